@@ -0,0 +1,107 @@
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "acct.h"
+
+static double tv_seconds(const struct timeval* tv) {
+  return tv->tv_sec + tv->tv_usec / 1e6;
+}
+
+static void tv_add(struct timeval* total, const struct timeval* tv, int sign) {
+  long usec = total->tv_usec + sign * tv->tv_usec;
+  total->tv_sec += sign * tv->tv_sec + (usec < 0 ? -1 : usec / 1000000);
+  total->tv_usec = usec < 0 ? usec + 1000000 : usec % 1000000;
+}
+
+/**
+ * @brief Adds the resources used by a child to a total, for the children of
+ * a pipeline or group.
+ *
+ * The times are summed, the largest resident set is kept.
+ */
+void rusage_add(struct rusage* total, const struct rusage* ru) {
+  tv_add(&total->ru_utime, &ru->ru_utime, 1);
+  tv_add(&total->ru_stime, &ru->ru_stime, 1);
+  if (ru->ru_maxrss > total->ru_maxrss) {
+    total->ru_maxrss = ru->ru_maxrss;
+  }
+}
+
+/**
+ * @brief Takes the times of an earlier reading from a total, leaving the
+ * times used in between.
+ */
+void rusage_sub(struct rusage* total, const struct rusage* ru) {
+  tv_add(&total->ru_utime, &ru->ru_utime, -1);
+  tv_add(&total->ru_stime, &ru->ru_stime, -1);
+}
+
+/**
+ * @brief Gets the seconds that have passed since a reading of the monotonic
+ * clock.
+ */
+double seconds_since(const struct timespec* start) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/**
+ * @brief Gets the descriptor named by {@code $NUSH_ACCT_FD}, where a line is
+ * written for every command that finishes.
+ *
+ * @return int is the descriptor, -1 if it is not set or not open.
+ */
+int acct_open_fd() {
+  char* env = getenv("NUSH_ACCT_FD");
+  if (env == NULL || *env == 0) {
+    return -1;
+  }
+  char* end;
+  long fd = strtol(env, &end, 10);
+  if (*end != 0 || fd < 0 || fd > 0xffff || fcntl(fd, F_GETFD) < 0) {
+    return -1;
+  }
+  return fd;
+}
+
+/**
+ * @brief Writes the accounting line of a finished command.
+ *
+ * The line is fields of key=value separated by spaces, with the command
+ * last since it can have spaces of its own. Times are in seconds and the
+ * resident set in kilobytes.
+ *
+ * @param fd      is where the line goes.
+ * @param pid     is the process that ran the command.
+ * @param status  is its status from {@code wait4}.
+ * @param cmd     is the text of the command.
+ * @param real    is the seconds it ran for.
+ * @param ru      is the resources it used.
+ */
+void acct_log(int fd, int pid, int status, const char* cmd, double real,
+              const struct rusage* ru) {
+  int code =
+      WIFSIGNALED(status) ? 128 + WTERMSIG(status) : WEXITSTATUS(status);
+  dprintf(fd, "pid=%d status=%d real=%.6f user=%.6f sys=%.6f maxrss=%ld cmd=%s\n",
+          pid, code, real, tv_seconds(&ru->ru_utime),
+          tv_seconds(&ru->ru_stime), ru->ru_maxrss, cmd);
+}
+
+static void print_time(FILE* out, const char* name, double secs) {
+  int mins = secs / 60;
+  fprintf(out, "%s\t%dm%.3fs\n", name, mins, secs - mins * 60);
+}
+
+/**
+ * @brief Prints the report of the time keyword.
+ */
+void print_times(FILE* out, double real, const struct rusage* ru) {
+  fputc('\n', out);
+  print_time(out, "real", real);
+  print_time(out, "user", tv_seconds(&ru->ru_utime));
+  print_time(out, "sys", tv_seconds(&ru->ru_stime));
+  fprintf(out, "maxrss\t%ldkB\n", ru->ru_maxrss);
+}
@@ -0,0 +1,21 @@
+#ifndef ACCT_H
+#define ACCT_H
+
+#include <stdio.h>
+#include <sys/resource.h>
+#include <time.h>
+
+void rusage_add(struct rusage* total, const struct rusage* ru);
+
+void rusage_sub(struct rusage* total, const struct rusage* ru);
+
+double seconds_since(const struct timespec* start);
+
+int acct_open_fd();
+
+void acct_log(int fd, int pid, int status, const char* cmd, double real,
+              const struct rusage* ru);
+
+void print_times(FILE* out, double real, const struct rusage* ru);
+
+#endif
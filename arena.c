@@ -0,0 +1,108 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+#define ARENA_ALIGN 16
+
+static arena_chunk* make_chunk(arena_chunk* prev, size_t cap) {
+  arena_chunk* chunk = malloc(sizeof(arena_chunk) + cap + ARENA_ALIGN);
+  assert(chunk != NULL);
+  chunk->prev = prev;
+  chunk->cap = cap + ARENA_ALIGN;
+  chunk->used = 0;
+  return chunk;
+}
+
+/**
+ * @brief Creates an {@code arena}.
+ *
+ * @param chunk_size is the size of the chunks allocations are made from.
+ * Larger allocations get a chunk of their own.
+ */
+arena* make_arena(size_t chunk_size) {
+  arena* ar = malloc(sizeof(arena));
+  ar->chunk_size = chunk_size;
+  ar->chunk = make_chunk(NULL, chunk_size);
+  ar->last = NULL;
+  return ar;
+}
+
+/**
+ * @brief Frees an {@code arena} and everything allocated from it.
+ */
+void free_arena(arena* ar) {
+  while (ar->chunk != NULL) {
+    arena_chunk* prev = ar->chunk->prev;
+    free(ar->chunk);
+    ar->chunk = prev;
+  }
+  free(ar);
+}
+
+/**
+ * @brief Allocates memory that stays valid until the next reset.
+ */
+void* arena_alloc(arena* ar, size_t size) {
+  arena_chunk* chunk = ar->chunk;
+  uintptr_t start = (uintptr_t)(chunk->data + chunk->used);
+  size_t pad = (ARENA_ALIGN - start % ARENA_ALIGN) % ARENA_ALIGN;
+
+  if (chunk->used + pad + size > chunk->cap) {
+    size_t cap = size > ar->chunk_size ? size : ar->chunk_size;
+    chunk = ar->chunk = make_chunk(chunk, cap);
+    start = (uintptr_t)chunk->data;
+    pad = (ARENA_ALIGN - start % ARENA_ALIGN) % ARENA_ALIGN;
+  }
+
+  chunk->used += pad + size;
+  ar->last = (void*)(start + pad);
+  return ar->last;
+}
+
+/**
+ * @brief Grows an allocation.
+ *
+ * The last allocation is grown in place when its chunk has room, anything
+ * else is copied to a new allocation.
+ */
+void* arena_realloc(arena* ar, void* ptr, size_t old_size, size_t new_size) {
+  if (ptr == NULL) {
+    return arena_alloc(ar, new_size);
+  }
+
+  arena_chunk* chunk = ar->chunk;
+  if (ptr == ar->last &&
+      (char*)ptr + new_size <= chunk->data + chunk->cap) {
+    chunk->used = (char*)ptr + new_size - chunk->data;
+    return ptr;
+  }
+
+  void* grown = arena_alloc(ar, new_size);
+  memcpy(grown, ptr, old_size);
+  return grown;
+}
+
+char* arena_strdup(arena* ar, const char* str) {
+  size_t size = strlen(str) + 1;
+  char* copy = arena_alloc(ar, size);
+  memcpy(copy, str, size);
+  return copy;
+}
+
+/**
+ * @brief Releases every allocation made from an {@code arena}.
+ *
+ * The first chunk is kept for reuse, chunks added for large lines are freed.
+ */
+void arena_reset(arena* ar) {
+  while (ar->chunk->prev != NULL) {
+    arena_chunk* prev = ar->chunk->prev;
+    free(ar->chunk);
+    ar->chunk = prev;
+  }
+  ar->chunk->used = 0;
+  ar->last = NULL;
+}
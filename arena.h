@@ -0,0 +1,38 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+typedef struct arena_chunk {
+  struct arena_chunk* prev;
+  size_t cap;
+  size_t used;
+  char data[];
+} arena_chunk;
+
+/**
+ * @brief A bump allocator for everything that lives as long as one command
+ * line.
+ *
+ * Allocations are carved out of large chunks and are never freed one by one,
+ * {@code arena_reset} releases all of them at once.
+ */
+typedef struct arena {
+  arena_chunk* chunk;  // The chunk being allocated from, the newest one.
+  size_t chunk_size;
+  void* last;  // The last allocation, which can be grown in place.
+} arena;
+
+arena* make_arena(size_t chunk_size);
+
+void free_arena(arena* ar);
+
+void* arena_alloc(arena* ar, size_t size);
+
+void* arena_realloc(arena* ar, void* ptr, size_t old_size, size_t new_size);
+
+char* arena_strdup(arena* ar, const char* str);
+
+void arena_reset(arena* ar);
+
+#endif
\ No newline at end of file
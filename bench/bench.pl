@@ -0,0 +1,80 @@
+#!/usr/bin/perl
+# End-to-end benchmarks of the shell: scripts are generated under tmp/bench,
+# each is run several times and the fastest run is reported, as a rate that
+# can be compared across versions.
+use 5.16.0;
+use warnings FATAL => 'all';
+
+use Time::HiRes qw(time);
+
+my $runs = 5;
+
+system("mkdir -p tmp/bench");
+$ENV{NUSH_CACHE_DIR} = "tmp/bench/cache";
+
+sub script {
+    my ($name, $text) = @_;
+    my $path = "tmp/bench/$name.sh";
+    open(my $fh, ">", $path) or die "$path: $!";
+    print $fh $text;
+    close($fh);
+    return $path;
+}
+
+# Gets the fastest time of running a script, in seconds.
+sub best {
+    my ($path) = @_;
+    my $best;
+    # The shell is run directly, not through sh, which would be timed too.
+    open(my $saved, ">&", \*STDOUT) or die "dup: $!";
+    open(STDOUT, ">", "/dev/null") or die "/dev/null: $!";
+    for (1 .. $runs) {
+        my $start = time();
+        my $rv = system("./nush", $path);
+        my $took = time() - $start;
+        $rv == 0 or die "$path failed";
+        $best = $took if !defined($best) || $took < $best;
+    }
+    open(STDOUT, ">&", $saved) or die "dup: $!";
+    return $best;
+}
+
+sub report {
+    my ($name, $value, $unit) = @_;
+    printf("%-28s %12.1f %s\n", $name, $value, $unit);
+}
+
+my $startup = best(script("empty", ""));
+report("startup", $startup * 1e6, "us");
+
+my $n = 20000;
+my $t = best(script("loop-builtin", "true\n" x $n));
+report("loop/builtin", $n / $t, "commands/s");
+
+$n = 2000;
+$t = best(script("loop-external", "/bin/true\n" x $n));
+report("loop/external", $n / $t, "commands/s");
+
+$n = 1000;
+$t = best(script("jobs", "/bin/true &\n" x $n . "wait\n"));
+report("jobs/background", $n / $t, "jobs/s");
+
+for my $depth (50, 500) {
+    $t = best(script("nest-$depth", "(" x $depth . "/bin/true" . ")" x $depth . "\n"));
+    report("nesting/plain $depth", ($t - $startup) / $depth * 1e6, "us/level");
+}
+
+# cd has to be kept from the shell, so every level is a process.
+my $depth = 50;
+$t = best(script("nest-cd", "(cd /; " x $depth . "/bin/true" . ")" x $depth . "\n"));
+report("nesting/forked $depth", ($t - $startup) / $depth * 1e6, "us/level");
+
+my $mb = 256;
+for my $stages (2, 8, 32) {
+    my $chain = "head -c ${mb}M /dev/zero" . " | cat" x ($stages - 1) . " | wc -c\n";
+    $t = best(script("pipe-$stages", $chain));
+    report("pipe/$stages stages", $mb / $t, "MB/s");
+}
+
+$t = best(script("pipe-redirect", "head -c ${mb}M /dev/zero | > /dev/null\n"));
+report("pipe/redirect stage", $mb / $t, "MB/s");
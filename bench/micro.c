@@ -0,0 +1,171 @@
+// Microbenchmarks of the tokenizer and the string vectors.
+//
+// Each benchmark is run for enough iterations to take a tenth of a second,
+// and the fastest of several runs is reported, which is the steadiest number
+// across runs on a busy machine.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "arena.h"
+#include "svec.h"
+#include "tokens.h"
+
+#define MIN_NS 100000000.0
+#define RUNS 5
+
+typedef void (*bench_fn)(void* ctx, long iters);
+
+/**
+ * @brief A line to tokenize, copied before each call since tokenize
+ * overwrites it.
+ */
+typedef struct line_case {
+  const char* text;
+  size_t len;
+  char* buf;
+  arena* ar;
+} line_case;
+
+static double now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double time_run(bench_fn fn, void* ctx, long iters) {
+  double start = now_ns();
+  fn(ctx, iters);
+  return now_ns() - start;
+}
+
+/**
+ * @brief Runs a benchmark and prints its time per call, and its throughput
+ * if each call handles {@code bytes} bytes.
+ */
+static void run(const char* name, bench_fn fn, void* ctx, size_t bytes) {
+  long iters = 1;
+  while (time_run(fn, ctx, iters) < MIN_NS / 10) {
+    iters *= 2;
+  }
+  iters = iters * 10;
+
+  double best = 0;
+  for (int ii = 0; ii < RUNS; ii++) {
+    double ns = time_run(fn, ctx, iters);
+    if (ii == 0 || ns < best) {
+      best = ns;
+    }
+  }
+  double per_op = best / iters;
+  printf("%-28s %12.1f ns/op", name, per_op);
+  if (bytes > 0) {
+    printf(" %10.1f MB/s", bytes / per_op * 1e3);
+  }
+  printf("\n");
+}
+
+static void bench_tokenize(void* ctx, long iters) {
+  line_case* lc = ctx;
+  for (long ii = 0; ii < iters; ii++) {
+    memcpy(lc->buf, lc->text, lc->len + 1);
+    tokenize(lc->ar, lc->buf);
+    arena_reset(lc->ar);
+  }
+}
+
+/**
+ * @brief Repeats a piece of a line until the line is at least {@code len}
+ * bytes.
+ */
+static char* repeat(const char* piece, size_t len) {
+  size_t piece_len = strlen(piece);
+  size_t count = (len + piece_len - 1) / piece_len;
+  char* text = malloc(count * piece_len + 1);
+  for (size_t ii = 0; ii < count; ii++) {
+    memcpy(text + ii * piece_len, piece, piece_len);
+  }
+  text[count * piece_len] = 0;
+  return text;
+}
+
+static void tokenize_case(const char* name, const char* text) {
+  line_case lc = {text, strlen(text), malloc(strlen(text) + 1),
+                  make_arena(64 * 1024)};
+  run(name, bench_tokenize, &lc, lc.len);
+  free(lc.buf);
+  free_arena(lc.ar);
+}
+
+#define NWORDS 1024
+
+static char* words[NWORDS];
+
+static void bench_push_reused(void* ctx, long iters) {
+  svec* sv = ctx;
+  for (long ii = 0; ii < iters; ii++) {
+    clear_svec(sv);
+    for (int jj = 0; jj < NWORDS; jj++) {
+      svec_push_back(sv, words[jj]);
+    }
+  }
+}
+
+static void bench_push_fresh(void* ctx, long iters) {
+  (void)ctx;
+  for (long ii = 0; ii < iters; ii++) {
+    svec* sv = make_svec(1);
+    for (int jj = 0; jj < NWORDS; jj++) {
+      svec_push_back(sv, words[jj]);
+    }
+    free_svec(sv);
+  }
+}
+
+static void bench_append(void* ctx, long iters) {
+  (void)ctx;
+  for (long ii = 0; ii < iters; ii++) {
+    svec* sv = make_svec(0);
+    for (int part = 0; part < 8; part++) {
+      svec* to_add = make_svec(0);
+      for (int jj = 0; jj < NWORDS / 8; jj++) {
+        svec_push_back(to_add, words[part * NWORDS / 8 + jj]);
+      }
+      append_svec(sv, to_add);
+    }
+    free_svec(sv);
+  }
+}
+
+int main() {
+  tokenize_case("tokenize/short", "echo hello world");
+  char* long_line = repeat("word ", 64 * 1024);
+  tokenize_case("tokenize/long (64K)", long_line);
+  free(long_line);
+  char* quotes = repeat("\"a b\" 'c d' e\\ f ", 4 * 1024);
+  tokenize_case("tokenize/quotes (4K)", quotes);
+  free(quotes);
+  char* ops = repeat("a|b&&c||d;e>f<g>>h 2>&1 (i) & ", 4 * 1024);
+  tokenize_case("tokenize/operators (4K)", ops);
+  free(ops);
+
+  for (int ii = 0; ii < NWORDS; ii++) {
+    char word[16];
+    snprintf(word, sizeof(word), "word%d", ii);
+    words[ii] = strdup(word);
+  }
+  svec* refs = make_svec(1);
+  run("svec/push 1K refs (reused)", bench_push_reused, refs, 0);
+  free_svec(refs);
+  svec* owned = make_svec(0);
+  run("svec/push 1K copies", bench_push_reused, owned, 0);
+  free_svec(owned);
+  run("svec/push 1K refs (fresh)", bench_push_fresh, NULL, 0);
+  run("svec/append 8x128", bench_append, NULL, 0);
+  for (int ii = 0; ii < NWORDS; ii++) {
+    free(words[ii]);
+  }
+  return 0;
+}
@@ -0,0 +1,749 @@
+#define _GNU_SOURCE
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdio_ext.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "builtins.h"
+#include "copy.h"
+#include "hash.h"
+#include "history.h"
+#include "jobs.h"
+#include "stats.h"
+#include "trace.h"
+
+// change directory, home if no directory is given
+static int builtin_cd(svec* argv, flags* flgs) {
+  (void)flgs;
+  char* dir = argv->size > 1 ? argv->data[1] : getenv("HOME");
+  if (dir == NULL || chdir(dir) != 0) {
+    perror("nush: cd");
+    return 1;
+  }
+  return 0;
+}
+
+// exit the program, with the last status if none is given. Nothing more runs
+// once it returns, the shell shuts down and a forked child exits.
+static int builtin_exit(svec* argv, flags* flgs) {
+  flgs->exiting = 1;
+  return argv->size > 1 ? atoi(argv->data[1]) : flgs->ret;
+}
+
+// list the recorded lines
+static int builtin_history(svec* argv, flags* flgs) {
+  (void)argv;
+  if (flgs->hist != NULL) {
+    history_print(flgs->hist, stdout);
+  }
+  return 0;
+}
+
+// list the remembered commands, forget them with -r, or remember more
+static int builtin_hash(svec* argv, flags* flgs) {
+  if (argv->size == 1) {
+    cmd_hash_print(flgs->cmds, stdout);
+    return 0;
+  }
+  int ret = 0;
+  for (int ii = 1; ii < argv->size; ii++) {
+    if (strcmp(argv->data[ii], "-r") == 0) {
+      cmd_hash_clear(flgs->cmds);
+    } else if (cmd_hash_lookup(flgs->cmds, argv->data[ii]) == NULL) {
+      fprintf(stderr, "nush: hash: %s: not found\n", argv->data[ii]);
+      ret = 1;
+    }
+  }
+  return ret;
+}
+
+// list the background jobs, or show or set the most running at once with
+// -j [N] (0 for no limit)
+static int builtin_jobs(svec* argv, flags* flgs) {
+  if (argv->size > 1 && strcmp(argv->data[1], "-j") == 0) {
+    if (argv->size > 2) {
+      flgs->jobs->max_jobs = atoi(argv->data[2]);
+      jobs_dispatch(flgs->jobs);
+    } else {
+      printf("%d\n", flgs->jobs->max_jobs);
+    }
+    return 0;
+  }
+  jobs_reap(flgs->jobs);
+  jobs_print(flgs->jobs, stdout);
+  return 0;
+}
+
+// wait for every job, the next one to finish (-n), or the given ones by PID
+// or %number
+static int builtin_wait(svec* argv, flags* flgs) {
+  if (argv->size == 1) {
+    jobs_wait_all(flgs->jobs);
+    return 0;
+  }
+  int ret = 0;
+  for (int ii = 1; ii < argv->size; ii++) {
+    char* arg = argv->data[ii];
+    if (strcmp(arg, "-n") == 0) {
+      ret = jobs_wait_next(flgs->jobs);
+      continue;
+    }
+    job* j = *arg == '%' ? jobs_find_id(flgs->jobs, atoi(arg + 1))
+                         : jobs_find(flgs->jobs, atoi(arg));
+    if (j == NULL) {
+      fprintf(stderr, "nush: wait: %s: no such job\n", arg);
+      ret = 127;
+    } else {
+      ret = jobs_wait(flgs->jobs, j);
+    }
+  }
+  return ret;
+}
+
+// print the counters of the work done by the shell, as key=value fields with
+// -m, or set them back to 0 with -r
+static int builtin_nushstat(svec* argv, flags* flgs) {
+  (void)flgs;
+  int machine = 0;
+  for (int ii = 1; ii < argv->size; ii++) {
+    if (strcmp(argv->data[ii], "-m") == 0) {
+      machine = 1;
+    } else if (strcmp(argv->data[ii], "-r") == 0) {
+      stats_reset();
+      return 0;
+    } else {
+      fprintf(stderr, "nush: nushstat: %s: invalid option\n", argv->data[ii]);
+      return 2;
+    }
+  }
+  stats_print(stdout, machine);
+  return 0;
+}
+
+// do nothing, successfully
+static int builtin_true(svec* argv, flags* flgs) {
+  (void)argv;
+  (void)flgs;
+  return 0;
+}
+
+// do nothing, unsuccessfully
+static int builtin_false(svec* argv, flags* flgs) {
+  (void)argv;
+  (void)flgs;
+  return 1;
+}
+
+// print the working directory
+static int builtin_pwd(svec* argv, flags* flgs) {
+  (void)argv;
+  (void)flgs;
+  char dir[PATH_MAX];
+  if (getcwd(dir, sizeof(dir)) == NULL) {
+    perror("nush: pwd");
+    return 1;
+  }
+  puts(dir);
+  return 0;
+}
+
+// copy the input to the output and to each file, appending to them with -a.
+// Input from a pipe is copied in the kernel, without a tee process.
+static int builtin_tee(svec* argv, flags* flgs) {
+  (void)flgs;
+  int append = argv->size > 1 && strcmp(argv->data[1], "-a") == 0;
+  int oflags = O_WRONLY | O_CREAT | O_CLOEXEC | (append ? O_APPEND : O_TRUNC);
+  int fds[argv->size + 1];
+  int nout = 0;
+  int ret = 0;
+  for (int ii = 1 + append; ii < argv->size; ii++) {
+    int fd = open(argv->data[ii], oflags, 0644);
+    if (fd < 0) {
+      fprintf(stderr, "nush: tee: %s: %s\n", argv->data[ii], strerror(errno));
+      ret = 1;
+      continue;
+    }
+    fds[nout++] = fd;
+  }
+
+  // The output goes last, it is spliced straight from the input.
+  fflush(stdout);
+  fds[nout++] = 1;
+  ssize_t copied = tee_stream(0, fds, nout);
+  STATS_ADD(copied, copied > 0 ? copied : 0);
+  nout--;
+  if (copied < 0) {
+    perror("nush: tee");
+    ret = 1;
+  }
+
+  for (int ii = 0; ii < nout; ii++) {
+    close(fds[ii]);
+  }
+  return ret;
+}
+
+/**
+ * @brief Writes the character of the backslash escape at {@code str}, like
+ * printf and echo -e do.
+ *
+ * @param str     is just past the backslash.
+ * @param out     is where the character goes.
+ * @param octal0  is if octal escapes start with \0, as for echo and %b, and
+ * may then have 3 more digits.
+ * @return int    is how many characters of {@code str} were used, or -1 for
+ * \c, which ends the output.
+ */
+static int put_escape(const char* str, FILE* out, int octal0) {
+  switch (*str) {
+    case 'a':
+      putc('\a', out);
+      return 1;
+    case 'b':
+      putc('\b', out);
+      return 1;
+    case 'c':
+      return -1;
+    case 'e':
+      putc('\033', out);
+      return 1;
+    case 'f':
+      putc('\f', out);
+      return 1;
+    case 'n':
+      putc('\n', out);
+      return 1;
+    case 'r':
+      putc('\r', out);
+      return 1;
+    case 't':
+      putc('\t', out);
+      return 1;
+    case 'v':
+      putc('\v', out);
+      return 1;
+    case '\\':
+      putc('\\', out);
+      return 1;
+    case 'x': {
+      int used = 1;
+      int value = 0;
+      for (; used < 3 && isxdigit((unsigned char)str[used]); used++) {
+        char digit = str[used];
+        value = value * 16 + (isdigit(digit) ? digit - '0'
+                                             : (digit | 0x20) - 'a' + 10);
+      }
+      if (used == 1) {
+        fputs("\\x", out);
+      } else {
+        putc(value, out);
+      }
+      return used;
+    }
+    default:
+      if (*str >= '0' && *str <= '7') {
+        int skip = octal0 && *str == '0';
+        int used = skip;
+        int value = 0;
+        for (; used < 3 + skip && str[used] >= '0' && str[used] <= '7';
+             used++) {
+          value = value * 8 + str[used] - '0';
+        }
+        putc(value, out);
+        return used;
+      }
+      putc('\\', out);
+      return 0;
+  }
+}
+
+/**
+ * @brief Writes a string with its backslash escapes replaced.
+ *
+ * @return int is 0, or -1 if a \c ended the output.
+ */
+static int put_escaped(const char* str, FILE* out, int octal0) {
+  for (; *str; str++) {
+    if (*str != '\\' || str[1] == 0) {
+      putc(*str, out);
+      continue;
+    }
+    int used = put_escape(str + 1, out, octal0);
+    if (used < 0) {
+      return -1;
+    }
+    str += used;
+  }
+  return 0;
+}
+
+// print the arguments separated by spaces. -n leaves out the newline, -e
+// replaces backslash escapes and -E does not.
+static int builtin_echo(svec* argv, flags* flgs) {
+  (void)flgs;
+  int newline = 1;
+  int escapes = 0;
+  int ii = 1;
+  for (; ii < argv->size; ii++) {
+    char* arg = argv->data[ii];
+    if (arg[0] != '-' || arg[1] == 0 ||
+        strspn(arg + 1, "neE") != strlen(arg + 1)) {
+      break;
+    }
+    for (arg++; *arg; arg++) {
+      if (*arg == 'n') {
+        newline = 0;
+      } else {
+        escapes = *arg == 'e';
+      }
+    }
+  }
+
+  for (int first = ii; ii < argv->size; ii++) {
+    if (ii > first) {
+      putchar(' ');
+    }
+    if (!escapes) {
+      fputs(argv->data[ii], stdout);
+    } else if (put_escaped(argv->data[ii], stdout, 1) != 0) {
+      return 0;
+    }
+  }
+  if (newline) {
+    putchar('\n');
+  }
+  return 0;
+}
+
+/**
+ * @brief Converts an argument of printf to a number. A leading quote gives
+ * the code of the character after it.
+ *
+ * @param value is the argument, NULL for a missing one, which is 0.
+ * @param ret   is set to 1 if the argument is not a number.
+ */
+static long long printf_integer(const char* value, int* ret) {
+  if (value == NULL) {
+    return 0;
+  }
+  if (*value == '\'' || *value == '"') {
+    return (unsigned char)value[1];
+  }
+  char* end;
+  errno = 0;
+  long long number = strtoll(value, &end, 0);
+  if (*value == 0 || *end != 0 || errno != 0) {
+    fprintf(stderr, "nush: printf: %s: invalid number\n", value);
+    *ret = 1;
+  }
+  return number;
+}
+
+static double printf_double(const char* value, int* ret) {
+  if (value == NULL) {
+    return 0;
+  }
+  char* end;
+  double number = strtod(value, &end);
+  if (*value == 0 || *end != 0) {
+    fprintf(stderr, "nush: printf: %s: invalid number\n", value);
+    *ret = 1;
+  }
+  return number;
+}
+
+// print the arguments through a format, which is used again for as long as
+// arguments are left
+static int builtin_printf(svec* argv, flags* flgs) {
+  (void)flgs;
+  if (argv->size < 2) {
+    fprintf(stderr, "nush: printf: usage: printf format [arguments]\n");
+    return 2;
+  }
+  const char* format = argv->data[1];
+  int arg = 2;
+  int ret = 0;
+
+  do {
+    int first_arg = arg;
+    for (const char* ff = format; *ff; ff++) {
+      if (*ff == '\\' && ff[1] != 0) {
+        int used = put_escape(ff + 1, stdout, 0);
+        if (used < 0) {
+          return ret;
+        }
+        ff += used;
+        continue;
+      } else if (*ff != '%') {
+        putchar(*ff);
+        continue;
+      } else if (ff[1] == '%') {
+        putchar('%');
+        ff++;
+        continue;
+      }
+
+      // The flags, width and precision are passed on to the real printf,
+      // with the size of the value it is given.
+      char spec[32];
+      size_t len = 1 + strspn(ff + 1, "-+ #0123456789.");
+      char conv = ff[len];
+      if (len + 3 >= sizeof(spec) || conv == 0 ||
+          strchr("diouxXcsbfeEgGaA", conv) == NULL) {
+        fprintf(stderr, "nush: printf: %s: invalid format\n", ff);
+        return 1;
+      }
+      memcpy(spec, ff, len);
+      ff += len;
+      char* value = arg < argv->size ? argv->data[arg++] : NULL;
+
+      switch (conv) {
+        case 'd':
+        case 'i':
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+          memcpy(spec + len, "ll", 2);
+          spec[len + 2] = conv;
+          spec[len + 3] = 0;
+          printf(spec, printf_integer(value, &ret));
+          break;
+        case 'c':
+          if (value != NULL && *value != 0) {
+            spec[len] = 'c';
+            spec[len + 1] = 0;
+            printf(spec, *value);
+          }
+          break;
+        case 's':
+          spec[len] = 's';
+          spec[len + 1] = 0;
+          printf(spec, value != NULL ? value : "");
+          break;
+        case 'b':
+          if (value != NULL && put_escaped(value, stdout, 1) != 0) {
+            return ret;
+          }
+          break;
+        default:
+          spec[len] = conv;
+          spec[len + 1] = 0;
+          printf(spec, printf_double(value, &ret));
+      }
+    }
+    if (arg == first_arg) {
+      break;
+    }
+  } while (arg < argv->size);
+  return ret;
+}
+
+/**
+ * @brief The state of evaluating the expression of test.
+ */
+typedef struct test_state {
+  svec* argv;
+  int pos;
+  int end;
+  int error;
+} test_state;
+
+static int test_or(test_state* ts);
+
+static void test_error(test_state* ts, const char* arg, const char* msg) {
+  if (!ts->error) {
+    fprintf(stderr, "nush: %s: %s%s%s\n", ts->argv->data[0], arg ? arg : "",
+            arg ? ": " : "", msg);
+  }
+  ts->error = 1;
+}
+
+static int is_binary_test(const char* op) {
+  static const char* ops[] = {"=",   "==",  "!=",  "-eq", "-ne", "-lt", "-le",
+                              "-gt", "-ge", "-nt", "-ot", "-ef", NULL};
+  for (int ii = 0; ops[ii] != NULL; ii++) {
+    if (strcmp(op, ops[ii]) == 0) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int is_unary_test(const char* op) {
+  return op[0] == '-' && op[1] != 0 && op[2] == 0 &&
+         strchr("bcdefghLnprsStuwxz", op[1]) != NULL;
+}
+
+static int test_unary(char op, const char* arg) {
+  struct stat st;
+  switch (op) {
+    case 'n':
+      return *arg != 0;
+    case 'z':
+      return *arg == 0;
+    case 't':
+      return isatty(atoi(arg));
+    case 'h':
+    case 'L':
+      return lstat(arg, &st) == 0 && S_ISLNK(st.st_mode);
+    case 'r':
+      return access(arg, R_OK) == 0;
+    case 'w':
+      return access(arg, W_OK) == 0;
+    case 'x':
+      return access(arg, X_OK) == 0;
+  }
+  if (stat(arg, &st) != 0) {
+    return 0;
+  }
+  switch (op) {
+    case 'b':
+      return S_ISBLK(st.st_mode);
+    case 'c':
+      return S_ISCHR(st.st_mode);
+    case 'd':
+      return S_ISDIR(st.st_mode);
+    case 'f':
+      return S_ISREG(st.st_mode);
+    case 'g':
+      return (st.st_mode & S_ISGID) != 0;
+    case 'p':
+      return S_ISFIFO(st.st_mode);
+    case 's':
+      return st.st_size > 0;
+    case 'S':
+      return S_ISSOCK(st.st_mode);
+    case 'u':
+      return (st.st_mode & S_ISUID) != 0;
+    default:
+      return 1;
+  }
+}
+
+static long long test_integer(test_state* ts, const char* arg) {
+  char* end;
+  errno = 0;
+  long long value = strtoll(arg, &end, 10);
+  while (isspace((unsigned char)*end)) {
+    end++;
+  }
+  if (*arg == 0 || *end != 0 || errno != 0) {
+    test_error(ts, arg, "integer expression expected");
+  }
+  return value;
+}
+
+/**
+ * @brief Compares two files by modification time, a missing file being
+ * older than any other.
+ */
+static int compare_mtimes(const char* left, const char* right) {
+  struct stat lst;
+  struct stat rst;
+  int lok = stat(left, &lst) == 0;
+  int rok = stat(right, &rst) == 0;
+  if (!lok || !rok) {
+    return lok - rok;
+  }
+  if (lst.st_mtim.tv_sec != rst.st_mtim.tv_sec) {
+    return lst.st_mtim.tv_sec < rst.st_mtim.tv_sec ? -1 : 1;
+  }
+  return (lst.st_mtim.tv_nsec > rst.st_mtim.tv_nsec) -
+         (lst.st_mtim.tv_nsec < rst.st_mtim.tv_nsec);
+}
+
+static int test_binary(test_state* ts, const char* left, const char* op,
+                       const char* right) {
+  if (strcmp(op, "=") == 0 || strcmp(op, "==") == 0) {
+    return strcmp(left, right) == 0;
+  } else if (strcmp(op, "!=") == 0) {
+    return strcmp(left, right) != 0;
+  } else if (strcmp(op, "-nt") == 0) {
+    return compare_mtimes(left, right) > 0;
+  } else if (strcmp(op, "-ot") == 0) {
+    return compare_mtimes(left, right) < 0;
+  } else if (strcmp(op, "-ef") == 0) {
+    struct stat lst;
+    struct stat rst;
+    return stat(left, &lst) == 0 && stat(right, &rst) == 0 &&
+           lst.st_dev == rst.st_dev && lst.st_ino == rst.st_ino;
+  }
+
+  long long lval = test_integer(ts, left);
+  long long rval = test_integer(ts, right);
+  switch (op[1] << 8 | op[2]) {
+    case 'e' << 8 | 'q':
+      return lval == rval;
+    case 'n' << 8 | 'e':
+      return lval != rval;
+    case 'l' << 8 | 't':
+      return lval < rval;
+    case 'l' << 8 | 'e':
+      return lval <= rval;
+    case 'g' << 8 | 't':
+      return lval > rval;
+    default:
+      return lval >= rval;
+  }
+}
+
+/**
+ * @brief Evaluates a binary or unary test, a parenthesized expression or a
+ * lone string, which is true if it is not empty.
+ *
+ * A binary operator is looked for first, so that operators can also be
+ * compared as strings.
+ */
+static int test_primary(test_state* ts) {
+  char** args = ts->argv->data;
+  int left = ts->end - ts->pos;
+  if (left <= 0) {
+    test_error(ts, NULL, "argument expected");
+    return 0;
+  }
+  char* arg = args[ts->pos];
+
+  if (left >= 3 && is_binary_test(args[ts->pos + 1])) {
+    ts->pos += 3;
+    return test_binary(ts, arg, args[ts->pos - 2], args[ts->pos - 1]);
+  }
+  if (strcmp(arg, "(") == 0 && left > 1) {
+    ts->pos++;
+    int value = test_or(ts);
+    if (ts->pos >= ts->end || strcmp(args[ts->pos], ")") != 0) {
+      test_error(ts, NULL, "`)' expected");
+    }
+    ts->pos++;
+    return value;
+  }
+  if (is_unary_test(arg) && left >= 2) {
+    ts->pos += 2;
+    return test_unary(arg[1], args[ts->pos - 1]);
+  }
+  ts->pos++;
+  return *arg != 0;
+}
+
+static int test_not(test_state* ts) {
+  if (ts->end - ts->pos > 1 && strcmp(ts->argv->data[ts->pos], "!") == 0) {
+    ts->pos++;
+    return !test_not(ts);
+  }
+  return test_primary(ts);
+}
+
+static int test_and(test_state* ts) {
+  int value = test_not(ts);
+  while (ts->pos < ts->end && strcmp(ts->argv->data[ts->pos], "-a") == 0) {
+    ts->pos++;
+    int right = test_not(ts);
+    value = value && right;
+  }
+  return value;
+}
+
+static int test_or(test_state* ts) {
+  int value = test_and(ts);
+  while (ts->pos < ts->end && strcmp(ts->argv->data[ts->pos], "-o") == 0) {
+    ts->pos++;
+    int right = test_and(ts);
+    value = value || right;
+  }
+  return value;
+}
+
+// evaluate an expression of strings, numbers and files: 0 if it is true, 1
+// if it is false and 2 if it is not an expression. [ needs a closing ].
+static int builtin_test(svec* argv, flags* flgs) {
+  (void)flgs;
+  test_state ts = {argv, 1, argv->size, 0};
+  if (strcmp(argv->data[0], "[") == 0) {
+    if (strcmp(argv->data[argv->size - 1], "]") != 0) {
+      fprintf(stderr, "nush: [: missing `]'\n");
+      return 2;
+    }
+    ts.end--;
+  }
+  if (ts.pos == ts.end) {
+    return 1;
+  }
+
+  int value = test_or(&ts);
+  if (ts.pos < ts.end) {
+    test_error(&ts, ts.argv->data[ts.pos], "unexpected argument");
+  }
+  return ts.error ? 2 : !value;
+}
+
+// Sorted by name for bsearch.
+static builtin builtins[] = {
+    {":", builtin_true, 0},         {"[", builtin_test, 0},
+    {"cd", builtin_cd, 1},          {"echo", builtin_echo, 0},
+    {"exit", builtin_exit, 1},      {"false", builtin_false, 0},
+    {"hash", builtin_hash, 1},      {"history", builtin_history, 0},
+    {"jobs", builtin_jobs, 1},      {"nushstat", builtin_nushstat, 1},
+    {"printf", builtin_printf, 0},  {"pwd", builtin_pwd, 0},
+    {"tee", builtin_tee, 0},        {"test", builtin_test, 0},
+    {"true", builtin_true, 0},      {"wait", builtin_wait, 1},
+};
+
+static int compare_builtin(const void* name, const void* bi) {
+  return strcmp(name, ((const builtin*)bi)->name);
+}
+
+/**
+ * @brief Finds a builtin by name.
+ *
+ * @return builtin* is the builtin, NULL if the name is not one.
+ */
+builtin* find_builtin(const char* name) {
+  return bsearch(name, builtins, sizeof(builtins) / sizeof(builtin),
+                 sizeof(builtin), compare_builtin);
+}
+
+/**
+ * @brief Checks if a command is run by the shell itself.
+ */
+int is_builtin(char* name) {
+  return find_builtin(name) != NULL;
+}
+
+/**
+ * @brief Checks if a builtin changes the state of the shell it runs in, so
+ * that running it outside a subshell would be visible.
+ */
+int builtin_changes_shell(char* name) {
+  builtin* bi = find_builtin(name);
+  return bi != NULL && bi->changes_shell;
+}
+
+/**
+ * @brief Runs a builtin command in the current process.
+ *
+ * What it prints is flushed before it returns, so that it comes before the
+ * output of whatever runs next. A failed write is reported, and what could
+ * not be written is dropped.
+ *
+ * @param argv  is the builtin and its arguments.
+ * @param flgs  is the (current) flags to use.
+ * @return int  is the exit status of the builtin.
+ */
+int execute_builtin(svec* argv, flags* flgs) {
+  builtin* bi = find_builtin(argv->data[0]);
+  int ret = bi->run(argv, flgs);
+  if (fflush(stdout) != 0 || ferror(stdout)) {
+    fprintf(stderr, "nush: %s: write error: %s\n", bi->name, strerror(errno));
+    __fpurge(stdout);
+    clearerr(stdout);
+    ret = 1;
+  }
+  return ret;
+}
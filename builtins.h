@@ -0,0 +1,26 @@
+#ifndef BUILTINS_H
+#define BUILTINS_H
+
+#include "flags.h"
+#include "svec.h"
+
+typedef int (*builtin_fn)(svec* argv, flags* flgs);
+
+/**
+ * @brief A command run by the shell itself.
+ */
+typedef struct builtin {
+  const char* name;
+  builtin_fn run;
+  int changes_shell;  // running it outside a subshell would be visible
+} builtin;
+
+builtin* find_builtin(const char* name);
+
+int is_builtin(char* name);
+
+int builtin_changes_shell(char* name);
+
+int execute_builtin(svec* argv, flags* flgs);
+
+#endif
@@ -0,0 +1,527 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "cache.h"
+#include "reader.h"
+#include "tokens.h"
+#include "trace.h"
+
+#define CACHE_MAGIC "NUSHCC02"
+
+/**
+ * @brief A cache file being written, grown by doubling.
+ */
+typedef struct out_buf {
+  char* data;
+  size_t len;
+  size_t cap;
+} out_buf;
+
+// FNV-1a
+static uint64_t hash_bytes(const void* data, size_t len, uint64_t hash) {
+  const unsigned char* bytes = data;
+  for (size_t ii = 0; ii < len; ii++) {
+    hash = (hash ^ bytes[ii]) * 1099511628211u;
+  }
+  return hash;
+}
+
+#define HASH_START 14695981039346656037u
+
+/**
+ * @brief Appends bytes to a cache file.
+ *
+ * @param align is what the offset must be a multiple of, a power of two.
+ * @return uint64_t is the offset they were put at, never 0 since the header
+ * is there.
+ */
+static uint64_t put_aligned(out_buf* out, const void* src, size_t size,
+                            size_t align) {
+  size_t off = (out->len + align - 1) & ~(align - 1);
+  while (off + size > out->cap) {
+    out->cap *= 2;
+    out->data = realloc(out->data, out->cap);
+  }
+  memset(out->data + out->len, 0, off - out->len);
+  memcpy(out->data + off, src, size);
+  out->len = off + size;
+  return off;
+}
+
+/**
+ * @brief Appends bytes to a cache file, aligned for any of the structs in
+ * it.
+ */
+static uint64_t put(out_buf* out, const void* src, size_t size) {
+  return put_aligned(out, src, size, 8);
+}
+
+static uint64_t put_str(out_buf* out, const char* str) {
+  return put_aligned(out, str, strlen(str) + 1, 1);
+}
+
+#define AS_OFFSET(off) ((void*)(uintptr_t)(off))
+
+/**
+ * @brief Appends a tree to a cache file, children first.
+ *
+ * The argument vectors get room for the NULL pushed before exec, so running
+ * a command never grows them.
+ *
+ * @return uint64_t is the offset of the root, 0 for NULL.
+ */
+static uint64_t put_node(out_buf* out, node* n) {
+  if (n == NULL) {
+    return 0;
+  }
+  node copy = *n;
+
+  if (n->nkids > 0) {
+    uint64_t kids[n->nkids];
+    for (int ii = 0; ii < n->nkids; ii++) {
+      kids[ii] = put_node(out, n->kids[ii]);
+    }
+    copy.kids = AS_OFFSET(put(out, kids, sizeof(kids)));
+  }
+  if (n->ops != NULL) {
+    copy.ops = AS_OFFSET(put(out, n->ops, n->nkids * sizeof(tok_type)));
+  }
+  copy.body = AS_OFFSET(put_node(out, n->body));
+
+  if (n->argv != NULL) {
+    uint64_t words[n->argv->size + 1];
+    for (int ii = 0; ii < n->argv->size; ii++) {
+      words[ii] = put_str(out, n->argv->data[ii]);
+    }
+    words[n->argv->size] = 0;
+    svec argv = {n->argv->size, n->argv->size + 1, NULL, 1, NULL};
+    argv.data = AS_OFFSET(put(out, words, sizeof(words)));
+    copy.argv = AS_OFFSET(put(out, &argv, sizeof(argv)));
+  }
+
+  if (n->nreds > 0) {
+    redir reds[n->nreds];
+    for (int ii = 0; ii < n->nreds; ii++) {
+      reds[ii] = n->reds[ii];
+      reds[ii].target = AS_OFFSET(put_str(out, n->reds[ii].target));
+    }
+    copy.reds = AS_OFFSET(put(out, reds, sizeof(reds)));
+  }
+
+  return put(out, &copy, sizeof(node));
+}
+
+/**
+ * @brief Finds what an offset stored in a loaded cache refers to, without
+ * writing to the cache.
+ *
+ * @param field  holds the offset.
+ * @param ptr    is set to the address, or NULL for a zero offset.
+ * @return int is 0, or -1 if the offset does not leave room for
+ * {@code size} bytes in the file.
+ */
+static int resolve(const cache_header* hdr, const void* field, size_t size,
+                   const void** ptr) {
+  uintptr_t off;
+  memcpy(&off, field, sizeof(off));
+  *ptr = NULL;
+  if (off == 0) {
+    return 0;
+  }
+  if (off < sizeof(cache_header) || off > hdr->length ||
+      size > hdr->length - off) {
+    return -1;
+  }
+  *ptr = (const char*)hdr + off;
+  return 0;
+}
+
+static int resolve_str(const cache_header* hdr, const void* field,
+                       const char** str) {
+  if (resolve(hdr, field, 1, (const void**)str) != 0) {
+    return -1;
+  }
+  const char* end = (const char*)hdr + hdr->length;
+  return *str == NULL || memchr(*str, 0, end - *str) != NULL ? 0 : -1;
+}
+
+/**
+ * @brief Checks that the offsets of a tree in a loaded cache all stay in
+ * the file.
+ *
+ * @return int is 0, or -1 if the cache is corrupt.
+ */
+static int check_node(const cache_header* hdr, const void* field) {
+  const node* n;
+  if (resolve(hdr, field, sizeof(node), (const void**)&n) != 0) {
+    return -1;
+  }
+  if (n == NULL) {
+    return 0;
+  }
+  const void* kids;
+  const void* ops;
+  const svec* argv;
+  const redir* reds;
+  if (n->nkids < 0 || n->nreds < 0 ||
+      resolve(hdr, &n->kids, n->nkids * sizeof(node*), &kids) != 0 ||
+      resolve(hdr, &n->ops, n->nkids * sizeof(tok_type), &ops) != 0 ||
+      check_node(hdr, &n->body) != 0 ||
+      resolve(hdr, &n->argv, sizeof(svec), (const void**)&argv) != 0 ||
+      resolve(hdr, &n->reds, n->nreds * sizeof(redir),
+              (const void**)&reds) != 0) {
+    return -1;
+  }
+  for (int ii = 0; ii < n->nkids; ii++) {
+    if (check_node(hdr, (node* const*)kids + ii) != 0) {
+      return -1;
+    }
+  }
+  if (argv != NULL) {
+    const void* data;
+    const char* word;
+    if (argv->size < 0 || argv->cap != argv->size + 1 ||
+        resolve(hdr, &argv->data, argv->cap * sizeof(char*), &data) != 0) {
+      return -1;
+    }
+    for (int ii = 0; ii < argv->size; ii++) {
+      if (resolve_str(hdr, (char* const*)data + ii, &word) != 0) {
+        return -1;
+      }
+    }
+  }
+  for (int ii = 0; ii < n->nreds; ii++) {
+    const char* target;
+    if (resolve_str(hdr, &reds[ii].target, &target) != 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Copies a checked tree out of a loaded cache into an arena, turning
+ * its offsets into pointers. Words, targets and operators are left in the
+ * cache, which is never written to, so its pages stay shared.
+ */
+static node* load_node(const cache_header* hdr, const void* field,
+                       arena* ar) {
+  const node* src;
+  resolve(hdr, field, sizeof(node), (const void**)&src);
+  if (src == NULL) {
+    return NULL;
+  }
+  node* n = arena_alloc(ar, sizeof(node));
+  *n = *src;
+  const void* ptr;
+  resolve(hdr, &src->kids, 0, &ptr);
+  if (ptr != NULL) {
+    n->kids = arena_alloc(ar, n->nkids * sizeof(node*));
+    for (int ii = 0; ii < n->nkids; ii++) {
+      n->kids[ii] = load_node(hdr, (node* const*)ptr + ii, ar);
+    }
+  }
+  resolve(hdr, &src->ops, 0, &ptr);
+  n->ops = (tok_type*)ptr;
+  n->body = load_node(hdr, &src->body, ar);
+
+  resolve(hdr, &src->argv, 0, &ptr);
+  if (ptr != NULL) {
+    const svec* words = ptr;
+    svec* argv = arena_alloc(ar, sizeof(svec));
+    *argv = *words;
+    argv->ar = ar;
+    argv->data = arena_alloc(ar, argv->cap * sizeof(char*));
+    resolve(hdr, &words->data, 0, &ptr);
+    for (int ii = 0; ii < argv->size; ii++) {
+      resolve_str(hdr, (char* const*)ptr + ii, (const char**)argv->data + ii);
+    }
+    n->argv = argv;
+  }
+
+  resolve(hdr, &src->reds, 0, &ptr);
+  if (ptr != NULL) {
+    n->reds = arena_alloc(ar, n->nreds * sizeof(redir));
+    memcpy(n->reds, ptr, n->nreds * sizeof(redir));
+    for (int ii = 0; ii < n->nreds; ii++) {
+      resolve_str(hdr, &n->reds[ii].target, (const char**)&n->reds[ii].target);
+    }
+  }
+  return n;
+}
+
+/**
+ * @brief Finds the lines of a cache and checks all of their offsets.
+ *
+ * @return compiled* is the script, or NULL if the cache is corrupt, in which
+ * case it is released.
+ */
+static compiled* make_compiled(cache_header* hdr, int mapped) {
+  compiled* prog = malloc(sizeof(compiled));
+  prog->hdr = hdr;
+  prog->mapped = mapped;
+  prog->nlines = hdr->nlines;
+  const void* lines;
+  int ok = resolve(hdr, &hdr->lines, hdr->nlines * sizeof(uint64_t),
+                   &lines) == 0;
+  prog->lines = lines;
+  for (uint32_t ii = 0; ok && ii < hdr->nlines; ii++) {
+    ok = check_node(hdr, prog->lines + ii) == 0;
+  }
+  if (!ok) {
+    free_compiled(prog);
+    return NULL;
+  }
+  return prog;
+}
+
+/**
+ * @brief Gets a line of a compiled script, ready to run.
+ *
+ * @param ii  is the line, less than {@code prog->nlines}.
+ * @param ar  is where the tree is put, the cache itself is only read.
+ */
+node* compiled_line(compiled* prog, uint32_t ii, arena* ar) {
+  return load_node(prog->hdr, prog->lines + ii, ar);
+}
+
+void free_compiled(compiled* prog) {
+  if (prog->mapped) {
+    munmap(prog->hdr, prog->hdr->length);
+  } else {
+    free(prog->hdr);
+  }
+  free(prog);
+}
+
+/**
+ * @brief Hashes the contents of a script.
+ */
+static uint64_t hash_file(int fd, size_t size) {
+  if (size == 0) {
+    return HASH_START;
+  }
+  void* data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (data == MAP_FAILED) {
+    return 0;
+  }
+  uint64_t hash = hash_bytes(data, size, HASH_START);
+  munmap(data, size);
+  return hash;
+}
+
+/**
+ * @brief Gets where the cache of a script goes: a file named after the
+ * hash of its real path in {@code $NUSH_CACHE_DIR}, or in
+ * {@code $XDG_CACHE_HOME/nush} or {@code ~/.cache/nush} if unset. The
+ * directories are created if needed.
+ *
+ * @return int is 0, or -1 if caching is off because {@code $NUSH_CACHE_DIR}
+ * is empty or there is no home.
+ */
+static int cache_path(const char* real, char* buf, size_t size) {
+  char dir[PATH_MAX];
+  char* env = getenv("NUSH_CACHE_DIR");
+  if (env != NULL) {
+    if (*env == 0) {
+      return -1;
+    }
+    snprintf(dir, sizeof(dir), "%s", env);
+  } else if ((env = getenv("XDG_CACHE_HOME")) != NULL && *env != 0) {
+    mkdir(env, 0700);
+    snprintf(dir, sizeof(dir), "%s/nush", env);
+  } else if ((env = getenv("HOME")) != NULL) {
+    snprintf(dir, sizeof(dir), "%s/.cache", env);
+    mkdir(dir, 0700);
+    snprintf(dir, sizeof(dir), "%s/.cache/nush", env);
+  } else {
+    return -1;
+  }
+  mkdir(dir, 0700);
+  snprintf(buf, size, "%s/%016llx.nushc", dir,
+           (unsigned long long)hash_bytes(real, strlen(real), HASH_START));
+  return 0;
+}
+
+/**
+ * @brief Maps the cache of a script, if it has one that is up to date.
+ *
+ * A cache whose script has a new modification time but the same contents is
+ * still used, and is given the new time.
+ */
+static compiled* open_cache(const char* cpath, const char* real, int fd,
+                            struct stat* st) {
+  int cfd = open(cpath, O_RDWR | O_CLOEXEC);
+  if (cfd < 0) {
+    return NULL;
+  }
+  struct stat cst;
+  cache_header* hdr = MAP_FAILED;
+  if (fstat(cfd, &cst) == 0 && (size_t)cst.st_size >= sizeof(cache_header)) {
+    hdr = mmap(NULL, cst.st_size, PROT_READ, MAP_PRIVATE, cfd, 0);
+  }
+  if (hdr == MAP_FAILED) {
+    close(cfd);
+    return NULL;
+  }
+
+  const char* cached;
+  int ok = memcmp(hdr->magic, CACHE_MAGIC, 8) == 0 &&
+           hdr->length == (uint64_t)cst.st_size &&
+           hdr->node_size == sizeof(node) &&
+           hdr->size == (uint64_t)st->st_size &&
+           resolve_str(hdr, &hdr->path, &cached) == 0 &&
+           cached != NULL && strcmp(cached, real) == 0;
+  if (ok && (hdr->mtime_sec != st->st_mtim.tv_sec ||
+             hdr->mtime_nsec != st->st_mtim.tv_nsec)) {
+    ok = hdr->hash == hash_file(fd, st->st_size);
+    if (ok) {
+      cache_header fresh = *hdr;
+      fresh.mtime_sec = st->st_mtim.tv_sec;
+      fresh.mtime_nsec = st->st_mtim.tv_nsec;
+      pwrite(cfd, &fresh, sizeof(cache_header), 0);
+    }
+  }
+  close(cfd);
+
+  if (!ok) {
+    munmap(hdr, cst.st_size);
+    return NULL;
+  }
+  return make_compiled(hdr, 1);
+}
+
+/**
+ * @brief Parses every line of a script into a new cache.
+ *
+ * @return out_buf is the cache, with a NULL data if a line does not parse.
+ */
+static out_buf compile(const char* real, int fd, struct stat* st) {
+  out_buf out = {malloc(64 * 1024), 0, 64 * 1024};
+  cache_header hdr;
+  memset(&hdr, 0, sizeof(hdr));
+  put(&out, &hdr, sizeof(hdr));
+
+  size_t nlines = 0;
+  size_t cap = 64;
+  uint64_t* lines = malloc(cap * sizeof(uint64_t));
+  arena* ar = make_arena(64 * 1024);
+  reader* rd = map_reader(fd);
+  // The mapping is hashed before its lines are tokenized in place.
+  uint64_t hash = rd->mapped ? hash_bytes(rd->buf, rd->end, HASH_START)
+                             : hash_file(fd, st->st_size);
+  char* line;
+  while ((line = reader_line(rd, NULL)) != NULL) {
+    node* tree;
+    uint64_t start = trace_begin();
+    tvec* tokens = tokenize(ar, line);
+    trace_text("tokenize", start, NULL, 0);
+    start = trace_begin();
+    int rv = parse(ar, tokens, &tree, NULL);
+    trace_text("parse", start, NULL, 0);
+    if (rv != 0) {
+      free(out.data);
+      out.data = NULL;
+      break;
+    }
+    tree = parse_heredocs(ar, tree, rd, NULL);
+    if (tree != NULL) {
+      if (nlines == cap) {
+        cap *= 2;
+        lines = realloc(lines, cap * sizeof(uint64_t));
+      }
+      lines[nlines++] = put_node(&out, tree);
+    }
+    arena_reset(ar);
+  }
+  free_reader(rd);
+  free_arena(ar);
+
+  if (out.data != NULL) {
+    hdr.lines = put(&out, lines, nlines * sizeof(uint64_t));
+    hdr.path = put_str(&out, real);
+    memcpy(hdr.magic, CACHE_MAGIC, 8);
+    hdr.length = out.len;
+    hdr.node_size = sizeof(node);
+    hdr.nlines = nlines;
+    hdr.size = st->st_size;
+    hdr.mtime_sec = st->st_mtim.tv_sec;
+    hdr.mtime_nsec = st->st_mtim.tv_nsec;
+    hdr.hash = hash;
+    memcpy(out.data, &hdr, sizeof(hdr));
+  }
+  free(lines);
+  return out;
+}
+
+/**
+ * @brief Writes a new cache next to where it goes and renames it into
+ * place, so that other runs never see half of it.
+ */
+static void write_cache(const char* cpath, out_buf* out) {
+  char tmp[PATH_MAX + 32];
+  snprintf(tmp, sizeof(tmp), "%s.%d", cpath, getpid());
+  int cfd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  if (cfd < 0) {
+    return;
+  }
+  size_t done = 0;
+  while (done < out->len) {
+    ssize_t put = write(cfd, out->data + done, out->len - done);
+    if (put < 0 && errno == EINTR) {
+      continue;
+    }
+    if (put <= 0) {
+      break;
+    }
+    done += put;
+  }
+  close(cfd);
+  if (done < out->len || rename(tmp, cpath) != 0) {
+    unlink(tmp);
+  }
+}
+
+/**
+ * @brief Gets the parsed lines of a script from its cache, compiling the
+ * script and caching it first if there is no cache or it is out of date.
+ *
+ * Caches are keyed by the real path of the script and checked against its
+ * size and modification time. When the time differs, the contents are
+ * hashed instead, so touching a script does not recompile it.
+ *
+ * @param path  is the script.
+ * @param fd    is the script, opened for reading. Its offset is not used.
+ * @return compiled* is the script, or NULL if it should be read line by line
+ * instead: caching is off, it is not a regular file, or a line of it does
+ * not parse, so that the lines before the error still run.
+ */
+compiled* load_compiled(const char* path, int fd) {
+  struct stat st;
+  char real[PATH_MAX];
+  char cpath[PATH_MAX];
+  if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) ||
+      realpath(path, real) == NULL ||
+      cache_path(real, cpath, sizeof(cpath)) != 0) {
+    return NULL;
+  }
+
+  compiled* prog = open_cache(cpath, real, fd, &st);
+  if (prog != NULL) {
+    return prog;
+  }
+
+  out_buf out = compile(real, fd, &st);
+  if (out.data == NULL) {
+    return NULL;
+  }
+  write_cache(cpath, &out);
+  return make_compiled((cache_header*)out.data, 0);
+}
@@ -0,0 +1,46 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "parse.h"
+
+/**
+ * @brief The start of a compiled script cache file.
+ *
+ * The parsed lines follow it, with every pointer stored as an offset from
+ * the start of the file. The file is mapped read-only, and each line is
+ * copied out into an arena with its offsets turned back into pointers just
+ * before it runs.
+ */
+typedef struct cache_header {
+  char magic[8];
+  uint64_t length;  // of the whole file
+  uint32_t node_size;  // sizeof(node), caches of other builds are rebuilt
+  uint32_t nlines;
+  uint64_t lines;  // offset of the array of lines
+  uint64_t path;   // offset of the real path of the script
+  uint64_t size;   // of the script
+  int64_t mtime_sec;
+  int64_t mtime_nsec;
+  uint64_t hash;  // FNV-1a of the script's contents
+} cache_header;
+
+/**
+ * @brief A script whose lines have all been parsed.
+ */
+typedef struct compiled {
+  cache_header* hdr;
+  int mapped;  // the header is a mapping of a cache file, not malloc'd
+  uint32_t nlines;
+  const uint64_t* lines;  // offsets of the non-empty lines in order
+} compiled;
+
+compiled* load_compiled(const char* path, int fd);
+
+node* compiled_line(compiled* prog, uint32_t ii, arena* ar);
+
+void free_compiled(compiled* prog);
+
+#endif
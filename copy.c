@@ -0,0 +1,260 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "copy.h"
+
+// The most bytes asked for by a single call.
+#define COPY_CHUNK (1 << 20)
+
+/**
+ * @brief Writes all of a buffer, retrying short writes.
+ *
+ * @return int is 0 on success and -1 on an error.
+ */
+int write_all(int fd, const void* buf, size_t len) {
+  const char* bytes = buf;
+  while (len > 0) {
+    ssize_t put = write(fd, bytes, len);
+    if (put < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return -1;
+    }
+    bytes += put;
+    len -= put;
+  }
+  return 0;
+}
+
+/**
+ * @brief Copies through a user space buffer, for when the kernel cannot copy
+ * between the two files.
+ */
+static ssize_t copy_buffered(int in_fd, int out_fd, ssize_t copied) {
+  char buf[64 * 1024];
+  ssize_t got;
+  while ((got = read(in_fd, buf, sizeof(buf))) != 0) {
+    if (got < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return -1;
+    }
+    for (ssize_t off = 0; off < got;) {
+      ssize_t put = write(out_fd, buf + off, got - off);
+      if (put < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return -1;
+      }
+      off += put;
+    }
+    copied += got;
+  }
+  return copied;
+}
+
+/**
+ * @brief Copies everything from one file descriptor to another, until the end
+ * of the input.
+ *
+ * The copy stays in the kernel where it can: splice when either end is a
+ * pipe, copy_file_range between regular files and sendfile from a regular
+ * file to anything else. Everything else, or a kernel that refuses the call
+ * for these files, goes through a buffer.
+ *
+ * @param in_fd   is the file descriptor to read from.
+ * @param out_fd  is the file descriptor to write to.
+ * @return ssize_t is the number of bytes copied, -1 on an error.
+ */
+ssize_t copy_stream(int in_fd, int out_fd) {
+  struct stat in_st;
+  struct stat out_st;
+  if (fstat(in_fd, &in_st) != 0 || fstat(out_fd, &out_st) != 0) {
+    return -1;
+  }
+
+  ssize_t copied = 0;
+  ssize_t moved;
+  if (S_ISFIFO(in_st.st_mode) || S_ISFIFO(out_st.st_mode)) {
+    while ((moved = splice(in_fd, NULL, out_fd, NULL, COPY_CHUNK,
+                           SPLICE_F_MOVE | SPLICE_F_MORE)) != 0) {
+      if (moved < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        // Nothing has been lost yet if the kernel refused the first call.
+        return copied == 0 && errno == EINVAL
+                   ? copy_buffered(in_fd, out_fd, 0)
+                   : -1;
+      }
+      copied += moved;
+    }
+    return copied;
+  }
+
+  if (S_ISREG(in_st.st_mode) && S_ISREG(out_st.st_mode)) {
+    while ((moved = copy_file_range(in_fd, NULL, out_fd, NULL, COPY_CHUNK,
+                                    0)) != 0) {
+      if (moved < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        if (copied == 0 && (errno == EXDEV || errno == EINVAL ||
+                            errno == EBADF || errno == ENOSYS ||
+                            errno == EOPNOTSUPP)) {
+          break;
+        }
+        return -1;
+      }
+      copied += moved;
+    }
+    if (copied > 0 || moved == 0) {
+      return copied;
+    }
+  }
+
+  if (S_ISREG(in_st.st_mode)) {
+    while ((moved = sendfile(out_fd, in_fd, NULL, COPY_CHUNK)) != 0) {
+      if (moved < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        if (copied == 0 && (errno == EINVAL || errno == ENOSYS)) {
+          break;
+        }
+        return -1;
+      }
+      copied += moved;
+    }
+    if (copied > 0 || moved == 0) {
+      return copied;
+    }
+  }
+
+  return copy_buffered(in_fd, out_fd, copied);
+}
+
+/**
+ * @brief Copies one input to several outputs through a user space buffer,
+ * for inputs that are not pipes.
+ */
+static ssize_t tee_buffered(int in_fd, const int* out_fds, int nout) {
+  char buf[64 * 1024];
+  ssize_t copied = 0;
+  ssize_t got;
+  while ((got = read(in_fd, buf, sizeof(buf))) != 0) {
+    if (got < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return -1;
+    }
+    for (int ii = 0; ii < nout; ii++) {
+      if (write_all(out_fds[ii], buf, got) != 0) {
+        return -1;
+      }
+    }
+    copied += got;
+  }
+  return copied;
+}
+
+/**
+ * @brief Moves exactly {@code len} bytes out of a pipe, through a buffer if
+ * the output cannot be spliced to, like a terminal.
+ */
+static int move_bytes(int in_fd, int out_fd, size_t len) {
+  while (len > 0) {
+    ssize_t moved = splice(in_fd, NULL, out_fd, NULL, len,
+                           SPLICE_F_MOVE | SPLICE_F_MORE);
+    if (moved < 0 && errno == EINVAL) {
+      char buf[64 * 1024];
+      moved = read(in_fd, buf, len < sizeof(buf) ? len : sizeof(buf));
+      if (moved > 0 && write_all(out_fd, buf, moved) != 0) {
+        return -1;
+      }
+    }
+    if (moved < 0 && errno == EINTR) {
+      continue;
+    } else if (moved <= 0) {
+      return -1;
+    }
+    len -= moved;
+  }
+  return 0;
+}
+
+/**
+ * @brief Copies everything from one file descriptor to several others, until
+ * the end of the input.
+ *
+ * When the input is a pipe the data never reaches user space: each output
+ * but the last gets a duplicate of what is in the pipe through tee, into a
+ * pipe of its own that is then spliced into it, and the last output has the
+ * data spliced into it from the input, which consumes it. The pipes of the
+ * outputs are as large as the input so that a duplicate of all of it
+ * always fits.
+ *
+ * @param in_fd   is the file descriptor to read from.
+ * @param out_fds is the file descriptors to write to.
+ * @param nout    is how many there are.
+ * @return ssize_t is the number of bytes copied, -1 on an error.
+ */
+ssize_t tee_stream(int in_fd, const int* out_fds, int nout) {
+  if (nout == 1) {
+    return copy_stream(in_fd, out_fds[0]);
+  }
+  int in_size = fcntl(in_fd, F_GETPIPE_SZ);
+  if (nout == 0 || in_size < 0) {
+    return tee_buffered(in_fd, out_fds, nout);
+  }
+
+  int mids[nout - 1][2];
+  int made = 0;
+  for (; made < nout - 1; made++) {
+    if (pipe2(mids[made], O_CLOEXEC) != 0) {
+      break;
+    }
+    if (fcntl(mids[made][1], F_SETPIPE_SZ, in_size) < in_size) {
+      close(mids[made][0]);
+      close(mids[made][1]);
+      break;
+    }
+  }
+
+  ssize_t copied = 0;
+  while (made == nout - 1) {
+    ssize_t len = tee(in_fd, mids[0][1], COPY_CHUNK, 0);
+    if (len < 0 && errno == EINTR) {
+      continue;
+    } else if (len <= 0) {
+      copied = len < 0 ? -1 : copied;
+      break;
+    }
+    int ok = move_bytes(mids[0][0], out_fds[0], len) == 0;
+    for (int ii = 1; ok && ii < nout - 1; ii++) {
+      ok = tee(in_fd, mids[ii][1], len, 0) == len &&
+           move_bytes(mids[ii][0], out_fds[ii], len) == 0;
+    }
+    if (!ok || move_bytes(in_fd, out_fds[nout - 1], len) != 0) {
+      copied = -1;
+      break;
+    }
+    copied += len;
+  }
+
+  int buffered = made < nout - 1;
+  for (int ii = 0; ii < made; ii++) {
+    close(mids[ii][0]);
+    close(mids[ii][1]);
+  }
+  return buffered ? tee_buffered(in_fd, out_fds, nout) : copied;
+}
@@ -0,0 +1,13 @@
+#ifndef COPY_H
+#define COPY_H
+
+#include <stddef.h>
+#include <sys/types.h>
+
+int write_all(int fd, const void* buf, size_t len);
+
+ssize_t copy_stream(int in_fd, int out_fd);
+
+ssize_t tee_stream(int in_fd, const int* out_fds, int nout);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,446 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "builtins.h"
+#include "expand.h"
+#include "jobs.h"
+#include "nush.h"
+#include "stats.h"
+#include "tokens.h"
+#include "trace.h"
+
+// The most bytes read from a substitution by a single call, to start with.
+#define READ_CHUNK (64 * 1024)
+
+/**
+ * @brief A string being built, grown by doubling.
+ */
+typedef struct text {
+  char* data;
+  size_t len;
+  size_t cap;
+} text;
+
+static void put_bytes(text* tx, const char* bytes, size_t len) {
+  if (tx->len + len + 1 > tx->cap) {
+    size_t cap = tx->cap ? tx->cap : 64;
+    while (cap < tx->len + len + 1) {
+      cap *= 2;
+    }
+    tx->data = realloc(tx->data, cap);
+    tx->cap = cap;
+  }
+  memcpy(tx->data + tx->len, bytes, len);
+  tx->len += len;
+  tx->data[tx->len] = 0;
+}
+
+/**
+ * @brief Reads everything a substitution prints.
+ *
+ * The buffer is doubled whenever it fills up, and each read asks for all of
+ * the space left, so large outputs take few calls.
+ */
+static void read_output(int fd, text* out) {
+  out->cap = READ_CHUNK;
+  out->data = malloc(out->cap);
+  for (;;) {
+    if (out->cap - out->len < READ_CHUNK) {
+      out->cap *= 2;
+      out->data = realloc(out->data, out->cap);
+    }
+    ssize_t got = read(fd, out->data + out->len, out->cap - out->len - 1);
+    if (got < 0 && errno == EINTR) {
+      continue;
+    } else if (got <= 0) {
+      break;
+    }
+    out->len += got;
+  }
+  out->data[out->len] = 0;
+}
+
+/**
+ * @brief Checks if a command can run in the shell with its output captured
+ * in memory: a builtin that cannot change the shell, with no redirections.
+ */
+static int runs_in_shell(node* n) {
+  return n->type == NODE_CMD && n->nreds == 0 && !n->subst &&
+         n->argv->size > 0 && is_builtin(n->argv->data[0]) &&
+         !builtin_changes_shell(n->argv->data[0]);
+}
+
+/**
+ * @brief A command with its substitutions expanded, along with the process
+ * substitutions started for it.
+ */
+typedef struct expansion {
+  node n;  // first, so that the node is the expansion
+  int nprocs;
+  int* fds;   // the shell's ends of their pipes, named by /dev/fd
+  int* pids;  // -1 if the command could not be started
+  struct expansion* prev;  // the expansion made before it, still in use
+} expansion;
+
+// The expansions not freed yet, newest first.
+static expansion* live;
+
+/**
+ * @brief Parses the command of a substitution into an arena.
+ *
+ * @return node* is the tree, NULL if it is empty or not valid.
+ */
+static node* parse_subst(arena* ar, const char* cmd, size_t len) {
+  char* line = arena_alloc(ar, len + 1);
+  memcpy(line, cmd, len);
+  line[len] = 0;
+  node* tree = NULL;
+  if (parse(ar, tokenize(ar, line), &tree, stderr) != 0) {
+    return NULL;
+  }
+  return tree;
+}
+
+/**
+ * @brief Starts the command of a substitution on one end of a pipe, spawned
+ * if it can be and forked otherwise.
+ *
+ * @param tree      is the command.
+ * @param pipe_fds  is the pipe, both ends are close-on-exec.
+ * @param out       is 1 if the command writes to the pipe, 0 if it reads.
+ * @param flgs      is the (current) flags to use.
+ * @return int      is the PID of the command, negative if it did not start.
+ */
+static int start_subst(node* tree, int* pipe_fds, int out, flags* flgs) {
+  int cpid;
+  uint64_t fork_start = trace_begin();
+  if (is_spawnable(tree)) {
+    cpid = out ? spawn_command(tree, 0, pipe_fds[1], flgs)
+               : spawn_command(tree, pipe_fds[0], 1, flgs);
+  } else if ((cpid = fork()) == 0) {
+    STATS_ADD(forks, 1);
+    dup2(pipe_fds[out], out);
+    close(pipe_fds[0]);
+    close(pipe_fds[1]);
+    flgs->piped = !out;
+    execute_in_child(tree, flgs);
+  } else {
+    trace_node("fork", fork_start, tree, cpid);
+  }
+  return cpid;
+}
+
+/**
+ * @brief Runs the command of a substitution and captures what it prints.
+ *
+ * Builtins run in the shell with a memory file in place of its stdout, since
+ * a pipe could fill up with no one but the shell itself to read it. Anything
+ * else runs with its stdout on a pipe and the shell reads the pipe until the
+ * command closes it. Trailing newlines are dropped.
+ *
+ * @param cmd   is the text of the command.
+ * @param len   is the length of {@code cmd}.
+ * @param flgs  is the (current) flags to use.
+ * @param out   is where the output goes.
+ */
+static void run_subst(const char* cmd, size_t len, flags* flgs, text* out) {
+  arena* ar = make_arena(4 * 1024);
+  node* tree = parse_subst(ar, cmd, len);
+  if (tree == NULL) {
+    free_arena(ar);
+    return;
+  }
+
+  int mem_fd = runs_in_shell(tree) ? memfd_create("nush-subst", MFD_CLOEXEC)
+                                   : -1;
+  if (mem_fd >= 0) {
+    fflush(stdout);
+    int saved = fcntl(1, F_DUPFD_CLOEXEC, 10);
+    dup2(mem_fd, 1);
+    execute_builtin(tree->argv, flgs);
+    if (saved >= 0) {
+      dup2(saved, 1);
+      close(saved);
+    } else {
+      close(1);
+    }
+    lseek(mem_fd, 0, SEEK_SET);
+    read_output(mem_fd, out);
+    close(mem_fd);
+  } else {
+    int pipe_fds[2];
+    if (pipe2(pipe_fds, O_CLOEXEC) != 0) {
+      perror("nush: pipe");
+      free_arena(ar);
+      return;
+    }
+    STATS_ADD(pipes, 1);
+    int cpid = start_subst(tree, pipe_fds, 1, flgs);
+    close(pipe_fds[1]);
+    read_output(pipe_fds[0], out);
+    close(pipe_fds[0]);
+    if (cpid > 0) {
+      int status;
+      uint64_t wait_start = trace_begin();
+      wait_child(flgs->jobs, cpid, &status, NULL);
+      trace_node("wait", wait_start, tree, cpid);
+    }
+  }
+
+  while (out->len > 0 && out->data[out->len - 1] == '\n') {
+    out->data[--out->len] = 0;
+  }
+  free_arena(ar);
+}
+
+/**
+ * @brief Starts the command of a process substitution, which runs alongside
+ * the command using it, and names its end of the pipe.
+ *
+ * The pipe is kept open in the shell until the command using it is done.
+ *
+ * @param cmd   is the text of the command.
+ * @param len   is the length of {@code cmd}.
+ * @param out   is 1 for <( ), whose command writes to the pipe, 0 for >( ).
+ * @param ex    is the expansion the process belongs to.
+ * @param flgs  is the (current) flags to use.
+ * @param path  is where the /dev/fd path goes.
+ */
+static void start_proc_subst(const char* cmd, size_t len, int out,
+                             expansion* ex, flags* flgs, char* path) {
+  int pipe_fds[2];
+  if (pipe2(pipe_fds, O_CLOEXEC) != 0) {
+    perror("nush: pipe");
+    strcpy(path, "/dev/null");
+    return;
+  }
+  STATS_ADD(pipes, 1);
+
+  arena* ar = make_arena(4 * 1024);
+  node* tree = parse_subst(ar, cmd, len);
+  int cpid = tree != NULL ? start_subst(tree, pipe_fds, out, flgs) : -1;
+  free_arena(ar);
+  close(pipe_fds[out]);
+
+  ex->fds = realloc(ex->fds, (ex->nprocs + 1) * sizeof(int));
+  ex->pids = realloc(ex->pids, (ex->nprocs + 1) * sizeof(int));
+  ex->fds[ex->nprocs] = pipe_fds[!out];
+  ex->pids[ex->nprocs] = cpid;
+  ex->nprocs++;
+  sprintf(path, "/dev/fd/%d", pipe_fds[!out]);
+}
+
+/**
+ * @brief Adds a finished field to the words and starts the next one.
+ */
+static void end_field(text* field, svec* argv) {
+  svec_push_back(argv, field->data);
+  *field = (text){NULL, 0, 0};
+  put_bytes(field, "", 0);
+}
+
+static int is_field_space(char ch) {
+  return ch == ' ' || ch == '\t' || ch == '\n';
+}
+
+/**
+ * @brief Expands the substitutions of a word.
+ *
+ * Output of unquoted command substitutions is split into fields at spaces,
+ * tabs and newlines, with the text around the substitution joined to the
+ * first and last field. Quoted output, and every output when {@code argv} is
+ * NULL, is kept whole. Process substitutions are replaced by the path of
+ * their pipe.
+ *
+ * @param word  is the word, with its substitutions between markers.
+ * @param ex    is the expansion the word belongs to.
+ * @param flgs  is the (current) flags to use.
+ * @param argv  is where the fields are added, or NULL to keep it one word.
+ * @return char* is the word when {@code argv} is NULL, to be freed.
+ */
+static char* expand_word(const char* word, expansion* ex, flags* flgs,
+                         svec* argv) {
+  text field = {NULL, 0, 0};
+  int started = 0;  // a field is being built, even if it is still empty
+  put_bytes(&field, "", 0);
+
+  for (const char* ch = word; *ch;) {
+    if (strchr(SUBST_MARKS, *ch) == NULL) {
+      size_t run = strcspn(ch, SUBST_MARKS);
+      put_bytes(&field, ch, run);
+      ch += run;
+      started = 1;
+      continue;
+    }
+
+    char mark = *ch;
+    const char* cmd = ch + 1;
+    const char* end = strchr(cmd, SUBST_END);
+    if (end == NULL) {
+      // Never made by tokenize, which rejects lines with marker bytes.
+      fprintf(stderr, "nush: unterminated substitution\n");
+      break;
+    }
+    ch = end + 1;
+    if (mark == SUBST_IN || mark == SUBST_OUT) {
+      char path[32];
+      start_proc_subst(cmd, end - cmd, mark == SUBST_IN, ex, flgs, path);
+      put_bytes(&field, path, strlen(path));
+      started = 1;
+      continue;
+    }
+
+    int split = mark == SUBST_START && argv != NULL;
+    text out = {NULL, 0, 0};
+    run_subst(cmd, end - cmd, flgs, &out);
+
+    if (!split) {
+      put_bytes(&field, out.data ? out.data : "", out.len);
+      started = 1;
+      free(out.data);
+      continue;
+    }
+    // A field is only ended once the next one starts, so spaces at the end
+    // of the output still separate it from the text after it.
+    int pending = 0;
+    for (size_t ii = 0; ii < out.len; ii++) {
+      if (is_field_space(out.data[ii])) {
+        pending = 1;
+        continue;
+      }
+      if (pending && started) {
+        end_field(&field, argv);
+      }
+      pending = 0;
+      put_bytes(&field, out.data + ii, 1);
+      started = 1;
+    }
+    if (pending && started) {
+      end_field(&field, argv);
+      started = 0;
+    }
+    free(out.data);
+  }
+
+  if (argv == NULL) {
+    return field.data;
+  }
+  if (started) {
+    svec_push_back(argv, field.data);
+  } else {
+    free(field.data);
+  }
+  return NULL;
+}
+
+/**
+ * @brief Runs the substitutions of a command or subshell and makes a copy of
+ * it with their output in place.
+ *
+ * Words are split where the output of unquoted command substitutions has
+ * spaces, redirection targets are not. The words and targets of the copy
+ * are its own, the rest of the node is shared with the original.
+ *
+ * The pipes of process substitutions stay close-on-exec in the shell, so
+ * that no other process holds them, and are only inherited by the command
+ * itself, through {@code inherit_expanded}.
+ *
+ * @param n     is the node with substitutions.
+ * @param flgs  is the (current) flags to use.
+ * @return node* is the expanded copy, freed with {@code free_expanded}.
+ */
+node* expand_command(node* n, flags* flgs) {
+  expansion* ex = calloc(1, sizeof(expansion));
+  node* copy = &ex->n;
+  *copy = *n;
+  copy->subst = 0;
+
+  if (n->type == NODE_CMD) {
+    // The words are owned by the copy but the vector only references them,
+    // since spawning a command adds a null to it.
+    copy->argv = make_svec(1);
+    for (int ii = 0; ii < n->argv->size; ii++) {
+      expand_word(n->argv->data[ii], ex, flgs, copy->argv);
+    }
+  }
+  copy->reds = malloc((n->nreds + 1) * sizeof(redir));
+  for (int ii = 0; ii < n->nreds; ii++) {
+    copy->reds[ii] = n->reds[ii];
+    copy->reds[ii].target = expand_word(n->reds[ii].target, ex, flgs, NULL);
+  }
+
+  ex->prev = live;
+  live = ex;
+  return copy;
+}
+
+/**
+ * @brief Lets the program run for a command inherit the pipes of its process
+ * substitutions, which its words name by /dev/fd.
+ *
+ * Nothing is done for a node that is not an expansion.
+ *
+ * @param n       is the command.
+ * @param actions is the file actions of the program to spawn, or NULL in a
+ * forked child that will exec it, whose descriptors are changed directly.
+ */
+void inherit_expanded(node* n, posix_spawn_file_actions_t* actions) {
+  expansion* ex = live;
+  while (ex != NULL && &ex->n != n) {
+    ex = ex->prev;
+  }
+  for (int ii = 0; ex != NULL && ii < ex->nprocs; ii++) {
+    if (actions == NULL) {
+      fcntl(ex->fds[ii], F_SETFD, 0);
+    } else {
+      // Duplicating a descriptor onto itself clears its close-on-exec flag.
+      posix_spawn_file_actions_adddup2(actions, ex->fds[ii], ex->fds[ii]);
+    }
+  }
+}
+
+/**
+ * @brief Frees a copy made by {@code expand_command}, once the command has
+ * run.
+ *
+ * The shell's ends of the process substitution pipes are closed, which ends
+ * their input or output, and the processes are waited for.
+ */
+void free_expanded(node* n, flags* flgs) {
+  expansion* ex = (expansion*)n;
+  expansion** link = &live;
+  while (*link != ex) {
+    link = &(*link)->prev;
+  }
+  *link = ex->prev;
+  for (int ii = 0; ii < ex->nprocs; ii++) {
+    close(ex->fds[ii]);
+  }
+  for (int ii = 0; ii < ex->nprocs; ii++) {
+    int status;
+    if (ex->pids[ii] > 0) {
+      wait_child(flgs->jobs, ex->pids[ii], &status, NULL);
+    }
+  }
+  free(ex->fds);
+  free(ex->pids);
+
+  if (n->type == NODE_CMD) {
+    for (int ii = 0; ii < n->argv->size; ii++) {
+      free(n->argv->data[ii]);
+    }
+    free_svec(n->argv);
+  }
+  for (int ii = 0; ii < n->nreds; ii++) {
+    free(n->reds[ii].target);
+  }
+  free(n->reds);
+  free(ex);
+}
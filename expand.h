@@ -0,0 +1,15 @@
+#ifndef EXPAND_H
+#define EXPAND_H
+
+#include <spawn.h>
+
+#include "flags.h"
+#include "parse.h"
+
+node* expand_command(node* n, flags* flgs);
+
+void inherit_expanded(node* n, posix_spawn_file_actions_t* actions);
+
+void free_expanded(node* n, flags* flgs);
+
+#endif
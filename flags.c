@@ -1,12 +1,23 @@
 #include <stdlib.h>
 
 #include "flags.h"
+#include "hash.h"
+#include "jobs.h"
 
 flags* make_flags() {
     flags* f = malloc(sizeof(flags));
     f->ret = 0;
-    f->are_tokens = 0;
-    f->pipe_fd = 0;
+    f->piped = 0;
+    f->exiting = 0;
+    f->jobs = make_job_table(NULL, NULL);
+    f->hist = NULL;
+    f->cmds = make_cmd_hash();
 
     return f;
-}
\ No newline at end of file
+}
+
+void free_flags(flags* f) {
+    free_job_table(f->jobs);
+    free_cmd_hash(f->cmds);
+    free(f);
+}
@@ -1,13 +1,18 @@
 #ifndef FLAGS_H
 #define FLAGS_H
 
+#include "vec.h"
+
 /**
  * @brief Stores the various flags used by {@code nush}.
  */
 typedef struct flags {
-    int ret;
-    int are_tokens; // if the buffer is a command or a bunch of tokens, including operators
-    int pipe_fd; // The file descriptor of a pipe to be used as input. 0 if no such pipe exists.
+    int ret; // The exit status of the last command.
+    int piped; // If stdin of the current process is a pipe from an earlier pipeline stage.
+    int exiting; // Set by exit, nothing more is run.
+    struct job_table* jobs; // The background jobs still running.
+    struct history* hist; // The command history, NULL if it is not recorded.
+    struct cmd_hash* cmds; // Where the commands run so far were found.
 } flags;
 
 /**
@@ -15,4 +20,9 @@ typedef struct flags {
  */
 flags* make_flags();
 
-#endif
\ No newline at end of file
+/**
+ * @brief Frees a {@code flags}.
+ */
+void free_flags(flags* f);
+
+#endif
@@ -0,0 +1,166 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "hash.h"
+
+cmd_hash* make_cmd_hash() {
+  cmd_hash* ch = malloc(sizeof(cmd_hash));
+  ch->size = 0;
+  ch->cap = 64;
+  ch->slots = calloc(ch->cap, sizeof(hash_entry));
+  ch->path_env = NULL;
+  return ch;
+}
+
+void free_cmd_hash(cmd_hash* ch) {
+  cmd_hash_clear(ch);
+  free(ch->slots);
+  free(ch->path_env);
+  free(ch);
+}
+
+/**
+ * @brief Forgets every remembered command, like {@code hash -r}.
+ */
+void cmd_hash_clear(cmd_hash* ch) {
+  for (int ii = 0; ii < ch->cap; ii++) {
+    free(ch->slots[ii].name);
+    free(ch->slots[ii].path);
+  }
+  memset(ch->slots, 0, ch->cap * sizeof(hash_entry));
+  ch->size = 0;
+}
+
+// FNV-1a
+static uint32_t hash_name(const char* name) {
+  uint32_t hash = 2166136261u;
+  for (; *name; name++) {
+    hash = (hash ^ (unsigned char)*name) * 16777619u;
+  }
+  return hash;
+}
+
+/**
+ * @brief Finds the slot of a command, or the empty slot it would go in.
+ */
+static hash_entry* find_slot(cmd_hash* ch, const char* name) {
+  int ii = hash_name(name) & (ch->cap - 1);
+  while (ch->slots[ii].name != NULL && strcmp(ch->slots[ii].name, name) != 0) {
+    ii = (ii + 1) & (ch->cap - 1);
+  }
+  return ch->slots + ii;
+}
+
+static void grow(cmd_hash* ch) {
+  hash_entry* old = ch->slots;
+  int old_cap = ch->cap;
+  ch->cap *= 2;
+  ch->slots = calloc(ch->cap, sizeof(hash_entry));
+  for (int ii = 0; ii < old_cap; ii++) {
+    if (old[ii].name != NULL) {
+      *find_slot(ch, old[ii].name) = old[ii];
+    }
+  }
+  free(old);
+}
+
+/**
+ * @brief Searches {@code $PATH} for an executable file.
+ *
+ * @return char* is the path of the file, which must be freed, or NULL.
+ */
+static char* search_path(const char* path_env, const char* name) {
+  size_t name_len = strlen(name);
+  const char* dir = path_env;
+  while (1) {
+    const char* end = strchr(dir, ':');
+    size_t dir_len = end ? (size_t)(end - dir) : strlen(dir);
+    char* path = malloc(dir_len + name_len + 3);
+    // An empty entry means the current directory.
+    if (dir_len == 0) {
+      path[0] = '.';
+      dir_len = 1;
+    } else {
+      memcpy(path, dir, dir_len);
+    }
+    path[dir_len] = '/';
+    memcpy(path + dir_len + 1, name, name_len + 1);
+
+    struct stat st;
+    if (stat(path, &st) == 0 && S_ISREG(st.st_mode) &&
+        access(path, X_OK) == 0) {
+      return path;
+    }
+    free(path);
+
+    if (end == NULL) {
+      return NULL;
+    }
+    dir = end + 1;
+  }
+}
+
+/**
+ * @brief Resolves a command to the file that would be exec'd for it.
+ *
+ * Names with a / are used as they are. Commands that are not found are not
+ * remembered, so they are found once they are installed.
+ *
+ * @param ch    is the table to use.
+ * @param name  is the command.
+ * @return char* is the path of the command, owned by the table, or NULL if
+ * it was not found.
+ */
+char* cmd_hash_lookup(cmd_hash* ch, char* name) {
+  if (strchr(name, '/') != NULL) {
+    return name;
+  }
+
+  char* path_env = getenv("PATH");
+  if (path_env == NULL) {
+    path_env = "/usr/local/bin:/usr/bin:/bin";
+  }
+  if (ch->path_env == NULL || strcmp(ch->path_env, path_env) != 0) {
+    cmd_hash_clear(ch);
+    free(ch->path_env);
+    ch->path_env = strdup(path_env);
+  }
+
+  hash_entry* entry = find_slot(ch, name);
+  if (entry->name == NULL) {
+    char* path = search_path(path_env, name);
+    if (path == NULL) {
+      return NULL;
+    }
+    if ((ch->size + 1) * 4 > ch->cap * 3) {
+      grow(ch);
+      entry = find_slot(ch, name);
+    }
+    entry->name = strdup(name);
+    entry->path = path;
+    entry->hits = 0;
+    ch->size++;
+  }
+
+  entry->hits++;
+  return entry->path;
+}
+
+/**
+ * @brief Lists the remembered commands and how often they were used.
+ */
+void cmd_hash_print(cmd_hash* ch, FILE* out) {
+  if (ch->size == 0) {
+    fprintf(out, "hash: hash table empty\n");
+    return;
+  }
+  fprintf(out, "hits\tcommand\n");
+  for (int ii = 0; ii < ch->cap; ii++) {
+    if (ch->slots[ii].name != NULL) {
+      fprintf(out, "%4d\t%s\n", ch->slots[ii].hits, ch->slots[ii].path);
+    }
+  }
+}
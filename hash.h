@@ -0,0 +1,36 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <stdio.h>
+
+typedef struct hash_entry {
+  char* name;  // NULL for an empty slot
+  char* path;
+  int hits;
+} hash_entry;
+
+/**
+ * @brief Remembers where commands were found on {@code $PATH} so that it is
+ * only searched once per command.
+ *
+ * An open addressing table keyed by command name. It is emptied whenever
+ * {@code $PATH} changes.
+ */
+typedef struct cmd_hash {
+  int size;
+  int cap;
+  hash_entry* slots;
+  char* path_env;  // The $PATH the entries were found with.
+} cmd_hash;
+
+cmd_hash* make_cmd_hash();
+
+void free_cmd_hash(cmd_hash* ch);
+
+void cmd_hash_clear(cmd_hash* ch);
+
+char* cmd_hash_lookup(cmd_hash* ch, char* name);
+
+void cmd_hash_print(cmd_hash* ch, FILE* out);
+
+#endif
\ No newline at end of file
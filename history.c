@@ -0,0 +1,330 @@
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "history.h"
+
+#define HIST_MAGIC "NUSHHIS1"
+#define HIST_DEFAULT_SIZE (64 * 1024)
+#define HIST_MIN_SIZE 256
+
+/**
+ * @brief Copies bytes into the ring, wrapping around its end.
+ */
+static void ring_write(history* hist, uint64_t off, const void* src,
+                       size_t len) {
+  size_t first = hist->cap - off;
+  if (first > len) {
+    first = len;
+  }
+  memcpy(hist->ring + off, src, first);
+  memcpy(hist->ring, (const char*)src + first, len - first);
+}
+
+/**
+ * @brief Copies bytes out of the ring, wrapping around its end.
+ */
+static void ring_read(history* hist, uint64_t off, void* dst, size_t len) {
+  size_t first = hist->cap - off;
+  if (first > len) {
+    first = len;
+  }
+  memcpy(dst, hist->ring + off, first);
+  memcpy((char*)dst + first, hist->ring, len - first);
+}
+
+/**
+ * @brief Appends an entry to the ring, dropping the oldest entries to make
+ * room for it, with the file already locked and in sync with the mapping.
+ *
+ * Entries longer than the history are truncated.
+ */
+static void append_entry(history* hist, const char* line, size_t len) {
+  hist_header* hdr = hist->hdr;
+  uint64_t cap = hist->cap;
+  if (len + sizeof(uint32_t) > cap) {
+    len = cap - sizeof(uint32_t);
+  }
+  uint32_t entry_len = len;
+  size_t size = sizeof(uint32_t) + len;
+
+  while (cap - hdr->used < size) {
+    uint32_t old_len;
+    ring_read(hist, hdr->tail, &old_len, sizeof(uint32_t));
+    hdr->tail = (hdr->tail + sizeof(uint32_t) + old_len) % cap;
+    hdr->used -= sizeof(uint32_t) + old_len;
+    hdr->count--;
+  }
+
+  ring_write(hist, hdr->head, &entry_len, sizeof(uint32_t));
+  ring_write(hist, (hdr->head + sizeof(uint32_t)) % cap, line, len);
+  hdr->head = (hdr->head + size) % cap;
+  hdr->used += size;
+  hdr->count++;
+}
+
+/**
+ * @brief Maps a history file of {@code size} bytes.
+ *
+ * @return int is 0, or -1 if it cannot be mapped.
+ */
+static int map_history(history* hist, size_t size) {
+  hist_header* hdr =
+      mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, hist->fd, 0);
+  if (hdr == MAP_FAILED) {
+    hist->hdr = NULL;
+    hist->size = 0;
+    return -1;
+  }
+  hist->hdr = hdr;
+  hist->ring = (char*)(hdr + 1);
+  hist->size = size;
+  hist->cap = size - sizeof(hist_header);
+  return 0;
+}
+
+static void unmap_history(history* hist) {
+  if (hist->hdr != NULL) {
+    munmap(hist->hdr, hist->size);
+    hist->hdr = NULL;
+    hist->size = 0;
+  }
+}
+
+/**
+ * @brief Checks that a mapped history is consistent with the size of its
+ * mapping, down to the lengths of its entries, so that reading it stays in
+ * the ring.
+ */
+static int valid_history(history* hist) {
+  hist_header* hdr = hist->hdr;
+  uint64_t cap = hist->cap;
+  if (memcmp(hdr->magic, HIST_MAGIC, 8) != 0 || hdr->cap != cap ||
+      cap < sizeof(uint32_t) ||
+      hdr->head >= cap || hdr->tail >= cap || hdr->used > cap ||
+      (hdr->tail + hdr->used) % cap != hdr->head) {
+    return 0;
+  }
+
+  uint64_t off = hdr->tail;
+  uint64_t left = hdr->used;
+  for (uint64_t ii = 0; ii < hdr->count; ii++) {
+    uint32_t len;
+    if (left < sizeof(uint32_t)) {
+      return 0;
+    }
+    ring_read(hist, off, &len, sizeof(uint32_t));
+    if (len > left - sizeof(uint32_t)) {
+      return 0;
+    }
+    left -= sizeof(uint32_t) + len;
+    off = (off + sizeof(uint32_t) + len) % cap;
+  }
+  return left == 0;
+}
+
+/**
+ * @brief Follows a history file that another shell has started over or
+ * resized since it was mapped, with the file already locked.
+ *
+ * @return int is 0, or -1 if the history can no longer be used.
+ */
+static int sync_history(history* hist) {
+  struct stat st;
+  if (fstat(hist->fd, &st) != 0) {
+    return -1;
+  }
+  // The header is only read once the file is known to still cover it.
+  if (hist->hdr != NULL && (size_t)st.st_size == hist->size &&
+      hist->hdr->cap == hist->cap) {
+    return 0;
+  }
+  unmap_history(hist);
+  if ((size_t)st.st_size <= sizeof(hist_header) ||
+      map_history(hist, st.st_size) != 0) {
+    return -1;
+  }
+  return valid_history(hist) ? 0 : -1;
+}
+
+/**
+ * @brief Checks if another shell has a history file open, from the lock each
+ * one holds on its first byte for as long as it does.
+ */
+static int in_use(int fd) {
+  struct flock fl = {.l_type = F_WRLCK, .l_whence = SEEK_SET, .l_len = 1};
+  return fcntl(fd, F_OFD_GETLK, &fl) == 0 && fl.l_type != F_UNLCK;
+}
+
+static void hold_open(int fd) {
+  struct flock fl = {.l_type = F_RDLCK, .l_whence = SEEK_SET, .l_len = 1};
+  fcntl(fd, F_OFD_SETLK, &fl);
+}
+
+/**
+ * @brief Opens or creates a history file and maps it into memory.
+ *
+ * A history of another size has its newest entries moved into one of the
+ * requested size, unless another shell has it open, in which case its size
+ * is kept. A file that is not a history, or whose header does not add up,
+ * is started over.
+ *
+ * @param path  is the file to use.
+ * @param cap   is the number of bytes available to entries.
+ * @return history* is the history, or NULL if the file cannot be used.
+ */
+history* open_history(const char* path, size_t cap) {
+  int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+  if (fd < 0) {
+    return NULL;
+  }
+
+  history* hist = malloc(sizeof(history));
+  hist->fd = fd;
+  hist->hdr = NULL;
+  hist->size = 0;
+  size_t size = sizeof(hist_header) + cap;
+  flock(fd, LOCK_EX);
+  int shared = in_use(fd);
+  hold_open(fd);
+
+  // The entries of a history of another size, oldest first.
+  char* saved = NULL;
+  uint64_t saved_used = 0;
+  uint64_t saved_count = 0;
+  struct stat st;
+  if (fstat(fd, &st) == 0 && (size_t)st.st_size > sizeof(hist_header) &&
+      map_history(hist, st.st_size) == 0) {
+    if (valid_history(hist)) {
+      if ((size_t)st.st_size == size || shared) {
+        flock(fd, LOCK_UN);
+        return hist;
+      }
+      saved_used = hist->hdr->used;
+      saved_count = hist->hdr->count;
+      saved = malloc(saved_used);
+      ring_read(hist, hist->hdr->tail, saved, saved_used);
+    }
+    unmap_history(hist);
+  }
+
+  if (ftruncate(fd, size) != 0 || map_history(hist, size) != 0) {
+    flock(fd, LOCK_UN);
+    close(fd);
+    free(saved);
+    free(hist);
+    return NULL;
+  }
+  hist_header* hdr = hist->hdr;
+  memset(hdr, 0, sizeof(hist_header));
+  memcpy(hdr->magic, HIST_MAGIC, 8);
+  hdr->cap = cap;
+
+  // Adding them in order drops the oldest if they no longer fit.
+  char* entry = saved;
+  for (uint64_t ii = 0; ii < saved_count; ii++) {
+    uint32_t len;
+    memcpy(&len, entry, sizeof(uint32_t));
+    append_entry(hist, entry + sizeof(uint32_t), len);
+    entry += sizeof(uint32_t) + len;
+  }
+  free(saved);
+  flock(fd, LOCK_UN);
+  return hist;
+}
+
+/**
+ * @brief Opens the user's history: {@code $NUSH_HISTFILE}, or
+ * {@code ~/.nush_history} if unset, holding up to {@code $NUSH_HISTSIZE} bytes
+ * of lines.
+ *
+ * @return history* is the history, or NULL if there is nowhere to keep it.
+ */
+history* open_default_history() {
+  char* path = getenv("NUSH_HISTFILE");
+  char home_path[4096];
+  if (path == NULL) {
+    char* home = getenv("HOME");
+    if (home == NULL) {
+      return NULL;
+    }
+    snprintf(home_path, sizeof(home_path), "%s/.nush_history", home);
+    path = home_path;
+  }
+
+  size_t cap = HIST_DEFAULT_SIZE;
+  char* size = getenv("NUSH_HISTSIZE");
+  if (size != NULL) {
+    cap = strtoul(size, NULL, 10);
+  }
+  if (cap < HIST_MIN_SIZE) {
+    cap = HIST_MIN_SIZE;
+  }
+
+  return open_history(path, cap);
+}
+
+void close_history(history* hist) {
+  unmap_history(hist);
+  close(hist->fd);
+  free(hist);
+}
+
+/**
+ * @brief Appends a line to the history, dropping the oldest entries to make
+ * room for it.
+ *
+ * The trailing newline is not stored, empty lines are ignored and lines
+ * longer than the history are truncated.
+ */
+void history_add(history* hist, const char* line) {
+  size_t len = strlen(line);
+  while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) {
+    len--;
+  }
+  if (len == 0) {
+    return;
+  }
+
+  flock(hist->fd, LOCK_EX);
+  if (sync_history(hist) == 0) {
+    append_entry(hist, line, len);
+  }
+  flock(hist->fd, LOCK_UN);
+}
+
+/**
+ * @brief Prints the entries of the history, oldest first and numbered.
+ */
+void history_print(history* hist, FILE* out) {
+  flock(hist->fd, LOCK_SH);
+  if (sync_history(hist) != 0) {
+    flock(hist->fd, LOCK_UN);
+    return;
+  }
+  hist_header* hdr = hist->hdr;
+  uint64_t cap = hist->cap;
+  uint64_t off = hdr->tail;
+  for (uint64_t ii = 0; ii < hdr->count; ii++) {
+    uint32_t len;
+    ring_read(hist, off, &len, sizeof(uint32_t));
+    off = (off + sizeof(uint32_t)) % cap;
+
+    // Entries that wrap around the end of the ring are printed in two parts.
+    size_t first = cap - off;
+    if (first > len) {
+      first = len;
+    }
+    fprintf(out, "%5lu  ", (unsigned long)ii + 1);
+    fwrite(hist->ring + off, 1, first, out);
+    fwrite(hist->ring, 1, len - first, out);
+    fputc('\n', out);
+    off = (off + len) % cap;
+  }
+  flock(hist->fd, LOCK_UN);
+}
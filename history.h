@@ -0,0 +1,46 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @brief The header at the start of a history file.
+ *
+ * It is followed by a ring of {@code cap} bytes holding the entries, each a
+ * 32 bit length followed by the text of the line. Offsets wrap around the end
+ * of the ring.
+ */
+typedef struct hist_header {
+  char magic[8];
+  uint64_t cap;
+  uint64_t head;   // Where the next entry is written.
+  uint64_t tail;   // Where the oldest entry starts.
+  uint64_t used;   // Bytes taken by entries.
+  uint64_t count;  // Number of entries.
+} hist_header;
+
+/**
+ * @brief A command history of bounded size, memory-mapped from a file so that
+ * it survives restarts without being parsed on startup.
+ */
+typedef struct history {
+  int fd;
+  hist_header* hdr;  // NULL once the file can no longer be mapped.
+  char* ring;
+  size_t size;   // Bytes mapped, another shell may have resized the file.
+  uint64_t cap;  // Bytes of the ring mapped, used instead of the header's.
+} history;
+
+history* open_history(const char* path, size_t cap);
+
+history* open_default_history();
+
+void close_history(history* hist);
+
+void history_add(history* hist, const char* line);
+
+void history_print(history* hist, FILE* out);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,507 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "acct.h"
+#include "jobs.h"
+#include "stats.h"
+
+// Set by the SIGCHLD handler, cleared once the children have been reaped.
+static volatile sig_atomic_t child_exited = 0;
+// Written to by the SIGCHLD handler, so a shell waiting for its next line
+// can wake up and reap.
+static int wake_pipe[2] = {-1, -1};
+
+static void on_sigchld(int sig) {
+  (void)sig;
+  int saved = errno;
+  child_exited = 1;
+  if (wake_pipe[1] >= 0) {
+    write(wake_pipe[1], "", 1);
+  }
+  errno = saved;
+}
+
+/**
+ * @brief Installs the SIGCHLD handler that lets {@code jobs_reap} know there
+ * is something to reap.
+ *
+ * System calls are restarted so reads of the next line are not cut short.
+ * The reader polls {@code jobs_wake_fd} instead, to reap while it waits.
+ */
+void jobs_install_handler() {
+  int fds[2];
+  if (pipe2(fds, O_CLOEXEC | O_NONBLOCK) == 0) {
+    // Kept above the descriptors redirections can name.
+    for (int ii = 0; ii < 2; ii++) {
+      wake_pipe[ii] = fcntl(fds[ii], F_DUPFD_CLOEXEC, 10);
+      close(fds[ii]);
+    }
+  }
+
+  struct sigaction sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = on_sigchld;
+  sa.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+  sigemptyset(&sa.sa_mask);
+  sigaction(SIGCHLD, &sa, NULL);
+}
+
+/**
+ * @brief Creates an empty {@code job_table}.
+ *
+ * The most jobs running at once is taken from {@code $NUSH_MAX_JOBS}, and
+ * the descriptor jobs are logged to from {@code $NUSH_ACCT_FD}.
+ *
+ * @param start     is how queued jobs are started.
+ * @param start_ctx is passed to {@code start}.
+ */
+job_table* make_job_table(job_starter start, void* start_ctx) {
+  job_table* jt = malloc(sizeof(job_table));
+  jt->size = 0;
+  jt->cap = 16;
+  jt->slots = calloc(jt->cap, sizeof(job));
+  jt->next_id = 1;
+  jt->first_failure = 0;
+  jt->strays = NULL;
+  jt->nstrays = 0;
+  jt->strays_cap = 0;
+  memset(&jt->usage, 0, sizeof(jt->usage));
+  jt->acct_fd = acct_open_fd();
+  jt->owner = getpid();
+  char* max_jobs = getenv("NUSH_MAX_JOBS");
+  jt->max_jobs = max_jobs ? atoi(max_jobs) : 0;
+  jt->queue = NULL;
+  jt->queue_head = 0;
+  jt->queue_size = 0;
+  jt->queue_cap = 0;
+  jt->start = start;
+  jt->start_ctx = start_ctx;
+  return jt;
+}
+
+/**
+ * @brief Drops every job, running or queued, without waiting for them.
+ */
+static void forget_jobs(job_table* jt) {
+  for (int ii = 0; ii < jt->cap; ii++) {
+    free(jt->slots[ii].cmd);
+  }
+  memset(jt->slots, 0, jt->cap * sizeof(job));
+  jt->size = 0;
+  for (int ii = 0; ii < jt->queue_size; ii++) {
+    free_arena(jt->queue[(jt->queue_head + ii) % jt->queue_cap].ar);
+  }
+  jt->queue_size = 0;
+}
+
+/**
+ * @brief Makes sure the table belongs to the current process.
+ *
+ * A forked child inherits the shell's table but not its children, so it
+ * starts over with no jobs. Listing the jobs does not need this.
+ */
+static void own(job_table* jt) {
+  int pid = getpid();
+  if (jt->owner != pid) {
+    forget_jobs(jt);
+    jt->nstrays = 0;
+    jt->owner = pid;
+  }
+}
+
+void free_job_table(job_table* jt) {
+  forget_jobs(jt);
+  free(jt->queue);
+  free(jt->slots);
+  free(jt->strays);
+  free(jt);
+}
+
+static int home_slot(job_table* jt, int pid) {
+  return ((uint32_t)pid * 2654435761u) & (jt->cap - 1);
+}
+
+static int find_slot(job_table* jt, int pid) {
+  int ii = home_slot(jt, pid);
+  while (jt->slots[ii].pid != 0 && jt->slots[ii].pid != pid) {
+    ii = (ii + 1) & (jt->cap - 1);
+  }
+  return ii;
+}
+
+static void grow(job_table* jt) {
+  job* old = jt->slots;
+  int old_cap = jt->cap;
+  jt->cap *= 2;
+  jt->slots = calloc(jt->cap, sizeof(job));
+  for (int ii = 0; ii < old_cap; ii++) {
+    if (old[ii].pid != 0) {
+      jt->slots[find_slot(jt, old[ii].pid)] = old[ii];
+    }
+  }
+  free(old);
+}
+
+/**
+ * @brief Empties a slot, moving back the entries after it that would no
+ * longer be found past the gap.
+ */
+static void remove_slot(job_table* jt, int ii) {
+  free(jt->slots[ii].cmd);
+  jt->slots[ii].pid = 0;
+  jt->slots[ii].cmd = NULL;
+  jt->size--;
+
+  int jj = ii;
+  while (1) {
+    jj = (jj + 1) & (jt->cap - 1);
+    if (jt->slots[jj].pid == 0) {
+      break;
+    }
+    int home = home_slot(jt, jt->slots[jj].pid);
+    // The entry can move to the gap if its home is not between the two.
+    int stays = ii <= jj ? (ii < home && home <= jj) : (ii < home || home <= jj);
+    if (!stays) {
+      jt->slots[ii] = jt->slots[jj];
+      jt->slots[jj].pid = 0;
+      jt->slots[jj].cmd = NULL;
+      ii = jj;
+    }
+  }
+}
+
+/**
+ * @brief Adds a background job.
+ *
+ * @param jt    is the table to add to.
+ * @param pid   is the process running the job.
+ * @param cmd   is the text of the job, which is copied.
+ * @return int  is the job's number.
+ */
+int jobs_add(job_table* jt, int pid, char* cmd) {
+  own(jt);
+  if (jt->size == 0) {
+    jt->next_id = 1;
+  }
+  if ((jt->size + 1) * 4 > jt->cap * 3) {
+    grow(jt);
+  }
+  job* j = jt->slots + find_slot(jt, pid);
+  j->pid = pid;
+  j->id = jt->next_id++;
+  j->cmd = strdup(cmd);
+  clock_gettime(CLOCK_MONOTONIC, &j->start);
+  jt->size++;
+  STATS_ADD(jobs_started, 1);
+  return j->id;
+}
+
+/**
+ * @brief Checks if a new job would have to be queued.
+ */
+int jobs_full(job_table* jt) {
+  own(jt);
+  return jt->max_jobs > 0 && (jt->size >= jt->max_jobs || jt->queue_size > 0);
+}
+
+/**
+ * @brief Queues a job to be started once a slot is free.
+ *
+ * The tree is copied into an arena of its own, the original can be released
+ * with its line.
+ */
+void jobs_enqueue(job_table* jt, node* body) {
+  own(jt);
+  if (jt->queue_size == jt->queue_cap) {
+    int cap = jt->queue_cap ? jt->queue_cap * 2 : 16;
+    queued_job* queue = malloc(cap * sizeof(queued_job));
+    for (int ii = 0; ii < jt->queue_size; ii++) {
+      queue[ii] = jt->queue[(jt->queue_head + ii) % jt->queue_cap];
+    }
+    free(jt->queue);
+    jt->queue = queue;
+    jt->queue_cap = cap;
+    jt->queue_head = 0;
+  }
+
+  // Most jobs are a short command, the arena's chunk is sized for those.
+  arena* ar = make_arena(1024);
+  queued_job* qj = jt->queue + (jt->queue_head + jt->queue_size) % jt->queue_cap;
+  qj->ar = ar;
+  qj->body = clone_node(ar, body);
+  jt->queue_size++;
+}
+
+/**
+ * @brief Starts queued jobs, oldest first, while there are free slots.
+ */
+void jobs_dispatch(job_table* jt) {
+  own(jt);
+  while (jt->queue_size > 0 &&
+         (jt->max_jobs <= 0 || jt->size < jt->max_jobs)) {
+    queued_job qj = jt->queue[jt->queue_head];
+    jt->queue_head = (jt->queue_head + 1) % jt->queue_cap;
+    jt->queue_size--;
+    jt->start(qj.body, jt->start_ctx);
+    free_arena(qj.ar);
+  }
+}
+
+job* jobs_find(job_table* jt, int pid) {
+  job* j = jt->slots + find_slot(jt, pid);
+  return j->pid ? j : NULL;
+}
+
+job* jobs_find_id(job_table* jt, int id) {
+  for (int ii = 0; ii < jt->cap; ii++) {
+    if (jt->slots[ii].pid != 0 && jt->slots[ii].id == id) {
+      return jt->slots + ii;
+    }
+  }
+  return NULL;
+}
+
+/**
+ * @brief Reaps a child with {@code wait4}, adding the resources it used to
+ * the table's total.
+ *
+ * @param pid     is the child, or -1 for any.
+ * @param options is the options of {@code wait4}.
+ * @return int    is the PID reaped, like {@code wait4}.
+ */
+static int reap(job_table* jt, int pid, int options, int* status,
+                struct rusage* usage) {
+  int rv = wait4(pid, status, options, usage);
+  if (rv > 0) {
+    rusage_add(&jt->usage, usage);
+  }
+  return rv;
+}
+
+/**
+ * @brief Records the status of a reaped child.
+ *
+ * Jobs are logged to the accounting descriptor as they finish.
+ *
+ * @return int is 1 if the child was a job, which is removed, and 0 if it is
+ * kept for {@code wait_child}.
+ */
+static int child_done(job_table* jt, int pid, int status,
+                      struct rusage* usage) {
+  int ii = find_slot(jt, pid);
+  if (jt->slots[ii].pid == 0) {
+    if (jt->nstrays == jt->strays_cap) {
+      jt->strays_cap = jt->strays_cap ? jt->strays_cap * 2 : 4;
+      jt->strays = realloc(jt->strays, jt->strays_cap * sizeof(reaped));
+    }
+    jt->strays[jt->nstrays++] = (reaped){pid, status, *usage};
+    return 0;
+  }
+  if (jt->acct_fd >= 0) {
+    job* j = jt->slots + ii;
+    acct_log(jt->acct_fd, pid, status, j->cmd, seconds_since(&j->start),
+             usage);
+  }
+  int code = WIFSIGNALED(status) ? 128 + WTERMSIG(status) : WEXITSTATUS(status);
+  if (jt->first_failure == 0) {
+    jt->first_failure = code;
+  }
+  remove_slot(jt, ii);
+  STATS_ADD(jobs_reaped, 1);
+  jobs_dispatch(jt);
+  return 1;
+}
+
+/**
+ * @brief Reaps every child that has exited since the last SIGCHLD, without
+ * blocking.
+ */
+void jobs_reap(job_table* jt) {
+  if (!child_exited) {
+    return;
+  }
+  child_exited = 0;
+  int pid;
+  int status;
+  struct rusage usage;
+  while ((pid = reap(jt, -1, WNOHANG, &status, &usage)) > 0) {
+    child_done(jt, pid, status, &usage);
+  }
+}
+
+/**
+ * @brief Gets the descriptor that becomes readable when a child exits, -1 if
+ * there is none.
+ */
+int jobs_wake_fd() {
+  return wake_pipe[0];
+}
+
+/**
+ * @brief Reaps jobs once {@code jobs_wake_fd} is readable, starting queued
+ * jobs in their place.
+ *
+ * @param ctx  is the {@code job_table}.
+ */
+void jobs_wake(void* ctx) {
+  char buf[64];
+  while (read(wake_pipe[0], buf, sizeof(buf)) > 0) {
+  }
+  jobs_reap(ctx);
+}
+
+/**
+ * @brief Waits for a foreground child, which may already have been reaped
+ * while looking for jobs.
+ *
+ * Jobs that finish in the meantime are reaped too, and queued jobs started in
+ * their place, so the job slots stay busy during long foreground commands.
+ *
+ * @param jt      is the table of jobs.
+ * @param pid     is the child.
+ * @param status  is set to its status.
+ * @param usage   is set to the resources it used, if not NULL.
+ * @return int    is the PID, or -1 if it is not a child.
+ */
+int wait_child(job_table* jt, int pid, int* status, struct rusage* usage) {
+  own(jt);
+  struct rusage ignored;
+  if (usage == NULL) {
+    usage = &ignored;
+  }
+  for (int ii = 0; ii < jt->nstrays; ii++) {
+    if (jt->strays[ii].pid == pid) {
+      *status = jt->strays[ii].status;
+      *usage = jt->strays[ii].usage;
+      jt->strays[ii] = jt->strays[--jt->nstrays];
+      return pid;
+    }
+  }
+
+  if (jt->size == 0) {
+    int rv;
+    while ((rv = reap(jt, pid, 0, status, usage)) < 0 && errno == EINTR) {
+    }
+    return rv;
+  }
+
+  while (1) {
+    int rv = reap(jt, -1, 0, status, usage);
+    if (rv == pid) {
+      return rv;
+    } else if (rv > 0) {
+      child_done(jt, rv, *status, usage);
+    } else if (errno != EINTR) {
+      return rv;
+    }
+  }
+}
+
+/**
+ * @brief Waits for a job to finish.
+ *
+ * @return int is the job's exit status.
+ */
+int jobs_wait(job_table* jt, job* j) {
+  own(jt);
+  int pid = j->pid;
+  int status;
+  struct rusage usage;
+  if (wait_child(jt, pid, &status, &usage) < 0) {
+    // Not a child of this process, like jobs inherited by a subshell.
+    remove_slot(jt, j - jt->slots);
+    return 127;
+  }
+  child_done(jt, pid, status, &usage);
+  return WIFSIGNALED(status) ? 128 + WTERMSIG(status) : WEXITSTATUS(status);
+}
+
+/**
+ * @brief Waits for the next job to finish, like {@code wait -n}.
+ *
+ * @return int is the job's exit status, or 127 if there are no jobs.
+ */
+int jobs_wait_next(job_table* jt) {
+  own(jt);
+  jobs_dispatch(jt);
+  while (jt->size > 0) {
+    int status;
+    struct rusage usage;
+    int pid = reap(jt, -1, 0, &status, &usage);
+    if (pid < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      break;
+    }
+    if (child_done(jt, pid, status, &usage)) {
+      return WIFSIGNALED(status) ? 128 + WTERMSIG(status)
+                                 : WEXITSTATUS(status);
+    }
+  }
+  return 127;
+}
+
+/**
+ * @brief Waits for every job to finish.
+ *
+ * Jobs that cannot be waited for, like those inherited by a subshell, are
+ * dropped.
+ *
+ * @return int is the first non-zero exit status of the jobs run so far.
+ */
+int jobs_wait_all(job_table* jt) {
+  own(jt);
+  jobs_dispatch(jt);
+  while (jt->size > 0) {
+    int status;
+    struct rusage usage;
+    int pid = reap(jt, -1, 0, &status, &usage);
+    if (pid < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      forget_jobs(jt);
+      break;
+    }
+    child_done(jt, pid, status, &usage);
+  }
+  return jt->first_failure;
+}
+
+static int by_id(const void* a, const void* b) {
+  return (*(job**)a)->id - (*(job**)b)->id;
+}
+
+/**
+ * @brief Lists the running jobs in the order they were started, then the
+ * queued ones.
+ */
+void jobs_print(job_table* jt, FILE* out) {
+  job* running[jt->size + 1];
+  int count = 0;
+  for (int ii = 0; ii < jt->cap; ii++) {
+    if (jt->slots[ii].pid != 0) {
+      running[count++] = jt->slots + ii;
+    }
+  }
+  qsort(running, count, sizeof(job*), by_id);
+  for (int ii = 0; ii < count; ii++) {
+    fprintf(out, "[%d] %d Running\t%s &\n", running[ii]->id, running[ii]->pid,
+            running[ii]->cmd);
+  }
+  for (int ii = 0; ii < jt->queue_size; ii++) {
+    char cmd[256];
+    unparse(jt->queue[(jt->queue_head + ii) % jt->queue_cap].body, cmd,
+            sizeof(cmd));
+    fprintf(out, "[-] Queued\t%s &\n", cmd);
+  }
+}
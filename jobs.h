@@ -0,0 +1,108 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+#include <stdio.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#include "arena.h"
+#include "parse.h"
+#include "vec.h"
+
+typedef struct job {
+  int pid;  // 0 for an empty slot
+  int id;   // The number shown by jobs and used as %id.
+  char* cmd;
+  struct timespec start;  // when it was started, for its accounting
+} job;
+
+/**
+ * @brief A child reaped while looking for another one, kept for
+ * {@code wait_child}.
+ */
+typedef struct reaped {
+  int pid;
+  int status;
+  struct rusage usage;
+} reaped;
+
+/**
+ * @brief A job waiting for a free slot, with the arena holding its copy of
+ * the tree.
+ */
+typedef struct queued_job {
+  node* body;
+  arena* ar;
+} queued_job;
+
+/**
+ * @brief Starts a job, returning its PID or a negative number if it could not
+ * be started.
+ */
+typedef int (*job_starter)(node* body, void* ctx);
+
+/**
+ * @brief The running background jobs, in an open addressing table keyed by
+ * PID, and the jobs queued behind them.
+ *
+ * Jobs are reaped as soon as SIGCHLD reports them and removed from the table,
+ * only the first failure is kept for the exit status of the shell. When
+ * {@code max_jobs} are running, new jobs wait in a FIFO queue and are started
+ * as the running ones finish.
+ */
+typedef struct job_table {
+  int size;
+  int cap;
+  job* slots;
+  int next_id;
+  int first_failure;  // The first non-zero status of a finished job.
+  reaped* strays;  // Other children reaped while looking for jobs.
+  int nstrays;
+  int strays_cap;
+  struct rusage usage;  // Of all the children reaped, times summed.
+  int acct_fd;  // Where each finished job is logged, -1 for nowhere.
+  int owner;  // The process the jobs belong to, children start with none.
+  int max_jobs;  // The most jobs running at once, 0 for no limit.
+  queued_job* queue;  // A ring of queue_cap jobs...
+  int queue_head;  // ...starting here...
+  int queue_size;  // ...holding this many.
+  int queue_cap;
+  job_starter start;
+  void* start_ctx;
+} job_table;
+
+job_table* make_job_table(job_starter start, void* start_ctx);
+
+void free_job_table(job_table* jt);
+
+void jobs_install_handler();
+
+int jobs_add(job_table* jt, int pid, char* cmd);
+
+int jobs_full(job_table* jt);
+
+void jobs_enqueue(job_table* jt, node* body);
+
+void jobs_dispatch(job_table* jt);
+
+job* jobs_find(job_table* jt, int pid);
+
+job* jobs_find_id(job_table* jt, int id);
+
+void jobs_reap(job_table* jt);
+
+int jobs_wake_fd();
+
+void jobs_wake(void* ctx);
+
+int wait_child(job_table* jt, int pid, int* status, struct rusage* usage);
+
+int jobs_wait(job_table* jt, job* j);
+
+int jobs_wait_next(job_table* jt);
+
+int jobs_wait_all(job_table* jt);
+
+void jobs_print(job_table* jt, FILE* out);
+
+#endif
\ No newline at end of file
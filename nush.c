@@ -1,610 +1,981 @@
+#define _GNU_SOURCE
+
 #include <assert.h>
+#include <errno.h>
 #include <fcntl.h>
+#include <spawn.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
+#include "acct.h"
+#include "builtins.h"
+#include "cache.h"
+#include "copy.h"
+#include "expand.h"
+#include "hash.h"
+#include "history.h"
+#include "jobs.h"
 #include "nush.h"
+#include "parse.h"
+#include "reader.h"
+#include "stats.h"
 #include "tokens.h"
+#include "trace.h"
 #include "vec.h"
 
+extern char** environ;
+
 /**
- * @brief Executes a command with its arguments.
+ * @brief Converts a status from {@code waitpid} into an exit code.
  *
- * @param cmd is the command and arguments to run.
- * @param input_fd is a pipe to replace stdin with.
- * @return int the exit status of the command.
+ * Processes killed by a signal get 128 plus the signal number, like other
+ * shells.
  */
-int execute(svec* cmd, int* input_fd) {
-  assert(cmd->size > 0);
-  int cpid;
-  int ret = 0;
-  if (cpid = fork()) {
-    if (*input_fd > 0) {
-      close(*input_fd);
-      *input_fd = 0;
-    }
-    int status;
-    waitpid(cpid, &status, 0);
-    ret = WEXITSTATUS(status);
-  } else {
-    change_input(input_fd);
-    svec_push_back(cmd, 0);
-    execvp(cmd->data[0], cmd->data);
+int exit_status(int status) {
+  if (WIFSIGNALED(status)) {
+    return 128 + WTERMSIG(status);
   }
+  return WEXITSTATUS(status);
+}
 
-  clear_svec(cmd);
+/**
+ * @brief Exits a forked child, writing out the events it traced first.
+ */
+static __attribute__((noreturn)) void exit_child(int code) {
+  trace_flush();
+  _exit(code);
+}
 
-  return ret;
+/**
+ * @brief Replaces the current process with the file of a command.
+ *
+ * This should only be used in a fork. Files without a #! line are run by
+ * /bin/sh, like execvp does. Never returns.
+ *
+ * @param path is the file to run.
+ * @param argv is the command and arguments to run.
+ */
+void exec_path(char* path, svec* argv) {
+  svec_push_back(argv, 0);
+  trace_argv("exec", argv);
+  STATS_ADD(execs, 1);
+  execv(path, argv->data);
+  if (errno == ENOEXEC) {
+    char** sh_argv = malloc((argv->size + 1) * sizeof(char*));
+    sh_argv[0] = "/bin/sh";
+    sh_argv[1] = path;
+    memcpy(sh_argv + 2, argv->data + 1, (argv->size - 1) * sizeof(char*));
+    execv(sh_argv[0], sh_argv);
+  }
+  perror(argv->data[0]);
+  exit_child(126);
 }
 
 /**
- * @brief Executes a set of tokens.
+ * @brief Replaces the current process with a command, found through the
+ * command hash.
  *
- * Changes stdin if a pipe is available.
+ * This should only be used in a fork. Never returns.
  *
- * @param tokens is the set of tokens to execute.
+ * @param argv is the command and arguments to run.
  * @param flgs is the (current) flags to use.
- * @param bg_pids is the list of backgrounded processes to check later.
  */
-void execute_tok(svec* tokens, flags* flgs, vec* bg_pids) {
-  assert(tokens->size > 0);
-  flgs->are_tokens = 0;
-  svec* buffer = make_svec(1);
-  int cpid = 1;
-  int ret = 0;
-  if (flgs->pipe_fd > 0 && (cpid = fork())) {
-    close(flgs->pipe_fd);
-    flgs->pipe_fd = 0;
-    int status;
-    waitpid(cpid, &status, 0);
-    ret = WEXITSTATUS(status);
-  } else {
-    change_input(&flgs->pipe_fd);
-    execute_tokens(tokens, flgs, buffer, bg_pids, 0);
-    if (!cpid) {
-      _exit(flgs->ret);
+void exec_argv(svec* argv, flags* flgs) {
+  char* path = cmd_hash_lookup(flgs->cmds, argv->data[0]);
+  if (path == NULL) {
+    fprintf(stderr, "nush: %s: command not found\n", argv->data[0]);
+    exit_child(127);
+  }
+  exec_path(path, argv);
+}
+
+/**
+ * @brief Makes a descriptor to read the text of a here-document or
+ * here-string from.
+ *
+ * Text that fits in a pipe is written into one, which never blocks since
+ * the pipe is empty. Anything longer goes into an anonymous memory file,
+ * read from the start. Neither is a file on disk, and no process has to
+ * produce the text.
+ *
+ * @param text      is the text.
+ * @param newline   is 1 to add a newline after it.
+ * @return int      is the descriptor, negative on an error.
+ */
+static int open_heredoc(const char* text, int newline) {
+  size_t len = strlen(text);
+  int pipe_fds[2];
+  if (pipe2(pipe_fds, O_CLOEXEC) == 0) {
+    STATS_ADD(pipes, 1);
+    STATS_ADD(copied, len + newline);
+    if (len + newline <= (size_t)fcntl(pipe_fds[1], F_GETPIPE_SZ)) {
+      int err = write_all(pipe_fds[1], text, len) ||
+                write_all(pipe_fds[1], "\n", newline);
+      close(pipe_fds[1]);
+      if (err) {
+        close(pipe_fds[0]);
+        return -1;
+      }
+      return pipe_fds[0];
     }
+    close(pipe_fds[0]);
+    close(pipe_fds[1]);
   }
-  free_svec(buffer);
-  clear_svec(tokens);
-  if (ret != 0) {
-    flgs->ret = ret;
+
+  int fd = memfd_create("nush-heredoc", MFD_CLOEXEC);
+  if (fd < 0) {
+    return -1;
+  }
+  if (write_all(fd, text, len) || write_all(fd, "\n", newline) ||
+      lseek(fd, 0, SEEK_SET) != 0) {
+    close(fd);
+    return -1;
   }
+  return fd;
 }
 
 /**
- * @brief Executes a command and its arguments in the background.
+ * @brief Opens the file of a redirection, or the text of a here-document.
  *
- * @param cmd is the command to run.
- * @param input_fd is the input stream to use.
- * @return int is the PID of the brackgrounded process.
+ * The descriptor is close-on-exec and above the ones a command line can
+ * name, so that it is not replaced by the other redirections before it is
+ * dup'd onto the descriptor redirected.
+ *
+ * @param red   is the redirection, it must be one that opens a file.
+ * @return int  is the file descriptor, negative if the file cannot be opened.
  */
-int execute_bg(svec* cmd, int* input_fd) {
-  assert(cmd->size > 0);
-  int cpid;
-  if (cpid = fork()) {
-    if (*input_fd > 0) {
-      close(*input_fd);
-      *input_fd = 0;
+int open_redirect(redir* red) {
+  if (red->op == TOK_DLESS || red->op == TOK_TLESS) {
+    int fd = open_heredoc(red->target, red->op == TOK_TLESS);
+    if (fd >= 0 && fd < 10) {
+      int high = fcntl(fd, F_DUPFD_CLOEXEC, 10);
+      close(fd);
+      fd = high;
     }
-  } else {
-    change_input(input_fd);
-    svec_push_back(cmd, 0);
-    execvp(cmd->data[0], cmd->data);
+    return fd;
   }
 
-  clear_svec(cmd);
+  int oflags;
+  switch (red->op) {
+    case TOK_LT:
+      oflags = O_RDONLY;
+      break;
+    case TOK_LTGT:
+      oflags = O_RDWR | O_CREAT;
+      break;
+    case TOK_DGREAT:
+      oflags = O_WRONLY | O_CREAT | O_APPEND;
+      break;
+    default:
+      oflags = O_WRONLY | O_CREAT | O_TRUNC;
+  }
+  int fd = open(red->target, oflags | O_CLOEXEC, 0644);
+  if (fd >= 0 && fd < 10) {
+    int high = fcntl(fd, F_DUPFD_CLOEXEC, 10);
+    close(fd);
+    fd = high;
+  }
+  return fd;
+}
 
-  return cpid;
+/**
+ * @brief Gets what to call the file of a redirection in error messages.
+ */
+static const char* redirect_name(redir* red) {
+  return red->op == TOK_DLESS || red->op == TOK_TLESS ? "nush: here-document"
+                                                      : red->target;
+}
+
+/**
+ * @brief Checks if a redirection copies or closes a descriptor instead of
+ * opening a file.
+ */
+int is_dup_redirect(redir* red) {
+  return red->op == TOK_GTAND || red->op == TOK_LTAND;
 }
 
 /**
- * @brief Executes a set of tokens in the background
+ * @brief Gets the descriptor a >& or <& redirection copies.
  *
- * @param tokens
- * @param flgs
- * @param bg_pids
+ * @param red   is the redirection.
+ * @return int  is the descriptor, -1 if the redirection closes its
+ * descriptor and -2 if the target is neither a number nor "-", which is
+ * reported.
  */
-void execute_bg_tok(svec* tokens, flags* flgs, vec* bg_pids) {
-  assert(tokens->size > 0);
-  flgs->are_tokens = 0;
-  int cpid = 1;
-  if (flgs->pipe_fd > 0 && (cpid = fork())) {
-    close(flgs->pipe_fd);
-    flgs->pipe_fd = 0;
-    int status;
-    waitpid(cpid, &status, 0);
-    vec_push_back(bg_pids, WEXITSTATUS(status));
-  } else {
-    change_input(&flgs->pipe_fd);
-    if (!cpid) {
-      _exit(execute_tokens(tokens, NULL, NULL, NULL, 1));
-    } else {
-      vec_push_back(bg_pids, execute_tokens(tokens, NULL, NULL, NULL, 1));
+int dup_source(redir* red) {
+  if (strcmp(red->target, "-") == 0) {
+    return -1;
+  }
+  char* end;
+  long fd = strtol(red->target, &end, 10);
+  if (*red->target == 0 || *end != 0 || fd < 0 || fd > 0xffff) {
+    fprintf(stderr, "nush: %s: bad file descriptor\n", red->target);
+    return -2;
+  }
+  return fd;
+}
+
+/**
+ * @brief Applies a redirection to the current process.
+ *
+ * @param red   is the redirection.
+ * @return int  is 0 on success and -1 if the file cannot be opened or the
+ * descriptor copied, which is reported.
+ */
+int apply_redirect(redir* red) {
+  if (is_dup_redirect(red)) {
+    int src = dup_source(red);
+    if (src == -1) {
+      close(red->fd);
+    } else if (src < 0) {
+      return -1;
+    } else if (dup2(src, red->fd) < 0) {
+      fprintf(stderr, "nush: %s: bad file descriptor\n", red->target);
+      return -1;
     }
+    return 0;
+  }
+
+  int fd = open_redirect(red);
+  if (fd < 0) {
+    perror(redirect_name(red));
+    return -1;
   }
-  clear_svec(tokens);
+  dup2(fd, red->fd);
+  close(fd);
+  return 0;
 }
 
 /**
- * @brief Handles command execution with file redirection
+ * @brief Applies all the redirections of a command or subshell to the
+ * current process, in the order they were written.
  *
- * @param op        is the type of redirect, either < or >.
- * @param cmd       is the command to execute.
- * @param file      is the name of the file to use.
- * @param input_fd  is a stored pipe to use as stdin.
- * @return int      is the exit status of the command.
+ * @return int is 0 on success and -1 as soon as one fails.
  */
-int execute_red(char op, svec* cmd, char* file, int* input_fd) {
-  assert(cmd->size > 0 != *input_fd > 0);
-  int cpid;
-  int ret = 0;
-  if (cpid = fork()) {
-    if (*input_fd > 0) {
-      close(*input_fd);
-      *input_fd = 0;
+int apply_redirects(node* n) {
+  uint64_t start = n->nreds ? trace_begin() : 0;
+  for (int ii = 0; ii < n->nreds; ii++) {
+    if (apply_redirect(n->reds + ii) != 0) {
+      return -1;
     }
-    int status;
-    waitpid(cpid, &status, 0);
-    ret = WEXITSTATUS(status);
-  } else {
-    if (op == '<') {
-      // If you're using a file as input, you shouldn't have a queued pipe input
-      // as well.
-      assert(*input_fd == 0);
-      int inputfd = open(file, O_RDONLY, 0444);
-      dup2(inputfd, 0);
-      close(inputfd);
+  }
+  trace_node("redirect", start, n, 0);
+  return 0;
+}
+
+/**
+ * @brief Puts back the descriptors saved by {@code redirect_shell}.
+ *
+ * @param n       is the redirected node.
+ * @param saved   is the saved descriptors.
+ * @param count   is how many of the redirections were applied.
+ */
+void restore_shell(node* n, int* saved, int count) {
+  fflush(stdout);
+  fflush(stderr);
+  for (int ii = count - 1; ii >= 0; ii--) {
+    if (saved[ii] >= 0) {
+      dup2(saved[ii], n->reds[ii].fd);
+      close(saved[ii]);
     } else {
-      int outputfd = open(file, O_CREAT | O_WRONLY, 0644);
-      dup2(outputfd, 1);
-      close(outputfd);
+      close(n->reds[ii].fd);
     }
+  }
+}
 
-    if (*input_fd > 0) {
-      change_input(input_fd);
-      // I hope you don't have more than 4096 characters in your pipe.
-      char strm_buf[4096];
-      read(0, strm_buf, 4096);
-      write(1, strm_buf, 4096);
-      _exit(0);
-    } else {
-      svec_push_back(cmd, 0);
-      execvp(cmd->data[0], cmd->data);
+/**
+ * @brief Applies the redirections of a node to the shell itself, for the
+ * builtins and subshells that run without forking.
+ *
+ * Each descriptor replaced is saved first so that
+ * {@code restore_shell} can put it back.
+ *
+ * @param n     is the redirected node.
+ * @param saved is filled with a copy of each descriptor replaced, -1 for
+ * those that were not open. It needs room for every redirection of the node.
+ * @return int  is 0 on success and -1 if a redirection fails, in which case
+ * the shell is already restored.
+ */
+int redirect_shell(node* n, int* saved) {
+  uint64_t start = n->nreds ? trace_begin() : 0;
+  fflush(stdout);
+  fflush(stderr);
+  for (int ii = 0; ii < n->nreds; ii++) {
+    saved[ii] = fcntl(n->reds[ii].fd, F_DUPFD_CLOEXEC, 10);
+    if (apply_redirect(n->reds + ii) != 0) {
+      restore_shell(n, saved, ii + 1);
+      return -1;
     }
   }
+  trace_node("redirect", start, n, 0);
+  return 0;
+}
 
-  clear_svec(cmd);
+/**
+ * @brief Waits for a foreground child, and logs what it used to the
+ * accounting descriptor if there is one.
+ *
+ * @param n     is what the child runs, named in the log.
+ * @param pid   is the child.
+ * @param start is when it was started.
+ * @param flgs  is the (current) flags to use.
+ * @return int  is the exit status of the child.
+ */
+int wait_command(node* n, int pid, struct timespec* start, flags* flgs) {
+  int status;
+  struct rusage usage;
+  uint64_t wait_start = trace_begin();
+  wait_child(flgs->jobs, pid, &status, &usage);
+  trace_node("wait", wait_start, n, pid);
+  if (flgs->jobs->acct_fd >= 0) {
+    char cmd[256];
+    unparse(n, cmd, sizeof(cmd));
+    acct_log(flgs->jobs->acct_fd, pid, status, cmd, seconds_since(start),
+             &usage);
+  }
+  return exit_status(status);
+}
 
-  return ret;
+/**
+ * @brief Checks if a node is an external command that only needs its file
+ * descriptors set up and can be spawned without forking the shell.
+ *
+ * Commands with substitutions are not, their words are only known once the
+ * substitutions have run, in the child.
+ */
+int is_spawnable(node* n) {
+  return n != NULL && n->type == NODE_CMD && !n->subst && n->argv->size > 0 &&
+         !is_builtin(n->argv->data[0]);
 }
 
 /**
- * @brief Handles executing a set of tokens with file redirection
+ * @brief Reports that a command could not be started, from a child with the
+ * command's descriptors set up so that the message goes to its stderr.
  *
- * @param op      is the type of redirect, either < or >.
- * @param tokens  is the set of tokens to execute.
- * @param file    is the name of the file to use.
- * @param flgs    are the (current) flags to use.
- * @param bg_pids is the list of background process to check later.
+ * @param n       is the command.
+ * @param in_fd   is a pipe to replace stdin with, 0 if none.
+ * @param out_fd  is a pipe to replace stdout with, 1 if none.
+ * @param msg     is why it could not be started.
+ * @param code    is the exit status of the child.
+ * @return int    is the PID of the child, or the negated exit status if it
+ * could not be forked either.
  */
-void execute_red_tok(char op, svec* tokens, char* file, flags* flgs,
-                     vec* bg_pids) {
-  assert(tokens->size > 0);
-  flgs->are_tokens = 0;
-  svec* buffer = make_svec(1);
-  int cpid;
-  int ret = 0;
-  if (cpid = fork()) {
-    if (flgs->pipe_fd > 0) {
-      close(flgs->pipe_fd);
-      flgs->pipe_fd = 0;
+static int fork_error(node* n, int in_fd, int out_fd, const char* msg,
+                      int code) {
+  int cpid = fork();
+  if (cpid < 0) {
+    fprintf(stderr, "nush: %s: %s\n", n->argv->data[0], msg);
+    return -code;
+  } else if (cpid > 0) {
+    return cpid;
+  }
+  // Children count their own forks, so the count is up to date before
+  // anything they run can read it.
+  STATS_ADD(forks, 1);
+  if (in_fd > 0) {
+    dup2(in_fd, 0);
+  }
+  if (out_fd > 1) {
+    dup2(out_fd, 1);
+  }
+  if (apply_redirects(n) != 0) {
+    exit_child(1);
+  }
+  fprintf(stderr, "nush: %s: %s\n", n->argv->data[0], msg);
+  exit_child(code);
+}
+
+/**
+ * @brief Starts an external command with {@code posix_spawn}.
+ *
+ * The redirect files are opened by the shell and dup'd in the child, so
+ * errors are reported for the right file. The child gets the shell's page
+ * tables through vfork semantics instead of a copy of them. A command that
+ * is not found or cannot be spawned is reported from a forked child instead,
+ * after its redirections, so that its 2> applies to the message.
+ *
+ * @param n       is the spawnable node to start.
+ * @param in_fd   is a pipe to replace stdin with, 0 if none.
+ * @param out_fd  is a pipe to replace stdout with, 1 if none.
+ * @param flgs    is the (current) flags to use.
+ * @return int    is the PID of the command, or the negated exit status if it
+ * could not be started.
+ */
+int spawn_command(node* n, int in_fd, int out_fd, flags* flgs) {
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  inherit_expanded(n, &actions);
+  if (in_fd > 0) {
+    posix_spawn_file_actions_adddup2(&actions, in_fd, 0);
+  }
+  if (out_fd > 1) {
+    posix_spawn_file_actions_adddup2(&actions, out_fd, 1);
+  }
+
+  int red_fds[n->nreds + 1];
+  int opened = 0;
+  int cpid = 0;
+  uint64_t start = n->nreds ? trace_begin() : 0;
+
+  // The actions run in order in the child, the same as apply_redirects.
+  for (int ii = 0; ii < n->nreds; ii++) {
+    redir* red = n->reds + ii;
+    if (is_dup_redirect(red)) {
+      int src = dup_source(red);
+      if (src == -1) {
+        posix_spawn_file_actions_addclose(&actions, red->fd);
+        continue;
+      } else if (src < 0) {
+        cpid = -1;
+        break;
+      }
+      posix_spawn_file_actions_adddup2(&actions, src, red->fd);
+      continue;
     }
-    int status;
-    waitpid(cpid, &status, 0);
-    ret = WEXITSTATUS(status);
-  } else {
-    if (op == '<') {
-      assert(flgs->pipe_fd == 0);
-      int inputfd = open(file, O_RDONLY, 0444);
-      dup2(inputfd, 0);
-      close(inputfd);
-    } else {
-      int outputfd = open(file, O_CREAT | O_WRONLY, 0644);
-      dup2(outputfd, 1);
-      close(outputfd);
+    int fd = open_redirect(red);
+    if (fd < 0) {
+      perror(redirect_name(red));
+      cpid = -1;
+      break;
     }
+    red_fds[opened++] = fd;
+    posix_spawn_file_actions_adddup2(&actions, fd, red->fd);
+  }
 
-    if (flgs->pipe_fd > 0) {
-      change_input(&flgs->pipe_fd);
-      char strm_buf[4096];
-      read(0, strm_buf, 4096);
-      write(1, strm_buf, 4096);
-      _exit(0);
-    } else {
-      execute_tokens(tokens, flgs, buffer, bg_pids, 0);
-      _exit(flgs->ret);
+  trace_node("redirect", start, n, 0);
+
+  char* path = NULL;
+  if (cpid == 0) {
+    path = cmd_hash_lookup(flgs->cmds, n->argv->data[0]);
+    if (path == NULL) {
+      cpid = fork_error(n, in_fd, out_fd, "command not found", 127);
     }
   }
 
-  free_svec(buffer);
-  clear_svec(tokens);
+  if (path != NULL) {
+    svec* argv = n->argv;
+    svec_push_back(argv, 0);
+    start = trace_begin();
+    int err = posix_spawn(&cpid, path, &actions, NULL, argv->data, environ);
+    if (err == ENOEXEC) {
+      // Files without a #! line are run by /bin/sh, like execvp does.
+      char* sh_argv[argv->size + 1];
+      sh_argv[0] = "/bin/sh";
+      sh_argv[1] = path;
+      memcpy(sh_argv + 2, argv->data + 1, (argv->size - 1) * sizeof(char*));
+      err = posix_spawn(&cpid, sh_argv[0], &actions, NULL, sh_argv, environ);
+    }
+    argv->size--;
+    if (err != 0) {
+      cpid = fork_error(n, in_fd, out_fd, strerror(err), 126);
+    } else {
+      STATS_ADD(execs, 1);
+    }
+    trace_node("spawn", start, n, cpid);
+  }
 
-  if (ret != 0) {
-    flgs->ret = ret;
+  for (int ii = 0; ii < opened; ii++) {
+    close(red_fds[ii]);
   }
+  posix_spawn_file_actions_destroy(&actions);
+
+  return cpid;
 }
 
 /**
- * @brief Creates a pipe, executes a command, returns the pipe with the stored
- * output
+ * @brief Executes a command with its arguments and waits for it.
  *
- * The write port of the pipe is automatically closed after usage.
+ * Builtins run in the shell with its descriptors redirected for as long as
+ * they run, anything else is spawned. A command with no words only opens its
+ * files.
  *
- * @param cmd       is the command to execute.
- * @param ret       is the (current) return value of the shell.
- * @param input_fd  is the input stream to use.
- * @return int      is the file descriptor of the pipe's read port.
+ * @param n     is the command.
+ * @param flgs  is the (current) flags to use.
+ * @return int  the exit status of the command.
  */
-int execute_pipe(svec* cmd, int* ret, int* input_fd) {
-  assert(cmd->size > 0);
-  int pipe_fds[2];
-  int rv = pipe(pipe_fds);
-  assert(rv == 0);
-
-  int cpid;
-
-  if (cpid = fork()) {
-    if (*input_fd > 0) {
-      close(*input_fd);
-      *input_fd = 0;
+int execute(node* n, flags* flgs) {
+  if (n->subst) {
+    node* expanded = expand_command(n, flgs);
+    int ret = execute(expanded, flgs);
+    free_expanded(expanded, flgs);
+    return ret;
+  }
+  if (n->argv->size == 0 || is_builtin(n->argv->data[0])) {
+    int saved[n->nreds + 1];
+    if (redirect_shell(n, saved) != 0) {
+      return 1;
     }
-    close(pipe_fds[1]);
-    int status;
-    waitpid(cpid, &status, 0);
-    *ret = WEXITSTATUS(status);
-    clear_svec(cmd);
-  } else {
-    dup2(pipe_fds[1], 1);
-    close(pipe_fds[0]);
-    close(pipe_fds[1]);
-    _exit(execute(cmd, input_fd));
+    int ret = n->argv->size ? execute_builtin(n->argv, flgs) : 0;
+    restore_shell(n, saved, n->nreds);
+    return ret;
   }
 
-  return pipe_fds[0];
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  int cpid = spawn_command(n, 0, 1, flgs);
+  if (cpid < 0) {
+    return -cpid;
+  }
+  return wait_command(n, cpid, &start, flgs);
 }
 
 /**
- * @brief Creates a pipe, executes a set of tokens, and sets the appropriate
- * flag
+ * @brief Runs a node in an already forked child and exits with its status.
  *
- * @param tokens  is the tokens to execute.
- * @param flgs    are the (current) flags to use.
- * @param bg_pids is the list of background processes to check later.
+ * Commands are exec'd directly and subshells run their body, since the fork
+ * already isolates them from the shell. The last command of a list or and/or
+ * chain is run the same way, so a child whose only content is a group does
+ * not fork again for it. Never returns.
+ *
+ * @param n     is the node to run.
+ * @param flgs  is the (current) flags to use.
  */
-void execute_pipe_tok(svec* tokens, flags* flgs, vec* bg_pids) {
-  assert(tokens->size > 0);
-  flgs->are_tokens = 0;
-  svec* buffer = make_svec(1);
-  int pipe_fds[2];
-  int rv = pipe(pipe_fds);
-  assert(rv == 0);
-
-  int cpid;
-
-  if (cpid = fork()) {
-    if (flgs->pipe_fd > 0) {
-      close(flgs->pipe_fd);
-      flgs->pipe_fd = 0;
-    }
-    close(pipe_fds[1]);
-    int status;
-    waitpid(cpid, &status, 0);
-    flgs->ret = WEXITSTATUS(status);
-    free_svec(buffer);
-    clear_svec(tokens);
-    flgs->pipe_fd = pipe_fds[0];
-  } else {
-    dup2(pipe_fds[1], 1);
-    close(pipe_fds[0]);
-    close(pipe_fds[1]);
-    _exit(execute_tokens(tokens, flgs, buffer, bg_pids, 0));
+void execute_in_child(node* n, flags* flgs) {
+  if (n->subst) {
+    // The child never returns, so the expanded copy is never freed.
+    n = expand_command(n, flgs);
+    inherit_expanded(n, NULL);
+  }
+  switch (n->type) {
+    case NODE_CMD:
+      if (apply_redirects(n) != 0) {
+        exit_child(1);
+      }
+      if (n->argv->size == 0) {
+        // A stage of only redirections streams the pipe into them.
+        ssize_t copied = flgs->piped ? copy_stream(0, 1) : 0;
+        STATS_ADD(copied, copied > 0 ? copied : 0);
+        exit_child(copied < 0);
+      }
+      if (is_builtin(n->argv->data[0])) {
+        exit_child(execute_builtin(n->argv, flgs));
+      }
+      exec_argv(n->argv, flgs);
+    case NODE_SUBSHELL:
+      if (apply_redirects(n) != 0) {
+        exit_child(1);
+      }
+      execute_in_child(n->body, flgs);
+    case NODE_LIST:
+      for (int ii = 0; ii < n->nkids - 1; ii++) {
+        execute_node(n->kids[ii], flgs);
+        if (flgs->exiting) {
+          exit_child(flgs->ret);
+        }
+      }
+      execute_in_child(n->kids[n->nkids - 1], flgs);
+    case NODE_AND_OR:
+      execute_node(n->kids[0], flgs);
+      for (int ii = 1; ii < n->nkids && !flgs->exiting; ii++) {
+        if ((n->ops[ii] == TOK_AND) == (flgs->ret == 0)) {
+          if (ii == n->nkids - 1) {
+            execute_in_child(n->kids[ii], flgs);
+          }
+          execute_node(n->kids[ii], flgs);
+        }
+      }
+      exit_child(flgs->ret);
+    default:
+      exit_child(execute_node(n, flgs));
   }
 }
 
 /**
- * @brief Returns the index of the token right before the next command to
- * process
+ * @brief Runs every stage of a pipeline concurrently.
  *
- * The index right before is returned so that when processed in a loop, the
- * correct token gets processed.
+ * All the stages are forked up front, each reading from the pipe of the one
+ * before it, and reaped once the last one has been started.
  *
- * @param tokens        is the tokens to execute.
- * @param current_idx   is the current token's index.
- * @return int          is the index of the token right before the next command.
+ * @param n     is the pipeline node.
+ * @param flgs  are the (current) flags to use.
+ * @return int  is the exit status of the last stage.
  */
-int next_command(svec* tokens, int current_idx) {
-  int ii = current_idx;
-  int current_lvl = 0;
-  while (ii < tokens->size) {
-    char* token = tokens->data[ii];
-    // Takes you to the token right after the matching parenthesis
-    if (strcmp(token, "(") == 0) {
-      current_lvl++;
-    } else if (strcmp(token, ")") == 0) {
-      if (--current_lvl == 0) {
-        ii++;
-        break;
+int execute_pipe(node* n, flags* flgs) {
+  int* cpids = malloc(n->nkids * sizeof(int));
+  int input_fd = 0;
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  for (int ii = 0; ii < n->nkids; ii++) {
+    int last = ii == n->nkids - 1;
+    int pipe_fds[2];
+    if (!last) {
+      // The shell's ends of the pipes must not leak into the other stages.
+      uint64_t pipe_start = trace_begin();
+      int rv = pipe2(pipe_fds, O_CLOEXEC);
+      assert(rv == 0);
+      STATS_ADD(pipes, 1);
+      trace_text("pipe", pipe_start, NULL, 0);
+    }
+
+    uint64_t fork_start = trace_begin();
+    if (is_spawnable(n->kids[ii])) {
+      cpids[ii] =
+          spawn_command(n->kids[ii], input_fd, last ? 1 : pipe_fds[1], flgs);
+    } else if ((cpids[ii] = fork()) == 0) {
+      STATS_ADD(forks, 1);
+      if (input_fd > 0) {
+        dup2(input_fd, 0);
+        close(input_fd);
+        flgs->piped = 1;
       }
-    } else if (current_lvl == 0 &&
-                   (strcmp(token, ";") == 0 || strcmp(token, "|") == 0 ||
-                    strcmp(token, ">") == 0) ||
-               strcmp(token, "&") == 0) {
-      break;
+      if (!last) {
+        dup2(pipe_fds[1], 1);
+        close(pipe_fds[0]);
+        close(pipe_fds[1]);
+      }
+      execute_in_child(n->kids[ii], flgs);
+    } else {
+      trace_node("fork", fork_start, n->kids[ii], cpids[ii]);
     }
-    ii++;
+
+    if (input_fd > 0) {
+      close(input_fd);
+    }
+    if (!last) {
+      close(pipe_fds[1]);
+      input_fd = pipe_fds[0];
+    }
+  }
+
+  int ret = 0;
+  for (int ii = 0; ii < n->nkids; ii++) {
+    if (cpids[ii] < 0) {
+      ret = -cpids[ii];
+      continue;
+    }
+    ret = wait_command(n->kids[ii], cpids[ii], &start, flgs);
   }
+  free(cpids);
+
+  return ret;
+}
 
-  return ii - 1;
+/**
+ * @brief Starts a background job and adds it to the jobs.
+ *
+ * @param body  is what the job runs.
+ * @param ctx   is the (current) flags to use.
+ * @return int  is the PID of the job, negative if it could not be started.
+ */
+int start_job(node* body, void* ctx) {
+  flags* flgs = ctx;
+  int cpid;
+  uint64_t fork_start = trace_begin();
+  if (is_spawnable(body)) {
+    cpid = spawn_command(body, 0, 1, flgs);
+  } else if ((cpid = fork()) == 0) {
+    STATS_ADD(forks, 1);
+    execute_in_child(body, flgs);
+  } else {
+    trace_node("fork", fork_start, body, cpid);
+  }
+  if (cpid > 0) {
+    char cmd[256];
+    unparse(body, cmd, sizeof(cmd));
+    jobs_add(flgs->jobs, cpid, cmd);
+  }
+  return cpid;
 }
 
 /**
- * @brief Replace stdin with the provided file descriptor.
+ * @brief Executes a node in the background.
  *
- * This should only be used in a fork. The provided file descriptor is closed.
+ * If the most jobs allowed are already running, the job is queued and
+ * started once one of them finishes.
  *
- * @param input_fd
+ * @param n     is the background node.
+ * @param flgs  are the (current) flags to use, the job is added to its jobs.
+ * @return int  is always 0.
  */
-void change_input(int* input_fd) {
-  if (*input_fd > 0) {
-    dup2(*input_fd, 0);
-    close(*input_fd);
-    *input_fd = 0;
+int execute_bg(node* n, flags* flgs) {
+  jobs_reap(flgs->jobs);
+  if (jobs_full(flgs->jobs)) {
+    jobs_enqueue(flgs->jobs, n->body);
+  } else {
+    start_job(n->body, flgs);
   }
+  return 0;
 }
 
 /**
- * @brief Checks that all the provided processes have exited
+ * @brief Checks if running a node in the shell could change the shell's
+ * state: builtins like cd or exit, or background jobs that would belong to
+ * the shell instead of the subshell.
  *
- * @param bg_pids is the processes to check.
- * @return int    is the exit code of the processes, the first non-zero code is
- * returned.
+ * Nested subshells are not looked into, they make the same decision when
+ * they are run.
  */
-int check_bg(vec* bg_pids) {
-  int ret = 0;
-  for (int ii = 0; ii < bg_pids->size; ii++) {
-    int status;
-    waitpid(bg_pids->data[ii], &status, 0);
-    if (ret == 0) {
-      ret = WEXITSTATUS(status);
-    }
+int needs_isolation(node* n) {
+  if (n == NULL) {
+    return 0;
+  }
+  switch (n->type) {
+    case NODE_CMD:
+      return n->argv->size > 0 && builtin_changes_shell(n->argv->data[0]);
+    case NODE_BG:
+      return 1;
+    case NODE_SUBSHELL:
+      return 0;
+    default:
+      for (int ii = 0; ii < n->nkids; ii++) {
+        if (needs_isolation(n->kids[ii])) {
+          return 1;
+        }
+      }
+      return needs_isolation(n->body);
   }
-
-  free_vec(bg_pids);
-
-  return ret;
 }
 
 /**
- * @brief Executes a set of tokens.
- *
- * If background mode is set, {@code buffer}, {@code flgs}, and {@code bg_pids}
- * are ignored. New local copies are created.
- *
- * @param tokens  is the tokens to execute.
- * @param flgs    is the flags to use.
- * @param buffer  is the command buffer to use.
- * @param bg_pids is the list of background processes to check later.
- * @param bg_mode determines if the tokens should be run in the background or
- * not.
- * @return int    is 0 if not in the background, and the PID of the child if it
- * is.
+ * @brief Executes a parenthesized list in a child so that it cannot change
+ * the shell's state.
+ *
+ * Lists that cannot change the shell's state are run in the shell instead,
+ * saving the fork, with the shell's descriptors redirected while they run.
+ *
+ * @param n     is the subshell node.
+ * @param flgs  are the (current) flags to use.
+ * @return int  is the exit status of the list.
  */
-int execute_tokens(svec* tokens, flags* flgs, svec* buffer, vec* bg_pids,
-                   int bg_mode) {
-  // If the end token is &, background mode is enabled
-  if (tokens->size > 0 && strcmp(tokens->data[tokens->size - 1], "&") == 0) {
-    bg_mode = 1;
+int execute_subshell(node* n, flags* flgs) {
+  if (n->subst) {
+    node* expanded = expand_command(n, flgs);
+    int ret = execute_subshell(expanded, flgs);
+    free_expanded(expanded, flgs);
+    return ret;
   }
-
-  if (bg_mode) {
-    buffer = make_svec(1);
-    bg_pids = make_vec();
-    flgs = make_flags();
+  if (!needs_isolation(n->body)) {
+    int saved[n->nreds + 1];
+    if (redirect_shell(n, saved) != 0) {
+      return 1;
+    }
+    int ret = execute_node(n->body, flgs);
+    restore_shell(n, saved, n->nreds);
+    return ret;
   }
 
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  uint64_t fork_start = trace_begin();
   int cpid;
+  if ((cpid = fork()) != 0) {
+    trace_node("fork", fork_start, n, cpid);
+    return wait_command(n, cpid, &start, flgs);
+  }
+  STATS_ADD(forks, 1);
+  execute_in_child(n, flgs);
+}
 
-  if (bg_mode && (cpid = fork())) {
-    free_svec(buffer);
-    free_vec(bg_pids);
-    free(flgs);
+/**
+ * @brief Executes a pipeline after the time keyword and reports the time it
+ * took to stderr.
+ *
+ * User and system times are those of every child reaped while it ran, plus
+ * the shell's own for the builtins, and the resident set is the largest of
+ * the children's.
+ *
+ * @param n     is the time node.
+ * @param flgs  is the (current) flags to use.
+ * @return int  is the exit status of the pipeline.
+ */
+int execute_time(node* n, flags* flgs) {
+  job_table* jt = flgs->jobs;
+  struct rusage outer = jt->usage;
+  memset(&jt->usage, 0, sizeof(jt->usage));
+  struct rusage self_start;
+  getrusage(RUSAGE_SELF, &self_start);
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  int ret = execute_node(n->body, flgs);
+
+  double real = seconds_since(&start);
+  struct rusage used = jt->usage;
+  struct rusage self;
+  getrusage(RUSAGE_SELF, &self);
+  rusage_sub(&self, &self_start);
+  self.ru_maxrss = 0;
+  rusage_add(&used, &self);
+  rusage_add(&outer, &jt->usage);
+  jt->usage = outer;
+
+  fflush(stdout);
+  print_times(stderr, real, &used);
+  return ret;
+}
 
-    return cpid;
-  } else {
-    for (int ii = 0; ii < tokens->size; ii++) {
-      char* token = tokens->data[ii];
-      if (strcmp(token, ";") == 0) {
-        // ; executes whatever has been accumulated in the buffer
-        if (buffer->size > 0) {
-          if (flgs->are_tokens) {
-            execute_tok(buffer, flgs, bg_pids);
-          } else {
-            flgs->ret = execute(buffer, &flgs->pipe_fd);
-          }
-        }
-      } else if (strcmp(token, "||") == 0) {
-        // || executes the buffer. If the return is not 0, skip to the next
-        // command, otherwise continue
-        if (buffer->size > 0) {
-          if (flgs->are_tokens) {
-            execute_tok(buffer, flgs, bg_pids);
-          } else {
-            flgs->ret = execute(buffer, &flgs->pipe_fd);
-          }
-        }
-        if (flgs->ret == 0) {
-          clear_svec(buffer);
-          ii = next_command(tokens, ii);
-        }
-      } else if (strcmp(token, "&&") == 0) {
-        // && executes the buffer. If the return is 0, skip to the next command,
-        // otherwise continue
-        if (buffer->size > 0) {
-          if (flgs->are_tokens) {
-            execute_tok(buffer, flgs, bg_pids);
-          } else {
-            flgs->ret = execute(buffer, &flgs->pipe_fd);
-          }
-        }
-        if (flgs->ret != 0) {
-          clear_svec(buffer);
-          ii = next_command(tokens, ii);
-        }
-      } else if (strcmp(token, "<") == 0 || strcmp(token, ">") == 0) {
-        // file redirection
-        ii++;
-        if (flgs->are_tokens) {
-          execute_red_tok(*token, buffer, tokens->data[ii], flgs, bg_pids);
-        } else {
-          flgs->ret =
-              execute_red(*token, buffer, tokens->data[ii], &flgs->pipe_fd);
-        }
-      } else if (strcmp(token, "|") == 0) {
-        // pipe
-        if (flgs->are_tokens) {
-          execute_pipe_tok(buffer, flgs, bg_pids);
-        } else {
-          flgs->pipe_fd = execute_pipe(buffer, &flgs->ret, &flgs->pipe_fd);
-        }
-      } else if (strcmp(token, "&") == 0) {
-        // background execution
-        if (ii < tokens->size - 1) {
-          char* next = tokens->data[ii + 1];
-          assert(strcmp(next, "&&") != 0 && strcmp(next, "||") != 0 &&
-                 strcmp(next, "|") != 0);
-          if (flgs->are_tokens) {
-            execute_bg_tok(buffer, flgs, bg_pids);
-          } else {
-            vec_push_back(bg_pids, execute_bg(buffer, &flgs->pipe_fd));
-          }
-        }
-      } else if (strcmp(token, "(") == 0) {
-        // gets all the tokens in between the parentheses, stores them in the
-        // buffer, set the tokens flag, and skips to next command.
-        assert(buffer->size == 0);
-        int next_cmd = next_command(tokens, ii);
-        sub_svec(tokens, buffer, ii + 1, next_cmd - 1);
-        flgs->are_tokens = 1;
-        ii = next_cmd;
-      } else if (strcmp(token, ")") == 0) {
-        // if ( was handled correctly, you should never reach here unless there's a syntax issue.
-        assert(0);
-      } else if (strcmp(token, "\\") == 0) {
-        // if there's a \ at the end, the \ processor didn't work correctly.
-        assert(ii != tokens->size - 1);
-      } else if (strcmp(token, "cd") == 0) {
-        // change directory
-        ii++;
-        flgs->ret = chdir(tokens->data[ii]);
-      } else if (strcmp(token, "exit") == 0) {
-        // exit the program
-        exit(flgs->ret);
-      } else {
-        svec_push_back(buffer, token);
+/**
+ * @brief Executes a parsed command line.
+ *
+ * @param n     is the root of the tree to execute.
+ * @param flgs  is the flags to use, its return value is updated as each
+ * command finishes.
+ * @return int  is the exit status of the last command run.
+ */
+int execute_node(node* n, flags* flgs) {
+  switch (n->type) {
+    case NODE_CMD:
+      flgs->ret = execute(n, flgs);
+      break;
+    case NODE_LIST:
+      for (int ii = 0; ii < n->nkids && !flgs->exiting; ii++) {
+        execute_node(n->kids[ii], flgs);
       }
-    }
-
-    if (buffer->size > 0) {
-      if (flgs->are_tokens) {
-        execute_tok(buffer, flgs, bg_pids);
-      } else {
-        flgs->ret = execute(buffer, &flgs->pipe_fd);
+      break;
+    case NODE_AND_OR:
+      // && only runs the next pipeline if the last one succeeded, || only if
+      // it failed.
+      execute_node(n->kids[0], flgs);
+      for (int ii = 1; ii < n->nkids && !flgs->exiting; ii++) {
+        if ((n->ops[ii] == TOK_AND) == (flgs->ret == 0)) {
+          execute_node(n->kids[ii], flgs);
+        }
       }
-    }
-
-    if (bg_mode) {
-      free_svec(buffer);
-      free(flgs);
-      check_bg(bg_pids);
-      _exit(0);
-    }
+      break;
+    case NODE_PIPE:
+      flgs->ret = execute_pipe(n, flgs);
+      break;
+    case NODE_BG:
+      flgs->ret = execute_bg(n, flgs);
+      break;
+    case NODE_SUBSHELL:
+      flgs->ret = execute_subshell(n, flgs);
+      break;
+    case NODE_TIME:
+      flgs->ret = execute_time(n, flgs);
+      break;
   }
 
-  return 0;
+  return flgs->ret;
+}
+
+/**
+ * @brief Waits for all the background jobs to exit
+ *
+ * @param flgs  is the flags holding the jobs.
+ * @return int  is the exit code of the jobs, the first non-zero code is
+ * returned.
+ */
+int check_bg(flags* flgs) {
+  return jobs_wait_all(flgs->jobs);
 }
 
 int main(int argc, char* argv[]) {
-  FILE* script;
+  trace_open();
+  stats_init();
+
   // Opens script if provided
+  int input_fd = 0;
   if (argc > 1) {
-    script = fopen(argv[1], "r");
+    input_fd = open(argv[1], O_RDONLY | O_CLOEXEC);
+    if (input_fd < 0) {
+      perror(argv[1]);
+      exit(127);
+    }
+  }
+  // Scripts are run from their compiled cache when they can be, and are
+  // otherwise mapped rather than read. Standard input is usually a terminal
+  // or a pipe, which cannot be.
+  compiled* prog = argc > 1 ? load_compiled(argv[1], input_fd) : NULL;
+  reader* rd = NULL;
+  if (argc == 1) {
+    rd = make_reader(0, "      ");
+  } else if (prog == NULL) {
+    rd = map_reader(input_fd);
   }
 
-  svec* buffer = make_svec(1);
-  cqueue* history = make_cqueue();
-  vec* bg_pids = make_vec();
-  char cmd[1024];
-  cmd[0] = 0;
+  // Everything a line needs is allocated from the arena, which is reset once
+  // the line has run.
+  arena* ar = make_arena(64 * 1024);
   flags* flgs = make_flags();
+  // Only interactive sessions are recorded.
+  if (argc == 1) {
+    flgs->hist = open_default_history();
+  }
 
-  while (1) {
-    // Initial read
-    if (argc == 1) {
-      printf("nush$ ");
-      fgets(cmd, 256, stdin);
-    } else {
-      fgets(cmd, 256, script);
-    }
+  flgs->jobs->start = start_job;
+  flgs->jobs->start_ctx = flgs;
+  jobs_install_handler();
+  // Jobs that finish while waiting for input are reaped straight away, so
+  // queued ones start without waiting for the next line.
+  if (rd != NULL && jobs_wake_fd() >= 0) {
+    rd->wake_fd = jobs_wake_fd();
+    rd->wake = jobs_wake;
+    rd->wake_ctx = flgs->jobs;
+  }
 
-    fflush(stdout);
+  for (uint32_t line = 0;; line++) {
+    // Finished background jobs are reaped before each line.
+    jobs_reap(flgs->jobs);
 
-    svec* tokens = tokenize(cmd);
-    // if \ is the last token, read more lines in until it's not
-    while (tokens->size > 0 &&
-           strcmp(tokens->data[tokens->size - 1], "\\") == 0) {
+    node* tree = NULL;
+    if (prog != NULL) {
+      if (line == prog->nlines) {
+        break;
+      }
+      tree = compiled_line(prog, line, ar);
+    } else {
       if (argc == 1) {
-        printf("      ");
-        fgets(cmd, 256, stdin);
-      } else {
-        fgets(cmd, 256, script);
+        printf("nush$ ");
+        fflush(stdout);
+      }
+
+      // A line continued with \ or with a newline in quotes is read whole.
+      char* cmd = reader_line(rd, NULL);
+      if (cmd == NULL) {
+        break;
       }
-      svec* next = tokenize(cmd);
-      append_svec(tokens, next);
-    }
 
-    cmd[0] = 0;
+      if (flgs->hist != NULL) {
+        history_add(flgs->hist, cmd);
+      }
+
+      uint64_t start = trace_begin();
+      tvec* tokens = tokenize(ar, cmd);
+      trace_text("tokenize", start, NULL, 0);
+      start = trace_begin();
+      if (parse(ar, tokens, &tree, stderr) != 0) {
+        flgs->ret = 2;
+        skip_heredocs(ar, tokens, rd);
+      }
+      trace_text("parse", start, NULL, 0);
+      tree = parse_heredocs(ar, tree, rd, stderr);
+    }
 
-    int cpid = execute_tokens(tokens, flgs, buffer, bg_pids, 0);
-    // if tokens were executed as background process, store PID
-    if (cpid != 0) {
-      vec_push_back(bg_pids, cpid);
+    if (tree != NULL) {
+      execute_node(tree, flgs);
     }
 
-    // Pushes tokens to the history, maybe a future feature implement?
-    cqueue_push_back(history, tokens);
-
-    // Check if EOF has been reached on the input and exits if so
-    if (argc == 1 && feof(stdin) != 0) {
-      free_svec(buffer);
-      free_cqueue(history);
-      int bg_ret = check_bg(bg_pids);
-      int ret = flgs->ret;
-      free(flgs);
-      exit(ret ? ret : bg_ret);
-    } else if (argc > 1 && feof(script) != 0) {
-      free_svec(buffer);
-      free_cqueue(history);
-      fclose(script);
-      int bg_ret = check_bg(bg_pids);
-      int ret = flgs->ret;
-      free(flgs);
-      exit(ret ? ret : bg_ret);
+    arena_reset(ar);
+    if (flgs->exiting) {
+      break;
     }
   }
-}
\ No newline at end of file
+
+  if (flgs->hist != NULL) {
+    close_history(flgs->hist);
+  }
+  free_arena(ar);
+  if (prog != NULL) {
+    free_compiled(prog);
+  } else {
+    free_reader(rd);
+  }
+  if (argc > 1) {
+    close(input_fd);
+  }
+  int bg_ret = check_bg(flgs);
+  // The status given to exit is kept even if it is 0.
+  int ret = flgs->exiting || flgs->ret ? flgs->ret : bg_ret;
+  free_flags(flgs);
+  trace_close();
+  exit(ret);
+}
@@ -1,33 +1,57 @@
 #ifndef NUSH_H
 #define NUSH_H
 
+#include <time.h>
+
 #include "svec.h"
 #include "vec.h"
-#include "cmd_queue.h"
 #include "flags.h"
+#include "parse.h"
+
+int exit_status(int status);
+
+__attribute__((noreturn)) void exec_path(char* path, svec* argv);
+
+__attribute__((noreturn)) void exec_argv(svec* argv, flags* flgs);
+
+int open_redirect(redir* red);
+
+int is_dup_redirect(redir* red);
+
+int dup_source(redir* red);
+
+int apply_redirect(redir* red);
+
+int apply_redirects(node* n);
+
+void restore_shell(node* n, int* saved, int count);
+
+int redirect_shell(node* n, int* saved);
+
+int wait_command(node* n, int pid, struct timespec* start, flags* flgs);
 
-int execute(svec* cmd, int* input_fd);
+int is_spawnable(node* n);
 
-void execute_tok(svec* tokens, flags* flgs, vec* bg_pids);
+int spawn_command(node* n, int in_fd, int out_fd, flags* flgs);
 
-int execute_bg(svec* cmd, int* input_fd);
+int execute(node* n, flags* flgs);
 
-void execute_bg_tok(svec* tokens, flags* flgs, vec* bg_pids);
+__attribute__((noreturn)) void execute_in_child(node* n, flags* flgs);
 
-int execute_red(char op, svec* cmd, char* file, int* input_fd);
+int execute_pipe(node* n, flags* flgs);
 
-void execute_red_tok(char op, svec* tokens, char* file, flags* flgs, vec* bg_pids);
+int start_job(node* body, void* ctx);
 
-int execute_pipe(svec* cmd, int* ret, int* input_fd);
+int execute_bg(node* n, flags* flgs);
 
-void execute_pipe_tok(svec* tokens, flags* flgs, vec* bg_pids);
+int needs_isolation(node* n);
 
-int execute_tokens(svec* tokens, flags* flgs, svec* buffer, vec* bg_pids, int bg_mode);
+int execute_subshell(node* n, flags* flgs);
 
-int next_command(svec* tokens, int current_idx);
+int execute_time(node* n, flags* flgs);
 
-void change_input(int* input_fd);
+int execute_node(node* n, flags* flgs);
 
-int check_bg(vec* bg_pids);
+int check_bg(flags* flgs);
 
 #endif
@@ -0,0 +1,634 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parse.h"
+#include "reader.h"
+
+/**
+ * @brief The state of a parse: the tokens and the index of the next one.
+ */
+typedef struct parser {
+  tvec* tokens;
+  int pos;
+  int error;
+  arena* ar;
+  FILE* errs;  // where syntax errors are reported, NULL for nowhere
+} parser;
+
+static node* parse_list(parser* p, int nested);
+
+static node* make_node(parser* p, node_type type) {
+  node* n = arena_alloc(p->ar, sizeof(node));
+  memset(n, 0, sizeof(node));
+  n->type = type;
+  return n;
+}
+
+/**
+ * @brief Checks if a word has command substitutions to run before it is
+ * used.
+ */
+static int has_subst(const char* word) {
+  return strpbrk(word, SUBST_MARKS) != NULL;
+}
+
+/**
+ * @brief Appends an operand to a list, and/or chain or pipeline.
+ *
+ * The arrays are grown whenever their size reaches a power of two.
+ */
+static void push_kid(parser* p, node* n, tok_type op, node* kid) {
+  if ((n->nkids & (n->nkids - 1)) == 0) {
+    int cap = n->nkids ? n->nkids * 2 : 1;
+    n->kids = arena_realloc(p->ar, n->kids, n->nkids * sizeof(node*),
+                            cap * sizeof(node*));
+    if (n->type == NODE_AND_OR) {
+      n->ops = arena_realloc(p->ar, n->ops, n->nkids * sizeof(tok_type),
+                             cap * sizeof(tok_type));
+    }
+  }
+  if (n->type == NODE_AND_OR) {
+    n->ops[n->nkids] = op;
+  }
+  n->kids[n->nkids++] = kid;
+}
+
+/**
+ * @brief Gets the next token without consuming it, NULL at the end of the
+ * line. Continuation backslashes are skipped.
+ */
+static token* peek(parser* p) {
+  while (p->pos < p->tokens->size &&
+         p->tokens->data[p->pos].type == TOK_BSLASH) {
+    p->pos++;
+  }
+  return p->pos < p->tokens->size ? p->tokens->data + p->pos : NULL;
+}
+
+static int peek_is(parser* p, tok_type type) {
+  token* tok = peek(p);
+  return tok != NULL && tok->type == type;
+}
+
+static node* syntax_error(parser* p) {
+  if (!p->error && p->errs != NULL) {
+    token* tok = peek(p);
+    fprintf(p->errs, "nush: syntax error near unexpected token `%s'\n",
+            tok ? tok_name(tok) : "newline");
+  }
+  p->error = 1;
+  return NULL;
+}
+
+/**
+ * @brief Checks if a token starts a redirection.
+ */
+static int is_redirect(token* tok) {
+  switch (tok->type) {
+    case TOK_LT:
+    case TOK_GT:
+    case TOK_DGREAT:
+    case TOK_LTGT:
+    case TOK_GTAND:
+    case TOK_LTAND:
+    case TOK_DLESS:
+    case TOK_DLESSDASH:
+    case TOK_TLESS:
+    case TOK_IO_NUMBER:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+/**
+ * @brief Appends a redirection to a command or subshell.
+ *
+ * The array is grown whenever its size reaches a power of two.
+ */
+static void push_redir(parser* p, node* n, redir red) {
+  if ((n->nreds & (n->nreds - 1)) == 0) {
+    int cap = n->nreds ? n->nreds * 2 : 1;
+    n->reds = arena_realloc(p->ar, n->reds, n->nreds * sizeof(redir),
+                            cap * sizeof(redir));
+  }
+  n->reds[n->nreds++] = red;
+  n->subst |= has_subst(red.target);
+}
+
+/**
+ * @brief Gets the descriptor a redirection operator applies to when no
+ * number is written before it.
+ */
+static int default_fd(tok_type op) {
+  return op == TOK_GT || op == TOK_DGREAT || op == TOK_GTAND ? 1 : 0;
+}
+
+/**
+ * @brief Parses a redirection: an optional descriptor number, the operator
+ * and the file or descriptor it redirects to.
+ */
+static int parse_redirect(parser* p, node* n) {
+  redir red = {-1, TOK_LT, NULL};
+  token* tok = peek(p);
+  if (tok->type == TOK_IO_NUMBER) {
+    red.fd = atoi(tok->text);
+    p->pos++;
+    tok = peek(p);
+    if (tok == NULL || tok->type == TOK_IO_NUMBER || !is_redirect(tok)) {
+      syntax_error(p);
+      return -1;
+    }
+  }
+  red.op = tok->type;
+  if (red.fd < 0) {
+    red.fd = default_fd(red.op);
+  }
+  p->pos++;
+
+  token* target = peek(p);
+  if (target == NULL || target->type != TOK_WORD) {
+    syntax_error(p);
+    return -1;
+  }
+  red.target = target->text;
+  p->pos++;
+  push_redir(p, n, red);
+  return 0;
+}
+
+/**
+ * @brief Parses a command: either words or a parenthesized list, along with
+ * any number of redirections.
+ *
+ * Redirections are kept in the order they were written, so that later ones
+ * are applied last.
+ */
+static node* parse_command(parser* p) {
+  node* cmd;
+
+  if (peek_is(p, TOK_LPAREN)) {
+    p->pos++;
+    node* body = parse_list(p, 1);
+    if (body == NULL) {
+      return syntax_error(p);
+    }
+    if (!peek_is(p, TOK_RPAREN)) {
+      return syntax_error(p);
+    }
+    p->pos++;
+    // ((list)) isolates no more than (list)
+    if (body->type == NODE_SUBSHELL && body->nreds == 0) {
+      cmd = body;
+    } else {
+      cmd = make_node(p, NODE_SUBSHELL);
+      cmd->body = body;
+    }
+  } else {
+    cmd = make_node(p, NODE_CMD);
+    cmd->argv = make_arena_svec(p->ar);
+  }
+
+  token* tok;
+  while ((tok = peek(p)) != NULL) {
+    if (tok->type == TOK_WORD && cmd->type == NODE_CMD) {
+      svec_push_back(cmd->argv, tok->text);
+      cmd->subst |= has_subst(tok->text);
+      p->pos++;
+    } else if (is_redirect(tok)) {
+      if (parse_redirect(p, cmd) != 0) {
+        return NULL;
+      }
+    } else {
+      break;
+    }
+  }
+
+  if (cmd->type == NODE_CMD && cmd->argv->size == 0 && cmd->nreds == 0) {
+    return syntax_error(p);
+  }
+  return cmd;
+}
+
+/**
+ * @brief Parses commands joined by |, which may be timed with the time
+ * keyword before them.
+ */
+static node* parse_pipeline(parser* p) {
+  token* tok = peek(p);
+  if (tok != NULL && tok->type == TOK_WORD && strcmp(tok->text, "time") == 0) {
+    p->pos++;
+    node* timed = make_node(p, NODE_TIME);
+    timed->body = parse_pipeline(p);
+    return timed->body != NULL ? timed : NULL;
+  }
+
+  node* stage = parse_command(p);
+  if (stage == NULL || !peek_is(p, TOK_PIPE)) {
+    return stage;
+  }
+
+  node* pipeline = make_node(p, NODE_PIPE);
+  push_kid(p, pipeline, TOK_PIPE, stage);
+  while (peek_is(p, TOK_PIPE)) {
+    p->pos++;
+    stage = parse_command(p);
+    if (stage == NULL) {
+      return syntax_error(p);
+    }
+    push_kid(p, pipeline, TOK_PIPE, stage);
+  }
+  return pipeline->nkids > 1 ? pipeline : pipeline->kids[0];
+}
+
+/**
+ * @brief Parses pipelines joined by && and ||.
+ */
+static node* parse_and_or(parser* p) {
+  node* pipeline = parse_pipeline(p);
+  if (pipeline == NULL || !(peek_is(p, TOK_AND) || peek_is(p, TOK_OR))) {
+    return pipeline;
+  }
+
+  node* chain = make_node(p, NODE_AND_OR);
+  push_kid(p, chain, TOK_AND, pipeline);
+  while (peek_is(p, TOK_AND) || peek_is(p, TOK_OR)) {
+    tok_type op = peek(p)->type;
+    p->pos++;
+    pipeline = parse_pipeline(p);
+    if (pipeline == NULL) {
+      return syntax_error(p);
+    }
+    push_kid(p, chain, op, pipeline);
+  }
+  return chain;
+}
+
+/**
+ * @brief Parses and/or chains separated by ; or &, up to the end of the line
+ * or, if nested, the closing parenthesis.
+ *
+ * A trailing separator is allowed. An empty list is returned as NULL.
+ */
+static node* parse_list(parser* p, int nested) {
+  node* list = make_node(p, NODE_LIST);
+  token* tok;
+  while ((tok = peek(p)) != NULL && !(nested && tok->type == TOK_RPAREN)) {
+    node* item = parse_and_or(p);
+    if (item == NULL) {
+      return syntax_error(p);
+    }
+
+    if (peek_is(p, TOK_AMP)) {
+      p->pos++;
+      node* bg = make_node(p, NODE_BG);
+      bg->body = item;
+      item = bg;
+    } else if (peek_is(p, TOK_SEMI)) {
+      p->pos++;
+    } else if (peek(p) != NULL && !(nested && peek_is(p, TOK_RPAREN))) {
+      return syntax_error(p);
+    }
+    push_kid(p, list, TOK_SEMI, item);
+  }
+
+  if (list->nkids <= 1) {
+    return list->nkids ? list->kids[0] : NULL;
+  }
+  return list;
+}
+
+/**
+ * @brief Builds the tree of a tokenized command line.
+ *
+ * The tree is allocated from {@code ar} and references the words of
+ * {@code tokens}.
+ *
+ * @param ar      is the arena of the line.
+ * @param tokens  is the tokens of the line.
+ * @param tree    is set to the root of the tree, NULL for an empty line.
+ * @param errs    is where a syntax error is reported, NULL to only return it.
+ * @return int    is 0 on success and -1 on a syntax error.
+ */
+int parse(arena* ar, tvec* tokens, node** tree, FILE* errs) {
+  parser p = {tokens, 0, 0, ar, errs};
+  *tree = parse_list(&p, 0);
+  if (!p.error && peek(&p) != NULL) {
+    syntax_error(&p);
+    *tree = NULL;
+  }
+  if (p.error) {
+    *tree = NULL;
+    return -1;
+  }
+  return 0;
+}
+
+static int is_heredoc(redir* red) {
+  return red->op == TOK_DLESS || red->op == TOK_DLESSDASH;
+}
+
+/**
+ * @brief Checks if a freshly parsed tree has here-documents to read.
+ */
+static int has_heredocs(node* n) {
+  if (n == NULL) {
+    return 0;
+  }
+  for (int ii = 0; ii < n->nreds; ii++) {
+    if (is_heredoc(n->reds + ii)) {
+      return 1;
+    }
+  }
+  for (int ii = 0; ii < n->nkids; ii++) {
+    if (has_heredocs(n->kids[ii])) {
+      return 1;
+    }
+  }
+  return has_heredocs(n->body);
+}
+
+/**
+ * @brief Reads the body of a here-document, up to the line that is its
+ * delimiter, into the arena.
+ */
+static char* read_heredoc(arena* ar, redir* red, reader* rd, FILE* errs) {
+  size_t len = 0;
+  size_t cap = 256;
+  char* body = arena_alloc(ar, cap);
+  char* line;
+  size_t line_len;
+  while ((line = reader_raw_line(rd, &line_len)) != NULL) {
+    if (red->op == TOK_DLESSDASH) {
+      size_t tabs = strspn(line, "\t");
+      line += tabs;
+      line_len -= tabs;
+    }
+    if (strcmp(line, red->target) == 0) {
+      break;
+    }
+    if (len + line_len + 2 > cap) {
+      size_t old = cap;
+      while (len + line_len + 2 > cap) {
+        cap *= 2;
+      }
+      body = arena_realloc(ar, body, old, cap);
+    }
+    memcpy(body + len, line, line_len);
+    len += line_len;
+    body[len++] = '\n';
+  }
+  if (line == NULL && errs != NULL) {
+    fprintf(errs,
+            "nush: warning: here-document delimited by end-of-file "
+            "(wanted `%s')\n",
+            red->target);
+  }
+  body[len] = 0;
+  return body;
+}
+
+/**
+ * @brief Reads the here-documents of a tree in the order they were written.
+ */
+static void read_heredocs(arena* ar, node* n, reader* rd, FILE* errs) {
+  if (n == NULL) {
+    return;
+  }
+  for (int ii = 0; ii < n->nkids; ii++) {
+    read_heredocs(ar, n->kids[ii], rd, errs);
+  }
+  read_heredocs(ar, n->body, rd, errs);
+  for (int ii = 0; ii < n->nreds; ii++) {
+    redir* red = n->reds + ii;
+    if (is_heredoc(red)) {
+      red->target = read_heredoc(ar, red, rd, errs);
+      red->op = TOK_DLESS;
+    }
+  }
+}
+
+/**
+ * @brief Reads the bodies of the here-documents of a parsed line from the
+ * lines that follow it.
+ *
+ * Each here-document redirection is left with its body as its target, with
+ * any tabs stripped, so that it can be opened without knowing how it was
+ * written.
+ *
+ * @param ar    is the arena of the line.
+ * @param tree  is the parsed line, it may reference the reader's buffer.
+ * @param rd    is the reader the line came from.
+ * @param errs  is where an unterminated here-document is reported, NULL for
+ * nowhere.
+ * @return node* is the tree to run, a copy in the arena if it had
+ * here-documents, since reading more lines can move the line it references.
+ */
+node* parse_heredocs(arena* ar, node* tree, reader* rd, FILE* errs) {
+  if (!has_heredocs(tree)) {
+    return tree;
+  }
+  tree = clone_node(ar, tree);
+  read_heredocs(ar, tree, rd, errs);
+  return tree;
+}
+
+/**
+ * @brief Reads and drops the bodies of the here-documents of a line that
+ * could not be parsed, so that they are not run as commands.
+ *
+ * @param ar      is the arena of the line.
+ * @param tokens  is the tokens of the line, their text may reference the
+ * reader's buffer.
+ * @param rd      is the reader the line came from.
+ */
+void skip_heredocs(arena* ar, tvec* tokens, reader* rd) {
+  // The delimiters are copied before any body is read, which can move the
+  // line they are in.
+  redir* reds = arena_alloc(ar, (tokens->size + 1) * sizeof(redir));
+  int nreds = 0;
+  for (int ii = 0; ii + 1 < tokens->size; ii++) {
+    token* tok = tokens->data + ii;
+    if ((tok->type == TOK_DLESS || tok->type == TOK_DLESSDASH) &&
+        tok[1].type == TOK_WORD) {
+      reds[nreds++] = (redir){0, tok->type, arena_strdup(ar, tok[1].text)};
+    }
+  }
+  for (int ii = 0; ii < nreds; ii++) {
+    read_heredoc(ar, reds + ii, rd, NULL);
+  }
+}
+
+/**
+ * @brief A string being built by {@code unparse}, truncated to its size.
+ */
+typedef struct text_buf {
+  char* buf;
+  size_t size;
+  size_t len;
+} text_buf;
+
+static void append_text(text_buf* tb, const char* str) {
+  for (; *str; str++, tb->len++) {
+    if (tb->len + 1 < tb->size) {
+      tb->buf[tb->len] = *str;
+    }
+  }
+}
+
+/**
+ * @brief Writes a word, quoted if it has to be, with its substitutions
+ * written out again.
+ */
+static void unparse_word(const char* word, text_buf* tb) {
+  int quote = *word == 0;
+  for (const char* ch = word; *ch && !quote; ch++) {
+    if (strchr(SUBST_MARKS, *ch) != NULL) {
+      ch = strchr(ch, SUBST_END);
+      if (ch == NULL) {
+        break;
+      }
+    } else {
+      quote = strchr(" \t\n;&|<>()\\", *ch) != NULL;
+    }
+  }
+
+  append_text(tb, quote ? "\"" : "");
+  char piece[2] = {0, 0};
+  const char* close = ")";
+  for (const char* ch = word; *ch; ch++) {
+    if (*ch == SUBST_QUOTED && !quote) {
+      close = ")\"";
+      append_text(tb, "\"$(");
+    } else if (*ch == SUBST_IN || *ch == SUBST_OUT) {
+      close = ")";
+      append_text(tb, *ch == SUBST_IN ? "<(" : ">(");
+    } else if (*ch == SUBST_START || *ch == SUBST_QUOTED) {
+      close = ")";
+      append_text(tb, "$(");
+    } else if (*ch == SUBST_END) {
+      append_text(tb, close);
+    } else {
+      piece[0] = *ch;
+      append_text(tb, piece);
+    }
+  }
+  append_text(tb, quote ? "\"" : "");
+}
+
+static void unparse_redirects(node* n, text_buf* tb) {
+  for (int ii = 0; ii < n->nreds; ii++) {
+    redir* red = n->reds + ii;
+    token tok = {red->op, NULL};
+    char fd[16];
+    snprintf(fd, sizeof(fd), "%d", red->fd);
+    append_text(tb, ii || n->type == NODE_SUBSHELL || n->argv->size ? " " : "");
+    append_text(tb, red->fd == default_fd(red->op) ? "" : fd);
+    append_text(tb, tok_name(&tok));
+    if (red->op == TOK_DLESS) {
+      // The body would not fit on the line, only where it is from is shown.
+      append_text(tb, " (here-document)");
+      continue;
+    }
+    append_text(tb, red->op == TOK_GTAND || red->op == TOK_LTAND ? "" : " ");
+    unparse_word(red->target, tb);
+  }
+}
+
+static void unparse_into(node* n, text_buf* tb) {
+  switch (n->type) {
+    case NODE_CMD:
+      for (int ii = 0; ii < n->argv->size; ii++) {
+        append_text(tb, ii ? " " : "");
+        unparse_word(n->argv->data[ii], tb);
+      }
+      unparse_redirects(n, tb);
+      break;
+    case NODE_LIST:
+    case NODE_AND_OR:
+    case NODE_PIPE:
+      for (int ii = 0; ii < n->nkids; ii++) {
+        if (ii > 0) {
+          if (n->type == NODE_PIPE) {
+            append_text(tb, " | ");
+          } else if (n->type == NODE_AND_OR) {
+            append_text(tb, n->ops[ii] == TOK_AND ? " && " : " || ");
+          } else {
+            append_text(tb, n->kids[ii - 1]->type == NODE_BG ? " " : "; ");
+          }
+        }
+        unparse_into(n->kids[ii], tb);
+      }
+      break;
+    case NODE_BG:
+      unparse_into(n->body, tb);
+      append_text(tb, " &");
+      break;
+    case NODE_TIME:
+      append_text(tb, "time ");
+      unparse_into(n->body, tb);
+      break;
+    case NODE_SUBSHELL:
+      append_text(tb, "(");
+      unparse_into(n->body, tb);
+      append_text(tb, ")");
+      unparse_redirects(n, tb);
+      break;
+  }
+}
+
+/**
+ * @brief Writes a node back out as a command line, for messages about it.
+ *
+ * @param n     is the node to write.
+ * @param buf   is where the text goes, it is truncated to fit and always
+ * terminated.
+ * @param size  is the size of {@code buf}.
+ * @return size_t is the length of the full text.
+ */
+size_t unparse(node* n, char* buf, size_t size) {
+  text_buf tb = {buf, size, 0};
+  unparse_into(n, &tb);
+  if (size > 0) {
+    buf[tb.len < size ? tb.len : size - 1] = 0;
+  }
+  return tb.len;
+}
+
+/**
+ * @brief Copies a tree and all its words into another arena, so that it can
+ * outlive the line it was parsed from.
+ */
+node* clone_node(arena* ar, node* n) {
+  if (n == NULL) {
+    return NULL;
+  }
+  node* copy = arena_alloc(ar, sizeof(node));
+  *copy = *n;
+  if (n->nkids > 0) {
+    copy->kids = arena_alloc(ar, n->nkids * sizeof(node*));
+    for (int ii = 0; ii < n->nkids; ii++) {
+      copy->kids[ii] = clone_node(ar, n->kids[ii]);
+    }
+  }
+  if (n->ops != NULL) {
+    copy->ops = arena_alloc(ar, n->nkids * sizeof(tok_type));
+    memcpy(copy->ops, n->ops, n->nkids * sizeof(tok_type));
+  }
+  copy->body = clone_node(ar, n->body);
+  if (n->argv != NULL) {
+    copy->argv = make_arena_svec(ar);
+    for (int ii = 0; ii < n->argv->size; ii++) {
+      svec_push_back(copy->argv, arena_strdup(ar, n->argv->data[ii]));
+    }
+  }
+  if (n->nreds > 0) {
+    copy->reds = arena_alloc(ar, n->nreds * sizeof(redir));
+    for (int ii = 0; ii < n->nreds; ii++) {
+      copy->reds[ii] = n->reds[ii];
+      copy->reds[ii].target = arena_strdup(ar, n->reds[ii].target);
+    }
+  }
+  return copy;
+}
@@ -0,0 +1,69 @@
+#ifndef PARSE_H
+#define PARSE_H
+
+#include <stdio.h>
+
+#include "arena.h"
+#include "reader.h"
+#include "svec.h"
+#include "tokens.h"
+
+/**
+ * @brief The kinds of node in a parsed command line.
+ */
+typedef enum node_type {
+  NODE_CMD,       // a command and its arguments
+  NODE_LIST,      // commands separated by ;
+  NODE_AND_OR,    // pipelines joined by && and ||
+  NODE_PIPE,      // commands joined by |
+  NODE_BG,        // a command followed by &
+  NODE_SUBSHELL,  // a list inside ( )
+  NODE_TIME,      // a pipeline after the time keyword
+} node_type;
+
+/**
+ * @brief A redirection of a command or subshell.
+ *
+ * {@code op} is one of <, >, >>, <>, which open {@code target}, or >& and <&,
+ * which make {@code fd} a copy of the descriptor {@code target} names, or
+ * close it if {@code target} is "-". Here-documents, <<, have their body as
+ * {@code target} once it is read, and here-strings, <<<, a word that is
+ * given a newline.
+ */
+typedef struct redir {
+  int fd;
+  tok_type op;
+  char* target;
+} redir;
+
+/**
+ * @brief A node of the tree built by {@code parse}.
+ *
+ * Lists, and/or chains and pipelines keep their operands in {@code kids}.
+ * Background, subshell and time nodes wrap a single {@code body}. Commands and
+ * subshells carry their redirections, applied in order; a command with no
+ * words only has redirections.
+ */
+typedef struct node {
+  node_type type;
+  int nkids;
+  struct node** kids;
+  tok_type* ops;  // NODE_AND_OR: ops[ii] joins kids[ii - 1] and kids[ii]
+  struct node* body;
+  svec* argv;     // NODE_CMD: references the words of the parsed tokens
+  int nreds;
+  redir* reds;
+  int subst;  // words or targets have command substitutions to run first
+} node;
+
+int parse(arena* ar, tvec* tokens, node** tree, FILE* errs);
+
+node* parse_heredocs(arena* ar, node* tree, reader* rd, FILE* errs);
+
+void skip_heredocs(arena* ar, tvec* tokens, reader* rd);
+
+size_t unparse(node* n, char* buf, size_t size);
+
+node* clone_node(arena* ar, node* n);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,232 @@
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "reader.h"
+#include "scan.h"
+
+// The least room asked of each read.
+#define READ_CHUNK (64 * 1024)
+
+/**
+ * @brief Creates a reader.
+ *
+ * @param fd      is the file descriptor to read, it is not closed by the
+ * reader.
+ * @param prompt  is printed when a line is continued onto the next one, NULL
+ * to print nothing.
+ */
+reader* make_reader(int fd, const char* prompt) {
+  reader* rd = calloc(1, sizeof(reader));
+  rd->fd = fd;
+  rd->cap = READ_CHUNK;
+  rd->buf = malloc(rd->cap);
+  rd->prompt = prompt;
+  return rd;
+}
+
+/**
+ * @brief Creates a reader over a whole regular file by mapping it instead of
+ * reading it.
+ *
+ * The mapping is private and writable, so lines and the words in them are
+ * terminated in place, and only the pages written to are copied. It is
+ * followed by a zeroed byte to terminate a last line with no newline, which
+ * the pages of the file itself may not have room for. Anything that cannot
+ * be mapped is read instead.
+ *
+ * @param fd  is the file descriptor of the file, it is not closed by the
+ * reader.
+ */
+reader* map_reader(int fd) {
+  struct stat st;
+  if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+    return make_reader(fd, NULL);
+  }
+
+  size_t size = st.st_size;
+  char* buf = mmap(NULL, size + 1, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (buf == MAP_FAILED) {
+    return make_reader(fd, NULL);
+  }
+  if (mmap(buf, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd,
+           0) == MAP_FAILED) {
+    munmap(buf, size + 1);
+    return make_reader(fd, NULL);
+  }
+  madvise(buf, size, MADV_SEQUENTIAL);
+
+  reader* rd = calloc(1, sizeof(reader));
+  rd->fd = fd;
+  rd->buf = buf;
+  rd->cap = size + 1;
+  rd->end = size;
+  rd->eof = 1;
+  rd->mapped = 1;
+  return rd;
+}
+
+void free_reader(reader* rd) {
+  if (rd->mapped) {
+    munmap(rd->buf, rd->cap);
+  } else {
+    free(rd->buf);
+  }
+  free(rd);
+}
+
+/**
+ * @brief Waits until there is input to read, calling the waker of the reader
+ * whenever its descriptor becomes readable first.
+ */
+static void wait_input(reader* rd) {
+  struct pollfd fds[2] = {{rd->fd, POLLIN, 0}, {rd->wake_fd, POLLIN, 0}};
+  for (;;) {
+    int ready = poll(fds, 2, -1);
+    if (ready < 0 && errno != EINTR) {
+      return;
+    }
+    if (ready > 0 && fds[1].revents != 0) {
+      rd->wake(rd->wake_ctx);
+    }
+    if (ready > 0 && fds[0].revents != 0) {
+      return;
+    }
+  }
+}
+
+/**
+ * @brief Reads the next chunk of input after what is buffered.
+ *
+ * The lines already returned are dropped from the front of the buffer first,
+ * and the buffer is doubled if that does not leave room for a chunk. One
+ * byte is always left to terminate the last line.
+ */
+static void fill(reader* rd) {
+  if (rd->start > 0 && rd->cap - rd->end <= READ_CHUNK) {
+    memmove(rd->buf, rd->buf + rd->start, rd->end - rd->start);
+    rd->scan -= rd->start;
+    rd->end -= rd->start;
+    rd->start = 0;
+  }
+  while (rd->cap - rd->end <= READ_CHUNK) {
+    rd->cap *= 2;
+    rd->buf = realloc(rd->buf, rd->cap);
+  }
+
+  if (rd->wake != NULL) {
+    wait_input(rd);
+  }
+  ssize_t got;
+  while ((got = read(rd->fd, rd->buf + rd->end, rd->cap - rd->end - 1)) < 0) {
+    if (errno != EINTR) {
+      perror("nush: read");
+      break;
+    }
+  }
+  if (got <= 0) {
+    rd->eof = 1;
+  } else {
+    rd->end += got;
+  }
+}
+
+/**
+ * @brief Ends the next line at {@code pos} and moves past it.
+ */
+static char* take_line(reader* rd, size_t pos, size_t* len) {
+  char* line = rd->buf + rd->start;
+  rd->buf[pos] = 0;
+  if (len != NULL) {
+    *len = pos - rd->start;
+  }
+  rd->start = rd->scan = pos < rd->end ? pos + 1 : pos;
+  return line;
+}
+
+/**
+ * @brief Reads the next logical line.
+ *
+ * Continued lines and quoted newlines are kept in the line as they were
+ * written, the tokenizer treats them as blanks. The newline ending the line
+ * is not included.
+ *
+ * @param rd    is the reader.
+ * @param len   is set to the length of the line if not NULL.
+ * @return char* is the line, valid until the next call, or NULL once the
+ * input is exhausted.
+ */
+char* reader_line(reader* rd, size_t* len) {
+  while (1) {
+    for (; rd->scan < rd->end; rd->scan++) {
+      // Other bytes only matter right after a backslash.
+      if (!rd->escaped) {
+        rd->scan += scan_line(rd->buf + rd->scan, rd->end - rd->scan);
+        if (rd->scan == rd->end) {
+          break;
+        }
+      }
+      char cc = rd->buf[rd->scan];
+      if (cc == '"') {
+        rd->quoted = !rd->quoted;
+        rd->escaped = 0;
+      } else if (rd->quoted) {
+        continue;
+      } else if (cc == '\n') {
+        if (!rd->escaped) {
+          return take_line(rd, rd->scan, len);
+        }
+        rd->escaped = 0;
+      } else if (cc == '\\') {
+        rd->escaped = 1;
+      } else if (cc != ' ' && cc != '\t' && cc != '\r') {
+        rd->escaped = 0;
+      }
+    }
+
+    if (rd->eof) {
+      rd->quoted = rd->escaped = 0;
+      return rd->start < rd->end ? take_line(rd, rd->end, len) : NULL;
+    }
+    if (rd->prompt != NULL && rd->scan > rd->start &&
+        rd->buf[rd->scan - 1] == '\n') {
+      fputs(rd->prompt, stdout);
+      fflush(stdout);
+    }
+    fill(rd);
+  }
+}
+
+/**
+ * @brief Reads the next line as it was written, for the bodies of
+ * here-documents, where quotes and backslashes mean nothing.
+ *
+ * @param rd    is the reader.
+ * @param len   is set to the length of the line if not NULL.
+ * @return char* is the line, valid until the next call, or NULL once the
+ * input is exhausted.
+ */
+char* reader_raw_line(reader* rd, size_t* len) {
+  while (1) {
+    char* nl = memchr(rd->buf + rd->scan, '\n', rd->end - rd->scan);
+    if (nl != NULL) {
+      return take_line(rd, nl - rd->buf, len);
+    }
+    rd->scan = rd->end;
+
+    if (rd->eof) {
+      return rd->start < rd->end ? take_line(rd, rd->end, len) : NULL;
+    }
+    if (rd->prompt != NULL && rd->scan == rd->start) {
+      fputs(rd->prompt, stdout);
+      fflush(stdout);
+    }
+    fill(rd);
+  }
+}
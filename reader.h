@@ -0,0 +1,42 @@
+#ifndef READER_H
+#define READER_H
+
+#include <stddef.h>
+
+typedef void (*reader_waker)(void* ctx);
+
+/**
+ * @brief Reads logical command lines from a file descriptor.
+ *
+ * Input is read in large chunks into a single buffer that grows to hold the
+ * longest line seen. A logical line ends at a newline that is neither inside
+ * quotes nor after a continuation backslash.
+ */
+typedef struct reader {
+  int fd;
+  char* buf;
+  size_t cap;
+  size_t start;  // where the next line starts
+  size_t scan;   // how far the next line has been scanned
+  size_t end;    // how much of the buffer has been read
+  int quoted;    // the scan is inside quotes
+  int escaped;   // the scan is after a backslash and blanks only
+  int eof;
+  int mapped;    // the buffer is a mapping of the whole file
+  const char* prompt;  // shown when a line needs more input, NULL if none
+  int wake_fd;  // while waiting for input, wake is called when this is readable
+  reader_waker wake;  // NULL to only wait for input
+  void* wake_ctx;
+} reader;
+
+reader* make_reader(int fd, const char* prompt);
+
+reader* map_reader(int fd);
+
+void free_reader(reader* rd);
+
+char* reader_line(reader* rd, size_t* len);
+
+char* reader_raw_line(reader* rd, size_t* len);
+
+#endif
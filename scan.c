@@ -0,0 +1,280 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "scan.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SCAN_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Bytes that end a run of word characters: whitespace, operators,
+ * quotes and the starts of command substitutions.
+ */
+static const unsigned char word_special[256] = {
+    ['\t'] = 1, ['\n'] = 1, ['\v'] = 1, ['\f'] = 1, ['\r'] = 1, [' '] = 1,
+    ['<'] = 1,  ['>'] = 1,  [';'] = 1,  ['('] = 1,  [')'] = 1,  ['\\'] = 1,
+    ['&'] = 1,  ['|'] = 1,  ['"'] = 1,  ['$'] = 1,  ['`'] = 1,
+};
+
+/**
+ * @brief Bytes that can end a logical line or change where it ends.
+ */
+static const unsigned char line_special[256] = {
+    ['\n'] = 1,
+    ['"'] = 1,
+    ['\\'] = 1,
+};
+
+static size_t scan_scalar(const unsigned char* special, const char* str,
+                          size_t len) {
+  size_t ii = 0;
+  while (ii < len && !special[(unsigned char)str[ii]]) {
+    ii++;
+  }
+  return ii;
+}
+
+/**
+ * @brief Sets the bits of the word special bytes of a block of up to 64
+ * bytes, one at a time.
+ */
+static uint64_t block_bits_scalar(const char* str, size_t len) {
+  uint64_t bits = 0;
+  for (size_t ii = 0; ii < len; ii++) {
+    bits |= (uint64_t)word_special[(unsigned char)str[ii]] << ii;
+  }
+  return bits;
+}
+
+static void word_bits_scalar(const char* str, size_t len, uint64_t* bits) {
+  for (size_t ii = 0; ii < len; ii += 64) {
+    bits[ii / 64] = block_bits_scalar(str + ii, len - ii < 64 ? len - ii : 64);
+  }
+}
+
+static size_t scan_line_scalar(const char* str, size_t len) {
+  return scan_scalar(line_special, str, len);
+}
+
+#ifdef SCAN_X86
+
+// The bytes compared one by one. For words, the rest of the whitespace, \t
+// to \r, is compared as a range: those bytes are positive and the bytes
+// above 0x7f negative, so a signed comparison works.
+static const char word_bytes[] = " <>;()\\&|\"$`";
+static const char line_bytes[] = "\n\"\\";
+
+__attribute__((target("sse2"))) static inline __m128i match_sse2(
+    __m128i v, const char* bytes, int spaces) {
+  __m128i m = _mm_setzero_si128();
+  if (spaces) {
+    m = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('\t' - 1)),
+                      _mm_cmplt_epi8(v, _mm_set1_epi8('\r' + 1)));
+  }
+  for (; *bytes; bytes++) {
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(*bytes)));
+  }
+  return m;
+}
+
+__attribute__((target("avx2"))) static inline __m256i match_avx2(
+    __m256i v, const char* bytes) {
+  __m256i m = _mm256_setzero_si256();
+  for (; *bytes; bytes++) {
+    m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(*bytes)));
+  }
+  return m;
+}
+
+/**
+ * @brief Finds the word special bytes with two table lookups per byte
+ * instead of a comparison per special byte.
+ *
+ * The special bytes fall in five groups of high nibbles: 0x0_ for \t to \r,
+ * 0x2_ for the space, quote, $, & and parentheses, 0x3_ for ; < >, 0x5_ or
+ * 0x7_ for \ and | and 0x6_ for the backtick. Each group gets a bit, set in
+ * the table of high nibbles for the group and in the table of low nibbles for
+ * each byte of it, and a byte is special if its two lookups share a bit.
+ */
+__attribute__((target("avx2"))) static inline __m256i word_match_avx2(
+    __m256i v) {
+  const __m256i lo_table =
+      _mm256_setr_epi8(18, 0, 2, 0, 2, 0, 2, 0, 2, 3, 1, 5, 13, 1, 4, 0,  //
+                       18, 0, 2, 0, 2, 0, 2, 0, 2, 3, 1, 5, 13, 1, 4, 0);
+  const __m256i hi_table =
+      _mm256_setr_epi8(1, 0, 2, 4, 0, 8, 16, 8, 0, 0, 0, 0, 0, 0, 0, 0,  //
+                       1, 0, 2, 4, 0, 8, 16, 8, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m256i nibble = _mm256_set1_epi8(0x0f);
+  __m256i lo = _mm256_and_si256(v, nibble);
+  __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble);
+  __m256i both = _mm256_and_si256(_mm256_shuffle_epi8(lo_table, lo),
+                                  _mm256_shuffle_epi8(hi_table, hi));
+  return _mm256_xor_si256(_mm256_cmpeq_epi8(both, _mm256_setzero_si256()),
+                          _mm256_set1_epi8(-1));
+}
+
+__attribute__((target("sse2"))) static void word_bits_sse2(const char* str,
+                                                            size_t len,
+                                                            uint64_t* bits) {
+  size_t ii = 0;
+  for (; ii + 64 <= len; ii += 64) {
+    uint64_t block = 0;
+    for (int jj = 0; jj < 64; jj += 16) {
+      __m128i v = _mm_loadu_si128((const __m128i*)(str + ii + jj));
+      uint64_t mask = (unsigned)_mm_movemask_epi8(match_sse2(v, word_bytes, 1));
+      block |= mask << jj;
+    }
+    bits[ii / 64] = block;
+  }
+  if (ii < len) {
+    bits[ii / 64] = block_bits_scalar(str + ii, len - ii);
+  }
+}
+
+__attribute__((target("sse2"))) static size_t scan_line_sse2(const char* str,
+                                                             size_t len) {
+  size_t ii = 0;
+  for (; ii + 16 <= len; ii += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(str + ii));
+    int bits = _mm_movemask_epi8(match_sse2(v, line_bytes, 0));
+    if (bits != 0) {
+      return ii + __builtin_ctz(bits);
+    }
+  }
+  return ii + scan_line_scalar(str + ii, len - ii);
+}
+
+__attribute__((target("avx2"))) static void word_bits_avx2(const char* str,
+                                                            size_t len,
+                                                            uint64_t* bits) {
+  size_t ii = 0;
+  for (; ii + 64 <= len; ii += 64) {
+    __m256i lo = _mm256_loadu_si256((const __m256i*)(str + ii));
+    __m256i hi = _mm256_loadu_si256((const __m256i*)(str + ii + 32));
+    uint64_t lo_bits = (unsigned)_mm256_movemask_epi8(word_match_avx2(lo));
+    uint64_t hi_bits = (unsigned)_mm256_movemask_epi8(word_match_avx2(hi));
+    bits[ii / 64] = lo_bits | hi_bits << 32;
+  }
+  if (ii < len) {
+    bits[ii / 64] = block_bits_scalar(str + ii, len - ii);
+  }
+}
+
+__attribute__((target("avx2"))) static size_t scan_line_avx2(const char* str,
+                                                             size_t len) {
+  size_t ii = 0;
+  for (; ii + 32 <= len; ii += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(str + ii));
+    unsigned bits = _mm256_movemask_epi8(match_avx2(v, line_bytes));
+    if (bits != 0) {
+      return ii + __builtin_ctz(bits);
+    }
+  }
+  return ii + scan_line_sse2(str + ii, len - ii);
+}
+
+#endif
+
+typedef void (*bits_fn)(const char* str, size_t len, uint64_t* bits);
+typedef size_t (*scan_fn)(const char* str, size_t len);
+
+static void word_bits_first(const char* str, size_t len, uint64_t* bits);
+static size_t scan_line_first(const char* str, size_t len);
+
+static bits_fn word_bits_impl = word_bits_first;
+static scan_fn scan_line_impl = scan_line_first;
+
+/**
+ * @brief Picks the widest scanners the CPU supports.
+ *
+ * Setting NUSH_SCAN to scalar, sse2 or avx2 caps the width, so that every
+ * version can be checked on the same machine.
+ */
+static void pick_scanners() {
+  word_bits_impl = word_bits_scalar;
+  scan_line_impl = scan_line_scalar;
+#ifdef SCAN_X86
+  const char* cap = getenv("NUSH_SCAN");
+  if (cap != NULL && strcmp(cap, "scalar") == 0) {
+    return;
+  }
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse2")) {
+    word_bits_impl = word_bits_sse2;
+    scan_line_impl = scan_line_sse2;
+  }
+  if (cap != NULL && strcmp(cap, "sse2") == 0) {
+    return;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    word_bits_impl = word_bits_avx2;
+    scan_line_impl = scan_line_avx2;
+  }
+#endif
+}
+
+static void word_bits_first(const char* str, size_t len, uint64_t* bits) {
+  pick_scanners();
+  word_bits_impl(str, len, bits);
+}
+
+static size_t scan_line_first(const char* str, size_t len) {
+  pick_scanners();
+  return scan_line_impl(str, len);
+}
+
+/**
+ * @brief Marks where the whitespace, operator and quote bytes of a line are,
+ * so that the runs of word characters between them need not be looked at
+ * again.
+ *
+ * @param str   is the text to scan.
+ * @param len   is how many bytes of it to scan.
+ * @param bits  is set to a bit per byte, in blocks of 64 starting from the
+ * low bit. It needs room for {@code (len + 63) / 64} blocks.
+ */
+void scan_word_bits(const char* str, size_t len, uint64_t* bits) {
+  word_bits_impl(str, len, bits);
+}
+
+/**
+ * @brief Finds the first bit set by {@code scan_word_bits} at or after an
+ * index.
+ *
+ * @param bits  is the bits of the line.
+ * @param pos   is the index to start at.
+ * @param len   is the length of the line.
+ * @return size_t is the index of the bit, {@code len} if there is none.
+ */
+size_t next_word_bit(const uint64_t* bits, size_t pos, size_t len) {
+  if (pos >= len) {
+    return len;
+  }
+  size_t block = pos / 64;
+  uint64_t mask = bits[block] & (~(uint64_t)0 << (pos % 64));
+  size_t blocks = (len + 63) / 64;
+  while (mask == 0) {
+    if (++block == blocks) {
+      return len;
+    }
+    mask = bits[block];
+  }
+  size_t next = block * 64 + __builtin_ctzll(mask);
+  return next < len ? next : len;
+}
+
+/**
+ * @brief Finds the first newline, quote or backslash, the only bytes that
+ * decide where a logical line ends.
+ *
+ * @param str   is the text to scan.
+ * @param len   is how many bytes of it to scan.
+ * @return size_t is the index of the byte, {@code len} if there is none.
+ */
+size_t scan_line(const char* str, size_t len) {
+  return scan_line_impl(str, len);
+}
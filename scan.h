@@ -0,0 +1,13 @@
+#ifndef SCAN_H
+#define SCAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+void scan_word_bits(const char* str, size_t len, uint64_t* bits);
+
+size_t next_word_bit(const uint64_t* bits, size_t pos, size_t len);
+
+size_t scan_line(const char* str, size_t len);
+
+#endif
@@ -0,0 +1,68 @@
+#include <stddef.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "stats.h"
+
+static counters own;
+counters* stats = &own;
+
+static const struct {
+  const char* name;
+  size_t offset;
+} fields[] = {
+    {"forks", offsetof(counters, forks)},
+    {"execs", offsetof(counters, execs)},
+    {"pipes", offsetof(counters, pipes)},
+    {"copied", offsetof(counters, copied)},
+    {"tokens", offsetof(counters, tokens)},
+    {"svec_allocs", offsetof(counters, svec_allocs)},
+    {"svec_reallocs", offsetof(counters, svec_reallocs)},
+    {"jobs_started", offsetof(counters, jobs_started)},
+    {"jobs_reaped", offsetof(counters, jobs_reaped)},
+};
+
+/**
+ * @brief Moves the counters to a shared mapping, so that what forked
+ * children do is counted too. Until then, or if there is no mapping, each
+ * process counts for itself.
+ */
+void stats_init() {
+  counters* shared = mmap(NULL, sizeof(counters), PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (shared != MAP_FAILED) {
+    *shared = *stats;
+    stats = shared;
+  }
+}
+
+/**
+ * @brief Sets every counter back to 0.
+ */
+void stats_reset() {
+  memset(stats, 0, sizeof(counters));
+}
+
+/**
+ * @brief Prints the counters.
+ *
+ * @param out     is where they go.
+ * @param machine is 1 for a single line of key=value fields separated by
+ * spaces, like the accounting log, and 0 for a line per counter with the
+ * values aligned.
+ */
+void stats_print(FILE* out, int machine) {
+  int nfields = sizeof(fields) / sizeof(fields[0]);
+  for (int ii = 0; ii < nfields; ii++) {
+    unsigned long value =
+        *(const unsigned long*)((const char*)stats + fields[ii].offset);
+    if (machine) {
+      fprintf(out, "%s%s=%lu", ii ? " " : "", fields[ii].name, value);
+    } else {
+      fprintf(out, "%-14s %lu\n", fields[ii].name, value);
+    }
+  }
+  if (machine) {
+    fputc('\n', out);
+  }
+}
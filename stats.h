@@ -0,0 +1,34 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdio.h>
+
+/**
+ * @brief Counts of the work done by the shell, including the work of the
+ * children it forks, which share the counts once {@code stats_init} has run.
+ */
+typedef struct counters {
+  unsigned long forks;          // children forked, counted by the child
+  unsigned long execs;          // programs started, by posix_spawn or exec
+  unsigned long pipes;          // pipes created
+  unsigned long copied;         // bytes copied by the redirection helpers
+  unsigned long tokens;         // tokens produced by tokenize
+  unsigned long svec_allocs;    // svecs made
+  unsigned long svec_reallocs;  // svec arrays grown
+  unsigned long jobs_started;   // background jobs started
+  unsigned long jobs_reaped;    // background jobs reaped
+} counters;
+
+extern counters* stats;
+
+// Adds to a counter, which other processes of the shell may add to at once.
+#define STATS_ADD(field, n) \
+  __atomic_fetch_add(&stats->field, (n), __ATOMIC_RELAXED)
+
+void stats_init();
+
+void stats_reset();
+
+void stats_print(FILE* out, int machine);
+
+#endif
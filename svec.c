@@ -6,6 +6,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "stats.h"
 #include "svec.h"
 
 svec* make_svec(int refOnly) {
@@ -15,6 +16,25 @@ svec* make_svec(int refOnly) {
   sv->data = malloc(4 * sizeof(char*));
   memset(sv->data, 0, 4 * sizeof(char*));
   sv->refOnly = refOnly;
+  sv->ar = NULL;
+  STATS_ADD(svec_allocs, 1);
+  return sv;
+}
+
+/**
+ * @brief Creates a {@code svec} of references that is allocated from an
+ * arena.
+ *
+ * It is released with the arena and must not be freed.
+ */
+svec* make_arena_svec(arena* ar) {
+  svec* sv = arena_alloc(ar, sizeof(svec));
+  sv->size = 0;
+  sv->cap = 4;
+  sv->data = arena_alloc(ar, 4 * sizeof(char*));
+  sv->refOnly = 1;
+  sv->ar = ar;
+  STATS_ADD(svec_allocs, 1);
   return sv;
 }
 
@@ -22,6 +42,9 @@ svec* make_svec(int refOnly) {
  * @brief Frees a {@code svec}.
  */
 void free_svec(svec* sv) {
+  if (sv->ar != NULL) {
+    return;
+  }
   free_svec_data(sv);
   free(sv);
 }
@@ -57,7 +80,13 @@ void svec_push_back(svec* sv, char* item) {
 
   if (ii >= sv->cap) {
     sv->cap *= 2;
-    sv->data = (char**)realloc(sv->data, sv->cap * sizeof(char*));
+    STATS_ADD(svec_reallocs, 1);
+    if (sv->ar != NULL) {
+      sv->data = arena_realloc(sv->ar, sv->data, ii * sizeof(char*),
+                               sv->cap * sizeof(char*));
+    } else {
+      sv->data = (char**)realloc(sv->data, sv->cap * sizeof(char*));
+    }
   }
 
   sv->size = ii + 1;
@@ -77,12 +106,16 @@ void svec_reverse(svec* sv) {
   }
 }
 
+/**
+ * @brief Empties a {@code svec}, keeping its array for reuse.
+ */
 void clear_svec(svec* sv) {
-  free_svec_data(sv);
+  if (!sv->refOnly) {
+    for (int ii = 0; ii < sv->size; ++ii) {
+      free(sv->data[ii]);
+    }
+  }
   sv->size = 0;
-  sv->cap = 4;
-  sv->data = malloc(4 * sizeof(char*));
-  memset(sv->data, 0, 4 * sizeof(char*));
 }
 
 /**
@@ -104,11 +137,19 @@ void sub_svec(svec* sv, svec* dst, int start, int end) {
 /**
  * @brief Appends the contents of one {@svec} to the end of another.
  * 
- * The {@svec} added is freed automatically.
+ * The strings are moved rather than copied, the {@svec} added is freed
+ * automatically.
  */
 void append_svec(svec* sv, svec* to_add) {
+  // Strings owned by both vectors can change hands without a copy.
+  int move = !sv->refOnly && !to_add->refOnly;
+  sv->refOnly = sv->refOnly || move;
   for (int ii = 0; ii < to_add->size; ii++) {
     svec_push_back(sv, to_add->data[ii]);
   }
+  if (move) {
+    sv->refOnly = 0;
+    to_add->refOnly = 1;
+  }
   free_svec(to_add);
-}
\ No newline at end of file
+}
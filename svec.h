@@ -5,14 +5,18 @@
 #ifndef SVEC_H
 #define SVEC_H
 
+#include "arena.h"
+
 typedef struct svec {
   int size;
   int cap;
   char** data;
   int refOnly;
+  arena* ar; // If set, the vector and its array live in this arena.
 } svec;
 
 svec* make_svec(int refOnly);
+svec* make_arena_svec(arena* ar);
 void free_svec(svec* sv);
 void free_svec_data(svec* sv);
 
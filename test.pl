@@ -2,9 +2,13 @@
 use 5.16.0;
 use warnings FATAL => 'all';
 
-use Test::Simple tests => 22;
+use Test::Simple tests => 52;
+use Time::HiRes qw(time);
 
 system("mkdir -p tmp");
+system("rm -f tmp/history");
+$ENV{NUSH_HISTFILE} = "tmp/history";
+$ENV{NUSH_CACHE_DIR} = "tmp/cache";
 
 my $prompt = `./nush < /dev/null`;
 ok($prompt =~ /nush\$/, "nush\$ prompt");
@@ -16,6 +20,23 @@ ok($inter =~ /nush\$/, "show prompt interactively twice");
 ok($inter =~ /one/, "run interactive command 1");
 ok($inter =~ /two/, "run interactive command 2");
 
+my $hist = `echo history | ./nush`;
+ok($hist =~ /echo one\n.*echo two\n.*history/s, "history kept across sessions");
+
+my $resized = `echo history | NUSH_HISTSIZE=1024 ./nush`;
+ok($resized =~ /echo one\n.*echo two\n.*history/s, "history kept when resized");
+
+open(my $bad, ">", "tmp/badhist") or die "tmp/badhist: $!";
+print $bad pack("a8 Q5", "NUSHHIS1", 256, 1000, 0, 0, 5), "\0" x 256;
+close($bad);
+my $reset = `echo history | NUSH_HISTFILE=tmp/badhist NUSH_HISTSIZE=256 ./nush`;
+ok($reset =~ /^nush\$ +1  history\n/, "history with a bad header started over");
+
+system("rm -f tmp/sharedhist");
+my $shared = `(echo "echo a1"; sleep 1; echo "echo a2"; echo history) | NUSH_HISTFILE=tmp/sharedhist NUSH_HISTSIZE=256 ./nush & sleep 0.3; echo "echo b1" | NUSH_HISTFILE=tmp/sharedhist NUSH_HISTSIZE=100000 ./nush > /dev/null; wait`;
+ok($shared =~ /echo a1\n.*echo b1\n.*echo a2\n/s && -s "tmp/sharedhist" == 256 + 48,
+   "history size kept while another shell has it open");
+
 my @scripts = glob("tests/*.sh");
 
 for my $script (@scripts) {
@@ -33,6 +54,31 @@ for my $script (@scripts) {
     }
 }
 
+# The stress corpus must also keep to its budgets, of time and of address
+# space for every process of a case, so that a scaling regression fails.
+open(my $budgets, "<", "tests/stress/budgets") or die "tests/stress/budgets: $!";
+while (my $line = <$budgets>) {
+    next if $line =~ /^#/;
+    my ($name, $secs, $mb) = split(" ", $line);
+    my $script = "tests/stress/$name.sh";
+    system("rm -f tmp/output");
+
+    my $start = time();
+    my $kb = $mb * 1024;
+    my $limit = $secs * 2;
+    my $rv = system("ulimit -v $kb; timeout -k 5 $limit ./nush $script > tmp/output");
+    my $took = time() - $start;
+    my $diff = `diff tests/stress/$name.out tmp/output`;
+
+    ok($rv == 0 && $diff eq "" && $took <= $secs,
+       sprintf("%s in %.2fs of %ds", $script, $took, $secs));
+    if ($diff ne "") {
+        $diff =~ s/^/# /mg;
+        print $diff;
+    }
+}
+close($budgets);
+
 sub check_errors {
     my ($errs) = @_;
     chomp $errs;
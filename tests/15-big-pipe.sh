@@ -0,0 +1 @@
+seq 1 200000 | sort -rn | head -n 2
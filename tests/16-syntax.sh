@@ -0,0 +1,6 @@
+echo before
+echo a | | echo b
+(echo c
+echo d ))
+; echo e
+echo after
@@ -0,0 +1,8 @@
+sort tests/sample.txt | head -n 1
+sort tests/sample.txt | tail -n 1
+hash | wc -l
+hash -r
+hash
+hash nosuchcommand || echo missing
+nosuchcommand 2> /dev/null || echo not run
+nosuchcommand 2>&1 | wc -l
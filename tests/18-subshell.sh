@@ -0,0 +1,5 @@
+mkdir -p tmp/sub
+(cd tmp && (cd sub) && ls -d ../tmp)
+((((echo deep))))
+(echo a; (echo b; (echo c)))
+ls -d tmp
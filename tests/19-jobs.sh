@@ -0,0 +1,8 @@
+(sleep 0.2; echo first) &
+(sleep 0.6; echo second) &
+jobs | wc -l
+wait -n
+echo after one
+wait
+echo after all
+wait %5 || echo no job
@@ -0,0 +1,8 @@
+jobs -j 1
+(sleep 0.2; echo slow) &
+echo fast &
+jobs -j
+wait
+echo end
+rm -f tmp/queued
+(echo "jobs -j 1"; echo "sleep 0.2 &"; echo "touch tmp/queued &"; sleep 1; test -e tmp/queued && echo "echo started while idle") | ./nush | grep -o started.*
@@ -0,0 +1,8 @@
+mkdir -p tmp
+seq 1 100000 | > tmp/piped.txt
+wc -l < tmp/piped.txt
+tail -n 1 tmp/piped.txt
+(echo out; echo err 1>&2) 2>&1 | > tmp/piped.txt
+cat tmp/piped.txt
+cd / | > /dev/null
+test $(pwd) != / && echo cd stayed in its stage
@@ -0,0 +1,13 @@
+mkdir -p tmp
+echo one > tmp/red.txt
+echo two >> tmp/red.txt
+echo three > tmp/red2.txt
+echo four > tmp/red2.txt
+cat tmp/red.txt tmp/red2.txt
+(echo out; ls /nonexistent) > tmp/both.txt 2>&1
+wc -l < tmp/both.txt
+sh -c "echo err 1>&2" 2>&1 | tr a-z A-Z
+sh -c "echo three 1>&3" 3>&1
+cat 3< tmp/red.txt 0<&3
+seq 1 3 | > tmp/red.txt
+cat tmp/red.txt
@@ -0,0 +1,9 @@
+mkdir -p tmp
+(printf "echo "; seq -s " " 1 20000) > tmp/long.sh
+./nush tmp/long.sh | wc -w
+./nush tmp/long.sh | tr " " "\n" | tail -n 1
+echo "two
+lines" | wc -l
+echo one \
+  two \
+  three
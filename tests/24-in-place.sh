@@ -0,0 +1,6 @@
+mkdir -p tmp
+echo "a;b"c d>tmp/inplace.txt;cat<tmp/inplace.txt
+echo x&&echo y||echo z
+echo "quote
+d" | wc -l
+echo last
\ No newline at end of file
@@ -0,0 +1,7 @@
+mkdir -p tmp
+(printf "echo "; seq -s "Qa|b;(c) Q d\\e&&f 2>&1;echo " 1 300; echo) | tr Q "\042" > tmp/scan.sh
+env NUSH_SCAN=scalar ./nush tmp/scan.sh > tmp/scan-scalar.txt 2>&1
+env NUSH_SCAN=sse2 ./nush tmp/scan.sh > tmp/scan-sse2.txt 2>&1
+./nush tmp/scan.sh > tmp/scan-best.txt 2>&1
+cmp tmp/scan-scalar.txt tmp/scan-sse2.txt && cmp tmp/scan-scalar.txt tmp/scan-best.txt && echo same
+wc -l < tmp/scan-scalar.txt
@@ -0,0 +1,13 @@
+mkdir -p tmp
+echo "echo older | tr a-z A-Z" > tmp/cached.sh
+./nush tmp/cached.sh
+./nush tmp/cached.sh
+echo "echo newer | tr a-z A-Z" > tmp/cached.sh
+./nush tmp/cached.sh
+touch tmp/cached.sh
+./nush tmp/cached.sh
+rm -rf tmp/cache26
+echo "nushstat -m | grep -o tokens=[0-9]*" > tmp/cached.sh
+env NUSH_CACHE_DIR=tmp/cache26 ./nush tmp/cached.sh
+ls tmp/cache26 | grep -c [.]nushc
+env NUSH_CACHE_DIR=tmp/cache26 ./nush tmp/cached.sh
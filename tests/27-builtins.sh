@@ -0,0 +1,15 @@
+echo hello world
+echo -n no newline; echo
+echo -e "a\tb\x41\0102\c" ignored; echo
+printf "%s=%05d|%-4s|%x|%.2f|%c%%\n" a 42 b 255 3.14159 xyz
+printf "%s,%s\n" 1 2 3
+test 1 -lt 2 && echo lt
+[ abc = abc ] && echo eq
+[ -d tests -a ! -f tests ] && echo dir
+[ "" ] || echo empty
+[ -n x -o 1 -gt 2 ] && echo or
+test 1 -eq x || echo bad number
+true && : && echo colon
+false || echo false
+pwd | wc -l
+echo piped | tr a-z A-Z
@@ -0,0 +1,17 @@
+echo a$(echo b c)d
+echo "a$(echo b  c)d" x$(printf "  ")y
+echo `echo back ticks`
+echo $(echo $(echo nested) "(parens)")
+echo [$(true)] "$(true)" [$(printf " a\tb\n ")]
+echo "$(printf "trailing\n\n\n")" newlines
+echo $(seq 1 20000) | wc -c
+echo $(cd /; pwd) $(pwd | wc -l)
+echo $(cat tests/sample.txt | head -2 | tr a-z A-Z)
+echo $(echo a | tr a b; echo c && echo d) e
+echo `echo one` | tr o O
+echo $(echo out) > tmp/subst.txt; cat < $(echo tmp/subst.txt)
+(echo sub $(echo shell)) > "$(echo tmp/subst.txt)"; cat tmp/subst.txt
+echo "$(echo ")")"
+wait
+printf "echo a\001\necho a\001b\n" > tmp/marker.sh
+./nush tmp/marker.sh || echo rejected
@@ -0,0 +1,17 @@
+diff <(printf "a\nb\nc\n") <(printf "a\nx\nc\n")
+cat <(echo one) <(echo two; echo three)
+paste -d, <(seq 3) <(seq 4 6) <(echo $(echo seven))
+cat < <(echo redirected)
+wc -l < <(seq 100000)
+head -2 <(seq 1000000)
+echo upper > >(tr a-z A-Z)
+tee >(wc -l) < tests/sample.txt > /dev/null
+cmp <(cat tests/sample.txt) tests/sample.txt && echo same
+(cat <(echo in subshell)) | cat
+wait
+jobs -j 1
+sleep 0.2 &
+sleep 2 &
+(time /usr/bin/tee >(wc -c) < <(sleep 0.5; echo x) > /dev/null) 2> tmp/procsubst-time.txt
+grep -c "real.0m0" tmp/procsubst-time.txt
+jobs -j 0
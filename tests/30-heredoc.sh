@@ -0,0 +1,28 @@
+cat <<EOF
+line one "unbalanced
+  indented \ back
+EOF
+cat <<-END | tr a-z A-Z
+	tabbed
+		twice
+	END
+tr a-z A-Z <<< "here string"
+wc -c <<<$(seq 1 10)
+cat <<A; cat <<B
+first
+A
+second
+B
+(cat; echo done) <<X
+in subshell
+X
+echo after
+mkdir -p tmp
+(echo "cat <<BIG | wc -lc"; seq 1 20000; echo BIG) > tmp/heredoc-big.sh
+./nush tmp/heredoc-big.sh
+cat <<"QUOTED" > tmp/heredoc.txt
+not $(expanded)
+QUOTED
+cat tmp/heredoc.txt
+printf "cat <<EOF <<-X )\necho body\nEOF\n\techo tabbed\n\tX\necho after the error\n" > tmp/heredoc-error.sh
+./nush tmp/heredoc-error.sh 2> /dev/null
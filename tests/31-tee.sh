@@ -0,0 +1,14 @@
+seq 1 200000 | tee tmp/t1.txt tmp/t2.txt | wc -l
+cmp tmp/t1.txt tmp/t2.txt && wc -l < tmp/t1.txt
+echo appended | tee -a tmp/t1.txt > /dev/null
+tail -1 tmp/t1.txt
+seq 1 5 | tee | wc -l
+tee tmp/t3.txt < tests/sample.txt | wc -l
+seq 3 | tee tmp/t4.txt
+echo $(seq 2 | tee tmp/t5.txt)
+echo x | tee tmp/t6.txt
+cat tmp/t6.txt
+yes | head -c 10000000 | tee tmp/t7.txt tmp/t8.txt tmp/t9.txt | md5sum
+cmp tmp/t7.txt tmp/t8.txt && echo same
+seq 1 1000 | tee tmp/t10.txt | tee -a tmp/t10.txt | tail -1
+wc -l < tmp/t10.txt
@@ -0,0 +1,7 @@
+(time seq 1 100000 | tail -1) 2> tmp/time.txt
+cut -f1 tmp/time.txt
+(time false) 2> /dev/null || echo status kept
+printf "sleep 0.1 &\nseq 3 | wc -l\n(exit 3)\nwait\n" > tmp/acct.sh
+env NUSH_ACCT_FD=5 ./nush tmp/acct.sh 5> tmp/acct.log
+cut -d" " -f2,7- tmp/acct.log | sort
+grep -c "^pid=[0-9]* status=[0-9]* real=[0-9.]* user=[0-9.]* sys=[0-9.]* maxrss=[0-9]* cmd=" tmp/acct.log
@@ -0,0 +1,10 @@
+rm -f tmp/trace.json
+printf "echo hi > /dev/null\nseq 3 | (cat; echo x) | wc -l\n(ls /dev/null)\n" > tmp/trace.sh
+env NUSH_CACHE_DIR= NUSH_TRACE=tmp/trace.json ./nush tmp/trace.sh
+head -1 tmp/trace.json
+grep -o name.:.[a-z]* tmp/trace.json | cut -c8- | sort -u
+grep -v -c ph.:.X.,.ts.:[0-9.]*,.dur.:[0-9.]*,.pid.:[0-9]*,.tid.:[0-9]*, tmp/trace.json
+rm -f tmp/trace-exit.json
+printf "sleep 0.01 &\n/bin/true\nexit 3\necho not run\n" > tmp/trace-exit.sh
+env NUSH_CACHE_DIR= NUSH_TRACE=tmp/trace-exit.json ./nush tmp/trace-exit.sh || echo exited
+grep -c name.:.spawn tmp/trace-exit.json
@@ -0,0 +1,18 @@
+nushstat -r
+(((echo nested)))
+(cd /; pwd)
+seq 3 | cat | wc -l
+sleep 0 &
+sleep 0 &
+wait
+nushstat -m > tmp/stats.txt
+cut -d" " -f1-3,8-9 tmp/stats.txt
+nushstat | cut -d" " -f1
+nushstat -r
+nushstat -m > tmp/stats.txt
+cut -d" " -f1-4 tmp/stats.txt
+nushstat -x || echo failed
+nushstat -r
+seq 1000 | > tmp/x
+nushstat -m > tmp/stats.txt
+grep -o copied=[0-9]* tmp/stats.txt
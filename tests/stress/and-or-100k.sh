@@ -0,0 +1,2 @@
+:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&:&&echo and
+false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||false||echo or
@@ -0,0 +1 @@
+echo a1 a2 a3 a4 a5 a6 a7 a8 a9 a10 a11 a12 a13 a14 a15 a16 a17 a18 a19 a20 a21 a22 a23 a24 a25 a26 a27 a28 a29 a30 a31 a32 a33 a34 a35 a36 a37 a38 a39 a40 a41 a42 a43 a44 a45 a46 a47 a48 a49 a50 a51 a52 a53 a54 a55 a56 a57 a58 a59 a60 a61 a62 a63 a64 a65 a66 a67 a68 a69 a70 a71 a72 a73 a74 a75 a76 a77 a78 a79 a80 a81 a82 a83 a84 a85 a86 a87 a88 a89 a90 a91 a92 a93 a94 a95 a96 a97 a98 a99 a100 a101 a102 a103 a104 a105 a106 a107 a108 a109 a110 a111 a112 a113 a114 a115 a116 a117 a118 a119 a120 a121 a122 a123 a124 a125 a126 a127 a128 a129 a130 a131 a132 a133 a134 a135 a136 a137 a138 a139 a140 a141 a142 a143 a144 a145 a146 a147 a148 a149 a150 a151 a152 a153 a154 a155 a156 a157 a158 a159 a160 a161 a162 a163 a164 a165 a166 a167 a168 a169 a170 a171 a172 a173 a174 a175 a176 a177 a178 a179 a180 a181 a182 a183 a184 a185 a186 a187 a188 a189 a190 a191 a192 a193 a194 a195 a196 a197 a198 a199 a200 a201 a202 a203 a204 a205 a206 a207 a208 a209 a210 a211 a212 a213 a214 a215 a216 a217 a218 a219 a220 a221 a222 a223 a224 a225 a226 a227 a228 a229 a230 a231 a232 a233 a234 a235 a236 a237 a238 a239 a240 a241 a242 a243 a244 a245 a246 a247 a248 a249 a250 a251 a252 a253 a254 a255 a256 a257 a258 a259 a260 a261 a262 a263 a264 a265 a266 a267 a268 a269 a270 a271 a272 a273 a274 a275 a276 a277 a278 a279 a280 a281 a282 a283 a284 a285 a286 a287 a288 a289 a290 a291 a292 a293 a294 a295 a296 a297 a298 a299 a300 a301 a302 a303 a304 a305 a306 a307 a308 a309 a310 a311 a312 a313 a314 a315 a316 a317 a318 a319 a320 a321 a322 a323 a324 a325 a326 a327 a328 a329 a330 a331 a332 a333 a334 a335 a336 a337 a338 a339 a340 a341 a342 a343 a344 a345 a346 a347 a348 a349 a350 a351 a352 a353 a354 a355 a356 a357 a358 a359 a360 a361 a362 a363 a364 a365 a366 a367 a368 a369 a370 a371 a372 a373 a374 a375 a376 a377 a378 a379 a380 a381 a382 a383 a384 a385 a386 a387 a388 a389 a390 a391 a392 a393 a394 a395 a396 a397 a398 a399 a400 a401 a402 a403 a404 a405 a406 a407 a408 a409 a410 a411 a412 a413 a414 a415 a416 a417 a418 a419 a420 a421 a422 a423 a424 a425 a426 a427 a428 a429 a430 a431 a432 a433 a434 a435 a436 a437 a438 a439 a440 a441 a442 a443 a444 a445 a446 a447 a448 a449 a450 a451 a452 a453 a454 a455 a456 a457 a458 a459 a460 a461 a462 a463 a464 a465 a466 a467 a468 a469 a470 a471 a472 a473 a474 a475 a476 a477 a478 a479 a480 a481 a482 a483 a484 a485 a486 a487 a488 a489 a490 a491 a492 a493 a494 a495 a496 a497 a498 a499 a500 a501 a502 a503 a504 a505 a506 a507 a508 a509 a510 a511 a512 a513 a514 a515 a516 a517 a518 a519 a520 a521 a522 a523 a524 a525 a526 a527 a528 a529 a530 a531 a532 a533 a534 a535 a536 a537 a538 a539 a540 a541 a542 a543 a544 a545 a546 a547 a548 a549 a550 a551 a552 a553 a554 a555 a556 a557 a558 a559 a560 a561 a562 a563 a564 a565 a566 a567 a568 a569 a570 a571 a572 a573 a574 a575 a576 a577 a578 a579 a580 a581 a582 a583 a584 a585 a586 a587 a588 a589 a590 a591 a592 a593 a594 a595 a596 a597 a598 a599 a600 a601 a602 a603 a604 a605 a606 a607 a608 a609 a610 a611 a612 a613 a614 a615 a616 a617 a618 a619 a620 a621 a622 a623 a624 a625 a626 a627 a628 a629 a630 a631 a632 a633 a634 a635 a636 a637 a638 a639 a640 a641 a642 a643 a644 a645 a646 a647 a648 a649 a650 a651 a652 a653 a654 a655 a656 a657 a658 a659 a660 a661 a662 a663 a664 a665 a666 a667 a668 a669 a670 a671 a672 a673 a674 a675 a676 a677 a678 a679 a680 a681 a682 a683 a684 a685 a686 a687 a688 a689 a690 a691 a692 a693 a694 a695 a696 a697 a698 a699 a700 a701 a702 a703 a704 a705 a706 a707 a708 a709 a710 a711 a712 a713 a714 a715 a716 a717 a718 a719 a720 a721 a722 a723 a724 a725 a726 a727 a728 a729 a730 a731 a732 a733 a734 a735 a736 a737 a738 a739 a740 a741 a742 a743 a744 a745 a746 a747 a748 a749 a750 a751 a752 a753 a754 a755 a756 a757 a758 a759 a760 a761 a762 a763 a764 a765 a766 a767 a768 a769 a770 a771 a772 a773 a774 a775 a776 a777 a778 a779 a780 a781 a782 a783 a784 a785 a786 a787 a788 a789 a790 a791 a792 a793 a794 a795 a796 a797 a798 a799 a800 a801 a802 a803 a804 a805 a806 a807 a808 a809 a810 a811 a812 a813 a814 a815 a816 a817 a818 a819 a820 a821 a822 a823 a824 a825 a826 a827 a828 a829 a830 a831 a832 a833 a834 a835 a836 a837 a838 a839 a840 a841 a842 a843 a844 a845 a846 a847 a848 a849 a850 a851 a852 a853 a854 a855 a856 a857 a858 a859 a860 a861 a862 a863 a864 a865 a866 a867 a868 a869 a870 a871 a872 a873 a874 a875 a876 a877 a878 a879 a880 a881 a882 a883 a884 a885 a886 a887 a888 a889 a890 a891 a892 a893 a894 a895 a896 a897 a898 a899 a900 a901 a902 a903 a904 a905 a906 a907 a908 a909 a910 a911 a912 a913 a914 a915 a916 a917 a918 a919 a920 a921 a922 a923 a924 a925 a926 a927 a928 a929 a930 a931 a932 a933 a934 a935 a936 a937 a938 a939 a940 a941 a942 a943 a944 a945 a946 a947 a948 a949 a950 a951 a952 a953 a954 a955 a956 a957 a958 a959 a960 a961 a962 a963 a964 a965 a966 a967 a968 a969 a970 a971 a972 a973 a974 a975 a976 a977 a978 a979 a980 a981 a982 a983 a984 a985 a986 a987 a988 a989 a990 a991 a992 a993 a994 a995 a996 a997 a998 a999 a1000 a1001 a1002 a1003 a1004 a1005 a1006 a1007 a1008 a1009 a1010 a1011 a1012 a1013 a1014 a1015 a1016 a1017 a1018 a1019 a1020 a1021 a1022 a1023 a1024 a1025 a1026 a1027 a1028 a1029 a1030 a1031 a1032 a1033 a1034 a1035 a1036 a1037 a1038 a1039 a1040 a1041 a1042 a1043 a1044 a1045 a1046 a1047 a1048 a1049 a1050 a1051 a1052 a1053 a1054 a1055 a1056 a1057 a1058 a1059 a1060 a1061 a1062 a1063 a1064 a1065 a1066 a1067 a1068 a1069 a1070 a1071 a1072 a1073 a1074 a1075 a1076 a1077 a1078 a1079 a1080 a1081 a1082 a1083 a1084 a1085 a1086 a1087 a1088 a1089 a1090 a1091 a1092 a1093 a1094 a1095 a1096 a1097 a1098 a1099 a1100 a1101 a1102 a1103 a1104 a1105 a1106 a1107 a1108 a1109 a1110 a1111 a1112 a1113 a1114 a1115 a1116 a1117 a1118 a1119 a1120 a1121 a1122 a1123 a1124 a1125 a1126 a1127 a1128 a1129 a1130 a1131 a1132 a1133 a1134 a1135 a1136 a1137 a1138 a1139 a1140 a1141 a1142 a1143 a1144 a1145 a1146 a1147 a1148 a1149 a1150 a1151 a1152 a1153 a1154 a1155 a1156 a1157 a1158 a1159 a1160 a1161 a1162 a1163 a1164 a1165 a1166 a1167 a1168 a1169 a1170 a1171 a1172 a1173 a1174 a1175 a1176 a1177 a1178 a1179 a1180 a1181 a1182 a1183 a1184 a1185 a1186 a1187 a1188 a1189 a1190 a1191 a1192 a1193 a1194 a1195 a1196 a1197 a1198 a1199 a1200 a1201 a1202 a1203 a1204 a1205 a1206 a1207 a1208 a1209 a1210 a1211 a1212 a1213 a1214 a1215 a1216 a1217 a1218 a1219 a1220 a1221 a1222 a1223 a1224 a1225 a1226 a1227 a1228 a1229 a1230 a1231 a1232 a1233 a1234 a1235 a1236 a1237 a1238 a1239 a1240 a1241 a1242 a1243 a1244 a1245 a1246 a1247 a1248 a1249 a1250 a1251 a1252 a1253 a1254 a1255 a1256 a1257 a1258 a1259 a1260 a1261 a1262 a1263 a1264 a1265 a1266 a1267 a1268 a1269 a1270 a1271 a1272 a1273 a1274 a1275 a1276 a1277 a1278 a1279 a1280 a1281 a1282 a1283 a1284 a1285 a1286 a1287 a1288 a1289 a1290 a1291 a1292 a1293 a1294 a1295 a1296 a1297 a1298 a1299 a1300 a1301 a1302 a1303 a1304 a1305 a1306 a1307 a1308 a1309 a1310 a1311 a1312 a1313 a1314 a1315 a1316 a1317 a1318 a1319 a1320 a1321 a1322 a1323 a1324 a1325 a1326 a1327 a1328 a1329 a1330 a1331 a1332 a1333 a1334 a1335 a1336 a1337 a1338 a1339 a1340 a1341 a1342 a1343 a1344 a1345 a1346 a1347 a1348 a1349 a1350 a1351 a1352 a1353 a1354 a1355 a1356 a1357 a1358 a1359 a1360 a1361 a1362 a1363 a1364 a1365 a1366 a1367 a1368 a1369 a1370 a1371 a1372 a1373 a1374 a1375 a1376 a1377 a1378 a1379 a1380 a1381 a1382 a1383 a1384 a1385 a1386 a1387 a1388 a1389 a1390 a1391 a1392 a1393 a1394 a1395 a1396 a1397 a1398 a1399 a1400 a1401 a1402 a1403 a1404 a1405 a1406 a1407 a1408 a1409 a1410 a1411 a1412 a1413 a1414 a1415 a1416 a1417 a1418 a1419 a1420 a1421 a1422 a1423 a1424 a1425 a1426 a1427 a1428 a1429 a1430 a1431 a1432 a1433 a1434 a1435 a1436 a1437 a1438 a1439 a1440 a1441 a1442 a1443 a1444 a1445 a1446 a1447 a1448 a1449 a1450 a1451 a1452 a1453 a1454 a1455 a1456 a1457 a1458 a1459 a1460 a1461 a1462 a1463 a1464 a1465 a1466 a1467 a1468 a1469 a1470 a1471 a1472 a1473 a1474 a1475 a1476 a1477 a1478 a1479 a1480 a1481 a1482 a1483 a1484 a1485 a1486 a1487 a1488 a1489 a1490 a1491 a1492 a1493 a1494 a1495 a1496 a1497 a1498 a1499 a1500 a1501 a1502 a1503 a1504 a1505 a1506 a1507 a1508 a1509 a1510 a1511 a1512 a1513 a1514 a1515 a1516 a1517 a1518 a1519 a1520 a1521 a1522 a1523 a1524 a1525 a1526 a1527 a1528 a1529 a1530 a1531 a1532 a1533 a1534 a1535 a1536 a1537 a1538 a1539 a1540 a1541 a1542 a1543 a1544 a1545 a1546 a1547 a1548 a1549 a1550 a1551 a1552 a1553 a1554 a1555 a1556 a1557 a1558 a1559 a1560 a1561 a1562 a1563 a1564 a1565 a1566 a1567 a1568 a1569 a1570 a1571 a1572 a1573 a1574 a1575 a1576 a1577 a1578 a1579 a1580 a1581 a1582 a1583 a1584 a1585 a1586 a1587 a1588 a1589 a1590 a1591 a1592 a1593 a1594 a1595 a1596 a1597 a1598 a1599 a1600 a1601 a1602 a1603 a1604 a1605 a1606 a1607 a1608 a1609 a1610 a1611 a1612 a1613 a1614 a1615 a1616 a1617 a1618 a1619 a1620 a1621 a1622 a1623 a1624 a1625 a1626 a1627 a1628 a1629 a1630 a1631 a1632 a1633 a1634 a1635 a1636 a1637 a1638 a1639 a1640 a1641 a1642 a1643 a1644 a1645 a1646 a1647 a1648 a1649 a1650 a1651 a1652 a1653 a1654 a1655 a1656 a1657 a1658 a1659 a1660 a1661 a1662 a1663 a1664 a1665 a1666 a1667 a1668 a1669 a1670 a1671 a1672 a1673 a1674 a1675 a1676 a1677 a1678 a1679 a1680 a1681 a1682 a1683 a1684 a1685 a1686 a1687 a1688 a1689 a1690 a1691 a1692 a1693 a1694 a1695 a1696 a1697 a1698 a1699 a1700 a1701 a1702 a1703 a1704 a1705 a1706 a1707 a1708 a1709 a1710 a1711 a1712 a1713 a1714 a1715 a1716 a1717 a1718 a1719 a1720 a1721 a1722 a1723 a1724 a1725 a1726 a1727 a1728 a1729 a1730 a1731 a1732 a1733 a1734 a1735 a1736 a1737 a1738 a1739 a1740 a1741 a1742 a1743 a1744 a1745 a1746 a1747 a1748 a1749 a1750 a1751 a1752 a1753 a1754 a1755 a1756 a1757 a1758 a1759 a1760 a1761 a1762 a1763 a1764 a1765 a1766 a1767 a1768 a1769 a1770 a1771 a1772 a1773 a1774 a1775 a1776 a1777 a1778 a1779 a1780 a1781 a1782 a1783 a1784 a1785 a1786 a1787 a1788 a1789 a1790 a1791 a1792 a1793 a1794 a1795 a1796 a1797 a1798 a1799 a1800 a1801 a1802 a1803 a1804 a1805 a1806 a1807 a1808 a1809 a1810 a1811 a1812 a1813 a1814 a1815 a1816 a1817 a1818 a1819 a1820 a1821 a1822 a1823 a1824 a1825 a1826 a1827 a1828 a1829 a1830 a1831 a1832 a1833 a1834 a1835 a1836 a1837 a1838 a1839 a1840 a1841 a1842 a1843 a1844 a1845 a1846 a1847 a1848 a1849 a1850 a1851 a1852 a1853 a1854 a1855 a1856 a1857 a1858 a1859 a1860 a1861 a1862 a1863 a1864 a1865 a1866 a1867 a1868 a1869 a1870 a1871 a1872 a1873 a1874 a1875 a1876 a1877 a1878 a1879 a1880 a1881 a1882 a1883 a1884 a1885 a1886 a1887 a1888 a1889 a1890 a1891 a1892 a1893 a1894 a1895 a1896 a1897 a1898 a1899 a1900 a1901 a1902 a1903 a1904 a1905 a1906 a1907 a1908 a1909 a1910 a1911 a1912 a1913 a1914 a1915 a1916 a1917 a1918 a1919 a1920 a1921 a1922 a1923 a1924 a1925 a1926 a1927 a1928 a1929 a1930 a1931 a1932 a1933 a1934 a1935 a1936 a1937 a1938 a1939 a1940 a1941 a1942 a1943 a1944 a1945 a1946 a1947 a1948 a1949 a1950 a1951 a1952 a1953 a1954 a1955 a1956 a1957 a1958 a1959 a1960 a1961 a1962 a1963 a1964 a1965 a1966 a1967 a1968 a1969 a1970 a1971 a1972 a1973 a1974 a1975 a1976 a1977 a1978 a1979 a1980 a1981 a1982 a1983 a1984 a1985 a1986 a1987 a1988 a1989 a1990 a1991 a1992 a1993 a1994 a1995 a1996 a1997 a1998 a1999 a2000 a2001 a2002 a2003 a2004 a2005 a2006 a2007 a2008 a2009 a2010 a2011 a2012 a2013 a2014 a2015 a2016 a2017 a2018 a2019 a2020 a2021 a2022 a2023 a2024 a2025 a2026 a2027 a2028 a2029 a2030 a2031 a2032 a2033 a2034 a2035 a2036 a2037 a2038 a2039 a2040 a2041 a2042 a2043 a2044 a2045 a2046 a2047 a2048 a2049 a2050 a2051 a2052 a2053 a2054 a2055 a2056 a2057 a2058 a2059 a2060 a2061 a2062 a2063 a2064 a2065 a2066 a2067 a2068 a2069 a2070 a2071 a2072 a2073 a2074 a2075 a2076 a2077 a2078 a2079 a2080 a2081 a2082 a2083 a2084 a2085 a2086 a2087 a2088 a2089 a2090 a2091 a2092 a2093 a2094 a2095 a2096 a2097 a2098 a2099 a2100 a2101 a2102 a2103 a2104 a2105 a2106 a2107 a2108 a2109 a2110 a2111 a2112 a2113 a2114 a2115 a2116 a2117 a2118 a2119 a2120 a2121 a2122 a2123 a2124 a2125 a2126 a2127 a2128 a2129 a2130 a2131 a2132 a2133 a2134 a2135 a2136 a2137 a2138 a2139 a2140 a2141 a2142 a2143 a2144 a2145 a2146 a2147 a2148 a2149 a2150 a2151 a2152 a2153 a2154 a2155 a2156 a2157 a2158 a2159 a2160 a2161 a2162 a2163 a2164 a2165 a2166 a2167 a2168 a2169 a2170 a2171 a2172 a2173 a2174 a2175 a2176 a2177 a2178 a2179 a2180 a2181 a2182 a2183 a2184 a2185 a2186 a2187 a2188 a2189 a2190 a2191 a2192 a2193 a2194 a2195 a2196 a2197 a2198 a2199 a2200 a2201 a2202 a2203 a2204 a2205 a2206 a2207 a2208 a2209 a2210 a2211 a2212 a2213 a2214 a2215 a2216 a2217 a2218 a2219 a2220 a2221 a2222 a2223 a2224 a2225 a2226 a2227 a2228 a2229 a2230 a2231 a2232 a2233 a2234 a2235 a2236 a2237 a2238 a2239 a2240 a2241 a2242 a2243 a2244 a2245 a2246 a2247 a2248 a2249 a2250 a2251 a2252 a2253 a2254 a2255 a2256 a2257 a2258 a2259 a2260 a2261 a2262 a2263 a2264 a2265 a2266 a2267 a2268 a2269 a2270 a2271 a2272 a2273 a2274 a2275 a2276 a2277 a2278 a2279 a2280 a2281 a2282 a2283 a2284 a2285 a2286 a2287 a2288 a2289 a2290 a2291 a2292 a2293 a2294 a2295 a2296 a2297 a2298 a2299 a2300 a2301 a2302 a2303 a2304 a2305 a2306 a2307 a2308 a2309 a2310 a2311 a2312 a2313 a2314 a2315 a2316 a2317 a2318 a2319 a2320 a2321 a2322 a2323 a2324 a2325 a2326 a2327 a2328 a2329 a2330 a2331 a2332 a2333 a2334 a2335 a2336 a2337 a2338 a2339 a2340 a2341 a2342 a2343 a2344 a2345 a2346 a2347 a2348 a2349 a2350 a2351 a2352 a2353 a2354 a2355 a2356 a2357 a2358 a2359 a2360 a2361 a2362 a2363 a2364 a2365 a2366 a2367 a2368 a2369 a2370 a2371 a2372 a2373 a2374 a2375 a2376 a2377 a2378 a2379 a2380 a2381 a2382 a2383 a2384 a2385 a2386 a2387 a2388 a2389 a2390 a2391 a2392 a2393 a2394 a2395 a2396 a2397 a2398 a2399 a2400 a2401 a2402 a2403 a2404 a2405 a2406 a2407 a2408 a2409 a2410 a2411 a2412 a2413 a2414 a2415 a2416 a2417 a2418 a2419 a2420 a2421 a2422 a2423 a2424 a2425 a2426 a2427 a2428 a2429 a2430 a2431 a2432 a2433 a2434 a2435 a2436 a2437 a2438 a2439 a2440 a2441 a2442 a2443 a2444 a2445 a2446 a2447 a2448 a2449 a2450 a2451 a2452 a2453 a2454 a2455 a2456 a2457 a2458 a2459 a2460 a2461 a2462 a2463 a2464 a2465 a2466 a2467 a2468 a2469 a2470 a2471 a2472 a2473 a2474 a2475 a2476 a2477 a2478 a2479 a2480 a2481 a2482 a2483 a2484 a2485 a2486 a2487 a2488 a2489 a2490 a2491 a2492 a2493 a2494 a2495 a2496 a2497 a2498 a2499 a2500 a2501 a2502 a2503 a2504 a2505 a2506 a2507 a2508 a2509 a2510 a2511 a2512 a2513 a2514 a2515 a2516 a2517 a2518 a2519 a2520 a2521 a2522 a2523 a2524 a2525 a2526 a2527 a2528 a2529 a2530 a2531 a2532 a2533 a2534 a2535 a2536 a2537 a2538 a2539 a2540 a2541 a2542 a2543 a2544 a2545 a2546 a2547 a2548 a2549 a2550 a2551 a2552 a2553 a2554 a2555 a2556 a2557 a2558 a2559 a2560 a2561 a2562 a2563 a2564 a2565 a2566 a2567 a2568 a2569 a2570 a2571 a2572 a2573 a2574 a2575 a2576 a2577 a2578 a2579 a2580 a2581 a2582 a2583 a2584 a2585 a2586 a2587 a2588 a2589 a2590 a2591 a2592 a2593 a2594 a2595 a2596 a2597 a2598 a2599 a2600 a2601 a2602 a2603 a2604 a2605 a2606 a2607 a2608 a2609 a2610 a2611 a2612 a2613 a2614 a2615 a2616 a2617 a2618 a2619 a2620 a2621 a2622 a2623 a2624 a2625 a2626 a2627 a2628 a2629 a2630 a2631 a2632 a2633 a2634 a2635 a2636 a2637 a2638 a2639 a2640 a2641 a2642 a2643 a2644 a2645 a2646 a2647 a2648 a2649 a2650 a2651 a2652 a2653 a2654 a2655 a2656 a2657 a2658 a2659 a2660 a2661 a2662 a2663 a2664 a2665 a2666 a2667 a2668 a2669 a2670 a2671 a2672 a2673 a2674 a2675 a2676 a2677 a2678 a2679 a2680 a2681 a2682 a2683 a2684 a2685 a2686 a2687 a2688 a2689 a2690 a2691 a2692 a2693 a2694 a2695 a2696 a2697 a2698 a2699 a2700 a2701 a2702 a2703 a2704 a2705 a2706 a2707 a2708 a2709 a2710 a2711 a2712 a2713 a2714 a2715 a2716 a2717 a2718 a2719 a2720 a2721 a2722 a2723 a2724 a2725 a2726 a2727 a2728 a2729 a2730 a2731 a2732 a2733 a2734 a2735 a2736 a2737 a2738 a2739 a2740 a2741 a2742 a2743 a2744 a2745 a2746 a2747 a2748 a2749 a2750 a2751 a2752 a2753 a2754 a2755 a2756 a2757 a2758 a2759 a2760 a2761 a2762 a2763 a2764 a2765 a2766 a2767 a2768 a2769 a2770 a2771 a2772 a2773 a2774 a2775 a2776 a2777 a2778 a2779 a2780 a2781 a2782 a2783 a2784 a2785 a2786 a2787 a2788 a2789 a2790 a2791 a2792 a2793 a2794 a2795 a2796 a2797 a2798 a2799 a2800 a2801 a2802 a2803 a2804 a2805 a2806 a2807 a2808 a2809 a2810 a2811 a2812 a2813 a2814 a2815 a2816 a2817 a2818 a2819 a2820 a2821 a2822 a2823 a2824 a2825 a2826 a2827 a2828 a2829 a2830 a2831 a2832 a2833 a2834 a2835 a2836 a2837 a2838 a2839 a2840 a2841 a2842 a2843 a2844 a2845 a2846 a2847 a2848 a2849 a2850 a2851 a2852 a2853 a2854 a2855 a2856 a2857 a2858 a2859 a2860 a2861 a2862 a2863 a2864 a2865 a2866 a2867 a2868 a2869 a2870 a2871 a2872 a2873 a2874 a2875 a2876 a2877 a2878 a2879 a2880 a2881 a2882 a2883 a2884 a2885 a2886 a2887 a2888 a2889 a2890 a2891 a2892 a2893 a2894 a2895 a2896 a2897 a2898 a2899 a2900 a2901 a2902 a2903 a2904 a2905 a2906 a2907 a2908 a2909 a2910 a2911 a2912 a2913 a2914 a2915 a2916 a2917 a2918 a2919 a2920 a2921 a2922 a2923 a2924 a2925 a2926 a2927 a2928 a2929 a2930 a2931 a2932 a2933 a2934 a2935 a2936 a2937 a2938 a2939 a2940 a2941 a2942 a2943 a2944 a2945 a2946 a2947 a2948 a2949 a2950 a2951 a2952 a2953 a2954 a2955 a2956 a2957 a2958 a2959 a2960 a2961 a2962 a2963 a2964 a2965 a2966 a2967 a2968 a2969 a2970 a2971 a2972 a2973 a2974 a2975 a2976 a2977 a2978 a2979 a2980 a2981 a2982 a2983 a2984 a2985 a2986 a2987 a2988 a2989 a2990 a2991 a2992 a2993 a2994 a2995 a2996 a2997 a2998 a2999 a3000 a3001 a3002 a3003 a3004 a3005 a3006 a3007 a3008 a3009 a3010 a3011 a3012 a3013 a3014 a3015 a3016 a3017 a3018 a3019 a3020 a3021 a3022 a3023 a3024 a3025 a3026 a3027 a3028 a3029 a3030 a3031 a3032 a3033 a3034 a3035 a3036 a3037 a3038 a3039 a3040 a3041 a3042 a3043 a3044 a3045 a3046 a3047 a3048 a3049 a3050 a3051 a3052 a3053 a3054 a3055 a3056 a3057 a3058 a3059 a3060 a3061 a3062 a3063 a3064 a3065 a3066 a3067 a3068 a3069 a3070 a3071 a3072 a3073 a3074 a3075 a3076 a3077 a3078 a3079 a3080 a3081 a3082 a3083 a3084 a3085 a3086 a3087 a3088 a3089 a3090 a3091 a3092 a3093 a3094 a3095 a3096 a3097 a3098 a3099 a3100 a3101 a3102 a3103 a3104 a3105 a3106 a3107 a3108 a3109 a3110 a3111 a3112 a3113 a3114 a3115 a3116 a3117 a3118 a3119 a3120 a3121 a3122 a3123 a3124 a3125 a3126 a3127 a3128 a3129 a3130 a3131 a3132 a3133 a3134 a3135 a3136 a3137 a3138 a3139 a3140 a3141 a3142 a3143 a3144 a3145 a3146 a3147 a3148 a3149 a3150 a3151 a3152 a3153 a3154 a3155 a3156 a3157 a3158 a3159 a3160 a3161 a3162 a3163 a3164 a3165 a3166 a3167 a3168 a3169 a3170 a3171 a3172 a3173 a3174 a3175 a3176 a3177 a3178 a3179 a3180 a3181 a3182 a3183 a3184 a3185 a3186 a3187 a3188 a3189 a3190 a3191 a3192 a3193 a3194 a3195 a3196 a3197 a3198 a3199 a3200 a3201 a3202 a3203 a3204 a3205 a3206 a3207 a3208 a3209 a3210 a3211 a3212 a3213 a3214 a3215 a3216 a3217 a3218 a3219 a3220 a3221 a3222 a3223 a3224 a3225 a3226 a3227 a3228 a3229 a3230 a3231 a3232 a3233 a3234 a3235 a3236 a3237 a3238 a3239 a3240 a3241 a3242 a3243 a3244 a3245 a3246 a3247 a3248 a3249 a3250 a3251 a3252 a3253 a3254 a3255 a3256 a3257 a3258 a3259 a3260 a3261 a3262 a3263 a3264 a3265 a3266 a3267 a3268 a3269 a3270 a3271 a3272 a3273 a3274 a3275 a3276 a3277 a3278 a3279 a3280 a3281 a3282 a3283 a3284 a3285 a3286 a3287 a3288 a3289 a3290 a3291 a3292 a3293 a3294 a3295 a3296 a3297 a3298 a3299 a3300 a3301 a3302 a3303 a3304 a3305 a3306 a3307 a3308 a3309 a3310 a3311 a3312 a3313 a3314 a3315 a3316 a3317 a3318 a3319 a3320 a3321 a3322 a3323 a3324 a3325 a3326 a3327 a3328 a3329 a3330 a3331 a3332 a3333 a3334 a3335 a3336 a3337 a3338 a3339 a3340 a3341 a3342 a3343 a3344 a3345 a3346 a3347 a3348 a3349 a3350 a3351 a3352 a3353 a3354 a3355 a3356 a3357 a3358 a3359 a3360 a3361 a3362 a3363 a3364 a3365 a3366 a3367 a3368 a3369 a3370 a3371 a3372 a3373 a3374 a3375 a3376 a3377 a3378 a3379 a3380 a3381 a3382 a3383 a3384 a3385 a3386 a3387 a3388 a3389 a3390 a3391 a3392 a3393 a3394 a3395 a3396 a3397 a3398 a3399 a3400 a3401 a3402 a3403 a3404 a3405 a3406 a3407 a3408 a3409 a3410 a3411 a3412 a3413 a3414 a3415 a3416 a3417 a3418 a3419 a3420 a3421 a3422 a3423 a3424 a3425 a3426 a3427 a3428 a3429 a3430 a3431 a3432 a3433 a3434 a3435 a3436 a3437 a3438 a3439 a3440 a3441 a3442 a3443 a3444 a3445 a3446 a3447 a3448 a3449 a3450 a3451 a3452 a3453 a3454 a3455 a3456 a3457 a3458 a3459 a3460 a3461 a3462 a3463 a3464 a3465 a3466 a3467 a3468 a3469 a3470 a3471 a3472 a3473 a3474 a3475 a3476 a3477 a3478 a3479 a3480 a3481 a3482 a3483 a3484 a3485 a3486 a3487 a3488 a3489 a3490 a3491 a3492 a3493 a3494 a3495 a3496 a3497 a3498 a3499 a3500 a3501 a3502 a3503 a3504 a3505 a3506 a3507 a3508 a3509 a3510 a3511 a3512 a3513 a3514 a3515 a3516 a3517 a3518 a3519 a3520 a3521 a3522 a3523 a3524 a3525 a3526 a3527 a3528 a3529 a3530 a3531 a3532 a3533 a3534 a3535 a3536 a3537 a3538 a3539 a3540 a3541 a3542 a3543 a3544 a3545 a3546 a3547 a3548 a3549 a3550 a3551 a3552 a3553 a3554 a3555 a3556 a3557 a3558 a3559 a3560 a3561 a3562 a3563 a3564 a3565 a3566 a3567 a3568 a3569 a3570 a3571 a3572 a3573 a3574 a3575 a3576 a3577 a3578 a3579 a3580 a3581 a3582 a3583 a3584 a3585 a3586 a3587 a3588 a3589 a3590 a3591 a3592 a3593 a3594 a3595 a3596 a3597 a3598 a3599 a3600 a3601 a3602 a3603 a3604 a3605 a3606 a3607 a3608 a3609 a3610 a3611 a3612 a3613 a3614 a3615 a3616 a3617 a3618 a3619 a3620 a3621 a3622 a3623 a3624 a3625 a3626 a3627 a3628 a3629 a3630 a3631 a3632 a3633 a3634 a3635 a3636 a3637 a3638 a3639 a3640 a3641 a3642 a3643 a3644 a3645 a3646 a3647 a3648 a3649 a3650 a3651 a3652 a3653 a3654 a3655 a3656 a3657 a3658 a3659 a3660 a3661 a3662 a3663 a3664 a3665 a3666 a3667 a3668 a3669 a3670 a3671 a3672 a3673 a3674 a3675 a3676 a3677 a3678 a3679 a3680 a3681 a3682 a3683 a3684 a3685 a3686 a3687 a3688 a3689 a3690 a3691 a3692 a3693 a3694 a3695 a3696 a3697 a3698 a3699 a3700 a3701 a3702 a3703 a3704 a3705 a3706 a3707 a3708 a3709 a3710 a3711 a3712 a3713 a3714 a3715 a3716 a3717 a3718 a3719 a3720 a3721 a3722 a3723 a3724 a3725 a3726 a3727 a3728 a3729 a3730 a3731 a3732 a3733 a3734 a3735 a3736 a3737 a3738 a3739 a3740 a3741 a3742 a3743 a3744 a3745 a3746 a3747 a3748 a3749 a3750 a3751 a3752 a3753 a3754 a3755 a3756 a3757 a3758 a3759 a3760 a3761 a3762 a3763 a3764 a3765 a3766 a3767 a3768 a3769 a3770 a3771 a3772 a3773 a3774 a3775 a3776 a3777 a3778 a3779 a3780 a3781 a3782 a3783 a3784 a3785 a3786 a3787 a3788 a3789 a3790 a3791 a3792 a3793 a3794 a3795 a3796 a3797 a3798 a3799 a3800 a3801 a3802 a3803 a3804 a3805 a3806 a3807 a3808 a3809 a3810 a3811 a3812 a3813 a3814 a3815 a3816 a3817 a3818 a3819 a3820 a3821 a3822 a3823 a3824 a3825 a3826 a3827 a3828 a3829 a3830 a3831 a3832 a3833 a3834 a3835 a3836 a3837 a3838 a3839 a3840 a3841 a3842 a3843 a3844 a3845 a3846 a3847 a3848 a3849 a3850 a3851 a3852 a3853 a3854 a3855 a3856 a3857 a3858 a3859 a3860 a3861 a3862 a3863 a3864 a3865 a3866 a3867 a3868 a3869 a3870 a3871 a3872 a3873 a3874 a3875 a3876 a3877 a3878 a3879 a3880 a3881 a3882 a3883 a3884 a3885 a3886 a3887 a3888 a3889 a3890 a3891 a3892 a3893 a3894 a3895 a3896 a3897 a3898 a3899 a3900 a3901 a3902 a3903 a3904 a3905 a3906 a3907 a3908 a3909 a3910 a3911 a3912 a3913 a3914 a3915 a3916 a3917 a3918 a3919 a3920 a3921 a3922 a3923 a3924 a3925 a3926 a3927 a3928 a3929 a3930 a3931 a3932 a3933 a3934 a3935 a3936 a3937 a3938 a3939 a3940 a3941 a3942 a3943 a3944 a3945 a3946 a3947 a3948 a3949 a3950 a3951 a3952 a3953 a3954 a3955 a3956 a3957 a3958 a3959 a3960 a3961 a3962 a3963 a3964 a3965 a3966 a3967 a3968 a3969 a3970 a3971 a3972 a3973 a3974 a3975 a3976 a3977 a3978 a3979 a3980 a3981 a3982 a3983 a3984 a3985 a3986 a3987 a3988 a3989 a3990 a3991 a3992 a3993 a3994 a3995 a3996 a3997 a3998 a3999 a4000 a4001 a4002 a4003 a4004 a4005 a4006 a4007 a4008 a4009 a4010 a4011 a4012 a4013 a4014 a4015 a4016 a4017 a4018 a4019 a4020 a4021 a4022 a4023 a4024 a4025 a4026 a4027 a4028 a4029 a4030 a4031 a4032 a4033 a4034 a4035 a4036 a4037 a4038 a4039 a4040 a4041 a4042 a4043 a4044 a4045 a4046 a4047 a4048 a4049 a4050 a4051 a4052 a4053 a4054 a4055 a4056 a4057 a4058 a4059 a4060 a4061 a4062 a4063 a4064 a4065 a4066 a4067 a4068 a4069 a4070 a4071 a4072 a4073 a4074 a4075 a4076 a4077 a4078 a4079 a4080 a4081 a4082 a4083 a4084 a4085 a4086 a4087 a4088 a4089 a4090 a4091 a4092 a4093 a4094 a4095 a4096 a4097 a4098 a4099 a4100 a4101 a4102 a4103 a4104 a4105 a4106 a4107 a4108 a4109 a4110 a4111 a4112 a4113 a4114 a4115 a4116 a4117 a4118 a4119 a4120 a4121 a4122 a4123 a4124 a4125 a4126 a4127 a4128 a4129 a4130 a4131 a4132 a4133 a4134 a4135 a4136 a4137 a4138 a4139 a4140 a4141 a4142 a4143 a4144 a4145 a4146 a4147 a4148 a4149 a4150 a4151 a4152 a4153 a4154 a4155 a4156 a4157 a4158 a4159 a4160 a4161 a4162 a4163 a4164 a4165 a4166 a4167 a4168 a4169 a4170 a4171 a4172 a4173 a4174 a4175 a4176 a4177 a4178 a4179 a4180 a4181 a4182 a4183 a4184 a4185 a4186 a4187 a4188 a4189 a4190 a4191 a4192 a4193 a4194 a4195 a4196 a4197 a4198 a4199 a4200 a4201 a4202 a4203 a4204 a4205 a4206 a4207 a4208 a4209 a4210 a4211 a4212 a4213 a4214 a4215 a4216 a4217 a4218 a4219 a4220 a4221 a4222 a4223 a4224 a4225 a4226 a4227 a4228 a4229 a4230 a4231 a4232 a4233 a4234 a4235 a4236 a4237 a4238 a4239 a4240 a4241 a4242 a4243 a4244 a4245 a4246 a4247 a4248 a4249 a4250 a4251 a4252 a4253 a4254 a4255 a4256 a4257 a4258 a4259 a4260 a4261 a4262 a4263 a4264 a4265 a4266 a4267 a4268 a4269 a4270 a4271 a4272 a4273 a4274 a4275 a4276 a4277 a4278 a4279 a4280 a4281 a4282 a4283 a4284 a4285 a4286 a4287 a4288 a4289 a4290 a4291 a4292 a4293 a4294 a4295 a4296 a4297 a4298 a4299 a4300 a4301 a4302 a4303 a4304 a4305 a4306 a4307 a4308 a4309 a4310 a4311 a4312 a4313 a4314 a4315 a4316 a4317 a4318 a4319 a4320 a4321 a4322 a4323 a4324 a4325 a4326 a4327 a4328 a4329 a4330 a4331 a4332 a4333 a4334 a4335 a4336 a4337 a4338 a4339 a4340 a4341 a4342 a4343 a4344 a4345 a4346 a4347 a4348 a4349 a4350 a4351 a4352 a4353 a4354 a4355 a4356 a4357 a4358 a4359 a4360 a4361 a4362 a4363 a4364 a4365 a4366 a4367 a4368 a4369 a4370 a4371 a4372 a4373 a4374 a4375 a4376 a4377 a4378 a4379 a4380 a4381 a4382 a4383 a4384 a4385 a4386 a4387 a4388 a4389 a4390 a4391 a4392 a4393 a4394 a4395 a4396 a4397 a4398 a4399 a4400 a4401 a4402 a4403 a4404 a4405 a4406 a4407 a4408 a4409 a4410 a4411 a4412 a4413 a4414 a4415 a4416 a4417 a4418 a4419 a4420 a4421 a4422 a4423 a4424 a4425 a4426 a4427 a4428 a4429 a4430 a4431 a4432 a4433 a4434 a4435 a4436 a4437 a4438 a4439 a4440 a4441 a4442 a4443 a4444 a4445 a4446 a4447 a4448 a4449 a4450 a4451 a4452 a4453 a4454 a4455 a4456 a4457 a4458 a4459 a4460 a4461 a4462 a4463 a4464 a4465 a4466 a4467 a4468 a4469 a4470 a4471 a4472 a4473 a4474 a4475 a4476 a4477 a4478 a4479 a4480 a4481 a4482 a4483 a4484 a4485 a4486 a4487 a4488 a4489 a4490 a4491 a4492 a4493 a4494 a4495 a4496 a4497 a4498 a4499 a4500 a4501 a4502 a4503 a4504 a4505 a4506 a4507 a4508 a4509 a4510 a4511 a4512 a4513 a4514 a4515 a4516 a4517 a4518 a4519 a4520 a4521 a4522 a4523 a4524 a4525 a4526 a4527 a4528 a4529 a4530 a4531 a4532 a4533 a4534 a4535 a4536 a4537 a4538 a4539 a4540 a4541 a4542 a4543 a4544 a4545 a4546 a4547 a4548 a4549 a4550 a4551 a4552 a4553 a4554 a4555 a4556 a4557 a4558 a4559 a4560 a4561 a4562 a4563 a4564 a4565 a4566 a4567 a4568 a4569 a4570 a4571 a4572 a4573 a4574 a4575 a4576 a4577 a4578 a4579 a4580 a4581 a4582 a4583 a4584 a4585 a4586 a4587 a4588 a4589 a4590 a4591 a4592 a4593 a4594 a4595 a4596 a4597 a4598 a4599 a4600 a4601 a4602 a4603 a4604 a4605 a4606 a4607 a4608 a4609 a4610 a4611 a4612 a4613 a4614 a4615 a4616 a4617 a4618 a4619 a4620 a4621 a4622 a4623 a4624 a4625 a4626 a4627 a4628 a4629 a4630 a4631 a4632 a4633 a4634 a4635 a4636 a4637 a4638 a4639 a4640 a4641 a4642 a4643 a4644 a4645 a4646 a4647 a4648 a4649 a4650 a4651 a4652 a4653 a4654 a4655 a4656 a4657 a4658 a4659 a4660 a4661 a4662 a4663 a4664 a4665 a4666 a4667 a4668 a4669 a4670 a4671 a4672 a4673 a4674 a4675 a4676 a4677 a4678 a4679 a4680 a4681 a4682 a4683 a4684 a4685 a4686 a4687 a4688 a4689 a4690 a4691 a4692 a4693 a4694 a4695 a4696 a4697 a4698 a4699 a4700 a4701 a4702 a4703 a4704 a4705 a4706 a4707 a4708 a4709 a4710 a4711 a4712 a4713 a4714 a4715 a4716 a4717 a4718 a4719 a4720 a4721 a4722 a4723 a4724 a4725 a4726 a4727 a4728 a4729 a4730 a4731 a4732 a4733 a4734 a4735 a4736 a4737 a4738 a4739 a4740 a4741 a4742 a4743 a4744 a4745 a4746 a4747 a4748 a4749 a4750 a4751 a4752 a4753 a4754 a4755 a4756 a4757 a4758 a4759 a4760 a4761 a4762 a4763 a4764 a4765 a4766 a4767 a4768 a4769 a4770 a4771 a4772 a4773 a4774 a4775 a4776 a4777 a4778 a4779 a4780 a4781 a4782 a4783 a4784 a4785 a4786 a4787 a4788 a4789 a4790 a4791 a4792 a4793 a4794 a4795 a4796 a4797 a4798 a4799 a4800 a4801 a4802 a4803 a4804 a4805 a4806 a4807 a4808 a4809 a4810 a4811 a4812 a4813 a4814 a4815 a4816 a4817 a4818 a4819 a4820 a4821 a4822 a4823 a4824 a4825 a4826 a4827 a4828 a4829 a4830 a4831 a4832 a4833 a4834 a4835 a4836 a4837 a4838 a4839 a4840 a4841 a4842 a4843 a4844 a4845 a4846 a4847 a4848 a4849 a4850 a4851 a4852 a4853 a4854 a4855 a4856 a4857 a4858 a4859 a4860 a4861 a4862 a4863 a4864 a4865 a4866 a4867 a4868 a4869 a4870 a4871 a4872 a4873 a4874 a4875 a4876 a4877 a4878 a4879 a4880 a4881 a4882 a4883 a4884 a4885 a4886 a4887 a4888 a4889 a4890 a4891 a4892 a4893 a4894 a4895 a4896 a4897 a4898 a4899 a4900 a4901 a4902 a4903 a4904 a4905 a4906 a4907 a4908 a4909 a4910 a4911 a4912 a4913 a4914 a4915 a4916 a4917 a4918 a4919 a4920 a4921 a4922 a4923 a4924 a4925 a4926 a4927 a4928 a4929 a4930 a4931 a4932 a4933 a4934 a4935 a4936 a4937 a4938 a4939 a4940 a4941 a4942 a4943 a4944 a4945 a4946 a4947 a4948 a4949 a4950 a4951 a4952 a4953 a4954 a4955 a4956 a4957 a4958 a4959 a4960 a4961 a4962 a4963 a4964 a4965 a4966 a4967 a4968 a4969 a4970 a4971 a4972 a4973 a4974 a4975 a4976 a4977 a4978 a4979 a4980 a4981 a4982 a4983 a4984 a4985 a4986 a4987 a4988 a4989 a4990 a4991 a4992 a4993 a4994 a4995 a4996 a4997 a4998 a4999 a5000 a5001 a5002 a5003 a5004 a5005 a5006 a5007 a5008 a5009 a5010 a5011 a5012 a5013 a5014 a5015 a5016 a5017 a5018 a5019 a5020 a5021 a5022 a5023 a5024 a5025 a5026 a5027 a5028 a5029 a5030 a5031 a5032 a5033 a5034 a5035 a5036 a5037 a5038 a5039 a5040 a5041 a5042 a5043 a5044 a5045 a5046 a5047 a5048 a5049 a5050 a5051 a5052 a5053 a5054 a5055 a5056 a5057 a5058 a5059 a5060 a5061 a5062 a5063 a5064 a5065 a5066 a5067 a5068 a5069 a5070 a5071 a5072 a5073 a5074 a5075 a5076 a5077 a5078 a5079 a5080 a5081 a5082 a5083 a5084 a5085 a5086 a5087 a5088 a5089 a5090 a5091 a5092 a5093 a5094 a5095 a5096 a5097 a5098 a5099 a5100 a5101 a5102 a5103 a5104 a5105 a5106 a5107 a5108 a5109 a5110 a5111 a5112 a5113 a5114 a5115 a5116 a5117 a5118 a5119 a5120 a5121 a5122 a5123 a5124 a5125 a5126 a5127 a5128 a5129 a5130 a5131 a5132 a5133 a5134 a5135 a5136 a5137 a5138 a5139 a5140 a5141 a5142 a5143 a5144 a5145 a5146 a5147 a5148 a5149 a5150 a5151 a5152 a5153 a5154 a5155 a5156 a5157 a5158 a5159 a5160 a5161 a5162 a5163 a5164 a5165 a5166 a5167 a5168 a5169 a5170 a5171 a5172 a5173 a5174 a5175 a5176 a5177 a5178 a5179 a5180 a5181 a5182 a5183 a5184 a5185 a5186 a5187 a5188 a5189 a5190 a5191 a5192 a5193 a5194 a5195 a5196 a5197 a5198 a5199 a5200 a5201 a5202 a5203 a5204 a5205 a5206 a5207 a5208 a5209 a5210 a5211 a5212 a5213 a5214 a5215 a5216 a5217 a5218 a5219 a5220 a5221 a5222 a5223 a5224 a5225 a5226 a5227 a5228 a5229 a5230 a5231 a5232 a5233 a5234 a5235 a5236 a5237 a5238 a5239 a5240 a5241 a5242 a5243 a5244 a5245 a5246 a5247 a5248 a5249 a5250 a5251 a5252 a5253 a5254 a5255 a5256 a5257 a5258 a5259 a5260 a5261 a5262 a5263 a5264 a5265 a5266 a5267 a5268 a5269 a5270 a5271 a5272 a5273 a5274 a5275 a5276 a5277 a5278 a5279 a5280 a5281 a5282 a5283 a5284 a5285 a5286 a5287 a5288 a5289 a5290 a5291 a5292 a5293 a5294 a5295 a5296 a5297 a5298 a5299 a5300 a5301 a5302 a5303 a5304 a5305 a5306 a5307 a5308 a5309 a5310 a5311 a5312 a5313 a5314 a5315 a5316 a5317 a5318 a5319 a5320 a5321 a5322 a5323 a5324 a5325 a5326 a5327 a5328 a5329 a5330 a5331 a5332 a5333 a5334 a5335 a5336 a5337 a5338 a5339 a5340 a5341 a5342 a5343 a5344 a5345 a5346 a5347 a5348 a5349 a5350 a5351 a5352 a5353 a5354 a5355 a5356 a5357 a5358 a5359 a5360 a5361 a5362 a5363 a5364 a5365 a5366 a5367 a5368 a5369 a5370 a5371 a5372 a5373 a5374 a5375 a5376 a5377 a5378 a5379 a5380 a5381 a5382 a5383 a5384 a5385 a5386 a5387 a5388 a5389 a5390 a5391 a5392 a5393 a5394 a5395 a5396 a5397 a5398 a5399 a5400 a5401 a5402 a5403 a5404 a5405 a5406 a5407 a5408 a5409 a5410 a5411 a5412 a5413 a5414 a5415 a5416 a5417 a5418 a5419 a5420 a5421 a5422 a5423 a5424 a5425 a5426 a5427 a5428 a5429 a5430 a5431 a5432 a5433 a5434 a5435 a5436 a5437 a5438 a5439 a5440 a5441 a5442 a5443 a5444 a5445 a5446 a5447 a5448 a5449 a5450 a5451 a5452 a5453 a5454 a5455 a5456 a5457 a5458 a5459 a5460 a5461 a5462 a5463 a5464 a5465 a5466 a5467 a5468 a5469 a5470 a5471 a5472 a5473 a5474 a5475 a5476 a5477 a5478 a5479 a5480 a5481 a5482 a5483 a5484 a5485 a5486 a5487 a5488 a5489 a5490 a5491 a5492 a5493 a5494 a5495 a5496 a5497 a5498 a5499 a5500 a5501 a5502 a5503 a5504 a5505 a5506 a5507 a5508 a5509 a5510 a5511 a5512 a5513 a5514 a5515 a5516 a5517 a5518 a5519 a5520 a5521 a5522 a5523 a5524 a5525 a5526 a5527 a5528 a5529 a5530 a5531 a5532 a5533 a5534 a5535 a5536 a5537 a5538 a5539 a5540 a5541 a5542 a5543 a5544 a5545 a5546 a5547 a5548 a5549 a5550 a5551 a5552 a5553 a5554 a5555 a5556 a5557 a5558 a5559 a5560 a5561 a5562 a5563 a5564 a5565 a5566 a5567 a5568 a5569 a5570 a5571 a5572 a5573 a5574 a5575 a5576 a5577 a5578 a5579 a5580 a5581 a5582 a5583 a5584 a5585 a5586 a5587 a5588 a5589 a5590 a5591 a5592 a5593 a5594 a5595 a5596 a5597 a5598 a5599 a5600 a5601 a5602 a5603 a5604 a5605 a5606 a5607 a5608 a5609 a5610 a5611 a5612 a5613 a5614 a5615 a5616 a5617 a5618 a5619 a5620 a5621 a5622 a5623 a5624 a5625 a5626 a5627 a5628 a5629 a5630 a5631 a5632 a5633 a5634 a5635 a5636 a5637 a5638 a5639 a5640 a5641 a5642 a5643 a5644 a5645 a5646 a5647 a5648 a5649 a5650 a5651 a5652 a5653 a5654 a5655 a5656 a5657 a5658 a5659 a5660 a5661 a5662 a5663 a5664 a5665 a5666 a5667 a5668 a5669 a5670 a5671 a5672 a5673 a5674 a5675 a5676 a5677 a5678 a5679 a5680 a5681 a5682 a5683 a5684 a5685 a5686 a5687 a5688 a5689 a5690 a5691 a5692 a5693 a5694 a5695 a5696 a5697 a5698 a5699 a5700 a5701 a5702 a5703 a5704 a5705 a5706 a5707 a5708 a5709 a5710 a5711 a5712 a5713 a5714 a5715 a5716 a5717 a5718 a5719 a5720 a5721 a5722 a5723 a5724 a5725 a5726 a5727 a5728 a5729 a5730 a5731 a5732 a5733 a5734 a5735 a5736 a5737 a5738 a5739 a5740 a5741 a5742 a5743 a5744 a5745 a5746 a5747 a5748 a5749 a5750 a5751 a5752 a5753 a5754 a5755 a5756 a5757 a5758 a5759 a5760 a5761 a5762 a5763 a5764 a5765 a5766 a5767 a5768 a5769 a5770 a5771 a5772 a5773 a5774 a5775 a5776 a5777 a5778 a5779 a5780 a5781 a5782 a5783 a5784 a5785 a5786 a5787 a5788 a5789 a5790 a5791 a5792 a5793 a5794 a5795 a5796 a5797 a5798 a5799 a5800 a5801 a5802 a5803 a5804 a5805 a5806 a5807 a5808 a5809 a5810 a5811 a5812 a5813 a5814 a5815 a5816 a5817 a5818 a5819 a5820 a5821 a5822 a5823 a5824 a5825 a5826 a5827 a5828 a5829 a5830 a5831 a5832 a5833 a5834 a5835 a5836 a5837 a5838 a5839 a5840 a5841 a5842 a5843 a5844 a5845 a5846 a5847 a5848 a5849 a5850 a5851 a5852 a5853 a5854 a5855 a5856 a5857 a5858 a5859 a5860 a5861 a5862 a5863 a5864 a5865 a5866 a5867 a5868 a5869 a5870 a5871 a5872 a5873 a5874 a5875 a5876 a5877 a5878 a5879 a5880 a5881 a5882 a5883 a5884 a5885 a5886 a5887 a5888 a5889 a5890 a5891 a5892 a5893 a5894 a5895 a5896 a5897 a5898 a5899 a5900 a5901 a5902 a5903 a5904 a5905 a5906 a5907 a5908 a5909 a5910 a5911 a5912 a5913 a5914 a5915 a5916 a5917 a5918 a5919 a5920 a5921 a5922 a5923 a5924 a5925 a5926 a5927 a5928 a5929 a5930 a5931 a5932 a5933 a5934 a5935 a5936 a5937 a5938 a5939 a5940 a5941 a5942 a5943 a5944 a5945 a5946 a5947 a5948 a5949 a5950 a5951 a5952 a5953 a5954 a5955 a5956 a5957 a5958 a5959 a5960 a5961 a5962 a5963 a5964 a5965 a5966 a5967 a5968 a5969 a5970 a5971 a5972 a5973 a5974 a5975 a5976 a5977 a5978 a5979 a5980 a5981 a5982 a5983 a5984 a5985 a5986 a5987 a5988 a5989 a5990 a5991 a5992 a5993 a5994 a5995 a5996 a5997 a5998 a5999 a6000 a6001 a6002 a6003 a6004 a6005 a6006 a6007 a6008 a6009 a6010 a6011 a6012 a6013 a6014 a6015 a6016 a6017 a6018 a6019 a6020 a6021 a6022 a6023 a6024 a6025 a6026 a6027 a6028 a6029 a6030 a6031 a6032 a6033 a6034 a6035 a6036 a6037 a6038 a6039 a6040 a6041 a6042 a6043 a6044 a6045 a6046 a6047 a6048 a6049 a6050 a6051 a6052 a6053 a6054 a6055 a6056 a6057 a6058 a6059 a6060 a6061 a6062 a6063 a6064 a6065 a6066 a6067 a6068 a6069 a6070 a6071 a6072 a6073 a6074 a6075 a6076 a6077 a6078 a6079 a6080 a6081 a6082 a6083 a6084 a6085 a6086 a6087 a6088 a6089 a6090 a6091 a6092 a6093 a6094 a6095 a6096 a6097 a6098 a6099 a6100 a6101 a6102 a6103 a6104 a6105 a6106 a6107 a6108 a6109 a6110 a6111 a6112 a6113 a6114 a6115 a6116 a6117 a6118 a6119 a6120 a6121 a6122 a6123 a6124 a6125 a6126 a6127 a6128 a6129 a6130 a6131 a6132 a6133 a6134 a6135 a6136 a6137 a6138 a6139 a6140 a6141 a6142 a6143 a6144 a6145 a6146 a6147 a6148 a6149 a6150 a6151 a6152 a6153 a6154 a6155 a6156 a6157 a6158 a6159 a6160 a6161 a6162 a6163 a6164 a6165 a6166 a6167 a6168 a6169 a6170 a6171 a6172 a6173 a6174 a6175 a6176 a6177 a6178 a6179 a6180 a6181 a6182 a6183 a6184 a6185 a6186 a6187 a6188 a6189 a6190 a6191 a6192 a6193 a6194 a6195 a6196 a6197 a6198 a6199 a6200 a6201 a6202 a6203 a6204 a6205 a6206 a6207 a6208 a6209 a6210 a6211 a6212 a6213 a6214 a6215 a6216 a6217 a6218 a6219 a6220 a6221 a6222 a6223 a6224 a6225 a6226 a6227 a6228 a6229 a6230 a6231 a6232 a6233 a6234 a6235 a6236 a6237 a6238 a6239 a6240 a6241 a6242 a6243 a6244 a6245 a6246 a6247 a6248 a6249 a6250 a6251 a6252 a6253 a6254 a6255 a6256 a6257 a6258 a6259 a6260 a6261 a6262 a6263 a6264 a6265 a6266 a6267 a6268 a6269 a6270 a6271 a6272 a6273 a6274 a6275 a6276 a6277 a6278 a6279 a6280 a6281 a6282 a6283 a6284 a6285 a6286 a6287 a6288 a6289 a6290 a6291 a6292 a6293 a6294 a6295 a6296 a6297 a6298 a6299 a6300 a6301 a6302 a6303 a6304 a6305 a6306 a6307 a6308 a6309 a6310 a6311 a6312 a6313 a6314 a6315 a6316 a6317 a6318 a6319 a6320 a6321 a6322 a6323 a6324 a6325 a6326 a6327 a6328 a6329 a6330 a6331 a6332 a6333 a6334 a6335 a6336 a6337 a6338 a6339 a6340 a6341 a6342 a6343 a6344 a6345 a6346 a6347 a6348 a6349 a6350 a6351 a6352 a6353 a6354 a6355 a6356 a6357 a6358 a6359 a6360 a6361 a6362 a6363 a6364 a6365 a6366 a6367 a6368 a6369 a6370 a6371 a6372 a6373 a6374 a6375 a6376 a6377 a6378 a6379 a6380 a6381 a6382 a6383 a6384 a6385 a6386 a6387 a6388 a6389 a6390 a6391 a6392 a6393 a6394 a6395 a6396 a6397 a6398 a6399 a6400 a6401 a6402 a6403 a6404 a6405 a6406 a6407 a6408 a6409 a6410 a6411 a6412 a6413 a6414 a6415 a6416 a6417 a6418 a6419 a6420 a6421 a6422 a6423 a6424 a6425 a6426 a6427 a6428 a6429 a6430 a6431 a6432 a6433 a6434 a6435 a6436 a6437 a6438 a6439 a6440 a6441 a6442 a6443 a6444 a6445 a6446 a6447 a6448 a6449 a6450 a6451 a6452 a6453 a6454 a6455 a6456 a6457 a6458 a6459 a6460 a6461 a6462 a6463 a6464 a6465 a6466 a6467 a6468 a6469 a6470 a6471 a6472 a6473 a6474 a6475 a6476 a6477 a6478 a6479 a6480 a6481 a6482 a6483 a6484 a6485 a6486 a6487 a6488 a6489 a6490 a6491 a6492 a6493 a6494 a6495 a6496 a6497 a6498 a6499 a6500 a6501 a6502 a6503 a6504 a6505 a6506 a6507 a6508 a6509 a6510 a6511 a6512 a6513 a6514 a6515 a6516 a6517 a6518 a6519 a6520 a6521 a6522 a6523 a6524 a6525 a6526 a6527 a6528 a6529 a6530 a6531 a6532 a6533 a6534 a6535 a6536 a6537 a6538 a6539 a6540 a6541 a6542 a6543 a6544 a6545 a6546 a6547 a6548 a6549 a6550 a6551 a6552 a6553 a6554 a6555 a6556 a6557 a6558 a6559 a6560 a6561 a6562 a6563 a6564 a6565 a6566 a6567 a6568 a6569 a6570 a6571 a6572 a6573 a6574 a6575 a6576 a6577 a6578 a6579 a6580 a6581 a6582 a6583 a6584 a6585 a6586 a6587 a6588 a6589 a6590 a6591 a6592 a6593 a6594 a6595 a6596 a6597 a6598 a6599 a6600 a6601 a6602 a6603 a6604 a6605 a6606 a6607 a6608 a6609 a6610 a6611 a6612 a6613 a6614 a6615 a6616 a6617 a6618 a6619 a6620 a6621 a6622 a6623 a6624 a6625 a6626 a6627 a6628 a6629 a6630 a6631 a6632 a6633 a6634 a6635 a6636 a6637 a6638 a6639 a6640 a6641 a6642 a6643 a6644 a6645 a6646 a6647 a6648 a6649 a6650 a6651 a6652 a6653 a6654 a6655 a6656 a6657 a6658 a6659 a6660 a6661 a6662 a6663 a6664 a6665 a6666 a6667 a6668 a6669 a6670 a6671 a6672 a6673 a6674 a6675 a6676 a6677 a6678 a6679 a6680 a6681 a6682 a6683 a6684 a6685 a6686 a6687 a6688 a6689 a6690 a6691 a6692 a6693 a6694 a6695 a6696 a6697 a6698 a6699 a6700 a6701 a6702 a6703 a6704 a6705 a6706 a6707 a6708 a6709 a6710 a6711 a6712 a6713 a6714 a6715 a6716 a6717 a6718 a6719 a6720 a6721 a6722 a6723 a6724 a6725 a6726 a6727 a6728 a6729 a6730 a6731 a6732 a6733 a6734 a6735 a6736 a6737 a6738 a6739 a6740 a6741 a6742 a6743 a6744 a6745 a6746 a6747 a6748 a6749 a6750 a6751 a6752 a6753 a6754 a6755 a6756 a6757 a6758 a6759 a6760 a6761 a6762 a6763 a6764 a6765 a6766 a6767 a6768 a6769 a6770 a6771 a6772 a6773 a6774 a6775 a6776 a6777 a6778 a6779 a6780 a6781 a6782 a6783 a6784 a6785 a6786 a6787 a6788 a6789 a6790 a6791 a6792 a6793 a6794 a6795 a6796 a6797 a6798 a6799 a6800 a6801 a6802 a6803 a6804 a6805 a6806 a6807 a6808 a6809 a6810 a6811 a6812 a6813 a6814 a6815 a6816 a6817 a6818 a6819 a6820 a6821 a6822 a6823 a6824 a6825 a6826 a6827 a6828 a6829 a6830 a6831 a6832 a6833 a6834 a6835 a6836 a6837 a6838 a6839 a6840 a6841 a6842 a6843 a6844 a6845 a6846 a6847 a6848 a6849 a6850 a6851 a6852 a6853 a6854 a6855 a6856 a6857 a6858 a6859 a6860 a6861 a6862 a6863 a6864 a6865 a6866 a6867 a6868 a6869 a6870 a6871 a6872 a6873 a6874 a6875 a6876 a6877 a6878 a6879 a6880 a6881 a6882 a6883 a6884 a6885 a6886 a6887 a6888 a6889 a6890 a6891 a6892 a6893 a6894 a6895 a6896 a6897 a6898 a6899 a6900 a6901 a6902 a6903 a6904 a6905 a6906 a6907 a6908 a6909 a6910 a6911 a6912 a6913 a6914 a6915 a6916 a6917 a6918 a6919 a6920 a6921 a6922 a6923 a6924 a6925 a6926 a6927 a6928 a6929 a6930 a6931 a6932 a6933 a6934 a6935 a6936 a6937 a6938 a6939 a6940 a6941 a6942 a6943 a6944 a6945 a6946 a6947 a6948 a6949 a6950 a6951 a6952 a6953 a6954 a6955 a6956 a6957 a6958 a6959 a6960 a6961 a6962 a6963 a6964 a6965 a6966 a6967 a6968 a6969 a6970 a6971 a6972 a6973 a6974 a6975 a6976 a6977 a6978 a6979 a6980 a6981 a6982 a6983 a6984 a6985 a6986 a6987 a6988 a6989 a6990 a6991 a6992 a6993 a6994 a6995 a6996 a6997 a6998 a6999 a7000 a7001 a7002 a7003 a7004 a7005 a7006 a7007 a7008 a7009 a7010 a7011 a7012 a7013 a7014 a7015 a7016 a7017 a7018 a7019 a7020 a7021 a7022 a7023 a7024 a7025 a7026 a7027 a7028 a7029 a7030 a7031 a7032 a7033 a7034 a7035 a7036 a7037 a7038 a7039 a7040 a7041 a7042 a7043 a7044 a7045 a7046 a7047 a7048 a7049 a7050 a7051 a7052 a7053 a7054 a7055 a7056 a7057 a7058 a7059 a7060 a7061 a7062 a7063 a7064 a7065 a7066 a7067 a7068 a7069 a7070 a7071 a7072 a7073 a7074 a7075 a7076 a7077 a7078 a7079 a7080 a7081 a7082 a7083 a7084 a7085 a7086 a7087 a7088 a7089 a7090 a7091 a7092 a7093 a7094 a7095 a7096 a7097 a7098 a7099 a7100 a7101 a7102 a7103 a7104 a7105 a7106 a7107 a7108 a7109 a7110 a7111 a7112 a7113 a7114 a7115 a7116 a7117 a7118 a7119 a7120 a7121 a7122 a7123 a7124 a7125 a7126 a7127 a7128 a7129 a7130 a7131 a7132 a7133 a7134 a7135 a7136 a7137 a7138 a7139 a7140 a7141 a7142 a7143 a7144 a7145 a7146 a7147 a7148 a7149 a7150 a7151 a7152 a7153 a7154 a7155 a7156 a7157 a7158 a7159 a7160 a7161 a7162 a7163 a7164 a7165 a7166 a7167 a7168 a7169 a7170 a7171 a7172 a7173 a7174 a7175 a7176 a7177 a7178 a7179 a7180 a7181 a7182 a7183 a7184 a7185 a7186 a7187 a7188 a7189 a7190 a7191 a7192 a7193 a7194 a7195 a7196 a7197 a7198 a7199 a7200 a7201 a7202 a7203 a7204 a7205 a7206 a7207 a7208 a7209 a7210 a7211 a7212 a7213 a7214 a7215 a7216 a7217 a7218 a7219 a7220 a7221 a7222 a7223 a7224 a7225 a7226 a7227 a7228 a7229 a7230 a7231 a7232 a7233 a7234 a7235 a7236 a7237 a7238 a7239 a7240 a7241 a7242 a7243 a7244 a7245 a7246 a7247 a7248 a7249 a7250 a7251 a7252 a7253 a7254 a7255 a7256 a7257 a7258 a7259 a7260 a7261 a7262 a7263 a7264 a7265 a7266 a7267 a7268 a7269 a7270 a7271 a7272 a7273 a7274 a7275 a7276 a7277 a7278 a7279 a7280 a7281 a7282 a7283 a7284 a7285 a7286 a7287 a7288 a7289 a7290 a7291 a7292 a7293 a7294 a7295 a7296 a7297 a7298 a7299 a7300 a7301 a7302 a7303 a7304 a7305 a7306 a7307 a7308 a7309 a7310 a7311 a7312 a7313 a7314 a7315 a7316 a7317 a7318 a7319 a7320 a7321 a7322 a7323 a7324 a7325 a7326 a7327 a7328 a7329 a7330 a7331 a7332 a7333 a7334 a7335 a7336 a7337 a7338 a7339 a7340 a7341 a7342 a7343 a7344 a7345 a7346 a7347 a7348 a7349 a7350 a7351 a7352 a7353 a7354 a7355 a7356 a7357 a7358 a7359 a7360 a7361 a7362 a7363 a7364 a7365 a7366 a7367 a7368 a7369 a7370 a7371 a7372 a7373 a7374 a7375 a7376 a7377 a7378 a7379 a7380 a7381 a7382 a7383 a7384 a7385 a7386 a7387 a7388 a7389 a7390 a7391 a7392 a7393 a7394 a7395 a7396 a7397 a7398 a7399 a7400 a7401 a7402 a7403 a7404 a7405 a7406 a7407 a7408 a7409 a7410 a7411 a7412 a7413 a7414 a7415 a7416 a7417 a7418 a7419 a7420 a7421 a7422 a7423 a7424 a7425 a7426 a7427 a7428 a7429 a7430 a7431 a7432 a7433 a7434 a7435 a7436 a7437 a7438 a7439 a7440 a7441 a7442 a7443 a7444 a7445 a7446 a7447 a7448 a7449 a7450 a7451 a7452 a7453 a7454 a7455 a7456 a7457 a7458 a7459 a7460 a7461 a7462 a7463 a7464 a7465 a7466 a7467 a7468 a7469 a7470 a7471 a7472 a7473 a7474 a7475 a7476 a7477 a7478 a7479 a7480 a7481 a7482 a7483 a7484 a7485 a7486 a7487 a7488 a7489 a7490 a7491 a7492 a7493 a7494 a7495 a7496 a7497 a7498 a7499 a7500 a7501 a7502 a7503 a7504 a7505 a7506 a7507 a7508 a7509 a7510 a7511 a7512 a7513 a7514 a7515 a7516 a7517 a7518 a7519 a7520 a7521 a7522 a7523 a7524 a7525 a7526 a7527 a7528 a7529 a7530 a7531 a7532 a7533 a7534 a7535 a7536 a7537 a7538 a7539 a7540 a7541 a7542 a7543 a7544 a7545 a7546 a7547 a7548 a7549 a7550 a7551 a7552 a7553 a7554 a7555 a7556 a7557 a7558 a7559 a7560 a7561 a7562 a7563 a7564 a7565 a7566 a7567 a7568 a7569 a7570 a7571 a7572 a7573 a7574 a7575 a7576 a7577 a7578 a7579 a7580 a7581 a7582 a7583 a7584 a7585 a7586 a7587 a7588 a7589 a7590 a7591 a7592 a7593 a7594 a7595 a7596 a7597 a7598 a7599 a7600 a7601 a7602 a7603 a7604 a7605 a7606 a7607 a7608 a7609 a7610 a7611 a7612 a7613 a7614 a7615 a7616 a7617 a7618 a7619 a7620 a7621 a7622 a7623 a7624 a7625 a7626 a7627 a7628 a7629 a7630 a7631 a7632 a7633 a7634 a7635 a7636 a7637 a7638 a7639 a7640 a7641 a7642 a7643 a7644 a7645 a7646 a7647 a7648 a7649 a7650 a7651 a7652 a7653 a7654 a7655 a7656 a7657 a7658 a7659 a7660 a7661 a7662 a7663 a7664 a7665 a7666 a7667 a7668 a7669 a7670 a7671 a7672 a7673 a7674 a7675 a7676 a7677 a7678 a7679 a7680 a7681 a7682 a7683 a7684 a7685 a7686 a7687 a7688 a7689 a7690 a7691 a7692 a7693 a7694 a7695 a7696 a7697 a7698 a7699 a7700 a7701 a7702 a7703 a7704 a7705 a7706 a7707 a7708 a7709 a7710 a7711 a7712 a7713 a7714 a7715 a7716 a7717 a7718 a7719 a7720 a7721 a7722 a7723 a7724 a7725 a7726 a7727 a7728 a7729 a7730 a7731 a7732 a7733 a7734 a7735 a7736 a7737 a7738 a7739 a7740 a7741 a7742 a7743 a7744 a7745 a7746 a7747 a7748 a7749 a7750 a7751 a7752 a7753 a7754 a7755 a7756 a7757 a7758 a7759 a7760 a7761 a7762 a7763 a7764 a7765 a7766 a7767 a7768 a7769 a7770 a7771 a7772 a7773 a7774 a7775 a7776 a7777 a7778 a7779 a7780 a7781 a7782 a7783 a7784 a7785 a7786 a7787 a7788 a7789 a7790 a7791 a7792 a7793 a7794 a7795 a7796 a7797 a7798 a7799 a7800 a7801 a7802 a7803 a7804 a7805 a7806 a7807 a7808 a7809 a7810 a7811 a7812 a7813 a7814 a7815 a7816 a7817 a7818 a7819 a7820 a7821 a7822 a7823 a7824 a7825 a7826 a7827 a7828 a7829 a7830 a7831 a7832 a7833 a7834 a7835 a7836 a7837 a7838 a7839 a7840 a7841 a7842 a7843 a7844 a7845 a7846 a7847 a7848 a7849 a7850 a7851 a7852 a7853 a7854 a7855 a7856 a7857 a7858 a7859 a7860 a7861 a7862 a7863 a7864 a7865 a7866 a7867 a7868 a7869 a7870 a7871 a7872 a7873 a7874 a7875 a7876 a7877 a7878 a7879 a7880 a7881 a7882 a7883 a7884 a7885 a7886 a7887 a7888 a7889 a7890 a7891 a7892 a7893 a7894 a7895 a7896 a7897 a7898 a7899 a7900 a7901 a7902 a7903 a7904 a7905 a7906 a7907 a7908 a7909 a7910 a7911 a7912 a7913 a7914 a7915 a7916 a7917 a7918 a7919 a7920 a7921 a7922 a7923 a7924 a7925 a7926 a7927 a7928 a7929 a7930 a7931 a7932 a7933 a7934 a7935 a7936 a7937 a7938 a7939 a7940 a7941 a7942 a7943 a7944 a7945 a7946 a7947 a7948 a7949 a7950 a7951 a7952 a7953 a7954 a7955 a7956 a7957 a7958 a7959 a7960 a7961 a7962 a7963 a7964 a7965 a7966 a7967 a7968 a7969 a7970 a7971 a7972 a7973 a7974 a7975 a7976 a7977 a7978 a7979 a7980 a7981 a7982 a7983 a7984 a7985 a7986 a7987 a7988 a7989 a7990 a7991 a7992 a7993 a7994 a7995 a7996 a7997 a7998 a7999 a8000 a8001 a8002 a8003 a8004 a8005 a8006 a8007 a8008 a8009 a8010 a8011 a8012 a8013 a8014 a8015 a8016 a8017 a8018 a8019 a8020 a8021 a8022 a8023 a8024 a8025 a8026 a8027 a8028 a8029 a8030 a8031 a8032 a8033 a8034 a8035 a8036 a8037 a8038 a8039 a8040 a8041 a8042 a8043 a8044 a8045 a8046 a8047 a8048 a8049 a8050 a8051 a8052 a8053 a8054 a8055 a8056 a8057 a8058 a8059 a8060 a8061 a8062 a8063 a8064 a8065 a8066 a8067 a8068 a8069 a8070 a8071 a8072 a8073 a8074 a8075 a8076 a8077 a8078 a8079 a8080 a8081 a8082 a8083 a8084 a8085 a8086 a8087 a8088 a8089 a8090 a8091 a8092 a8093 a8094 a8095 a8096 a8097 a8098 a8099 a8100 a8101 a8102 a8103 a8104 a8105 a8106 a8107 a8108 a8109 a8110 a8111 a8112 a8113 a8114 a8115 a8116 a8117 a8118 a8119 a8120 a8121 a8122 a8123 a8124 a8125 a8126 a8127 a8128 a8129 a8130 a8131 a8132 a8133 a8134 a8135 a8136 a8137 a8138 a8139 a8140 a8141 a8142 a8143 a8144 a8145 a8146 a8147 a8148 a8149 a8150 a8151 a8152 a8153 a8154 a8155 a8156 a8157 a8158 a8159 a8160 a8161 a8162 a8163 a8164 a8165 a8166 a8167 a8168 a8169 a8170 a8171 a8172 a8173 a8174 a8175 a8176 a8177 a8178 a8179 a8180 a8181 a8182 a8183 a8184 a8185 a8186 a8187 a8188 a8189 a8190 a8191 a8192 a8193 a8194 a8195 a8196 a8197 a8198 a8199 a8200 a8201 a8202 a8203 a8204 a8205 a8206 a8207 a8208 a8209 a8210 a8211 a8212 a8213 a8214 a8215 a8216 a8217 a8218 a8219 a8220 a8221 a8222 a8223 a8224 a8225 a8226 a8227 a8228 a8229 a8230 a8231 a8232 a8233 a8234 a8235 a8236 a8237 a8238 a8239 a8240 a8241 a8242 a8243 a8244 a8245 a8246 a8247 a8248 a8249 a8250 a8251 a8252 a8253 a8254 a8255 a8256 a8257 a8258 a8259 a8260 a8261 a8262 a8263 a8264 a8265 a8266 a8267 a8268 a8269 a8270 a8271 a8272 a8273 a8274 a8275 a8276 a8277 a8278 a8279 a8280 a8281 a8282 a8283 a8284 a8285 a8286 a8287 a8288 a8289 a8290 a8291 a8292 a8293 a8294 a8295 a8296 a8297 a8298 a8299 a8300 a8301 a8302 a8303 a8304 a8305 a8306 a8307 a8308 a8309 a8310 a8311 a8312 a8313 a8314 a8315 a8316 a8317 a8318 a8319 a8320 a8321 a8322 a8323 a8324 a8325 a8326 a8327 a8328 a8329 a8330 a8331 a8332 a8333 a8334 a8335 a8336 a8337 a8338 a8339 a8340 a8341 a8342 a8343 a8344 a8345 a8346 a8347 a8348 a8349 a8350 a8351 a8352 a8353 a8354 a8355 a8356 a8357 a8358 a8359 a8360 a8361 a8362 a8363 a8364 a8365 a8366 a8367 a8368 a8369 a8370 a8371 a8372 a8373 a8374 a8375 a8376 a8377 a8378 a8379 a8380 a8381 a8382 a8383 a8384 a8385 a8386 a8387 a8388 a8389 a8390 a8391 a8392 a8393 a8394 a8395 a8396 a8397 a8398 a8399 a8400 a8401 a8402 a8403 a8404 a8405 a8406 a8407 a8408 a8409 a8410 a8411 a8412 a8413 a8414 a8415 a8416 a8417 a8418 a8419 a8420 a8421 a8422 a8423 a8424 a8425 a8426 a8427 a8428 a8429 a8430 a8431 a8432 a8433 a8434 a8435 a8436 a8437 a8438 a8439 a8440 a8441 a8442 a8443 a8444 a8445 a8446 a8447 a8448 a8449 a8450 a8451 a8452 a8453 a8454 a8455 a8456 a8457 a8458 a8459 a8460 a8461 a8462 a8463 a8464 a8465 a8466 a8467 a8468 a8469 a8470 a8471 a8472 a8473 a8474 a8475 a8476 a8477 a8478 a8479 a8480 a8481 a8482 a8483 a8484 a8485 a8486 a8487 a8488 a8489 a8490 a8491 a8492 a8493 a8494 a8495 a8496 a8497 a8498 a8499 a8500 a8501 a8502 a8503 a8504 a8505 a8506 a8507 a8508 a8509 a8510 a8511 a8512 a8513 a8514 a8515 a8516 a8517 a8518 a8519 a8520 a8521 a8522 a8523 a8524 a8525 a8526 a8527 a8528 a8529 a8530 a8531 a8532 a8533 a8534 a8535 a8536 a8537 a8538 a8539 a8540 a8541 a8542 a8543 a8544 a8545 a8546 a8547 a8548 a8549 a8550 a8551 a8552 a8553 a8554 a8555 a8556 a8557 a8558 a8559 a8560 a8561 a8562 a8563 a8564 a8565 a8566 a8567 a8568 a8569 a8570 a8571 a8572 a8573 a8574 a8575 a8576 a8577 a8578 a8579 a8580 a8581 a8582 a8583 a8584 a8585 a8586 a8587 a8588 a8589 a8590 a8591 a8592 a8593 a8594 a8595 a8596 a8597 a8598 a8599 a8600 a8601 a8602 a8603 a8604 a8605 a8606 a8607 a8608 a8609 a8610 a8611 a8612 a8613 a8614 a8615 a8616 a8617 a8618 a8619 a8620 a8621 a8622 a8623 a8624 a8625 a8626 a8627 a8628 a8629 a8630 a8631 a8632 a8633 a8634 a8635 a8636 a8637 a8638 a8639 a8640 a8641 a8642 a8643 a8644 a8645 a8646 a8647 a8648 a8649 a8650 a8651 a8652 a8653 a8654 a8655 a8656 a8657 a8658 a8659 a8660 a8661 a8662 a8663 a8664 a8665 a8666 a8667 a8668 a8669 a8670 a8671 a8672 a8673 a8674 a8675 a8676 a8677 a8678 a8679 a8680 a8681 a8682 a8683 a8684 a8685 a8686 a8687 a8688 a8689 a8690 a8691 a8692 a8693 a8694 a8695 a8696 a8697 a8698 a8699 a8700 a8701 a8702 a8703 a8704 a8705 a8706 a8707 a8708 a8709 a8710 a8711 a8712 a8713 a8714 a8715 a8716 a8717 a8718 a8719 a8720 a8721 a8722 a8723 a8724 a8725 a8726 a8727 a8728 a8729 a8730 a8731 a8732 a8733 a8734 a8735 a8736 a8737 a8738 a8739 a8740 a8741 a8742 a8743 a8744 a8745 a8746 a8747 a8748 a8749 a8750 a8751 a8752 a8753 a8754 a8755 a8756 a8757 a8758 a8759 a8760 a8761 a8762 a8763 a8764 a8765 a8766 a8767 a8768 a8769 a8770 a8771 a8772 a8773 a8774 a8775 a8776 a8777 a8778 a8779 a8780 a8781 a8782 a8783 a8784 a8785 a8786 a8787 a8788 a8789 a8790 a8791 a8792 a8793 a8794 a8795 a8796 a8797 a8798 a8799 a8800 a8801 a8802 a8803 a8804 a8805 a8806 a8807 a8808 a8809 a8810 a8811 a8812 a8813 a8814 a8815 a8816 a8817 a8818 a8819 a8820 a8821 a8822 a8823 a8824 a8825 a8826 a8827 a8828 a8829 a8830 a8831 a8832 a8833 a8834 a8835 a8836 a8837 a8838 a8839 a8840 a8841 a8842 a8843 a8844 a8845 a8846 a8847 a8848 a8849 a8850 a8851 a8852 a8853 a8854 a8855 a8856 a8857 a8858 a8859 a8860 a8861 a8862 a8863 a8864 a8865 a8866 a8867 a8868 a8869 a8870 a8871 a8872 a8873 a8874 a8875 a8876 a8877 a8878 a8879 a8880 a8881 a8882 a8883 a8884 a8885 a8886 a8887 a8888 a8889 a8890 a8891 a8892 a8893 a8894 a8895 a8896 a8897 a8898 a8899 a8900 a8901 a8902 a8903 a8904 a8905 a8906 a8907 a8908 a8909 a8910 a8911 a8912 a8913 a8914 a8915 a8916 a8917 a8918 a8919 a8920 a8921 a8922 a8923 a8924 a8925 a8926 a8927 a8928 a8929 a8930 a8931 a8932 a8933 a8934 a8935 a8936 a8937 a8938 a8939 a8940 a8941 a8942 a8943 a8944 a8945 a8946 a8947 a8948 a8949 a8950 a8951 a8952 a8953 a8954 a8955 a8956 a8957 a8958 a8959 a8960 a8961 a8962 a8963 a8964 a8965 a8966 a8967 a8968 a8969 a8970 a8971 a8972 a8973 a8974 a8975 a8976 a8977 a8978 a8979 a8980 a8981 a8982 a8983 a8984 a8985 a8986 a8987 a8988 a8989 a8990 a8991 a8992 a8993 a8994 a8995 a8996 a8997 a8998 a8999 a9000 a9001 a9002 a9003 a9004 a9005 a9006 a9007 a9008 a9009 a9010 a9011 a9012 a9013 a9014 a9015 a9016 a9017 a9018 a9019 a9020 a9021 a9022 a9023 a9024 a9025 a9026 a9027 a9028 a9029 a9030 a9031 a9032 a9033 a9034 a9035 a9036 a9037 a9038 a9039 a9040 a9041 a9042 a9043 a9044 a9045 a9046 a9047 a9048 a9049 a9050 a9051 a9052 a9053 a9054 a9055 a9056 a9057 a9058 a9059 a9060 a9061 a9062 a9063 a9064 a9065 a9066 a9067 a9068 a9069 a9070 a9071 a9072 a9073 a9074 a9075 a9076 a9077 a9078 a9079 a9080 a9081 a9082 a9083 a9084 a9085 a9086 a9087 a9088 a9089 a9090 a9091 a9092 a9093 a9094 a9095 a9096 a9097 a9098 a9099 a9100 a9101 a9102 a9103 a9104 a9105 a9106 a9107 a9108 a9109 a9110 a9111 a9112 a9113 a9114 a9115 a9116 a9117 a9118 a9119 a9120 a9121 a9122 a9123 a9124 a9125 a9126 a9127 a9128 a9129 a9130 a9131 a9132 a9133 a9134 a9135 a9136 a9137 a9138 a9139 a9140 a9141 a9142 a9143 a9144 a9145 a9146 a9147 a9148 a9149 a9150 a9151 a9152 a9153 a9154 a9155 a9156 a9157 a9158 a9159 a9160 a9161 a9162 a9163 a9164 a9165 a9166 a9167 a9168 a9169 a9170 a9171 a9172 a9173 a9174 a9175 a9176 a9177 a9178 a9179 a9180 a9181 a9182 a9183 a9184 a9185 a9186 a9187 a9188 a9189 a9190 a9191 a9192 a9193 a9194 a9195 a9196 a9197 a9198 a9199 a9200 a9201 a9202 a9203 a9204 a9205 a9206 a9207 a9208 a9209 a9210 a9211 a9212 a9213 a9214 a9215 a9216 a9217 a9218 a9219 a9220 a9221 a9222 a9223 a9224 a9225 a9226 a9227 a9228 a9229 a9230 a9231 a9232 a9233 a9234 a9235 a9236 a9237 a9238 a9239 a9240 a9241 a9242 a9243 a9244 a9245 a9246 a9247 a9248 a9249 a9250 a9251 a9252 a9253 a9254 a9255 a9256 a9257 a9258 a9259 a9260 a9261 a9262 a9263 a9264 a9265 a9266 a9267 a9268 a9269 a9270 a9271 a9272 a9273 a9274 a9275 a9276 a9277 a9278 a9279 a9280 a9281 a9282 a9283 a9284 a9285 a9286 a9287 a9288 a9289 a9290 a9291 a9292 a9293 a9294 a9295 a9296 a9297 a9298 a9299 a9300 a9301 a9302 a9303 a9304 a9305 a9306 a9307 a9308 a9309 a9310 a9311 a9312 a9313 a9314 a9315 a9316 a9317 a9318 a9319 a9320 a9321 a9322 a9323 a9324 a9325 a9326 a9327 a9328 a9329 a9330 a9331 a9332 a9333 a9334 a9335 a9336 a9337 a9338 a9339 a9340 a9341 a9342 a9343 a9344 a9345 a9346 a9347 a9348 a9349 a9350 a9351 a9352 a9353 a9354 a9355 a9356 a9357 a9358 a9359 a9360 a9361 a9362 a9363 a9364 a9365 a9366 a9367 a9368 a9369 a9370 a9371 a9372 a9373 a9374 a9375 a9376 a9377 a9378 a9379 a9380 a9381 a9382 a9383 a9384 a9385 a9386 a9387 a9388 a9389 a9390 a9391 a9392 a9393 a9394 a9395 a9396 a9397 a9398 a9399 a9400 a9401 a9402 a9403 a9404 a9405 a9406 a9407 a9408 a9409 a9410 a9411 a9412 a9413 a9414 a9415 a9416 a9417 a9418 a9419 a9420 a9421 a9422 a9423 a9424 a9425 a9426 a9427 a9428 a9429 a9430 a9431 a9432 a9433 a9434 a9435 a9436 a9437 a9438 a9439 a9440 a9441 a9442 a9443 a9444 a9445 a9446 a9447 a9448 a9449 a9450 a9451 a9452 a9453 a9454 a9455 a9456 a9457 a9458 a9459 a9460 a9461 a9462 a9463 a9464 a9465 a9466 a9467 a9468 a9469 a9470 a9471 a9472 a9473 a9474 a9475 a9476 a9477 a9478 a9479 a9480 a9481 a9482 a9483 a9484 a9485 a9486 a9487 a9488 a9489 a9490 a9491 a9492 a9493 a9494 a9495 a9496 a9497 a9498 a9499 a9500 a9501 a9502 a9503 a9504 a9505 a9506 a9507 a9508 a9509 a9510 a9511 a9512 a9513 a9514 a9515 a9516 a9517 a9518 a9519 a9520 a9521 a9522 a9523 a9524 a9525 a9526 a9527 a9528 a9529 a9530 a9531 a9532 a9533 a9534 a9535 a9536 a9537 a9538 a9539 a9540 a9541 a9542 a9543 a9544 a9545 a9546 a9547 a9548 a9549 a9550 a9551 a9552 a9553 a9554 a9555 a9556 a9557 a9558 a9559 a9560 a9561 a9562 a9563 a9564 a9565 a9566 a9567 a9568 a9569 a9570 a9571 a9572 a9573 a9574 a9575 a9576 a9577 a9578 a9579 a9580 a9581 a9582 a9583 a9584 a9585 a9586 a9587 a9588 a9589 a9590 a9591 a9592 a9593 a9594 a9595 a9596 a9597 a9598 a9599 a9600 a9601 a9602 a9603 a9604 a9605 a9606 a9607 a9608 a9609 a9610 a9611 a9612 a9613 a9614 a9615 a9616 a9617 a9618 a9619 a9620 a9621 a9622 a9623 a9624 a9625 a9626 a9627 a9628 a9629 a9630 a9631 a9632 a9633 a9634 a9635 a9636 a9637 a9638 a9639 a9640 a9641 a9642 a9643 a9644 a9645 a9646 a9647 a9648 a9649 a9650 a9651 a9652 a9653 a9654 a9655 a9656 a9657 a9658 a9659 a9660 a9661 a9662 a9663 a9664 a9665 a9666 a9667 a9668 a9669 a9670 a9671 a9672 a9673 a9674 a9675 a9676 a9677 a9678 a9679 a9680 a9681 a9682 a9683 a9684 a9685 a9686 a9687 a9688 a9689 a9690 a9691 a9692 a9693 a9694 a9695 a9696 a9697 a9698 a9699 a9700 a9701 a9702 a9703 a9704 a9705 a9706 a9707 a9708 a9709 a9710 a9711 a9712 a9713 a9714 a9715 a9716 a9717 a9718 a9719 a9720 a9721 a9722 a9723 a9724 a9725 a9726 a9727 a9728 a9729 a9730 a9731 a9732 a9733 a9734 a9735 a9736 a9737 a9738 a9739 a9740 a9741 a9742 a9743 a9744 a9745 a9746 a9747 a9748 a9749 a9750 a9751 a9752 a9753 a9754 a9755 a9756 a9757 a9758 a9759 a9760 a9761 a9762 a9763 a9764 a9765 a9766 a9767 a9768 a9769 a9770 a9771 a9772 a9773 a9774 a9775 a9776 a9777 a9778 a9779 a9780 a9781 a9782 a9783 a9784 a9785 a9786 a9787 a9788 a9789 a9790 a9791 a9792 a9793 a9794 a9795 a9796 a9797 a9798 a9799 a9800 a9801 a9802 a9803 a9804 a9805 a9806 a9807 a9808 a9809 a9810 a9811 a9812 a9813 a9814 a9815 a9816 a9817 a9818 a9819 a9820 a9821 a9822 a9823 a9824 a9825 a9826 a9827 a9828 a9829 a9830 a9831 a9832 a9833 a9834 a9835 a9836 a9837 a9838 a9839 a9840 a9841 a9842 a9843 a9844 a9845 a9846 a9847 a9848 a9849 a9850 a9851 a9852 a9853 a9854 a9855 a9856 a9857 a9858 a9859 a9860 a9861 a9862 a9863 a9864 a9865 a9866 a9867 a9868 a9869 a9870 a9871 a9872 a9873 a9874 a9875 a9876 a9877 a9878 a9879 a9880 a9881 a9882 a9883 a9884 a9885 a9886 a9887 a9888 a9889 a9890 a9891 a9892 a9893 a9894 a9895 a9896 a9897 a9898 a9899 a9900 a9901 a9902 a9903 a9904 a9905 a9906 a9907 a9908 a9909 a9910 a9911 a9912 a9913 a9914 a9915 a9916 a9917 a9918 a9919 a9920 a9921 a9922 a9923 a9924 a9925 a9926 a9927 a9928 a9929 a9930 a9931 a9932 a9933 a9934 a9935 a9936 a9937 a9938 a9939 a9940 a9941 a9942 a9943 a9944 a9945 a9946 a9947 a9948 a9949 a9950 a9951 a9952 a9953 a9954 a9955 a9956 a9957 a9958 a9959 a9960 a9961 a9962 a9963 a9964 a9965 a9966 a9967 a9968 a9969 a9970 a9971 a9972 a9973 a9974 a9975 a9976 a9977 a9978 a9979 a9980 a9981 a9982 a9983 a9984 a9985 a9986 a9987 a9988 a9989 a9990 a9991 a9992 a9993 a9994 a9995 a9996 a9997 a9998 a9999 a10000 a10001 a10002 a10003 a10004 a10005 a10006 a10007 a10008 a10009 a10010 a10011 a10012 a10013 a10014 a10015 a10016 a10017 a10018 a10019 a10020 a10021 a10022 a10023 a10024 a10025 a10026 a10027 a10028 a10029 a10030 a10031 a10032 a10033 a10034 a10035 a10036 a10037 a10038 a10039 a10040 a10041 a10042 a10043 a10044 a10045 a10046 a10047 a10048 a10049 a10050 a10051 a10052 a10053 a10054 a10055 a10056 a10057 a10058 a10059 a10060 a10061 a10062 a10063 a10064 a10065 a10066 a10067 a10068 a10069 a10070 a10071 a10072 a10073 a10074 a10075 a10076 a10077 a10078 a10079 a10080 a10081 a10082 a10083 a10084 a10085 a10086 a10087 a10088 a10089 a10090 a10091 a10092 a10093 a10094 a10095 a10096 a10097 a10098 a10099 a10100 a10101 a10102 a10103 a10104 a10105 a10106 a10107 a10108 a10109 a10110 a10111 a10112 a10113 a10114 a10115 a10116 a10117 a10118 a10119 a10120 a10121 a10122 a10123 a10124 a10125 a10126 a10127 a10128 a10129 a10130 a10131 a10132 a10133 a10134 a10135 a10136 a10137 a10138 a10139 a10140 a10141 a10142 a10143 a10144 a10145 a10146 a10147 a10148 a10149 a10150 a10151 a10152 a10153 a10154 a10155 a10156 a10157 a10158 a10159 a10160 a10161 a10162 a10163 a10164 a10165 a10166 a10167 a10168 a10169 a10170 a10171 a10172 a10173 a10174 a10175 a10176 a10177 a10178 a10179 a10180 a10181 a10182 a10183 a10184 a10185 a10186 a10187 a10188 a10189 a10190 a10191 a10192 a10193 a10194 a10195 a10196 a10197 a10198 a10199 a10200 a10201 a10202 a10203 a10204 a10205 a10206 a10207 a10208 a10209 a10210 a10211 a10212 a10213 a10214 a10215 a10216 a10217 a10218 a10219 a10220 a10221 a10222 a10223 a10224 a10225 a10226 a10227 a10228 a10229 a10230 a10231 a10232 a10233 a10234 a10235 a10236 a10237 a10238 a10239 a10240 a10241 a10242 a10243 a10244 a10245 a10246 a10247 a10248 a10249 a10250 a10251 a10252 a10253 a10254 a10255 a10256 a10257 a10258 a10259 a10260 a10261 a10262 a10263 a10264 a10265 a10266 a10267 a10268 a10269 a10270 a10271 a10272 a10273 a10274 a10275 a10276 a10277 a10278 a10279 a10280 a10281 a10282 a10283 a10284 a10285 a10286 a10287 a10288 a10289 a10290 a10291 a10292 a10293 a10294 a10295 a10296 a10297 a10298 a10299 a10300 a10301 a10302 a10303 a10304 a10305 a10306 a10307 a10308 a10309 a10310 a10311 a10312 a10313 a10314 a10315 a10316 a10317 a10318 a10319 a10320 a10321 a10322 a10323 a10324 a10325 a10326 a10327 a10328 a10329 a10330 a10331 a10332 a10333 a10334 a10335 a10336 a10337 a10338 a10339 a10340 a10341 a10342 a10343 a10344 a10345 a10346 a10347 a10348 a10349 a10350 a10351 a10352 a10353 a10354 a10355 a10356 a10357 a10358 a10359 a10360 a10361 a10362 a10363 a10364 a10365 a10366 a10367 a10368 a10369 a10370 a10371 a10372 a10373 a10374 a10375 a10376 a10377 a10378 a10379 a10380 a10381 a10382 a10383 a10384 a10385 a10386 a10387 a10388 a10389 a10390 a10391 a10392 a10393 a10394 a10395 a10396 a10397 a10398 a10399 a10400 a10401 a10402 a10403 a10404 a10405 a10406 a10407 a10408 a10409 a10410 a10411 a10412 a10413 a10414 a10415 a10416 a10417 a10418 a10419 a10420 a10421 a10422 a10423 a10424 a10425 a10426 a10427 a10428 a10429 a10430 a10431 a10432 a10433 a10434 a10435 a10436 a10437 a10438 a10439 a10440 a10441 a10442 a10443 a10444 a10445 a10446 a10447 a10448 a10449 a10450 a10451 a10452 a10453 a10454 a10455 a10456 a10457 a10458 a10459 a10460 a10461 a10462 a10463 a10464 a10465 a10466 a10467 a10468 a10469 a10470 a10471 a10472 a10473 a10474 a10475 a10476 a10477 a10478 a10479 a10480 a10481 a10482 a10483 a10484 a10485 a10486 a10487 a10488 a10489 a10490 a10491 a10492 a10493 a10494 a10495 a10496 a10497 a10498 a10499 a10500 a10501 a10502 a10503 a10504 a10505 a10506 a10507 a10508 a10509 a10510 a10511 a10512 a10513 a10514 a10515 a10516 a10517 a10518 a10519 a10520 a10521 a10522 a10523 a10524 a10525 a10526 a10527 a10528 a10529 a10530 a10531 a10532 a10533 a10534 a10535 a10536 a10537 a10538 a10539 a10540 a10541 a10542 a10543 a10544 a10545 a10546 a10547 a10548 a10549 a10550 a10551 a10552 a10553 a10554 a10555 a10556 a10557 a10558 a10559 a10560 a10561 a10562 a10563 a10564 a10565 a10566 a10567 a10568 a10569 a10570 a10571 a10572 a10573 a10574 a10575 a10576 a10577 a10578 a10579 a10580 a10581 a10582 a10583 a10584 a10585 a10586 a10587 a10588 a10589 a10590 a10591 a10592 a10593 a10594 a10595 a10596 a10597 a10598 a10599 a10600 a10601 a10602 a10603 a10604 a10605 a10606 a10607 a10608 a10609 a10610 a10611 a10612 a10613 a10614 a10615 a10616 a10617 a10618 a10619 a10620 a10621 a10622 a10623 a10624 a10625 a10626 a10627 a10628 a10629 a10630 a10631 a10632 a10633 a10634 a10635 a10636 a10637 a10638 a10639 a10640 a10641 a10642 a10643 a10644 a10645 a10646 a10647 a10648 a10649 a10650 a10651 a10652 a10653 a10654 a10655 a10656 a10657 a10658 a10659 a10660 a10661 a10662 a10663 a10664 a10665 a10666 a10667 a10668 a10669 a10670 a10671 a10672 a10673 a10674 a10675 a10676 a10677 a10678 a10679 a10680 a10681 a10682 a10683 a10684 a10685 a10686 a10687 a10688 a10689 a10690 a10691 a10692 a10693 a10694 a10695 a10696 a10697 a10698 a10699 a10700 a10701 a10702 a10703 a10704 a10705 a10706 a10707 a10708 a10709 a10710 a10711 a10712 a10713 a10714 a10715 a10716 a10717 a10718 a10719 a10720 a10721 a10722 a10723 a10724 a10725 a10726 a10727 a10728 a10729 a10730 a10731 a10732 a10733 a10734 a10735 a10736 a10737 a10738 a10739 a10740 a10741 a10742 a10743 a10744 a10745 a10746 a10747 a10748 a10749 a10750 a10751 a10752 a10753 a10754 a10755 a10756 a10757 a10758 a10759 a10760 a10761 a10762 a10763 a10764 a10765 a10766 a10767 a10768 a10769 a10770 a10771 a10772 a10773 a10774 a10775 a10776 a10777 a10778 a10779 a10780 a10781 a10782 a10783 a10784 a10785 a10786 a10787 a10788 a10789 a10790 a10791 a10792 a10793 a10794 a10795 a10796 a10797 a10798 a10799 a10800 a10801 a10802 a10803 a10804 a10805 a10806 a10807 a10808 a10809 a10810 a10811 a10812 a10813 a10814 a10815 a10816 a10817 a10818 a10819 a10820 a10821 a10822 a10823 a10824 a10825 a10826 a10827 a10828 a10829 a10830 a10831 a10832 a10833 a10834 a10835 a10836 a10837 a10838 a10839 a10840 a10841 a10842 a10843 a10844 a10845 a10846 a10847 a10848 a10849 a10850 a10851 a10852 a10853 a10854 a10855 a10856 a10857 a10858 a10859 a10860 a10861 a10862 a10863 a10864 a10865 a10866 a10867 a10868 a10869 a10870 a10871 a10872 a10873 a10874 a10875 a10876 a10877 a10878 a10879 a10880 a10881 a10882 a10883 a10884 a10885 a10886 a10887 a10888 a10889 a10890 a10891 a10892 a10893 a10894 a10895 a10896 a10897 a10898 a10899 a10900 a10901 a10902 a10903 a10904 a10905 a10906 a10907 a10908 a10909 a10910 a10911 a10912 a10913 a10914 a10915 a10916 a10917 a10918 a10919 a10920 a10921 a10922 a10923 a10924 a10925 a10926 a10927 a10928 a10929 a10930 a10931 a10932 a10933 a10934 a10935 a10936 a10937 a10938 a10939 a10940 a10941 a10942 a10943 a10944 a10945 a10946 a10947 a10948 a10949 a10950 a10951 a10952 a10953 a10954 a10955 a10956 a10957 a10958 a10959 a10960 a10961 a10962 a10963 a10964 a10965 a10966 a10967 a10968 a10969 a10970 a10971 a10972 a10973 a10974 a10975 a10976 a10977 a10978 a10979 a10980 a10981 a10982 a10983 a10984 a10985 a10986 a10987 a10988 a10989 a10990 a10991 a10992 a10993 a10994 a10995 a10996 a10997 a10998 a10999 a11000 a11001 a11002 a11003 a11004 a11005 a11006 a11007 a11008 a11009 a11010 a11011 a11012 a11013 a11014 a11015 a11016 a11017 a11018 a11019 a11020 a11021 a11022 a11023 a11024 a11025 a11026 a11027 a11028 a11029 a11030 a11031 a11032 a11033 a11034 a11035 a11036 a11037 a11038 a11039 a11040 a11041 a11042 a11043 a11044 a11045 a11046 a11047 a11048 a11049 a11050 a11051 a11052 a11053 a11054 a11055 a11056 a11057 a11058 a11059 a11060 a11061 a11062 a11063 a11064 a11065 a11066 a11067 a11068 a11069 a11070 a11071 a11072 a11073 a11074 a11075 a11076 a11077 a11078 a11079 a11080 a11081 a11082 a11083 a11084 a11085 a11086 a11087 a11088 a11089 a11090 a11091 a11092 a11093 a11094 a11095 a11096 a11097 a11098 a11099 a11100 a11101 a11102 a11103 a11104 a11105 a11106 a11107 a11108 a11109 a11110 a11111 a11112 a11113 a11114 a11115 a11116 a11117 a11118 a11119 a11120 a11121 a11122 a11123 a11124 a11125 a11126 a11127 a11128 a11129 a11130 a11131 a11132 a11133 a11134 a11135 a11136 a11137 a11138 a11139 a11140 a11141 a11142 a11143 a11144 a11145 a11146 a11147 a11148 a11149 a11150 a11151 a11152 a11153 a11154 a11155 a11156 a11157 a11158 a11159 a11160 a11161 a11162 a11163 a11164 a11165 a11166 a11167 a11168 a11169 a11170 a11171 a11172 a11173 a11174 a11175 a11176 a11177 a11178 a11179 a11180 a11181 a11182 a11183 a11184 a11185 a11186 a11187 a11188 a11189 a11190 a11191 a11192 a11193 a11194 a11195 a11196 a11197 a11198 a11199 a11200 a11201 a11202 a11203 a11204 a11205 a11206 a11207 a11208 a11209 a11210 a11211 a11212 a11213 a11214 a11215 a11216 a11217 a11218 a11219 a11220 a11221 a11222 a11223 a11224 a11225 a11226 a11227 a11228 a11229 a11230 a11231 a11232 a11233 a11234 a11235 a11236 a11237 a11238 a11239 a11240 a11241 a11242 a11243 a11244 a11245 a11246 a11247 a11248 a11249 a11250 a11251 a11252 a11253 a11254 a11255 a11256 a11257 a11258 a11259 a11260 a11261 a11262 a11263 a11264 a11265 a11266 a11267 a11268 a11269 a11270 a11271 a11272 a11273 a11274 a11275 a11276 a11277 a11278 a11279 a11280 a11281 a11282 a11283 a11284 a11285 a11286 a11287 a11288 a11289 a11290 a11291 a11292 a11293 a11294 a11295 a11296 a11297 a11298 a11299 a11300 a11301 a11302 a11303 a11304 a11305 a11306 a11307 a11308 a11309 a11310 a11311 a11312 a11313 a11314 a11315 a11316 a11317 a11318 a11319 a11320 a11321 a11322 a11323 a11324 a11325 a11326 a11327 a11328 a11329 a11330 a11331 a11332 a11333 a11334 a11335 a11336 a11337 a11338 a11339 a11340 a11341 a11342 a11343 a11344 a11345 a11346 a11347 a11348 a11349 a11350 a11351 a11352 a11353 a11354 a11355 a11356 a11357 a11358 a11359 a11360 a11361 a11362 a11363 a11364 a11365 a11366 a11367 a11368 a11369 a11370 a11371 a11372 a11373 a11374 a11375 a11376 a11377 a11378 a11379 a11380 a11381 a11382 a11383 a11384 a11385 a11386 a11387 a11388 a11389 a11390 a11391 a11392 a11393 a11394 a11395 a11396 a11397 a11398 a11399 a11400 a11401 a11402 a11403 a11404 a11405 a11406 a11407 a11408 a11409 a11410 a11411 a11412 a11413 a11414 a11415 a11416 a11417 a11418 a11419 a11420 a11421 a11422 a11423 a11424 a11425 a11426 a11427 a11428 a11429 a11430 a11431 a11432 a11433 a11434 a11435 a11436 a11437 a11438 a11439 a11440 a11441 a11442 a11443 a11444 a11445 a11446 a11447 a11448 a11449 a11450 a11451 a11452 a11453 a11454 a11455 a11456 a11457 a11458 a11459 a11460 a11461 a11462 a11463 a11464 a11465 a11466 a11467 a11468 a11469 a11470 a11471 a11472 a11473 a11474 a11475 a11476 a11477 a11478 a11479 a11480 a11481 a11482 a11483 a11484 a11485 a11486 a11487 a11488 a11489 a11490 a11491 a11492 a11493 a11494 a11495 a11496 a11497 a11498 a11499 a11500 a11501 a11502 a11503 a11504 a11505 a11506 a11507 a11508 a11509 a11510 a11511 a11512 a11513 a11514 a11515 a11516 a11517 a11518 a11519 a11520 a11521 a11522 a11523 a11524 a11525 a11526 a11527 a11528 a11529 a11530 a11531 a11532 a11533 a11534 a11535 a11536 a11537 a11538 a11539 a11540 a11541 a11542 a11543 a11544 a11545 a11546 a11547 a11548 a11549 a11550 a11551 a11552 a11553 a11554 a11555 a11556 a11557 a11558 a11559 a11560 a11561 a11562 a11563 a11564 a11565 a11566 a11567 a11568 a11569 a11570 a11571 a11572 a11573 a11574 a11575 a11576 a11577 a11578 a11579 a11580 a11581 a11582 a11583 a11584 a11585 a11586 a11587 a11588 a11589 a11590 a11591 a11592 a11593 a11594 a11595 a11596 a11597 a11598 a11599 a11600 a11601 a11602 a11603 a11604 a11605 a11606 a11607 a11608 a11609 a11610 a11611 a11612 a11613 a11614 a11615 a11616 a11617 a11618 a11619 a11620 a11621 a11622 a11623 a11624 a11625 a11626 a11627 a11628 a11629 a11630 a11631 a11632 a11633 a11634 a11635 a11636 a11637 a11638 a11639 a11640 a11641 a11642 a11643 a11644 a11645 a11646 a11647 a11648 a11649 a11650 a11651 a11652 a11653 a11654 a11655 a11656 a11657 a11658 a11659 a11660 a11661 a11662 a11663 a11664 a11665 a11666 a11667 a11668 a11669 a11670 a11671 a11672 a11673 a11674 a11675 a11676 a11677 a11678 a11679 a11680 a11681 a11682 a11683 a11684 a11685 a11686 a11687 a11688 a11689 a11690 a11691 a11692 a11693 a11694 a11695 a11696 a11697 a11698 a11699 a11700 a11701 a11702 a11703 a11704 a11705 a11706 a11707 a11708 a11709 a11710 a11711 a11712 a11713 a11714 a11715 a11716 a11717 a11718 a11719 a11720 a11721 a11722 a11723 a11724 a11725 a11726 a11727 a11728 a11729 a11730 a11731 a11732 a11733 a11734 a11735 a11736 a11737 a11738 a11739 a11740 a11741 a11742 a11743 a11744 a11745 a11746 a11747 a11748 a11749 a11750 a11751 a11752 a11753 a11754 a11755 a11756 a11757 a11758 a11759 a11760 a11761 a11762 a11763 a11764 a11765 a11766 a11767 a11768 a11769 a11770 a11771 a11772 a11773 a11774 a11775 a11776 a11777 a11778 a11779 a11780 a11781 a11782 a11783 a11784 a11785 a11786 a11787 a11788 a11789 a11790 a11791 a11792 a11793 a11794 a11795 a11796 a11797 a11798 a11799 a11800 a11801 a11802 a11803 a11804 a11805 a11806 a11807 a11808 a11809 a11810 a11811 a11812 a11813 a11814 a11815 a11816 a11817 a11818 a11819 a11820 a11821 a11822 a11823 a11824 a11825 a11826 a11827 a11828 a11829 a11830 a11831 a11832 a11833 a11834 a11835 a11836 a11837 a11838 a11839 a11840 a11841 a11842 a11843 a11844 a11845 a11846 a11847 a11848 a11849 a11850 a11851 a11852 a11853 a11854 a11855 a11856 a11857 a11858 a11859 a11860 a11861 a11862 a11863 a11864 a11865 a11866 a11867 a11868 a11869 a11870 a11871 a11872 a11873 a11874 a11875 a11876 a11877 a11878 a11879 a11880 a11881 a11882 a11883 a11884 a11885 a11886 a11887 a11888 a11889 a11890 a11891 a11892 a11893 a11894 a11895 a11896 a11897 a11898 a11899 a11900 a11901 a11902 a11903 a11904 a11905 a11906 a11907 a11908 a11909 a11910 a11911 a11912 a11913 a11914 a11915 a11916 a11917 a11918 a11919 a11920 a11921 a11922 a11923 a11924 a11925 a11926 a11927 a11928 a11929 a11930 a11931 a11932 a11933 a11934 a11935 a11936 a11937 a11938 a11939 a11940 a11941 a11942 a11943 a11944 a11945 a11946 a11947 a11948 a11949 a11950 a11951 a11952 a11953 a11954 a11955 a11956 a11957 a11958 a11959 a11960 a11961 a11962 a11963 a11964 a11965 a11966 a11967 a11968 a11969 a11970 a11971 a11972 a11973 a11974 a11975 a11976 a11977 a11978 a11979 a11980 a11981 a11982 a11983 a11984 a11985 a11986 a11987 a11988 a11989 a11990 a11991 a11992 a11993 a11994 a11995 a11996 a11997 a11998 a11999 a12000 a12001 a12002 a12003 a12004 a12005 a12006 a12007 a12008 a12009 a12010 a12011 a12012 a12013 a12014 a12015 a12016 a12017 a12018 a12019 a12020 a12021 a12022 a12023 a12024 a12025 a12026 a12027 a12028 a12029 a12030 a12031 a12032 a12033 a12034 a12035 a12036 a12037 a12038 a12039 a12040 a12041 a12042 a12043 a12044 a12045 a12046 a12047 a12048 a12049 a12050 a12051 a12052 a12053 a12054 a12055 a12056 a12057 a12058 a12059 a12060 a12061 a12062 a12063 a12064 a12065 a12066 a12067 a12068 a12069 a12070 a12071 a12072 a12073 a12074 a12075 a12076 a12077 a12078 a12079 a12080 a12081 a12082 a12083 a12084 a12085 a12086 a12087 a12088 a12089 a12090 a12091 a12092 a12093 a12094 a12095 a12096 a12097 a12098 a12099 a12100 a12101 a12102 a12103 a12104 a12105 a12106 a12107 a12108 a12109 a12110 a12111 a12112 a12113 a12114 a12115 a12116 a12117 a12118 a12119 a12120 a12121 a12122 a12123 a12124 a12125 a12126 a12127 a12128 a12129 a12130 a12131 a12132 a12133 a12134 a12135 a12136 a12137 a12138 a12139 a12140 a12141 a12142 a12143 a12144 a12145 a12146 a12147 a12148 a12149 a12150 a12151 a12152 a12153 a12154 a12155 a12156 a12157 a12158 a12159 a12160 a12161 a12162 a12163 a12164 a12165 a12166 a12167 a12168 a12169 a12170 a12171 a12172 a12173 a12174 a12175 a12176 a12177 a12178 a12179 a12180 a12181 a12182 a12183 a12184 a12185 a12186 a12187 a12188 a12189 a12190 a12191 a12192 a12193 a12194 a12195 a12196 a12197 a12198 a12199 a12200 a12201 a12202 a12203 a12204 a12205 a12206 a12207 a12208 a12209 a12210 a12211 a12212 a12213 a12214 a12215 a12216 a12217 a12218 a12219 a12220 a12221 a12222 a12223 a12224 a12225 a12226 a12227 a12228 a12229 a12230 a12231 a12232 a12233 a12234 a12235 a12236 a12237 a12238 a12239 a12240 a12241 a12242 a12243 a12244 a12245 a12246 a12247 a12248 a12249 a12250 a12251 a12252 a12253 a12254 a12255 a12256 a12257 a12258 a12259 a12260 a12261 a12262 a12263 a12264 a12265 a12266 a12267 a12268 a12269 a12270 a12271 a12272 a12273 a12274 a12275 a12276 a12277 a12278 a12279 a12280 a12281 a12282 a12283 a12284 a12285 a12286 a12287 a12288 a12289 a12290 a12291 a12292 a12293 a12294 a12295 a12296 a12297 a12298 a12299 a12300 a12301 a12302 a12303 a12304 a12305 a12306 a12307 a12308 a12309 a12310 a12311 a12312 a12313 a12314 a12315 a12316 a12317 a12318 a12319 a12320 a12321 a12322 a12323 a12324 a12325 a12326 a12327 a12328 a12329 a12330 a12331 a12332 a12333 a12334 a12335 a12336 a12337 a12338 a12339 a12340 a12341 a12342 a12343 a12344 a12345 a12346 a12347 a12348 a12349 a12350 a12351 a12352 a12353 a12354 a12355 a12356 a12357 a12358 a12359 a12360 a12361 a12362 a12363 a12364 a12365 a12366 a12367 a12368 a12369 a12370 a12371 a12372 a12373 a12374 a12375 a12376 a12377 a12378 a12379 a12380 a12381 a12382 a12383 a12384 a12385 a12386 a12387 a12388 a12389 a12390 a12391 a12392 a12393 a12394 a12395 a12396 a12397 a12398 a12399 a12400 a12401 a12402 a12403 a12404 a12405 a12406 a12407 a12408 a12409 a12410 a12411 a12412 a12413 a12414 a12415 a12416 a12417 a12418 a12419 a12420 a12421 a12422 a12423 a12424 a12425 a12426 a12427 a12428 a12429 a12430 a12431 a12432 a12433 a12434 a12435 a12436 a12437 a12438 a12439 a12440 a12441 a12442 a12443 a12444 a12445 a12446 a12447 a12448 a12449 a12450 a12451 a12452 a12453 a12454 a12455 a12456 a12457 a12458 a12459 a12460 a12461 a12462 a12463 a12464 a12465 a12466 a12467 a12468 a12469 a12470 a12471 a12472 a12473 a12474 a12475 a12476 a12477 a12478 a12479 a12480 a12481 a12482 a12483 a12484 a12485 a12486 a12487 a12488 a12489 a12490 a12491 a12492 a12493 a12494 a12495 a12496 a12497 a12498 a12499 a12500 a12501 a12502 a12503 a12504 a12505 a12506 a12507 a12508 a12509 a12510 a12511 a12512 a12513 a12514 a12515 a12516 a12517 a12518 a12519 a12520 a12521 a12522 a12523 a12524 a12525 a12526 a12527 a12528 a12529 a12530 a12531 a12532 a12533 a12534 a12535 a12536 a12537 a12538 a12539 a12540 a12541 a12542 a12543 a12544 a12545 a12546 a12547 a12548 a12549 a12550 a12551 a12552 a12553 a12554 a12555 a12556 a12557 a12558 a12559 a12560 a12561 a12562 a12563 a12564 a12565 a12566 a12567 a12568 a12569 a12570 a12571 a12572 a12573 a12574 a12575 a12576 a12577 a12578 a12579 a12580 a12581 a12582 a12583 a12584 a12585 a12586 a12587 a12588 a12589 a12590 a12591 a12592 a12593 a12594 a12595 a12596 a12597 a12598 a12599 a12600 a12601 a12602 a12603 a12604 a12605 a12606 a12607 a12608 a12609 a12610 a12611 a12612 a12613 a12614 a12615 a12616 a12617 a12618 a12619 a12620 a12621 a12622 a12623 a12624 a12625 a12626 a12627 a12628 a12629 a12630 a12631 a12632 a12633 a12634 a12635 a12636 a12637 a12638 a12639 a12640 a12641 a12642 a12643 a12644 a12645 a12646 a12647 a12648 a12649 a12650 a12651 a12652 a12653 a12654 a12655 a12656 a12657 a12658 a12659 a12660 a12661 a12662 a12663 a12664 a12665 a12666 a12667 a12668 a12669 a12670 a12671 a12672 a12673 a12674 a12675 a12676 a12677 a12678 a12679 a12680 a12681 a12682 a12683 a12684 a12685 a12686 a12687 a12688 a12689 a12690 a12691 a12692 a12693 a12694 a12695 a12696 a12697 a12698 a12699 a12700 a12701 a12702 a12703 a12704 a12705 a12706 a12707 a12708 a12709 a12710 a12711 a12712 a12713 a12714 a12715 a12716 a12717 a12718 a12719 a12720 a12721 a12722 a12723 a12724 a12725 a12726 a12727 a12728 a12729 a12730 a12731 a12732 a12733 a12734 a12735 a12736 a12737 a12738 a12739 a12740 a12741 a12742 a12743 a12744 a12745 a12746 a12747 a12748 a12749 a12750 a12751 a12752 a12753 a12754 a12755 a12756 a12757 a12758 a12759 a12760 a12761 a12762 a12763 a12764 a12765 a12766 a12767 a12768 a12769 a12770 a12771 a12772 a12773 a12774 a12775 a12776 a12777 a12778 a12779 a12780 a12781 a12782 a12783 a12784 a12785 a12786 a12787 a12788 a12789 a12790 a12791 a12792 a12793 a12794 a12795 a12796 a12797 a12798 a12799 a12800 a12801 a12802 a12803 a12804 a12805 a12806 a12807 a12808 a12809 a12810 a12811 a12812 a12813 a12814 a12815 a12816 a12817 a12818 a12819 a12820 a12821 a12822 a12823 a12824 a12825 a12826 a12827 a12828 a12829 a12830 a12831 a12832 a12833 a12834 a12835 a12836 a12837 a12838 a12839 a12840 a12841 a12842 a12843 a12844 a12845 a12846 a12847 a12848 a12849 a12850 a12851 a12852 a12853 a12854 a12855 a12856 a12857 a12858 a12859 a12860 a12861 a12862 a12863 a12864 a12865 a12866 a12867 a12868 a12869 a12870 a12871 a12872 a12873 a12874 a12875 a12876 a12877 a12878 a12879 a12880 a12881 a12882 a12883 a12884 a12885 a12886 a12887 a12888 a12889 a12890 a12891 a12892 a12893 a12894 a12895 a12896 a12897 a12898 a12899 a12900 a12901 a12902 a12903 a12904 a12905 a12906 a12907 a12908 a12909 a12910 a12911 a12912 a12913 a12914 a12915 a12916 a12917 a12918 a12919 a12920 a12921 a12922 a12923 a12924 a12925 a12926 a12927 a12928 a12929 a12930 a12931 a12932 a12933 a12934 a12935 a12936 a12937 a12938 a12939 a12940 a12941 a12942 a12943 a12944 a12945 a12946 a12947 a12948 a12949 a12950 a12951 a12952 a12953 a12954 a12955 a12956 a12957 a12958 a12959 a12960 a12961 a12962 a12963 a12964 a12965 a12966 a12967 a12968 a12969 a12970 a12971 a12972 a12973 a12974 a12975 a12976 a12977 a12978 a12979 a12980 a12981 a12982 a12983 a12984 a12985 a12986 a12987 a12988 a12989 a12990 a12991 a12992 a12993 a12994 a12995 a12996 a12997 a12998 a12999 a13000 a13001 a13002 a13003 a13004 a13005 a13006 a13007 a13008 a13009 a13010 a13011 a13012 a13013 a13014 a13015 a13016 a13017 a13018 a13019 a13020 a13021 a13022 a13023 a13024 a13025 a13026 a13027 a13028 a13029 a13030 a13031 a13032 a13033 a13034 a13035 a13036 a13037 a13038 a13039 a13040 a13041 a13042 a13043 a13044 a13045 a13046 a13047 a13048 a13049 a13050 a13051 a13052 a13053 a13054 a13055 a13056 a13057 a13058 a13059 a13060 a13061 a13062 a13063 a13064 a13065 a13066 a13067 a13068 a13069 a13070 a13071 a13072 a13073 a13074 a13075 a13076 a13077 a13078 a13079 a13080 a13081 a13082 a13083 a13084 a13085 a13086 a13087 a13088 a13089 a13090 a13091 a13092 a13093 a13094 a13095 a13096 a13097 a13098 a13099 a13100 a13101 a13102 a13103 a13104 a13105 a13106 a13107 a13108 a13109 a13110 a13111 a13112 a13113 a13114 a13115 a13116 a13117 a13118 a13119 a13120 a13121 a13122 a13123 a13124 a13125 a13126 a13127 a13128 a13129 a13130 a13131 a13132 a13133 a13134 a13135 a13136 a13137 a13138 a13139 a13140 a13141 a13142 a13143 a13144 a13145 a13146 a13147 a13148 a13149 a13150 a13151 a13152 a13153 a13154 a13155 a13156 a13157 a13158 a13159 a13160 a13161 a13162 a13163 a13164 a13165 a13166 a13167 a13168 a13169 a13170 a13171 a13172 a13173 a13174 a13175 a13176 a13177 a13178 a13179 a13180 a13181 a13182 a13183 a13184 a13185 a13186 a13187 a13188 a13189 a13190 a13191 a13192 a13193 a13194 a13195 a13196 a13197 a13198 a13199 a13200 a13201 a13202 a13203 a13204 a13205 a13206 a13207 a13208 a13209 a13210 a13211 a13212 a13213 a13214 a13215 a13216 a13217 a13218 a13219 a13220 a13221 a13222 a13223 a13224 a13225 a13226 a13227 a13228 a13229 a13230 a13231 a13232 a13233 a13234 a13235 a13236 a13237 a13238 a13239 a13240 a13241 a13242 a13243 a13244 a13245 a13246 a13247 a13248 a13249 a13250 a13251 a13252 a13253 a13254 a13255 a13256 a13257 a13258 a13259 a13260 a13261 a13262 a13263 a13264 a13265 a13266 a13267 a13268 a13269 a13270 a13271 a13272 a13273 a13274 a13275 a13276 a13277 a13278 a13279 a13280 a13281 a13282 a13283 a13284 a13285 a13286 a13287 a13288 a13289 a13290 a13291 a13292 a13293 a13294 a13295 a13296 a13297 a13298 a13299 a13300 a13301 a13302 a13303 a13304 a13305 a13306 a13307 a13308 a13309 a13310 a13311 a13312 a13313 a13314 a13315 a13316 a13317 a13318 a13319 a13320 a13321 a13322 a13323 a13324 a13325 a13326 a13327 a13328 a13329 a13330 a13331 a13332 a13333 a13334 a13335 a13336 a13337 a13338 a13339 a13340 a13341 a13342 a13343 a13344 a13345 a13346 a13347 a13348 a13349 a13350 a13351 a13352 a13353 a13354 a13355 a13356 a13357 a13358 a13359 a13360 a13361 a13362 a13363 a13364 a13365 a13366 a13367 a13368 a13369 a13370 a13371 a13372 a13373 a13374 a13375 a13376 a13377 a13378 a13379 a13380 a13381 a13382 a13383 a13384 a13385 a13386 a13387 a13388 a13389 a13390 a13391 a13392 a13393 a13394 a13395 a13396 a13397 a13398 a13399 a13400 a13401 a13402 a13403 a13404 a13405 a13406 a13407 a13408 a13409 a13410 a13411 a13412 a13413 a13414 a13415 a13416 a13417 a13418 a13419 a13420 a13421 a13422 a13423 a13424 a13425 a13426 a13427 a13428 a13429 a13430 a13431 a13432 a13433 a13434 a13435 a13436 a13437 a13438 a13439 a13440 a13441 a13442 a13443 a13444 a13445 a13446 a13447 a13448 a13449 a13450 a13451 a13452 a13453 a13454 a13455 a13456 a13457 a13458 a13459 a13460 a13461 a13462 a13463 a13464 a13465 a13466 a13467 a13468 a13469 a13470 a13471 a13472 a13473 a13474 a13475 a13476 a13477 a13478 a13479 a13480 a13481 a13482 a13483 a13484 a13485 a13486 a13487 a13488 a13489 a13490 a13491 a13492 a13493 a13494 a13495 a13496 a13497 a13498 a13499 a13500 a13501 a13502 a13503 a13504 a13505 a13506 a13507 a13508 a13509 a13510 a13511 a13512 a13513 a13514 a13515 a13516 a13517 a13518 a13519 a13520 a13521 a13522 a13523 a13524 a13525 a13526 a13527 a13528 a13529 a13530 a13531 a13532 a13533 a13534 a13535 a13536 a13537 a13538 a13539 a13540 a13541 a13542 a13543 a13544 a13545 a13546 a13547 a13548 a13549 a13550 a13551 a13552 a13553 a13554 a13555 a13556 a13557 a13558 a13559 a13560 a13561 a13562 a13563 a13564 a13565 a13566 a13567 a13568 a13569 a13570 a13571 a13572 a13573 a13574 a13575 a13576 a13577 a13578 a13579 a13580 a13581 a13582 a13583 a13584 a13585 a13586 a13587 a13588 a13589 a13590 a13591 a13592 a13593 a13594 a13595 a13596 a13597 a13598 a13599 a13600 a13601 a13602 a13603 a13604 a13605 a13606 a13607 a13608 a13609 a13610 a13611 a13612 a13613 a13614 a13615 a13616 a13617 a13618 a13619 a13620 a13621 a13622 a13623 a13624 a13625 a13626 a13627 a13628 a13629 a13630 a13631 a13632 a13633 a13634 a13635 a13636 a13637 a13638 a13639 a13640 a13641 a13642 a13643 a13644 a13645 a13646 a13647 a13648 a13649 a13650 a13651 a13652 a13653 a13654 a13655 a13656 a13657 a13658 a13659 a13660 a13661 a13662 a13663 a13664 a13665 a13666 a13667 a13668 a13669 a13670 a13671 a13672 a13673 a13674 a13675 a13676 a13677 a13678 a13679 a13680 a13681 a13682 a13683 a13684 a13685 a13686 a13687 a13688 a13689 a13690 a13691 a13692 a13693 a13694 a13695 a13696 a13697 a13698 a13699 a13700 a13701 a13702 a13703 a13704 a13705 a13706 a13707 a13708 a13709 a13710 a13711 a13712 a13713 a13714 a13715 a13716 a13717 a13718 a13719 a13720 a13721 a13722 a13723 a13724 a13725 a13726 a13727 a13728 a13729 a13730 a13731 a13732 a13733 a13734 a13735 a13736 a13737 a13738 a13739 a13740 a13741 a13742 a13743 a13744 a13745 a13746 a13747 a13748 a13749 a13750 a13751 a13752 a13753 a13754 a13755 a13756 a13757 a13758 a13759 a13760 a13761 a13762 a13763 a13764 a13765 a13766 a13767 a13768 a13769 a13770 a13771 a13772 a13773 a13774 a13775 a13776 a13777 a13778 a13779 a13780 a13781 a13782 a13783 a13784 a13785 a13786 a13787 a13788 a13789 a13790 a13791 a13792 a13793 a13794 a13795 a13796 a13797 a13798 a13799 a13800 a13801 a13802 a13803 a13804 a13805 a13806 a13807 a13808 a13809 a13810 a13811 a13812 a13813 a13814 a13815 a13816 a13817 a13818 a13819 a13820 a13821 a13822 a13823 a13824 a13825 a13826 a13827 a13828 a13829 a13830 a13831 a13832 a13833 a13834 a13835 a13836 a13837 a13838 a13839 a13840 a13841 a13842 a13843 a13844 a13845 a13846 a13847 a13848 a13849 a13850 a13851 a13852 a13853 a13854 a13855 a13856 a13857 a13858 a13859 a13860 a13861 a13862 a13863 a13864 a13865 a13866 a13867 a13868 a13869 a13870 a13871 a13872 a13873 a13874 a13875 a13876 a13877 a13878 a13879 a13880 a13881 a13882 a13883 a13884 a13885 a13886 a13887 a13888 a13889 a13890 a13891 a13892 a13893 a13894 a13895 a13896 a13897 a13898 a13899 a13900 a13901 a13902 a13903 a13904 a13905 a13906 a13907 a13908 a13909 a13910 a13911 a13912 a13913 a13914 a13915 a13916 a13917 a13918 a13919 a13920 a13921 a13922 a13923 a13924 a13925 a13926 a13927 a13928 a13929 a13930 a13931 a13932 a13933 a13934 a13935 a13936 a13937 a13938 a13939 a13940 a13941 a13942 a13943 a13944 a13945 a13946 a13947 a13948 a13949 a13950 a13951 a13952 a13953 a13954 a13955 a13956 a13957 a13958 a13959 a13960 a13961 a13962 a13963 a13964 a13965 a13966 a13967 a13968 a13969 a13970 a13971 a13972 a13973 a13974 a13975 a13976 a13977 a13978 a13979 a13980 a13981 a13982 a13983 a13984 a13985 a13986 a13987 a13988 a13989 a13990 a13991 a13992 a13993 a13994 a13995 a13996 a13997 a13998 a13999 a14000 a14001 a14002 a14003 a14004 a14005 a14006 a14007 a14008 a14009 a14010 a14011 a14012 a14013 a14014 a14015 a14016 a14017 a14018 a14019 a14020 a14021 a14022 a14023 a14024 a14025 a14026 a14027 a14028 a14029 a14030 a14031 a14032 a14033 a14034 a14035 a14036 a14037 a14038 a14039 a14040 a14041 a14042 a14043 a14044 a14045 a14046 a14047 a14048 a14049 a14050 a14051 a14052 a14053 a14054 a14055 a14056 a14057 a14058 a14059 a14060 a14061 a14062 a14063 a14064 a14065 a14066 a14067 a14068 a14069 a14070 a14071 a14072 a14073 a14074 a14075 a14076 a14077 a14078 a14079 a14080 a14081 a14082 a14083 a14084 a14085 a14086 a14087 a14088 a14089 a14090 a14091 a14092 a14093 a14094 a14095 a14096 a14097 a14098 a14099 a14100 a14101 a14102 a14103 a14104 a14105 a14106 a14107 a14108 a14109 a14110 a14111 a14112 a14113 a14114 a14115 a14116 a14117 a14118 a14119 a14120 a14121 a14122 a14123 a14124 a14125 a14126 a14127 a14128 a14129 a14130 a14131 a14132 a14133 a14134 a14135 a14136 a14137 a14138 a14139 a14140 a14141 a14142 a14143 a14144 a14145 a14146 a14147 a14148 a14149 a14150 a14151 a14152 a14153 a14154 a14155 a14156 a14157 a14158 a14159 a14160 a14161 a14162 a14163 a14164 a14165 a14166 a14167 a14168 a14169 a14170 a14171 a14172 a14173 a14174 a14175 a14176 a14177 a14178 a14179 a14180 a14181 a14182 a14183 a14184 a14185 a14186 a14187 a14188 a14189 a14190 a14191 a14192 a14193 a14194 a14195 a14196 a14197 a14198 a14199 a14200 a14201 a14202 a14203 a14204 a14205 a14206 a14207 a14208 a14209 a14210 a14211 a14212 a14213 a14214 a14215 a14216 a14217 a14218 a14219 a14220 a14221 a14222 a14223 a14224 a14225 a14226 a14227 a14228 a14229 a14230 a14231 a14232 a14233 a14234 a14235 a14236 a14237 a14238 a14239 a14240 a14241 a14242 a14243 a14244 a14245 a14246 a14247 a14248 a14249 a14250 a14251 a14252 a14253 a14254 a14255 a14256 a14257 a14258 a14259 a14260 a14261 a14262 a14263 a14264 a14265 a14266 a14267 a14268 a14269 a14270 a14271 a14272 a14273 a14274 a14275 a14276 a14277 a14278 a14279 a14280 a14281 a14282 a14283 a14284 a14285 a14286 a14287 a14288 a14289 a14290 a14291 a14292 a14293 a14294 a14295 a14296 a14297 a14298 a14299 a14300 a14301 a14302 a14303 a14304 a14305 a14306 a14307 a14308 a14309 a14310 a14311 a14312 a14313 a14314 a14315 a14316 a14317 a14318 a14319 a14320 a14321 a14322 a14323 a14324 a14325 a14326 a14327 a14328 a14329 a14330 a14331 a14332 a14333 a14334 a14335 a14336 a14337 a14338 a14339 a14340 a14341 a14342 a14343 a14344 a14345 a14346 a14347 a14348 a14349 a14350 a14351 a14352 a14353 a14354 a14355 a14356 a14357 a14358 a14359 a14360 a14361 a14362 a14363 a14364 a14365 a14366 a14367 a14368 a14369 a14370 a14371 a14372 a14373 a14374 a14375 a14376 a14377 a14378 a14379 a14380 a14381 a14382 a14383 a14384 a14385 a14386 a14387 a14388 a14389 a14390 a14391 a14392 a14393 a14394 a14395 a14396 a14397 a14398 a14399 a14400 a14401 a14402 a14403 a14404 a14405 a14406 a14407 a14408 a14409 a14410 a14411 a14412 a14413 a14414 a14415 a14416 a14417 a14418 a14419 a14420 a14421 a14422 a14423 a14424 a14425 a14426 a14427 a14428 a14429 a14430 a14431 a14432 a14433 a14434 a14435 a14436 a14437 a14438 a14439 a14440 a14441 a14442 a14443 a14444 a14445 a14446 a14447 a14448 a14449 a14450 a14451 a14452 a14453 a14454 a14455 a14456 a14457 a14458 a14459 a14460 a14461 a14462 a14463 a14464 a14465 a14466 a14467 a14468 a14469 a14470 a14471 a14472 a14473 a14474 a14475 a14476 a14477 a14478 a14479 a14480 a14481 a14482 a14483 a14484 a14485 a14486 a14487 a14488 a14489 a14490 a14491 a14492 a14493 a14494 a14495 a14496 a14497 a14498 a14499 a14500 a14501 a14502 a14503 a14504 a14505 a14506 a14507 a14508 a14509 a14510 a14511 a14512 a14513 a14514 a14515 a14516 a14517 a14518 a14519 a14520 a14521 a14522 a14523 a14524 a14525 a14526 a14527 a14528 a14529 a14530 a14531 a14532 a14533 a14534 a14535 a14536 a14537 a14538 a14539 a14540 a14541 a14542 a14543 a14544 a14545 a14546 a14547 a14548 a14549 a14550 a14551 a14552 a14553 a14554 a14555 a14556 a14557 a14558 a14559 a14560 a14561 a14562 a14563 a14564 a14565 a14566 a14567 a14568 a14569 a14570 a14571 a14572 a14573 a14574 a14575 a14576 a14577 a14578 a14579 a14580 a14581 a14582 a14583 a14584 a14585 a14586 a14587 a14588 a14589 a14590 a14591 a14592 a14593 a14594 a14595 a14596 a14597 a14598 a14599 a14600 a14601 a14602 a14603 a14604 a14605 a14606 a14607 a14608 a14609 a14610 a14611 a14612 a14613 a14614 a14615 a14616 a14617 a14618 a14619 a14620 a14621 a14622 a14623 a14624 a14625 a14626 a14627 a14628 a14629 a14630 a14631 a14632 a14633 a14634 a14635 a14636 a14637 a14638 a14639 a14640 a14641 a14642 a14643 a14644 a14645 a14646 a14647 a14648 a14649 a14650 a14651 a14652 a14653 a14654 a14655 a14656 a14657 a14658 a14659 a14660 a14661 a14662 a14663 a14664 a14665 a14666 a14667 a14668 a14669 a14670 a14671 a14672 a14673 a14674 a14675 a14676 a14677 a14678 a14679 a14680 a14681 a14682 a14683 a14684 a14685 a14686 a14687 a14688 a14689 a14690 a14691 a14692 a14693 a14694 a14695 a14696 a14697 a14698 a14699 a14700 a14701 a14702 a14703 a14704 a14705 a14706 a14707 a14708 a14709 a14710 a14711 a14712 a14713 a14714 a14715 a14716 a14717 a14718 a14719 a14720 a14721 a14722 a14723 a14724 a14725 a14726 a14727 a14728 a14729 a14730 a14731 a14732 a14733 a14734 a14735 a14736 a14737 a14738 a14739 a14740 a14741 a14742 a14743 a14744 a14745 a14746 a14747 a14748 a14749 a14750 a14751 a14752 a14753 a14754 a14755 a14756 a14757 a14758 a14759 a14760 a14761 a14762 a14763 a14764 a14765 a14766 a14767 a14768 a14769 a14770 a14771 a14772 a14773 a14774 a14775 a14776 a14777 a14778 a14779 a14780 a14781 a14782 a14783 a14784 a14785 a14786 a14787 a14788 a14789 a14790 a14791 a14792 a14793 a14794 a14795 a14796 a14797 a14798 a14799 a14800 a14801 a14802 a14803 a14804 a14805 a14806 a14807 a14808 a14809 a14810 a14811 a14812 a14813 a14814 a14815 a14816 a14817 a14818 a14819 a14820 a14821 a14822 a14823 a14824 a14825 a14826 a14827 a14828 a14829 a14830 a14831 a14832 a14833 a14834 a14835 a14836 a14837 a14838 a14839 a14840 a14841 a14842 a14843 a14844 a14845 a14846 a14847 a14848 a14849 a14850 a14851 a14852 a14853 a14854 a14855 a14856 a14857 a14858 a14859 a14860 a14861 a14862 a14863 a14864 a14865 a14866 a14867 a14868 a14869 a14870 a14871 a14872 a14873 a14874 a14875 a14876 a14877 a14878 a14879 a14880 a14881 a14882 a14883 a14884 a14885 a14886 a14887 a14888 a14889 a14890 a14891 a14892 a14893 a14894 a14895 a14896 a14897 a14898 a14899 a14900 a14901 a14902 a14903 a14904 a14905 a14906 a14907 a14908 a14909 a14910 a14911 a14912 a14913 a14914 a14915 a14916 a14917 a14918 a14919 a14920 a14921 a14922 a14923 a14924 a14925 a14926 a14927 a14928 a14929 a14930 a14931 a14932 a14933 a14934 a14935 a14936 a14937 a14938 a14939 a14940 a14941 a14942 a14943 a14944 a14945 a14946 a14947 a14948 a14949 a14950 a14951 a14952 a14953 a14954 a14955 a14956 a14957 a14958 a14959 a14960 a14961 a14962 a14963 a14964 a14965 a14966 a14967 a14968 a14969 a14970 a14971 a14972 a14973 a14974 a14975 a14976 a14977 a14978 a14979 a14980 a14981 a14982 a14983 a14984 a14985 a14986 a14987 a14988 a14989 a14990 a14991 a14992 a14993 a14994 a14995 a14996 a14997 a14998 a14999 a15000 a15001 a15002 a15003 a15004 a15005 a15006 a15007 a15008 a15009 a15010 a15011 a15012 a15013 a15014 a15015 a15016 a15017 a15018 a15019 a15020 a15021 a15022 a15023 a15024 a15025 a15026 a15027 a15028 a15029 a15030 a15031 a15032 a15033 a15034 a15035 a15036 a15037 a15038 a15039 a15040 a15041 a15042 a15043 a15044 a15045 a15046 a15047 a15048 a15049 a15050 a15051 a15052 a15053 a15054 a15055 a15056 a15057 a15058 a15059 a15060 a15061 a15062 a15063 a15064 a15065 a15066 a15067 a15068 a15069 a15070 a15071 a15072 a15073 a15074 a15075 a15076 a15077 a15078 a15079 a15080 a15081 a15082 a15083 a15084 a15085 a15086 a15087 a15088 a15089 a15090 a15091 a15092 a15093 a15094 a15095 a15096 a15097 a15098 a15099 a15100 a15101 a15102 a15103 a15104 a15105 a15106 a15107 a15108 a15109 a15110 a15111 a15112 a15113 a15114 a15115 a15116 a15117 a15118 a15119 a15120 a15121 a15122 a15123 a15124 a15125 a15126 a15127 a15128 a15129 a15130 a15131 a15132 a15133 a15134 a15135 a15136 a15137 a15138 a15139 a15140 a15141 a15142 a15143 a15144 a15145 a15146 a15147 a15148 a15149 a15150 a15151 a15152 a15153 a15154 a15155 a15156 a15157 a15158 a15159 a15160 a15161 a15162 a15163 a15164 a15165 a15166 a15167 a15168 a15169 a15170 a15171 a15172 a15173 a15174 a15175 a15176 a15177 a15178 a15179 a15180 a15181 a15182 a15183 a15184 a15185 a15186 a15187 a15188 a15189 a15190 a15191 a15192 a15193 a15194 a15195 a15196 a15197 a15198 a15199 a15200 a15201 a15202 a15203 a15204 a15205 a15206 a15207 a15208 a15209 a15210 a15211 a15212 a15213 a15214 a15215 a15216 a15217 a15218 a15219 a15220 a15221 a15222 a15223 a15224 a15225 a15226 a15227 a15228 a15229 a15230 a15231 a15232 a15233 a15234 a15235 a15236 a15237 a15238 a15239 a15240 a15241 a15242 a15243 a15244 a15245 a15246 a15247 a15248 a15249 a15250 a15251 a15252 a15253 a15254 a15255 a15256 a15257 a15258 a15259 a15260 a15261 a15262 a15263 a15264 a15265 a15266 a15267 a15268 a15269 a15270 a15271 a15272 a15273 a15274 a15275 a15276 a15277 a15278 a15279 a15280 a15281 a15282 a15283 a15284 a15285 a15286 a15287 a15288 a15289 a15290 a15291 a15292 a15293 a15294 a15295 a15296 a15297 a15298 a15299 a15300 a15301 a15302 a15303 a15304 a15305 a15306 a15307 a15308 a15309 a15310 a15311 a15312 a15313 a15314 a15315 a15316 a15317 a15318 a15319 a15320 a15321 a15322 a15323 a15324 a15325 a15326 a15327 a15328 a15329 a15330 a15331 a15332 a15333 a15334 a15335 a15336 a15337 a15338 a15339 a15340 a15341 a15342 a15343 a15344 a15345 a15346 a15347 a15348 a15349 a15350 a15351 a15352 a15353 a15354 a15355 a15356 a15357 a15358 a15359 a15360 a15361 a15362 a15363 a15364 a15365 a15366 a15367 a15368 a15369 a15370 a15371 a15372 a15373 a15374 a15375 a15376 a15377 a15378 a15379 a15380 a15381 a15382 a15383 a15384 a15385 a15386 a15387 a15388 a15389 a15390 a15391 a15392 a15393 a15394 a15395 a15396 a15397 a15398 a15399 a15400 a15401 a15402 a15403 a15404 a15405 a15406 a15407 a15408 a15409 a15410 a15411 a15412 a15413 a15414 a15415 a15416 a15417 a15418 a15419 a15420 a15421 a15422 a15423 a15424 a15425 a15426 a15427 a15428 a15429 a15430 a15431 a15432 a15433 a15434 a15435 a15436 a15437 a15438 a15439 a15440 a15441 a15442 a15443 a15444 a15445 a15446 a15447 a15448 a15449 a15450 a15451 a15452 a15453 a15454 a15455 a15456 a15457 a15458 a15459 a15460 a15461 a15462 a15463 a15464 a15465 a15466 a15467 a15468 a15469 a15470 a15471 a15472 a15473 a15474 a15475 a15476 a15477 a15478 a15479 a15480 a15481 a15482 a15483 a15484 a15485 a15486 a15487 a15488 a15489 a15490 a15491 a15492 a15493 a15494 a15495 a15496 a15497 a15498 a15499 a15500 a15501 a15502 a15503 a15504 a15505 a15506 a15507 a15508 a15509 a15510 a15511 a15512 a15513 a15514 a15515 a15516 a15517 a15518 a15519 a15520 a15521 a15522 a15523 a15524 a15525 a15526 a15527 a15528 a15529 a15530 a15531 a15532 a15533 a15534 a15535 a15536 a15537 a15538 a15539 a15540 a15541 a15542 a15543 a15544 a15545 a15546 a15547 a15548 a15549 a15550 a15551 a15552 a15553 a15554 a15555 a15556 a15557 a15558 a15559 a15560 a15561 a15562 a15563 a15564 a15565 a15566 a15567 a15568 a15569 a15570 a15571 a15572 a15573 a15574 a15575 a15576 a15577 a15578 a15579 a15580 a15581 a15582 a15583 a15584 a15585 a15586 a15587 a15588 a15589 a15590 a15591 a15592 a15593 a15594 a15595 a15596 a15597 a15598 a15599 a15600 a15601 a15602 a15603 a15604 a15605 a15606 a15607 a15608 a15609 a15610 a15611 a15612 a15613 a15614 a15615 a15616 a15617 a15618 a15619 a15620 a15621 a15622 a15623 a15624 a15625 a15626 a15627 a15628 a15629 a15630 a15631 a15632 a15633 a15634 a15635 a15636 a15637 a15638 a15639 a15640 a15641 a15642 a15643 a15644 a15645 a15646 a15647 a15648 a15649 a15650 a15651 a15652 a15653 a15654 a15655 a15656 a15657 a15658 a15659 a15660 a15661 a15662 a15663 a15664 a15665 a15666 a15667 a15668 a15669 a15670 a15671 a15672 a15673 a15674 a15675 a15676 a15677 a15678 a15679 a15680 a15681 a15682 a15683 a15684 a15685 a15686 a15687 a15688 a15689 a15690 a15691 a15692 a15693 a15694 a15695 a15696 a15697 a15698 a15699 a15700 a15701 a15702 a15703 a15704 a15705 a15706 a15707 a15708 a15709 a15710 a15711 a15712 a15713 a15714 a15715 a15716 a15717 a15718 a15719 a15720 a15721 a15722 a15723 a15724 a15725 a15726 a15727 a15728 a15729 a15730 a15731 a15732 a15733 a15734 a15735 a15736 a15737 a15738 a15739 a15740 a15741 a15742 a15743 a15744 a15745 a15746 a15747 a15748 a15749 a15750 a15751 a15752 a15753 a15754 a15755 a15756 a15757 a15758 a15759 a15760 a15761 a15762 a15763 a15764 a15765 a15766 a15767 a15768 a15769 a15770 a15771 a15772 a15773 a15774 a15775 a15776 a15777 a15778 a15779 a15780 a15781 a15782 a15783 a15784 a15785 a15786 a15787 a15788 a15789 a15790 a15791 a15792 a15793 a15794 a15795 a15796 a15797 a15798 a15799 a15800 a15801 a15802 a15803 a15804 a15805 a15806 a15807 a15808 a15809 a15810 a15811 a15812 a15813 a15814 a15815 a15816 a15817 a15818 a15819 a15820 a15821 a15822 a15823 a15824 a15825 a15826 a15827 a15828 a15829 a15830 a15831 a15832 a15833 a15834 a15835 a15836 a15837 a15838 a15839 a15840 a15841 a15842 a15843 a15844 a15845 a15846 a15847 a15848 a15849 a15850 a15851 a15852 a15853 a15854 a15855 a15856 a15857 a15858 a15859 a15860 a15861 a15862 a15863 a15864 a15865 a15866 a15867 a15868 a15869 a15870 a15871 a15872 a15873 a15874 a15875 a15876 a15877 a15878 a15879 a15880 a15881 a15882 a15883 a15884 a15885 a15886 a15887 a15888 a15889 a15890 a15891 a15892 a15893 a15894 a15895 a15896 a15897 a15898 a15899 a15900 a15901 a15902 a15903 a15904 a15905 a15906 a15907 a15908 a15909 a15910 a15911 a15912 a15913 a15914 a15915 a15916 a15917 a15918 a15919 a15920 a15921 a15922 a15923 a15924 a15925 a15926 a15927 a15928 a15929 a15930 a15931 a15932 a15933 a15934 a15935 a15936 a15937 a15938 a15939 a15940 a15941 a15942 a15943 a15944 a15945 a15946 a15947 a15948 a15949 a15950 a15951 a15952 a15953 a15954 a15955 a15956 a15957 a15958 a15959 a15960 a15961 a15962 a15963 a15964 a15965 a15966 a15967 a15968 a15969 a15970 a15971 a15972 a15973 a15974 a15975 a15976 a15977 a15978 a15979 a15980 a15981 a15982 a15983 a15984 a15985 a15986 a15987 a15988 a15989 a15990 a15991 a15992 a15993 a15994 a15995 a15996 a15997 a15998 a15999 a16000 a16001 a16002 a16003 a16004 a16005 a16006 a16007 a16008 a16009 a16010 a16011 a16012 a16013 a16014 a16015 a16016 a16017 a16018 a16019 a16020 a16021 a16022 a16023 a16024 a16025 a16026 a16027 a16028 a16029 a16030 a16031 a16032 a16033 a16034 a16035 a16036 a16037 a16038 a16039 a16040 a16041 a16042 a16043 a16044 a16045 a16046 a16047 a16048 a16049 a16050 a16051 a16052 a16053 a16054 a16055 a16056 a16057 a16058 a16059 a16060 a16061 a16062 a16063 a16064 a16065 a16066 a16067 a16068 a16069 a16070 a16071 a16072 a16073 a16074 a16075 a16076 a16077 a16078 a16079 a16080 a16081 a16082 a16083 a16084 a16085 a16086 a16087 a16088 a16089 a16090 a16091 a16092 a16093 a16094 a16095 a16096 a16097 a16098 a16099 a16100 a16101 a16102 a16103 a16104 a16105 a16106 a16107 a16108 a16109 a16110 a16111 a16112 a16113 a16114 a16115 a16116 a16117 a16118 a16119 a16120 a16121 a16122 a16123 a16124 a16125 a16126 a16127 a16128 a16129 a16130 a16131 a16132 a16133 a16134 a16135 a16136 a16137 a16138 a16139 a16140 a16141 a16142 a16143 a16144 a16145 a16146 a16147 a16148 a16149 a16150 a16151 a16152 a16153 a16154 a16155 a16156 a16157 a16158 a16159 a16160 a16161 a16162 a16163 a16164 a16165 a16166 a16167 a16168 a16169 a16170 a16171 a16172 a16173 a16174 a16175 a16176 a16177 a16178 a16179 a16180 a16181 a16182 a16183 a16184 a16185 a16186 a16187 a16188 a16189 a16190 a16191 a16192 a16193 a16194 a16195 a16196 a16197 a16198 a16199 a16200 a16201 a16202 a16203 a16204 a16205 a16206 a16207 a16208 a16209 a16210 a16211 a16212 a16213 a16214 a16215 a16216 a16217 a16218 a16219 a16220 a16221 a16222 a16223 a16224 a16225 a16226 a16227 a16228 a16229 a16230 a16231 a16232 a16233 a16234 a16235 a16236 a16237 a16238 a16239 a16240 a16241 a16242 a16243 a16244 a16245 a16246 a16247 a16248 a16249 a16250 a16251 a16252 a16253 a16254 a16255 a16256 a16257 a16258 a16259 a16260 a16261 a16262 a16263 a16264 a16265 a16266 a16267 a16268 a16269 a16270 a16271 a16272 a16273 a16274 a16275 a16276 a16277 a16278 a16279 a16280 a16281 a16282 a16283 a16284 a16285 a16286 a16287 a16288 a16289 a16290 a16291 a16292 a16293 a16294 a16295 a16296 a16297 a16298 a16299 a16300 a16301 a16302 a16303 a16304 a16305 a16306 a16307 a16308 a16309 a16310 a16311 a16312 a16313 a16314 a16315 a16316 a16317 a16318 a16319 a16320 a16321 a16322 a16323 a16324 a16325 a16326 a16327 a16328 a16329 a16330 a16331 a16332 a16333 a16334 a16335 a16336 a16337 a16338 a16339 a16340 a16341 a16342 a16343 a16344 a16345 a16346 a16347 a16348 a16349 a16350 a16351 a16352 a16353 a16354 a16355 a16356 a16357 a16358 a16359 a16360 a16361 a16362 a16363 a16364 a16365 a16366 a16367 a16368 a16369 a16370 a16371 a16372 a16373 a16374 a16375 a16376 a16377 a16378 a16379 a16380 a16381 a16382 a16383 a16384 a16385 a16386 a16387 a16388 a16389 a16390 a16391 a16392 a16393 a16394 a16395 a16396 a16397 a16398 a16399 a16400 a16401 a16402 a16403 a16404 a16405 a16406 a16407 a16408 a16409 a16410 a16411 a16412 a16413 a16414 a16415 a16416 a16417 a16418 a16419 a16420 a16421 a16422 a16423 a16424 a16425 a16426 a16427 a16428 a16429 a16430 a16431 a16432 a16433 a16434 a16435 a16436 a16437 a16438 a16439 a16440 a16441 a16442 a16443 a16444 a16445 a16446 a16447 a16448 a16449 a16450 a16451 a16452 a16453 a16454 a16455 a16456 a16457 a16458 a16459 a16460 a16461 a16462 a16463 a16464 a16465 a16466 a16467 a16468 a16469 a16470 a16471 a16472 a16473 a16474 a16475 a16476 a16477 a16478 a16479 a16480 a16481 a16482 a16483 a16484 a16485 a16486 a16487 a16488 a16489 a16490 a16491 a16492 a16493 a16494 a16495 a16496 a16497 a16498 a16499 a16500 a16501 a16502 a16503 a16504 a16505 a16506 a16507 a16508 a16509 a16510 a16511 a16512 a16513 a16514 a16515 a16516 a16517 a16518 a16519 a16520 a16521 a16522 a16523 a16524 a16525 a16526 a16527 a16528 a16529 a16530 a16531 a16532 a16533 a16534 a16535 a16536 a16537 a16538 a16539 a16540 a16541 a16542 a16543 a16544 a16545 a16546 a16547 a16548 a16549 a16550 a16551 a16552 a16553 a16554 a16555 a16556 a16557 a16558 a16559 a16560 a16561 a16562 a16563 a16564 a16565 a16566 a16567 a16568 a16569 a16570 a16571 a16572 a16573 a16574 a16575 a16576 a16577 a16578 a16579 a16580 a16581 a16582 a16583 a16584 a16585 a16586 a16587 a16588 a16589 a16590 a16591 a16592 a16593 a16594 a16595 a16596 a16597 a16598 a16599 a16600 a16601 a16602 a16603 a16604 a16605 a16606 a16607 a16608 a16609 a16610 a16611 a16612 a16613 a16614 a16615 a16616 a16617 a16618 a16619 a16620 a16621 a16622 a16623 a16624 a16625 a16626 a16627 a16628 a16629 a16630 a16631 a16632 a16633 a16634 a16635 a16636 a16637 a16638 a16639 a16640 a16641 a16642 a16643 a16644 a16645 a16646 a16647 a16648 a16649 a16650 a16651 a16652 a16653 a16654 a16655 a16656 a16657 a16658 a16659 a16660 a16661 a16662 a16663 a16664 a16665 a16666 a16667 a16668 a16669 a16670 a16671 a16672 a16673 a16674 a16675 a16676 a16677 a16678 a16679 a16680 a16681 a16682 a16683 a16684 a16685 a16686 a16687 a16688 a16689 a16690 a16691 a16692 a16693 a16694 a16695 a16696 a16697 a16698 a16699 a16700 a16701 a16702 a16703 a16704 a16705 a16706 a16707 a16708 a16709 a16710 a16711 a16712 a16713 a16714 a16715 a16716 a16717 a16718 a16719 a16720 a16721 a16722 a16723 a16724 a16725 a16726 a16727 a16728 a16729 a16730 a16731 a16732 a16733 a16734 a16735 a16736 a16737 a16738 a16739 a16740 a16741 a16742 a16743 a16744 a16745 a16746 a16747 a16748 a16749 a16750 a16751 a16752 a16753 a16754 a16755 a16756 a16757 a16758 a16759 a16760 a16761 a16762 a16763 a16764 a16765 a16766 a16767 a16768 a16769 a16770 a16771 a16772 a16773 a16774 a16775 a16776 a16777 a16778 a16779 a16780 a16781 a16782 a16783 a16784 a16785 a16786 a16787 a16788 a16789 a16790 a16791 a16792 a16793 a16794 a16795 a16796 a16797 a16798 a16799 a16800 a16801 a16802 a16803 a16804 a16805 a16806 a16807 a16808 a16809 a16810 a16811 a16812 a16813 a16814 a16815 a16816 a16817 a16818 a16819 a16820 a16821 a16822 a16823 a16824 a16825 a16826 a16827 a16828 a16829 a16830 a16831 a16832 a16833 a16834 a16835 a16836 a16837 a16838 a16839 a16840 a16841 a16842 a16843 a16844 a16845 a16846 a16847 a16848 a16849 a16850 a16851 a16852 a16853 a16854 a16855 a16856 a16857 a16858 a16859 a16860 a16861 a16862 a16863 a16864 a16865 a16866 a16867 a16868 a16869 a16870 a16871 a16872 a16873 a16874 a16875 a16876 a16877 a16878 a16879 a16880 a16881 a16882 a16883 a16884 a16885 a16886 a16887 a16888 a16889 a16890 a16891 a16892 a16893 a16894 a16895 a16896 a16897 a16898 a16899 a16900 a16901 a16902 a16903 a16904 a16905 a16906 a16907 a16908 a16909 a16910 a16911 a16912 a16913 a16914 a16915 a16916 a16917 a16918 a16919 a16920 a16921 a16922 a16923 a16924 a16925 a16926 a16927 a16928 a16929 a16930 a16931 a16932 a16933 a16934 a16935 a16936 a16937 a16938 a16939 a16940 a16941 a16942 a16943 a16944 a16945 a16946 a16947 a16948 a16949 a16950 a16951 a16952 a16953 a16954 a16955 a16956 a16957 a16958 a16959 a16960 a16961 a16962 a16963 a16964 a16965 a16966 a16967 a16968 a16969 a16970 a16971 a16972 a16973 a16974 a16975 a16976 a16977 a16978 a16979 a16980 a16981 a16982 a16983 a16984 a16985 a16986 a16987 a16988 a16989 a16990 a16991 a16992 a16993 a16994 a16995 a16996 a16997 a16998 a16999 a17000 a17001 a17002 a17003 a17004 a17005 a17006 a17007 a17008 a17009 a17010 a17011 a17012 a17013 a17014 a17015 a17016 a17017 a17018 a17019 a17020 a17021 a17022 a17023 a17024 a17025 a17026 a17027 a17028 a17029 a17030 a17031 a17032 a17033 a17034 a17035 a17036 a17037 a17038 a17039 a17040 a17041 a17042 a17043 a17044 a17045 a17046 a17047 a17048 a17049 a17050 a17051 a17052 a17053 a17054 a17055 a17056 a17057 a17058 a17059 a17060 a17061 a17062 a17063 a17064 a17065 a17066 a17067 a17068 a17069 a17070 a17071 a17072 a17073 a17074 a17075 a17076 a17077 a17078 a17079 a17080 a17081 a17082 a17083 a17084 a17085 a17086 a17087 a17088 a17089 a17090 a17091 a17092 a17093 a17094 a17095 a17096 a17097 a17098 a17099 a17100 a17101 a17102 a17103 a17104 a17105 a17106 a17107 a17108 a17109 a17110 a17111 a17112 a17113 a17114 a17115 a17116 a17117 a17118 a17119 a17120 a17121 a17122 a17123 a17124 a17125 a17126 a17127 a17128 a17129 a17130 a17131 a17132 a17133 a17134 a17135 a17136 a17137 a17138 a17139 a17140 a17141 a17142 a17143 a17144 a17145 a17146 a17147 a17148 a17149 a17150 a17151 a17152 a17153 a17154 a17155 a17156 a17157 a17158 a17159 a17160 a17161 a17162 a17163 a17164 a17165 a17166 a17167 a17168 a17169 a17170 a17171 a17172 a17173 a17174 a17175 a17176 a17177 a17178 a17179 a17180 a17181 a17182 a17183 a17184 a17185 a17186 a17187 a17188 a17189 a17190 a17191 a17192 a17193 a17194 a17195 a17196 a17197 a17198 a17199 a17200 a17201 a17202 a17203 a17204 a17205 a17206 a17207 a17208 a17209 a17210 a17211 a17212 a17213 a17214 a17215 a17216 a17217 a17218 a17219 a17220 a17221 a17222 a17223 a17224 a17225 a17226 a17227 a17228 a17229 a17230 a17231 a17232 a17233 a17234 a17235 a17236 a17237 a17238 a17239 a17240 a17241 a17242 a17243 a17244 a17245 a17246 a17247 a17248 a17249 a17250 a17251 a17252 a17253 a17254 a17255 a17256 a17257 a17258 a17259 a17260 a17261 a17262 a17263 a17264 a17265 a17266 a17267 a17268 a17269 a17270 a17271 a17272 a17273 a17274 a17275 a17276 a17277 a17278 a17279 a17280 a17281 a17282 a17283 a17284 a17285 a17286 a17287 a17288 a17289 a17290 a17291 a17292 a17293 a17294 a17295 a17296 a17297 a17298 a17299 a17300 a17301 a17302 a17303 a17304 a17305 a17306 a17307 a17308 a17309 a17310 a17311 a17312 a17313 a17314 a17315 a17316 a17317 a17318 a17319 a17320 a17321 a17322 a17323 a17324 a17325 a17326 a17327 a17328 a17329 a17330 a17331 a17332 a17333 a17334 a17335 a17336 a17337 a17338 a17339 a17340 a17341 a17342 a17343 a17344 a17345 a17346 a17347 a17348 a17349 a17350 a17351 a17352 a17353 a17354 a17355 a17356 a17357 a17358 a17359 a17360 a17361 a17362 a17363 a17364 a17365 a17366 a17367 a17368 a17369 a17370 a17371 a17372 a17373 a17374 a17375 a17376 a17377 a17378 a17379 a17380 a17381 a17382 a17383 a17384 a17385 a17386 a17387 a17388 a17389 a17390 a17391 a17392 a17393 a17394 a17395 a17396 a17397 a17398 a17399 a17400 a17401 a17402 a17403 a17404 a17405 a17406 a17407 a17408 a17409 a17410 a17411 a17412 a17413 a17414 a17415 a17416 a17417 a17418 a17419 a17420 a17421 a17422 a17423 a17424 a17425 a17426 a17427 a17428 a17429 a17430 a17431 a17432 a17433 a17434 a17435 a17436 a17437 a17438 a17439 a17440 a17441 a17442 a17443 a17444 a17445 a17446 a17447 a17448 a17449 a17450 a17451 a17452 a17453 a17454 a17455 a17456 a17457 a17458 a17459 a17460 a17461 a17462 a17463 a17464 a17465 a17466 a17467 a17468 a17469 a17470 a17471 a17472 a17473 a17474 a17475 a17476 a17477 a17478 a17479 a17480 a17481 a17482 a17483 a17484 a17485 a17486 a17487 a17488 a17489 a17490 a17491 a17492 a17493 a17494 a17495 a17496 a17497 a17498 a17499 a17500 a17501 a17502 a17503 a17504 a17505 a17506 a17507 a17508 a17509 a17510 a17511 a17512 a17513 a17514 a17515 a17516 a17517 a17518 a17519 a17520 a17521 a17522 a17523 a17524 a17525 a17526 a17527 a17528 a17529 a17530 a17531 a17532 a17533 a17534 a17535 a17536 a17537 a17538 a17539 a17540 a17541 a17542 a17543 a17544 a17545 a17546 a17547 a17548 a17549 a17550 a17551 a17552 a17553 a17554 a17555 a17556 a17557 a17558 a17559 a17560 a17561 a17562 a17563 a17564 a17565 a17566 a17567 a17568 a17569 a17570 a17571 a17572 a17573 a17574 a17575 a17576 a17577 a17578 a17579 a17580 a17581 a17582 a17583 a17584 a17585 a17586 a17587 a17588 a17589 a17590 a17591 a17592 a17593 a17594 a17595 a17596 a17597 a17598 a17599 a17600 a17601 a17602 a17603 a17604 a17605 a17606 a17607 a17608 a17609 a17610 a17611 a17612 a17613 a17614 a17615 a17616 a17617 a17618 a17619 a17620 a17621 a17622 a17623 a17624 a17625 a17626 a17627 a17628 a17629 a17630 a17631 a17632 a17633 a17634 a17635 a17636 a17637 a17638 a17639 a17640 a17641 a17642 a17643 a17644 a17645 a17646 a17647 a17648 a17649 a17650 a17651 a17652 a17653 a17654 a17655 a17656 a17657 a17658 a17659 a17660 a17661 a17662 a17663 a17664 a17665 a17666 a17667 a17668 a17669 a17670 a17671 a17672 a17673 a17674 a17675 a17676 a17677 a17678 a17679 a17680 a17681 a17682 a17683 a17684 a17685 a17686 a17687 a17688 a17689 a17690 a17691 a17692 a17693 a17694 a17695 a17696 a17697 a17698 a17699 a17700 a17701 a17702 a17703 a17704 a17705 a17706 a17707 a17708 a17709 a17710 a17711 a17712 a17713 a17714 a17715 a17716 a17717 a17718 a17719 a17720 a17721 a17722 a17723 a17724 a17725 a17726 a17727 a17728 a17729 a17730 a17731 a17732 a17733 a17734 a17735 a17736 a17737 a17738 a17739 a17740 a17741 a17742 a17743 a17744 a17745 a17746 a17747 a17748 a17749 a17750 a17751 a17752 a17753 a17754 a17755 a17756 a17757 a17758 a17759 a17760 a17761 a17762 a17763 a17764 a17765 a17766 a17767 a17768 a17769 a17770 a17771 a17772 a17773 a17774 a17775 a17776 a17777 a17778 a17779 a17780 a17781 a17782 a17783 a17784 a17785 a17786 a17787 a17788 a17789 a17790 a17791 a17792 a17793 a17794 a17795 a17796 a17797 a17798 a17799 a17800 a17801 a17802 a17803 a17804 a17805 a17806 a17807 a17808 a17809 a17810 a17811 a17812 a17813 a17814 a17815 a17816 a17817 a17818 a17819 a17820 a17821 a17822 a17823 a17824 a17825 a17826 a17827 a17828 a17829 a17830 a17831 a17832 a17833 a17834 a17835 a17836 a17837 a17838 a17839 a17840 a17841 a17842 a17843 a17844 a17845 a17846 a17847 a17848 a17849 a17850 a17851 a17852 a17853 a17854 a17855 a17856 a17857 a17858 a17859 a17860 a17861 a17862 a17863 a17864 a17865 a17866 a17867 a17868 a17869 a17870 a17871 a17872 a17873 a17874 a17875 a17876 a17877 a17878 a17879 a17880 a17881 a17882 a17883 a17884 a17885 a17886 a17887 a17888 a17889 a17890 a17891 a17892 a17893 a17894 a17895 a17896 a17897 a17898 a17899 a17900 a17901 a17902 a17903 a17904 a17905 a17906 a17907 a17908 a17909 a17910 a17911 a17912 a17913 a17914 a17915 a17916 a17917 a17918 a17919 a17920 a17921 a17922 a17923 a17924 a17925 a17926 a17927 a17928 a17929 a17930 a17931 a17932 a17933 a17934 a17935 a17936 a17937 a17938 a17939 a17940 a17941 a17942 a17943 a17944 a17945 a17946 a17947 a17948 a17949 a17950 a17951 a17952 a17953 a17954 a17955 a17956 a17957 a17958 a17959 a17960 a17961 a17962 a17963 a17964 a17965 a17966 a17967 a17968 a17969 a17970 a17971 a17972 a17973 a17974 a17975 a17976 a17977 a17978 a17979 a17980 a17981 a17982 a17983 a17984 a17985 a17986 a17987 a17988 a17989 a17990 a17991 a17992 a17993 a17994 a17995 a17996 a17997 a17998 a17999 a18000 a18001 a18002 a18003 a18004 a18005 a18006 a18007 a18008 a18009 a18010 a18011 a18012 a18013 a18014 a18015 a18016 a18017 a18018 a18019 a18020 a18021 a18022 a18023 a18024 a18025 a18026 a18027 a18028 a18029 a18030 a18031 a18032 a18033 a18034 a18035 a18036 a18037 a18038 a18039 a18040 a18041 a18042 a18043 a18044 a18045 a18046 a18047 a18048 a18049 a18050 a18051 a18052 a18053 a18054 a18055 a18056 a18057 a18058 a18059 a18060 a18061 a18062 a18063 a18064 a18065 a18066 a18067 a18068 a18069 a18070 a18071 a18072 a18073 a18074 a18075 a18076 a18077 a18078 a18079 a18080 a18081 a18082 a18083 a18084 a18085 a18086 a18087 a18088 a18089 a18090 a18091 a18092 a18093 a18094 a18095 a18096 a18097 a18098 a18099 a18100 a18101 a18102 a18103 a18104 a18105 a18106 a18107 a18108 a18109 a18110 a18111 a18112 a18113 a18114 a18115 a18116 a18117 a18118 a18119 a18120 a18121 a18122 a18123 a18124 a18125 a18126 a18127 a18128 a18129 a18130 a18131 a18132 a18133 a18134 a18135 a18136 a18137 a18138 a18139 a18140 a18141 a18142 a18143 a18144 a18145 a18146 a18147 a18148 a18149 a18150 a18151 a18152 a18153 a18154 a18155 a18156 a18157 a18158 a18159 a18160 a18161 a18162 a18163 a18164 a18165 a18166 a18167 a18168 a18169 a18170 a18171 a18172 a18173 a18174 a18175 a18176 a18177 a18178 a18179 a18180 a18181 a18182 a18183 a18184 a18185 a18186 a18187 a18188 a18189 a18190 a18191 a18192 a18193 a18194 a18195 a18196 a18197 a18198 a18199 a18200 a18201 a18202 a18203 a18204 a18205 a18206 a18207 a18208 a18209 a18210 a18211 a18212 a18213 a18214 a18215 a18216 a18217 a18218 a18219 a18220 a18221 a18222 a18223 a18224 a18225 a18226 a18227 a18228 a18229 a18230 a18231 a18232 a18233 a18234 a18235 a18236 a18237 a18238 a18239 a18240 a18241 a18242 a18243 a18244 a18245 a18246 a18247 a18248 a18249 a18250 a18251 a18252 a18253 a18254 a18255 a18256 a18257 a18258 a18259 a18260 a18261 a18262 a18263 a18264 a18265 a18266 a18267 a18268 a18269 a18270 a18271 a18272 a18273 a18274 a18275 a18276 a18277 a18278 a18279 a18280 a18281 a18282 a18283 a18284 a18285 a18286 a18287 a18288 a18289 a18290 a18291 a18292 a18293 a18294 a18295 a18296 a18297 a18298 a18299 a18300 a18301 a18302 a18303 a18304 a18305 a18306 a18307 a18308 a18309 a18310 a18311 a18312 a18313 a18314 a18315 a18316 a18317 a18318 a18319 a18320 a18321 a18322 a18323 a18324 a18325 a18326 a18327 a18328 a18329 a18330 a18331 a18332 a18333 a18334 a18335 a18336 a18337 a18338 a18339 a18340 a18341 a18342 a18343 a18344 a18345 a18346 a18347 a18348 a18349 a18350 a18351 a18352 a18353 a18354 a18355 a18356 a18357 a18358 a18359 a18360 a18361 a18362 a18363 a18364 a18365 a18366 a18367 a18368 a18369 a18370 a18371 a18372 a18373 a18374 a18375 a18376 a18377 a18378 a18379 a18380 a18381 a18382 a18383 a18384 a18385 a18386 a18387 a18388 a18389 a18390 a18391 a18392 a18393 a18394 a18395 a18396 a18397 a18398 a18399 a18400 a18401 a18402 a18403 a18404 a18405 a18406 a18407 a18408 a18409 a18410 a18411 a18412 a18413 a18414 a18415 a18416 a18417 a18418 a18419 a18420 a18421 a18422 a18423 a18424 a18425 a18426 a18427 a18428 a18429 a18430 a18431 a18432 a18433 a18434 a18435 a18436 a18437 a18438 a18439 a18440 a18441 a18442 a18443 a18444 a18445 a18446 a18447 a18448 a18449 a18450 a18451 a18452 a18453 a18454 a18455 a18456 a18457 a18458 a18459 a18460 a18461 a18462 a18463 a18464 a18465 a18466 a18467 a18468 a18469 a18470 a18471 a18472 a18473 a18474 a18475 a18476 a18477 a18478 a18479 a18480 a18481 a18482 a18483 a18484 a18485 a18486 a18487 a18488 a18489 a18490 a18491 a18492 a18493 a18494 a18495 a18496 a18497 a18498 a18499 a18500 a18501 a18502 a18503 a18504 a18505 a18506 a18507 a18508 a18509 a18510 a18511 a18512 a18513 a18514 a18515 a18516 a18517 a18518 a18519 a18520 a18521 a18522 a18523 a18524 a18525 a18526 a18527 a18528 a18529 a18530 a18531 a18532 a18533 a18534 a18535 a18536 a18537 a18538 a18539 a18540 a18541 a18542 a18543 a18544 a18545 a18546 a18547 a18548 a18549 a18550 a18551 a18552 a18553 a18554 a18555 a18556 a18557 a18558 a18559 a18560 a18561 a18562 a18563 a18564 a18565 a18566 a18567 a18568 a18569 a18570 a18571 a18572 a18573 a18574 a18575 a18576 a18577 a18578 a18579 a18580 a18581 a18582 a18583 a18584 a18585 a18586 a18587 a18588 a18589 a18590 a18591 a18592 a18593 a18594 a18595 a18596 a18597 a18598 a18599 a18600 a18601 a18602 a18603 a18604 a18605 a18606 a18607 a18608 a18609 a18610 a18611 a18612 a18613 a18614 a18615 a18616 a18617 a18618 a18619 a18620 a18621 a18622 a18623 a18624 a18625 a18626 a18627 a18628 a18629 a18630 a18631 a18632 a18633 a18634 a18635 a18636 a18637 a18638 a18639 a18640 a18641 a18642 a18643 a18644 a18645 a18646 a18647 a18648 a18649 a18650 a18651 a18652 a18653 a18654 a18655 a18656 a18657 a18658 a18659 a18660 a18661 a18662 a18663 a18664 a18665 a18666 a18667 a18668 a18669 a18670 a18671 a18672 a18673 a18674 a18675 a18676 a18677 a18678 a18679 a18680 a18681 a18682 a18683 a18684 a18685 a18686 a18687 a18688 a18689 a18690 a18691 a18692 a18693 a18694 a18695 a18696 a18697 a18698 a18699 a18700 a18701 a18702 a18703 a18704 a18705 a18706 a18707 a18708 a18709 a18710 a18711 a18712 a18713 a18714 a18715 a18716 a18717 a18718 a18719 a18720 a18721 a18722 a18723 a18724 a18725 a18726 a18727 a18728 a18729 a18730 a18731 a18732 a18733 a18734 a18735 a18736 a18737 a18738 a18739 a18740 a18741 a18742 a18743 a18744 a18745 a18746 a18747 a18748 a18749 a18750 a18751 a18752 a18753 a18754 a18755 a18756 a18757 a18758 a18759 a18760 a18761 a18762 a18763 a18764 a18765 a18766 a18767 a18768 a18769 a18770 a18771 a18772 a18773 a18774 a18775 a18776 a18777 a18778 a18779 a18780 a18781 a18782 a18783 a18784 a18785 a18786 a18787 a18788 a18789 a18790 a18791 a18792 a18793 a18794 a18795 a18796 a18797 a18798 a18799 a18800 a18801 a18802 a18803 a18804 a18805 a18806 a18807 a18808 a18809 a18810 a18811 a18812 a18813 a18814 a18815 a18816 a18817 a18818 a18819 a18820 a18821 a18822 a18823 a18824 a18825 a18826 a18827 a18828 a18829 a18830 a18831 a18832 a18833 a18834 a18835 a18836 a18837 a18838 a18839 a18840 a18841 a18842 a18843 a18844 a18845 a18846 a18847 a18848 a18849 a18850 a18851 a18852 a18853 a18854 a18855 a18856 a18857 a18858 a18859 a18860 a18861 a18862 a18863 a18864 a18865 a18866 a18867 a18868 a18869 a18870 a18871 a18872 a18873 a18874 a18875 a18876 a18877 a18878 a18879 a18880 a18881 a18882 a18883 a18884 a18885 a18886 a18887 a18888 a18889 a18890 a18891 a18892 a18893 a18894 a18895 a18896 a18897 a18898 a18899 a18900 a18901 a18902 a18903 a18904 a18905 a18906 a18907 a18908 a18909 a18910 a18911 a18912 a18913 a18914 a18915 a18916 a18917 a18918 a18919 a18920 a18921 a18922 a18923 a18924 a18925 a18926 a18927 a18928 a18929 a18930 a18931 a18932 a18933 a18934 a18935 a18936 a18937 a18938 a18939 a18940 a18941 a18942 a18943 a18944 a18945 a18946 a18947 a18948 a18949 a18950 a18951 a18952 a18953 a18954 a18955 a18956 a18957 a18958 a18959 a18960 a18961 a18962 a18963 a18964 a18965 a18966 a18967 a18968 a18969 a18970 a18971 a18972 a18973 a18974 a18975 a18976 a18977 a18978 a18979 a18980 a18981 a18982 a18983 a18984 a18985 a18986 a18987 a18988 a18989 a18990 a18991 a18992 a18993 a18994 a18995 a18996 a18997 a18998 a18999 a19000 a19001 a19002 a19003 a19004 a19005 a19006 a19007 a19008 a19009 a19010 a19011 a19012 a19013 a19014 a19015 a19016 a19017 a19018 a19019 a19020 a19021 a19022 a19023 a19024 a19025 a19026 a19027 a19028 a19029 a19030 a19031 a19032 a19033 a19034 a19035 a19036 a19037 a19038 a19039 a19040 a19041 a19042 a19043 a19044 a19045 a19046 a19047 a19048 a19049 a19050 a19051 a19052 a19053 a19054 a19055 a19056 a19057 a19058 a19059 a19060 a19061 a19062 a19063 a19064 a19065 a19066 a19067 a19068 a19069 a19070 a19071 a19072 a19073 a19074 a19075 a19076 a19077 a19078 a19079 a19080 a19081 a19082 a19083 a19084 a19085 a19086 a19087 a19088 a19089 a19090 a19091 a19092 a19093 a19094 a19095 a19096 a19097 a19098 a19099 a19100 a19101 a19102 a19103 a19104 a19105 a19106 a19107 a19108 a19109 a19110 a19111 a19112 a19113 a19114 a19115 a19116 a19117 a19118 a19119 a19120 a19121 a19122 a19123 a19124 a19125 a19126 a19127 a19128 a19129 a19130 a19131 a19132 a19133 a19134 a19135 a19136 a19137 a19138 a19139 a19140 a19141 a19142 a19143 a19144 a19145 a19146 a19147 a19148 a19149 a19150 a19151 a19152 a19153 a19154 a19155 a19156 a19157 a19158 a19159 a19160 a19161 a19162 a19163 a19164 a19165 a19166 a19167 a19168 a19169 a19170 a19171 a19172 a19173 a19174 a19175 a19176 a19177 a19178 a19179 a19180 a19181 a19182 a19183 a19184 a19185 a19186 a19187 a19188 a19189 a19190 a19191 a19192 a19193 a19194 a19195 a19196 a19197 a19198 a19199 a19200 a19201 a19202 a19203 a19204 a19205 a19206 a19207 a19208 a19209 a19210 a19211 a19212 a19213 a19214 a19215 a19216 a19217 a19218 a19219 a19220 a19221 a19222 a19223 a19224 a19225 a19226 a19227 a19228 a19229 a19230 a19231 a19232 a19233 a19234 a19235 a19236 a19237 a19238 a19239 a19240 a19241 a19242 a19243 a19244 a19245 a19246 a19247 a19248 a19249 a19250 a19251 a19252 a19253 a19254 a19255 a19256 a19257 a19258 a19259 a19260 a19261 a19262 a19263 a19264 a19265 a19266 a19267 a19268 a19269 a19270 a19271 a19272 a19273 a19274 a19275 a19276 a19277 a19278 a19279 a19280 a19281 a19282 a19283 a19284 a19285 a19286 a19287 a19288 a19289 a19290 a19291 a19292 a19293 a19294 a19295 a19296 a19297 a19298 a19299 a19300 a19301 a19302 a19303 a19304 a19305 a19306 a19307 a19308 a19309 a19310 a19311 a19312 a19313 a19314 a19315 a19316 a19317 a19318 a19319 a19320 a19321 a19322 a19323 a19324 a19325 a19326 a19327 a19328 a19329 a19330 a19331 a19332 a19333 a19334 a19335 a19336 a19337 a19338 a19339 a19340 a19341 a19342 a19343 a19344 a19345 a19346 a19347 a19348 a19349 a19350 a19351 a19352 a19353 a19354 a19355 a19356 a19357 a19358 a19359 a19360 a19361 a19362 a19363 a19364 a19365 a19366 a19367 a19368 a19369 a19370 a19371 a19372 a19373 a19374 a19375 a19376 a19377 a19378 a19379 a19380 a19381 a19382 a19383 a19384 a19385 a19386 a19387 a19388 a19389 a19390 a19391 a19392 a19393 a19394 a19395 a19396 a19397 a19398 a19399 a19400 a19401 a19402 a19403 a19404 a19405 a19406 a19407 a19408 a19409 a19410 a19411 a19412 a19413 a19414 a19415 a19416 a19417 a19418 a19419 a19420 a19421 a19422 a19423 a19424 a19425 a19426 a19427 a19428 a19429 a19430 a19431 a19432 a19433 a19434 a19435 a19436 a19437 a19438 a19439 a19440 a19441 a19442 a19443 a19444 a19445 a19446 a19447 a19448 a19449 a19450 a19451 a19452 a19453 a19454 a19455 a19456 a19457 a19458 a19459 a19460 a19461 a19462 a19463 a19464 a19465 a19466 a19467 a19468 a19469 a19470 a19471 a19472 a19473 a19474 a19475 a19476 a19477 a19478 a19479 a19480 a19481 a19482 a19483 a19484 a19485 a19486 a19487 a19488 a19489 a19490 a19491 a19492 a19493 a19494 a19495 a19496 a19497 a19498 a19499 a19500 a19501 a19502 a19503 a19504 a19505 a19506 a19507 a19508 a19509 a19510 a19511 a19512 a19513 a19514 a19515 a19516 a19517 a19518 a19519 a19520 a19521 a19522 a19523 a19524 a19525 a19526 a19527 a19528 a19529 a19530 a19531 a19532 a19533 a19534 a19535 a19536 a19537 a19538 a19539 a19540 a19541 a19542 a19543 a19544 a19545 a19546 a19547 a19548 a19549 a19550 a19551 a19552 a19553 a19554 a19555 a19556 a19557 a19558 a19559 a19560 a19561 a19562 a19563 a19564 a19565 a19566 a19567 a19568 a19569 a19570 a19571 a19572 a19573 a19574 a19575 a19576 a19577 a19578 a19579 a19580 a19581 a19582 a19583 a19584 a19585 a19586 a19587 a19588 a19589 a19590 a19591 a19592 a19593 a19594 a19595 a19596 a19597 a19598 a19599 a19600 a19601 a19602 a19603 a19604 a19605 a19606 a19607 a19608 a19609 a19610 a19611 a19612 a19613 a19614 a19615 a19616 a19617 a19618 a19619 a19620 a19621 a19622 a19623 a19624 a19625 a19626 a19627 a19628 a19629 a19630 a19631 a19632 a19633 a19634 a19635 a19636 a19637 a19638 a19639 a19640 a19641 a19642 a19643 a19644 a19645 a19646 a19647 a19648 a19649 a19650 a19651 a19652 a19653 a19654 a19655 a19656 a19657 a19658 a19659 a19660 a19661 a19662 a19663 a19664 a19665 a19666 a19667 a19668 a19669 a19670 a19671 a19672 a19673 a19674 a19675 a19676 a19677 a19678 a19679 a19680 a19681 a19682 a19683 a19684 a19685 a19686 a19687 a19688 a19689 a19690 a19691 a19692 a19693 a19694 a19695 a19696 a19697 a19698 a19699 a19700 a19701 a19702 a19703 a19704 a19705 a19706 a19707 a19708 a19709 a19710 a19711 a19712 a19713 a19714 a19715 a19716 a19717 a19718 a19719 a19720 a19721 a19722 a19723 a19724 a19725 a19726 a19727 a19728 a19729 a19730 a19731 a19732 a19733 a19734 a19735 a19736 a19737 a19738 a19739 a19740 a19741 a19742 a19743 a19744 a19745 a19746 a19747 a19748 a19749 a19750 a19751 a19752 a19753 a19754 a19755 a19756 a19757 a19758 a19759 a19760 a19761 a19762 a19763 a19764 a19765 a19766 a19767 a19768 a19769 a19770 a19771 a19772 a19773 a19774 a19775 a19776 a19777 a19778 a19779 a19780 a19781 a19782 a19783 a19784 a19785 a19786 a19787 a19788 a19789 a19790 a19791 a19792 a19793 a19794 a19795 a19796 a19797 a19798 a19799 a19800 a19801 a19802 a19803 a19804 a19805 a19806 a19807 a19808 a19809 a19810 a19811 a19812 a19813 a19814 a19815 a19816 a19817 a19818 a19819 a19820 a19821 a19822 a19823 a19824 a19825 a19826 a19827 a19828 a19829 a19830 a19831 a19832 a19833 a19834 a19835 a19836 a19837 a19838 a19839 a19840 a19841 a19842 a19843 a19844 a19845 a19846 a19847 a19848 a19849 a19850 a19851 a19852 a19853 a19854 a19855 a19856 a19857 a19858 a19859 a19860 a19861 a19862 a19863 a19864 a19865 a19866 a19867 a19868 a19869 a19870 a19871 a19872 a19873 a19874 a19875 a19876 a19877 a19878 a19879 a19880 a19881 a19882 a19883 a19884 a19885 a19886 a19887 a19888 a19889 a19890 a19891 a19892 a19893 a19894 a19895 a19896 a19897 a19898 a19899 a19900 a19901 a19902 a19903 a19904 a19905 a19906 a19907 a19908 a19909 a19910 a19911 a19912 a19913 a19914 a19915 a19916 a19917 a19918 a19919 a19920 a19921 a19922 a19923 a19924 a19925 a19926 a19927 a19928 a19929 a19930 a19931 a19932 a19933 a19934 a19935 a19936 a19937 a19938 a19939 a19940 a19941 a19942 a19943 a19944 a19945 a19946 a19947 a19948 a19949 a19950 a19951 a19952 a19953 a19954 a19955 a19956 a19957 a19958 a19959 a19960 a19961 a19962 a19963 a19964 a19965 a19966 a19967 a19968 a19969 a19970 a19971 a19972 a19973 a19974 a19975 a19976 a19977 a19978 a19979 a19980 a19981 a19982 a19983 a19984 a19985 a19986 a19987 a19988 a19989 a19990 a19991 a19992 a19993 a19994 a19995 a19996 a19997 a19998 a19999 a20000 a20001 a20002 a20003 a20004 a20005 a20006 a20007 a20008 a20009 a20010 a20011 a20012 a20013 a20014 a20015 a20016 a20017 a20018 a20019 a20020 a20021 a20022 a20023 a20024 a20025 a20026 a20027 a20028 a20029 a20030 a20031 a20032 a20033 a20034 a20035 a20036 a20037 a20038 a20039 a20040 a20041 a20042 a20043 a20044 a20045 a20046 a20047 a20048 a20049 a20050 a20051 a20052 a20053 a20054 a20055 a20056 a20057 a20058 a20059 a20060 a20061 a20062 a20063 a20064 a20065 a20066 a20067 a20068 a20069 a20070 a20071 a20072 a20073 a20074 a20075 a20076 a20077 a20078 a20079 a20080 a20081 a20082 a20083 a20084 a20085 a20086 a20087 a20088 a20089 a20090 a20091 a20092 a20093 a20094 a20095 a20096 a20097 a20098 a20099 a20100 a20101 a20102 a20103 a20104 a20105 a20106 a20107 a20108 a20109 a20110 a20111 a20112 a20113 a20114 a20115 a20116 a20117 a20118 a20119 a20120 a20121 a20122 a20123 a20124 a20125 a20126 a20127 a20128 a20129 a20130 a20131 a20132 a20133 a20134 a20135 a20136 a20137 a20138 a20139 a20140 a20141 a20142 a20143 a20144 a20145 a20146 a20147 a20148 a20149 a20150 a20151 a20152 a20153 a20154 a20155 a20156 a20157 a20158 a20159 a20160 a20161 a20162 a20163 a20164 a20165 a20166 a20167 a20168 a20169 a20170 a20171 a20172 a20173 a20174 a20175 a20176 a20177 a20178 a20179 a20180 a20181 a20182 a20183 a20184 a20185 a20186 a20187 a20188 a20189 a20190 a20191 a20192 a20193 a20194 a20195 a20196 a20197 a20198 a20199 a20200 a20201 a20202 a20203 a20204 a20205 a20206 a20207 a20208 a20209 a20210 a20211 a20212 a20213 a20214 a20215 a20216 a20217 a20218 a20219 a20220 a20221 a20222 a20223 a20224 a20225 a20226 a20227 a20228 a20229 a20230 a20231 a20232 a20233 a20234 a20235 a20236 a20237 a20238 a20239 a20240 a20241 a20242 a20243 a20244 a20245 a20246 a20247 a20248 a20249 a20250 a20251 a20252 a20253 a20254 a20255 a20256 a20257 a20258 a20259 a20260 a20261 a20262 a20263 a20264 a20265 a20266 a20267 a20268 a20269 a20270 a20271 a20272 a20273 a20274 a20275 a20276 a20277 a20278 a20279 a20280 a20281 a20282 a20283 a20284 a20285 a20286 a20287 a20288 a20289 a20290 a20291 a20292 a20293 a20294 a20295 a20296 a20297 a20298 a20299 a20300 a20301 a20302 a20303 a20304 a20305 a20306 a20307 a20308 a20309 a20310 a20311 a20312 a20313 a20314 a20315 a20316 a20317 a20318 a20319 a20320 a20321 a20322 a20323 a20324 a20325 a20326 a20327 a20328 a20329 a20330 a20331 a20332 a20333 a20334 a20335 a20336 a20337 a20338 a20339 a20340 a20341 a20342 a20343 a20344 a20345 a20346 a20347 a20348 a20349 a20350 a20351 a20352 a20353 a20354 a20355 a20356 a20357 a20358 a20359 a20360 a20361 a20362 a20363 a20364 a20365 a20366 a20367 a20368 a20369 a20370 a20371 a20372 a20373 a20374 a20375 a20376 a20377 a20378 a20379 a20380 a20381 a20382 a20383 a20384 a20385 a20386 a20387 a20388 a20389 a20390 a20391 a20392 a20393 a20394 a20395 a20396 a20397 a20398 a20399 a20400 a20401 a20402 a20403 a20404 a20405 a20406 a20407 a20408 a20409 a20410 a20411 a20412 a20413 a20414 a20415 a20416 a20417 a20418 a20419 a20420 a20421 a20422 a20423 a20424 a20425 a20426 a20427 a20428 a20429 a20430 a20431 a20432 a20433 a20434 a20435 a20436 a20437 a20438 a20439 a20440 a20441 a20442 a20443 a20444 a20445 a20446 a20447 a20448 a20449 a20450 a20451 a20452 a20453 a20454 a20455 a20456 a20457 a20458 a20459 a20460 a20461 a20462 a20463 a20464 a20465 a20466 a20467 a20468 a20469 a20470 a20471 a20472 a20473 a20474 a20475 a20476 a20477 a20478 a20479 a20480 a20481 a20482 a20483 a20484 a20485 a20486 a20487 a20488 a20489 a20490 a20491 a20492 a20493 a20494 a20495 a20496 a20497 a20498 a20499 a20500 a20501 a20502 a20503 a20504 a20505 a20506 a20507 a20508 a20509 a20510 a20511 a20512 a20513 a20514 a20515 a20516 a20517 a20518 a20519 a20520 a20521 a20522 a20523 a20524 a20525 a20526 a20527 a20528 a20529 a20530 a20531 a20532 a20533 a20534 a20535 a20536 a20537 a20538 a20539 a20540 a20541 a20542 a20543 a20544 a20545 a20546 a20547 a20548 a20549 a20550 a20551 a20552 a20553 a20554 a20555 a20556 a20557 a20558 a20559 a20560 a20561 a20562 a20563 a20564 a20565 a20566 a20567 a20568 a20569 a20570 a20571 a20572 a20573 a20574 a20575 a20576 a20577 a20578 a20579 a20580 a20581 a20582 a20583 a20584 a20585 a20586 a20587 a20588 a20589 a20590 a20591 a20592 a20593 a20594 a20595 a20596 a20597 a20598 a20599 a20600 a20601 a20602 a20603 a20604 a20605 a20606 a20607 a20608 a20609 a20610 a20611 a20612 a20613 a20614 a20615 a20616 a20617 a20618 a20619 a20620 a20621 a20622 a20623 a20624 a20625 a20626 a20627 a20628 a20629 a20630 a20631 a20632 a20633 a20634 a20635 a20636 a20637 a20638 a20639 a20640 a20641 a20642 a20643 a20644 a20645 a20646 a20647 a20648 a20649 a20650 a20651 a20652 a20653 a20654 a20655 a20656 a20657 a20658 a20659 a20660 a20661 a20662 a20663 a20664 a20665 a20666 a20667 a20668 a20669 a20670 a20671 a20672 a20673 a20674 a20675 a20676 a20677 a20678 a20679 a20680 a20681 a20682 a20683 a20684 a20685 a20686 a20687 a20688 a20689 a20690 a20691 a20692 a20693 a20694 a20695 a20696 a20697 a20698 a20699 a20700 a20701 a20702 a20703 a20704 a20705 a20706 a20707 a20708 a20709 a20710 a20711 a20712 a20713 a20714 a20715 a20716 a20717 a20718 a20719 a20720 a20721 a20722 a20723 a20724 a20725 a20726 a20727 a20728 a20729 a20730 a20731 a20732 a20733 a20734 a20735 a20736 a20737 a20738 a20739 a20740 a20741 a20742 a20743 a20744 a20745 a20746 a20747 a20748 a20749 a20750 a20751 a20752 a20753 a20754 a20755 a20756 a20757 a20758 a20759 a20760 a20761 a20762 a20763 a20764 a20765 a20766 a20767 a20768 a20769 a20770 a20771 a20772 a20773 a20774 a20775 a20776 a20777 a20778 a20779 a20780 a20781 a20782 a20783 a20784 a20785 a20786 a20787 a20788 a20789 a20790 a20791 a20792 a20793 a20794 a20795 a20796 a20797 a20798 a20799 a20800 a20801 a20802 a20803 a20804 a20805 a20806 a20807 a20808 a20809 a20810 a20811 a20812 a20813 a20814 a20815 a20816 a20817 a20818 a20819 a20820 a20821 a20822 a20823 a20824 a20825 a20826 a20827 a20828 a20829 a20830 a20831 a20832 a20833 a20834 a20835 a20836 a20837 a20838 a20839 a20840 a20841 a20842 a20843 a20844 a20845 a20846 a20847 a20848 a20849 a20850 a20851 a20852 a20853 a20854 a20855 a20856 a20857 a20858 a20859 a20860 a20861 a20862 a20863 a20864 a20865 a20866 a20867 a20868 a20869 a20870 a20871 a20872 a20873 a20874 a20875 a20876 a20877 a20878 a20879 a20880 a20881 a20882 a20883 a20884 a20885 a20886 a20887 a20888 a20889 a20890 a20891 a20892 a20893 a20894 a20895 a20896 a20897 a20898 a20899 a20900 a20901 a20902 a20903 a20904 a20905 a20906 a20907 a20908 a20909 a20910 a20911 a20912 a20913 a20914 a20915 a20916 a20917 a20918 a20919 a20920 a20921 a20922 a20923 a20924 a20925 a20926 a20927 a20928 a20929 a20930 a20931 a20932 a20933 a20934 a20935 a20936 a20937 a20938 a20939 a20940 a20941 a20942 a20943 a20944 a20945 a20946 a20947 a20948 a20949 a20950 a20951 a20952 a20953 a20954 a20955 a20956 a20957 a20958 a20959 a20960 a20961 a20962 a20963 a20964 a20965 a20966 a20967 a20968 a20969 a20970 a20971 a20972 a20973 a20974 a20975 a20976 a20977 a20978 a20979 a20980 a20981 a20982 a20983 a20984 a20985 a20986 a20987 a20988 a20989 a20990 a20991 a20992 a20993 a20994 a20995 a20996 a20997 a20998 a20999 a21000 a21001 a21002 a21003 a21004 a21005 a21006 a21007 a21008 a21009 a21010 a21011 a21012 a21013 a21014 a21015 a21016 a21017 a21018 a21019 a21020 a21021 a21022 a21023 a21024 a21025 a21026 a21027 a21028 a21029 a21030 a21031 a21032 a21033 a21034 a21035 a21036 a21037 a21038 a21039 a21040 a21041 a21042 a21043 a21044 a21045 a21046 a21047 a21048 a21049 a21050 a21051 a21052 a21053 a21054 a21055 a21056 a21057 a21058 a21059 a21060 a21061 a21062 a21063 a21064 a21065 a21066 a21067 a21068 a21069 a21070 a21071 a21072 a21073 a21074 a21075 a21076 a21077 a21078 a21079 a21080 a21081 a21082 a21083 a21084 a21085 a21086 a21087 a21088 a21089 a21090 a21091 a21092 a21093 a21094 a21095 a21096 a21097 a21098 a21099 a21100 a21101 a21102 a21103 a21104 a21105 a21106 a21107 a21108 a21109 a21110 a21111 a21112 a21113 a21114 a21115 a21116 a21117 a21118 a21119 a21120 a21121 a21122 a21123 a21124 a21125 a21126 a21127 a21128 a21129 a21130 a21131 a21132 a21133 a21134 a21135 a21136 a21137 a21138 a21139 a21140 a21141 a21142 a21143 a21144 a21145 a21146 a21147 a21148 a21149 a21150 a21151 a21152 a21153 a21154 a21155 a21156 a21157 a21158 a21159 a21160 a21161 a21162 a21163 a21164 a21165 a21166 a21167 a21168 a21169 a21170 a21171 a21172 a21173 a21174 a21175 a21176 a21177 a21178 a21179 a21180 a21181 a21182 a21183 a21184 a21185 a21186 a21187 a21188 a21189 a21190 a21191 a21192 a21193 a21194 a21195 a21196 a21197 a21198 a21199 a21200 a21201 a21202 a21203 a21204 a21205 a21206 a21207 a21208 a21209 a21210 a21211 a21212 a21213 a21214 a21215 a21216 a21217 a21218 a21219 a21220 a21221 a21222 a21223 a21224 a21225 a21226 a21227 a21228 a21229 a21230 a21231 a21232 a21233 a21234 a21235 a21236 a21237 a21238 a21239 a21240 a21241 a21242 a21243 a21244 a21245 a21246 a21247 a21248 a21249 a21250 a21251 a21252 a21253 a21254 a21255 a21256 a21257 a21258 a21259 a21260 a21261 a21262 a21263 a21264 a21265 a21266 a21267 a21268 a21269 a21270 a21271 a21272 a21273 a21274 a21275 a21276 a21277 a21278 a21279 a21280 a21281 a21282 a21283 a21284 a21285 a21286 a21287 a21288 a21289 a21290 a21291 a21292 a21293 a21294 a21295 a21296 a21297 a21298 a21299 a21300 a21301 a21302 a21303 a21304 a21305 a21306 a21307 a21308 a21309 a21310 a21311 a21312 a21313 a21314 a21315 a21316 a21317 a21318 a21319 a21320 a21321 a21322 a21323 a21324 a21325 a21326 a21327 a21328 a21329 a21330 a21331 a21332 a21333 a21334 a21335 a21336 a21337 a21338 a21339 a21340 a21341 a21342 a21343 a21344 a21345 a21346 a21347 a21348 a21349 a21350 a21351 a21352 a21353 a21354 a21355 a21356 a21357 a21358 a21359 a21360 a21361 a21362 a21363 a21364 a21365 a21366 a21367 a21368 a21369 a21370 a21371 a21372 a21373 a21374 a21375 a21376 a21377 a21378 a21379 a21380 a21381 a21382 a21383 a21384 a21385 a21386 a21387 a21388 a21389 a21390 a21391 a21392 a21393 a21394 a21395 a21396 a21397 a21398 a21399 a21400 a21401 a21402 a21403 a21404 a21405 a21406 a21407 a21408 a21409 a21410 a21411 a21412 a21413 a21414 a21415 a21416 a21417 a21418 a21419 a21420 a21421 a21422 a21423 a21424 a21425 a21426 a21427 a21428 a21429 a21430 a21431 a21432 a21433 a21434 a21435 a21436 a21437 a21438 a21439 a21440 a21441 a21442 a21443 a21444 a21445 a21446 a21447 a21448 a21449 a21450 a21451 a21452 a21453 a21454 a21455 a21456 a21457 a21458 a21459 a21460 a21461 a21462 a21463 a21464 a21465 a21466 a21467 a21468 a21469 a21470 a21471 a21472 a21473 a21474 a21475 a21476 a21477 a21478 a21479 a21480 a21481 a21482 a21483 a21484 a21485 a21486 a21487 a21488 a21489 a21490 a21491 a21492 a21493 a21494 a21495 a21496 a21497 a21498 a21499 a21500 a21501 a21502 a21503 a21504 a21505 a21506 a21507 a21508 a21509 a21510 a21511 a21512 a21513 a21514 a21515 a21516 a21517 a21518 a21519 a21520 a21521 a21522 a21523 a21524 a21525 a21526 a21527 a21528 a21529 a21530 a21531 a21532 a21533 a21534 a21535 a21536 a21537 a21538 a21539 a21540 a21541 a21542 a21543 a21544 a21545 a21546 a21547 a21548 a21549 a21550 a21551 a21552 a21553 a21554 a21555 a21556 a21557 a21558 a21559 a21560 a21561 a21562 a21563 a21564 a21565 a21566 a21567 a21568 a21569 a21570 a21571 a21572 a21573 a21574 a21575 a21576 a21577 a21578 a21579 a21580 a21581 a21582 a21583 a21584 a21585 a21586 a21587 a21588 a21589 a21590 a21591 a21592 a21593 a21594 a21595 a21596 a21597 a21598 a21599 a21600 a21601 a21602 a21603 a21604 a21605 a21606 a21607 a21608 a21609 a21610 a21611 a21612 a21613 a21614 a21615 a21616 a21617 a21618 a21619 a21620 a21621 a21622 a21623 a21624 a21625 a21626 a21627 a21628 a21629 a21630 a21631 a21632 a21633 a21634 a21635 a21636 a21637 a21638 a21639 a21640 a21641 a21642 a21643 a21644 a21645 a21646 a21647 a21648 a21649 a21650 a21651 a21652 a21653 a21654 a21655 a21656 a21657 a21658 a21659 a21660 a21661 a21662 a21663 a21664 a21665 a21666 a21667 a21668 a21669 a21670 a21671 a21672 a21673 a21674 a21675 a21676 a21677 a21678 a21679 a21680 a21681 a21682 a21683 a21684 a21685 a21686 a21687 a21688 a21689 a21690 a21691 a21692 a21693 a21694 a21695 a21696 a21697 a21698 a21699 a21700 a21701 a21702 a21703 a21704 a21705 a21706 a21707 a21708 a21709 a21710 a21711 a21712 a21713 a21714 a21715 a21716 a21717 a21718 a21719 a21720 a21721 a21722 a21723 a21724 a21725 a21726 a21727 a21728 a21729 a21730 a21731 a21732 a21733 a21734 a21735 a21736 a21737 a21738 a21739 a21740 a21741 a21742 a21743 a21744 a21745 a21746 a21747 a21748 a21749 a21750 a21751 a21752 a21753 a21754 a21755 a21756 a21757 a21758 a21759 a21760 a21761 a21762 a21763 a21764 a21765 a21766 a21767 a21768 a21769 a21770 a21771 a21772 a21773 a21774 a21775 a21776 a21777 a21778 a21779 a21780 a21781 a21782 a21783 a21784 a21785 a21786 a21787 a21788 a21789 a21790 a21791 a21792 a21793 a21794 a21795 a21796 a21797 a21798 a21799 a21800 a21801 a21802 a21803 a21804 a21805 a21806 a21807 a21808 a21809 a21810 a21811 a21812 a21813 a21814 a21815 a21816 a21817 a21818 a21819 a21820 a21821 a21822 a21823 a21824 a21825 a21826 a21827 a21828 a21829 a21830 a21831 a21832 a21833 a21834 a21835 a21836 a21837 a21838 a21839 a21840 a21841 a21842 a21843 a21844 a21845 a21846 a21847 a21848 a21849 a21850 a21851 a21852 a21853 a21854 a21855 a21856 a21857 a21858 a21859 a21860 a21861 a21862 a21863 a21864 a21865 a21866 a21867 a21868 a21869 a21870 a21871 a21872 a21873 a21874 a21875 a21876 a21877 a21878 a21879 a21880 a21881 a21882 a21883 a21884 a21885 a21886 a21887 a21888 a21889 a21890 a21891 a21892 a21893 a21894 a21895 a21896 a21897 a21898 a21899 a21900 a21901 a21902 a21903 a21904 a21905 a21906 a21907 a21908 a21909 a21910 a21911 a21912 a21913 a21914 a21915 a21916 a21917 a21918 a21919 a21920 a21921 a21922 a21923 a21924 a21925 a21926 a21927 a21928 a21929 a21930 a21931 a21932 a21933 a21934 a21935 a21936 a21937 a21938 a21939 a21940 a21941 a21942 a21943 a21944 a21945 a21946 a21947 a21948 a21949 a21950 a21951 a21952 a21953 a21954 a21955 a21956 a21957 a21958 a21959 a21960 a21961 a21962 a21963 a21964 a21965 a21966 a21967 a21968 a21969 a21970 a21971 a21972 a21973 a21974 a21975 a21976 a21977 a21978 a21979 a21980 a21981 a21982 a21983 a21984 a21985 a21986 a21987 a21988 a21989 a21990 a21991 a21992 a21993 a21994 a21995 a21996 a21997 a21998 a21999 a22000 a22001 a22002 a22003 a22004 a22005 a22006 a22007 a22008 a22009 a22010 a22011 a22012 a22013 a22014 a22015 a22016 a22017 a22018 a22019 a22020 a22021 a22022 a22023 a22024 a22025 a22026 a22027 a22028 a22029 a22030 a22031 a22032 a22033 a22034 a22035 a22036 a22037 a22038 a22039 a22040 a22041 a22042 a22043 a22044 a22045 a22046 a22047 a22048 a22049 a22050 a22051 a22052 a22053 a22054 a22055 a22056 a22057 a22058 a22059 a22060 a22061 a22062 a22063 a22064 a22065 a22066 a22067 a22068 a22069 a22070 a22071 a22072 a22073 a22074 a22075 a22076 a22077 a22078 a22079 a22080 a22081 a22082 a22083 a22084 a22085 a22086 a22087 a22088 a22089 a22090 a22091 a22092 a22093 a22094 a22095 a22096 a22097 a22098 a22099 a22100 a22101 a22102 a22103 a22104 a22105 a22106 a22107 a22108 a22109 a22110 a22111 a22112 a22113 a22114 a22115 a22116 a22117 a22118 a22119 a22120 a22121 a22122 a22123 a22124 a22125 a22126 a22127 a22128 a22129 a22130 a22131 a22132 a22133 a22134 a22135 a22136 a22137 a22138 a22139 a22140 a22141 a22142 a22143 a22144 a22145 a22146 a22147 a22148 a22149 a22150 a22151 a22152 a22153 a22154 a22155 a22156 a22157 a22158 a22159 a22160 a22161 a22162 a22163 a22164 a22165 a22166 a22167 a22168 a22169 a22170 a22171 a22172 a22173 a22174 a22175 a22176 a22177 a22178 a22179 a22180 a22181 a22182 a22183 a22184 a22185 a22186 a22187 a22188 a22189 a22190 a22191 a22192 a22193 a22194 a22195 a22196 a22197 a22198 a22199 a22200 a22201 a22202 a22203 a22204 a22205 a22206 a22207 a22208 a22209 a22210 a22211 a22212 a22213 a22214 a22215 a22216 a22217 a22218 a22219 a22220 a22221 a22222 a22223 a22224 a22225 a22226 a22227 a22228 a22229 a22230 a22231 a22232 a22233 a22234 a22235 a22236 a22237 a22238 a22239 a22240 a22241 a22242 a22243 a22244 a22245 a22246 a22247 a22248 a22249 a22250 a22251 a22252 a22253 a22254 a22255 a22256 a22257 a22258 a22259 a22260 a22261 a22262 a22263 a22264 a22265 a22266 a22267 a22268 a22269 a22270 a22271 a22272 a22273 a22274 a22275 a22276 a22277 a22278 a22279 a22280 a22281 a22282 a22283 a22284 a22285 a22286 a22287 a22288 a22289 a22290 a22291 a22292 a22293 a22294 a22295 a22296 a22297 a22298 a22299 a22300 a22301 a22302 a22303 a22304 a22305 a22306 a22307 a22308 a22309 a22310 a22311 a22312 a22313 a22314 a22315 a22316 a22317 a22318 a22319 a22320 a22321 a22322 a22323 a22324 a22325 a22326 a22327 a22328 a22329 a22330 a22331 a22332 a22333 a22334 a22335 a22336 a22337 a22338 a22339 a22340 a22341 a22342 a22343 a22344 a22345 a22346 a22347 a22348 a22349 a22350 a22351 a22352 a22353 a22354 a22355 a22356 a22357 a22358 a22359 a22360 a22361 a22362 a22363 a22364 a22365 a22366 a22367 a22368 a22369 a22370 a22371 a22372 a22373 a22374 a22375 a22376 a22377 a22378 a22379 a22380 a22381 a22382 a22383 a22384 a22385 a22386 a22387 a22388 a22389 a22390 a22391 a22392 a22393 a22394 a22395 a22396 a22397 a22398 a22399 a22400 a22401 a22402 a22403 a22404 a22405 a22406 a22407 a22408 a22409 a22410 a22411 a22412 a22413 a22414 a22415 a22416 a22417 a22418 a22419 a22420 a22421 a22422 a22423 a22424 a22425 a22426 a22427 a22428 a22429 a22430 a22431 a22432 a22433 a22434 a22435 a22436 a22437 a22438 a22439 a22440 a22441 a22442 a22443 a22444 a22445 a22446 a22447 a22448 a22449 a22450 a22451 a22452 a22453 a22454 a22455 a22456 a22457 a22458 a22459 a22460 a22461 a22462 a22463 a22464 a22465 a22466 a22467 a22468 a22469 a22470 a22471 a22472 a22473 a22474 a22475 a22476 a22477 a22478 a22479 a22480 a22481 a22482 a22483 a22484 a22485 a22486 a22487 a22488 a22489 a22490 a22491 a22492 a22493 a22494 a22495 a22496 a22497 a22498 a22499 a22500 a22501 a22502 a22503 a22504 a22505 a22506 a22507 a22508 a22509 a22510 a22511 a22512 a22513 a22514 a22515 a22516 a22517 a22518 a22519 a22520 a22521 a22522 a22523 a22524 a22525 a22526 a22527 a22528 a22529 a22530 a22531 a22532 a22533 a22534 a22535 a22536 a22537 a22538 a22539 a22540 a22541 a22542 a22543 a22544 a22545 a22546 a22547 a22548 a22549 a22550 a22551 a22552 a22553 a22554 a22555 a22556 a22557 a22558 a22559 a22560 a22561 a22562 a22563 a22564 a22565 a22566 a22567 a22568 a22569 a22570 a22571 a22572 a22573 a22574 a22575 a22576 a22577 a22578 a22579 a22580 a22581 a22582 a22583 a22584 a22585 a22586 a22587 a22588 a22589 a22590 a22591 a22592 a22593 a22594 a22595 a22596 a22597 a22598 a22599 a22600 a22601 a22602 a22603 a22604 a22605 a22606 a22607 a22608 a22609 a22610 a22611 a22612 a22613 a22614 a22615 a22616 a22617 a22618 a22619 a22620 a22621 a22622 a22623 a22624 a22625 a22626 a22627 a22628 a22629 a22630 a22631 a22632 a22633 a22634 a22635 a22636 a22637 a22638 a22639 a22640 a22641 a22642 a22643 a22644 a22645 a22646 a22647 a22648 a22649 a22650 a22651 a22652 a22653 a22654 a22655 a22656 a22657 a22658 a22659 a22660 a22661 a22662 a22663 a22664 a22665 a22666 a22667 a22668 a22669 a22670 a22671 a22672 a22673 a22674 a22675 a22676 a22677 a22678 a22679 a22680 a22681 a22682 a22683 a22684 a22685 a22686 a22687 a22688 a22689 a22690 a22691 a22692 a22693 a22694 a22695 a22696 a22697 a22698 a22699 a22700 a22701 a22702 a22703 a22704 a22705 a22706 a22707 a22708 a22709 a22710 a22711 a22712 a22713 a22714 a22715 a22716 a22717 a22718 a22719 a22720 a22721 a22722 a22723 a22724 a22725 a22726 a22727 a22728 a22729 a22730 a22731 a22732 a22733 a22734 a22735 a22736 a22737 a22738 a22739 a22740 a22741 a22742 a22743 a22744 a22745 a22746 a22747 a22748 a22749 a22750 a22751 a22752 a22753 a22754 a22755 a22756 a22757 a22758 a22759 a22760 a22761 a22762 a22763 a22764 a22765 a22766 a22767 a22768 a22769 a22770 a22771 a22772 a22773 a22774 a22775 a22776 a22777 a22778 a22779 a22780 a22781 a22782 a22783 a22784 a22785 a22786 a22787 a22788 a22789 a22790 a22791 a22792 a22793 a22794 a22795 a22796 a22797 a22798 a22799 a22800 a22801 a22802 a22803 a22804 a22805 a22806 a22807 a22808 a22809 a22810 a22811 a22812 a22813 a22814 a22815 a22816 a22817 a22818 a22819 a22820 a22821 a22822 a22823 a22824 a22825 a22826 a22827 a22828 a22829 a22830 a22831 a22832 a22833 a22834 a22835 a22836 a22837 a22838 a22839 a22840 a22841 a22842 a22843 a22844 a22845 a22846 a22847 a22848 a22849 a22850 a22851 a22852 a22853 a22854 a22855 a22856 a22857 a22858 a22859 a22860 a22861 a22862 a22863 a22864 a22865 a22866 a22867 a22868 a22869 a22870 a22871 a22872 a22873 a22874 a22875 a22876 a22877 a22878 a22879 a22880 a22881 a22882 a22883 a22884 a22885 a22886 a22887 a22888 a22889 a22890 a22891 a22892 a22893 a22894 a22895 a22896 a22897 a22898 a22899 a22900 a22901 a22902 a22903 a22904 a22905 a22906 a22907 a22908 a22909 a22910 a22911 a22912 a22913 a22914 a22915 a22916 a22917 a22918 a22919 a22920 a22921 a22922 a22923 a22924 a22925 a22926 a22927 a22928 a22929 a22930 a22931 a22932 a22933 a22934 a22935 a22936 a22937 a22938 a22939 a22940 a22941 a22942 a22943 a22944 a22945 a22946 a22947 a22948 a22949 a22950 a22951 a22952 a22953 a22954 a22955 a22956 a22957 a22958 a22959 a22960 a22961 a22962 a22963 a22964 a22965 a22966 a22967 a22968 a22969 a22970 a22971 a22972 a22973 a22974 a22975 a22976 a22977 a22978 a22979 a22980 a22981 a22982 a22983 a22984 a22985 a22986 a22987 a22988 a22989 a22990 a22991 a22992 a22993 a22994 a22995 a22996 a22997 a22998 a22999 a23000 a23001 a23002 a23003 a23004 a23005 a23006 a23007 a23008 a23009 a23010 a23011 a23012 a23013 a23014 a23015 a23016 a23017 a23018 a23019 a23020 a23021 a23022 a23023 a23024 a23025 a23026 a23027 a23028 a23029 a23030 a23031 a23032 a23033 a23034 a23035 a23036 a23037 a23038 a23039 a23040 a23041 a23042 a23043 a23044 a23045 a23046 a23047 a23048 a23049 a23050 a23051 a23052 a23053 a23054 a23055 a23056 a23057 a23058 a23059 a23060 a23061 a23062 a23063 a23064 a23065 a23066 a23067 a23068 a23069 a23070 a23071 a23072 a23073 a23074 a23075 a23076 a23077 a23078 a23079 a23080 a23081 a23082 a23083 a23084 a23085 a23086 a23087 a23088 a23089 a23090 a23091 a23092 a23093 a23094 a23095 a23096 a23097 a23098 a23099 a23100 a23101 a23102 a23103 a23104 a23105 a23106 a23107 a23108 a23109 a23110 a23111 a23112 a23113 a23114 a23115 a23116 a23117 a23118 a23119 a23120 a23121 a23122 a23123 a23124 a23125 a23126 a23127 a23128 a23129 a23130 a23131 a23132 a23133 a23134 a23135 a23136 a23137 a23138 a23139 a23140 a23141 a23142 a23143 a23144 a23145 a23146 a23147 a23148 a23149 a23150 a23151 a23152 a23153 a23154 a23155 a23156 a23157 a23158 a23159 a23160 a23161 a23162 a23163 a23164 a23165 a23166 a23167 a23168 a23169 a23170 a23171 a23172 a23173 a23174 a23175 a23176 a23177 a23178 a23179 a23180 a23181 a23182 a23183 a23184 a23185 a23186 a23187 a23188 a23189 a23190 a23191 a23192 a23193 a23194 a23195 a23196 a23197 a23198 a23199 a23200 a23201 a23202 a23203 a23204 a23205 a23206 a23207 a23208 a23209 a23210 a23211 a23212 a23213 a23214 a23215 a23216 a23217 a23218 a23219 a23220 a23221 a23222 a23223 a23224 a23225 a23226 a23227 a23228 a23229 a23230 a23231 a23232 a23233 a23234 a23235 a23236 a23237 a23238 a23239 a23240 a23241 a23242 a23243 a23244 a23245 a23246 a23247 a23248 a23249 a23250 a23251 a23252 a23253 a23254 a23255 a23256 a23257 a23258 a23259 a23260 a23261 a23262 a23263 a23264 a23265 a23266 a23267 a23268 a23269 a23270 a23271 a23272 a23273 a23274 a23275 a23276 a23277 a23278 a23279 a23280 a23281 a23282 a23283 a23284 a23285 a23286 a23287 a23288 a23289 a23290 a23291 a23292 a23293 a23294 a23295 a23296 a23297 a23298 a23299 a23300 a23301 a23302 a23303 a23304 a23305 a23306 a23307 a23308 a23309 a23310 a23311 a23312 a23313 a23314 a23315 a23316 a23317 a23318 a23319 a23320 a23321 a23322 a23323 a23324 a23325 a23326 a23327 a23328 a23329 a23330 a23331 a23332 a23333 a23334 a23335 a23336 a23337 a23338 a23339 a23340 a23341 a23342 a23343 a23344 a23345 a23346 a23347 a23348 a23349 a23350 a23351 a23352 a23353 a23354 a23355 a23356 a23357 a23358 a23359 a23360 a23361 a23362 a23363 a23364 a23365 a23366 a23367 a23368 a23369 a23370 a23371 a23372 a23373 a23374 a23375 a23376 a23377 a23378 a23379 a23380 a23381 a23382 a23383 a23384 a23385 a23386 a23387 a23388 a23389 a23390 a23391 a23392 a23393 a23394 a23395 a23396 a23397 a23398 a23399 a23400 a23401 a23402 a23403 a23404 a23405 a23406 a23407 a23408 a23409 a23410 a23411 a23412 a23413 a23414 a23415 a23416 a23417 a23418 a23419 a23420 a23421 a23422 a23423 a23424 a23425 a23426 a23427 a23428 a23429 a23430 a23431 a23432 a23433 a23434 a23435 a23436 a23437 a23438 a23439 a23440 a23441 a23442 a23443 a23444 a23445 a23446 a23447 a23448 a23449 a23450 a23451 a23452 a23453 a23454 a23455 a23456 a23457 a23458 a23459 a23460 a23461 a23462 a23463 a23464 a23465 a23466 a23467 a23468 a23469 a23470 a23471 a23472 a23473 a23474 a23475 a23476 a23477 a23478 a23479 a23480 a23481 a23482 a23483 a23484 a23485 a23486 a23487 a23488 a23489 a23490 a23491 a23492 a23493 a23494 a23495 a23496 a23497 a23498 a23499 a23500 a23501 a23502 a23503 a23504 a23505 a23506 a23507 a23508 a23509 a23510 a23511 a23512 a23513 a23514 a23515 a23516 a23517 a23518 a23519 a23520 a23521 a23522 a23523 a23524 a23525 a23526 a23527 a23528 a23529 a23530 a23531 a23532 a23533 a23534 a23535 a23536 a23537 a23538 a23539 a23540 a23541 a23542 a23543 a23544 a23545 a23546 a23547 a23548 a23549 a23550 a23551 a23552 a23553 a23554 a23555 a23556 a23557 a23558 a23559 a23560 a23561 a23562 a23563 a23564 a23565 a23566 a23567 a23568 a23569 a23570 a23571 a23572 a23573 a23574 a23575 a23576 a23577 a23578 a23579 a23580 a23581 a23582 a23583 a23584 a23585 a23586 a23587 a23588 a23589 a23590 a23591 a23592 a23593 a23594 a23595 a23596 a23597 a23598 a23599 a23600 a23601 a23602 a23603 a23604 a23605 a23606 a23607 a23608 a23609 a23610 a23611 a23612 a23613 a23614 a23615 a23616 a23617 a23618 a23619 a23620 a23621 a23622 a23623 a23624 a23625 a23626 a23627 a23628 a23629 a23630 a23631 a23632 a23633 a23634 a23635 a23636 a23637 a23638 a23639 a23640 a23641 a23642 a23643 a23644 a23645 a23646 a23647 a23648 a23649 a23650 a23651 a23652 a23653 a23654 a23655 a23656 a23657 a23658 a23659 a23660 a23661 a23662 a23663 a23664 a23665 a23666 a23667 a23668 a23669 a23670 a23671 a23672 a23673 a23674 a23675 a23676 a23677 a23678 a23679 a23680 a23681 a23682 a23683 a23684 a23685 a23686 a23687 a23688 a23689 a23690 a23691 a23692 a23693 a23694 a23695 a23696 a23697 a23698 a23699 a23700 a23701 a23702 a23703 a23704 a23705 a23706 a23707 a23708 a23709 a23710 a23711 a23712 a23713 a23714 a23715 a23716 a23717 a23718 a23719 a23720 a23721 a23722 a23723 a23724 a23725 a23726 a23727 a23728 a23729 a23730 a23731 a23732 a23733 a23734 a23735 a23736 a23737 a23738 a23739 a23740 a23741 a23742 a23743 a23744 a23745 a23746 a23747 a23748 a23749 a23750 a23751 a23752 a23753 a23754 a23755 a23756 a23757 a23758 a23759 a23760 a23761 a23762 a23763 a23764 a23765 a23766 a23767 a23768 a23769 a23770 a23771 a23772 a23773 a23774 a23775 a23776 a23777 a23778 a23779 a23780 a23781 a23782 a23783 a23784 a23785 a23786 a23787 a23788 a23789 a23790 a23791 a23792 a23793 a23794 a23795 a23796 a23797 a23798 a23799 a23800 a23801 a23802 a23803 a23804 a23805 a23806 a23807 a23808 a23809 a23810 a23811 a23812 a23813 a23814 a23815 a23816 a23817 a23818 a23819 a23820 a23821 a23822 a23823 a23824 a23825 a23826 a23827 a23828 a23829 a23830 a23831 a23832 a23833 a23834 a23835 a23836 a23837 a23838 a23839 a23840 a23841 a23842 a23843 a23844 a23845 a23846 a23847 a23848 a23849 a23850 a23851 a23852 a23853 a23854 a23855 a23856 a23857 a23858 a23859 a23860 a23861 a23862 a23863 a23864 a23865 a23866 a23867 a23868 a23869 a23870 a23871 a23872 a23873 a23874 a23875 a23876 a23877 a23878 a23879 a23880 a23881 a23882 a23883 a23884 a23885 a23886 a23887 a23888 a23889 a23890 a23891 a23892 a23893 a23894 a23895 a23896 a23897 a23898 a23899 a23900 a23901 a23902 a23903 a23904 a23905 a23906 a23907 a23908 a23909 a23910 a23911 a23912 a23913 a23914 a23915 a23916 a23917 a23918 a23919 a23920 a23921 a23922 a23923 a23924 a23925 a23926 a23927 a23928 a23929 a23930 a23931 a23932 a23933 a23934 a23935 a23936 a23937 a23938 a23939 a23940 a23941 a23942 a23943 a23944 a23945 a23946 a23947 a23948 a23949 a23950 a23951 a23952 a23953 a23954 a23955 a23956 a23957 a23958 a23959 a23960 a23961 a23962 a23963 a23964 a23965 a23966 a23967 a23968 a23969 a23970 a23971 a23972 a23973 a23974 a23975 a23976 a23977 a23978 a23979 a23980 a23981 a23982 a23983 a23984 a23985 a23986 a23987 a23988 a23989 a23990 a23991 a23992 a23993 a23994 a23995 a23996 a23997 a23998 a23999 a24000 a24001 a24002 a24003 a24004 a24005 a24006 a24007 a24008 a24009 a24010 a24011 a24012 a24013 a24014 a24015 a24016 a24017 a24018 a24019 a24020 a24021 a24022 a24023 a24024 a24025 a24026 a24027 a24028 a24029 a24030 a24031 a24032 a24033 a24034 a24035 a24036 a24037 a24038 a24039 a24040 a24041 a24042 a24043 a24044 a24045 a24046 a24047 a24048 a24049 a24050 a24051 a24052 a24053 a24054 a24055 a24056 a24057 a24058 a24059 a24060 a24061 a24062 a24063 a24064 a24065 a24066 a24067 a24068 a24069 a24070 a24071 a24072 a24073 a24074 a24075 a24076 a24077 a24078 a24079 a24080 a24081 a24082 a24083 a24084 a24085 a24086 a24087 a24088 a24089 a24090 a24091 a24092 a24093 a24094 a24095 a24096 a24097 a24098 a24099 a24100 a24101 a24102 a24103 a24104 a24105 a24106 a24107 a24108 a24109 a24110 a24111 a24112 a24113 a24114 a24115 a24116 a24117 a24118 a24119 a24120 a24121 a24122 a24123 a24124 a24125 a24126 a24127 a24128 a24129 a24130 a24131 a24132 a24133 a24134 a24135 a24136 a24137 a24138 a24139 a24140 a24141 a24142 a24143 a24144 a24145 a24146 a24147 a24148 a24149 a24150 a24151 a24152 a24153 a24154 a24155 a24156 a24157 a24158 a24159 a24160 a24161 a24162 a24163 a24164 a24165 a24166 a24167 a24168 a24169 a24170 a24171 a24172 a24173 a24174 a24175 a24176 a24177 a24178 a24179 a24180 a24181 a24182 a24183 a24184 a24185 a24186 a24187 a24188 a24189 a24190 a24191 a24192 a24193 a24194 a24195 a24196 a24197 a24198 a24199 a24200 a24201 a24202 a24203 a24204 a24205 a24206 a24207 a24208 a24209 a24210 a24211 a24212 a24213 a24214 a24215 a24216 a24217 a24218 a24219 a24220 a24221 a24222 a24223 a24224 a24225 a24226 a24227 a24228 a24229 a24230 a24231 a24232 a24233 a24234 a24235 a24236 a24237 a24238 a24239 a24240 a24241 a24242 a24243 a24244 a24245 a24246 a24247 a24248 a24249 a24250 a24251 a24252 a24253 a24254 a24255 a24256 a24257 a24258 a24259 a24260 a24261 a24262 a24263 a24264 a24265 a24266 a24267 a24268 a24269 a24270 a24271 a24272 a24273 a24274 a24275 a24276 a24277 a24278 a24279 a24280 a24281 a24282 a24283 a24284 a24285 a24286 a24287 a24288 a24289 a24290 a24291 a24292 a24293 a24294 a24295 a24296 a24297 a24298 a24299 a24300 a24301 a24302 a24303 a24304 a24305 a24306 a24307 a24308 a24309 a24310 a24311 a24312 a24313 a24314 a24315 a24316 a24317 a24318 a24319 a24320 a24321 a24322 a24323 a24324 a24325 a24326 a24327 a24328 a24329 a24330 a24331 a24332 a24333 a24334 a24335 a24336 a24337 a24338 a24339 a24340 a24341 a24342 a24343 a24344 a24345 a24346 a24347 a24348 a24349 a24350 a24351 a24352 a24353 a24354 a24355 a24356 a24357 a24358 a24359 a24360 a24361 a24362 a24363 a24364 a24365 a24366 a24367 a24368 a24369 a24370 a24371 a24372 a24373 a24374 a24375 a24376 a24377 a24378 a24379 a24380 a24381 a24382 a24383 a24384 a24385 a24386 a24387 a24388 a24389 a24390 a24391 a24392 a24393 a24394 a24395 a24396 a24397 a24398 a24399 a24400 a24401 a24402 a24403 a24404 a24405 a24406 a24407 a24408 a24409 a24410 a24411 a24412 a24413 a24414 a24415 a24416 a24417 a24418 a24419 a24420 a24421 a24422 a24423 a24424 a24425 a24426 a24427 a24428 a24429 a24430 a24431 a24432 a24433 a24434 a24435 a24436 a24437 a24438 a24439 a24440 a24441 a24442 a24443 a24444 a24445 a24446 a24447 a24448 a24449 a24450 a24451 a24452 a24453 a24454 a24455 a24456 a24457 a24458 a24459 a24460 a24461 a24462 a24463 a24464 a24465 a24466 a24467 a24468 a24469 a24470 a24471 a24472 a24473 a24474 a24475 a24476 a24477 a24478 a24479 a24480 a24481 a24482 a24483 a24484 a24485 a24486 a24487 a24488 a24489 a24490 a24491 a24492 a24493 a24494 a24495 a24496 a24497 a24498 a24499 a24500 a24501 a24502 a24503 a24504 a24505 a24506 a24507 a24508 a24509 a24510 a24511 a24512 a24513 a24514 a24515 a24516 a24517 a24518 a24519 a24520 a24521 a24522 a24523 a24524 a24525 a24526 a24527 a24528 a24529 a24530 a24531 a24532 a24533 a24534 a24535 a24536 a24537 a24538 a24539 a24540 a24541 a24542 a24543 a24544 a24545 a24546 a24547 a24548 a24549 a24550 a24551 a24552 a24553 a24554 a24555 a24556 a24557 a24558 a24559 a24560 a24561 a24562 a24563 a24564 a24565 a24566 a24567 a24568 a24569 a24570 a24571 a24572 a24573 a24574 a24575 a24576 a24577 a24578 a24579 a24580 a24581 a24582 a24583 a24584 a24585 a24586 a24587 a24588 a24589 a24590 a24591 a24592 a24593 a24594 a24595 a24596 a24597 a24598 a24599 a24600 a24601 a24602 a24603 a24604 a24605 a24606 a24607 a24608 a24609 a24610 a24611 a24612 a24613 a24614 a24615 a24616 a24617 a24618 a24619 a24620 a24621 a24622 a24623 a24624 a24625 a24626 a24627 a24628 a24629 a24630 a24631 a24632 a24633 a24634 a24635 a24636 a24637 a24638 a24639 a24640 a24641 a24642 a24643 a24644 a24645 a24646 a24647 a24648 a24649 a24650 a24651 a24652 a24653 a24654 a24655 a24656 a24657 a24658 a24659 a24660 a24661 a24662 a24663 a24664 a24665 a24666 a24667 a24668 a24669 a24670 a24671 a24672 a24673 a24674 a24675 a24676 a24677 a24678 a24679 a24680 a24681 a24682 a24683 a24684 a24685 a24686 a24687 a24688 a24689 a24690 a24691 a24692 a24693 a24694 a24695 a24696 a24697 a24698 a24699 a24700 a24701 a24702 a24703 a24704 a24705 a24706 a24707 a24708 a24709 a24710 a24711 a24712 a24713 a24714 a24715 a24716 a24717 a24718 a24719 a24720 a24721 a24722 a24723 a24724 a24725 a24726 a24727 a24728 a24729 a24730 a24731 a24732 a24733 a24734 a24735 a24736 a24737 a24738 a24739 a24740 a24741 a24742 a24743 a24744 a24745 a24746 a24747 a24748 a24749 a24750 a24751 a24752 a24753 a24754 a24755 a24756 a24757 a24758 a24759 a24760 a24761 a24762 a24763 a24764 a24765 a24766 a24767 a24768 a24769 a24770 a24771 a24772 a24773 a24774 a24775 a24776 a24777 a24778 a24779 a24780 a24781 a24782 a24783 a24784 a24785 a24786 a24787 a24788 a24789 a24790 a24791 a24792 a24793 a24794 a24795 a24796 a24797 a24798 a24799 a24800 a24801 a24802 a24803 a24804 a24805 a24806 a24807 a24808 a24809 a24810 a24811 a24812 a24813 a24814 a24815 a24816 a24817 a24818 a24819 a24820 a24821 a24822 a24823 a24824 a24825 a24826 a24827 a24828 a24829 a24830 a24831 a24832 a24833 a24834 a24835 a24836 a24837 a24838 a24839 a24840 a24841 a24842 a24843 a24844 a24845 a24846 a24847 a24848 a24849 a24850 a24851 a24852 a24853 a24854 a24855 a24856 a24857 a24858 a24859 a24860 a24861 a24862 a24863 a24864 a24865 a24866 a24867 a24868 a24869 a24870 a24871 a24872 a24873 a24874 a24875 a24876 a24877 a24878 a24879 a24880 a24881 a24882 a24883 a24884 a24885 a24886 a24887 a24888 a24889 a24890 a24891 a24892 a24893 a24894 a24895 a24896 a24897 a24898 a24899 a24900 a24901 a24902 a24903 a24904 a24905 a24906 a24907 a24908 a24909 a24910 a24911 a24912 a24913 a24914 a24915 a24916 a24917 a24918 a24919 a24920 a24921 a24922 a24923 a24924 a24925 a24926 a24927 a24928 a24929 a24930 a24931 a24932 a24933 a24934 a24935 a24936 a24937 a24938 a24939 a24940 a24941 a24942 a24943 a24944 a24945 a24946 a24947 a24948 a24949 a24950 a24951 a24952 a24953 a24954 a24955 a24956 a24957 a24958 a24959 a24960 a24961 a24962 a24963 a24964 a24965 a24966 a24967 a24968 a24969 a24970 a24971 a24972 a24973 a24974 a24975 a24976 a24977 a24978 a24979 a24980 a24981 a24982 a24983 a24984 a24985 a24986 a24987 a24988 a24989 a24990 a24991 a24992 a24993 a24994 a24995 a24996 a24997 a24998 a24999 a25000 a25001 a25002 a25003 a25004 a25005 a25006 a25007 a25008 a25009 a25010 a25011 a25012 a25013 a25014 a25015 a25016 a25017 a25018 a25019 a25020 a25021 a25022 a25023 a25024 a25025 a25026 a25027 a25028 a25029 a25030 a25031 a25032 a25033 a25034 a25035 a25036 a25037 a25038 a25039 a25040 a25041 a25042 a25043 a25044 a25045 a25046 a25047 a25048 a25049 a25050 a25051 a25052 a25053 a25054 a25055 a25056 a25057 a25058 a25059 a25060 a25061 a25062 a25063 a25064 a25065 a25066 a25067 a25068 a25069 a25070 a25071 a25072 a25073 a25074 a25075 a25076 a25077 a25078 a25079 a25080 a25081 a25082 a25083 a25084 a25085 a25086 a25087 a25088 a25089 a25090 a25091 a25092 a25093 a25094 a25095 a25096 a25097 a25098 a25099 a25100 a25101 a25102 a25103 a25104 a25105 a25106 a25107 a25108 a25109 a25110 a25111 a25112 a25113 a25114 a25115 a25116 a25117 a25118 a25119 a25120 a25121 a25122 a25123 a25124 a25125 a25126 a25127 a25128 a25129 a25130 a25131 a25132 a25133 a25134 a25135 a25136 a25137 a25138 a25139 a25140 a25141 a25142 a25143 a25144 a25145 a25146 a25147 a25148 a25149 a25150 a25151 a25152 a25153 a25154 a25155 a25156 a25157 a25158 a25159 a25160 a25161 a25162 a25163 a25164 a25165 a25166 a25167 a25168 a25169 a25170 a25171 a25172 a25173 a25174 a25175 a25176 a25177 a25178 a25179 a25180 a25181 a25182 a25183 a25184 a25185 a25186 a25187 a25188 a25189 a25190 a25191 a25192 a25193 a25194 a25195 a25196 a25197 a25198 a25199 a25200 a25201 a25202 a25203 a25204 a25205 a25206 a25207 a25208 a25209 a25210 a25211 a25212 a25213 a25214 a25215 a25216 a25217 a25218 a25219 a25220 a25221 a25222 a25223 a25224 a25225 a25226 a25227 a25228 a25229 a25230 a25231 a25232 a25233 a25234 a25235 a25236 a25237 a25238 a25239 a25240 a25241 a25242 a25243 a25244 a25245 a25246 a25247 a25248 a25249 a25250 a25251 a25252 a25253 a25254 a25255 a25256 a25257 a25258 a25259 a25260 a25261 a25262 a25263 a25264 a25265 a25266 a25267 a25268 a25269 a25270 a25271 a25272 a25273 a25274 a25275 a25276 a25277 a25278 a25279 a25280 a25281 a25282 a25283 a25284 a25285 a25286 a25287 a25288 a25289 a25290 a25291 a25292 a25293 a25294 a25295 a25296 a25297 a25298 a25299 a25300 a25301 a25302 a25303 a25304 a25305 a25306 a25307 a25308 a25309 a25310 a25311 a25312 a25313 a25314 a25315 a25316 a25317 a25318 a25319 a25320 a25321 a25322 a25323 a25324 a25325 a25326 a25327 a25328 a25329 a25330 a25331 a25332 a25333 a25334 a25335 a25336 a25337 a25338 a25339 a25340 a25341 a25342 a25343 a25344 a25345 a25346 a25347 a25348 a25349 a25350 a25351 a25352 a25353 a25354 a25355 a25356 a25357 a25358 a25359 a25360 a25361 a25362 a25363 a25364 a25365 a25366 a25367 a25368 a25369 a25370 a25371 a25372 a25373 a25374 a25375 a25376 a25377 a25378 a25379 a25380 a25381 a25382 a25383 a25384 a25385 a25386 a25387 a25388 a25389 a25390 a25391 a25392 a25393 a25394 a25395 a25396 a25397 a25398 a25399 a25400 a25401 a25402 a25403 a25404 a25405 a25406 a25407 a25408 a25409 a25410 a25411 a25412 a25413 a25414 a25415 a25416 a25417 a25418 a25419 a25420 a25421 a25422 a25423 a25424 a25425 a25426 a25427 a25428 a25429 a25430 a25431 a25432 a25433 a25434 a25435 a25436 a25437 a25438 a25439 a25440 a25441 a25442 a25443 a25444 a25445 a25446 a25447 a25448 a25449 a25450 a25451 a25452 a25453 a25454 a25455 a25456 a25457 a25458 a25459 a25460 a25461 a25462 a25463 a25464 a25465 a25466 a25467 a25468 a25469 a25470 a25471 a25472 a25473 a25474 a25475 a25476 a25477 a25478 a25479 a25480 a25481 a25482 a25483 a25484 a25485 a25486 a25487 a25488 a25489 a25490 a25491 a25492 a25493 a25494 a25495 a25496 a25497 a25498 a25499 a25500 a25501 a25502 a25503 a25504 a25505 a25506 a25507 a25508 a25509 a25510 a25511 a25512 a25513 a25514 a25515 a25516 a25517 a25518 a25519 a25520 a25521 a25522 a25523 a25524 a25525 a25526 a25527 a25528 a25529 a25530 a25531 a25532 a25533 a25534 a25535 a25536 a25537 a25538 a25539 a25540 a25541 a25542 a25543 a25544 a25545 a25546 a25547 a25548 a25549 a25550 a25551 a25552 a25553 a25554 a25555 a25556 a25557 a25558 a25559 a25560 a25561 a25562 a25563 a25564 a25565 a25566 a25567 a25568 a25569 a25570 a25571 a25572 a25573 a25574 a25575 a25576 a25577 a25578 a25579 a25580 a25581 a25582 a25583 a25584 a25585 a25586 a25587 a25588 a25589 a25590 a25591 a25592 a25593 a25594 a25595 a25596 a25597 a25598 a25599 a25600 a25601 a25602 a25603 a25604 a25605 a25606 a25607 a25608 a25609 a25610 a25611 a25612 a25613 a25614 a25615 a25616 a25617 a25618 a25619 a25620 a25621 a25622 a25623 a25624 a25625 a25626 a25627 a25628 a25629 a25630 a25631 a25632 a25633 a25634 a25635 a25636 a25637 a25638 a25639 a25640 a25641 a25642 a25643 a25644 a25645 a25646 a25647 a25648 a25649 a25650 a25651 a25652 a25653 a25654 a25655 a25656 a25657 a25658 a25659 a25660 a25661 a25662 a25663 a25664 a25665 a25666 a25667 a25668 a25669 a25670 a25671 a25672 a25673 a25674 a25675 a25676 a25677 a25678 a25679 a25680 a25681 a25682 a25683 a25684 a25685 a25686 a25687 a25688 a25689 a25690 a25691 a25692 a25693 a25694 a25695 a25696 a25697 a25698 a25699 a25700 a25701 a25702 a25703 a25704 a25705 a25706 a25707 a25708 a25709 a25710 a25711 a25712 a25713 a25714 a25715 a25716 a25717 a25718 a25719 a25720 a25721 a25722 a25723 a25724 a25725 a25726 a25727 a25728 a25729 a25730 a25731 a25732 a25733 a25734 a25735 a25736 a25737 a25738 a25739 a25740 a25741 a25742 a25743 a25744 a25745 a25746 a25747 a25748 a25749 a25750 a25751 a25752 a25753 a25754 a25755 a25756 a25757 a25758 a25759 a25760 a25761 a25762 a25763 a25764 a25765 a25766 a25767 a25768 a25769 a25770 a25771 a25772 a25773 a25774 a25775 a25776 a25777 a25778 a25779 a25780 a25781 a25782 a25783 a25784 a25785 a25786 a25787 a25788 a25789 a25790 a25791 a25792 a25793 a25794 a25795 a25796 a25797 a25798 a25799 a25800 a25801 a25802 a25803 a25804 a25805 a25806 a25807 a25808 a25809 a25810 a25811 a25812 a25813 a25814 a25815 a25816 a25817 a25818 a25819 a25820 a25821 a25822 a25823 a25824 a25825 a25826 a25827 a25828 a25829 a25830 a25831 a25832 a25833 a25834 a25835 a25836 a25837 a25838 a25839 a25840 a25841 a25842 a25843 a25844 a25845 a25846 a25847 a25848 a25849 a25850 a25851 a25852 a25853 a25854 a25855 a25856 a25857 a25858 a25859 a25860 a25861 a25862 a25863 a25864 a25865 a25866 a25867 a25868 a25869 a25870 a25871 a25872 a25873 a25874 a25875 a25876 a25877 a25878 a25879 a25880 a25881 a25882 a25883 a25884 a25885 a25886 a25887 a25888 a25889 a25890 a25891 a25892 a25893 a25894 a25895 a25896 a25897 a25898 a25899 a25900 a25901 a25902 a25903 a25904 a25905 a25906 a25907 a25908 a25909 a25910 a25911 a25912 a25913 a25914 a25915 a25916 a25917 a25918 a25919 a25920 a25921 a25922 a25923 a25924 a25925 a25926 a25927 a25928 a25929 a25930 a25931 a25932 a25933 a25934 a25935 a25936 a25937 a25938 a25939 a25940 a25941 a25942 a25943 a25944 a25945 a25946 a25947 a25948 a25949 a25950 a25951 a25952 a25953 a25954 a25955 a25956 a25957 a25958 a25959 a25960 a25961 a25962 a25963 a25964 a25965 a25966 a25967 a25968 a25969 a25970 a25971 a25972 a25973 a25974 a25975 a25976 a25977 a25978 a25979 a25980 a25981 a25982 a25983 a25984 a25985 a25986 a25987 a25988 a25989 a25990 a25991 a25992 a25993 a25994 a25995 a25996 a25997 a25998 a25999 a26000 a26001 a26002 a26003 a26004 a26005 a26006 a26007 a26008 a26009 a26010 a26011 a26012 a26013 a26014 a26015 a26016 a26017 a26018 a26019 a26020 a26021 a26022 a26023 a26024 a26025 a26026 a26027 a26028 a26029 a26030 a26031 a26032 a26033 a26034 a26035 a26036 a26037 a26038 a26039 a26040 a26041 a26042 a26043 a26044 a26045 a26046 a26047 a26048 a26049 a26050 a26051 a26052 a26053 a26054 a26055 a26056 a26057 a26058 a26059 a26060 a26061 a26062 a26063 a26064 a26065 a26066 a26067 a26068 a26069 a26070 a26071 a26072 a26073 a26074 a26075 a26076 a26077 a26078 a26079 a26080 a26081 a26082 a26083 a26084 a26085 a26086 a26087 a26088 a26089 a26090 a26091 a26092 a26093 a26094 a26095 a26096 a26097 a26098 a26099 a26100 a26101 a26102 a26103 a26104 a26105 a26106 a26107 a26108 a26109 a26110 a26111 a26112 a26113 a26114 a26115 a26116 a26117 a26118 a26119 a26120 a26121 a26122 a26123 a26124 a26125 a26126 a26127 a26128 a26129 a26130 a26131 a26132 a26133 a26134 a26135 a26136 a26137 a26138 a26139 a26140 a26141 a26142 a26143 a26144 a26145 a26146 a26147 a26148 a26149 a26150 a26151 a26152 a26153 a26154 a26155 a26156 a26157 a26158 a26159 a26160 a26161 a26162 a26163 a26164 a26165 a26166 a26167 a26168 a26169 a26170 a26171 a26172 a26173 a26174 a26175 a26176 a26177 a26178 a26179 a26180 a26181 a26182 a26183 a26184 a26185 a26186 a26187 a26188 a26189 a26190 a26191 a26192 a26193 a26194 a26195 a26196 a26197 a26198 a26199 a26200 a26201 a26202 a26203 a26204 a26205 a26206 a26207 a26208 a26209 a26210 a26211 a26212 a26213 a26214 a26215 a26216 a26217 a26218 a26219 a26220 a26221 a26222 a26223 a26224 a26225 a26226 a26227 a26228 a26229 a26230 a26231 a26232 a26233 a26234 a26235 a26236 a26237 a26238 a26239 a26240 a26241 a26242 a26243 a26244 a26245 a26246 a26247 a26248 a26249 a26250 a26251 a26252 a26253 a26254 a26255 a26256 a26257 a26258 a26259 a26260 a26261 a26262 a26263 a26264 a26265 a26266 a26267 a26268 a26269 a26270 a26271 a26272 a26273 a26274 a26275 a26276 a26277 a26278 a26279 a26280 a26281 a26282 a26283 a26284 a26285 a26286 a26287 a26288 a26289 a26290 a26291 a26292 a26293 a26294 a26295 a26296 a26297 a26298 a26299 a26300 a26301 a26302 a26303 a26304 a26305 a26306 a26307 a26308 a26309 a26310 a26311 a26312 a26313 a26314 a26315 a26316 a26317 a26318 a26319 a26320 a26321 a26322 a26323 a26324 a26325 a26326 a26327 a26328 a26329 a26330 a26331 a26332 a26333 a26334 a26335 a26336 a26337 a26338 a26339 a26340 a26341 a26342 a26343 a26344 a26345 a26346 a26347 a26348 a26349 a26350 a26351 a26352 a26353 a26354 a26355 a26356 a26357 a26358 a26359 a26360 a26361 a26362 a26363 a26364 a26365 a26366 a26367 a26368 a26369 a26370 a26371 a26372 a26373 a26374 a26375 a26376 a26377 a26378 a26379 a26380 a26381 a26382 a26383 a26384 a26385 a26386 a26387 a26388 a26389 a26390 a26391 a26392 a26393 a26394 a26395 a26396 a26397 a26398 a26399 a26400 a26401 a26402 a26403 a26404 a26405 a26406 a26407 a26408 a26409 a26410 a26411 a26412 a26413 a26414 a26415 a26416 a26417 a26418 a26419 a26420 a26421 a26422 a26423 a26424 a26425 a26426 a26427 a26428 a26429 a26430 a26431 a26432 a26433 a26434 a26435 a26436 a26437 a26438 a26439 a26440 a26441 a26442 a26443 a26444 a26445 a26446 a26447 a26448 a26449 a26450 a26451 a26452 a26453 a26454 a26455 a26456 a26457 a26458 a26459 a26460 a26461 a26462 a26463 a26464 a26465 a26466 a26467 a26468 a26469 a26470 a26471 a26472 a26473 a26474 a26475 a26476 a26477 a26478 a26479 a26480 a26481 a26482 a26483 a26484 a26485 a26486 a26487 a26488 a26489 a26490 a26491 a26492 a26493 a26494 a26495 a26496 a26497 a26498 a26499 a26500 a26501 a26502 a26503 a26504 a26505 a26506 a26507 a26508 a26509 a26510 a26511 a26512 a26513 a26514 a26515 a26516 a26517 a26518 a26519 a26520 a26521 a26522 a26523 a26524 a26525 a26526 a26527 a26528 a26529 a26530 a26531 a26532 a26533 a26534 a26535 a26536 a26537 a26538 a26539 a26540 a26541 a26542 a26543 a26544 a26545 a26546 a26547 a26548 a26549 a26550 a26551 a26552 a26553 a26554 a26555 a26556 a26557 a26558 a26559 a26560 a26561 a26562 a26563 a26564 a26565 a26566 a26567 a26568 a26569 a26570 a26571 a26572 a26573 a26574 a26575 a26576 a26577 a26578 a26579 a26580 a26581 a26582 a26583 a26584 a26585 a26586 a26587 a26588 a26589 a26590 a26591 a26592 a26593 a26594 a26595 a26596 a26597 a26598 a26599 a26600 a26601 a26602 a26603 a26604 a26605 a26606 a26607 a26608 a26609 a26610 a26611 a26612 a26613 a26614 a26615 a26616 a26617 a26618 a26619 a26620 a26621 a26622 a26623 a26624 a26625 a26626 a26627 a26628 a26629 a26630 a26631 a26632 a26633 a26634 a26635 a26636 a26637 a26638 a26639 a26640 a26641 a26642 a26643 a26644 a26645 a26646 a26647 a26648 a26649 a26650 a26651 a26652 a26653 a26654 a26655 a26656 a26657 a26658 a26659 a26660 a26661 a26662 a26663 a26664 a26665 a26666 a26667 a26668 a26669 a26670 a26671 a26672 a26673 a26674 a26675 a26676 a26677 a26678 a26679 a26680 a26681 a26682 a26683 a26684 a26685 a26686 a26687 a26688 a26689 a26690 a26691 a26692 a26693 a26694 a26695 a26696 a26697 a26698 a26699 a26700 a26701 a26702 a26703 a26704 a26705 a26706 a26707 a26708 a26709 a26710 a26711 a26712 a26713 a26714 a26715 a26716 a26717 a26718 a26719 a26720 a26721 a26722 a26723 a26724 a26725 a26726 a26727 a26728 a26729 a26730 a26731 a26732 a26733 a26734 a26735 a26736 a26737 a26738 a26739 a26740 a26741 a26742 a26743 a26744 a26745 a26746 a26747 a26748 a26749 a26750 a26751 a26752 a26753 a26754 a26755 a26756 a26757 a26758 a26759 a26760 a26761 a26762 a26763 a26764 a26765 a26766 a26767 a26768 a26769 a26770 a26771 a26772 a26773 a26774 a26775 a26776 a26777 a26778 a26779 a26780 a26781 a26782 a26783 a26784 a26785 a26786 a26787 a26788 a26789 a26790 a26791 a26792 a26793 a26794 a26795 a26796 a26797 a26798 a26799 a26800 a26801 a26802 a26803 a26804 a26805 a26806 a26807 a26808 a26809 a26810 a26811 a26812 a26813 a26814 a26815 a26816 a26817 a26818 a26819 a26820 a26821 a26822 a26823 a26824 a26825 a26826 a26827 a26828 a26829 a26830 a26831 a26832 a26833 a26834 a26835 a26836 a26837 a26838 a26839 a26840 a26841 a26842 a26843 a26844 a26845 a26846 a26847 a26848 a26849 a26850 a26851 a26852 a26853 a26854 a26855 a26856 a26857 a26858 a26859 a26860 a26861 a26862 a26863 a26864 a26865 a26866 a26867 a26868 a26869 a26870 a26871 a26872 a26873 a26874 a26875 a26876 a26877 a26878 a26879 a26880 a26881 a26882 a26883 a26884 a26885 a26886 a26887 a26888 a26889 a26890 a26891 a26892 a26893 a26894 a26895 a26896 a26897 a26898 a26899 a26900 a26901 a26902 a26903 a26904 a26905 a26906 a26907 a26908 a26909 a26910 a26911 a26912 a26913 a26914 a26915 a26916 a26917 a26918 a26919 a26920 a26921 a26922 a26923 a26924 a26925 a26926 a26927 a26928 a26929 a26930 a26931 a26932 a26933 a26934 a26935 a26936 a26937 a26938 a26939 a26940 a26941 a26942 a26943 a26944 a26945 a26946 a26947 a26948 a26949 a26950 a26951 a26952 a26953 a26954 a26955 a26956 a26957 a26958 a26959 a26960 a26961 a26962 a26963 a26964 a26965 a26966 a26967 a26968 a26969 a26970 a26971 a26972 a26973 a26974 a26975 a26976 a26977 a26978 a26979 a26980 a26981 a26982 a26983 a26984 a26985 a26986 a26987 a26988 a26989 a26990 a26991 a26992 a26993 a26994 a26995 a26996 a26997 a26998 a26999 a27000 a27001 a27002 a27003 a27004 a27005 a27006 a27007 a27008 a27009 a27010 a27011 a27012 a27013 a27014 a27015 a27016 a27017 a27018 a27019 a27020 a27021 a27022 a27023 a27024 a27025 a27026 a27027 a27028 a27029 a27030 a27031 a27032 a27033 a27034 a27035 a27036 a27037 a27038 a27039 a27040 a27041 a27042 a27043 a27044 a27045 a27046 a27047 a27048 a27049 a27050 a27051 a27052 a27053 a27054 a27055 a27056 a27057 a27058 a27059 a27060 a27061 a27062 a27063 a27064 a27065 a27066 a27067 a27068 a27069 a27070 a27071 a27072 a27073 a27074 a27075 a27076 a27077 a27078 a27079 a27080 a27081 a27082 a27083 a27084 a27085 a27086 a27087 a27088 a27089 a27090 a27091 a27092 a27093 a27094 a27095 a27096 a27097 a27098 a27099 a27100 a27101 a27102 a27103 a27104 a27105 a27106 a27107 a27108 a27109 a27110 a27111 a27112 a27113 a27114 a27115 a27116 a27117 a27118 a27119 a27120 a27121 a27122 a27123 a27124 a27125 a27126 a27127 a27128 a27129 a27130 a27131 a27132 a27133 a27134 a27135 a27136 a27137 a27138 a27139 a27140 a27141 a27142 a27143 a27144 a27145 a27146 a27147 a27148 a27149 a27150 a27151 a27152 a27153 a27154 a27155 a27156 a27157 a27158 a27159 a27160 a27161 a27162 a27163 a27164 a27165 a27166 a27167 a27168 a27169 a27170 a27171 a27172 a27173 a27174 a27175 a27176 a27177 a27178 a27179 a27180 a27181 a27182 a27183 a27184 a27185 a27186 a27187 a27188 a27189 a27190 a27191 a27192 a27193 a27194 a27195 a27196 a27197 a27198 a27199 a27200 a27201 a27202 a27203 a27204 a27205 a27206 a27207 a27208 a27209 a27210 a27211 a27212 a27213 a27214 a27215 a27216 a27217 a27218 a27219 a27220 a27221 a27222 a27223 a27224 a27225 a27226 a27227 a27228 a27229 a27230 a27231 a27232 a27233 a27234 a27235 a27236 a27237 a27238 a27239 a27240 a27241 a27242 a27243 a27244 a27245 a27246 a27247 a27248 a27249 a27250 a27251 a27252 a27253 a27254 a27255 a27256 a27257 a27258 a27259 a27260 a27261 a27262 a27263 a27264 a27265 a27266 a27267 a27268 a27269 a27270 a27271 a27272 a27273 a27274 a27275 a27276 a27277 a27278 a27279 a27280 a27281 a27282 a27283 a27284 a27285 a27286 a27287 a27288 a27289 a27290 a27291 a27292 a27293 a27294 a27295 a27296 a27297 a27298 a27299 a27300 a27301 a27302 a27303 a27304 a27305 a27306 a27307 a27308 a27309 a27310 a27311 a27312 a27313 a27314 a27315 a27316 a27317 a27318 a27319 a27320 a27321 a27322 a27323 a27324 a27325 a27326 a27327 a27328 a27329 a27330 a27331 a27332 a27333 a27334 a27335 a27336 a27337 a27338 a27339 a27340 a27341 a27342 a27343 a27344 a27345 a27346 a27347 a27348 a27349 a27350 a27351 a27352 a27353 a27354 a27355 a27356 a27357 a27358 a27359 a27360 a27361 a27362 a27363 a27364 a27365 a27366 a27367 a27368 a27369 a27370 a27371 a27372 a27373 a27374 a27375 a27376 a27377 a27378 a27379 a27380 a27381 a27382 a27383 a27384 a27385 a27386 a27387 a27388 a27389 a27390 a27391 a27392 a27393 a27394 a27395 a27396 a27397 a27398 a27399 a27400 a27401 a27402 a27403 a27404 a27405 a27406 a27407 a27408 a27409 a27410 a27411 a27412 a27413 a27414 a27415 a27416 a27417 a27418 a27419 a27420 a27421 a27422 a27423 a27424 a27425 a27426 a27427 a27428 a27429 a27430 a27431 a27432 a27433 a27434 a27435 a27436 a27437 a27438 a27439 a27440 a27441 a27442 a27443 a27444 a27445 a27446 a27447 a27448 a27449 a27450 a27451 a27452 a27453 a27454 a27455 a27456 a27457 a27458 a27459 a27460 a27461 a27462 a27463 a27464 a27465 a27466 a27467 a27468 a27469 a27470 a27471 a27472 a27473 a27474 a27475 a27476 a27477 a27478 a27479 a27480 a27481 a27482 a27483 a27484 a27485 a27486 a27487 a27488 a27489 a27490 a27491 a27492 a27493 a27494 a27495 a27496 a27497 a27498 a27499 a27500 a27501 a27502 a27503 a27504 a27505 a27506 a27507 a27508 a27509 a27510 a27511 a27512 a27513 a27514 a27515 a27516 a27517 a27518 a27519 a27520 a27521 a27522 a27523 a27524 a27525 a27526 a27527 a27528 a27529 a27530 a27531 a27532 a27533 a27534 a27535 a27536 a27537 a27538 a27539 a27540 a27541 a27542 a27543 a27544 a27545 a27546 a27547 a27548 a27549 a27550 a27551 a27552 a27553 a27554 a27555 a27556 a27557 a27558 a27559 a27560 a27561 a27562 a27563 a27564 a27565 a27566 a27567 a27568 a27569 a27570 a27571 a27572 a27573 a27574 a27575 a27576 a27577 a27578 a27579 a27580 a27581 a27582 a27583 a27584 a27585 a27586 a27587 a27588 a27589 a27590 a27591 a27592 a27593 a27594 a27595 a27596 a27597 a27598 a27599 a27600 a27601 a27602 a27603 a27604 a27605 a27606 a27607 a27608 a27609 a27610 a27611 a27612 a27613 a27614 a27615 a27616 a27617 a27618 a27619 a27620 a27621 a27622 a27623 a27624 a27625 a27626 a27627 a27628 a27629 a27630 a27631 a27632 a27633 a27634 a27635 a27636 a27637 a27638 a27639 a27640 a27641 a27642 a27643 a27644 a27645 a27646 a27647 a27648 a27649 a27650 a27651 a27652 a27653 a27654 a27655 a27656 a27657 a27658 a27659 a27660 a27661 a27662 a27663 a27664 a27665 a27666 a27667 a27668 a27669 a27670 a27671 a27672 a27673 a27674 a27675 a27676 a27677 a27678 a27679 a27680 a27681 a27682 a27683 a27684 a27685 a27686 a27687 a27688 a27689 a27690 a27691 a27692 a27693 a27694 a27695 a27696 a27697 a27698 a27699 a27700 a27701 a27702 a27703 a27704 a27705 a27706 a27707 a27708 a27709 a27710 a27711 a27712 a27713 a27714 a27715 a27716 a27717 a27718 a27719 a27720 a27721 a27722 a27723 a27724 a27725 a27726 a27727 a27728 a27729 a27730 a27731 a27732 a27733 a27734 a27735 a27736 a27737 a27738 a27739 a27740 a27741 a27742 a27743 a27744 a27745 a27746 a27747 a27748 a27749 a27750 a27751 a27752 a27753 a27754 a27755 a27756 a27757 a27758 a27759 a27760 a27761 a27762 a27763 a27764 a27765 a27766 a27767 a27768 a27769 a27770 a27771 a27772 a27773 a27774 a27775 a27776 a27777 a27778 a27779 a27780 a27781 a27782 a27783 a27784 a27785 a27786 a27787 a27788 a27789 a27790 a27791 a27792 a27793 a27794 a27795 a27796 a27797 a27798 a27799 a27800 a27801 a27802 a27803 a27804 a27805 a27806 a27807 a27808 a27809 a27810 a27811 a27812 a27813 a27814 a27815 a27816 a27817 a27818 a27819 a27820 a27821 a27822 a27823 a27824 a27825 a27826 a27827 a27828 a27829 a27830 a27831 a27832 a27833 a27834 a27835 a27836 a27837 a27838 a27839 a27840 a27841 a27842 a27843 a27844 a27845 a27846 a27847 a27848 a27849 a27850 a27851 a27852 a27853 a27854 a27855 a27856 a27857 a27858 a27859 a27860 a27861 a27862 a27863 a27864 a27865 a27866 a27867 a27868 a27869 a27870 a27871 a27872 a27873 a27874 a27875 a27876 a27877 a27878 a27879 a27880 a27881 a27882 a27883 a27884 a27885 a27886 a27887 a27888 a27889 a27890 a27891 a27892 a27893 a27894 a27895 a27896 a27897 a27898 a27899 a27900 a27901 a27902 a27903 a27904 a27905 a27906 a27907 a27908 a27909 a27910 a27911 a27912 a27913 a27914 a27915 a27916 a27917 a27918 a27919 a27920 a27921 a27922 a27923 a27924 a27925 a27926 a27927 a27928 a27929 a27930 a27931 a27932 a27933 a27934 a27935 a27936 a27937 a27938 a27939 a27940 a27941 a27942 a27943 a27944 a27945 a27946 a27947 a27948 a27949 a27950 a27951 a27952 a27953 a27954 a27955 a27956 a27957 a27958 a27959 a27960 a27961 a27962 a27963 a27964 a27965 a27966 a27967 a27968 a27969 a27970 a27971 a27972 a27973 a27974 a27975 a27976 a27977 a27978 a27979 a27980 a27981 a27982 a27983 a27984 a27985 a27986 a27987 a27988 a27989 a27990 a27991 a27992 a27993 a27994 a27995 a27996 a27997 a27998 a27999 a28000 a28001 a28002 a28003 a28004 a28005 a28006 a28007 a28008 a28009 a28010 a28011 a28012 a28013 a28014 a28015 a28016 a28017 a28018 a28019 a28020 a28021 a28022 a28023 a28024 a28025 a28026 a28027 a28028 a28029 a28030 a28031 a28032 a28033 a28034 a28035 a28036 a28037 a28038 a28039 a28040 a28041 a28042 a28043 a28044 a28045 a28046 a28047 a28048 a28049 a28050 a28051 a28052 a28053 a28054 a28055 a28056 a28057 a28058 a28059 a28060 a28061 a28062 a28063 a28064 a28065 a28066 a28067 a28068 a28069 a28070 a28071 a28072 a28073 a28074 a28075 a28076 a28077 a28078 a28079 a28080 a28081 a28082 a28083 a28084 a28085 a28086 a28087 a28088 a28089 a28090 a28091 a28092 a28093 a28094 a28095 a28096 a28097 a28098 a28099 a28100 a28101 a28102 a28103 a28104 a28105 a28106 a28107 a28108 a28109 a28110 a28111 a28112 a28113 a28114 a28115 a28116 a28117 a28118 a28119 a28120 a28121 a28122 a28123 a28124 a28125 a28126 a28127 a28128 a28129 a28130 a28131 a28132 a28133 a28134 a28135 a28136 a28137 a28138 a28139 a28140 a28141 a28142 a28143 a28144 a28145 a28146 a28147 a28148 a28149 a28150 a28151 a28152 a28153 a28154 a28155 a28156 a28157 a28158 a28159 a28160 a28161 a28162 a28163 a28164 a28165 a28166 a28167 a28168 a28169 a28170 a28171 a28172 a28173 a28174 a28175 a28176 a28177 a28178 a28179 a28180 a28181 a28182 a28183 a28184 a28185 a28186 a28187 a28188 a28189 a28190 a28191 a28192 a28193 a28194 a28195 a28196 a28197 a28198 a28199 a28200 a28201 a28202 a28203 a28204 a28205 a28206 a28207 a28208 a28209 a28210 a28211 a28212 a28213 a28214 a28215 a28216 a28217 a28218 a28219 a28220 a28221 a28222 a28223 a28224 a28225 a28226 a28227 a28228 a28229 a28230 a28231 a28232 a28233 a28234 a28235 a28236 a28237 a28238 a28239 a28240 a28241 a28242 a28243 a28244 a28245 a28246 a28247 a28248 a28249 a28250 a28251 a28252 a28253 a28254 a28255 a28256 a28257 a28258 a28259 a28260 a28261 a28262 a28263 a28264 a28265 a28266 a28267 a28268 a28269 a28270 a28271 a28272 a28273 a28274 a28275 a28276 a28277 a28278 a28279 a28280 a28281 a28282 a28283 a28284 a28285 a28286 a28287 a28288 a28289 a28290 a28291 a28292 a28293 a28294 a28295 a28296 a28297 a28298 a28299 a28300 a28301 a28302 a28303 a28304 a28305 a28306 a28307 a28308 a28309 a28310 a28311 a28312 a28313 a28314 a28315 a28316 a28317 a28318 a28319 a28320 a28321 a28322 a28323 a28324 a28325 a28326 a28327 a28328 a28329 a28330 a28331 a28332 a28333 a28334 a28335 a28336 a28337 a28338 a28339 a28340 a28341 a28342 a28343 a28344 a28345 a28346 a28347 a28348 a28349 a28350 a28351 a28352 a28353 a28354 a28355 a28356 a28357 a28358 a28359 a28360 a28361 a28362 a28363 a28364 a28365 a28366 a28367 a28368 a28369 a28370 a28371 a28372 a28373 a28374 a28375 a28376 a28377 a28378 a28379 a28380 a28381 a28382 a28383 a28384 a28385 a28386 a28387 a28388 a28389 a28390 a28391 a28392 a28393 a28394 a28395 a28396 a28397 a28398 a28399 a28400 a28401 a28402 a28403 a28404 a28405 a28406 a28407 a28408 a28409 a28410 a28411 a28412 a28413 a28414 a28415 a28416 a28417 a28418 a28419 a28420 a28421 a28422 a28423 a28424 a28425 a28426 a28427 a28428 a28429 a28430 a28431 a28432 a28433 a28434 a28435 a28436 a28437 a28438 a28439 a28440 a28441 a28442 a28443 a28444 a28445 a28446 a28447 a28448 a28449 a28450 a28451 a28452 a28453 a28454 a28455 a28456 a28457 a28458 a28459 a28460 a28461 a28462 a28463 a28464 a28465 a28466 a28467 a28468 a28469 a28470 a28471 a28472 a28473 a28474 a28475 a28476 a28477 a28478 a28479 a28480 a28481 a28482 a28483 a28484 a28485 a28486 a28487 a28488 a28489 a28490 a28491 a28492 a28493 a28494 a28495 a28496 a28497 a28498 a28499 a28500 a28501 a28502 a28503 a28504 a28505 a28506 a28507 a28508 a28509 a28510 a28511 a28512 a28513 a28514 a28515 a28516 a28517 a28518 a28519 a28520 a28521 a28522 a28523 a28524 a28525 a28526 a28527 a28528 a28529 a28530 a28531 a28532 a28533 a28534 a28535 a28536 a28537 a28538 a28539 a28540 a28541 a28542 a28543 a28544 a28545 a28546 a28547 a28548 a28549 a28550 a28551 a28552 a28553 a28554 a28555 a28556 a28557 a28558 a28559 a28560 a28561 a28562 a28563 a28564 a28565 a28566 a28567 a28568 a28569 a28570 a28571 a28572 a28573 a28574 a28575 a28576 a28577 a28578 a28579 a28580 a28581 a28582 a28583 a28584 a28585 a28586 a28587 a28588 a28589 a28590 a28591 a28592 a28593 a28594 a28595 a28596 a28597 a28598 a28599 a28600 a28601 a28602 a28603 a28604 a28605 a28606 a28607 a28608 a28609 a28610 a28611 a28612 a28613 a28614 a28615 a28616 a28617 a28618 a28619 a28620 a28621 a28622 a28623 a28624 a28625 a28626 a28627 a28628 a28629 a28630 a28631 a28632 a28633 a28634 a28635 a28636 a28637 a28638 a28639 a28640 a28641 a28642 a28643 a28644 a28645 a28646 a28647 a28648 a28649 a28650 a28651 a28652 a28653 a28654 a28655 a28656 a28657 a28658 a28659 a28660 a28661 a28662 a28663 a28664 a28665 a28666 a28667 a28668 a28669 a28670 a28671 a28672 a28673 a28674 a28675 a28676 a28677 a28678 a28679 a28680 a28681 a28682 a28683 a28684 a28685 a28686 a28687 a28688 a28689 a28690 a28691 a28692 a28693 a28694 a28695 a28696 a28697 a28698 a28699 a28700 a28701 a28702 a28703 a28704 a28705 a28706 a28707 a28708 a28709 a28710 a28711 a28712 a28713 a28714 a28715 a28716 a28717 a28718 a28719 a28720 a28721 a28722 a28723 a28724 a28725 a28726 a28727 a28728 a28729 a28730 a28731 a28732 a28733 a28734 a28735 a28736 a28737 a28738 a28739 a28740 a28741 a28742 a28743 a28744 a28745 a28746 a28747 a28748 a28749 a28750 a28751 a28752 a28753 a28754 a28755 a28756 a28757 a28758 a28759 a28760 a28761 a28762 a28763 a28764 a28765 a28766 a28767 a28768 a28769 a28770 a28771 a28772 a28773 a28774 a28775 a28776 a28777 a28778 a28779 a28780 a28781 a28782 a28783 a28784 a28785 a28786 a28787 a28788 a28789 a28790 a28791 a28792 a28793 a28794 a28795 a28796 a28797 a28798 a28799 a28800 a28801 a28802 a28803 a28804 a28805 a28806 a28807 a28808 a28809 a28810 a28811 a28812 a28813 a28814 a28815 a28816 a28817 a28818 a28819 a28820 a28821 a28822 a28823 a28824 a28825 a28826 a28827 a28828 a28829 a28830 a28831 a28832 a28833 a28834 a28835 a28836 a28837 a28838 a28839 a28840 a28841 a28842 a28843 a28844 a28845 a28846 a28847 a28848 a28849 a28850 a28851 a28852 a28853 a28854 a28855 a28856 a28857 a28858 a28859 a28860 a28861 a28862 a28863 a28864 a28865 a28866 a28867 a28868 a28869 a28870 a28871 a28872 a28873 a28874 a28875 a28876 a28877 a28878 a28879 a28880 a28881 a28882 a28883 a28884 a28885 a28886 a28887 a28888 a28889 a28890 a28891 a28892 a28893 a28894 a28895 a28896 a28897 a28898 a28899 a28900 a28901 a28902 a28903 a28904 a28905 a28906 a28907 a28908 a28909 a28910 a28911 a28912 a28913 a28914 a28915 a28916 a28917 a28918 a28919 a28920 a28921 a28922 a28923 a28924 a28925 a28926 a28927 a28928 a28929 a28930 a28931 a28932 a28933 a28934 a28935 a28936 a28937 a28938 a28939 a28940 a28941 a28942 a28943 a28944 a28945 a28946 a28947 a28948 a28949 a28950 a28951 a28952 a28953 a28954 a28955 a28956 a28957 a28958 a28959 a28960 a28961 a28962 a28963 a28964 a28965 a28966 a28967 a28968 a28969 a28970 a28971 a28972 a28973 a28974 a28975 a28976 a28977 a28978 a28979 a28980 a28981 a28982 a28983 a28984 a28985 a28986 a28987 a28988 a28989 a28990 a28991 a28992 a28993 a28994 a28995 a28996 a28997 a28998 a28999 a29000 a29001 a29002 a29003 a29004 a29005 a29006 a29007 a29008 a29009 a29010 a29011 a29012 a29013 a29014 a29015 a29016 a29017 a29018 a29019 a29020 a29021 a29022 a29023 a29024 a29025 a29026 a29027 a29028 a29029 a29030 a29031 a29032 a29033 a29034 a29035 a29036 a29037 a29038 a29039 a29040 a29041 a29042 a29043 a29044 a29045 a29046 a29047 a29048 a29049 a29050 a29051 a29052 a29053 a29054 a29055 a29056 a29057 a29058 a29059 a29060 a29061 a29062 a29063 a29064 a29065 a29066 a29067 a29068 a29069 a29070 a29071 a29072 a29073 a29074 a29075 a29076 a29077 a29078 a29079 a29080 a29081 a29082 a29083 a29084 a29085 a29086 a29087 a29088 a29089 a29090 a29091 a29092 a29093 a29094 a29095 a29096 a29097 a29098 a29099 a29100 a29101 a29102 a29103 a29104 a29105 a29106 a29107 a29108 a29109 a29110 a29111 a29112 a29113 a29114 a29115 a29116 a29117 a29118 a29119 a29120 a29121 a29122 a29123 a29124 a29125 a29126 a29127 a29128 a29129 a29130 a29131 a29132 a29133 a29134 a29135 a29136 a29137 a29138 a29139 a29140 a29141 a29142 a29143 a29144 a29145 a29146 a29147 a29148 a29149 a29150 a29151 a29152 a29153 a29154 a29155 a29156 a29157 a29158 a29159 a29160 a29161 a29162 a29163 a29164 a29165 a29166 a29167 a29168 a29169 a29170 a29171 a29172 a29173 a29174 a29175 a29176 a29177 a29178 a29179 a29180 a29181 a29182 a29183 a29184 a29185 a29186 a29187 a29188 a29189 a29190 a29191 a29192 a29193 a29194 a29195 a29196 a29197 a29198 a29199 a29200 a29201 a29202 a29203 a29204 a29205 a29206 a29207 a29208 a29209 a29210 a29211 a29212 a29213 a29214 a29215 a29216 a29217 a29218 a29219 a29220 a29221 a29222 a29223 a29224 a29225 a29226 a29227 a29228 a29229 a29230 a29231 a29232 a29233 a29234 a29235 a29236 a29237 a29238 a29239 a29240 a29241 a29242 a29243 a29244 a29245 a29246 a29247 a29248 a29249 a29250 a29251 a29252 a29253 a29254 a29255 a29256 a29257 a29258 a29259 a29260 a29261 a29262 a29263 a29264 a29265 a29266 a29267 a29268 a29269 a29270 a29271 a29272 a29273 a29274 a29275 a29276 a29277 a29278 a29279 a29280 a29281 a29282 a29283 a29284 a29285 a29286 a29287 a29288 a29289 a29290 a29291 a29292 a29293 a29294 a29295 a29296 a29297 a29298 a29299 a29300 a29301 a29302 a29303 a29304 a29305 a29306 a29307 a29308 a29309 a29310 a29311 a29312 a29313 a29314 a29315 a29316 a29317 a29318 a29319 a29320 a29321 a29322 a29323 a29324 a29325 a29326 a29327 a29328 a29329 a29330 a29331 a29332 a29333 a29334 a29335 a29336 a29337 a29338 a29339 a29340 a29341 a29342 a29343 a29344 a29345 a29346 a29347 a29348 a29349 a29350 a29351 a29352 a29353 a29354 a29355 a29356 a29357 a29358 a29359 a29360 a29361 a29362 a29363 a29364 a29365 a29366 a29367 a29368 a29369 a29370 a29371 a29372 a29373 a29374 a29375 a29376 a29377 a29378 a29379 a29380 a29381 a29382 a29383 a29384 a29385 a29386 a29387 a29388 a29389 a29390 a29391 a29392 a29393 a29394 a29395 a29396 a29397 a29398 a29399 a29400 a29401 a29402 a29403 a29404 a29405 a29406 a29407 a29408 a29409 a29410 a29411 a29412 a29413 a29414 a29415 a29416 a29417 a29418 a29419 a29420 a29421 a29422 a29423 a29424 a29425 a29426 a29427 a29428 a29429 a29430 a29431 a29432 a29433 a29434 a29435 a29436 a29437 a29438 a29439 a29440 a29441 a29442 a29443 a29444 a29445 a29446 a29447 a29448 a29449 a29450 a29451 a29452 a29453 a29454 a29455 a29456 a29457 a29458 a29459 a29460 a29461 a29462 a29463 a29464 a29465 a29466 a29467 a29468 a29469 a29470 a29471 a29472 a29473 a29474 a29475 a29476 a29477 a29478 a29479 a29480 a29481 a29482 a29483 a29484 a29485 a29486 a29487 a29488 a29489 a29490 a29491 a29492 a29493 a29494 a29495 a29496 a29497 a29498 a29499 a29500 a29501 a29502 a29503 a29504 a29505 a29506 a29507 a29508 a29509 a29510 a29511 a29512 a29513 a29514 a29515 a29516 a29517 a29518 a29519 a29520 a29521 a29522 a29523 a29524 a29525 a29526 a29527 a29528 a29529 a29530 a29531 a29532 a29533 a29534 a29535 a29536 a29537 a29538 a29539 a29540 a29541 a29542 a29543 a29544 a29545 a29546 a29547 a29548 a29549 a29550 a29551 a29552 a29553 a29554 a29555 a29556 a29557 a29558 a29559 a29560 a29561 a29562 a29563 a29564 a29565 a29566 a29567 a29568 a29569 a29570 a29571 a29572 a29573 a29574 a29575 a29576 a29577 a29578 a29579 a29580 a29581 a29582 a29583 a29584 a29585 a29586 a29587 a29588 a29589 a29590 a29591 a29592 a29593 a29594 a29595 a29596 a29597 a29598 a29599 a29600 a29601 a29602 a29603 a29604 a29605 a29606 a29607 a29608 a29609 a29610 a29611 a29612 a29613 a29614 a29615 a29616 a29617 a29618 a29619 a29620 a29621 a29622 a29623 a29624 a29625 a29626 a29627 a29628 a29629 a29630 a29631 a29632 a29633 a29634 a29635 a29636 a29637 a29638 a29639 a29640 a29641 a29642 a29643 a29644 a29645 a29646 a29647 a29648 a29649 a29650 a29651 a29652 a29653 a29654 a29655 a29656 a29657 a29658 a29659 a29660 a29661 a29662 a29663 a29664 a29665 a29666 a29667 a29668 a29669 a29670 a29671 a29672 a29673 a29674 a29675 a29676 a29677 a29678 a29679 a29680 a29681 a29682 a29683 a29684 a29685 a29686 a29687 a29688 a29689 a29690 a29691 a29692 a29693 a29694 a29695 a29696 a29697 a29698 a29699 a29700 a29701 a29702 a29703 a29704 a29705 a29706 a29707 a29708 a29709 a29710 a29711 a29712 a29713 a29714 a29715 a29716 a29717 a29718 a29719 a29720 a29721 a29722 a29723 a29724 a29725 a29726 a29727 a29728 a29729 a29730 a29731 a29732 a29733 a29734 a29735 a29736 a29737 a29738 a29739 a29740 a29741 a29742 a29743 a29744 a29745 a29746 a29747 a29748 a29749 a29750 a29751 a29752 a29753 a29754 a29755 a29756 a29757 a29758 a29759 a29760 a29761 a29762 a29763 a29764 a29765 a29766 a29767 a29768 a29769 a29770 a29771 a29772 a29773 a29774 a29775 a29776 a29777 a29778 a29779 a29780 a29781 a29782 a29783 a29784 a29785 a29786 a29787 a29788 a29789 a29790 a29791 a29792 a29793 a29794 a29795 a29796 a29797 a29798 a29799 a29800 a29801 a29802 a29803 a29804 a29805 a29806 a29807 a29808 a29809 a29810 a29811 a29812 a29813 a29814 a29815 a29816 a29817 a29818 a29819 a29820 a29821 a29822 a29823 a29824 a29825 a29826 a29827 a29828 a29829 a29830 a29831 a29832 a29833 a29834 a29835 a29836 a29837 a29838 a29839 a29840 a29841 a29842 a29843 a29844 a29845 a29846 a29847 a29848 a29849 a29850 a29851 a29852 a29853 a29854 a29855 a29856 a29857 a29858 a29859 a29860 a29861 a29862 a29863 a29864 a29865 a29866 a29867 a29868 a29869 a29870 a29871 a29872 a29873 a29874 a29875 a29876 a29877 a29878 a29879 a29880 a29881 a29882 a29883 a29884 a29885 a29886 a29887 a29888 a29889 a29890 a29891 a29892 a29893 a29894 a29895 a29896 a29897 a29898 a29899 a29900 a29901 a29902 a29903 a29904 a29905 a29906 a29907 a29908 a29909 a29910 a29911 a29912 a29913 a29914 a29915 a29916 a29917 a29918 a29919 a29920 a29921 a29922 a29923 a29924 a29925 a29926 a29927 a29928 a29929 a29930 a29931 a29932 a29933 a29934 a29935 a29936 a29937 a29938 a29939 a29940 a29941 a29942 a29943 a29944 a29945 a29946 a29947 a29948 a29949 a29950 a29951 a29952 a29953 a29954 a29955 a29956 a29957 a29958 a29959 a29960 a29961 a29962 a29963 a29964 a29965 a29966 a29967 a29968 a29969 a29970 a29971 a29972 a29973 a29974 a29975 a29976 a29977 a29978 a29979 a29980 a29981 a29982 a29983 a29984 a29985 a29986 a29987 a29988 a29989 a29990 a29991 a29992 a29993 a29994 a29995 a29996 a29997 a29998 a29999 a30000 a30001 a30002 a30003 a30004 a30005 a30006 a30007 a30008 a30009 a30010 a30011 a30012 a30013 a30014 a30015 a30016 a30017 a30018 a30019 a30020 a30021 a30022 a30023 a30024 a30025 a30026 a30027 a30028 a30029 a30030 a30031 a30032 a30033 a30034 a30035 a30036 a30037 a30038 a30039 a30040 a30041 a30042 a30043 a30044 a30045 a30046 a30047 a30048 a30049 a30050 a30051 a30052 a30053 a30054 a30055 a30056 a30057 a30058 a30059 a30060 a30061 a30062 a30063 a30064 a30065 a30066 a30067 a30068 a30069 a30070 a30071 a30072 a30073 a30074 a30075 a30076 a30077 a30078 a30079 a30080 a30081 a30082 a30083 a30084 a30085 a30086 a30087 a30088 a30089 a30090 a30091 a30092 a30093 a30094 a30095 a30096 a30097 a30098 a30099 a30100 a30101 a30102 a30103 a30104 a30105 a30106 a30107 a30108 a30109 a30110 a30111 a30112 a30113 a30114 a30115 a30116 a30117 a30118 a30119 a30120 a30121 a30122 a30123 a30124 a30125 a30126 a30127 a30128 a30129 a30130 a30131 a30132 a30133 a30134 a30135 a30136 a30137 a30138 a30139 a30140 a30141 a30142 a30143 a30144 a30145 a30146 a30147 a30148 a30149 a30150 a30151 a30152 a30153 a30154 a30155 a30156 a30157 a30158 a30159 a30160 a30161 a30162 a30163 a30164 a30165 a30166 a30167 a30168 a30169 a30170 a30171 a30172 a30173 a30174 a30175 a30176 a30177 a30178 a30179 a30180 a30181 a30182 a30183 a30184 a30185 a30186 a30187 a30188 a30189 a30190 a30191 a30192 a30193 a30194 a30195 a30196 a30197 a30198 a30199 a30200 a30201 a30202 a30203 a30204 a30205 a30206 a30207 a30208 a30209 a30210 a30211 a30212 a30213 a30214 a30215 a30216 a30217 a30218 a30219 a30220 a30221 a30222 a30223 a30224 a30225 a30226 a30227 a30228 a30229 a30230 a30231 a30232 a30233 a30234 a30235 a30236 a30237 a30238 a30239 a30240 a30241 a30242 a30243 a30244 a30245 a30246 a30247 a30248 a30249 a30250 a30251 a30252 a30253 a30254 a30255 a30256 a30257 a30258 a30259 a30260 a30261 a30262 a30263 a30264 a30265 a30266 a30267 a30268 a30269 a30270 a30271 a30272 a30273 a30274 a30275 a30276 a30277 a30278 a30279 a30280 a30281 a30282 a30283 a30284 a30285 a30286 a30287 a30288 a30289 a30290 a30291 a30292 a30293 a30294 a30295 a30296 a30297 a30298 a30299 a30300 a30301 a30302 a30303 a30304 a30305 a30306 a30307 a30308 a30309 a30310 a30311 a30312 a30313 a30314 a30315 a30316 a30317 a30318 a30319 a30320 a30321 a30322 a30323 a30324 a30325 a30326 a30327 a30328 a30329 a30330 a30331 a30332 a30333 a30334 a30335 a30336 a30337 a30338 a30339 a30340 a30341 a30342 a30343 a30344 a30345 a30346 a30347 a30348 a30349 a30350 a30351 a30352 a30353 a30354 a30355 a30356 a30357 a30358 a30359 a30360 a30361 a30362 a30363 a30364 a30365 a30366 a30367 a30368 a30369 a30370 a30371 a30372 a30373 a30374 a30375 a30376 a30377 a30378 a30379 a30380 a30381 a30382 a30383 a30384 a30385 a30386 a30387 a30388 a30389 a30390 a30391 a30392 a30393 a30394 a30395 a30396 a30397 a30398 a30399 a30400 a30401 a30402 a30403 a30404 a30405 a30406 a30407 a30408 a30409 a30410 a30411 a30412 a30413 a30414 a30415 a30416 a30417 a30418 a30419 a30420 a30421 a30422 a30423 a30424 a30425 a30426 a30427 a30428 a30429 a30430 a30431 a30432 a30433 a30434 a30435 a30436 a30437 a30438 a30439 a30440 a30441 a30442 a30443 a30444 a30445 a30446 a30447 a30448 a30449 a30450 a30451 a30452 a30453 a30454 a30455 a30456 a30457 a30458 a30459 a30460 a30461 a30462 a30463 a30464 a30465 a30466 a30467 a30468 a30469 a30470 a30471 a30472 a30473 a30474 a30475 a30476 a30477 a30478 a30479 a30480 a30481 a30482 a30483 a30484 a30485 a30486 a30487 a30488 a30489 a30490 a30491 a30492 a30493 a30494 a30495 a30496 a30497 a30498 a30499 a30500 a30501 a30502 a30503 a30504 a30505 a30506 a30507 a30508 a30509 a30510 a30511 a30512 a30513 a30514 a30515 a30516 a30517 a30518 a30519 a30520 a30521 a30522 a30523 a30524 a30525 a30526 a30527 a30528 a30529 a30530 a30531 a30532 a30533 a30534 a30535 a30536 a30537 a30538 a30539 a30540 a30541 a30542 a30543 a30544 a30545 a30546 a30547 a30548 a30549 a30550 a30551 a30552 a30553 a30554 a30555 a30556 a30557 a30558 a30559 a30560 a30561 a30562 a30563 a30564 a30565 a30566 a30567 a30568 a30569 a30570 a30571 a30572 a30573 a30574 a30575 a30576 a30577 a30578 a30579 a30580 a30581 a30582 a30583 a30584 a30585 a30586 a30587 a30588 a30589 a30590 a30591 a30592 a30593 a30594 a30595 a30596 a30597 a30598 a30599 a30600 a30601 a30602 a30603 a30604 a30605 a30606 a30607 a30608 a30609 a30610 a30611 a30612 a30613 a30614 a30615 a30616 a30617 a30618 a30619 a30620 a30621 a30622 a30623 a30624 a30625 a30626 a30627 a30628 a30629 a30630 a30631 a30632 a30633 a30634 a30635 a30636 a30637 a30638 a30639 a30640 a30641 a30642 a30643 a30644 a30645 a30646 a30647 a30648 a30649 a30650 a30651 a30652 a30653 a30654 a30655 a30656 a30657 a30658 a30659 a30660 a30661 a30662 a30663 a30664 a30665 a30666 a30667 a30668 a30669 a30670 a30671 a30672 a30673 a30674 a30675 a30676 a30677 a30678 a30679 a30680 a30681 a30682 a30683 a30684 a30685 a30686 a30687 a30688 a30689 a30690 a30691 a30692 a30693 a30694 a30695 a30696 a30697 a30698 a30699 a30700 a30701 a30702 a30703 a30704 a30705 a30706 a30707 a30708 a30709 a30710 a30711 a30712 a30713 a30714 a30715 a30716 a30717 a30718 a30719 a30720 a30721 a30722 a30723 a30724 a30725 a30726 a30727 a30728 a30729 a30730 a30731 a30732 a30733 a30734 a30735 a30736 a30737 a30738 a30739 a30740 a30741 a30742 a30743 a30744 a30745 a30746 a30747 a30748 a30749 a30750 a30751 a30752 a30753 a30754 a30755 a30756 a30757 a30758 a30759 a30760 a30761 a30762 a30763 a30764 a30765 a30766 a30767 a30768 a30769 a30770 a30771 a30772 a30773 a30774 a30775 a30776 a30777 a30778 a30779 a30780 a30781 a30782 a30783 a30784 a30785 a30786 a30787 a30788 a30789 a30790 a30791 a30792 a30793 a30794 a30795 a30796 a30797 a30798 a30799 a30800 a30801 a30802 a30803 a30804 a30805 a30806 a30807 a30808 a30809 a30810 a30811 a30812 a30813 a30814 a30815 a30816 a30817 a30818 a30819 a30820 a30821 a30822 a30823 a30824 a30825 a30826 a30827 a30828 a30829 a30830 a30831 a30832 a30833 a30834 a30835 a30836 a30837 a30838 a30839 a30840 a30841 a30842 a30843 a30844 a30845 a30846 a30847 a30848 a30849 a30850 a30851 a30852 a30853 a30854 a30855 a30856 a30857 a30858 a30859 a30860 a30861 a30862 a30863 a30864 a30865 a30866 a30867 a30868 a30869 a30870 a30871 a30872 a30873 a30874 a30875 a30876 a30877 a30878 a30879 a30880 a30881 a30882 a30883 a30884 a30885 a30886 a30887 a30888 a30889 a30890 a30891 a30892 a30893 a30894 a30895 a30896 a30897 a30898 a30899 a30900 a30901 a30902 a30903 a30904 a30905 a30906 a30907 a30908 a30909 a30910 a30911 a30912 a30913 a30914 a30915 a30916 a30917 a30918 a30919 a30920 a30921 a30922 a30923 a30924 a30925 a30926 a30927 a30928 a30929 a30930 a30931 a30932 a30933 a30934 a30935 a30936 a30937 a30938 a30939 a30940 a30941 a30942 a30943 a30944 a30945 a30946 a30947 a30948 a30949 a30950 a30951 a30952 a30953 a30954 a30955 a30956 a30957 a30958 a30959 a30960 a30961 a30962 a30963 a30964 a30965 a30966 a30967 a30968 a30969 a30970 a30971 a30972 a30973 a30974 a30975 a30976 a30977 a30978 a30979 a30980 a30981 a30982 a30983 a30984 a30985 a30986 a30987 a30988 a30989 a30990 a30991 a30992 a30993 a30994 a30995 a30996 a30997 a30998 a30999 a31000 a31001 a31002 a31003 a31004 a31005 a31006 a31007 a31008 a31009 a31010 a31011 a31012 a31013 a31014 a31015 a31016 a31017 a31018 a31019 a31020 a31021 a31022 a31023 a31024 a31025 a31026 a31027 a31028 a31029 a31030 a31031 a31032 a31033 a31034 a31035 a31036 a31037 a31038 a31039 a31040 a31041 a31042 a31043 a31044 a31045 a31046 a31047 a31048 a31049 a31050 a31051 a31052 a31053 a31054 a31055 a31056 a31057 a31058 a31059 a31060 a31061 a31062 a31063 a31064 a31065 a31066 a31067 a31068 a31069 a31070 a31071 a31072 a31073 a31074 a31075 a31076 a31077 a31078 a31079 a31080 a31081 a31082 a31083 a31084 a31085 a31086 a31087 a31088 a31089 a31090 a31091 a31092 a31093 a31094 a31095 a31096 a31097 a31098 a31099 a31100 a31101 a31102 a31103 a31104 a31105 a31106 a31107 a31108 a31109 a31110 a31111 a31112 a31113 a31114 a31115 a31116 a31117 a31118 a31119 a31120 a31121 a31122 a31123 a31124 a31125 a31126 a31127 a31128 a31129 a31130 a31131 a31132 a31133 a31134 a31135 a31136 a31137 a31138 a31139 a31140 a31141 a31142 a31143 a31144 a31145 a31146 a31147 a31148 a31149 a31150 a31151 a31152 a31153 a31154 a31155 a31156 a31157 a31158 a31159 a31160 a31161 a31162 a31163 a31164 a31165 a31166 a31167 a31168 a31169 a31170 a31171 a31172 a31173 a31174 a31175 a31176 a31177 a31178 a31179 a31180 a31181 a31182 a31183 a31184 a31185 a31186 a31187 a31188 a31189 a31190 a31191 a31192 a31193 a31194 a31195 a31196 a31197 a31198 a31199 a31200 a31201 a31202 a31203 a31204 a31205 a31206 a31207 a31208 a31209 a31210 a31211 a31212 a31213 a31214 a31215 a31216 a31217 a31218 a31219 a31220 a31221 a31222 a31223 a31224 a31225 a31226 a31227 a31228 a31229 a31230 a31231 a31232 a31233 a31234 a31235 a31236 a31237 a31238 a31239 a31240 a31241 a31242 a31243 a31244 a31245 a31246 a31247 a31248 a31249 a31250 a31251 a31252 a31253 a31254 a31255 a31256 a31257 a31258 a31259 a31260 a31261 a31262 a31263 a31264 a31265 a31266 a31267 a31268 a31269 a31270 a31271 a31272 a31273 a31274 a31275 a31276 a31277 a31278 a31279 a31280 a31281 a31282 a31283 a31284 a31285 a31286 a31287 a31288 a31289 a31290 a31291 a31292 a31293 a31294 a31295 a31296 a31297 a31298 a31299 a31300 a31301 a31302 a31303 a31304 a31305 a31306 a31307 a31308 a31309 a31310 a31311 a31312 a31313 a31314 a31315 a31316 a31317 a31318 a31319 a31320 a31321 a31322 a31323 a31324 a31325 a31326 a31327 a31328 a31329 a31330 a31331 a31332 a31333 a31334 a31335 a31336 a31337 a31338 a31339 a31340 a31341 a31342 a31343 a31344 a31345 a31346 a31347 a31348 a31349 a31350 a31351 a31352 a31353 a31354 a31355 a31356 a31357 a31358 a31359 a31360 a31361 a31362 a31363 a31364 a31365 a31366 a31367 a31368 a31369 a31370 a31371 a31372 a31373 a31374 a31375 a31376 a31377 a31378 a31379 a31380 a31381 a31382 a31383 a31384 a31385 a31386 a31387 a31388 a31389 a31390 a31391 a31392 a31393 a31394 a31395 a31396 a31397 a31398 a31399 a31400 a31401 a31402 a31403 a31404 a31405 a31406 a31407 a31408 a31409 a31410 a31411 a31412 a31413 a31414 a31415 a31416 a31417 a31418 a31419 a31420 a31421 a31422 a31423 a31424 a31425 a31426 a31427 a31428 a31429 a31430 a31431 a31432 a31433 a31434 a31435 a31436 a31437 a31438 a31439 a31440 a31441 a31442 a31443 a31444 a31445 a31446 a31447 a31448 a31449 a31450 a31451 a31452 a31453 a31454 a31455 a31456 a31457 a31458 a31459 a31460 a31461 a31462 a31463 a31464 a31465 a31466 a31467 a31468 a31469 a31470 a31471 a31472 a31473 a31474 a31475 a31476 a31477 a31478 a31479 a31480 a31481 a31482 a31483 a31484 a31485 a31486 a31487 a31488 a31489 a31490 a31491 a31492 a31493 a31494 a31495 a31496 a31497 a31498 a31499 a31500 a31501 a31502 a31503 a31504 a31505 a31506 a31507 a31508 a31509 a31510 a31511 a31512 a31513 a31514 a31515 a31516 a31517 a31518 a31519 a31520 a31521 a31522 a31523 a31524 a31525 a31526 a31527 a31528 a31529 a31530 a31531 a31532 a31533 a31534 a31535 a31536 a31537 a31538 a31539 a31540 a31541 a31542 a31543 a31544 a31545 a31546 a31547 a31548 a31549 a31550 a31551 a31552 a31553 a31554 a31555 a31556 a31557 a31558 a31559 a31560 a31561 a31562 a31563 a31564 a31565 a31566 a31567 a31568 a31569 a31570 a31571 a31572 a31573 a31574 a31575 a31576 a31577 a31578 a31579 a31580 a31581 a31582 a31583 a31584 a31585 a31586 a31587 a31588 a31589 a31590 a31591 a31592 a31593 a31594 a31595 a31596 a31597 a31598 a31599 a31600 a31601 a31602 a31603 a31604 a31605 a31606 a31607 a31608 a31609 a31610 a31611 a31612 a31613 a31614 a31615 a31616 a31617 a31618 a31619 a31620 a31621 a31622 a31623 a31624 a31625 a31626 a31627 a31628 a31629 a31630 a31631 a31632 a31633 a31634 a31635 a31636 a31637 a31638 a31639 a31640 a31641 a31642 a31643 a31644 a31645 a31646 a31647 a31648 a31649 a31650 a31651 a31652 a31653 a31654 a31655 a31656 a31657 a31658 a31659 a31660 a31661 a31662 a31663 a31664 a31665 a31666 a31667 a31668 a31669 a31670 a31671 a31672 a31673 a31674 a31675 a31676 a31677 a31678 a31679 a31680 a31681 a31682 a31683 a31684 a31685 a31686 a31687 a31688 a31689 a31690 a31691 a31692 a31693 a31694 a31695 a31696 a31697 a31698 a31699 a31700 a31701 a31702 a31703 a31704 a31705 a31706 a31707 a31708 a31709 a31710 a31711 a31712 a31713 a31714 a31715 a31716 a31717 a31718 a31719 a31720 a31721 a31722 a31723 a31724 a31725 a31726 a31727 a31728 a31729 a31730 a31731 a31732 a31733 a31734 a31735 a31736 a31737 a31738 a31739 a31740 a31741 a31742 a31743 a31744 a31745 a31746 a31747 a31748 a31749 a31750 a31751 a31752 a31753 a31754 a31755 a31756 a31757 a31758 a31759 a31760 a31761 a31762 a31763 a31764 a31765 a31766 a31767 a31768 a31769 a31770 a31771 a31772 a31773 a31774 a31775 a31776 a31777 a31778 a31779 a31780 a31781 a31782 a31783 a31784 a31785 a31786 a31787 a31788 a31789 a31790 a31791 a31792 a31793 a31794 a31795 a31796 a31797 a31798 a31799 a31800 a31801 a31802 a31803 a31804 a31805 a31806 a31807 a31808 a31809 a31810 a31811 a31812 a31813 a31814 a31815 a31816 a31817 a31818 a31819 a31820 a31821 a31822 a31823 a31824 a31825 a31826 a31827 a31828 a31829 a31830 a31831 a31832 a31833 a31834 a31835 a31836 a31837 a31838 a31839 a31840 a31841 a31842 a31843 a31844 a31845 a31846 a31847 a31848 a31849 a31850 a31851 a31852 a31853 a31854 a31855 a31856 a31857 a31858 a31859 a31860 a31861 a31862 a31863 a31864 a31865 a31866 a31867 a31868 a31869 a31870 a31871 a31872 a31873 a31874 a31875 a31876 a31877 a31878 a31879 a31880 a31881 a31882 a31883 a31884 a31885 a31886 a31887 a31888 a31889 a31890 a31891 a31892 a31893 a31894 a31895 a31896 a31897 a31898 a31899 a31900 a31901 a31902 a31903 a31904 a31905 a31906 a31907 a31908 a31909 a31910 a31911 a31912 a31913 a31914 a31915 a31916 a31917 a31918 a31919 a31920 a31921 a31922 a31923 a31924 a31925 a31926 a31927 a31928 a31929 a31930 a31931 a31932 a31933 a31934 a31935 a31936 a31937 a31938 a31939 a31940 a31941 a31942 a31943 a31944 a31945 a31946 a31947 a31948 a31949 a31950 a31951 a31952 a31953 a31954 a31955 a31956 a31957 a31958 a31959 a31960 a31961 a31962 a31963 a31964 a31965 a31966 a31967 a31968 a31969 a31970 a31971 a31972 a31973 a31974 a31975 a31976 a31977 a31978 a31979 a31980 a31981 a31982 a31983 a31984 a31985 a31986 a31987 a31988 a31989 a31990 a31991 a31992 a31993 a31994 a31995 a31996 a31997 a31998 a31999 a32000 a32001 a32002 a32003 a32004 a32005 a32006 a32007 a32008 a32009 a32010 a32011 a32012 a32013 a32014 a32015 a32016 a32017 a32018 a32019 a32020 a32021 a32022 a32023 a32024 a32025 a32026 a32027 a32028 a32029 a32030 a32031 a32032 a32033 a32034 a32035 a32036 a32037 a32038 a32039 a32040 a32041 a32042 a32043 a32044 a32045 a32046 a32047 a32048 a32049 a32050 a32051 a32052 a32053 a32054 a32055 a32056 a32057 a32058 a32059 a32060 a32061 a32062 a32063 a32064 a32065 a32066 a32067 a32068 a32069 a32070 a32071 a32072 a32073 a32074 a32075 a32076 a32077 a32078 a32079 a32080 a32081 a32082 a32083 a32084 a32085 a32086 a32087 a32088 a32089 a32090 a32091 a32092 a32093 a32094 a32095 a32096 a32097 a32098 a32099 a32100 a32101 a32102 a32103 a32104 a32105 a32106 a32107 a32108 a32109 a32110 a32111 a32112 a32113 a32114 a32115 a32116 a32117 a32118 a32119 a32120 a32121 a32122 a32123 a32124 a32125 a32126 a32127 a32128 a32129 a32130 a32131 a32132 a32133 a32134 a32135 a32136 a32137 a32138 a32139 a32140 a32141 a32142 a32143 a32144 a32145 a32146 a32147 a32148 a32149 a32150 a32151 a32152 a32153 a32154 a32155 a32156 a32157 a32158 a32159 a32160 a32161 a32162 a32163 a32164 a32165 a32166 a32167 a32168 a32169 a32170 a32171 a32172 a32173 a32174 a32175 a32176 a32177 a32178 a32179 a32180 a32181 a32182 a32183 a32184 a32185 a32186 a32187 a32188 a32189 a32190 a32191 a32192 a32193 a32194 a32195 a32196 a32197 a32198 a32199 a32200 a32201 a32202 a32203 a32204 a32205 a32206 a32207 a32208 a32209 a32210 a32211 a32212 a32213 a32214 a32215 a32216 a32217 a32218 a32219 a32220 a32221 a32222 a32223 a32224 a32225 a32226 a32227 a32228 a32229 a32230 a32231 a32232 a32233 a32234 a32235 a32236 a32237 a32238 a32239 a32240 a32241 a32242 a32243 a32244 a32245 a32246 a32247 a32248 a32249 a32250 a32251 a32252 a32253 a32254 a32255 a32256 a32257 a32258 a32259 a32260 a32261 a32262 a32263 a32264 a32265 a32266 a32267 a32268 a32269 a32270 a32271 a32272 a32273 a32274 a32275 a32276 a32277 a32278 a32279 a32280 a32281 a32282 a32283 a32284 a32285 a32286 a32287 a32288 a32289 a32290 a32291 a32292 a32293 a32294 a32295 a32296 a32297 a32298 a32299 a32300 a32301 a32302 a32303 a32304 a32305 a32306 a32307 a32308 a32309 a32310 a32311 a32312 a32313 a32314 a32315 a32316 a32317 a32318 a32319 a32320 a32321 a32322 a32323 a32324 a32325 a32326 a32327 a32328 a32329 a32330 a32331 a32332 a32333 a32334 a32335 a32336 a32337 a32338 a32339 a32340 a32341 a32342 a32343 a32344 a32345 a32346 a32347 a32348 a32349 a32350 a32351 a32352 a32353 a32354 a32355 a32356 a32357 a32358 a32359 a32360 a32361 a32362 a32363 a32364 a32365 a32366 a32367 a32368 a32369 a32370 a32371 a32372 a32373 a32374 a32375 a32376 a32377 a32378 a32379 a32380 a32381 a32382 a32383 a32384 a32385 a32386 a32387 a32388 a32389 a32390 a32391 a32392 a32393 a32394 a32395 a32396 a32397 a32398 a32399 a32400 a32401 a32402 a32403 a32404 a32405 a32406 a32407 a32408 a32409 a32410 a32411 a32412 a32413 a32414 a32415 a32416 a32417 a32418 a32419 a32420 a32421 a32422 a32423 a32424 a32425 a32426 a32427 a32428 a32429 a32430 a32431 a32432 a32433 a32434 a32435 a32436 a32437 a32438 a32439 a32440 a32441 a32442 a32443 a32444 a32445 a32446 a32447 a32448 a32449 a32450 a32451 a32452 a32453 a32454 a32455 a32456 a32457 a32458 a32459 a32460 a32461 a32462 a32463 a32464 a32465 a32466 a32467 a32468 a32469 a32470 a32471 a32472 a32473 a32474 a32475 a32476 a32477 a32478 a32479 a32480 a32481 a32482 a32483 a32484 a32485 a32486 a32487 a32488 a32489 a32490 a32491 a32492 a32493 a32494 a32495 a32496 a32497 a32498 a32499 a32500 a32501 a32502 a32503 a32504 a32505 a32506 a32507 a32508 a32509 a32510 a32511 a32512 a32513 a32514 a32515 a32516 a32517 a32518 a32519 a32520 a32521 a32522 a32523 a32524 a32525 a32526 a32527 a32528 a32529 a32530 a32531 a32532 a32533 a32534 a32535 a32536 a32537 a32538 a32539 a32540 a32541 a32542 a32543 a32544 a32545 a32546 a32547 a32548 a32549 a32550 a32551 a32552 a32553 a32554 a32555 a32556 a32557 a32558 a32559 a32560 a32561 a32562 a32563 a32564 a32565 a32566 a32567 a32568 a32569 a32570 a32571 a32572 a32573 a32574 a32575 a32576 a32577 a32578 a32579 a32580 a32581 a32582 a32583 a32584 a32585 a32586 a32587 a32588 a32589 a32590 a32591 a32592 a32593 a32594 a32595 a32596 a32597 a32598 a32599 a32600 a32601 a32602 a32603 a32604 a32605 a32606 a32607 a32608 a32609 a32610 a32611 a32612 a32613 a32614 a32615 a32616 a32617 a32618 a32619 a32620 a32621 a32622 a32623 a32624 a32625 a32626 a32627 a32628 a32629 a32630 a32631 a32632 a32633 a32634 a32635 a32636 a32637 a32638 a32639 a32640 a32641 a32642 a32643 a32644 a32645 a32646 a32647 a32648 a32649 a32650 a32651 a32652 a32653 a32654 a32655 a32656 a32657 a32658 a32659 a32660 a32661 a32662 a32663 a32664 a32665 a32666 a32667 a32668 a32669 a32670 a32671 a32672 a32673 a32674 a32675 a32676 a32677 a32678 a32679 a32680 a32681 a32682 a32683 a32684 a32685 a32686 a32687 a32688 a32689 a32690 a32691 a32692 a32693 a32694 a32695 a32696 a32697 a32698 a32699 a32700 a32701 a32702 a32703 a32704 a32705 a32706 a32707 a32708 a32709 a32710 a32711 a32712 a32713 a32714 a32715 a32716 a32717 a32718 a32719 a32720 a32721 a32722 a32723 a32724 a32725 a32726 a32727 a32728 a32729 a32730 a32731 a32732 a32733 a32734 a32735 a32736 a32737 a32738 a32739 a32740 a32741 a32742 a32743 a32744 a32745 a32746 a32747 a32748 a32749 a32750 a32751 a32752 a32753 a32754 a32755 a32756 a32757 a32758 a32759 a32760 a32761 a32762 a32763 a32764 a32765 a32766 a32767 a32768 a32769 a32770 a32771 a32772 a32773 a32774 a32775 a32776 a32777 a32778 a32779 a32780 a32781 a32782 a32783 a32784 a32785 a32786 a32787 a32788 a32789 a32790 a32791 a32792 a32793 a32794 a32795 a32796 a32797 a32798 a32799 a32800 a32801 a32802 a32803 a32804 a32805 a32806 a32807 a32808 a32809 a32810 a32811 a32812 a32813 a32814 a32815 a32816 a32817 a32818 a32819 a32820 a32821 a32822 a32823 a32824 a32825 a32826 a32827 a32828 a32829 a32830 a32831 a32832 a32833 a32834 a32835 a32836 a32837 a32838 a32839 a32840 a32841 a32842 a32843 a32844 a32845 a32846 a32847 a32848 a32849 a32850 a32851 a32852 a32853 a32854 a32855 a32856 a32857 a32858 a32859 a32860 a32861 a32862 a32863 a32864 a32865 a32866 a32867 a32868 a32869 a32870 a32871 a32872 a32873 a32874 a32875 a32876 a32877 a32878 a32879 a32880 a32881 a32882 a32883 a32884 a32885 a32886 a32887 a32888 a32889 a32890 a32891 a32892 a32893 a32894 a32895 a32896 a32897 a32898 a32899 a32900 a32901 a32902 a32903 a32904 a32905 a32906 a32907 a32908 a32909 a32910 a32911 a32912 a32913 a32914 a32915 a32916 a32917 a32918 a32919 a32920 a32921 a32922 a32923 a32924 a32925 a32926 a32927 a32928 a32929 a32930 a32931 a32932 a32933 a32934 a32935 a32936 a32937 a32938 a32939 a32940 a32941 a32942 a32943 a32944 a32945 a32946 a32947 a32948 a32949 a32950 a32951 a32952 a32953 a32954 a32955 a32956 a32957 a32958 a32959 a32960 a32961 a32962 a32963 a32964 a32965 a32966 a32967 a32968 a32969 a32970 a32971 a32972 a32973 a32974 a32975 a32976 a32977 a32978 a32979 a32980 a32981 a32982 a32983 a32984 a32985 a32986 a32987 a32988 a32989 a32990 a32991 a32992 a32993 a32994 a32995 a32996 a32997 a32998 a32999 a33000 a33001 a33002 a33003 a33004 a33005 a33006 a33007 a33008 a33009 a33010 a33011 a33012 a33013 a33014 a33015 a33016 a33017 a33018 a33019 a33020 a33021 a33022 a33023 a33024 a33025 a33026 a33027 a33028 a33029 a33030 a33031 a33032 a33033 a33034 a33035 a33036 a33037 a33038 a33039 a33040 a33041 a33042 a33043 a33044 a33045 a33046 a33047 a33048 a33049 a33050 a33051 a33052 a33053 a33054 a33055 a33056 a33057 a33058 a33059 a33060 a33061 a33062 a33063 a33064 a33065 a33066 a33067 a33068 a33069 a33070 a33071 a33072 a33073 a33074 a33075 a33076 a33077 a33078 a33079 a33080 a33081 a33082 a33083 a33084 a33085 a33086 a33087 a33088 a33089 a33090 a33091 a33092 a33093 a33094 a33095 a33096 a33097 a33098 a33099 a33100 a33101 a33102 a33103 a33104 a33105 a33106 a33107 a33108 a33109 a33110 a33111 a33112 a33113 a33114 a33115 a33116 a33117 a33118 a33119 a33120 a33121 a33122 a33123 a33124 a33125 a33126 a33127 a33128 a33129 a33130 a33131 a33132 a33133 a33134 a33135 a33136 a33137 a33138 a33139 a33140 a33141 a33142 a33143 a33144 a33145 a33146 a33147 a33148 a33149 a33150 a33151 a33152 a33153 a33154 a33155 a33156 a33157 a33158 a33159 a33160 a33161 a33162 a33163 a33164 a33165 a33166 a33167 a33168 a33169 a33170 a33171 a33172 a33173 a33174 a33175 a33176 a33177 a33178 a33179 a33180 a33181 a33182 a33183 a33184 a33185 a33186 a33187 a33188 a33189 a33190 a33191 a33192 a33193 a33194 a33195 a33196 a33197 a33198 a33199 a33200 a33201 a33202 a33203 a33204 a33205 a33206 a33207 a33208 a33209 a33210 a33211 a33212 a33213 a33214 a33215 a33216 a33217 a33218 a33219 a33220 a33221 a33222 a33223 a33224 a33225 a33226 a33227 a33228 a33229 a33230 a33231 a33232 a33233 a33234 a33235 a33236 a33237 a33238 a33239 a33240 a33241 a33242 a33243 a33244 a33245 a33246 a33247 a33248 a33249 a33250 a33251 a33252 a33253 a33254 a33255 a33256 a33257 a33258 a33259 a33260 a33261 a33262 a33263 a33264 a33265 a33266 a33267 a33268 a33269 a33270 a33271 a33272 a33273 a33274 a33275 a33276 a33277 a33278 a33279 a33280 a33281 a33282 a33283 a33284 a33285 a33286 a33287 a33288 a33289 a33290 a33291 a33292 a33293 a33294 a33295 a33296 a33297 a33298 a33299 a33300 a33301 a33302 a33303 a33304 a33305 a33306 a33307 a33308 a33309 a33310 a33311 a33312 a33313 a33314 a33315 a33316 a33317 a33318 a33319 a33320 a33321 a33322 a33323 a33324 a33325 a33326 a33327 a33328 a33329 a33330 a33331 a33332 a33333 a33334 a33335 a33336 a33337 a33338 a33339 a33340 a33341 a33342 a33343 a33344 a33345 a33346 a33347 a33348 a33349 a33350 a33351 a33352 a33353 a33354 a33355 a33356 a33357 a33358 a33359 a33360 a33361 a33362 a33363 a33364 a33365 a33366 a33367 a33368 a33369 a33370 a33371 a33372 a33373 a33374 a33375 a33376 a33377 a33378 a33379 a33380 a33381 a33382 a33383 a33384 a33385 a33386 a33387 a33388 a33389 a33390 a33391 a33392 a33393 a33394 a33395 a33396 a33397 a33398 a33399 a33400 a33401 a33402 a33403 a33404 a33405 a33406 a33407 a33408 a33409 a33410 a33411 a33412 a33413 a33414 a33415 a33416 a33417 a33418 a33419 a33420 a33421 a33422 a33423 a33424 a33425 a33426 a33427 a33428 a33429 a33430 a33431 a33432 a33433 a33434 a33435 a33436 a33437 a33438 a33439 a33440 a33441 a33442 a33443 a33444 a33445 a33446 a33447 a33448 a33449 a33450 a33451 a33452 a33453 a33454 a33455 a33456 a33457 a33458 a33459 a33460 a33461 a33462 a33463 a33464 a33465 a33466 a33467 a33468 a33469 a33470 a33471 a33472 a33473 a33474 a33475 a33476 a33477 a33478 a33479 a33480 a33481 a33482 a33483 a33484 a33485 a33486 a33487 a33488 a33489 a33490 a33491 a33492 a33493 a33494 a33495 a33496 a33497 a33498 a33499 a33500 a33501 a33502 a33503 a33504 a33505 a33506 a33507 a33508 a33509 a33510 a33511 a33512 a33513 a33514 a33515 a33516 a33517 a33518 a33519 a33520 a33521 a33522 a33523 a33524 a33525 a33526 a33527 a33528 a33529 a33530 a33531 a33532 a33533 a33534 a33535 a33536 a33537 a33538 a33539 a33540 a33541 a33542 a33543 a33544 a33545 a33546 a33547 a33548 a33549 a33550 a33551 a33552 a33553 a33554 a33555 a33556 a33557 a33558 a33559 a33560 a33561 a33562 a33563 a33564 a33565 a33566 a33567 a33568 a33569 a33570 a33571 a33572 a33573 a33574 a33575 a33576 a33577 a33578 a33579 a33580 a33581 a33582 a33583 a33584 a33585 a33586 a33587 a33588 a33589 a33590 a33591 a33592 a33593 a33594 a33595 a33596 a33597 a33598 a33599 a33600 a33601 a33602 a33603 a33604 a33605 a33606 a33607 a33608 a33609 a33610 a33611 a33612 a33613 a33614 a33615 a33616 a33617 a33618 a33619 a33620 a33621 a33622 a33623 a33624 a33625 a33626 a33627 a33628 a33629 a33630 a33631 a33632 a33633 a33634 a33635 a33636 a33637 a33638 a33639 a33640 a33641 a33642 a33643 a33644 a33645 a33646 a33647 a33648 a33649 a33650 a33651 a33652 a33653 a33654 a33655 a33656 a33657 a33658 a33659 a33660 a33661 a33662 a33663 a33664 a33665 a33666 a33667 a33668 a33669 a33670 a33671 a33672 a33673 a33674 a33675 a33676 a33677 a33678 a33679 a33680 a33681 a33682 a33683 a33684 a33685 a33686 a33687 a33688 a33689 a33690 a33691 a33692 a33693 a33694 a33695 a33696 a33697 a33698 a33699 a33700 a33701 a33702 a33703 a33704 a33705 a33706 a33707 a33708 a33709 a33710 a33711 a33712 a33713 a33714 a33715 a33716 a33717 a33718 a33719 a33720 a33721 a33722 a33723 a33724 a33725 a33726 a33727 a33728 a33729 a33730 a33731 a33732 a33733 a33734 a33735 a33736 a33737 a33738 a33739 a33740 a33741 a33742 a33743 a33744 a33745 a33746 a33747 a33748 a33749 a33750 a33751 a33752 a33753 a33754 a33755 a33756 a33757 a33758 a33759 a33760 a33761 a33762 a33763 a33764 a33765 a33766 a33767 a33768 a33769 a33770 a33771 a33772 a33773 a33774 a33775 a33776 a33777 a33778 a33779 a33780 a33781 a33782 a33783 a33784 a33785 a33786 a33787 a33788 a33789 a33790 a33791 a33792 a33793 a33794 a33795 a33796 a33797 a33798 a33799 a33800 a33801 a33802 a33803 a33804 a33805 a33806 a33807 a33808 a33809 a33810 a33811 a33812 a33813 a33814 a33815 a33816 a33817 a33818 a33819 a33820 a33821 a33822 a33823 a33824 a33825 a33826 a33827 a33828 a33829 a33830 a33831 a33832 a33833 a33834 a33835 a33836 a33837 a33838 a33839 a33840 a33841 a33842 a33843 a33844 a33845 a33846 a33847 a33848 a33849 a33850 a33851 a33852 a33853 a33854 a33855 a33856 a33857 a33858 a33859 a33860 a33861 a33862 a33863 a33864 a33865 a33866 a33867 a33868 a33869 a33870 a33871 a33872 a33873 a33874 a33875 a33876 a33877 a33878 a33879 a33880 a33881 a33882 a33883 a33884 a33885 a33886 a33887 a33888 a33889 a33890 a33891 a33892 a33893 a33894 a33895 a33896 a33897 a33898 a33899 a33900 a33901 a33902 a33903 a33904 a33905 a33906 a33907 a33908 a33909 a33910 a33911 a33912 a33913 a33914 a33915 a33916 a33917 a33918 a33919 a33920 a33921 a33922 a33923 a33924 a33925 a33926 a33927 a33928 a33929 a33930 a33931 a33932 a33933 a33934 a33935 a33936 a33937 a33938 a33939 a33940 a33941 a33942 a33943 a33944 a33945 a33946 a33947 a33948 a33949 a33950 a33951 a33952 a33953 a33954 a33955 a33956 a33957 a33958 a33959 a33960 a33961 a33962 a33963 a33964 a33965 a33966 a33967 a33968 a33969 a33970 a33971 a33972 a33973 a33974 a33975 a33976 a33977 a33978 a33979 a33980 a33981 a33982 a33983 a33984 a33985 a33986 a33987 a33988 a33989 a33990 a33991 a33992 a33993 a33994 a33995 a33996 a33997 a33998 a33999 a34000 a34001 a34002 a34003 a34004 a34005 a34006 a34007 a34008 a34009 a34010 a34011 a34012 a34013 a34014 a34015 a34016 a34017 a34018 a34019 a34020 a34021 a34022 a34023 a34024 a34025 a34026 a34027 a34028 a34029 a34030 a34031 a34032 a34033 a34034 a34035 a34036 a34037 a34038 a34039 a34040 a34041 a34042 a34043 a34044 a34045 a34046 a34047 a34048 a34049 a34050 a34051 a34052 a34053 a34054 a34055 a34056 a34057 a34058 a34059 a34060 a34061 a34062 a34063 a34064 a34065 a34066 a34067 a34068 a34069 a34070 a34071 a34072 a34073 a34074 a34075 a34076 a34077 a34078 a34079 a34080 a34081 a34082 a34083 a34084 a34085 a34086 a34087 a34088 a34089 a34090 a34091 a34092 a34093 a34094 a34095 a34096 a34097 a34098 a34099 a34100 a34101 a34102 a34103 a34104 a34105 a34106 a34107 a34108 a34109 a34110 a34111 a34112 a34113 a34114 a34115 a34116 a34117 a34118 a34119 a34120 a34121 a34122 a34123 a34124 a34125 a34126 a34127 a34128 a34129 a34130 a34131 a34132 a34133 a34134 a34135 a34136 a34137 a34138 a34139 a34140 a34141 a34142 a34143 a34144 a34145 a34146 a34147 a34148 a34149 a34150 a34151 a34152 a34153 a34154 a34155 a34156 a34157 a34158 a34159 a34160 a34161 a34162 a34163 a34164 a34165 a34166 a34167 a34168 a34169 a34170 a34171 a34172 a34173 a34174 a34175 a34176 a34177 a34178 a34179 a34180 a34181 a34182 a34183 a34184 a34185 a34186 a34187 a34188 a34189 a34190 a34191 a34192 a34193 a34194 a34195 a34196 a34197 a34198 a34199 a34200 a34201 a34202 a34203 a34204 a34205 a34206 a34207 a34208 a34209 a34210 a34211 a34212 a34213 a34214 a34215 a34216 a34217 a34218 a34219 a34220 a34221 a34222 a34223 a34224 a34225 a34226 a34227 a34228 a34229 a34230 a34231 a34232 a34233 a34234 a34235 a34236 a34237 a34238 a34239 a34240 a34241 a34242 a34243 a34244 a34245 a34246 a34247 a34248 a34249 a34250 a34251 a34252 a34253 a34254 a34255 a34256 a34257 a34258 a34259 a34260 a34261 a34262 a34263 a34264 a34265 a34266 a34267 a34268 a34269 a34270 a34271 a34272 a34273 a34274 a34275 a34276 a34277 a34278 a34279 a34280 a34281 a34282 a34283 a34284 a34285 a34286 a34287 a34288 a34289 a34290 a34291 a34292 a34293 a34294 a34295 a34296 a34297 a34298 a34299 a34300 a34301 a34302 a34303 a34304 a34305 a34306 a34307 a34308 a34309 a34310 a34311 a34312 a34313 a34314 a34315 a34316 a34317 a34318 a34319 a34320 a34321 a34322 a34323 a34324 a34325 a34326 a34327 a34328 a34329 a34330 a34331 a34332 a34333 a34334 a34335 a34336 a34337 a34338 a34339 a34340 a34341 a34342 a34343 a34344 a34345 a34346 a34347 a34348 a34349 a34350 a34351 a34352 a34353 a34354 a34355 a34356 a34357 a34358 a34359 a34360 a34361 a34362 a34363 a34364 a34365 a34366 a34367 a34368 a34369 a34370 a34371 a34372 a34373 a34374 a34375 a34376 a34377 a34378 a34379 a34380 a34381 a34382 a34383 a34384 a34385 a34386 a34387 a34388 a34389 a34390 a34391 a34392 a34393 a34394 a34395 a34396 a34397 a34398 a34399 a34400 a34401 a34402 a34403 a34404 a34405 a34406 a34407 a34408 a34409 a34410 a34411 a34412 a34413 a34414 a34415 a34416 a34417 a34418 a34419 a34420 a34421 a34422 a34423 a34424 a34425 a34426 a34427 a34428 a34429 a34430 a34431 a34432 a34433 a34434 a34435 a34436 a34437 a34438 a34439 a34440 a34441 a34442 a34443 a34444 a34445 a34446 a34447 a34448 a34449 a34450 a34451 a34452 a34453 a34454 a34455 a34456 a34457 a34458 a34459 a34460 a34461 a34462 a34463 a34464 a34465 a34466 a34467 a34468 a34469 a34470 a34471 a34472 a34473 a34474 a34475 a34476 a34477 a34478 a34479 a34480 a34481 a34482 a34483 a34484 a34485 a34486 a34487 a34488 a34489 a34490 a34491 a34492 a34493 a34494 a34495 a34496 a34497 a34498 a34499 a34500 a34501 a34502 a34503 a34504 a34505 a34506 a34507 a34508 a34509 a34510 a34511 a34512 a34513 a34514 a34515 a34516 a34517 a34518 a34519 a34520 a34521 a34522 a34523 a34524 a34525 a34526 a34527 a34528 a34529 a34530 a34531 a34532 a34533 a34534 a34535 a34536 a34537 a34538 a34539 a34540 a34541 a34542 a34543 a34544 a34545 a34546 a34547 a34548 a34549 a34550 a34551 a34552 a34553 a34554 a34555 a34556 a34557 a34558 a34559 a34560 a34561 a34562 a34563 a34564 a34565 a34566 a34567 a34568 a34569 a34570 a34571 a34572 a34573 a34574 a34575 a34576 a34577 a34578 a34579 a34580 a34581 a34582 a34583 a34584 a34585 a34586 a34587 a34588 a34589 a34590 a34591 a34592 a34593 a34594 a34595 a34596 a34597 a34598 a34599 a34600 a34601 a34602 a34603 a34604 a34605 a34606 a34607 a34608 a34609 a34610 a34611 a34612 a34613 a34614 a34615 a34616 a34617 a34618 a34619 a34620 a34621 a34622 a34623 a34624 a34625 a34626 a34627 a34628 a34629 a34630 a34631 a34632 a34633 a34634 a34635 a34636 a34637 a34638 a34639 a34640 a34641 a34642 a34643 a34644 a34645 a34646 a34647 a34648 a34649 a34650 a34651 a34652 a34653 a34654 a34655 a34656 a34657 a34658 a34659 a34660 a34661 a34662 a34663 a34664 a34665 a34666 a34667 a34668 a34669 a34670 a34671 a34672 a34673 a34674 a34675 a34676 a34677 a34678 a34679 a34680 a34681 a34682 a34683 a34684 a34685 a34686 a34687 a34688 a34689 a34690 a34691 a34692 a34693 a34694 a34695 a34696 a34697 a34698 a34699 a34700 a34701 a34702 a34703 a34704 a34705 a34706 a34707 a34708 a34709 a34710 a34711 a34712 a34713 a34714 a34715 a34716 a34717 a34718 a34719 a34720 a34721 a34722 a34723 a34724 a34725 a34726 a34727 a34728 a34729 a34730 a34731 a34732 a34733 a34734 a34735 a34736 a34737 a34738 a34739 a34740 a34741 a34742 a34743 a34744 a34745 a34746 a34747 a34748 a34749 a34750 a34751 a34752 a34753 a34754 a34755 a34756 a34757 a34758 a34759 a34760 a34761 a34762 a34763 a34764 a34765 a34766 a34767 a34768 a34769 a34770 a34771 a34772 a34773 a34774 a34775 a34776 a34777 a34778 a34779 a34780 a34781 a34782 a34783 a34784 a34785 a34786 a34787 a34788 a34789 a34790 a34791 a34792 a34793 a34794 a34795 a34796 a34797 a34798 a34799 a34800 a34801 a34802 a34803 a34804 a34805 a34806 a34807 a34808 a34809 a34810 a34811 a34812 a34813 a34814 a34815 a34816 a34817 a34818 a34819 a34820 a34821 a34822 a34823 a34824 a34825 a34826 a34827 a34828 a34829 a34830 a34831 a34832 a34833 a34834 a34835 a34836 a34837 a34838 a34839 a34840 a34841 a34842 a34843 a34844 a34845 a34846 a34847 a34848 a34849 a34850 a34851 a34852 a34853 a34854 a34855 a34856 a34857 a34858 a34859 a34860 a34861 a34862 a34863 a34864 a34865 a34866 a34867 a34868 a34869 a34870 a34871 a34872 a34873 a34874 a34875 a34876 a34877 a34878 a34879 a34880 a34881 a34882 a34883 a34884 a34885 a34886 a34887 a34888 a34889 a34890 a34891 a34892 a34893 a34894 a34895 a34896 a34897 a34898 a34899 a34900 a34901 a34902 a34903 a34904 a34905 a34906 a34907 a34908 a34909 a34910 a34911 a34912 a34913 a34914 a34915 a34916 a34917 a34918 a34919 a34920 a34921 a34922 a34923 a34924 a34925 a34926 a34927 a34928 a34929 a34930 a34931 a34932 a34933 a34934 a34935 a34936 a34937 a34938 a34939 a34940 a34941 a34942 a34943 a34944 a34945 a34946 a34947 a34948 a34949 a34950 a34951 a34952 a34953 a34954 a34955 a34956 a34957 a34958 a34959 a34960 a34961 a34962 a34963 a34964 a34965 a34966 a34967 a34968 a34969 a34970 a34971 a34972 a34973 a34974 a34975 a34976 a34977 a34978 a34979 a34980 a34981 a34982 a34983 a34984 a34985 a34986 a34987 a34988 a34989 a34990 a34991 a34992 a34993 a34994 a34995 a34996 a34997 a34998 a34999 a35000 a35001 a35002 a35003 a35004 a35005 a35006 a35007 a35008 a35009 a35010 a35011 a35012 a35013 a35014 a35015 a35016 a35017 a35018 a35019 a35020 a35021 a35022 a35023 a35024 a35025 a35026 a35027 a35028 a35029 a35030 a35031 a35032 a35033 a35034 a35035 a35036 a35037 a35038 a35039 a35040 a35041 a35042 a35043 a35044 a35045 a35046 a35047 a35048 a35049 a35050 a35051 a35052 a35053 a35054 a35055 a35056 a35057 a35058 a35059 a35060 a35061 a35062 a35063 a35064 a35065 a35066 a35067 a35068 a35069 a35070 a35071 a35072 a35073 a35074 a35075 a35076 a35077 a35078 a35079 a35080 a35081 a35082 a35083 a35084 a35085 a35086 a35087 a35088 a35089 a35090 a35091 a35092 a35093 a35094 a35095 a35096 a35097 a35098 a35099 a35100 a35101 a35102 a35103 a35104 a35105 a35106 a35107 a35108 a35109 a35110 a35111 a35112 a35113 a35114 a35115 a35116 a35117 a35118 a35119 a35120 a35121 a35122 a35123 a35124 a35125 a35126 a35127 a35128 a35129 a35130 a35131 a35132 a35133 a35134 a35135 a35136 a35137 a35138 a35139 a35140 a35141 a35142 a35143 a35144 a35145 a35146 a35147 a35148 a35149 a35150 a35151 a35152 a35153 a35154 a35155 a35156 a35157 a35158 a35159 a35160 a35161 a35162 a35163 a35164 a35165 a35166 a35167 a35168 a35169 a35170 a35171 a35172 a35173 a35174 a35175 a35176 a35177 a35178 a35179 a35180 a35181 a35182 a35183 a35184 a35185 a35186 a35187 a35188 a35189 a35190 a35191 a35192 a35193 a35194 a35195 a35196 a35197 a35198 a35199 a35200 a35201 a35202 a35203 a35204 a35205 a35206 a35207 a35208 a35209 a35210 a35211 a35212 a35213 a35214 a35215 a35216 a35217 a35218 a35219 a35220 a35221 a35222 a35223 a35224 a35225 a35226 a35227 a35228 a35229 a35230 a35231 a35232 a35233 a35234 a35235 a35236 a35237 a35238 a35239 a35240 a35241 a35242 a35243 a35244 a35245 a35246 a35247 a35248 a35249 a35250 a35251 a35252 a35253 a35254 a35255 a35256 a35257 a35258 a35259 a35260 a35261 a35262 a35263 a35264 a35265 a35266 a35267 a35268 a35269 a35270 a35271 a35272 a35273 a35274 a35275 a35276 a35277 a35278 a35279 a35280 a35281 a35282 a35283 a35284 a35285 a35286 a35287 a35288 a35289 a35290 a35291 a35292 a35293 a35294 a35295 a35296 a35297 a35298 a35299 a35300 a35301 a35302 a35303 a35304 a35305 a35306 a35307 a35308 a35309 a35310 a35311 a35312 a35313 a35314 a35315 a35316 a35317 a35318 a35319 a35320 a35321 a35322 a35323 a35324 a35325 a35326 a35327 a35328 a35329 a35330 a35331 a35332 a35333 a35334 a35335 a35336 a35337 a35338 a35339 a35340 a35341 a35342 a35343 a35344 a35345 a35346 a35347 a35348 a35349 a35350 a35351 a35352 a35353 a35354 a35355 a35356 a35357 a35358 a35359 a35360 a35361 a35362 a35363 a35364 a35365 a35366 a35367 a35368 a35369 a35370 a35371 a35372 a35373 a35374 a35375 a35376 a35377 a35378 a35379 a35380 a35381 a35382 a35383 a35384 a35385 a35386 a35387 a35388 a35389 a35390 a35391 a35392 a35393 a35394 a35395 a35396 a35397 a35398 a35399 a35400 a35401 a35402 a35403 a35404 a35405 a35406 a35407 a35408 a35409 a35410 a35411 a35412 a35413 a35414 a35415 a35416 a35417 a35418 a35419 a35420 a35421 a35422 a35423 a35424 a35425 a35426 a35427 a35428 a35429 a35430 a35431 a35432 a35433 a35434 a35435 a35436 a35437 a35438 a35439 a35440 a35441 a35442 a35443 a35444 a35445 a35446 a35447 a35448 a35449 a35450 a35451 a35452 a35453 a35454 a35455 a35456 a35457 a35458 a35459 a35460 a35461 a35462 a35463 a35464 a35465 a35466 a35467 a35468 a35469 a35470 a35471 a35472 a35473 a35474 a35475 a35476 a35477 a35478 a35479 a35480 a35481 a35482 a35483 a35484 a35485 a35486 a35487 a35488 a35489 a35490 a35491 a35492 a35493 a35494 a35495 a35496 a35497 a35498 a35499 a35500 a35501 a35502 a35503 a35504 a35505 a35506 a35507 a35508 a35509 a35510 a35511 a35512 a35513 a35514 a35515 a35516 a35517 a35518 a35519 a35520 a35521 a35522 a35523 a35524 a35525 a35526 a35527 a35528 a35529 a35530 a35531 a35532 a35533 a35534 a35535 a35536 a35537 a35538 a35539 a35540 a35541 a35542 a35543 a35544 a35545 a35546 a35547 a35548 a35549 a35550 a35551 a35552 a35553 a35554 a35555 a35556 a35557 a35558 a35559 a35560 a35561 a35562 a35563 a35564 a35565 a35566 a35567 a35568 a35569 a35570 a35571 a35572 a35573 a35574 a35575 a35576 a35577 a35578 a35579 a35580 a35581 a35582 a35583 a35584 a35585 a35586 a35587 a35588 a35589 a35590 a35591 a35592 a35593 a35594 a35595 a35596 a35597 a35598 a35599 a35600 a35601 a35602 a35603 a35604 a35605 a35606 a35607 a35608 a35609 a35610 a35611 a35612 a35613 a35614 a35615 a35616 a35617 a35618 a35619 a35620 a35621 a35622 a35623 a35624 a35625 a35626 a35627 a35628 a35629 a35630 a35631 a35632 a35633 a35634 a35635 a35636 a35637 a35638 a35639 a35640 a35641 a35642 a35643 a35644 a35645 a35646 a35647 a35648 a35649 a35650 a35651 a35652 a35653 a35654 a35655 a35656 a35657 a35658 a35659 a35660 a35661 a35662 a35663 a35664 a35665 a35666 a35667 a35668 a35669 a35670 a35671 a35672 a35673 a35674 a35675 a35676 a35677 a35678 a35679 a35680 a35681 a35682 a35683 a35684 a35685 a35686 a35687 a35688 a35689 a35690 a35691 a35692 a35693 a35694 a35695 a35696 a35697 a35698 a35699 a35700 a35701 a35702 a35703 a35704 a35705 a35706 a35707 a35708 a35709 a35710 a35711 a35712 a35713 a35714 a35715 a35716 a35717 a35718 a35719 a35720 a35721 a35722 a35723 a35724 a35725 a35726 a35727 a35728 a35729 a35730 a35731 a35732 a35733 a35734 a35735 a35736 a35737 a35738 a35739 a35740 a35741 a35742 a35743 a35744 a35745 a35746 a35747 a35748 a35749 a35750 a35751 a35752 a35753 a35754 a35755 a35756 a35757 a35758 a35759 a35760 a35761 a35762 a35763 a35764 a35765 a35766 a35767 a35768 a35769 a35770 a35771 a35772 a35773 a35774 a35775 a35776 a35777 a35778 a35779 a35780 a35781 a35782 a35783 a35784 a35785 a35786 a35787 a35788 a35789 a35790 a35791 a35792 a35793 a35794 a35795 a35796 a35797 a35798 a35799 a35800 a35801 a35802 a35803 a35804 a35805 a35806 a35807 a35808 a35809 a35810 a35811 a35812 a35813 a35814 a35815 a35816 a35817 a35818 a35819 a35820 a35821 a35822 a35823 a35824 a35825 a35826 a35827 a35828 a35829 a35830 a35831 a35832 a35833 a35834 a35835 a35836 a35837 a35838 a35839 a35840 a35841 a35842 a35843 a35844 a35845 a35846 a35847 a35848 a35849 a35850 a35851 a35852 a35853 a35854 a35855 a35856 a35857 a35858 a35859 a35860 a35861 a35862 a35863 a35864 a35865 a35866 a35867 a35868 a35869 a35870 a35871 a35872 a35873 a35874 a35875 a35876 a35877 a35878 a35879 a35880 a35881 a35882 a35883 a35884 a35885 a35886 a35887 a35888 a35889 a35890 a35891 a35892 a35893 a35894 a35895 a35896 a35897 a35898 a35899 a35900 a35901 a35902 a35903 a35904 a35905 a35906 a35907 a35908 a35909 a35910 a35911 a35912 a35913 a35914 a35915 a35916 a35917 a35918 a35919 a35920 a35921 a35922 a35923 a35924 a35925 a35926 a35927 a35928 a35929 a35930 a35931 a35932 a35933 a35934 a35935 a35936 a35937 a35938 a35939 a35940 a35941 a35942 a35943 a35944 a35945 a35946 a35947 a35948 a35949 a35950 a35951 a35952 a35953 a35954 a35955 a35956 a35957 a35958 a35959 a35960 a35961 a35962 a35963 a35964 a35965 a35966 a35967 a35968 a35969 a35970 a35971 a35972 a35973 a35974 a35975 a35976 a35977 a35978 a35979 a35980 a35981 a35982 a35983 a35984 a35985 a35986 a35987 a35988 a35989 a35990 a35991 a35992 a35993 a35994 a35995 a35996 a35997 a35998 a35999 a36000 a36001 a36002 a36003 a36004 a36005 a36006 a36007 a36008 a36009 a36010 a36011 a36012 a36013 a36014 a36015 a36016 a36017 a36018 a36019 a36020 a36021 a36022 a36023 a36024 a36025 a36026 a36027 a36028 a36029 a36030 a36031 a36032 a36033 a36034 a36035 a36036 a36037 a36038 a36039 a36040 a36041 a36042 a36043 a36044 a36045 a36046 a36047 a36048 a36049 a36050 a36051 a36052 a36053 a36054 a36055 a36056 a36057 a36058 a36059 a36060 a36061 a36062 a36063 a36064 a36065 a36066 a36067 a36068 a36069 a36070 a36071 a36072 a36073 a36074 a36075 a36076 a36077 a36078 a36079 a36080 a36081 a36082 a36083 a36084 a36085 a36086 a36087 a36088 a36089 a36090 a36091 a36092 a36093 a36094 a36095 a36096 a36097 a36098 a36099 a36100 a36101 a36102 a36103 a36104 a36105 a36106 a36107 a36108 a36109 a36110 a36111 a36112 a36113 a36114 a36115 a36116 a36117 a36118 a36119 a36120 a36121 a36122 a36123 a36124 a36125 a36126 a36127 a36128 a36129 a36130 a36131 a36132 a36133 a36134 a36135 a36136 a36137 a36138 a36139 a36140 a36141 a36142 a36143 a36144 a36145 a36146 a36147 a36148 a36149 a36150 a36151 a36152 a36153 a36154 a36155 a36156 a36157 a36158 a36159 a36160 a36161 a36162 a36163 a36164 a36165 a36166 a36167 a36168 a36169 a36170 a36171 a36172 a36173 a36174 a36175 a36176 a36177 a36178 a36179 a36180 a36181 a36182 a36183 a36184 a36185 a36186 a36187 a36188 a36189 a36190 a36191 a36192 a36193 a36194 a36195 a36196 a36197 a36198 a36199 a36200 a36201 a36202 a36203 a36204 a36205 a36206 a36207 a36208 a36209 a36210 a36211 a36212 a36213 a36214 a36215 a36216 a36217 a36218 a36219 a36220 a36221 a36222 a36223 a36224 a36225 a36226 a36227 a36228 a36229 a36230 a36231 a36232 a36233 a36234 a36235 a36236 a36237 a36238 a36239 a36240 a36241 a36242 a36243 a36244 a36245 a36246 a36247 a36248 a36249 a36250 a36251 a36252 a36253 a36254 a36255 a36256 a36257 a36258 a36259 a36260 a36261 a36262 a36263 a36264 a36265 a36266 a36267 a36268 a36269 a36270 a36271 a36272 a36273 a36274 a36275 a36276 a36277 a36278 a36279 a36280 a36281 a36282 a36283 a36284 a36285 a36286 a36287 a36288 a36289 a36290 a36291 a36292 a36293 a36294 a36295 a36296 a36297 a36298 a36299 a36300 a36301 a36302 a36303 a36304 a36305 a36306 a36307 a36308 a36309 a36310 a36311 a36312 a36313 a36314 a36315 a36316 a36317 a36318 a36319 a36320 a36321 a36322 a36323 a36324 a36325 a36326 a36327 a36328 a36329 a36330 a36331 a36332 a36333 a36334 a36335 a36336 a36337 a36338 a36339 a36340 a36341 a36342 a36343 a36344 a36345 a36346 a36347 a36348 a36349 a36350 a36351 a36352 a36353 a36354 a36355 a36356 a36357 a36358 a36359 a36360 a36361 a36362 a36363 a36364 a36365 a36366 a36367 a36368 a36369 a36370 a36371 a36372 a36373 a36374 a36375 a36376 a36377 a36378 a36379 a36380 a36381 a36382 a36383 a36384 a36385 a36386 a36387 a36388 a36389 a36390 a36391 a36392 a36393 a36394 a36395 a36396 a36397 a36398 a36399 a36400 a36401 a36402 a36403 a36404 a36405 a36406 a36407 a36408 a36409 a36410 a36411 a36412 a36413 a36414 a36415 a36416 a36417 a36418 a36419 a36420 a36421 a36422 a36423 a36424 a36425 a36426 a36427 a36428 a36429 a36430 a36431 a36432 a36433 a36434 a36435 a36436 a36437 a36438 a36439 a36440 a36441 a36442 a36443 a36444 a36445 a36446 a36447 a36448 a36449 a36450 a36451 a36452 a36453 a36454 a36455 a36456 a36457 a36458 a36459 a36460 a36461 a36462 a36463 a36464 a36465 a36466 a36467 a36468 a36469 a36470 a36471 a36472 a36473 a36474 a36475 a36476 a36477 a36478 a36479 a36480 a36481 a36482 a36483 a36484 a36485 a36486 a36487 a36488 a36489 a36490 a36491 a36492 a36493 a36494 a36495 a36496 a36497 a36498 a36499 a36500 a36501 a36502 a36503 a36504 a36505 a36506 a36507 a36508 a36509 a36510 a36511 a36512 a36513 a36514 a36515 a36516 a36517 a36518 a36519 a36520 a36521 a36522 a36523 a36524 a36525 a36526 a36527 a36528 a36529 a36530 a36531 a36532 a36533 a36534 a36535 a36536 a36537 a36538 a36539 a36540 a36541 a36542 a36543 a36544 a36545 a36546 a36547 a36548 a36549 a36550 a36551 a36552 a36553 a36554 a36555 a36556 a36557 a36558 a36559 a36560 a36561 a36562 a36563 a36564 a36565 a36566 a36567 a36568 a36569 a36570 a36571 a36572 a36573 a36574 a36575 a36576 a36577 a36578 a36579 a36580 a36581 a36582 a36583 a36584 a36585 a36586 a36587 a36588 a36589 a36590 a36591 a36592 a36593 a36594 a36595 a36596 a36597 a36598 a36599 a36600 a36601 a36602 a36603 a36604 a36605 a36606 a36607 a36608 a36609 a36610 a36611 a36612 a36613 a36614 a36615 a36616 a36617 a36618 a36619 a36620 a36621 a36622 a36623 a36624 a36625 a36626 a36627 a36628 a36629 a36630 a36631 a36632 a36633 a36634 a36635 a36636 a36637 a36638 a36639 a36640 a36641 a36642 a36643 a36644 a36645 a36646 a36647 a36648 a36649 a36650 a36651 a36652 a36653 a36654 a36655 a36656 a36657 a36658 a36659 a36660 a36661 a36662 a36663 a36664 a36665 a36666 a36667 a36668 a36669 a36670 a36671 a36672 a36673 a36674 a36675 a36676 a36677 a36678 a36679 a36680 a36681 a36682 a36683 a36684 a36685 a36686 a36687 a36688 a36689 a36690 a36691 a36692 a36693 a36694 a36695 a36696 a36697 a36698 a36699 a36700 a36701 a36702 a36703 a36704 a36705 a36706 a36707 a36708 a36709 a36710 a36711 a36712 a36713 a36714 a36715 a36716 a36717 a36718 a36719 a36720 a36721 a36722 a36723 a36724 a36725 a36726 a36727 a36728 a36729 a36730 a36731 a36732 a36733 a36734 a36735 a36736 a36737 a36738 a36739 a36740 a36741 a36742 a36743 a36744 a36745 a36746 a36747 a36748 a36749 a36750 a36751 a36752 a36753 a36754 a36755 a36756 a36757 a36758 a36759 a36760 a36761 a36762 a36763 a36764 a36765 a36766 a36767 a36768 a36769 a36770 a36771 a36772 a36773 a36774 a36775 a36776 a36777 a36778 a36779 a36780 a36781 a36782 a36783 a36784 a36785 a36786 a36787 a36788 a36789 a36790 a36791 a36792 a36793 a36794 a36795 a36796 a36797 a36798 a36799 a36800 a36801 a36802 a36803 a36804 a36805 a36806 a36807 a36808 a36809 a36810 a36811 a36812 a36813 a36814 a36815 a36816 a36817 a36818 a36819 a36820 a36821 a36822 a36823 a36824 a36825 a36826 a36827 a36828 a36829 a36830 a36831 a36832 a36833 a36834 a36835 a36836 a36837 a36838 a36839 a36840 a36841 a36842 a36843 a36844 a36845 a36846 a36847 a36848 a36849 a36850 a36851 a36852 a36853 a36854 a36855 a36856 a36857 a36858 a36859 a36860 a36861 a36862 a36863 a36864 a36865 a36866 a36867 a36868 a36869 a36870 a36871 a36872 a36873 a36874 a36875 a36876 a36877 a36878 a36879 a36880 a36881 a36882 a36883 a36884 a36885 a36886 a36887 a36888 a36889 a36890 a36891 a36892 a36893 a36894 a36895 a36896 a36897 a36898 a36899 a36900 a36901 a36902 a36903 a36904 a36905 a36906 a36907 a36908 a36909 a36910 a36911 a36912 a36913 a36914 a36915 a36916 a36917 a36918 a36919 a36920 a36921 a36922 a36923 a36924 a36925 a36926 a36927 a36928 a36929 a36930 a36931 a36932 a36933 a36934 a36935 a36936 a36937 a36938 a36939 a36940 a36941 a36942 a36943 a36944 a36945 a36946 a36947 a36948 a36949 a36950 a36951 a36952 a36953 a36954 a36955 a36956 a36957 a36958 a36959 a36960 a36961 a36962 a36963 a36964 a36965 a36966 a36967 a36968 a36969 a36970 a36971 a36972 a36973 a36974 a36975 a36976 a36977 a36978 a36979 a36980 a36981 a36982 a36983 a36984 a36985 a36986 a36987 a36988 a36989 a36990 a36991 a36992 a36993 a36994 a36995 a36996 a36997 a36998 a36999 a37000 a37001 a37002 a37003 a37004 a37005 a37006 a37007 a37008 a37009 a37010 a37011 a37012 a37013 a37014 a37015 a37016 a37017 a37018 a37019 a37020 a37021 a37022 a37023 a37024 a37025 a37026 a37027 a37028 a37029 a37030 a37031 a37032 a37033 a37034 a37035 a37036 a37037 a37038 a37039 a37040 a37041 a37042 a37043 a37044 a37045 a37046 a37047 a37048 a37049 a37050 a37051 a37052 a37053 a37054 a37055 a37056 a37057 a37058 a37059 a37060 a37061 a37062 a37063 a37064 a37065 a37066 a37067 a37068 a37069 a37070 a37071 a37072 a37073 a37074 a37075 a37076 a37077 a37078 a37079 a37080 a37081 a37082 a37083 a37084 a37085 a37086 a37087 a37088 a37089 a37090 a37091 a37092 a37093 a37094 a37095 a37096 a37097 a37098 a37099 a37100 a37101 a37102 a37103 a37104 a37105 a37106 a37107 a37108 a37109 a37110 a37111 a37112 a37113 a37114 a37115 a37116 a37117 a37118 a37119 a37120 a37121 a37122 a37123 a37124 a37125 a37126 a37127 a37128 a37129 a37130 a37131 a37132 a37133 a37134 a37135 a37136 a37137 a37138 a37139 a37140 a37141 a37142 a37143 a37144 a37145 a37146 a37147 a37148 a37149 a37150 a37151 a37152 a37153 a37154 a37155 a37156 a37157 a37158 a37159 a37160 a37161 a37162 a37163 a37164 a37165 a37166 a37167 a37168 a37169 a37170 a37171 a37172 a37173 a37174 a37175 a37176 a37177 a37178 a37179 a37180 a37181 a37182 a37183 a37184 a37185 a37186 a37187 a37188 a37189 a37190 a37191 a37192 a37193 a37194 a37195 a37196 a37197 a37198 a37199 a37200 a37201 a37202 a37203 a37204 a37205 a37206 a37207 a37208 a37209 a37210 a37211 a37212 a37213 a37214 a37215 a37216 a37217 a37218 a37219 a37220 a37221 a37222 a37223 a37224 a37225 a37226 a37227 a37228 a37229 a37230 a37231 a37232 a37233 a37234 a37235 a37236 a37237 a37238 a37239 a37240 a37241 a37242 a37243 a37244 a37245 a37246 a37247 a37248 a37249 a37250 a37251 a37252 a37253 a37254 a37255 a37256 a37257 a37258 a37259 a37260 a37261 a37262 a37263 a37264 a37265 a37266 a37267 a37268 a37269 a37270 a37271 a37272 a37273 a37274 a37275 a37276 a37277 a37278 a37279 a37280 a37281 a37282 a37283 a37284 a37285 a37286 a37287 a37288 a37289 a37290 a37291 a37292 a37293 a37294 a37295 a37296 a37297 a37298 a37299 a37300 a37301 a37302 a37303 a37304 a37305 a37306 a37307 a37308 a37309 a37310 a37311 a37312 a37313 a37314 a37315 a37316 a37317 a37318 a37319 a37320 a37321 a37322 a37323 a37324 a37325 a37326 a37327 a37328 a37329 a37330 a37331 a37332 a37333 a37334 a37335 a37336 a37337 a37338 a37339 a37340 a37341 a37342 a37343 a37344 a37345 a37346 a37347 a37348 a37349 a37350 a37351 a37352 a37353 a37354 a37355 a37356 a37357 a37358 a37359 a37360 a37361 a37362 a37363 a37364 a37365 a37366 a37367 a37368 a37369 a37370 a37371 a37372 a37373 a37374 a37375 a37376 a37377 a37378 a37379 a37380 a37381 a37382 a37383 a37384 a37385 a37386 a37387 a37388 a37389 a37390 a37391 a37392 a37393 a37394 a37395 a37396 a37397 a37398 a37399 a37400 a37401 a37402 a37403 a37404 a37405 a37406 a37407 a37408 a37409 a37410 a37411 a37412 a37413 a37414 a37415 a37416 a37417 a37418 a37419 a37420 a37421 a37422 a37423 a37424 a37425 a37426 a37427 a37428 a37429 a37430 a37431 a37432 a37433 a37434 a37435 a37436 a37437 a37438 a37439 a37440 a37441 a37442 a37443 a37444 a37445 a37446 a37447 a37448 a37449 a37450 a37451 a37452 a37453 a37454 a37455 a37456 a37457 a37458 a37459 a37460 a37461 a37462 a37463 a37464 a37465 a37466 a37467 a37468 a37469 a37470 a37471 a37472 a37473 a37474 a37475 a37476 a37477 a37478 a37479 a37480 a37481 a37482 a37483 a37484 a37485 a37486 a37487 a37488 a37489 a37490 a37491 a37492 a37493 a37494 a37495 a37496 a37497 a37498 a37499 a37500 a37501 a37502 a37503 a37504 a37505 a37506 a37507 a37508 a37509 a37510 a37511 a37512 a37513 a37514 a37515 a37516 a37517 a37518 a37519 a37520 a37521 a37522 a37523 a37524 a37525 a37526 a37527 a37528 a37529 a37530 a37531 a37532 a37533 a37534 a37535 a37536 a37537 a37538 a37539 a37540 a37541 a37542 a37543 a37544 a37545 a37546 a37547 a37548 a37549 a37550 a37551 a37552 a37553 a37554 a37555 a37556 a37557 a37558 a37559 a37560 a37561 a37562 a37563 a37564 a37565 a37566 a37567 a37568 a37569 a37570 a37571 a37572 a37573 a37574 a37575 a37576 a37577 a37578 a37579 a37580 a37581 a37582 a37583 a37584 a37585 a37586 a37587 a37588 a37589 a37590 a37591 a37592 a37593 a37594 a37595 a37596 a37597 a37598 a37599 a37600 a37601 a37602 a37603 a37604 a37605 a37606 a37607 a37608 a37609 a37610 a37611 a37612 a37613 a37614 a37615 a37616 a37617 a37618 a37619 a37620 a37621 a37622 a37623 a37624 a37625 a37626 a37627 a37628 a37629 a37630 a37631 a37632 a37633 a37634 a37635 a37636 a37637 a37638 a37639 a37640 a37641 a37642 a37643 a37644 a37645 a37646 a37647 a37648 a37649 a37650 a37651 a37652 a37653 a37654 a37655 a37656 a37657 a37658 a37659 a37660 a37661 a37662 a37663 a37664 a37665 a37666 a37667 a37668 a37669 a37670 a37671 a37672 a37673 a37674 a37675 a37676 a37677 a37678 a37679 a37680 a37681 a37682 a37683 a37684 a37685 a37686 a37687 a37688 a37689 a37690 a37691 a37692 a37693 a37694 a37695 a37696 a37697 a37698 a37699 a37700 a37701 a37702 a37703 a37704 a37705 a37706 a37707 a37708 a37709 a37710 a37711 a37712 a37713 a37714 a37715 a37716 a37717 a37718 a37719 a37720 a37721 a37722 a37723 a37724 a37725 a37726 a37727 a37728 a37729 a37730 a37731 a37732 a37733 a37734 a37735 a37736 a37737 a37738 a37739 a37740 a37741 a37742 a37743 a37744 a37745 a37746 a37747 a37748 a37749 a37750 a37751 a37752 a37753 a37754 a37755 a37756 a37757 a37758 a37759 a37760 a37761 a37762 a37763 a37764 a37765 a37766 a37767 a37768 a37769 a37770 a37771 a37772 a37773 a37774 a37775 a37776 a37777 a37778 a37779 a37780 a37781 a37782 a37783 a37784 a37785 a37786 a37787 a37788 a37789 a37790 a37791 a37792 a37793 a37794 a37795 a37796 a37797 a37798 a37799 a37800 a37801 a37802 a37803 a37804 a37805 a37806 a37807 a37808 a37809 a37810 a37811 a37812 a37813 a37814 a37815 a37816 a37817 a37818 a37819 a37820 a37821 a37822 a37823 a37824 a37825 a37826 a37827 a37828 a37829 a37830 a37831 a37832 a37833 a37834 a37835 a37836 a37837 a37838 a37839 a37840 a37841 a37842 a37843 a37844 a37845 a37846 a37847 a37848 a37849 a37850 a37851 a37852 a37853 a37854 a37855 a37856 a37857 a37858 a37859 a37860 a37861 a37862 a37863 a37864 a37865 a37866 a37867 a37868 a37869 a37870 a37871 a37872 a37873 a37874 a37875 a37876 a37877 a37878 a37879 a37880 a37881 a37882 a37883 a37884 a37885 a37886 a37887 a37888 a37889 a37890 a37891 a37892 a37893 a37894 a37895 a37896 a37897 a37898 a37899 a37900 a37901 a37902 a37903 a37904 a37905 a37906 a37907 a37908 a37909 a37910 a37911 a37912 a37913 a37914 a37915 a37916 a37917 a37918 a37919 a37920 a37921 a37922 a37923 a37924 a37925 a37926 a37927 a37928 a37929 a37930 a37931 a37932 a37933 a37934 a37935 a37936 a37937 a37938 a37939 a37940 a37941 a37942 a37943 a37944 a37945 a37946 a37947 a37948 a37949 a37950 a37951 a37952 a37953 a37954 a37955 a37956 a37957 a37958 a37959 a37960 a37961 a37962 a37963 a37964 a37965 a37966 a37967 a37968 a37969 a37970 a37971 a37972 a37973 a37974 a37975 a37976 a37977 a37978 a37979 a37980 a37981 a37982 a37983 a37984 a37985 a37986 a37987 a37988 a37989 a37990 a37991 a37992 a37993 a37994 a37995 a37996 a37997 a37998 a37999 a38000 a38001 a38002 a38003 a38004 a38005 a38006 a38007 a38008 a38009 a38010 a38011 a38012 a38013 a38014 a38015 a38016 a38017 a38018 a38019 a38020 a38021 a38022 a38023 a38024 a38025 a38026 a38027 a38028 a38029 a38030 a38031 a38032 a38033 a38034 a38035 a38036 a38037 a38038 a38039 a38040 a38041 a38042 a38043 a38044 a38045 a38046 a38047 a38048 a38049 a38050 a38051 a38052 a38053 a38054 a38055 a38056 a38057 a38058 a38059 a38060 a38061 a38062 a38063 a38064 a38065 a38066 a38067 a38068 a38069 a38070 a38071 a38072 a38073 a38074 a38075 a38076 a38077 a38078 a38079 a38080 a38081 a38082 a38083 a38084 a38085 a38086 a38087 a38088 a38089 a38090 a38091 a38092 a38093 a38094 a38095 a38096 a38097 a38098 a38099 a38100 a38101 a38102 a38103 a38104 a38105 a38106 a38107 a38108 a38109 a38110 a38111 a38112 a38113 a38114 a38115 a38116 a38117 a38118 a38119 a38120 a38121 a38122 a38123 a38124 a38125 a38126 a38127 a38128 a38129 a38130 a38131 a38132 a38133 a38134 a38135 a38136 a38137 a38138 a38139 a38140 a38141 a38142 a38143 a38144 a38145 a38146 a38147 a38148 a38149 a38150 a38151 a38152 a38153 a38154 a38155 a38156 a38157 a38158 a38159 a38160 a38161 a38162 a38163 a38164 a38165 a38166 a38167 a38168 a38169 a38170 a38171 a38172 a38173 a38174 a38175 a38176 a38177 a38178 a38179 a38180 a38181 a38182 a38183 a38184 a38185 a38186 a38187 a38188 a38189 a38190 a38191 a38192 a38193 a38194 a38195 a38196 a38197 a38198 a38199 a38200 a38201 a38202 a38203 a38204 a38205 a38206 a38207 a38208 a38209 a38210 a38211 a38212 a38213 a38214 a38215 a38216 a38217 a38218 a38219 a38220 a38221 a38222 a38223 a38224 a38225 a38226 a38227 a38228 a38229 a38230 a38231 a38232 a38233 a38234 a38235 a38236 a38237 a38238 a38239 a38240 a38241 a38242 a38243 a38244 a38245 a38246 a38247 a38248 a38249 a38250 a38251 a38252 a38253 a38254 a38255 a38256 a38257 a38258 a38259 a38260 a38261 a38262 a38263 a38264 a38265 a38266 a38267 a38268 a38269 a38270 a38271 a38272 a38273 a38274 a38275 a38276 a38277 a38278 a38279 a38280 a38281 a38282 a38283 a38284 a38285 a38286 a38287 a38288 a38289 a38290 a38291 a38292 a38293 a38294 a38295 a38296 a38297 a38298 a38299 a38300 a38301 a38302 a38303 a38304 a38305 a38306 a38307 a38308 a38309 a38310 a38311 a38312 a38313 a38314 a38315 a38316 a38317 a38318 a38319 a38320 a38321 a38322 a38323 a38324 a38325 a38326 a38327 a38328 a38329 a38330 a38331 a38332 a38333 a38334 a38335 a38336 a38337 a38338 a38339 a38340 a38341 a38342 a38343 a38344 a38345 a38346 a38347 a38348 a38349 a38350 a38351 a38352 a38353 a38354 a38355 a38356 a38357 a38358 a38359 a38360 a38361 a38362 a38363 a38364 a38365 a38366 a38367 a38368 a38369 a38370 a38371 a38372 a38373 a38374 a38375 a38376 a38377 a38378 a38379 a38380 a38381 a38382 a38383 a38384 a38385 a38386 a38387 a38388 a38389 a38390 a38391 a38392 a38393 a38394 a38395 a38396 a38397 a38398 a38399 a38400 a38401 a38402 a38403 a38404 a38405 a38406 a38407 a38408 a38409 a38410 a38411 a38412 a38413 a38414 a38415 a38416 a38417 a38418 a38419 a38420 a38421 a38422 a38423 a38424 a38425 a38426 a38427 a38428 a38429 a38430 a38431 a38432 a38433 a38434 a38435 a38436 a38437 a38438 a38439 a38440 a38441 a38442 a38443 a38444 a38445 a38446 a38447 a38448 a38449 a38450 a38451 a38452 a38453 a38454 a38455 a38456 a38457 a38458 a38459 a38460 a38461 a38462 a38463 a38464 a38465 a38466 a38467 a38468 a38469 a38470 a38471 a38472 a38473 a38474 a38475 a38476 a38477 a38478 a38479 a38480 a38481 a38482 a38483 a38484 a38485 a38486 a38487 a38488 a38489 a38490 a38491 a38492 a38493 a38494 a38495 a38496 a38497 a38498 a38499 a38500 a38501 a38502 a38503 a38504 a38505 a38506 a38507 a38508 a38509 a38510 a38511 a38512 a38513 a38514 a38515 a38516 a38517 a38518 a38519 a38520 a38521 a38522 a38523 a38524 a38525 a38526 a38527 a38528 a38529 a38530 a38531 a38532 a38533 a38534 a38535 a38536 a38537 a38538 a38539 a38540 a38541 a38542 a38543 a38544 a38545 a38546 a38547 a38548 a38549 a38550 a38551 a38552 a38553 a38554 a38555 a38556 a38557 a38558 a38559 a38560 a38561 a38562 a38563 a38564 a38565 a38566 a38567 a38568 a38569 a38570 a38571 a38572 a38573 a38574 a38575 a38576 a38577 a38578 a38579 a38580 a38581 a38582 a38583 a38584 a38585 a38586 a38587 a38588 a38589 a38590 a38591 a38592 a38593 a38594 a38595 a38596 a38597 a38598 a38599 a38600 a38601 a38602 a38603 a38604 a38605 a38606 a38607 a38608 a38609 a38610 a38611 a38612 a38613 a38614 a38615 a38616 a38617 a38618 a38619 a38620 a38621 a38622 a38623 a38624 a38625 a38626 a38627 a38628 a38629 a38630 a38631 a38632 a38633 a38634 a38635 a38636 a38637 a38638 a38639 a38640 a38641 a38642 a38643 a38644 a38645 a38646 a38647 a38648 a38649 a38650 a38651 a38652 a38653 a38654 a38655 a38656 a38657 a38658 a38659 a38660 a38661 a38662 a38663 a38664 a38665 a38666 a38667 a38668 a38669 a38670 a38671 a38672 a38673 a38674 a38675 a38676 a38677 a38678 a38679 a38680 a38681 a38682 a38683 a38684 a38685 a38686 a38687 a38688 a38689 a38690 a38691 a38692 a38693 a38694 a38695 a38696 a38697 a38698 a38699 a38700 a38701 a38702 a38703 a38704 a38705 a38706 a38707 a38708 a38709 a38710 a38711 a38712 a38713 a38714 a38715 a38716 a38717 a38718 a38719 a38720 a38721 a38722 a38723 a38724 a38725 a38726 a38727 a38728 a38729 a38730 a38731 a38732 a38733 a38734 a38735 a38736 a38737 a38738 a38739 a38740 a38741 a38742 a38743 a38744 a38745 a38746 a38747 a38748 a38749 a38750 a38751 a38752 a38753 a38754 a38755 a38756 a38757 a38758 a38759 a38760 a38761 a38762 a38763 a38764 a38765 a38766 a38767 a38768 a38769 a38770 a38771 a38772 a38773 a38774 a38775 a38776 a38777 a38778 a38779 a38780 a38781 a38782 a38783 a38784 a38785 a38786 a38787 a38788 a38789 a38790 a38791 a38792 a38793 a38794 a38795 a38796 a38797 a38798 a38799 a38800 a38801 a38802 a38803 a38804 a38805 a38806 a38807 a38808 a38809 a38810 a38811 a38812 a38813 a38814 a38815 a38816 a38817 a38818 a38819 a38820 a38821 a38822 a38823 a38824 a38825 a38826 a38827 a38828 a38829 a38830 a38831 a38832 a38833 a38834 a38835 a38836 a38837 a38838 a38839 a38840 a38841 a38842 a38843 a38844 a38845 a38846 a38847 a38848 a38849 a38850 a38851 a38852 a38853 a38854 a38855 a38856 a38857 a38858 a38859 a38860 a38861 a38862 a38863 a38864 a38865 a38866 a38867 a38868 a38869 a38870 a38871 a38872 a38873 a38874 a38875 a38876 a38877 a38878 a38879 a38880 a38881 a38882 a38883 a38884 a38885 a38886 a38887 a38888 a38889 a38890 a38891 a38892 a38893 a38894 a38895 a38896 a38897 a38898 a38899 a38900 a38901 a38902 a38903 a38904 a38905 a38906 a38907 a38908 a38909 a38910 a38911 a38912 a38913 a38914 a38915 a38916 a38917 a38918 a38919 a38920 a38921 a38922 a38923 a38924 a38925 a38926 a38927 a38928 a38929 a38930 a38931 a38932 a38933 a38934 a38935 a38936 a38937 a38938 a38939 a38940 a38941 a38942 a38943 a38944 a38945 a38946 a38947 a38948 a38949 a38950 a38951 a38952 a38953 a38954 a38955 a38956 a38957 a38958 a38959 a38960 a38961 a38962 a38963 a38964 a38965 a38966 a38967 a38968 a38969 a38970 a38971 a38972 a38973 a38974 a38975 a38976 a38977 a38978 a38979 a38980 a38981 a38982 a38983 a38984 a38985 a38986 a38987 a38988 a38989 a38990 a38991 a38992 a38993 a38994 a38995 a38996 a38997 a38998 a38999 a39000 a39001 a39002 a39003 a39004 a39005 a39006 a39007 a39008 a39009 a39010 a39011 a39012 a39013 a39014 a39015 a39016 a39017 a39018 a39019 a39020 a39021 a39022 a39023 a39024 a39025 a39026 a39027 a39028 a39029 a39030 a39031 a39032 a39033 a39034 a39035 a39036 a39037 a39038 a39039 a39040 a39041 a39042 a39043 a39044 a39045 a39046 a39047 a39048 a39049 a39050 a39051 a39052 a39053 a39054 a39055 a39056 a39057 a39058 a39059 a39060 a39061 a39062 a39063 a39064 a39065 a39066 a39067 a39068 a39069 a39070 a39071 a39072 a39073 a39074 a39075 a39076 a39077 a39078 a39079 a39080 a39081 a39082 a39083 a39084 a39085 a39086 a39087 a39088 a39089 a39090 a39091 a39092 a39093 a39094 a39095 a39096 a39097 a39098 a39099 a39100 a39101 a39102 a39103 a39104 a39105 a39106 a39107 a39108 a39109 a39110 a39111 a39112 a39113 a39114 a39115 a39116 a39117 a39118 a39119 a39120 a39121 a39122 a39123 a39124 a39125 a39126 a39127 a39128 a39129 a39130 a39131 a39132 a39133 a39134 a39135 a39136 a39137 a39138 a39139 a39140 a39141 a39142 a39143 a39144 a39145 a39146 a39147 a39148 a39149 a39150 a39151 a39152 a39153 a39154 a39155 a39156 a39157 a39158 a39159 a39160 a39161 a39162 a39163 a39164 a39165 a39166 a39167 a39168 a39169 a39170 a39171 a39172 a39173 a39174 a39175 a39176 a39177 a39178 a39179 a39180 a39181 a39182 a39183 a39184 a39185 a39186 a39187 a39188 a39189 a39190 a39191 a39192 a39193 a39194 a39195 a39196 a39197 a39198 a39199 a39200 a39201 a39202 a39203 a39204 a39205 a39206 a39207 a39208 a39209 a39210 a39211 a39212 a39213 a39214 a39215 a39216 a39217 a39218 a39219 a39220 a39221 a39222 a39223 a39224 a39225 a39226 a39227 a39228 a39229 a39230 a39231 a39232 a39233 a39234 a39235 a39236 a39237 a39238 a39239 a39240 a39241 a39242 a39243 a39244 a39245 a39246 a39247 a39248 a39249 a39250 a39251 a39252 a39253 a39254 a39255 a39256 a39257 a39258 a39259 a39260 a39261 a39262 a39263 a39264 a39265 a39266 a39267 a39268 a39269 a39270 a39271 a39272 a39273 a39274 a39275 a39276 a39277 a39278 a39279 a39280 a39281 a39282 a39283 a39284 a39285 a39286 a39287 a39288 a39289 a39290 a39291 a39292 a39293 a39294 a39295 a39296 a39297 a39298 a39299 a39300 a39301 a39302 a39303 a39304 a39305 a39306 a39307 a39308 a39309 a39310 a39311 a39312 a39313 a39314 a39315 a39316 a39317 a39318 a39319 a39320 a39321 a39322 a39323 a39324 a39325 a39326 a39327 a39328 a39329 a39330 a39331 a39332 a39333 a39334 a39335 a39336 a39337 a39338 a39339 a39340 a39341 a39342 a39343 a39344 a39345 a39346 a39347 a39348 a39349 a39350 a39351 a39352 a39353 a39354 a39355 a39356 a39357 a39358 a39359 a39360 a39361 a39362 a39363 a39364 a39365 a39366 a39367 a39368 a39369 a39370 a39371 a39372 a39373 a39374 a39375 a39376 a39377 a39378 a39379 a39380 a39381 a39382 a39383 a39384 a39385 a39386 a39387 a39388 a39389 a39390 a39391 a39392 a39393 a39394 a39395 a39396 a39397 a39398 a39399 a39400 a39401 a39402 a39403 a39404 a39405 a39406 a39407 a39408 a39409 a39410 a39411 a39412 a39413 a39414 a39415 a39416 a39417 a39418 a39419 a39420 a39421 a39422 a39423 a39424 a39425 a39426 a39427 a39428 a39429 a39430 a39431 a39432 a39433 a39434 a39435 a39436 a39437 a39438 a39439 a39440 a39441 a39442 a39443 a39444 a39445 a39446 a39447 a39448 a39449 a39450 a39451 a39452 a39453 a39454 a39455 a39456 a39457 a39458 a39459 a39460 a39461 a39462 a39463 a39464 a39465 a39466 a39467 a39468 a39469 a39470 a39471 a39472 a39473 a39474 a39475 a39476 a39477 a39478 a39479 a39480 a39481 a39482 a39483 a39484 a39485 a39486 a39487 a39488 a39489 a39490 a39491 a39492 a39493 a39494 a39495 a39496 a39497 a39498 a39499 a39500 a39501 a39502 a39503 a39504 a39505 a39506 a39507 a39508 a39509 a39510 a39511 a39512 a39513 a39514 a39515 a39516 a39517 a39518 a39519 a39520 a39521 a39522 a39523 a39524 a39525 a39526 a39527 a39528 a39529 a39530 a39531 a39532 a39533 a39534 a39535 a39536 a39537 a39538 a39539 a39540 a39541 a39542 a39543 a39544 a39545 a39546 a39547 a39548 a39549 a39550 a39551 a39552 a39553 a39554 a39555 a39556 a39557 a39558 a39559 a39560 a39561 a39562 a39563 a39564 a39565 a39566 a39567 a39568 a39569 a39570 a39571 a39572 a39573 a39574 a39575 a39576 a39577 a39578 a39579 a39580 a39581 a39582 a39583 a39584 a39585 a39586 a39587 a39588 a39589 a39590 a39591 a39592 a39593 a39594 a39595 a39596 a39597 a39598 a39599 a39600 a39601 a39602 a39603 a39604 a39605 a39606 a39607 a39608 a39609 a39610 a39611 a39612 a39613 a39614 a39615 a39616 a39617 a39618 a39619 a39620 a39621 a39622 a39623 a39624 a39625 a39626 a39627 a39628 a39629 a39630 a39631 a39632 a39633 a39634 a39635 a39636 a39637 a39638 a39639 a39640 a39641 a39642 a39643 a39644 a39645 a39646 a39647 a39648 a39649 a39650 a39651 a39652 a39653 a39654 a39655 a39656 a39657 a39658 a39659 a39660 a39661 a39662 a39663 a39664 a39665 a39666 a39667 a39668 a39669 a39670 a39671 a39672 a39673 a39674 a39675 a39676 a39677 a39678 a39679 a39680 a39681 a39682 a39683 a39684 a39685 a39686 a39687 a39688 a39689 a39690 a39691 a39692 a39693 a39694 a39695 a39696 a39697 a39698 a39699 a39700 a39701 a39702 a39703 a39704 a39705 a39706 a39707 a39708 a39709 a39710 a39711 a39712 a39713 a39714 a39715 a39716 a39717 a39718 a39719 a39720 a39721 a39722 a39723 a39724 a39725 a39726 a39727 a39728 a39729 a39730 a39731 a39732 a39733 a39734 a39735 a39736 a39737 a39738 a39739 a39740 a39741 a39742 a39743 a39744 a39745 a39746 a39747 a39748 a39749 a39750 a39751 a39752 a39753 a39754 a39755 a39756 a39757 a39758 a39759 a39760 a39761 a39762 a39763 a39764 a39765 a39766 a39767 a39768 a39769 a39770 a39771 a39772 a39773 a39774 a39775 a39776 a39777 a39778 a39779 a39780 a39781 a39782 a39783 a39784 a39785 a39786 a39787 a39788 a39789 a39790 a39791 a39792 a39793 a39794 a39795 a39796 a39797 a39798 a39799 a39800 a39801 a39802 a39803 a39804 a39805 a39806 a39807 a39808 a39809 a39810 a39811 a39812 a39813 a39814 a39815 a39816 a39817 a39818 a39819 a39820 a39821 a39822 a39823 a39824 a39825 a39826 a39827 a39828 a39829 a39830 a39831 a39832 a39833 a39834 a39835 a39836 a39837 a39838 a39839 a39840 a39841 a39842 a39843 a39844 a39845 a39846 a39847 a39848 a39849 a39850 a39851 a39852 a39853 a39854 a39855 a39856 a39857 a39858 a39859 a39860 a39861 a39862 a39863 a39864 a39865 a39866 a39867 a39868 a39869 a39870 a39871 a39872 a39873 a39874 a39875 a39876 a39877 a39878 a39879 a39880 a39881 a39882 a39883 a39884 a39885 a39886 a39887 a39888 a39889 a39890 a39891 a39892 a39893 a39894 a39895 a39896 a39897 a39898 a39899 a39900 a39901 a39902 a39903 a39904 a39905 a39906 a39907 a39908 a39909 a39910 a39911 a39912 a39913 a39914 a39915 a39916 a39917 a39918 a39919 a39920 a39921 a39922 a39923 a39924 a39925 a39926 a39927 a39928 a39929 a39930 a39931 a39932 a39933 a39934 a39935 a39936 a39937 a39938 a39939 a39940 a39941 a39942 a39943 a39944 a39945 a39946 a39947 a39948 a39949 a39950 a39951 a39952 a39953 a39954 a39955 a39956 a39957 a39958 a39959 a39960 a39961 a39962 a39963 a39964 a39965 a39966 a39967 a39968 a39969 a39970 a39971 a39972 a39973 a39974 a39975 a39976 a39977 a39978 a39979 a39980 a39981 a39982 a39983 a39984 a39985 a39986 a39987 a39988 a39989 a39990 a39991 a39992 a39993 a39994 a39995 a39996 a39997 a39998 a39999 a40000 a40001 a40002 a40003 a40004 a40005 a40006 a40007 a40008 a40009 a40010 a40011 a40012 a40013 a40014 a40015 a40016 a40017 a40018 a40019 a40020 a40021 a40022 a40023 a40024 a40025 a40026 a40027 a40028 a40029 a40030 a40031 a40032 a40033 a40034 a40035 a40036 a40037 a40038 a40039 a40040 a40041 a40042 a40043 a40044 a40045 a40046 a40047 a40048 a40049 a40050 a40051 a40052 a40053 a40054 a40055 a40056 a40057 a40058 a40059 a40060 a40061 a40062 a40063 a40064 a40065 a40066 a40067 a40068 a40069 a40070 a40071 a40072 a40073 a40074 a40075 a40076 a40077 a40078 a40079 a40080 a40081 a40082 a40083 a40084 a40085 a40086 a40087 a40088 a40089 a40090 a40091 a40092 a40093 a40094 a40095 a40096 a40097 a40098 a40099 a40100 a40101 a40102 a40103 a40104 a40105 a40106 a40107 a40108 a40109 a40110 a40111 a40112 a40113 a40114 a40115 a40116 a40117 a40118 a40119 a40120 a40121 a40122 a40123 a40124 a40125 a40126 a40127 a40128 a40129 a40130 a40131 a40132 a40133 a40134 a40135 a40136 a40137 a40138 a40139 a40140 a40141 a40142 a40143 a40144 a40145 a40146 a40147 a40148 a40149 a40150 a40151 a40152 a40153 a40154 a40155 a40156 a40157 a40158 a40159 a40160 a40161 a40162 a40163 a40164 a40165 a40166 a40167 a40168 a40169 a40170 a40171 a40172 a40173 a40174 a40175 a40176 a40177 a40178 a40179 a40180 a40181 a40182 a40183 a40184 a40185 a40186 a40187 a40188 a40189 a40190 a40191 a40192 a40193 a40194 a40195 a40196 a40197 a40198 a40199 a40200 a40201 a40202 a40203 a40204 a40205 a40206 a40207 a40208 a40209 a40210 a40211 a40212 a40213 a40214 a40215 a40216 a40217 a40218 a40219 a40220 a40221 a40222 a40223 a40224 a40225 a40226 a40227 a40228 a40229 a40230 a40231 a40232 a40233 a40234 a40235 a40236 a40237 a40238 a40239 a40240 a40241 a40242 a40243 a40244 a40245 a40246 a40247 a40248 a40249 a40250 a40251 a40252 a40253 a40254 a40255 a40256 a40257 a40258 a40259 a40260 a40261 a40262 a40263 a40264 a40265 a40266 a40267 a40268 a40269 a40270 a40271 a40272 a40273 a40274 a40275 a40276 a40277 a40278 a40279 a40280 a40281 a40282 a40283 a40284 a40285 a40286 a40287 a40288 a40289 a40290 a40291 a40292 a40293 a40294 a40295 a40296 a40297 a40298 a40299 a40300 a40301 a40302 a40303 a40304 a40305 a40306 a40307 a40308 a40309 a40310 a40311 a40312 a40313 a40314 a40315 a40316 a40317 a40318 a40319 a40320 a40321 a40322 a40323 a40324 a40325 a40326 a40327 a40328 a40329 a40330 a40331 a40332 a40333 a40334 a40335 a40336 a40337 a40338 a40339 a40340 a40341 a40342 a40343 a40344 a40345 a40346 a40347 a40348 a40349 a40350 a40351 a40352 a40353 a40354 a40355 a40356 a40357 a40358 a40359 a40360 a40361 a40362 a40363 a40364 a40365 a40366 a40367 a40368 a40369 a40370 a40371 a40372 a40373 a40374 a40375 a40376 a40377 a40378 a40379 a40380 a40381 a40382 a40383 a40384 a40385 a40386 a40387 a40388 a40389 a40390 a40391 a40392 a40393 a40394 a40395 a40396 a40397 a40398 a40399 a40400 a40401 a40402 a40403 a40404 a40405 a40406 a40407 a40408 a40409 a40410 a40411 a40412 a40413 a40414 a40415 a40416 a40417 a40418 a40419 a40420 a40421 a40422 a40423 a40424 a40425 a40426 a40427 a40428 a40429 a40430 a40431 a40432 a40433 a40434 a40435 a40436 a40437 a40438 a40439 a40440 a40441 a40442 a40443 a40444 a40445 a40446 a40447 a40448 a40449 a40450 a40451 a40452 a40453 a40454 a40455 a40456 a40457 a40458 a40459 a40460 a40461 a40462 a40463 a40464 a40465 a40466 a40467 a40468 a40469 a40470 a40471 a40472 a40473 a40474 a40475 a40476 a40477 a40478 a40479 a40480 a40481 a40482 a40483 a40484 a40485 a40486 a40487 a40488 a40489 a40490 a40491 a40492 a40493 a40494 a40495 a40496 a40497 a40498 a40499 a40500 a40501 a40502 a40503 a40504 a40505 a40506 a40507 a40508 a40509 a40510 a40511 a40512 a40513 a40514 a40515 a40516 a40517 a40518 a40519 a40520 a40521 a40522 a40523 a40524 a40525 a40526 a40527 a40528 a40529 a40530 a40531 a40532 a40533 a40534 a40535 a40536 a40537 a40538 a40539 a40540 a40541 a40542 a40543 a40544 a40545 a40546 a40547 a40548 a40549 a40550 a40551 a40552 a40553 a40554 a40555 a40556 a40557 a40558 a40559 a40560 a40561 a40562 a40563 a40564 a40565 a40566 a40567 a40568 a40569 a40570 a40571 a40572 a40573 a40574 a40575 a40576 a40577 a40578 a40579 a40580 a40581 a40582 a40583 a40584 a40585 a40586 a40587 a40588 a40589 a40590 a40591 a40592 a40593 a40594 a40595 a40596 a40597 a40598 a40599 a40600 a40601 a40602 a40603 a40604 a40605 a40606 a40607 a40608 a40609 a40610 a40611 a40612 a40613 a40614 a40615 a40616 a40617 a40618 a40619 a40620 a40621 a40622 a40623 a40624 a40625 a40626 a40627 a40628 a40629 a40630 a40631 a40632 a40633 a40634 a40635 a40636 a40637 a40638 a40639 a40640 a40641 a40642 a40643 a40644 a40645 a40646 a40647 a40648 a40649 a40650 a40651 a40652 a40653 a40654 a40655 a40656 a40657 a40658 a40659 a40660 a40661 a40662 a40663 a40664 a40665 a40666 a40667 a40668 a40669 a40670 a40671 a40672 a40673 a40674 a40675 a40676 a40677 a40678 a40679 a40680 a40681 a40682 a40683 a40684 a40685 a40686 a40687 a40688 a40689 a40690 a40691 a40692 a40693 a40694 a40695 a40696 a40697 a40698 a40699 a40700 a40701 a40702 a40703 a40704 a40705 a40706 a40707 a40708 a40709 a40710 a40711 a40712 a40713 a40714 a40715 a40716 a40717 a40718 a40719 a40720 a40721 a40722 a40723 a40724 a40725 a40726 a40727 a40728 a40729 a40730 a40731 a40732 a40733 a40734 a40735 a40736 a40737 a40738 a40739 a40740 a40741 a40742 a40743 a40744 a40745 a40746 a40747 a40748 a40749 a40750 a40751 a40752 a40753 a40754 a40755 a40756 a40757 a40758 a40759 a40760 a40761 a40762 a40763 a40764 a40765 a40766 a40767 a40768 a40769 a40770 a40771 a40772 a40773 a40774 a40775 a40776 a40777 a40778 a40779 a40780 a40781 a40782 a40783 a40784 a40785 a40786 a40787 a40788 a40789 a40790 a40791 a40792 a40793 a40794 a40795 a40796 a40797 a40798 a40799 a40800 a40801 a40802 a40803 a40804 a40805 a40806 a40807 a40808 a40809 a40810 a40811 a40812 a40813 a40814 a40815 a40816 a40817 a40818 a40819 a40820 a40821 a40822 a40823 a40824 a40825 a40826 a40827 a40828 a40829 a40830 a40831 a40832 a40833 a40834 a40835 a40836 a40837 a40838 a40839 a40840 a40841 a40842 a40843 a40844 a40845 a40846 a40847 a40848 a40849 a40850 a40851 a40852 a40853 a40854 a40855 a40856 a40857 a40858 a40859 a40860 a40861 a40862 a40863 a40864 a40865 a40866 a40867 a40868 a40869 a40870 a40871 a40872 a40873 a40874 a40875 a40876 a40877 a40878 a40879 a40880 a40881 a40882 a40883 a40884 a40885 a40886 a40887 a40888 a40889 a40890 a40891 a40892 a40893 a40894 a40895 a40896 a40897 a40898 a40899 a40900 a40901 a40902 a40903 a40904 a40905 a40906 a40907 a40908 a40909 a40910 a40911 a40912 a40913 a40914 a40915 a40916 a40917 a40918 a40919 a40920 a40921 a40922 a40923 a40924 a40925 a40926 a40927 a40928 a40929 a40930 a40931 a40932 a40933 a40934 a40935 a40936 a40937 a40938 a40939 a40940 a40941 a40942 a40943 a40944 a40945 a40946 a40947 a40948 a40949 a40950 a40951 a40952 a40953 a40954 a40955 a40956 a40957 a40958 a40959 a40960 a40961 a40962 a40963 a40964 a40965 a40966 a40967 a40968 a40969 a40970 a40971 a40972 a40973 a40974 a40975 a40976 a40977 a40978 a40979 a40980 a40981 a40982 a40983 a40984 a40985 a40986 a40987 a40988 a40989 a40990 a40991 a40992 a40993 a40994 a40995 a40996 a40997 a40998 a40999 a41000 a41001 a41002 a41003 a41004 a41005 a41006 a41007 a41008 a41009 a41010 a41011 a41012 a41013 a41014 a41015 a41016 a41017 a41018 a41019 a41020 a41021 a41022 a41023 a41024 a41025 a41026 a41027 a41028 a41029 a41030 a41031 a41032 a41033 a41034 a41035 a41036 a41037 a41038 a41039 a41040 a41041 a41042 a41043 a41044 a41045 a41046 a41047 a41048 a41049 a41050 a41051 a41052 a41053 a41054 a41055 a41056 a41057 a41058 a41059 a41060 a41061 a41062 a41063 a41064 a41065 a41066 a41067 a41068 a41069 a41070 a41071 a41072 a41073 a41074 a41075 a41076 a41077 a41078 a41079 a41080 a41081 a41082 a41083 a41084 a41085 a41086 a41087 a41088 a41089 a41090 a41091 a41092 a41093 a41094 a41095 a41096 a41097 a41098 a41099 a41100 a41101 a41102 a41103 a41104 a41105 a41106 a41107 a41108 a41109 a41110 a41111 a41112 a41113 a41114 a41115 a41116 a41117 a41118 a41119 a41120 a41121 a41122 a41123 a41124 a41125 a41126 a41127 a41128 a41129 a41130 a41131 a41132 a41133 a41134 a41135 a41136 a41137 a41138 a41139 a41140 a41141 a41142 a41143 a41144 a41145 a41146 a41147 a41148 a41149 a41150 a41151 a41152 a41153 a41154 a41155 a41156 a41157 a41158 a41159 a41160 a41161 a41162 a41163 a41164 a41165 a41166 a41167 a41168 a41169 a41170 a41171 a41172 a41173 a41174 a41175 a41176 a41177 a41178 a41179 a41180 a41181 a41182 a41183 a41184 a41185 a41186 a41187 a41188 a41189 a41190 a41191 a41192 a41193 a41194 a41195 a41196 a41197 a41198 a41199 a41200 a41201 a41202 a41203 a41204 a41205 a41206 a41207 a41208 a41209 a41210 a41211 a41212 a41213 a41214 a41215 a41216 a41217 a41218 a41219 a41220 a41221 a41222 a41223 a41224 a41225 a41226 a41227 a41228 a41229 a41230 a41231 a41232 a41233 a41234 a41235 a41236 a41237 a41238 a41239 a41240 a41241 a41242 a41243 a41244 a41245 a41246 a41247 a41248 a41249 a41250 a41251 a41252 a41253 a41254 a41255 a41256 a41257 a41258 a41259 a41260 a41261 a41262 a41263 a41264 a41265 a41266 a41267 a41268 a41269 a41270 a41271 a41272 a41273 a41274 a41275 a41276 a41277 a41278 a41279 a41280 a41281 a41282 a41283 a41284 a41285 a41286 a41287 a41288 a41289 a41290 a41291 a41292 a41293 a41294 a41295 a41296 a41297 a41298 a41299 a41300 a41301 a41302 a41303 a41304 a41305 a41306 a41307 a41308 a41309 a41310 a41311 a41312 a41313 a41314 a41315 a41316 a41317 a41318 a41319 a41320 a41321 a41322 a41323 a41324 a41325 a41326 a41327 a41328 a41329 a41330 a41331 a41332 a41333 a41334 a41335 a41336 a41337 a41338 a41339 a41340 a41341 a41342 a41343 a41344 a41345 a41346 a41347 a41348 a41349 a41350 a41351 a41352 a41353 a41354 a41355 a41356 a41357 a41358 a41359 a41360 a41361 a41362 a41363 a41364 a41365 a41366 a41367 a41368 a41369 a41370 a41371 a41372 a41373 a41374 a41375 a41376 a41377 a41378 a41379 a41380 a41381 a41382 a41383 a41384 a41385 a41386 a41387 a41388 a41389 a41390 a41391 a41392 a41393 a41394 a41395 a41396 a41397 a41398 a41399 a41400 a41401 a41402 a41403 a41404 a41405 a41406 a41407 a41408 a41409 a41410 a41411 a41412 a41413 a41414 a41415 a41416 a41417 a41418 a41419 a41420 a41421 a41422 a41423 a41424 a41425 a41426 a41427 a41428 a41429 a41430 a41431 a41432 a41433 a41434 a41435 a41436 a41437 a41438 a41439 a41440 a41441 a41442 a41443 a41444 a41445 a41446 a41447 a41448 a41449 a41450 a41451 a41452 a41453 a41454 a41455 a41456 a41457 a41458 a41459 a41460 a41461 a41462 a41463 a41464 a41465 a41466 a41467 a41468 a41469 a41470 a41471 a41472 a41473 a41474 a41475 a41476 a41477 a41478 a41479 a41480 a41481 a41482 a41483 a41484 a41485 a41486 a41487 a41488 a41489 a41490 a41491 a41492 a41493 a41494 a41495 a41496 a41497 a41498 a41499 a41500 a41501 a41502 a41503 a41504 a41505 a41506 a41507 a41508 a41509 a41510 a41511 a41512 a41513 a41514 a41515 a41516 a41517 a41518 a41519 a41520 a41521 a41522 a41523 a41524 a41525 a41526 a41527 a41528 a41529 a41530 a41531 a41532 a41533 a41534 a41535 a41536 a41537 a41538 a41539 a41540 a41541 a41542 a41543 a41544 a41545 a41546 a41547 a41548 a41549 a41550 a41551 a41552 a41553 a41554 a41555 a41556 a41557 a41558 a41559 a41560 a41561 a41562 a41563 a41564 a41565 a41566 a41567 a41568 a41569 a41570 a41571 a41572 a41573 a41574 a41575 a41576 a41577 a41578 a41579 a41580 a41581 a41582 a41583 a41584 a41585 a41586 a41587 a41588 a41589 a41590 a41591 a41592 a41593 a41594 a41595 a41596 a41597 a41598 a41599 a41600 a41601 a41602 a41603 a41604 a41605 a41606 a41607 a41608 a41609 a41610 a41611 a41612 a41613 a41614 a41615 a41616 a41617 a41618 a41619 a41620 a41621 a41622 a41623 a41624 a41625 a41626 a41627 a41628 a41629 a41630 a41631 a41632 a41633 a41634 a41635 a41636 a41637 a41638 a41639 a41640 a41641 a41642 a41643 a41644 a41645 a41646 a41647 a41648 a41649 a41650 a41651 a41652 a41653 a41654 a41655 a41656 a41657 a41658 a41659 a41660 a41661 a41662 a41663 a41664 a41665 a41666 a41667 a41668 a41669 a41670 a41671 a41672 a41673 a41674 a41675 a41676 a41677 a41678 a41679 a41680 a41681 a41682 a41683 a41684 a41685 a41686 a41687 a41688 a41689 a41690 a41691 a41692 a41693 a41694 a41695 a41696 a41697 a41698 a41699 a41700 a41701 a41702 a41703 a41704 a41705 a41706 a41707 a41708 a41709 a41710 a41711 a41712 a41713 a41714 a41715 a41716 a41717 a41718 a41719 a41720 a41721 a41722 a41723 a41724 a41725 a41726 a41727 a41728 a41729 a41730 a41731 a41732 a41733 a41734 a41735 a41736 a41737 a41738 a41739 a41740 a41741 a41742 a41743 a41744 a41745 a41746 a41747 a41748 a41749 a41750 a41751 a41752 a41753 a41754 a41755 a41756 a41757 a41758 a41759 a41760 a41761 a41762 a41763 a41764 a41765 a41766 a41767 a41768 a41769 a41770 a41771 a41772 a41773 a41774 a41775 a41776 a41777 a41778 a41779 a41780 a41781 a41782 a41783 a41784 a41785 a41786 a41787 a41788 a41789 a41790 a41791 a41792 a41793 a41794 a41795 a41796 a41797 a41798 a41799 a41800 a41801 a41802 a41803 a41804 a41805 a41806 a41807 a41808 a41809 a41810 a41811 a41812 a41813 a41814 a41815 a41816 a41817 a41818 a41819 a41820 a41821 a41822 a41823 a41824 a41825 a41826 a41827 a41828 a41829 a41830 a41831 a41832 a41833 a41834 a41835 a41836 a41837 a41838 a41839 a41840 a41841 a41842 a41843 a41844 a41845 a41846 a41847 a41848 a41849 a41850 a41851 a41852 a41853 a41854 a41855 a41856 a41857 a41858 a41859 a41860 a41861 a41862 a41863 a41864 a41865 a41866 a41867 a41868 a41869 a41870 a41871 a41872 a41873 a41874 a41875 a41876 a41877 a41878 a41879 a41880 a41881 a41882 a41883 a41884 a41885 a41886 a41887 a41888 a41889 a41890 a41891 a41892 a41893 a41894 a41895 a41896 a41897 a41898 a41899 a41900 a41901 a41902 a41903 a41904 a41905 a41906 a41907 a41908 a41909 a41910 a41911 a41912 a41913 a41914 a41915 a41916 a41917 a41918 a41919 a41920 a41921 a41922 a41923 a41924 a41925 a41926 a41927 a41928 a41929 a41930 a41931 a41932 a41933 a41934 a41935 a41936 a41937 a41938 a41939 a41940 a41941 a41942 a41943 a41944 a41945 a41946 a41947 a41948 a41949 a41950 a41951 a41952 a41953 a41954 a41955 a41956 a41957 a41958 a41959 a41960 a41961 a41962 a41963 a41964 a41965 a41966 a41967 a41968 a41969 a41970 a41971 a41972 a41973 a41974 a41975 a41976 a41977 a41978 a41979 a41980 a41981 a41982 a41983 a41984 a41985 a41986 a41987 a41988 a41989 a41990 a41991 a41992 a41993 a41994 a41995 a41996 a41997 a41998 a41999 a42000 a42001 a42002 a42003 a42004 a42005 a42006 a42007 a42008 a42009 a42010 a42011 a42012 a42013 a42014 a42015 a42016 a42017 a42018 a42019 a42020 a42021 a42022 a42023 a42024 a42025 a42026 a42027 a42028 a42029 a42030 a42031 a42032 a42033 a42034 a42035 a42036 a42037 a42038 a42039 a42040 a42041 a42042 a42043 a42044 a42045 a42046 a42047 a42048 a42049 a42050 a42051 a42052 a42053 a42054 a42055 a42056 a42057 a42058 a42059 a42060 a42061 a42062 a42063 a42064 a42065 a42066 a42067 a42068 a42069 a42070 a42071 a42072 a42073 a42074 a42075 a42076 a42077 a42078 a42079 a42080 a42081 a42082 a42083 a42084 a42085 a42086 a42087 a42088 a42089 a42090 a42091 a42092 a42093 a42094 a42095 a42096 a42097 a42098 a42099 a42100 a42101 a42102 a42103 a42104 a42105 a42106 a42107 a42108 a42109 a42110 a42111 a42112 a42113 a42114 a42115 a42116 a42117 a42118 a42119 a42120 a42121 a42122 a42123 a42124 a42125 a42126 a42127 a42128 a42129 a42130 a42131 a42132 a42133 a42134 a42135 a42136 a42137 a42138 a42139 a42140 a42141 a42142 a42143 a42144 a42145 a42146 a42147 a42148 a42149 a42150 a42151 a42152 a42153 a42154 a42155 a42156 a42157 a42158 a42159 a42160 a42161 a42162 a42163 a42164 a42165 a42166 a42167 a42168 a42169 a42170 a42171 a42172 a42173 a42174 a42175 a42176 a42177 a42178 a42179 a42180 a42181 a42182 a42183 a42184 a42185 a42186 a42187 a42188 a42189 a42190 a42191 a42192 a42193 a42194 a42195 a42196 a42197 a42198 a42199 a42200 a42201 a42202 a42203 a42204 a42205 a42206 a42207 a42208 a42209 a42210 a42211 a42212 a42213 a42214 a42215 a42216 a42217 a42218 a42219 a42220 a42221 a42222 a42223 a42224 a42225 a42226 a42227 a42228 a42229 a42230 a42231 a42232 a42233 a42234 a42235 a42236 a42237 a42238 a42239 a42240 a42241 a42242 a42243 a42244 a42245 a42246 a42247 a42248 a42249 a42250 a42251 a42252 a42253 a42254 a42255 a42256 a42257 a42258 a42259 a42260 a42261 a42262 a42263 a42264 a42265 a42266 a42267 a42268 a42269 a42270 a42271 a42272 a42273 a42274 a42275 a42276 a42277 a42278 a42279 a42280 a42281 a42282 a42283 a42284 a42285 a42286 a42287 a42288 a42289 a42290 a42291 a42292 a42293 a42294 a42295 a42296 a42297 a42298 a42299 a42300 a42301 a42302 a42303 a42304 a42305 a42306 a42307 a42308 a42309 a42310 a42311 a42312 a42313 a42314 a42315 a42316 a42317 a42318 a42319 a42320 a42321 a42322 a42323 a42324 a42325 a42326 a42327 a42328 a42329 a42330 a42331 a42332 a42333 a42334 a42335 a42336 a42337 a42338 a42339 a42340 a42341 a42342 a42343 a42344 a42345 a42346 a42347 a42348 a42349 a42350 a42351 a42352 a42353 a42354 a42355 a42356 a42357 a42358 a42359 a42360 a42361 a42362 a42363 a42364 a42365 a42366 a42367 a42368 a42369 a42370 a42371 a42372 a42373 a42374 a42375 a42376 a42377 a42378 a42379 a42380 a42381 a42382 a42383 a42384 a42385 a42386 a42387 a42388 a42389 a42390 a42391 a42392 a42393 a42394 a42395 a42396 a42397 a42398 a42399 a42400 a42401 a42402 a42403 a42404 a42405 a42406 a42407 a42408 a42409 a42410 a42411 a42412 a42413 a42414 a42415 a42416 a42417 a42418 a42419 a42420 a42421 a42422 a42423 a42424 a42425 a42426 a42427 a42428 a42429 a42430 a42431 a42432 a42433 a42434 a42435 a42436 a42437 a42438 a42439 a42440 a42441 a42442 a42443 a42444 a42445 a42446 a42447 a42448 a42449 a42450 a42451 a42452 a42453 a42454 a42455 a42456 a42457 a42458 a42459 a42460 a42461 a42462 a42463 a42464 a42465 a42466 a42467 a42468 a42469 a42470 a42471 a42472 a42473 a42474 a42475 a42476 a42477 a42478 a42479 a42480 a42481 a42482 a42483 a42484 a42485 a42486 a42487 a42488 a42489 a42490 a42491 a42492 a42493 a42494 a42495 a42496 a42497 a42498 a42499 a42500 a42501 a42502 a42503 a42504 a42505 a42506 a42507 a42508 a42509 a42510 a42511 a42512 a42513 a42514 a42515 a42516 a42517 a42518 a42519 a42520 a42521 a42522 a42523 a42524 a42525 a42526 a42527 a42528 a42529 a42530 a42531 a42532 a42533 a42534 a42535 a42536 a42537 a42538 a42539 a42540 a42541 a42542 a42543 a42544 a42545 a42546 a42547 a42548 a42549 a42550 a42551 a42552 a42553 a42554 a42555 a42556 a42557 a42558 a42559 a42560 a42561 a42562 a42563 a42564 a42565 a42566 a42567 a42568 a42569 a42570 a42571 a42572 a42573 a42574 a42575 a42576 a42577 a42578 a42579 a42580 a42581 a42582 a42583 a42584 a42585 a42586 a42587 a42588 a42589 a42590 a42591 a42592 a42593 a42594 a42595 a42596 a42597 a42598 a42599 a42600 a42601 a42602 a42603 a42604 a42605 a42606 a42607 a42608 a42609 a42610 a42611 a42612 a42613 a42614 a42615 a42616 a42617 a42618 a42619 a42620 a42621 a42622 a42623 a42624 a42625 a42626 a42627 a42628 a42629 a42630 a42631 a42632 a42633 a42634 a42635 a42636 a42637 a42638 a42639 a42640 a42641 a42642 a42643 a42644 a42645 a42646 a42647 a42648 a42649 a42650 a42651 a42652 a42653 a42654 a42655 a42656 a42657 a42658 a42659 a42660 a42661 a42662 a42663 a42664 a42665 a42666 a42667 a42668 a42669 a42670 a42671 a42672 a42673 a42674 a42675 a42676 a42677 a42678 a42679 a42680 a42681 a42682 a42683 a42684 a42685 a42686 a42687 a42688 a42689 a42690 a42691 a42692 a42693 a42694 a42695 a42696 a42697 a42698 a42699 a42700 a42701 a42702 a42703 a42704 a42705 a42706 a42707 a42708 a42709 a42710 a42711 a42712 a42713 a42714 a42715 a42716 a42717 a42718 a42719 a42720 a42721 a42722 a42723 a42724 a42725 a42726 a42727 a42728 a42729 a42730 a42731 a42732 a42733 a42734 a42735 a42736 a42737 a42738 a42739 a42740 a42741 a42742 a42743 a42744 a42745 a42746 a42747 a42748 a42749 a42750 a42751 a42752 a42753 a42754 a42755 a42756 a42757 a42758 a42759 a42760 a42761 a42762 a42763 a42764 a42765 a42766 a42767 a42768 a42769 a42770 a42771 a42772 a42773 a42774 a42775 a42776 a42777 a42778 a42779 a42780 a42781 a42782 a42783 a42784 a42785 a42786 a42787 a42788 a42789 a42790 a42791 a42792 a42793 a42794 a42795 a42796 a42797 a42798 a42799 a42800 a42801 a42802 a42803 a42804 a42805 a42806 a42807 a42808 a42809 a42810 a42811 a42812 a42813 a42814 a42815 a42816 a42817 a42818 a42819 a42820 a42821 a42822 a42823 a42824 a42825 a42826 a42827 a42828 a42829 a42830 a42831 a42832 a42833 a42834 a42835 a42836 a42837 a42838 a42839 a42840 a42841 a42842 a42843 a42844 a42845 a42846 a42847 a42848 a42849 a42850 a42851 a42852 a42853 a42854 a42855 a42856 a42857 a42858 a42859 a42860 a42861 a42862 a42863 a42864 a42865 a42866 a42867 a42868 a42869 a42870 a42871 a42872 a42873 a42874 a42875 a42876 a42877 a42878 a42879 a42880 a42881 a42882 a42883 a42884 a42885 a42886 a42887 a42888 a42889 a42890 a42891 a42892 a42893 a42894 a42895 a42896 a42897 a42898 a42899 a42900 a42901 a42902 a42903 a42904 a42905 a42906 a42907 a42908 a42909 a42910 a42911 a42912 a42913 a42914 a42915 a42916 a42917 a42918 a42919 a42920 a42921 a42922 a42923 a42924 a42925 a42926 a42927 a42928 a42929 a42930 a42931 a42932 a42933 a42934 a42935 a42936 a42937 a42938 a42939 a42940 a42941 a42942 a42943 a42944 a42945 a42946 a42947 a42948 a42949 a42950 a42951 a42952 a42953 a42954 a42955 a42956 a42957 a42958 a42959 a42960 a42961 a42962 a42963 a42964 a42965 a42966 a42967 a42968 a42969 a42970 a42971 a42972 a42973 a42974 a42975 a42976 a42977 a42978 a42979 a42980 a42981 a42982 a42983 a42984 a42985 a42986 a42987 a42988 a42989 a42990 a42991 a42992 a42993 a42994 a42995 a42996 a42997 a42998 a42999 a43000 a43001 a43002 a43003 a43004 a43005 a43006 a43007 a43008 a43009 a43010 a43011 a43012 a43013 a43014 a43015 a43016 a43017 a43018 a43019 a43020 a43021 a43022 a43023 a43024 a43025 a43026 a43027 a43028 a43029 a43030 a43031 a43032 a43033 a43034 a43035 a43036 a43037 a43038 a43039 a43040 a43041 a43042 a43043 a43044 a43045 a43046 a43047 a43048 a43049 a43050 a43051 a43052 a43053 a43054 a43055 a43056 a43057 a43058 a43059 a43060 a43061 a43062 a43063 a43064 a43065 a43066 a43067 a43068 a43069 a43070 a43071 a43072 a43073 a43074 a43075 a43076 a43077 a43078 a43079 a43080 a43081 a43082 a43083 a43084 a43085 a43086 a43087 a43088 a43089 a43090 a43091 a43092 a43093 a43094 a43095 a43096 a43097 a43098 a43099 a43100 a43101 a43102 a43103 a43104 a43105 a43106 a43107 a43108 a43109 a43110 a43111 a43112 a43113 a43114 a43115 a43116 a43117 a43118 a43119 a43120 a43121 a43122 a43123 a43124 a43125 a43126 a43127 a43128 a43129 a43130 a43131 a43132 a43133 a43134 a43135 a43136 a43137 a43138 a43139 a43140 a43141 a43142 a43143 a43144 a43145 a43146 a43147 a43148 a43149 a43150 a43151 a43152 a43153 a43154 a43155 a43156 a43157 a43158 a43159 a43160 a43161 a43162 a43163 a43164 a43165 a43166 a43167 a43168 a43169 a43170 a43171 a43172 a43173 a43174 a43175 a43176 a43177 a43178 a43179 a43180 a43181 a43182 a43183 a43184 a43185 a43186 a43187 a43188 a43189 a43190 a43191 a43192 a43193 a43194 a43195 a43196 a43197 a43198 a43199 a43200 a43201 a43202 a43203 a43204 a43205 a43206 a43207 a43208 a43209 a43210 a43211 a43212 a43213 a43214 a43215 a43216 a43217 a43218 a43219 a43220 a43221 a43222 a43223 a43224 a43225 a43226 a43227 a43228 a43229 a43230 a43231 a43232 a43233 a43234 a43235 a43236 a43237 a43238 a43239 a43240 a43241 a43242 a43243 a43244 a43245 a43246 a43247 a43248 a43249 a43250 a43251 a43252 a43253 a43254 a43255 a43256 a43257 a43258 a43259 a43260 a43261 a43262 a43263 a43264 a43265 a43266 a43267 a43268 a43269 a43270 a43271 a43272 a43273 a43274 a43275 a43276 a43277 a43278 a43279 a43280 a43281 a43282 a43283 a43284 a43285 a43286 a43287 a43288 a43289 a43290 a43291 a43292 a43293 a43294 a43295 a43296 a43297 a43298 a43299 a43300 a43301 a43302 a43303 a43304 a43305 a43306 a43307 a43308 a43309 a43310 a43311 a43312 a43313 a43314 a43315 a43316 a43317 a43318 a43319 a43320 a43321 a43322 a43323 a43324 a43325 a43326 a43327 a43328 a43329 a43330 a43331 a43332 a43333 a43334 a43335 a43336 a43337 a43338 a43339 a43340 a43341 a43342 a43343 a43344 a43345 a43346 a43347 a43348 a43349 a43350 a43351 a43352 a43353 a43354 a43355 a43356 a43357 a43358 a43359 a43360 a43361 a43362 a43363 a43364 a43365 a43366 a43367 a43368 a43369 a43370 a43371 a43372 a43373 a43374 a43375 a43376 a43377 a43378 a43379 a43380 a43381 a43382 a43383 a43384 a43385 a43386 a43387 a43388 a43389 a43390 a43391 a43392 a43393 a43394 a43395 a43396 a43397 a43398 a43399 a43400 a43401 a43402 a43403 a43404 a43405 a43406 a43407 a43408 a43409 a43410 a43411 a43412 a43413 a43414 a43415 a43416 a43417 a43418 a43419 a43420 a43421 a43422 a43423 a43424 a43425 a43426 a43427 a43428 a43429 a43430 a43431 a43432 a43433 a43434 a43435 a43436 a43437 a43438 a43439 a43440 a43441 a43442 a43443 a43444 a43445 a43446 a43447 a43448 a43449 a43450 a43451 a43452 a43453 a43454 a43455 a43456 a43457 a43458 a43459 a43460 a43461 a43462 a43463 a43464 a43465 a43466 a43467 a43468 a43469 a43470 a43471 a43472 a43473 a43474 a43475 a43476 a43477 a43478 a43479 a43480 a43481 a43482 a43483 a43484 a43485 a43486 a43487 a43488 a43489 a43490 a43491 a43492 a43493 a43494 a43495 a43496 a43497 a43498 a43499 a43500 a43501 a43502 a43503 a43504 a43505 a43506 a43507 a43508 a43509 a43510 a43511 a43512 a43513 a43514 a43515 a43516 a43517 a43518 a43519 a43520 a43521 a43522 a43523 a43524 a43525 a43526 a43527 a43528 a43529 a43530 a43531 a43532 a43533 a43534 a43535 a43536 a43537 a43538 a43539 a43540 a43541 a43542 a43543 a43544 a43545 a43546 a43547 a43548 a43549 a43550 a43551 a43552 a43553 a43554 a43555 a43556 a43557 a43558 a43559 a43560 a43561 a43562 a43563 a43564 a43565 a43566 a43567 a43568 a43569 a43570 a43571 a43572 a43573 a43574 a43575 a43576 a43577 a43578 a43579 a43580 a43581 a43582 a43583 a43584 a43585 a43586 a43587 a43588 a43589 a43590 a43591 a43592 a43593 a43594 a43595 a43596 a43597 a43598 a43599 a43600 a43601 a43602 a43603 a43604 a43605 a43606 a43607 a43608 a43609 a43610 a43611 a43612 a43613 a43614 a43615 a43616 a43617 a43618 a43619 a43620 a43621 a43622 a43623 a43624 a43625 a43626 a43627 a43628 a43629 a43630 a43631 a43632 a43633 a43634 a43635 a43636 a43637 a43638 a43639 a43640 a43641 a43642 a43643 a43644 a43645 a43646 a43647 a43648 a43649 a43650 a43651 a43652 a43653 a43654 a43655 a43656 a43657 a43658 a43659 a43660 a43661 a43662 a43663 a43664 a43665 a43666 a43667 a43668 a43669 a43670 a43671 a43672 a43673 a43674 a43675 a43676 a43677 a43678 a43679 a43680 a43681 a43682 a43683 a43684 a43685 a43686 a43687 a43688 a43689 a43690 a43691 a43692 a43693 a43694 a43695 a43696 a43697 a43698 a43699 a43700 a43701 a43702 a43703 a43704 a43705 a43706 a43707 a43708 a43709 a43710 a43711 a43712 a43713 a43714 a43715 a43716 a43717 a43718 a43719 a43720 a43721 a43722 a43723 a43724 a43725 a43726 a43727 a43728 a43729 a43730 a43731 a43732 a43733 a43734 a43735 a43736 a43737 a43738 a43739 a43740 a43741 a43742 a43743 a43744 a43745 a43746 a43747 a43748 a43749 a43750 a43751 a43752 a43753 a43754 a43755 a43756 a43757 a43758 a43759 a43760 a43761 a43762 a43763 a43764 a43765 a43766 a43767 a43768 a43769 a43770 a43771 a43772 a43773 a43774 a43775 a43776 a43777 a43778 a43779 a43780 a43781 a43782 a43783 a43784 a43785 a43786 a43787 a43788 a43789 a43790 a43791 a43792 a43793 a43794 a43795 a43796 a43797 a43798 a43799 a43800 a43801 a43802 a43803 a43804 a43805 a43806 a43807 a43808 a43809 a43810 a43811 a43812 a43813 a43814 a43815 a43816 a43817 a43818 a43819 a43820 a43821 a43822 a43823 a43824 a43825 a43826 a43827 a43828 a43829 a43830 a43831 a43832 a43833 a43834 a43835 a43836 a43837 a43838 a43839 a43840 a43841 a43842 a43843 a43844 a43845 a43846 a43847 a43848 a43849 a43850 a43851 a43852 a43853 a43854 a43855 a43856 a43857 a43858 a43859 a43860 a43861 a43862 a43863 a43864 a43865 a43866 a43867 a43868 a43869 a43870 a43871 a43872 a43873 a43874 a43875 a43876 a43877 a43878 a43879 a43880 a43881 a43882 a43883 a43884 a43885 a43886 a43887 a43888 a43889 a43890 a43891 a43892 a43893 a43894 a43895 a43896 a43897 a43898 a43899 a43900 a43901 a43902 a43903 a43904 a43905 a43906 a43907 a43908 a43909 a43910 a43911 a43912 a43913 a43914 a43915 a43916 a43917 a43918 a43919 a43920 a43921 a43922 a43923 a43924 a43925 a43926 a43927 a43928 a43929 a43930 a43931 a43932 a43933 a43934 a43935 a43936 a43937 a43938 a43939 a43940 a43941 a43942 a43943 a43944 a43945 a43946 a43947 a43948 a43949 a43950 a43951 a43952 a43953 a43954 a43955 a43956 a43957 a43958 a43959 a43960 a43961 a43962 a43963 a43964 a43965 a43966 a43967 a43968 a43969 a43970 a43971 a43972 a43973 a43974 a43975 a43976 a43977 a43978 a43979 a43980 a43981 a43982 a43983 a43984 a43985 a43986 a43987 a43988 a43989 a43990 a43991 a43992 a43993 a43994 a43995 a43996 a43997 a43998 a43999 a44000 a44001 a44002 a44003 a44004 a44005 a44006 a44007 a44008 a44009 a44010 a44011 a44012 a44013 a44014 a44015 a44016 a44017 a44018 a44019 a44020 a44021 a44022 a44023 a44024 a44025 a44026 a44027 a44028 a44029 a44030 a44031 a44032 a44033 a44034 a44035 a44036 a44037 a44038 a44039 a44040 a44041 a44042 a44043 a44044 a44045 a44046 a44047 a44048 a44049 a44050 a44051 a44052 a44053 a44054 a44055 a44056 a44057 a44058 a44059 a44060 a44061 a44062 a44063 a44064 a44065 a44066 a44067 a44068 a44069 a44070 a44071 a44072 a44073 a44074 a44075 a44076 a44077 a44078 a44079 a44080 a44081 a44082 a44083 a44084 a44085 a44086 a44087 a44088 a44089 a44090 a44091 a44092 a44093 a44094 a44095 a44096 a44097 a44098 a44099 a44100 a44101 a44102 a44103 a44104 a44105 a44106 a44107 a44108 a44109 a44110 a44111 a44112 a44113 a44114 a44115 a44116 a44117 a44118 a44119 a44120 a44121 a44122 a44123 a44124 a44125 a44126 a44127 a44128 a44129 a44130 a44131 a44132 a44133 a44134 a44135 a44136 a44137 a44138 a44139 a44140 a44141 a44142 a44143 a44144 a44145 a44146 a44147 a44148 a44149 a44150 a44151 a44152 a44153 a44154 a44155 a44156 a44157 a44158 a44159 a44160 a44161 a44162 a44163 a44164 a44165 a44166 a44167 a44168 a44169 a44170 a44171 a44172 a44173 a44174 a44175 a44176 a44177 a44178 a44179 a44180 a44181 a44182 a44183 a44184 a44185 a44186 a44187 a44188 a44189 a44190 a44191 a44192 a44193 a44194 a44195 a44196 a44197 a44198 a44199 a44200 a44201 a44202 a44203 a44204 a44205 a44206 a44207 a44208 a44209 a44210 a44211 a44212 a44213 a44214 a44215 a44216 a44217 a44218 a44219 a44220 a44221 a44222 a44223 a44224 a44225 a44226 a44227 a44228 a44229 a44230 a44231 a44232 a44233 a44234 a44235 a44236 a44237 a44238 a44239 a44240 a44241 a44242 a44243 a44244 a44245 a44246 a44247 a44248 a44249 a44250 a44251 a44252 a44253 a44254 a44255 a44256 a44257 a44258 a44259 a44260 a44261 a44262 a44263 a44264 a44265 a44266 a44267 a44268 a44269 a44270 a44271 a44272 a44273 a44274 a44275 a44276 a44277 a44278 a44279 a44280 a44281 a44282 a44283 a44284 a44285 a44286 a44287 a44288 a44289 a44290 a44291 a44292 a44293 a44294 a44295 a44296 a44297 a44298 a44299 a44300 a44301 a44302 a44303 a44304 a44305 a44306 a44307 a44308 a44309 a44310 a44311 a44312 a44313 a44314 a44315 a44316 a44317 a44318 a44319 a44320 a44321 a44322 a44323 a44324 a44325 a44326 a44327 a44328 a44329 a44330 a44331 a44332 a44333 a44334 a44335 a44336 a44337 a44338 a44339 a44340 a44341 a44342 a44343 a44344 a44345 a44346 a44347 a44348 a44349 a44350 a44351 a44352 a44353 a44354 a44355 a44356 a44357 a44358 a44359 a44360 a44361 a44362 a44363 a44364 a44365 a44366 a44367 a44368 a44369 a44370 a44371 a44372 a44373 a44374 a44375 a44376 a44377 a44378 a44379 a44380 a44381 a44382 a44383 a44384 a44385 a44386 a44387 a44388 a44389 a44390 a44391 a44392 a44393 a44394 a44395 a44396 a44397 a44398 a44399 a44400 a44401 a44402 a44403 a44404 a44405 a44406 a44407 a44408 a44409 a44410 a44411 a44412 a44413 a44414 a44415 a44416 a44417 a44418 a44419 a44420 a44421 a44422 a44423 a44424 a44425 a44426 a44427 a44428 a44429 a44430 a44431 a44432 a44433 a44434 a44435 a44436 a44437 a44438 a44439 a44440 a44441 a44442 a44443 a44444 a44445 a44446 a44447 a44448 a44449 a44450 a44451 a44452 a44453 a44454 a44455 a44456 a44457 a44458 a44459 a44460 a44461 a44462 a44463 a44464 a44465 a44466 a44467 a44468 a44469 a44470 a44471 a44472 a44473 a44474 a44475 a44476 a44477 a44478 a44479 a44480 a44481 a44482 a44483 a44484 a44485 a44486 a44487 a44488 a44489 a44490 a44491 a44492 a44493 a44494 a44495 a44496 a44497 a44498 a44499 a44500 a44501 a44502 a44503 a44504 a44505 a44506 a44507 a44508 a44509 a44510 a44511 a44512 a44513 a44514 a44515 a44516 a44517 a44518 a44519 a44520 a44521 a44522 a44523 a44524 a44525 a44526 a44527 a44528 a44529 a44530 a44531 a44532 a44533 a44534 a44535 a44536 a44537 a44538 a44539 a44540 a44541 a44542 a44543 a44544 a44545 a44546 a44547 a44548 a44549 a44550 a44551 a44552 a44553 a44554 a44555 a44556 a44557 a44558 a44559 a44560 a44561 a44562 a44563 a44564 a44565 a44566 a44567 a44568 a44569 a44570 a44571 a44572 a44573 a44574 a44575 a44576 a44577 a44578 a44579 a44580 a44581 a44582 a44583 a44584 a44585 a44586 a44587 a44588 a44589 a44590 a44591 a44592 a44593 a44594 a44595 a44596 a44597 a44598 a44599 a44600 a44601 a44602 a44603 a44604 a44605 a44606 a44607 a44608 a44609 a44610 a44611 a44612 a44613 a44614 a44615 a44616 a44617 a44618 a44619 a44620 a44621 a44622 a44623 a44624 a44625 a44626 a44627 a44628 a44629 a44630 a44631 a44632 a44633 a44634 a44635 a44636 a44637 a44638 a44639 a44640 a44641 a44642 a44643 a44644 a44645 a44646 a44647 a44648 a44649 a44650 a44651 a44652 a44653 a44654 a44655 a44656 a44657 a44658 a44659 a44660 a44661 a44662 a44663 a44664 a44665 a44666 a44667 a44668 a44669 a44670 a44671 a44672 a44673 a44674 a44675 a44676 a44677 a44678 a44679 a44680 a44681 a44682 a44683 a44684 a44685 a44686 a44687 a44688 a44689 a44690 a44691 a44692 a44693 a44694 a44695 a44696 a44697 a44698 a44699 a44700 a44701 a44702 a44703 a44704 a44705 a44706 a44707 a44708 a44709 a44710 a44711 a44712 a44713 a44714 a44715 a44716 a44717 a44718 a44719 a44720 a44721 a44722 a44723 a44724 a44725 a44726 a44727 a44728 a44729 a44730 a44731 a44732 a44733 a44734 a44735 a44736 a44737 a44738 a44739 a44740 a44741 a44742 a44743 a44744 a44745 a44746 a44747 a44748 a44749 a44750 a44751 a44752 a44753 a44754 a44755 a44756 a44757 a44758 a44759 a44760 a44761 a44762 a44763 a44764 a44765 a44766 a44767 a44768 a44769 a44770 a44771 a44772 a44773 a44774 a44775 a44776 a44777 a44778 a44779 a44780 a44781 a44782 a44783 a44784 a44785 a44786 a44787 a44788 a44789 a44790 a44791 a44792 a44793 a44794 a44795 a44796 a44797 a44798 a44799 a44800 a44801 a44802 a44803 a44804 a44805 a44806 a44807 a44808 a44809 a44810 a44811 a44812 a44813 a44814 a44815 a44816 a44817 a44818 a44819 a44820 a44821 a44822 a44823 a44824 a44825 a44826 a44827 a44828 a44829 a44830 a44831 a44832 a44833 a44834 a44835 a44836 a44837 a44838 a44839 a44840 a44841 a44842 a44843 a44844 a44845 a44846 a44847 a44848 a44849 a44850 a44851 a44852 a44853 a44854 a44855 a44856 a44857 a44858 a44859 a44860 a44861 a44862 a44863 a44864 a44865 a44866 a44867 a44868 a44869 a44870 a44871 a44872 a44873 a44874 a44875 a44876 a44877 a44878 a44879 a44880 a44881 a44882 a44883 a44884 a44885 a44886 a44887 a44888 a44889 a44890 a44891 a44892 a44893 a44894 a44895 a44896 a44897 a44898 a44899 a44900 a44901 a44902 a44903 a44904 a44905 a44906 a44907 a44908 a44909 a44910 a44911 a44912 a44913 a44914 a44915 a44916 a44917 a44918 a44919 a44920 a44921 a44922 a44923 a44924 a44925 a44926 a44927 a44928 a44929 a44930 a44931 a44932 a44933 a44934 a44935 a44936 a44937 a44938 a44939 a44940 a44941 a44942 a44943 a44944 a44945 a44946 a44947 a44948 a44949 a44950 a44951 a44952 a44953 a44954 a44955 a44956 a44957 a44958 a44959 a44960 a44961 a44962 a44963 a44964 a44965 a44966 a44967 a44968 a44969 a44970 a44971 a44972 a44973 a44974 a44975 a44976 a44977 a44978 a44979 a44980 a44981 a44982 a44983 a44984 a44985 a44986 a44987 a44988 a44989 a44990 a44991 a44992 a44993 a44994 a44995 a44996 a44997 a44998 a44999 a45000 a45001 a45002 a45003 a45004 a45005 a45006 a45007 a45008 a45009 a45010 a45011 a45012 a45013 a45014 a45015 a45016 a45017 a45018 a45019 a45020 a45021 a45022 a45023 a45024 a45025 a45026 a45027 a45028 a45029 a45030 a45031 a45032 a45033 a45034 a45035 a45036 a45037 a45038 a45039 a45040 a45041 a45042 a45043 a45044 a45045 a45046 a45047 a45048 a45049 a45050 a45051 a45052 a45053 a45054 a45055 a45056 a45057 a45058 a45059 a45060 a45061 a45062 a45063 a45064 a45065 a45066 a45067 a45068 a45069 a45070 a45071 a45072 a45073 a45074 a45075 a45076 a45077 a45078 a45079 a45080 a45081 a45082 a45083 a45084 a45085 a45086 a45087 a45088 a45089 a45090 a45091 a45092 a45093 a45094 a45095 a45096 a45097 a45098 a45099 a45100 a45101 a45102 a45103 a45104 a45105 a45106 a45107 a45108 a45109 a45110 a45111 a45112 a45113 a45114 a45115 a45116 a45117 a45118 a45119 a45120 a45121 a45122 a45123 a45124 a45125 a45126 a45127 a45128 a45129 a45130 a45131 a45132 a45133 a45134 a45135 a45136 a45137 a45138 a45139 a45140 a45141 a45142 a45143 a45144 a45145 a45146 a45147 a45148 a45149 a45150 a45151 a45152 a45153 a45154 a45155 a45156 a45157 a45158 a45159 a45160 a45161 a45162 a45163 a45164 a45165 a45166 a45167 a45168 a45169 a45170 a45171 a45172 a45173 a45174 a45175 a45176 a45177 a45178 a45179 a45180 a45181 a45182 a45183 a45184 a45185 a45186 a45187 a45188 a45189 a45190 a45191 a45192 a45193 a45194 a45195 a45196 a45197 a45198 a45199 a45200 a45201 a45202 a45203 a45204 a45205 a45206 a45207 a45208 a45209 a45210 a45211 a45212 a45213 a45214 a45215 a45216 a45217 a45218 a45219 a45220 a45221 a45222 a45223 a45224 a45225 a45226 a45227 a45228 a45229 a45230 a45231 a45232 a45233 a45234 a45235 a45236 a45237 a45238 a45239 a45240 a45241 a45242 a45243 a45244 a45245 a45246 a45247 a45248 a45249 a45250 a45251 a45252 a45253 a45254 a45255 a45256 a45257 a45258 a45259 a45260 a45261 a45262 a45263 a45264 a45265 a45266 a45267 a45268 a45269 a45270 a45271 a45272 a45273 a45274 a45275 a45276 a45277 a45278 a45279 a45280 a45281 a45282 a45283 a45284 a45285 a45286 a45287 a45288 a45289 a45290 a45291 a45292 a45293 a45294 a45295 a45296 a45297 a45298 a45299 a45300 a45301 a45302 a45303 a45304 a45305 a45306 a45307 a45308 a45309 a45310 a45311 a45312 a45313 a45314 a45315 a45316 a45317 a45318 a45319 a45320 a45321 a45322 a45323 a45324 a45325 a45326 a45327 a45328 a45329 a45330 a45331 a45332 a45333 a45334 a45335 a45336 a45337 a45338 a45339 a45340 a45341 a45342 a45343 a45344 a45345 a45346 a45347 a45348 a45349 a45350 a45351 a45352 a45353 a45354 a45355 a45356 a45357 a45358 a45359 a45360 a45361 a45362 a45363 a45364 a45365 a45366 a45367 a45368 a45369 a45370 a45371 a45372 a45373 a45374 a45375 a45376 a45377 a45378 a45379 a45380 a45381 a45382 a45383 a45384 a45385 a45386 a45387 a45388 a45389 a45390 a45391 a45392 a45393 a45394 a45395 a45396 a45397 a45398 a45399 a45400 a45401 a45402 a45403 a45404 a45405 a45406 a45407 a45408 a45409 a45410 a45411 a45412 a45413 a45414 a45415 a45416 a45417 a45418 a45419 a45420 a45421 a45422 a45423 a45424 a45425 a45426 a45427 a45428 a45429 a45430 a45431 a45432 a45433 a45434 a45435 a45436 a45437 a45438 a45439 a45440 a45441 a45442 a45443 a45444 a45445 a45446 a45447 a45448 a45449 a45450 a45451 a45452 a45453 a45454 a45455 a45456 a45457 a45458 a45459 a45460 a45461 a45462 a45463 a45464 a45465 a45466 a45467 a45468 a45469 a45470 a45471 a45472 a45473 a45474 a45475 a45476 a45477 a45478 a45479 a45480 a45481 a45482 a45483 a45484 a45485 a45486 a45487 a45488 a45489 a45490 a45491 a45492 a45493 a45494 a45495 a45496 a45497 a45498 a45499 a45500 a45501 a45502 a45503 a45504 a45505 a45506 a45507 a45508 a45509 a45510 a45511 a45512 a45513 a45514 a45515 a45516 a45517 a45518 a45519 a45520 a45521 a45522 a45523 a45524 a45525 a45526 a45527 a45528 a45529 a45530 a45531 a45532 a45533 a45534 a45535 a45536 a45537 a45538 a45539 a45540 a45541 a45542 a45543 a45544 a45545 a45546 a45547 a45548 a45549 a45550 a45551 a45552 a45553 a45554 a45555 a45556 a45557 a45558 a45559 a45560 a45561 a45562 a45563 a45564 a45565 a45566 a45567 a45568 a45569 a45570 a45571 a45572 a45573 a45574 a45575 a45576 a45577 a45578 a45579 a45580 a45581 a45582 a45583 a45584 a45585 a45586 a45587 a45588 a45589 a45590 a45591 a45592 a45593 a45594 a45595 a45596 a45597 a45598 a45599 a45600 a45601 a45602 a45603 a45604 a45605 a45606 a45607 a45608 a45609 a45610 a45611 a45612 a45613 a45614 a45615 a45616 a45617 a45618 a45619 a45620 a45621 a45622 a45623 a45624 a45625 a45626 a45627 a45628 a45629 a45630 a45631 a45632 a45633 a45634 a45635 a45636 a45637 a45638 a45639 a45640 a45641 a45642 a45643 a45644 a45645 a45646 a45647 a45648 a45649 a45650 a45651 a45652 a45653 a45654 a45655 a45656 a45657 a45658 a45659 a45660 a45661 a45662 a45663 a45664 a45665 a45666 a45667 a45668 a45669 a45670 a45671 a45672 a45673 a45674 a45675 a45676 a45677 a45678 a45679 a45680 a45681 a45682 a45683 a45684 a45685 a45686 a45687 a45688 a45689 a45690 a45691 a45692 a45693 a45694 a45695 a45696 a45697 a45698 a45699 a45700 a45701 a45702 a45703 a45704 a45705 a45706 a45707 a45708 a45709 a45710 a45711 a45712 a45713 a45714 a45715 a45716 a45717 a45718 a45719 a45720 a45721 a45722 a45723 a45724 a45725 a45726 a45727 a45728 a45729 a45730 a45731 a45732 a45733 a45734 a45735 a45736 a45737 a45738 a45739 a45740 a45741 a45742 a45743 a45744 a45745 a45746 a45747 a45748 a45749 a45750 a45751 a45752 a45753 a45754 a45755 a45756 a45757 a45758 a45759 a45760 a45761 a45762 a45763 a45764 a45765 a45766 a45767 a45768 a45769 a45770 a45771 a45772 a45773 a45774 a45775 a45776 a45777 a45778 a45779 a45780 a45781 a45782 a45783 a45784 a45785 a45786 a45787 a45788 a45789 a45790 a45791 a45792 a45793 a45794 a45795 a45796 a45797 a45798 a45799 a45800 a45801 a45802 a45803 a45804 a45805 a45806 a45807 a45808 a45809 a45810 a45811 a45812 a45813 a45814 a45815 a45816 a45817 a45818 a45819 a45820 a45821 a45822 a45823 a45824 a45825 a45826 a45827 a45828 a45829 a45830 a45831 a45832 a45833 a45834 a45835 a45836 a45837 a45838 a45839 a45840 a45841 a45842 a45843 a45844 a45845 a45846 a45847 a45848 a45849 a45850 a45851 a45852 a45853 a45854 a45855 a45856 a45857 a45858 a45859 a45860 a45861 a45862 a45863 a45864 a45865 a45866 a45867 a45868 a45869 a45870 a45871 a45872 a45873 a45874 a45875 a45876 a45877 a45878 a45879 a45880 a45881 a45882 a45883 a45884 a45885 a45886 a45887 a45888 a45889 a45890 a45891 a45892 a45893 a45894 a45895 a45896 a45897 a45898 a45899 a45900 a45901 a45902 a45903 a45904 a45905 a45906 a45907 a45908 a45909 a45910 a45911 a45912 a45913 a45914 a45915 a45916 a45917 a45918 a45919 a45920 a45921 a45922 a45923 a45924 a45925 a45926 a45927 a45928 a45929 a45930 a45931 a45932 a45933 a45934 a45935 a45936 a45937 a45938 a45939 a45940 a45941 a45942 a45943 a45944 a45945 a45946 a45947 a45948 a45949 a45950 a45951 a45952 a45953 a45954 a45955 a45956 a45957 a45958 a45959 a45960 a45961 a45962 a45963 a45964 a45965 a45966 a45967 a45968 a45969 a45970 a45971 a45972 a45973 a45974 a45975 a45976 a45977 a45978 a45979 a45980 a45981 a45982 a45983 a45984 a45985 a45986 a45987 a45988 a45989 a45990 a45991 a45992 a45993 a45994 a45995 a45996 a45997 a45998 a45999 a46000 a46001 a46002 a46003 a46004 a46005 a46006 a46007 a46008 a46009 a46010 a46011 a46012 a46013 a46014 a46015 a46016 a46017 a46018 a46019 a46020 a46021 a46022 a46023 a46024 a46025 a46026 a46027 a46028 a46029 a46030 a46031 a46032 a46033 a46034 a46035 a46036 a46037 a46038 a46039 a46040 a46041 a46042 a46043 a46044 a46045 a46046 a46047 a46048 a46049 a46050 a46051 a46052 a46053 a46054 a46055 a46056 a46057 a46058 a46059 a46060 a46061 a46062 a46063 a46064 a46065 a46066 a46067 a46068 a46069 a46070 a46071 a46072 a46073 a46074 a46075 a46076 a46077 a46078 a46079 a46080 a46081 a46082 a46083 a46084 a46085 a46086 a46087 a46088 a46089 a46090 a46091 a46092 a46093 a46094 a46095 a46096 a46097 a46098 a46099 a46100 a46101 a46102 a46103 a46104 a46105 a46106 a46107 a46108 a46109 a46110 a46111 a46112 a46113 a46114 a46115 a46116 a46117 a46118 a46119 a46120 a46121 a46122 a46123 a46124 a46125 a46126 a46127 a46128 a46129 a46130 a46131 a46132 a46133 a46134 a46135 a46136 a46137 a46138 a46139 a46140 a46141 a46142 a46143 a46144 a46145 a46146 a46147 a46148 a46149 a46150 a46151 a46152 a46153 a46154 a46155 a46156 a46157 a46158 a46159 a46160 a46161 a46162 a46163 a46164 a46165 a46166 a46167 a46168 a46169 a46170 a46171 a46172 a46173 a46174 a46175 a46176 a46177 a46178 a46179 a46180 a46181 a46182 a46183 a46184 a46185 a46186 a46187 a46188 a46189 a46190 a46191 a46192 a46193 a46194 a46195 a46196 a46197 a46198 a46199 a46200 a46201 a46202 a46203 a46204 a46205 a46206 a46207 a46208 a46209 a46210 a46211 a46212 a46213 a46214 a46215 a46216 a46217 a46218 a46219 a46220 a46221 a46222 a46223 a46224 a46225 a46226 a46227 a46228 a46229 a46230 a46231 a46232 a46233 a46234 a46235 a46236 a46237 a46238 a46239 a46240 a46241 a46242 a46243 a46244 a46245 a46246 a46247 a46248 a46249 a46250 a46251 a46252 a46253 a46254 a46255 a46256 a46257 a46258 a46259 a46260 a46261 a46262 a46263 a46264 a46265 a46266 a46267 a46268 a46269 a46270 a46271 a46272 a46273 a46274 a46275 a46276 a46277 a46278 a46279 a46280 a46281 a46282 a46283 a46284 a46285 a46286 a46287 a46288 a46289 a46290 a46291 a46292 a46293 a46294 a46295 a46296 a46297 a46298 a46299 a46300 a46301 a46302 a46303 a46304 a46305 a46306 a46307 a46308 a46309 a46310 a46311 a46312 a46313 a46314 a46315 a46316 a46317 a46318 a46319 a46320 a46321 a46322 a46323 a46324 a46325 a46326 a46327 a46328 a46329 a46330 a46331 a46332 a46333 a46334 a46335 a46336 a46337 a46338 a46339 a46340 a46341 a46342 a46343 a46344 a46345 a46346 a46347 a46348 a46349 a46350 a46351 a46352 a46353 a46354 a46355 a46356 a46357 a46358 a46359 a46360 a46361 a46362 a46363 a46364 a46365 a46366 a46367 a46368 a46369 a46370 a46371 a46372 a46373 a46374 a46375 a46376 a46377 a46378 a46379 a46380 a46381 a46382 a46383 a46384 a46385 a46386 a46387 a46388 a46389 a46390 a46391 a46392 a46393 a46394 a46395 a46396 a46397 a46398 a46399 a46400 a46401 a46402 a46403 a46404 a46405 a46406 a46407 a46408 a46409 a46410 a46411 a46412 a46413 a46414 a46415 a46416 a46417 a46418 a46419 a46420 a46421 a46422 a46423 a46424 a46425 a46426 a46427 a46428 a46429 a46430 a46431 a46432 a46433 a46434 a46435 a46436 a46437 a46438 a46439 a46440 a46441 a46442 a46443 a46444 a46445 a46446 a46447 a46448 a46449 a46450 a46451 a46452 a46453 a46454 a46455 a46456 a46457 a46458 a46459 a46460 a46461 a46462 a46463 a46464 a46465 a46466 a46467 a46468 a46469 a46470 a46471 a46472 a46473 a46474 a46475 a46476 a46477 a46478 a46479 a46480 a46481 a46482 a46483 a46484 a46485 a46486 a46487 a46488 a46489 a46490 a46491 a46492 a46493 a46494 a46495 a46496 a46497 a46498 a46499 a46500 a46501 a46502 a46503 a46504 a46505 a46506 a46507 a46508 a46509 a46510 a46511 a46512 a46513 a46514 a46515 a46516 a46517 a46518 a46519 a46520 a46521 a46522 a46523 a46524 a46525 a46526 a46527 a46528 a46529 a46530 a46531 a46532 a46533 a46534 a46535 a46536 a46537 a46538 a46539 a46540 a46541 a46542 a46543 a46544 a46545 a46546 a46547 a46548 a46549 a46550 a46551 a46552 a46553 a46554 a46555 a46556 a46557 a46558 a46559 a46560 a46561 a46562 a46563 a46564 a46565 a46566 a46567 a46568 a46569 a46570 a46571 a46572 a46573 a46574 a46575 a46576 a46577 a46578 a46579 a46580 a46581 a46582 a46583 a46584 a46585 a46586 a46587 a46588 a46589 a46590 a46591 a46592 a46593 a46594 a46595 a46596 a46597 a46598 a46599 a46600 a46601 a46602 a46603 a46604 a46605 a46606 a46607 a46608 a46609 a46610 a46611 a46612 a46613 a46614 a46615 a46616 a46617 a46618 a46619 a46620 a46621 a46622 a46623 a46624 a46625 a46626 a46627 a46628 a46629 a46630 a46631 a46632 a46633 a46634 a46635 a46636 a46637 a46638 a46639 a46640 a46641 a46642 a46643 a46644 a46645 a46646 a46647 a46648 a46649 a46650 a46651 a46652 a46653 a46654 a46655 a46656 a46657 a46658 a46659 a46660 a46661 a46662 a46663 a46664 a46665 a46666 a46667 a46668 a46669 a46670 a46671 a46672 a46673 a46674 a46675 a46676 a46677 a46678 a46679 a46680 a46681 a46682 a46683 a46684 a46685 a46686 a46687 a46688 a46689 a46690 a46691 a46692 a46693 a46694 a46695 a46696 a46697 a46698 a46699 a46700 a46701 a46702 a46703 a46704 a46705 a46706 a46707 a46708 a46709 a46710 a46711 a46712 a46713 a46714 a46715 a46716 a46717 a46718 a46719 a46720 a46721 a46722 a46723 a46724 a46725 a46726 a46727 a46728 a46729 a46730 a46731 a46732 a46733 a46734 a46735 a46736 a46737 a46738 a46739 a46740 a46741 a46742 a46743 a46744 a46745 a46746 a46747 a46748 a46749 a46750 a46751 a46752 a46753 a46754 a46755 a46756 a46757 a46758 a46759 a46760 a46761 a46762 a46763 a46764 a46765 a46766 a46767 a46768 a46769 a46770 a46771 a46772 a46773 a46774 a46775 a46776 a46777 a46778 a46779 a46780 a46781 a46782 a46783 a46784 a46785 a46786 a46787 a46788 a46789 a46790 a46791 a46792 a46793 a46794 a46795 a46796 a46797 a46798 a46799 a46800 a46801 a46802 a46803 a46804 a46805 a46806 a46807 a46808 a46809 a46810 a46811 a46812 a46813 a46814 a46815 a46816 a46817 a46818 a46819 a46820 a46821 a46822 a46823 a46824 a46825 a46826 a46827 a46828 a46829 a46830 a46831 a46832 a46833 a46834 a46835 a46836 a46837 a46838 a46839 a46840 a46841 a46842 a46843 a46844 a46845 a46846 a46847 a46848 a46849 a46850 a46851 a46852 a46853 a46854 a46855 a46856 a46857 a46858 a46859 a46860 a46861 a46862 a46863 a46864 a46865 a46866 a46867 a46868 a46869 a46870 a46871 a46872 a46873 a46874 a46875 a46876 a46877 a46878 a46879 a46880 a46881 a46882 a46883 a46884 a46885 a46886 a46887 a46888 a46889 a46890 a46891 a46892 a46893 a46894 a46895 a46896 a46897 a46898 a46899 a46900 a46901 a46902 a46903 a46904 a46905 a46906 a46907 a46908 a46909 a46910 a46911 a46912 a46913 a46914 a46915 a46916 a46917 a46918 a46919 a46920 a46921 a46922 a46923 a46924 a46925 a46926 a46927 a46928 a46929 a46930 a46931 a46932 a46933 a46934 a46935 a46936 a46937 a46938 a46939 a46940 a46941 a46942 a46943 a46944 a46945 a46946 a46947 a46948 a46949 a46950 a46951 a46952 a46953 a46954 a46955 a46956 a46957 a46958 a46959 a46960 a46961 a46962 a46963 a46964 a46965 a46966 a46967 a46968 a46969 a46970 a46971 a46972 a46973 a46974 a46975 a46976 a46977 a46978 a46979 a46980 a46981 a46982 a46983 a46984 a46985 a46986 a46987 a46988 a46989 a46990 a46991 a46992 a46993 a46994 a46995 a46996 a46997 a46998 a46999 a47000 a47001 a47002 a47003 a47004 a47005 a47006 a47007 a47008 a47009 a47010 a47011 a47012 a47013 a47014 a47015 a47016 a47017 a47018 a47019 a47020 a47021 a47022 a47023 a47024 a47025 a47026 a47027 a47028 a47029 a47030 a47031 a47032 a47033 a47034 a47035 a47036 a47037 a47038 a47039 a47040 a47041 a47042 a47043 a47044 a47045 a47046 a47047 a47048 a47049 a47050 a47051 a47052 a47053 a47054 a47055 a47056 a47057 a47058 a47059 a47060 a47061 a47062 a47063 a47064 a47065 a47066 a47067 a47068 a47069 a47070 a47071 a47072 a47073 a47074 a47075 a47076 a47077 a47078 a47079 a47080 a47081 a47082 a47083 a47084 a47085 a47086 a47087 a47088 a47089 a47090 a47091 a47092 a47093 a47094 a47095 a47096 a47097 a47098 a47099 a47100 a47101 a47102 a47103 a47104 a47105 a47106 a47107 a47108 a47109 a47110 a47111 a47112 a47113 a47114 a47115 a47116 a47117 a47118 a47119 a47120 a47121 a47122 a47123 a47124 a47125 a47126 a47127 a47128 a47129 a47130 a47131 a47132 a47133 a47134 a47135 a47136 a47137 a47138 a47139 a47140 a47141 a47142 a47143 a47144 a47145 a47146 a47147 a47148 a47149 a47150 a47151 a47152 a47153 a47154 a47155 a47156 a47157 a47158 a47159 a47160 a47161 a47162 a47163 a47164 a47165 a47166 a47167 a47168 a47169 a47170 a47171 a47172 a47173 a47174 a47175 a47176 a47177 a47178 a47179 a47180 a47181 a47182 a47183 a47184 a47185 a47186 a47187 a47188 a47189 a47190 a47191 a47192 a47193 a47194 a47195 a47196 a47197 a47198 a47199 a47200 a47201 a47202 a47203 a47204 a47205 a47206 a47207 a47208 a47209 a47210 a47211 a47212 a47213 a47214 a47215 a47216 a47217 a47218 a47219 a47220 a47221 a47222 a47223 a47224 a47225 a47226 a47227 a47228 a47229 a47230 a47231 a47232 a47233 a47234 a47235 a47236 a47237 a47238 a47239 a47240 a47241 a47242 a47243 a47244 a47245 a47246 a47247 a47248 a47249 a47250 a47251 a47252 a47253 a47254 a47255 a47256 a47257 a47258 a47259 a47260 a47261 a47262 a47263 a47264 a47265 a47266 a47267 a47268 a47269 a47270 a47271 a47272 a47273 a47274 a47275 a47276 a47277 a47278 a47279 a47280 a47281 a47282 a47283 a47284 a47285 a47286 a47287 a47288 a47289 a47290 a47291 a47292 a47293 a47294 a47295 a47296 a47297 a47298 a47299 a47300 a47301 a47302 a47303 a47304 a47305 a47306 a47307 a47308 a47309 a47310 a47311 a47312 a47313 a47314 a47315 a47316 a47317 a47318 a47319 a47320 a47321 a47322 a47323 a47324 a47325 a47326 a47327 a47328 a47329 a47330 a47331 a47332 a47333 a47334 a47335 a47336 a47337 a47338 a47339 a47340 a47341 a47342 a47343 a47344 a47345 a47346 a47347 a47348 a47349 a47350 a47351 a47352 a47353 a47354 a47355 a47356 a47357 a47358 a47359 a47360 a47361 a47362 a47363 a47364 a47365 a47366 a47367 a47368 a47369 a47370 a47371 a47372 a47373 a47374 a47375 a47376 a47377 a47378 a47379 a47380 a47381 a47382 a47383 a47384 a47385 a47386 a47387 a47388 a47389 a47390 a47391 a47392 a47393 a47394 a47395 a47396 a47397 a47398 a47399 a47400 a47401 a47402 a47403 a47404 a47405 a47406 a47407 a47408 a47409 a47410 a47411 a47412 a47413 a47414 a47415 a47416 a47417 a47418 a47419 a47420 a47421 a47422 a47423 a47424 a47425 a47426 a47427 a47428 a47429 a47430 a47431 a47432 a47433 a47434 a47435 a47436 a47437 a47438 a47439 a47440 a47441 a47442 a47443 a47444 a47445 a47446 a47447 a47448 a47449 a47450 a47451 a47452 a47453 a47454 a47455 a47456 a47457 a47458 a47459 a47460 a47461 a47462 a47463 a47464 a47465 a47466 a47467 a47468 a47469 a47470 a47471 a47472 a47473 a47474 a47475 a47476 a47477 a47478 a47479 a47480 a47481 a47482 a47483 a47484 a47485 a47486 a47487 a47488 a47489 a47490 a47491 a47492 a47493 a47494 a47495 a47496 a47497 a47498 a47499 a47500 a47501 a47502 a47503 a47504 a47505 a47506 a47507 a47508 a47509 a47510 a47511 a47512 a47513 a47514 a47515 a47516 a47517 a47518 a47519 a47520 a47521 a47522 a47523 a47524 a47525 a47526 a47527 a47528 a47529 a47530 a47531 a47532 a47533 a47534 a47535 a47536 a47537 a47538 a47539 a47540 a47541 a47542 a47543 a47544 a47545 a47546 a47547 a47548 a47549 a47550 a47551 a47552 a47553 a47554 a47555 a47556 a47557 a47558 a47559 a47560 a47561 a47562 a47563 a47564 a47565 a47566 a47567 a47568 a47569 a47570 a47571 a47572 a47573 a47574 a47575 a47576 a47577 a47578 a47579 a47580 a47581 a47582 a47583 a47584 a47585 a47586 a47587 a47588 a47589 a47590 a47591 a47592 a47593 a47594 a47595 a47596 a47597 a47598 a47599 a47600 a47601 a47602 a47603 a47604 a47605 a47606 a47607 a47608 a47609 a47610 a47611 a47612 a47613 a47614 a47615 a47616 a47617 a47618 a47619 a47620 a47621 a47622 a47623 a47624 a47625 a47626 a47627 a47628 a47629 a47630 a47631 a47632 a47633 a47634 a47635 a47636 a47637 a47638 a47639 a47640 a47641 a47642 a47643 a47644 a47645 a47646 a47647 a47648 a47649 a47650 a47651 a47652 a47653 a47654 a47655 a47656 a47657 a47658 a47659 a47660 a47661 a47662 a47663 a47664 a47665 a47666 a47667 a47668 a47669 a47670 a47671 a47672 a47673 a47674 a47675 a47676 a47677 a47678 a47679 a47680 a47681 a47682 a47683 a47684 a47685 a47686 a47687 a47688 a47689 a47690 a47691 a47692 a47693 a47694 a47695 a47696 a47697 a47698 a47699 a47700 a47701 a47702 a47703 a47704 a47705 a47706 a47707 a47708 a47709 a47710 a47711 a47712 a47713 a47714 a47715 a47716 a47717 a47718 a47719 a47720 a47721 a47722 a47723 a47724 a47725 a47726 a47727 a47728 a47729 a47730 a47731 a47732 a47733 a47734 a47735 a47736 a47737 a47738 a47739 a47740 a47741 a47742 a47743 a47744 a47745 a47746 a47747 a47748 a47749 a47750 a47751 a47752 a47753 a47754 a47755 a47756 a47757 a47758 a47759 a47760 a47761 a47762 a47763 a47764 a47765 a47766 a47767 a47768 a47769 a47770 a47771 a47772 a47773 a47774 a47775 a47776 a47777 a47778 a47779 a47780 a47781 a47782 a47783 a47784 a47785 a47786 a47787 a47788 a47789 a47790 a47791 a47792 a47793 a47794 a47795 a47796 a47797 a47798 a47799 a47800 a47801 a47802 a47803 a47804 a47805 a47806 a47807 a47808 a47809 a47810 a47811 a47812 a47813 a47814 a47815 a47816 a47817 a47818 a47819 a47820 a47821 a47822 a47823 a47824 a47825 a47826 a47827 a47828 a47829 a47830 a47831 a47832 a47833 a47834 a47835 a47836 a47837 a47838 a47839 a47840 a47841 a47842 a47843 a47844 a47845 a47846 a47847 a47848 a47849 a47850 a47851 a47852 a47853 a47854 a47855 a47856 a47857 a47858 a47859 a47860 a47861 a47862 a47863 a47864 a47865 a47866 a47867 a47868 a47869 a47870 a47871 a47872 a47873 a47874 a47875 a47876 a47877 a47878 a47879 a47880 a47881 a47882 a47883 a47884 a47885 a47886 a47887 a47888 a47889 a47890 a47891 a47892 a47893 a47894 a47895 a47896 a47897 a47898 a47899 a47900 a47901 a47902 a47903 a47904 a47905 a47906 a47907 a47908 a47909 a47910 a47911 a47912 a47913 a47914 a47915 a47916 a47917 a47918 a47919 a47920 a47921 a47922 a47923 a47924 a47925 a47926 a47927 a47928 a47929 a47930 a47931 a47932 a47933 a47934 a47935 a47936 a47937 a47938 a47939 a47940 a47941 a47942 a47943 a47944 a47945 a47946 a47947 a47948 a47949 a47950 a47951 a47952 a47953 a47954 a47955 a47956 a47957 a47958 a47959 a47960 a47961 a47962 a47963 a47964 a47965 a47966 a47967 a47968 a47969 a47970 a47971 a47972 a47973 a47974 a47975 a47976 a47977 a47978 a47979 a47980 a47981 a47982 a47983 a47984 a47985 a47986 a47987 a47988 a47989 a47990 a47991 a47992 a47993 a47994 a47995 a47996 a47997 a47998 a47999 a48000 a48001 a48002 a48003 a48004 a48005 a48006 a48007 a48008 a48009 a48010 a48011 a48012 a48013 a48014 a48015 a48016 a48017 a48018 a48019 a48020 a48021 a48022 a48023 a48024 a48025 a48026 a48027 a48028 a48029 a48030 a48031 a48032 a48033 a48034 a48035 a48036 a48037 a48038 a48039 a48040 a48041 a48042 a48043 a48044 a48045 a48046 a48047 a48048 a48049 a48050 a48051 a48052 a48053 a48054 a48055 a48056 a48057 a48058 a48059 a48060 a48061 a48062 a48063 a48064 a48065 a48066 a48067 a48068 a48069 a48070 a48071 a48072 a48073 a48074 a48075 a48076 a48077 a48078 a48079 a48080 a48081 a48082 a48083 a48084 a48085 a48086 a48087 a48088 a48089 a48090 a48091 a48092 a48093 a48094 a48095 a48096 a48097 a48098 a48099 a48100 a48101 a48102 a48103 a48104 a48105 a48106 a48107 a48108 a48109 a48110 a48111 a48112 a48113 a48114 a48115 a48116 a48117 a48118 a48119 a48120 a48121 a48122 a48123 a48124 a48125 a48126 a48127 a48128 a48129 a48130 a48131 a48132 a48133 a48134 a48135 a48136 a48137 a48138 a48139 a48140 a48141 a48142 a48143 a48144 a48145 a48146 a48147 a48148 a48149 a48150 a48151 a48152 a48153 a48154 a48155 a48156 a48157 a48158 a48159 a48160 a48161 a48162 a48163 a48164 a48165 a48166 a48167 a48168 a48169 a48170 a48171 a48172 a48173 a48174 a48175 a48176 a48177 a48178 a48179 a48180 a48181 a48182 a48183 a48184 a48185 a48186 a48187 a48188 a48189 a48190 a48191 a48192 a48193 a48194 a48195 a48196 a48197 a48198 a48199 a48200 a48201 a48202 a48203 a48204 a48205 a48206 a48207 a48208 a48209 a48210 a48211 a48212 a48213 a48214 a48215 a48216 a48217 a48218 a48219 a48220 a48221 a48222 a48223 a48224 a48225 a48226 a48227 a48228 a48229 a48230 a48231 a48232 a48233 a48234 a48235 a48236 a48237 a48238 a48239 a48240 a48241 a48242 a48243 a48244 a48245 a48246 a48247 a48248 a48249 a48250 a48251 a48252 a48253 a48254 a48255 a48256 a48257 a48258 a48259 a48260 a48261 a48262 a48263 a48264 a48265 a48266 a48267 a48268 a48269 a48270 a48271 a48272 a48273 a48274 a48275 a48276 a48277 a48278 a48279 a48280 a48281 a48282 a48283 a48284 a48285 a48286 a48287 a48288 a48289 a48290 a48291 a48292 a48293 a48294 a48295 a48296 a48297 a48298 a48299 a48300 a48301 a48302 a48303 a48304 a48305 a48306 a48307 a48308 a48309 a48310 a48311 a48312 a48313 a48314 a48315 a48316 a48317 a48318 a48319 a48320 a48321 a48322 a48323 a48324 a48325 a48326 a48327 a48328 a48329 a48330 a48331 a48332 a48333 a48334 a48335 a48336 a48337 a48338 a48339 a48340 a48341 a48342 a48343 a48344 a48345 a48346 a48347 a48348 a48349 a48350 a48351 a48352 a48353 a48354 a48355 a48356 a48357 a48358 a48359 a48360 a48361 a48362 a48363 a48364 a48365 a48366 a48367 a48368 a48369 a48370 a48371 a48372 a48373 a48374 a48375 a48376 a48377 a48378 a48379 a48380 a48381 a48382 a48383 a48384 a48385 a48386 a48387 a48388 a48389 a48390 a48391 a48392 a48393 a48394 a48395 a48396 a48397 a48398 a48399 a48400 a48401 a48402 a48403 a48404 a48405 a48406 a48407 a48408 a48409 a48410 a48411 a48412 a48413 a48414 a48415 a48416 a48417 a48418 a48419 a48420 a48421 a48422 a48423 a48424 a48425 a48426 a48427 a48428 a48429 a48430 a48431 a48432 a48433 a48434 a48435 a48436 a48437 a48438 a48439 a48440 a48441 a48442 a48443 a48444 a48445 a48446 a48447 a48448 a48449 a48450 a48451 a48452 a48453 a48454 a48455 a48456 a48457 a48458 a48459 a48460 a48461 a48462 a48463 a48464 a48465 a48466 a48467 a48468 a48469 a48470 a48471 a48472 a48473 a48474 a48475 a48476 a48477 a48478 a48479 a48480 a48481 a48482 a48483 a48484 a48485 a48486 a48487 a48488 a48489 a48490 a48491 a48492 a48493 a48494 a48495 a48496 a48497 a48498 a48499 a48500 a48501 a48502 a48503 a48504 a48505 a48506 a48507 a48508 a48509 a48510 a48511 a48512 a48513 a48514 a48515 a48516 a48517 a48518 a48519 a48520 a48521 a48522 a48523 a48524 a48525 a48526 a48527 a48528 a48529 a48530 a48531 a48532 a48533 a48534 a48535 a48536 a48537 a48538 a48539 a48540 a48541 a48542 a48543 a48544 a48545 a48546 a48547 a48548 a48549 a48550 a48551 a48552 a48553 a48554 a48555 a48556 a48557 a48558 a48559 a48560 a48561 a48562 a48563 a48564 a48565 a48566 a48567 a48568 a48569 a48570 a48571 a48572 a48573 a48574 a48575 a48576 a48577 a48578 a48579 a48580 a48581 a48582 a48583 a48584 a48585 a48586 a48587 a48588 a48589 a48590 a48591 a48592 a48593 a48594 a48595 a48596 a48597 a48598 a48599 a48600 a48601 a48602 a48603 a48604 a48605 a48606 a48607 a48608 a48609 a48610 a48611 a48612 a48613 a48614 a48615 a48616 a48617 a48618 a48619 a48620 a48621 a48622 a48623 a48624 a48625 a48626 a48627 a48628 a48629 a48630 a48631 a48632 a48633 a48634 a48635 a48636 a48637 a48638 a48639 a48640 a48641 a48642 a48643 a48644 a48645 a48646 a48647 a48648 a48649 a48650 a48651 a48652 a48653 a48654 a48655 a48656 a48657 a48658 a48659 a48660 a48661 a48662 a48663 a48664 a48665 a48666 a48667 a48668 a48669 a48670 a48671 a48672 a48673 a48674 a48675 a48676 a48677 a48678 a48679 a48680 a48681 a48682 a48683 a48684 a48685 a48686 a48687 a48688 a48689 a48690 a48691 a48692 a48693 a48694 a48695 a48696 a48697 a48698 a48699 a48700 a48701 a48702 a48703 a48704 a48705 a48706 a48707 a48708 a48709 a48710 a48711 a48712 a48713 a48714 a48715 a48716 a48717 a48718 a48719 a48720 a48721 a48722 a48723 a48724 a48725 a48726 a48727 a48728 a48729 a48730 a48731 a48732 a48733 a48734 a48735 a48736 a48737 a48738 a48739 a48740 a48741 a48742 a48743 a48744 a48745 a48746 a48747 a48748 a48749 a48750 a48751 a48752 a48753 a48754 a48755 a48756 a48757 a48758 a48759 a48760 a48761 a48762 a48763 a48764 a48765 a48766 a48767 a48768 a48769 a48770 a48771 a48772 a48773 a48774 a48775 a48776 a48777 a48778 a48779 a48780 a48781 a48782 a48783 a48784 a48785 a48786 a48787 a48788 a48789 a48790 a48791 a48792 a48793 a48794 a48795 a48796 a48797 a48798 a48799 a48800 a48801 a48802 a48803 a48804 a48805 a48806 a48807 a48808 a48809 a48810 a48811 a48812 a48813 a48814 a48815 a48816 a48817 a48818 a48819 a48820 a48821 a48822 a48823 a48824 a48825 a48826 a48827 a48828 a48829 a48830 a48831 a48832 a48833 a48834 a48835 a48836 a48837 a48838 a48839 a48840 a48841 a48842 a48843 a48844 a48845 a48846 a48847 a48848 a48849 a48850 a48851 a48852 a48853 a48854 a48855 a48856 a48857 a48858 a48859 a48860 a48861 a48862 a48863 a48864 a48865 a48866 a48867 a48868 a48869 a48870 a48871 a48872 a48873 a48874 a48875 a48876 a48877 a48878 a48879 a48880 a48881 a48882 a48883 a48884 a48885 a48886 a48887 a48888 a48889 a48890 a48891 a48892 a48893 a48894 a48895 a48896 a48897 a48898 a48899 a48900 a48901 a48902 a48903 a48904 a48905 a48906 a48907 a48908 a48909 a48910 a48911 a48912 a48913 a48914 a48915 a48916 a48917 a48918 a48919 a48920 a48921 a48922 a48923 a48924 a48925 a48926 a48927 a48928 a48929 a48930 a48931 a48932 a48933 a48934 a48935 a48936 a48937 a48938 a48939 a48940 a48941 a48942 a48943 a48944 a48945 a48946 a48947 a48948 a48949 a48950 a48951 a48952 a48953 a48954 a48955 a48956 a48957 a48958 a48959 a48960 a48961 a48962 a48963 a48964 a48965 a48966 a48967 a48968 a48969 a48970 a48971 a48972 a48973 a48974 a48975 a48976 a48977 a48978 a48979 a48980 a48981 a48982 a48983 a48984 a48985 a48986 a48987 a48988 a48989 a48990 a48991 a48992 a48993 a48994 a48995 a48996 a48997 a48998 a48999 a49000 a49001 a49002 a49003 a49004 a49005 a49006 a49007 a49008 a49009 a49010 a49011 a49012 a49013 a49014 a49015 a49016 a49017 a49018 a49019 a49020 a49021 a49022 a49023 a49024 a49025 a49026 a49027 a49028 a49029 a49030 a49031 a49032 a49033 a49034 a49035 a49036 a49037 a49038 a49039 a49040 a49041 a49042 a49043 a49044 a49045 a49046 a49047 a49048 a49049 a49050 a49051 a49052 a49053 a49054 a49055 a49056 a49057 a49058 a49059 a49060 a49061 a49062 a49063 a49064 a49065 a49066 a49067 a49068 a49069 a49070 a49071 a49072 a49073 a49074 a49075 a49076 a49077 a49078 a49079 a49080 a49081 a49082 a49083 a49084 a49085 a49086 a49087 a49088 a49089 a49090 a49091 a49092 a49093 a49094 a49095 a49096 a49097 a49098 a49099 a49100 a49101 a49102 a49103 a49104 a49105 a49106 a49107 a49108 a49109 a49110 a49111 a49112 a49113 a49114 a49115 a49116 a49117 a49118 a49119 a49120 a49121 a49122 a49123 a49124 a49125 a49126 a49127 a49128 a49129 a49130 a49131 a49132 a49133 a49134 a49135 a49136 a49137 a49138 a49139 a49140 a49141 a49142 a49143 a49144 a49145 a49146 a49147 a49148 a49149 a49150 a49151 a49152 a49153 a49154 a49155 a49156 a49157 a49158 a49159 a49160 a49161 a49162 a49163 a49164 a49165 a49166 a49167 a49168 a49169 a49170 a49171 a49172 a49173 a49174 a49175 a49176 a49177 a49178 a49179 a49180 a49181 a49182 a49183 a49184 a49185 a49186 a49187 a49188 a49189 a49190 a49191 a49192 a49193 a49194 a49195 a49196 a49197 a49198 a49199 a49200 a49201 a49202 a49203 a49204 a49205 a49206 a49207 a49208 a49209 a49210 a49211 a49212 a49213 a49214 a49215 a49216 a49217 a49218 a49219 a49220 a49221 a49222 a49223 a49224 a49225 a49226 a49227 a49228 a49229 a49230 a49231 a49232 a49233 a49234 a49235 a49236 a49237 a49238 a49239 a49240 a49241 a49242 a49243 a49244 a49245 a49246 a49247 a49248 a49249 a49250 a49251 a49252 a49253 a49254 a49255 a49256 a49257 a49258 a49259 a49260 a49261 a49262 a49263 a49264 a49265 a49266 a49267 a49268 a49269 a49270 a49271 a49272 a49273 a49274 a49275 a49276 a49277 a49278 a49279 a49280 a49281 a49282 a49283 a49284 a49285 a49286 a49287 a49288 a49289 a49290 a49291 a49292 a49293 a49294 a49295 a49296 a49297 a49298 a49299 a49300 a49301 a49302 a49303 a49304 a49305 a49306 a49307 a49308 a49309 a49310 a49311 a49312 a49313 a49314 a49315 a49316 a49317 a49318 a49319 a49320 a49321 a49322 a49323 a49324 a49325 a49326 a49327 a49328 a49329 a49330 a49331 a49332 a49333 a49334 a49335 a49336 a49337 a49338 a49339 a49340 a49341 a49342 a49343 a49344 a49345 a49346 a49347 a49348 a49349 a49350 a49351 a49352 a49353 a49354 a49355 a49356 a49357 a49358 a49359 a49360 a49361 a49362 a49363 a49364 a49365 a49366 a49367 a49368 a49369 a49370 a49371 a49372 a49373 a49374 a49375 a49376 a49377 a49378 a49379 a49380 a49381 a49382 a49383 a49384 a49385 a49386 a49387 a49388 a49389 a49390 a49391 a49392 a49393 a49394 a49395 a49396 a49397 a49398 a49399 a49400 a49401 a49402 a49403 a49404 a49405 a49406 a49407 a49408 a49409 a49410 a49411 a49412 a49413 a49414 a49415 a49416 a49417 a49418 a49419 a49420 a49421 a49422 a49423 a49424 a49425 a49426 a49427 a49428 a49429 a49430 a49431 a49432 a49433 a49434 a49435 a49436 a49437 a49438 a49439 a49440 a49441 a49442 a49443 a49444 a49445 a49446 a49447 a49448 a49449 a49450 a49451 a49452 a49453 a49454 a49455 a49456 a49457 a49458 a49459 a49460 a49461 a49462 a49463 a49464 a49465 a49466 a49467 a49468 a49469 a49470 a49471 a49472 a49473 a49474 a49475 a49476 a49477 a49478 a49479 a49480 a49481 a49482 a49483 a49484 a49485 a49486 a49487 a49488 a49489 a49490 a49491 a49492 a49493 a49494 a49495 a49496 a49497 a49498 a49499 a49500 a49501 a49502 a49503 a49504 a49505 a49506 a49507 a49508 a49509 a49510 a49511 a49512 a49513 a49514 a49515 a49516 a49517 a49518 a49519 a49520 a49521 a49522 a49523 a49524 a49525 a49526 a49527 a49528 a49529 a49530 a49531 a49532 a49533 a49534 a49535 a49536 a49537 a49538 a49539 a49540 a49541 a49542 a49543 a49544 a49545 a49546 a49547 a49548 a49549 a49550 a49551 a49552 a49553 a49554 a49555 a49556 a49557 a49558 a49559 a49560 a49561 a49562 a49563 a49564 a49565 a49566 a49567 a49568 a49569 a49570 a49571 a49572 a49573 a49574 a49575 a49576 a49577 a49578 a49579 a49580 a49581 a49582 a49583 a49584 a49585 a49586 a49587 a49588 a49589 a49590 a49591 a49592 a49593 a49594 a49595 a49596 a49597 a49598 a49599 a49600 a49601 a49602 a49603 a49604 a49605 a49606 a49607 a49608 a49609 a49610 a49611 a49612 a49613 a49614 a49615 a49616 a49617 a49618 a49619 a49620 a49621 a49622 a49623 a49624 a49625 a49626 a49627 a49628 a49629 a49630 a49631 a49632 a49633 a49634 a49635 a49636 a49637 a49638 a49639 a49640 a49641 a49642 a49643 a49644 a49645 a49646 a49647 a49648 a49649 a49650 a49651 a49652 a49653 a49654 a49655 a49656 a49657 a49658 a49659 a49660 a49661 a49662 a49663 a49664 a49665 a49666 a49667 a49668 a49669 a49670 a49671 a49672 a49673 a49674 a49675 a49676 a49677 a49678 a49679 a49680 a49681 a49682 a49683 a49684 a49685 a49686 a49687 a49688 a49689 a49690 a49691 a49692 a49693 a49694 a49695 a49696 a49697 a49698 a49699 a49700 a49701 a49702 a49703 a49704 a49705 a49706 a49707 a49708 a49709 a49710 a49711 a49712 a49713 a49714 a49715 a49716 a49717 a49718 a49719 a49720 a49721 a49722 a49723 a49724 a49725 a49726 a49727 a49728 a49729 a49730 a49731 a49732 a49733 a49734 a49735 a49736 a49737 a49738 a49739 a49740 a49741 a49742 a49743 a49744 a49745 a49746 a49747 a49748 a49749 a49750 a49751 a49752 a49753 a49754 a49755 a49756 a49757 a49758 a49759 a49760 a49761 a49762 a49763 a49764 a49765 a49766 a49767 a49768 a49769 a49770 a49771 a49772 a49773 a49774 a49775 a49776 a49777 a49778 a49779 a49780 a49781 a49782 a49783 a49784 a49785 a49786 a49787 a49788 a49789 a49790 a49791 a49792 a49793 a49794 a49795 a49796 a49797 a49798 a49799 a49800 a49801 a49802 a49803 a49804 a49805 a49806 a49807 a49808 a49809 a49810 a49811 a49812 a49813 a49814 a49815 a49816 a49817 a49818 a49819 a49820 a49821 a49822 a49823 a49824 a49825 a49826 a49827 a49828 a49829 a49830 a49831 a49832 a49833 a49834 a49835 a49836 a49837 a49838 a49839 a49840 a49841 a49842 a49843 a49844 a49845 a49846 a49847 a49848 a49849 a49850 a49851 a49852 a49853 a49854 a49855 a49856 a49857 a49858 a49859 a49860 a49861 a49862 a49863 a49864 a49865 a49866 a49867 a49868 a49869 a49870 a49871 a49872 a49873 a49874 a49875 a49876 a49877 a49878 a49879 a49880 a49881 a49882 a49883 a49884 a49885 a49886 a49887 a49888 a49889 a49890 a49891 a49892 a49893 a49894 a49895 a49896 a49897 a49898 a49899 a49900 a49901 a49902 a49903 a49904 a49905 a49906 a49907 a49908 a49909 a49910 a49911 a49912 a49913 a49914 a49915 a49916 a49917 a49918 a49919 a49920 a49921 a49922 a49923 a49924 a49925 a49926 a49927 a49928 a49929 a49930 a49931 a49932 a49933 a49934 a49935 a49936 a49937 a49938 a49939 a49940 a49941 a49942 a49943 a49944 a49945 a49946 a49947 a49948 a49949 a49950 a49951 a49952 a49953 a49954 a49955 a49956 a49957 a49958 a49959 a49960 a49961 a49962 a49963 a49964 a49965 a49966 a49967 a49968 a49969 a49970 a49971 a49972 a49973 a49974 a49975 a49976 a49977 a49978 a49979 a49980 a49981 a49982 a49983 a49984 a49985 a49986 a49987 a49988 a49989 a49990 a49991 a49992 a49993 a49994 a49995 a49996 a49997 a49998 a49999 a50000 a50001 a50002 a50003 a50004 a50005 a50006 a50007 a50008 a50009 a50010 a50011 a50012 a50013 a50014 a50015 a50016 a50017 a50018 a50019 a50020 a50021 a50022 a50023 a50024 a50025 a50026 a50027 a50028 a50029 a50030 a50031 a50032 a50033 a50034 a50035 a50036 a50037 a50038 a50039 a50040 a50041 a50042 a50043 a50044 a50045 a50046 a50047 a50048 a50049 a50050 a50051 a50052 a50053 a50054 a50055 a50056 a50057 a50058 a50059 a50060 a50061 a50062 a50063 a50064 a50065 a50066 a50067 a50068 a50069 a50070 a50071 a50072 a50073 a50074 a50075 a50076 a50077 a50078 a50079 a50080 a50081 a50082 a50083 a50084 a50085 a50086 a50087 a50088 a50089 a50090 a50091 a50092 a50093 a50094 a50095 a50096 a50097 a50098 a50099 a50100 a50101 a50102 a50103 a50104 a50105 a50106 a50107 a50108 a50109 a50110 a50111 a50112 a50113 a50114 a50115 a50116 a50117 a50118 a50119 a50120 a50121 a50122 a50123 a50124 a50125 a50126 a50127 a50128 a50129 a50130 a50131 a50132 a50133 a50134 a50135 a50136 a50137 a50138 a50139 a50140 a50141 a50142 a50143 a50144 a50145 a50146 a50147 a50148 a50149 a50150 a50151 a50152 a50153 a50154 a50155 a50156 a50157 a50158 a50159 a50160 a50161 a50162 a50163 a50164 a50165 a50166 a50167 a50168 a50169 a50170 a50171 a50172 a50173 a50174 a50175 a50176 a50177 a50178 a50179 a50180 a50181 a50182 a50183 a50184 a50185 a50186 a50187 a50188 a50189 a50190 a50191 a50192 a50193 a50194 a50195 a50196 a50197 a50198 a50199 a50200 a50201 a50202 a50203 a50204 a50205 a50206 a50207 a50208 a50209 a50210 a50211 a50212 a50213 a50214 a50215 a50216 a50217 a50218 a50219 a50220 a50221 a50222 a50223 a50224 a50225 a50226 a50227 a50228 a50229 a50230 a50231 a50232 a50233 a50234 a50235 a50236 a50237 a50238 a50239 a50240 a50241 a50242 a50243 a50244 a50245 a50246 a50247 a50248 a50249 a50250 a50251 a50252 a50253 a50254 a50255 a50256 a50257 a50258 a50259 a50260 a50261 a50262 a50263 a50264 a50265 a50266 a50267 a50268 a50269 a50270 a50271 a50272 a50273 a50274 a50275 a50276 a50277 a50278 a50279 a50280 a50281 a50282 a50283 a50284 a50285 a50286 a50287 a50288 a50289 a50290 a50291 a50292 a50293 a50294 a50295 a50296 a50297 a50298 a50299 a50300 a50301 a50302 a50303 a50304 a50305 a50306 a50307 a50308 a50309 a50310 a50311 a50312 a50313 a50314 a50315 a50316 a50317 a50318 a50319 a50320 a50321 a50322 a50323 a50324 a50325 a50326 a50327 a50328 a50329 a50330 a50331 a50332 a50333 a50334 a50335 a50336 a50337 a50338 a50339 a50340 a50341 a50342 a50343 a50344 a50345 a50346 a50347 a50348 a50349 a50350 a50351 a50352 a50353 a50354 a50355 a50356 a50357 a50358 a50359 a50360 a50361 a50362 a50363 a50364 a50365 a50366 a50367 a50368 a50369 a50370 a50371 a50372 a50373 a50374 a50375 a50376 a50377 a50378 a50379 a50380 a50381 a50382 a50383 a50384 a50385 a50386 a50387 a50388 a50389 a50390 a50391 a50392 a50393 a50394 a50395 a50396 a50397 a50398 a50399 a50400 a50401 a50402 a50403 a50404 a50405 a50406 a50407 a50408 a50409 a50410 a50411 a50412 a50413 a50414 a50415 a50416 a50417 a50418 a50419 a50420 a50421 a50422 a50423 a50424 a50425 a50426 a50427 a50428 a50429 a50430 a50431 a50432 a50433 a50434 a50435 a50436 a50437 a50438 a50439 a50440 a50441 a50442 a50443 a50444 a50445 a50446 a50447 a50448 a50449 a50450 a50451 a50452 a50453 a50454 a50455 a50456 a50457 a50458 a50459 a50460 a50461 a50462 a50463 a50464 a50465 a50466 a50467 a50468 a50469 a50470 a50471 a50472 a50473 a50474 a50475 a50476 a50477 a50478 a50479 a50480 a50481 a50482 a50483 a50484 a50485 a50486 a50487 a50488 a50489 a50490 a50491 a50492 a50493 a50494 a50495 a50496 a50497 a50498 a50499 a50500 a50501 a50502 a50503 a50504 a50505 a50506 a50507 a50508 a50509 a50510 a50511 a50512 a50513 a50514 a50515 a50516 a50517 a50518 a50519 a50520 a50521 a50522 a50523 a50524 a50525 a50526 a50527 a50528 a50529 a50530 a50531 a50532 a50533 a50534 a50535 a50536 a50537 a50538 a50539 a50540 a50541 a50542 a50543 a50544 a50545 a50546 a50547 a50548 a50549 a50550 a50551 a50552 a50553 a50554 a50555 a50556 a50557 a50558 a50559 a50560 a50561 a50562 a50563 a50564 a50565 a50566 a50567 a50568 a50569 a50570 a50571 a50572 a50573 a50574 a50575 a50576 a50577 a50578 a50579 a50580 a50581 a50582 a50583 a50584 a50585 a50586 a50587 a50588 a50589 a50590 a50591 a50592 a50593 a50594 a50595 a50596 a50597 a50598 a50599 a50600 a50601 a50602 a50603 a50604 a50605 a50606 a50607 a50608 a50609 a50610 a50611 a50612 a50613 a50614 a50615 a50616 a50617 a50618 a50619 a50620 a50621 a50622 a50623 a50624 a50625 a50626 a50627 a50628 a50629 a50630 a50631 a50632 a50633 a50634 a50635 a50636 a50637 a50638 a50639 a50640 a50641 a50642 a50643 a50644 a50645 a50646 a50647 a50648 a50649 a50650 a50651 a50652 a50653 a50654 a50655 a50656 a50657 a50658 a50659 a50660 a50661 a50662 a50663 a50664 a50665 a50666 a50667 a50668 a50669 a50670 a50671 a50672 a50673 a50674 a50675 a50676 a50677 a50678 a50679 a50680 a50681 a50682 a50683 a50684 a50685 a50686 a50687 a50688 a50689 a50690 a50691 a50692 a50693 a50694 a50695 a50696 a50697 a50698 a50699 a50700 a50701 a50702 a50703 a50704 a50705 a50706 a50707 a50708 a50709 a50710 a50711 a50712 a50713 a50714 a50715 a50716 a50717 a50718 a50719 a50720 a50721 a50722 a50723 a50724 a50725 a50726 a50727 a50728 a50729 a50730 a50731 a50732 a50733 a50734 a50735 a50736 a50737 a50738 a50739 a50740 a50741 a50742 a50743 a50744 a50745 a50746 a50747 a50748 a50749 a50750 a50751 a50752 a50753 a50754 a50755 a50756 a50757 a50758 a50759 a50760 a50761 a50762 a50763 a50764 a50765 a50766 a50767 a50768 a50769 a50770 a50771 a50772 a50773 a50774 a50775 a50776 a50777 a50778 a50779 a50780 a50781 a50782 a50783 a50784 a50785 a50786 a50787 a50788 a50789 a50790 a50791 a50792 a50793 a50794 a50795 a50796 a50797 a50798 a50799 a50800 a50801 a50802 a50803 a50804 a50805 a50806 a50807 a50808 a50809 a50810 a50811 a50812 a50813 a50814 a50815 a50816 a50817 a50818 a50819 a50820 a50821 a50822 a50823 a50824 a50825 a50826 a50827 a50828 a50829 a50830 a50831 a50832 a50833 a50834 a50835 a50836 a50837 a50838 a50839 a50840 a50841 a50842 a50843 a50844 a50845 a50846 a50847 a50848 a50849 a50850 a50851 a50852 a50853 a50854 a50855 a50856 a50857 a50858 a50859 a50860 a50861 a50862 a50863 a50864 a50865 a50866 a50867 a50868 a50869 a50870 a50871 a50872 a50873 a50874 a50875 a50876 a50877 a50878 a50879 a50880 a50881 a50882 a50883 a50884 a50885 a50886 a50887 a50888 a50889 a50890 a50891 a50892 a50893 a50894 a50895 a50896 a50897 a50898 a50899 a50900 a50901 a50902 a50903 a50904 a50905 a50906 a50907 a50908 a50909 a50910 a50911 a50912 a50913 a50914 a50915 a50916 a50917 a50918 a50919 a50920 a50921 a50922 a50923 a50924 a50925 a50926 a50927 a50928 a50929 a50930 a50931 a50932 a50933 a50934 a50935 a50936 a50937 a50938 a50939 a50940 a50941 a50942 a50943 a50944 a50945 a50946 a50947 a50948 a50949 a50950 a50951 a50952 a50953 a50954 a50955 a50956 a50957 a50958 a50959 a50960 a50961 a50962 a50963 a50964 a50965 a50966 a50967 a50968 a50969 a50970 a50971 a50972 a50973 a50974 a50975 a50976 a50977 a50978 a50979 a50980 a50981 a50982 a50983 a50984 a50985 a50986 a50987 a50988 a50989 a50990 a50991 a50992 a50993 a50994 a50995 a50996 a50997 a50998 a50999 a51000 a51001 a51002 a51003 a51004 a51005 a51006 a51007 a51008 a51009 a51010 a51011 a51012 a51013 a51014 a51015 a51016 a51017 a51018 a51019 a51020 a51021 a51022 a51023 a51024 a51025 a51026 a51027 a51028 a51029 a51030 a51031 a51032 a51033 a51034 a51035 a51036 a51037 a51038 a51039 a51040 a51041 a51042 a51043 a51044 a51045 a51046 a51047 a51048 a51049 a51050 a51051 a51052 a51053 a51054 a51055 a51056 a51057 a51058 a51059 a51060 a51061 a51062 a51063 a51064 a51065 a51066 a51067 a51068 a51069 a51070 a51071 a51072 a51073 a51074 a51075 a51076 a51077 a51078 a51079 a51080 a51081 a51082 a51083 a51084 a51085 a51086 a51087 a51088 a51089 a51090 a51091 a51092 a51093 a51094 a51095 a51096 a51097 a51098 a51099 a51100 a51101 a51102 a51103 a51104 a51105 a51106 a51107 a51108 a51109 a51110 a51111 a51112 a51113 a51114 a51115 a51116 a51117 a51118 a51119 a51120 a51121 a51122 a51123 a51124 a51125 a51126 a51127 a51128 a51129 a51130 a51131 a51132 a51133 a51134 a51135 a51136 a51137 a51138 a51139 a51140 a51141 a51142 a51143 a51144 a51145 a51146 a51147 a51148 a51149 a51150 a51151 a51152 a51153 a51154 a51155 a51156 a51157 a51158 a51159 a51160 a51161 a51162 a51163 a51164 a51165 a51166 a51167 a51168 a51169 a51170 a51171 a51172 a51173 a51174 a51175 a51176 a51177 a51178 a51179 a51180 a51181 a51182 a51183 a51184 a51185 a51186 a51187 a51188 a51189 a51190 a51191 a51192 a51193 a51194 a51195 a51196 a51197 a51198 a51199 a51200 a51201 a51202 a51203 a51204 a51205 a51206 a51207 a51208 a51209 a51210 a51211 a51212 a51213 a51214 a51215 a51216 a51217 a51218 a51219 a51220 a51221 a51222 a51223 a51224 a51225 a51226 a51227 a51228 a51229 a51230 a51231 a51232 a51233 a51234 a51235 a51236 a51237 a51238 a51239 a51240 a51241 a51242 a51243 a51244 a51245 a51246 a51247 a51248 a51249 a51250 a51251 a51252 a51253 a51254 a51255 a51256 a51257 a51258 a51259 a51260 a51261 a51262 a51263 a51264 a51265 a51266 a51267 a51268 a51269 a51270 a51271 a51272 a51273 a51274 a51275 a51276 a51277 a51278 a51279 a51280 a51281 a51282 a51283 a51284 a51285 a51286 a51287 a51288 a51289 a51290 a51291 a51292 a51293 a51294 a51295 a51296 a51297 a51298 a51299 a51300 a51301 a51302 a51303 a51304 a51305 a51306 a51307 a51308 a51309 a51310 a51311 a51312 a51313 a51314 a51315 a51316 a51317 a51318 a51319 a51320 a51321 a51322 a51323 a51324 a51325 a51326 a51327 a51328 a51329 a51330 a51331 a51332 a51333 a51334 a51335 a51336 a51337 a51338 a51339 a51340 a51341 a51342 a51343 a51344 a51345 a51346 a51347 a51348 a51349 a51350 a51351 a51352 a51353 a51354 a51355 a51356 a51357 a51358 a51359 a51360 a51361 a51362 a51363 a51364 a51365 a51366 a51367 a51368 a51369 a51370 a51371 a51372 a51373 a51374 a51375 a51376 a51377 a51378 a51379 a51380 a51381 a51382 a51383 a51384 a51385 a51386 a51387 a51388 a51389 a51390 a51391 a51392 a51393 a51394 a51395 a51396 a51397 a51398 a51399 a51400 a51401 a51402 a51403 a51404 a51405 a51406 a51407 a51408 a51409 a51410 a51411 a51412 a51413 a51414 a51415 a51416 a51417 a51418 a51419 a51420 a51421 a51422 a51423 a51424 a51425 a51426 a51427 a51428 a51429 a51430 a51431 a51432 a51433 a51434 a51435 a51436 a51437 a51438 a51439 a51440 a51441 a51442 a51443 a51444 a51445 a51446 a51447 a51448 a51449 a51450 a51451 a51452 a51453 a51454 a51455 a51456 a51457 a51458 a51459 a51460 a51461 a51462 a51463 a51464 a51465 a51466 a51467 a51468 a51469 a51470 a51471 a51472 a51473 a51474 a51475 a51476 a51477 a51478 a51479 a51480 a51481 a51482 a51483 a51484 a51485 a51486 a51487 a51488 a51489 a51490 a51491 a51492 a51493 a51494 a51495 a51496 a51497 a51498 a51499 a51500 a51501 a51502 a51503 a51504 a51505 a51506 a51507 a51508 a51509 a51510 a51511 a51512 a51513 a51514 a51515 a51516 a51517 a51518 a51519 a51520 a51521 a51522 a51523 a51524 a51525 a51526 a51527 a51528 a51529 a51530 a51531 a51532 a51533 a51534 a51535 a51536 a51537 a51538 a51539 a51540 a51541 a51542 a51543 a51544 a51545 a51546 a51547 a51548 a51549 a51550 a51551 a51552 a51553 a51554 a51555 a51556 a51557 a51558 a51559 a51560 a51561 a51562 a51563 a51564 a51565 a51566 a51567 a51568 a51569 a51570 a51571 a51572 a51573 a51574 a51575 a51576 a51577 a51578 a51579 a51580 a51581 a51582 a51583 a51584 a51585 a51586 a51587 a51588 a51589 a51590 a51591 a51592 a51593 a51594 a51595 a51596 a51597 a51598 a51599 a51600 a51601 a51602 a51603 a51604 a51605 a51606 a51607 a51608 a51609 a51610 a51611 a51612 a51613 a51614 a51615 a51616 a51617 a51618 a51619 a51620 a51621 a51622 a51623 a51624 a51625 a51626 a51627 a51628 a51629 a51630 a51631 a51632 a51633 a51634 a51635 a51636 a51637 a51638 a51639 a51640 a51641 a51642 a51643 a51644 a51645 a51646 a51647 a51648 a51649 a51650 a51651 a51652 a51653 a51654 a51655 a51656 a51657 a51658 a51659 a51660 a51661 a51662 a51663 a51664 a51665 a51666 a51667 a51668 a51669 a51670 a51671 a51672 a51673 a51674 a51675 a51676 a51677 a51678 a51679 a51680 a51681 a51682 a51683 a51684 a51685 a51686 a51687 a51688 a51689 a51690 a51691 a51692 a51693 a51694 a51695 a51696 a51697 a51698 a51699 a51700 a51701 a51702 a51703 a51704 a51705 a51706 a51707 a51708 a51709 a51710 a51711 a51712 a51713 a51714 a51715 a51716 a51717 a51718 a51719 a51720 a51721 a51722 a51723 a51724 a51725 a51726 a51727 a51728 a51729 a51730 a51731 a51732 a51733 a51734 a51735 a51736 a51737 a51738 a51739 a51740 a51741 a51742 a51743 a51744 a51745 a51746 a51747 a51748 a51749 a51750 a51751 a51752 a51753 a51754 a51755 a51756 a51757 a51758 a51759 a51760 a51761 a51762 a51763 a51764 a51765 a51766 a51767 a51768 a51769 a51770 a51771 a51772 a51773 a51774 a51775 a51776 a51777 a51778 a51779 a51780 a51781 a51782 a51783 a51784 a51785 a51786 a51787 a51788 a51789 a51790 a51791 a51792 a51793 a51794 a51795 a51796 a51797 a51798 a51799 a51800 a51801 a51802 a51803 a51804 a51805 a51806 a51807 a51808 a51809 a51810 a51811 a51812 a51813 a51814 a51815 a51816 a51817 a51818 a51819 a51820 a51821 a51822 a51823 a51824 a51825 a51826 a51827 a51828 a51829 a51830 a51831 a51832 a51833 a51834 a51835 a51836 a51837 a51838 a51839 a51840 a51841 a51842 a51843 a51844 a51845 a51846 a51847 a51848 a51849 a51850 a51851 a51852 a51853 a51854 a51855 a51856 a51857 a51858 a51859 a51860 a51861 a51862 a51863 a51864 a51865 a51866 a51867 a51868 a51869 a51870 a51871 a51872 a51873 a51874 a51875 a51876 a51877 a51878 a51879 a51880 a51881 a51882 a51883 a51884 a51885 a51886 a51887 a51888 a51889 a51890 a51891 a51892 a51893 a51894 a51895 a51896 a51897 a51898 a51899 a51900 a51901 a51902 a51903 a51904 a51905 a51906 a51907 a51908 a51909 a51910 a51911 a51912 a51913 a51914 a51915 a51916 a51917 a51918 a51919 a51920 a51921 a51922 a51923 a51924 a51925 a51926 a51927 a51928 a51929 a51930 a51931 a51932 a51933 a51934 a51935 a51936 a51937 a51938 a51939 a51940 a51941 a51942 a51943 a51944 a51945 a51946 a51947 a51948 a51949 a51950 a51951 a51952 a51953 a51954 a51955 a51956 a51957 a51958 a51959 a51960 a51961 a51962 a51963 a51964 a51965 a51966 a51967 a51968 a51969 a51970 a51971 a51972 a51973 a51974 a51975 a51976 a51977 a51978 a51979 a51980 a51981 a51982 a51983 a51984 a51985 a51986 a51987 a51988 a51989 a51990 a51991 a51992 a51993 a51994 a51995 a51996 a51997 a51998 a51999 a52000 a52001 a52002 a52003 a52004 a52005 a52006 a52007 a52008 a52009 a52010 a52011 a52012 a52013 a52014 a52015 a52016 a52017 a52018 a52019 a52020 a52021 a52022 a52023 a52024 a52025 a52026 a52027 a52028 a52029 a52030 a52031 a52032 a52033 a52034 a52035 a52036 a52037 a52038 a52039 a52040 a52041 a52042 a52043 a52044 a52045 a52046 a52047 a52048 a52049 a52050 a52051 a52052 a52053 a52054 a52055 a52056 a52057 a52058 a52059 a52060 a52061 a52062 a52063 a52064 a52065 a52066 a52067 a52068 a52069 a52070 a52071 a52072 a52073 a52074 a52075 a52076 a52077 a52078 a52079 a52080 a52081 a52082 a52083 a52084 a52085 a52086 a52087 a52088 a52089 a52090 a52091 a52092 a52093 a52094 a52095 a52096 a52097 a52098 a52099 a52100 a52101 a52102 a52103 a52104 a52105 a52106 a52107 a52108 a52109 a52110 a52111 a52112 a52113 a52114 a52115 a52116 a52117 a52118 a52119 a52120 a52121 a52122 a52123 a52124 a52125 a52126 a52127 a52128 a52129 a52130 a52131 a52132 a52133 a52134 a52135 a52136 a52137 a52138 a52139 a52140 a52141 a52142 a52143 a52144 a52145 a52146 a52147 a52148 a52149 a52150 a52151 a52152 a52153 a52154 a52155 a52156 a52157 a52158 a52159 a52160 a52161 a52162 a52163 a52164 a52165 a52166 a52167 a52168 a52169 a52170 a52171 a52172 a52173 a52174 a52175 a52176 a52177 a52178 a52179 a52180 a52181 a52182 a52183 a52184 a52185 a52186 a52187 a52188 a52189 a52190 a52191 a52192 a52193 a52194 a52195 a52196 a52197 a52198 a52199 a52200 a52201 a52202 a52203 a52204 a52205 a52206 a52207 a52208 a52209 a52210 a52211 a52212 a52213 a52214 a52215 a52216 a52217 a52218 a52219 a52220 a52221 a52222 a52223 a52224 a52225 a52226 a52227 a52228 a52229 a52230 a52231 a52232 a52233 a52234 a52235 a52236 a52237 a52238 a52239 a52240 a52241 a52242 a52243 a52244 a52245 a52246 a52247 a52248 a52249 a52250 a52251 a52252 a52253 a52254 a52255 a52256 a52257 a52258 a52259 a52260 a52261 a52262 a52263 a52264 a52265 a52266 a52267 a52268 a52269 a52270 a52271 a52272 a52273 a52274 a52275 a52276 a52277 a52278 a52279 a52280 a52281 a52282 a52283 a52284 a52285 a52286 a52287 a52288 a52289 a52290 a52291 a52292 a52293 a52294 a52295 a52296 a52297 a52298 a52299 a52300 a52301 a52302 a52303 a52304 a52305 a52306 a52307 a52308 a52309 a52310 a52311 a52312 a52313 a52314 a52315 a52316 a52317 a52318 a52319 a52320 a52321 a52322 a52323 a52324 a52325 a52326 a52327 a52328 a52329 a52330 a52331 a52332 a52333 a52334 a52335 a52336 a52337 a52338 a52339 a52340 a52341 a52342 a52343 a52344 a52345 a52346 a52347 a52348 a52349 a52350 a52351 a52352 a52353 a52354 a52355 a52356 a52357 a52358 a52359 a52360 a52361 a52362 a52363 a52364 a52365 a52366 a52367 a52368 a52369 a52370 a52371 a52372 a52373 a52374 a52375 a52376 a52377 a52378 a52379 a52380 a52381 a52382 a52383 a52384 a52385 a52386 a52387 a52388 a52389 a52390 a52391 a52392 a52393 a52394 a52395 a52396 a52397 a52398 a52399 a52400 a52401 a52402 a52403 a52404 a52405 a52406 a52407 a52408 a52409 a52410 a52411 a52412 a52413 a52414 a52415 a52416 a52417 a52418 a52419 a52420 a52421 a52422 a52423 a52424 a52425 a52426 a52427 a52428 a52429 a52430 a52431 a52432 a52433 a52434 a52435 a52436 a52437 a52438 a52439 a52440 a52441 a52442 a52443 a52444 a52445 a52446 a52447 a52448 a52449 a52450 a52451 a52452 a52453 a52454 a52455 a52456 a52457 a52458 a52459 a52460 a52461 a52462 a52463 a52464 a52465 a52466 a52467 a52468 a52469 a52470 a52471 a52472 a52473 a52474 a52475 a52476 a52477 a52478 a52479 a52480 a52481 a52482 a52483 a52484 a52485 a52486 a52487 a52488 a52489 a52490 a52491 a52492 a52493 a52494 a52495 a52496 a52497 a52498 a52499 a52500 a52501 a52502 a52503 a52504 a52505 a52506 a52507 a52508 a52509 a52510 a52511 a52512 a52513 a52514 a52515 a52516 a52517 a52518 a52519 a52520 a52521 a52522 a52523 a52524 a52525 a52526 a52527 a52528 a52529 a52530 a52531 a52532 a52533 a52534 a52535 a52536 a52537 a52538 a52539 a52540 a52541 a52542 a52543 a52544 a52545 a52546 a52547 a52548 a52549 a52550 a52551 a52552 a52553 a52554 a52555 a52556 a52557 a52558 a52559 a52560 a52561 a52562 a52563 a52564 a52565 a52566 a52567 a52568 a52569 a52570 a52571 a52572 a52573 a52574 a52575 a52576 a52577 a52578 a52579 a52580 a52581 a52582 a52583 a52584 a52585 a52586 a52587 a52588 a52589 a52590 a52591 a52592 a52593 a52594 a52595 a52596 a52597 a52598 a52599 a52600 a52601 a52602 a52603 a52604 a52605 a52606 a52607 a52608 a52609 a52610 a52611 a52612 a52613 a52614 a52615 a52616 a52617 a52618 a52619 a52620 a52621 a52622 a52623 a52624 a52625 a52626 a52627 a52628 a52629 a52630 a52631 a52632 a52633 a52634 a52635 a52636 a52637 a52638 a52639 a52640 a52641 a52642 a52643 a52644 a52645 a52646 a52647 a52648 a52649 a52650 a52651 a52652 a52653 a52654 a52655 a52656 a52657 a52658 a52659 a52660 a52661 a52662 a52663 a52664 a52665 a52666 a52667 a52668 a52669 a52670 a52671 a52672 a52673 a52674 a52675 a52676 a52677 a52678 a52679 a52680 a52681 a52682 a52683 a52684 a52685 a52686 a52687 a52688 a52689 a52690 a52691 a52692 a52693 a52694 a52695 a52696 a52697 a52698 a52699 a52700 a52701 a52702 a52703 a52704 a52705 a52706 a52707 a52708 a52709 a52710 a52711 a52712 a52713 a52714 a52715 a52716 a52717 a52718 a52719 a52720 a52721 a52722 a52723 a52724 a52725 a52726 a52727 a52728 a52729 a52730 a52731 a52732 a52733 a52734 a52735 a52736 a52737 a52738 a52739 a52740 a52741 a52742 a52743 a52744 a52745 a52746 a52747 a52748 a52749 a52750 a52751 a52752 a52753 a52754 a52755 a52756 a52757 a52758 a52759 a52760 a52761 a52762 a52763 a52764 a52765 a52766 a52767 a52768 a52769 a52770 a52771 a52772 a52773 a52774 a52775 a52776 a52777 a52778 a52779 a52780 a52781 a52782 a52783 a52784 a52785 a52786 a52787 a52788 a52789 a52790 a52791 a52792 a52793 a52794 a52795 a52796 a52797 a52798 a52799 a52800 a52801 a52802 a52803 a52804 a52805 a52806 a52807 a52808 a52809 a52810 a52811 a52812 a52813 a52814 a52815 a52816 a52817 a52818 a52819 a52820 a52821 a52822 a52823 a52824 a52825 a52826 a52827 a52828 a52829 a52830 a52831 a52832 a52833 a52834 a52835 a52836 a52837 a52838 a52839 a52840 a52841 a52842 a52843 a52844 a52845 a52846 a52847 a52848 a52849 a52850 a52851 a52852 a52853 a52854 a52855 a52856 a52857 a52858 a52859 a52860 a52861 a52862 a52863 a52864 a52865 a52866 a52867 a52868 a52869 a52870 a52871 a52872 a52873 a52874 a52875 a52876 a52877 a52878 a52879 a52880 a52881 a52882 a52883 a52884 a52885 a52886 a52887 a52888 a52889 a52890 a52891 a52892 a52893 a52894 a52895 a52896 a52897 a52898 a52899 a52900 a52901 a52902 a52903 a52904 a52905 a52906 a52907 a52908 a52909 a52910 a52911 a52912 a52913 a52914 a52915 a52916 a52917 a52918 a52919 a52920 a52921 a52922 a52923 a52924 a52925 a52926 a52927 a52928 a52929 a52930 a52931 a52932 a52933 a52934 a52935 a52936 a52937 a52938 a52939 a52940 a52941 a52942 a52943 a52944 a52945 a52946 a52947 a52948 a52949 a52950 a52951 a52952 a52953 a52954 a52955 a52956 a52957 a52958 a52959 a52960 a52961 a52962 a52963 a52964 a52965 a52966 a52967 a52968 a52969 a52970 a52971 a52972 a52973 a52974 a52975 a52976 a52977 a52978 a52979 a52980 a52981 a52982 a52983 a52984 a52985 a52986 a52987 a52988 a52989 a52990 a52991 a52992 a52993 a52994 a52995 a52996 a52997 a52998 a52999 a53000 a53001 a53002 a53003 a53004 a53005 a53006 a53007 a53008 a53009 a53010 a53011 a53012 a53013 a53014 a53015 a53016 a53017 a53018 a53019 a53020 a53021 a53022 a53023 a53024 a53025 a53026 a53027 a53028 a53029 a53030 a53031 a53032 a53033 a53034 a53035 a53036 a53037 a53038 a53039 a53040 a53041 a53042 a53043 a53044 a53045 a53046 a53047 a53048 a53049 a53050 a53051 a53052 a53053 a53054 a53055 a53056 a53057 a53058 a53059 a53060 a53061 a53062 a53063 a53064 a53065 a53066 a53067 a53068 a53069 a53070 a53071 a53072 a53073 a53074 a53075 a53076 a53077 a53078 a53079 a53080 a53081 a53082 a53083 a53084 a53085 a53086 a53087 a53088 a53089 a53090 a53091 a53092 a53093 a53094 a53095 a53096 a53097 a53098 a53099 a53100 a53101 a53102 a53103 a53104 a53105 a53106 a53107 a53108 a53109 a53110 a53111 a53112 a53113 a53114 a53115 a53116 a53117 a53118 a53119 a53120 a53121 a53122 a53123 a53124 a53125 a53126 a53127 a53128 a53129 a53130 a53131 a53132 a53133 a53134 a53135 a53136 a53137 a53138 a53139 a53140 a53141 a53142 a53143 a53144 a53145 a53146 a53147 a53148 a53149 a53150 a53151 a53152 a53153 a53154 a53155 a53156 a53157 a53158 a53159 a53160 a53161 a53162 a53163 a53164 a53165 a53166 a53167 a53168 a53169 a53170 a53171 a53172 a53173 a53174 a53175 a53176 a53177 a53178 a53179 a53180 a53181 a53182 a53183 a53184 a53185 a53186 a53187 a53188 a53189 a53190 a53191 a53192 a53193 a53194 a53195 a53196 a53197 a53198 a53199 a53200 a53201 a53202 a53203 a53204 a53205 a53206 a53207 a53208 a53209 a53210 a53211 a53212 a53213 a53214 a53215 a53216 a53217 a53218 a53219 a53220 a53221 a53222 a53223 a53224 a53225 a53226 a53227 a53228 a53229 a53230 a53231 a53232 a53233 a53234 a53235 a53236 a53237 a53238 a53239 a53240 a53241 a53242 a53243 a53244 a53245 a53246 a53247 a53248 a53249 a53250 a53251 a53252 a53253 a53254 a53255 a53256 a53257 a53258 a53259 a53260 a53261 a53262 a53263 a53264 a53265 a53266 a53267 a53268 a53269 a53270 a53271 a53272 a53273 a53274 a53275 a53276 a53277 a53278 a53279 a53280 a53281 a53282 a53283 a53284 a53285 a53286 a53287 a53288 a53289 a53290 a53291 a53292 a53293 a53294 a53295 a53296 a53297 a53298 a53299 a53300 a53301 a53302 a53303 a53304 a53305 a53306 a53307 a53308 a53309 a53310 a53311 a53312 a53313 a53314 a53315 a53316 a53317 a53318 a53319 a53320 a53321 a53322 a53323 a53324 a53325 a53326 a53327 a53328 a53329 a53330 a53331 a53332 a53333 a53334 a53335 a53336 a53337 a53338 a53339 a53340 a53341 a53342 a53343 a53344 a53345 a53346 a53347 a53348 a53349 a53350 a53351 a53352 a53353 a53354 a53355 a53356 a53357 a53358 a53359 a53360 a53361 a53362 a53363 a53364 a53365 a53366 a53367 a53368 a53369 a53370 a53371 a53372 a53373 a53374 a53375 a53376 a53377 a53378 a53379 a53380 a53381 a53382 a53383 a53384 a53385 a53386 a53387 a53388 a53389 a53390 a53391 a53392 a53393 a53394 a53395 a53396 a53397 a53398 a53399 a53400 a53401 a53402 a53403 a53404 a53405 a53406 a53407 a53408 a53409 a53410 a53411 a53412 a53413 a53414 a53415 a53416 a53417 a53418 a53419 a53420 a53421 a53422 a53423 a53424 a53425 a53426 a53427 a53428 a53429 a53430 a53431 a53432 a53433 a53434 a53435 a53436 a53437 a53438 a53439 a53440 a53441 a53442 a53443 a53444 a53445 a53446 a53447 a53448 a53449 a53450 a53451 a53452 a53453 a53454 a53455 a53456 a53457 a53458 a53459 a53460 a53461 a53462 a53463 a53464 a53465 a53466 a53467 a53468 a53469 a53470 a53471 a53472 a53473 a53474 a53475 a53476 a53477 a53478 a53479 a53480 a53481 a53482 a53483 a53484 a53485 a53486 a53487 a53488 a53489 a53490 a53491 a53492 a53493 a53494 a53495 a53496 a53497 a53498 a53499 a53500 a53501 a53502 a53503 a53504 a53505 a53506 a53507 a53508 a53509 a53510 a53511 a53512 a53513 a53514 a53515 a53516 a53517 a53518 a53519 a53520 a53521 a53522 a53523 a53524 a53525 a53526 a53527 a53528 a53529 a53530 a53531 a53532 a53533 a53534 a53535 a53536 a53537 a53538 a53539 a53540 a53541 a53542 a53543 a53544 a53545 a53546 a53547 a53548 a53549 a53550 a53551 a53552 a53553 a53554 a53555 a53556 a53557 a53558 a53559 a53560 a53561 a53562 a53563 a53564 a53565 a53566 a53567 a53568 a53569 a53570 a53571 a53572 a53573 a53574 a53575 a53576 a53577 a53578 a53579 a53580 a53581 a53582 a53583 a53584 a53585 a53586 a53587 a53588 a53589 a53590 a53591 a53592 a53593 a53594 a53595 a53596 a53597 a53598 a53599 a53600 a53601 a53602 a53603 a53604 a53605 a53606 a53607 a53608 a53609 a53610 a53611 a53612 a53613 a53614 a53615 a53616 a53617 a53618 a53619 a53620 a53621 a53622 a53623 a53624 a53625 a53626 a53627 a53628 a53629 a53630 a53631 a53632 a53633 a53634 a53635 a53636 a53637 a53638 a53639 a53640 a53641 a53642 a53643 a53644 a53645 a53646 a53647 a53648 a53649 a53650 a53651 a53652 a53653 a53654 a53655 a53656 a53657 a53658 a53659 a53660 a53661 a53662 a53663 a53664 a53665 a53666 a53667 a53668 a53669 a53670 a53671 a53672 a53673 a53674 a53675 a53676 a53677 a53678 a53679 a53680 a53681 a53682 a53683 a53684 a53685 a53686 a53687 a53688 a53689 a53690 a53691 a53692 a53693 a53694 a53695 a53696 a53697 a53698 a53699 a53700 a53701 a53702 a53703 a53704 a53705 a53706 a53707 a53708 a53709 a53710 a53711 a53712 a53713 a53714 a53715 a53716 a53717 a53718 a53719 a53720 a53721 a53722 a53723 a53724 a53725 a53726 a53727 a53728 a53729 a53730 a53731 a53732 a53733 a53734 a53735 a53736 a53737 a53738 a53739 a53740 a53741 a53742 a53743 a53744 a53745 a53746 a53747 a53748 a53749 a53750 a53751 a53752 a53753 a53754 a53755 a53756 a53757 a53758 a53759 a53760 a53761 a53762 a53763 a53764 a53765 a53766 a53767 a53768 a53769 a53770 a53771 a53772 a53773 a53774 a53775 a53776 a53777 a53778 a53779 a53780 a53781 a53782 a53783 a53784 a53785 a53786 a53787 a53788 a53789 a53790 a53791 a53792 a53793 a53794 a53795 a53796 a53797 a53798 a53799 a53800 a53801 a53802 a53803 a53804 a53805 a53806 a53807 a53808 a53809 a53810 a53811 a53812 a53813 a53814 a53815 a53816 a53817 a53818 a53819 a53820 a53821 a53822 a53823 a53824 a53825 a53826 a53827 a53828 a53829 a53830 a53831 a53832 a53833 a53834 a53835 a53836 a53837 a53838 a53839 a53840 a53841 a53842 a53843 a53844 a53845 a53846 a53847 a53848 a53849 a53850 a53851 a53852 a53853 a53854 a53855 a53856 a53857 a53858 a53859 a53860 a53861 a53862 a53863 a53864 a53865 a53866 a53867 a53868 a53869 a53870 a53871 a53872 a53873 a53874 a53875 a53876 a53877 a53878 a53879 a53880 a53881 a53882 a53883 a53884 a53885 a53886 a53887 a53888 a53889 a53890 a53891 a53892 a53893 a53894 a53895 a53896 a53897 a53898 a53899 a53900 a53901 a53902 a53903 a53904 a53905 a53906 a53907 a53908 a53909 a53910 a53911 a53912 a53913 a53914 a53915 a53916 a53917 a53918 a53919 a53920 a53921 a53922 a53923 a53924 a53925 a53926 a53927 a53928 a53929 a53930 a53931 a53932 a53933 a53934 a53935 a53936 a53937 a53938 a53939 a53940 a53941 a53942 a53943 a53944 a53945 a53946 a53947 a53948 a53949 a53950 a53951 a53952 a53953 a53954 a53955 a53956 a53957 a53958 a53959 a53960 a53961 a53962 a53963 a53964 a53965 a53966 a53967 a53968 a53969 a53970 a53971 a53972 a53973 a53974 a53975 a53976 a53977 a53978 a53979 a53980 a53981 a53982 a53983 a53984 a53985 a53986 a53987 a53988 a53989 a53990 a53991 a53992 a53993 a53994 a53995 a53996 a53997 a53998 a53999 a54000 a54001 a54002 a54003 a54004 a54005 a54006 a54007 a54008 a54009 a54010 a54011 a54012 a54013 a54014 a54015 a54016 a54017 a54018 a54019 a54020 a54021 a54022 a54023 a54024 a54025 a54026 a54027 a54028 a54029 a54030 a54031 a54032 a54033 a54034 a54035 a54036 a54037 a54038 a54039 a54040 a54041 a54042 a54043 a54044 a54045 a54046 a54047 a54048 a54049 a54050 a54051 a54052 a54053 a54054 a54055 a54056 a54057 a54058 a54059 a54060 a54061 a54062 a54063 a54064 a54065 a54066 a54067 a54068 a54069 a54070 a54071 a54072 a54073 a54074 a54075 a54076 a54077 a54078 a54079 a54080 a54081 a54082 a54083 a54084 a54085 a54086 a54087 a54088 a54089 a54090 a54091 a54092 a54093 a54094 a54095 a54096 a54097 a54098 a54099 a54100 a54101 a54102 a54103 a54104 a54105 a54106 a54107 a54108 a54109 a54110 a54111 a54112 a54113 a54114 a54115 a54116 a54117 a54118 a54119 a54120 a54121 a54122 a54123 a54124 a54125 a54126 a54127 a54128 a54129 a54130 a54131 a54132 a54133 a54134 a54135 a54136 a54137 a54138 a54139 a54140 a54141 a54142 a54143 a54144 a54145 a54146 a54147 a54148 a54149 a54150 a54151 a54152 a54153 a54154 a54155 a54156 a54157 a54158 a54159 a54160 a54161 a54162 a54163 a54164 a54165 a54166 a54167 a54168 a54169 a54170 a54171 a54172 a54173 a54174 a54175 a54176 a54177 a54178 a54179 a54180 a54181 a54182 a54183 a54184 a54185 a54186 a54187 a54188 a54189 a54190 a54191 a54192 a54193 a54194 a54195 a54196 a54197 a54198 a54199 a54200 a54201 a54202 a54203 a54204 a54205 a54206 a54207 a54208 a54209 a54210 a54211 a54212 a54213 a54214 a54215 a54216 a54217 a54218 a54219 a54220 a54221 a54222 a54223 a54224 a54225 a54226 a54227 a54228 a54229 a54230 a54231 a54232 a54233 a54234 a54235 a54236 a54237 a54238 a54239 a54240 a54241 a54242 a54243 a54244 a54245 a54246 a54247 a54248 a54249 a54250 a54251 a54252 a54253 a54254 a54255 a54256 a54257 a54258 a54259 a54260 a54261 a54262 a54263 a54264 a54265 a54266 a54267 a54268 a54269 a54270 a54271 a54272 a54273 a54274 a54275 a54276 a54277 a54278 a54279 a54280 a54281 a54282 a54283 a54284 a54285 a54286 a54287 a54288 a54289 a54290 a54291 a54292 a54293 a54294 a54295 a54296 a54297 a54298 a54299 a54300 a54301 a54302 a54303 a54304 a54305 a54306 a54307 a54308 a54309 a54310 a54311 a54312 a54313 a54314 a54315 a54316 a54317 a54318 a54319 a54320 a54321 a54322 a54323 a54324 a54325 a54326 a54327 a54328 a54329 a54330 a54331 a54332 a54333 a54334 a54335 a54336 a54337 a54338 a54339 a54340 a54341 a54342 a54343 a54344 a54345 a54346 a54347 a54348 a54349 a54350 a54351 a54352 a54353 a54354 a54355 a54356 a54357 a54358 a54359 a54360 a54361 a54362 a54363 a54364 a54365 a54366 a54367 a54368 a54369 a54370 a54371 a54372 a54373 a54374 a54375 a54376 a54377 a54378 a54379 a54380 a54381 a54382 a54383 a54384 a54385 a54386 a54387 a54388 a54389 a54390 a54391 a54392 a54393 a54394 a54395 a54396 a54397 a54398 a54399 a54400 a54401 a54402 a54403 a54404 a54405 a54406 a54407 a54408 a54409 a54410 a54411 a54412 a54413 a54414 a54415 a54416 a54417 a54418 a54419 a54420 a54421 a54422 a54423 a54424 a54425 a54426 a54427 a54428 a54429 a54430 a54431 a54432 a54433 a54434 a54435 a54436 a54437 a54438 a54439 a54440 a54441 a54442 a54443 a54444 a54445 a54446 a54447 a54448 a54449 a54450 a54451 a54452 a54453 a54454 a54455 a54456 a54457 a54458 a54459 a54460 a54461 a54462 a54463 a54464 a54465 a54466 a54467 a54468 a54469 a54470 a54471 a54472 a54473 a54474 a54475 a54476 a54477 a54478 a54479 a54480 a54481 a54482 a54483 a54484 a54485 a54486 a54487 a54488 a54489 a54490 a54491 a54492 a54493 a54494 a54495 a54496 a54497 a54498 a54499 a54500 a54501 a54502 a54503 a54504 a54505 a54506 a54507 a54508 a54509 a54510 a54511 a54512 a54513 a54514 a54515 a54516 a54517 a54518 a54519 a54520 a54521 a54522 a54523 a54524 a54525 a54526 a54527 a54528 a54529 a54530 a54531 a54532 a54533 a54534 a54535 a54536 a54537 a54538 a54539 a54540 a54541 a54542 a54543 a54544 a54545 a54546 a54547 a54548 a54549 a54550 a54551 a54552 a54553 a54554 a54555 a54556 a54557 a54558 a54559 a54560 a54561 a54562 a54563 a54564 a54565 a54566 a54567 a54568 a54569 a54570 a54571 a54572 a54573 a54574 a54575 a54576 a54577 a54578 a54579 a54580 a54581 a54582 a54583 a54584 a54585 a54586 a54587 a54588 a54589 a54590 a54591 a54592 a54593 a54594 a54595 a54596 a54597 a54598 a54599 a54600 a54601 a54602 a54603 a54604 a54605 a54606 a54607 a54608 a54609 a54610 a54611 a54612 a54613 a54614 a54615 a54616 a54617 a54618 a54619 a54620 a54621 a54622 a54623 a54624 a54625 a54626 a54627 a54628 a54629 a54630 a54631 a54632 a54633 a54634 a54635 a54636 a54637 a54638 a54639 a54640 a54641 a54642 a54643 a54644 a54645 a54646 a54647 a54648 a54649 a54650 a54651 a54652 a54653 a54654 a54655 a54656 a54657 a54658 a54659 a54660 a54661 a54662 a54663 a54664 a54665 a54666 a54667 a54668 a54669 a54670 a54671 a54672 a54673 a54674 a54675 a54676 a54677 a54678 a54679 a54680 a54681 a54682 a54683 a54684 a54685 a54686 a54687 a54688 a54689 a54690 a54691 a54692 a54693 a54694 a54695 a54696 a54697 a54698 a54699 a54700 a54701 a54702 a54703 a54704 a54705 a54706 a54707 a54708 a54709 a54710 a54711 a54712 a54713 a54714 a54715 a54716 a54717 a54718 a54719 a54720 a54721 a54722 a54723 a54724 a54725 a54726 a54727 a54728 a54729 a54730 a54731 a54732 a54733 a54734 a54735 a54736 a54737 a54738 a54739 a54740 a54741 a54742 a54743 a54744 a54745 a54746 a54747 a54748 a54749 a54750 a54751 a54752 a54753 a54754 a54755 a54756 a54757 a54758 a54759 a54760 a54761 a54762 a54763 a54764 a54765 a54766 a54767 a54768 a54769 a54770 a54771 a54772 a54773 a54774 a54775 a54776 a54777 a54778 a54779 a54780 a54781 a54782 a54783 a54784 a54785 a54786 a54787 a54788 a54789 a54790 a54791 a54792 a54793 a54794 a54795 a54796 a54797 a54798 a54799 a54800 a54801 a54802 a54803 a54804 a54805 a54806 a54807 a54808 a54809 a54810 a54811 a54812 a54813 a54814 a54815 a54816 a54817 a54818 a54819 a54820 a54821 a54822 a54823 a54824 a54825 a54826 a54827 a54828 a54829 a54830 a54831 a54832 a54833 a54834 a54835 a54836 a54837 a54838 a54839 a54840 a54841 a54842 a54843 a54844 a54845 a54846 a54847 a54848 a54849 a54850 a54851 a54852 a54853 a54854 a54855 a54856 a54857 a54858 a54859 a54860 a54861 a54862 a54863 a54864 a54865 a54866 a54867 a54868 a54869 a54870 a54871 a54872 a54873 a54874 a54875 a54876 a54877 a54878 a54879 a54880 a54881 a54882 a54883 a54884 a54885 a54886 a54887 a54888 a54889 a54890 a54891 a54892 a54893 a54894 a54895 a54896 a54897 a54898 a54899 a54900 a54901 a54902 a54903 a54904 a54905 a54906 a54907 a54908 a54909 a54910 a54911 a54912 a54913 a54914 a54915 a54916 a54917 a54918 a54919 a54920 a54921 a54922 a54923 a54924 a54925 a54926 a54927 a54928 a54929 a54930 a54931 a54932 a54933 a54934 a54935 a54936 a54937 a54938 a54939 a54940 a54941 a54942 a54943 a54944 a54945 a54946 a54947 a54948 a54949 a54950 a54951 a54952 a54953 a54954 a54955 a54956 a54957 a54958 a54959 a54960 a54961 a54962 a54963 a54964 a54965 a54966 a54967 a54968 a54969 a54970 a54971 a54972 a54973 a54974 a54975 a54976 a54977 a54978 a54979 a54980 a54981 a54982 a54983 a54984 a54985 a54986 a54987 a54988 a54989 a54990 a54991 a54992 a54993 a54994 a54995 a54996 a54997 a54998 a54999 a55000 a55001 a55002 a55003 a55004 a55005 a55006 a55007 a55008 a55009 a55010 a55011 a55012 a55013 a55014 a55015 a55016 a55017 a55018 a55019 a55020 a55021 a55022 a55023 a55024 a55025 a55026 a55027 a55028 a55029 a55030 a55031 a55032 a55033 a55034 a55035 a55036 a55037 a55038 a55039 a55040 a55041 a55042 a55043 a55044 a55045 a55046 a55047 a55048 a55049 a55050 a55051 a55052 a55053 a55054 a55055 a55056 a55057 a55058 a55059 a55060 a55061 a55062 a55063 a55064 a55065 a55066 a55067 a55068 a55069 a55070 a55071 a55072 a55073 a55074 a55075 a55076 a55077 a55078 a55079 a55080 a55081 a55082 a55083 a55084 a55085 a55086 a55087 a55088 a55089 a55090 a55091 a55092 a55093 a55094 a55095 a55096 a55097 a55098 a55099 a55100 a55101 a55102 a55103 a55104 a55105 a55106 a55107 a55108 a55109 a55110 a55111 a55112 a55113 a55114 a55115 a55116 a55117 a55118 a55119 a55120 a55121 a55122 a55123 a55124 a55125 a55126 a55127 a55128 a55129 a55130 a55131 a55132 a55133 a55134 a55135 a55136 a55137 a55138 a55139 a55140 a55141 a55142 a55143 a55144 a55145 a55146 a55147 a55148 a55149 a55150 a55151 a55152 a55153 a55154 a55155 a55156 a55157 a55158 a55159 a55160 a55161 a55162 a55163 a55164 a55165 a55166 a55167 a55168 a55169 a55170 a55171 a55172 a55173 a55174 a55175 a55176 a55177 a55178 a55179 a55180 a55181 a55182 a55183 a55184 a55185 a55186 a55187 a55188 a55189 a55190 a55191 a55192 a55193 a55194 a55195 a55196 a55197 a55198 a55199 a55200 a55201 a55202 a55203 a55204 a55205 a55206 a55207 a55208 a55209 a55210 a55211 a55212 a55213 a55214 a55215 a55216 a55217 a55218 a55219 a55220 a55221 a55222 a55223 a55224 a55225 a55226 a55227 a55228 a55229 a55230 a55231 a55232 a55233 a55234 a55235 a55236 a55237 a55238 a55239 a55240 a55241 a55242 a55243 a55244 a55245 a55246 a55247 a55248 a55249 a55250 a55251 a55252 a55253 a55254 a55255 a55256 a55257 a55258 a55259 a55260 a55261 a55262 a55263 a55264 a55265 a55266 a55267 a55268 a55269 a55270 a55271 a55272 a55273 a55274 a55275 a55276 a55277 a55278 a55279 a55280 a55281 a55282 a55283 a55284 a55285 a55286 a55287 a55288 a55289 a55290 a55291 a55292 a55293 a55294 a55295 a55296 a55297 a55298 a55299 a55300 a55301 a55302 a55303 a55304 a55305 a55306 a55307 a55308 a55309 a55310 a55311 a55312 a55313 a55314 a55315 a55316 a55317 a55318 a55319 a55320 a55321 a55322 a55323 a55324 a55325 a55326 a55327 a55328 a55329 a55330 a55331 a55332 a55333 a55334 a55335 a55336 a55337 a55338 a55339 a55340 a55341 a55342 a55343 a55344 a55345 a55346 a55347 a55348 a55349 a55350 a55351 a55352 a55353 a55354 a55355 a55356 a55357 a55358 a55359 a55360 a55361 a55362 a55363 a55364 a55365 a55366 a55367 a55368 a55369 a55370 a55371 a55372 a55373 a55374 a55375 a55376 a55377 a55378 a55379 a55380 a55381 a55382 a55383 a55384 a55385 a55386 a55387 a55388 a55389 a55390 a55391 a55392 a55393 a55394 a55395 a55396 a55397 a55398 a55399 a55400 a55401 a55402 a55403 a55404 a55405 a55406 a55407 a55408 a55409 a55410 a55411 a55412 a55413 a55414 a55415 a55416 a55417 a55418 a55419 a55420 a55421 a55422 a55423 a55424 a55425 a55426 a55427 a55428 a55429 a55430 a55431 a55432 a55433 a55434 a55435 a55436 a55437 a55438 a55439 a55440 a55441 a55442 a55443 a55444 a55445 a55446 a55447 a55448 a55449 a55450 a55451 a55452 a55453 a55454 a55455 a55456 a55457 a55458 a55459 a55460 a55461 a55462 a55463 a55464 a55465 a55466 a55467 a55468 a55469 a55470 a55471 a55472 a55473 a55474 a55475 a55476 a55477 a55478 a55479 a55480 a55481 a55482 a55483 a55484 a55485 a55486 a55487 a55488 a55489 a55490 a55491 a55492 a55493 a55494 a55495 a55496 a55497 a55498 a55499 a55500 a55501 a55502 a55503 a55504 a55505 a55506 a55507 a55508 a55509 a55510 a55511 a55512 a55513 a55514 a55515 a55516 a55517 a55518 a55519 a55520 a55521 a55522 a55523 a55524 a55525 a55526 a55527 a55528 a55529 a55530 a55531 a55532 a55533 a55534 a55535 a55536 a55537 a55538 a55539 a55540 a55541 a55542 a55543 a55544 a55545 a55546 a55547 a55548 a55549 a55550 a55551 a55552 a55553 a55554 a55555 a55556 a55557 a55558 a55559 a55560 a55561 a55562 a55563 a55564 a55565 a55566 a55567 a55568 a55569 a55570 a55571 a55572 a55573 a55574 a55575 a55576 a55577 a55578 a55579 a55580 a55581 a55582 a55583 a55584 a55585 a55586 a55587 a55588 a55589 a55590 a55591 a55592 a55593 a55594 a55595 a55596 a55597 a55598 a55599 a55600 a55601 a55602 a55603 a55604 a55605 a55606 a55607 a55608 a55609 a55610 a55611 a55612 a55613 a55614 a55615 a55616 a55617 a55618 a55619 a55620 a55621 a55622 a55623 a55624 a55625 a55626 a55627 a55628 a55629 a55630 a55631 a55632 a55633 a55634 a55635 a55636 a55637 a55638 a55639 a55640 a55641 a55642 a55643 a55644 a55645 a55646 a55647 a55648 a55649 a55650 a55651 a55652 a55653 a55654 a55655 a55656 a55657 a55658 a55659 a55660 a55661 a55662 a55663 a55664 a55665 a55666 a55667 a55668 a55669 a55670 a55671 a55672 a55673 a55674 a55675 a55676 a55677 a55678 a55679 a55680 a55681 a55682 a55683 a55684 a55685 a55686 a55687 a55688 a55689 a55690 a55691 a55692 a55693 a55694 a55695 a55696 a55697 a55698 a55699 a55700 a55701 a55702 a55703 a55704 a55705 a55706 a55707 a55708 a55709 a55710 a55711 a55712 a55713 a55714 a55715 a55716 a55717 a55718 a55719 a55720 a55721 a55722 a55723 a55724 a55725 a55726 a55727 a55728 a55729 a55730 a55731 a55732 a55733 a55734 a55735 a55736 a55737 a55738 a55739 a55740 a55741 a55742 a55743 a55744 a55745 a55746 a55747 a55748 a55749 a55750 a55751 a55752 a55753 a55754 a55755 a55756 a55757 a55758 a55759 a55760 a55761 a55762 a55763 a55764 a55765 a55766 a55767 a55768 a55769 a55770 a55771 a55772 a55773 a55774 a55775 a55776 a55777 a55778 a55779 a55780 a55781 a55782 a55783 a55784 a55785 a55786 a55787 a55788 a55789 a55790 a55791 a55792 a55793 a55794 a55795 a55796 a55797 a55798 a55799 a55800 a55801 a55802 a55803 a55804 a55805 a55806 a55807 a55808 a55809 a55810 a55811 a55812 a55813 a55814 a55815 a55816 a55817 a55818 a55819 a55820 a55821 a55822 a55823 a55824 a55825 a55826 a55827 a55828 a55829 a55830 a55831 a55832 a55833 a55834 a55835 a55836 a55837 a55838 a55839 a55840 a55841 a55842 a55843 a55844 a55845 a55846 a55847 a55848 a55849 a55850 a55851 a55852 a55853 a55854 a55855 a55856 a55857 a55858 a55859 a55860 a55861 a55862 a55863 a55864 a55865 a55866 a55867 a55868 a55869 a55870 a55871 a55872 a55873 a55874 a55875 a55876 a55877 a55878 a55879 a55880 a55881 a55882 a55883 a55884 a55885 a55886 a55887 a55888 a55889 a55890 a55891 a55892 a55893 a55894 a55895 a55896 a55897 a55898 a55899 a55900 a55901 a55902 a55903 a55904 a55905 a55906 a55907 a55908 a55909 a55910 a55911 a55912 a55913 a55914 a55915 a55916 a55917 a55918 a55919 a55920 a55921 a55922 a55923 a55924 a55925 a55926 a55927 a55928 a55929 a55930 a55931 a55932 a55933 a55934 a55935 a55936 a55937 a55938 a55939 a55940 a55941 a55942 a55943 a55944 a55945 a55946 a55947 a55948 a55949 a55950 a55951 a55952 a55953 a55954 a55955 a55956 a55957 a55958 a55959 a55960 a55961 a55962 a55963 a55964 a55965 a55966 a55967 a55968 a55969 a55970 a55971 a55972 a55973 a55974 a55975 a55976 a55977 a55978 a55979 a55980 a55981 a55982 a55983 a55984 a55985 a55986 a55987 a55988 a55989 a55990 a55991 a55992 a55993 a55994 a55995 a55996 a55997 a55998 a55999 a56000 a56001 a56002 a56003 a56004 a56005 a56006 a56007 a56008 a56009 a56010 a56011 a56012 a56013 a56014 a56015 a56016 a56017 a56018 a56019 a56020 a56021 a56022 a56023 a56024 a56025 a56026 a56027 a56028 a56029 a56030 a56031 a56032 a56033 a56034 a56035 a56036 a56037 a56038 a56039 a56040 a56041 a56042 a56043 a56044 a56045 a56046 a56047 a56048 a56049 a56050 a56051 a56052 a56053 a56054 a56055 a56056 a56057 a56058 a56059 a56060 a56061 a56062 a56063 a56064 a56065 a56066 a56067 a56068 a56069 a56070 a56071 a56072 a56073 a56074 a56075 a56076 a56077 a56078 a56079 a56080 a56081 a56082 a56083 a56084 a56085 a56086 a56087 a56088 a56089 a56090 a56091 a56092 a56093 a56094 a56095 a56096 a56097 a56098 a56099 a56100 a56101 a56102 a56103 a56104 a56105 a56106 a56107 a56108 a56109 a56110 a56111 a56112 a56113 a56114 a56115 a56116 a56117 a56118 a56119 a56120 a56121 a56122 a56123 a56124 a56125 a56126 a56127 a56128 a56129 a56130 a56131 a56132 a56133 a56134 a56135 a56136 a56137 a56138 a56139 a56140 a56141 a56142 a56143 a56144 a56145 a56146 a56147 a56148 a56149 a56150 a56151 a56152 a56153 a56154 a56155 a56156 a56157 a56158 a56159 a56160 a56161 a56162 a56163 a56164 a56165 a56166 a56167 a56168 a56169 a56170 a56171 a56172 a56173 a56174 a56175 a56176 a56177 a56178 a56179 a56180 a56181 a56182 a56183 a56184 a56185 a56186 a56187 a56188 a56189 a56190 a56191 a56192 a56193 a56194 a56195 a56196 a56197 a56198 a56199 a56200 a56201 a56202 a56203 a56204 a56205 a56206 a56207 a56208 a56209 a56210 a56211 a56212 a56213 a56214 a56215 a56216 a56217 a56218 a56219 a56220 a56221 a56222 a56223 a56224 a56225 a56226 a56227 a56228 a56229 a56230 a56231 a56232 a56233 a56234 a56235 a56236 a56237 a56238 a56239 a56240 a56241 a56242 a56243 a56244 a56245 a56246 a56247 a56248 a56249 a56250 a56251 a56252 a56253 a56254 a56255 a56256 a56257 a56258 a56259 a56260 a56261 a56262 a56263 a56264 a56265 a56266 a56267 a56268 a56269 a56270 a56271 a56272 a56273 a56274 a56275 a56276 a56277 a56278 a56279 a56280 a56281 a56282 a56283 a56284 a56285 a56286 a56287 a56288 a56289 a56290 a56291 a56292 a56293 a56294 a56295 a56296 a56297 a56298 a56299 a56300 a56301 a56302 a56303 a56304 a56305 a56306 a56307 a56308 a56309 a56310 a56311 a56312 a56313 a56314 a56315 a56316 a56317 a56318 a56319 a56320 a56321 a56322 a56323 a56324 a56325 a56326 a56327 a56328 a56329 a56330 a56331 a56332 a56333 a56334 a56335 a56336 a56337 a56338 a56339 a56340 a56341 a56342 a56343 a56344 a56345 a56346 a56347 a56348 a56349 a56350 a56351 a56352 a56353 a56354 a56355 a56356 a56357 a56358 a56359 a56360 a56361 a56362 a56363 a56364 a56365 a56366 a56367 a56368 a56369 a56370 a56371 a56372 a56373 a56374 a56375 a56376 a56377 a56378 a56379 a56380 a56381 a56382 a56383 a56384 a56385 a56386 a56387 a56388 a56389 a56390 a56391 a56392 a56393 a56394 a56395 a56396 a56397 a56398 a56399 a56400 a56401 a56402 a56403 a56404 a56405 a56406 a56407 a56408 a56409 a56410 a56411 a56412 a56413 a56414 a56415 a56416 a56417 a56418 a56419 a56420 a56421 a56422 a56423 a56424 a56425 a56426 a56427 a56428 a56429 a56430 a56431 a56432 a56433 a56434 a56435 a56436 a56437 a56438 a56439 a56440 a56441 a56442 a56443 a56444 a56445 a56446 a56447 a56448 a56449 a56450 a56451 a56452 a56453 a56454 a56455 a56456 a56457 a56458 a56459 a56460 a56461 a56462 a56463 a56464 a56465 a56466 a56467 a56468 a56469 a56470 a56471 a56472 a56473 a56474 a56475 a56476 a56477 a56478 a56479 a56480 a56481 a56482 a56483 a56484 a56485 a56486 a56487 a56488 a56489 a56490 a56491 a56492 a56493 a56494 a56495 a56496 a56497 a56498 a56499 a56500 a56501 a56502 a56503 a56504 a56505 a56506 a56507 a56508 a56509 a56510 a56511 a56512 a56513 a56514 a56515 a56516 a56517 a56518 a56519 a56520 a56521 a56522 a56523 a56524 a56525 a56526 a56527 a56528 a56529 a56530 a56531 a56532 a56533 a56534 a56535 a56536 a56537 a56538 a56539 a56540 a56541 a56542 a56543 a56544 a56545 a56546 a56547 a56548 a56549 a56550 a56551 a56552 a56553 a56554 a56555 a56556 a56557 a56558 a56559 a56560 a56561 a56562 a56563 a56564 a56565 a56566 a56567 a56568 a56569 a56570 a56571 a56572 a56573 a56574 a56575 a56576 a56577 a56578 a56579 a56580 a56581 a56582 a56583 a56584 a56585 a56586 a56587 a56588 a56589 a56590 a56591 a56592 a56593 a56594 a56595 a56596 a56597 a56598 a56599 a56600 a56601 a56602 a56603 a56604 a56605 a56606 a56607 a56608 a56609 a56610 a56611 a56612 a56613 a56614 a56615 a56616 a56617 a56618 a56619 a56620 a56621 a56622 a56623 a56624 a56625 a56626 a56627 a56628 a56629 a56630 a56631 a56632 a56633 a56634 a56635 a56636 a56637 a56638 a56639 a56640 a56641 a56642 a56643 a56644 a56645 a56646 a56647 a56648 a56649 a56650 a56651 a56652 a56653 a56654 a56655 a56656 a56657 a56658 a56659 a56660 a56661 a56662 a56663 a56664 a56665 a56666 a56667 a56668 a56669 a56670 a56671 a56672 a56673 a56674 a56675 a56676 a56677 a56678 a56679 a56680 a56681 a56682 a56683 a56684 a56685 a56686 a56687 a56688 a56689 a56690 a56691 a56692 a56693 a56694 a56695 a56696 a56697 a56698 a56699 a56700 a56701 a56702 a56703 a56704 a56705 a56706 a56707 a56708 a56709 a56710 a56711 a56712 a56713 a56714 a56715 a56716 a56717 a56718 a56719 a56720 a56721 a56722 a56723 a56724 a56725 a56726 a56727 a56728 a56729 a56730 a56731 a56732 a56733 a56734 a56735 a56736 a56737 a56738 a56739 a56740 a56741 a56742 a56743 a56744 a56745 a56746 a56747 a56748 a56749 a56750 a56751 a56752 a56753 a56754 a56755 a56756 a56757 a56758 a56759 a56760 a56761 a56762 a56763 a56764 a56765 a56766 a56767 a56768 a56769 a56770 a56771 a56772 a56773 a56774 a56775 a56776 a56777 a56778 a56779 a56780 a56781 a56782 a56783 a56784 a56785 a56786 a56787 a56788 a56789 a56790 a56791 a56792 a56793 a56794 a56795 a56796 a56797 a56798 a56799 a56800 a56801 a56802 a56803 a56804 a56805 a56806 a56807 a56808 a56809 a56810 a56811 a56812 a56813 a56814 a56815 a56816 a56817 a56818 a56819 a56820 a56821 a56822 a56823 a56824 a56825 a56826 a56827 a56828 a56829 a56830 a56831 a56832 a56833 a56834 a56835 a56836 a56837 a56838 a56839 a56840 a56841 a56842 a56843 a56844 a56845 a56846 a56847 a56848 a56849 a56850 a56851 a56852 a56853 a56854 a56855 a56856 a56857 a56858 a56859 a56860 a56861 a56862 a56863 a56864 a56865 a56866 a56867 a56868 a56869 a56870 a56871 a56872 a56873 a56874 a56875 a56876 a56877 a56878 a56879 a56880 a56881 a56882 a56883 a56884 a56885 a56886 a56887 a56888 a56889 a56890 a56891 a56892 a56893 a56894 a56895 a56896 a56897 a56898 a56899 a56900 a56901 a56902 a56903 a56904 a56905 a56906 a56907 a56908 a56909 a56910 a56911 a56912 a56913 a56914 a56915 a56916 a56917 a56918 a56919 a56920 a56921 a56922 a56923 a56924 a56925 a56926 a56927 a56928 a56929 a56930 a56931 a56932 a56933 a56934 a56935 a56936 a56937 a56938 a56939 a56940 a56941 a56942 a56943 a56944 a56945 a56946 a56947 a56948 a56949 a56950 a56951 a56952 a56953 a56954 a56955 a56956 a56957 a56958 a56959 a56960 a56961 a56962 a56963 a56964 a56965 a56966 a56967 a56968 a56969 a56970 a56971 a56972 a56973 a56974 a56975 a56976 a56977 a56978 a56979 a56980 a56981 a56982 a56983 a56984 a56985 a56986 a56987 a56988 a56989 a56990 a56991 a56992 a56993 a56994 a56995 a56996 a56997 a56998 a56999 a57000 a57001 a57002 a57003 a57004 a57005 a57006 a57007 a57008 a57009 a57010 a57011 a57012 a57013 a57014 a57015 a57016 a57017 a57018 a57019 a57020 a57021 a57022 a57023 a57024 a57025 a57026 a57027 a57028 a57029 a57030 a57031 a57032 a57033 a57034 a57035 a57036 a57037 a57038 a57039 a57040 a57041 a57042 a57043 a57044 a57045 a57046 a57047 a57048 a57049 a57050 a57051 a57052 a57053 a57054 a57055 a57056 a57057 a57058 a57059 a57060 a57061 a57062 a57063 a57064 a57065 a57066 a57067 a57068 a57069 a57070 a57071 a57072 a57073 a57074 a57075 a57076 a57077 a57078 a57079 a57080 a57081 a57082 a57083 a57084 a57085 a57086 a57087 a57088 a57089 a57090 a57091 a57092 a57093 a57094 a57095 a57096 a57097 a57098 a57099 a57100 a57101 a57102 a57103 a57104 a57105 a57106 a57107 a57108 a57109 a57110 a57111 a57112 a57113 a57114 a57115 a57116 a57117 a57118 a57119 a57120 a57121 a57122 a57123 a57124 a57125 a57126 a57127 a57128 a57129 a57130 a57131 a57132 a57133 a57134 a57135 a57136 a57137 a57138 a57139 a57140 a57141 a57142 a57143 a57144 a57145 a57146 a57147 a57148 a57149 a57150 a57151 a57152 a57153 a57154 a57155 a57156 a57157 a57158 a57159 a57160 a57161 a57162 a57163 a57164 a57165 a57166 a57167 a57168 a57169 a57170 a57171 a57172 a57173 a57174 a57175 a57176 a57177 a57178 a57179 a57180 a57181 a57182 a57183 a57184 a57185 a57186 a57187 a57188 a57189 a57190 a57191 a57192 a57193 a57194 a57195 a57196 a57197 a57198 a57199 a57200 a57201 a57202 a57203 a57204 a57205 a57206 a57207 a57208 a57209 a57210 a57211 a57212 a57213 a57214 a57215 a57216 a57217 a57218 a57219 a57220 a57221 a57222 a57223 a57224 a57225 a57226 a57227 a57228 a57229 a57230 a57231 a57232 a57233 a57234 a57235 a57236 a57237 a57238 a57239 a57240 a57241 a57242 a57243 a57244 a57245 a57246 a57247 a57248 a57249 a57250 a57251 a57252 a57253 a57254 a57255 a57256 a57257 a57258 a57259 a57260 a57261 a57262 a57263 a57264 a57265 a57266 a57267 a57268 a57269 a57270 a57271 a57272 a57273 a57274 a57275 a57276 a57277 a57278 a57279 a57280 a57281 a57282 a57283 a57284 a57285 a57286 a57287 a57288 a57289 a57290 a57291 a57292 a57293 a57294 a57295 a57296 a57297 a57298 a57299 a57300 a57301 a57302 a57303 a57304 a57305 a57306 a57307 a57308 a57309 a57310 a57311 a57312 a57313 a57314 a57315 a57316 a57317 a57318 a57319 a57320 a57321 a57322 a57323 a57324 a57325 a57326 a57327 a57328 a57329 a57330 a57331 a57332 a57333 a57334 a57335 a57336 a57337 a57338 a57339 a57340 a57341 a57342 a57343 a57344 a57345 a57346 a57347 a57348 a57349 a57350 a57351 a57352 a57353 a57354 a57355 a57356 a57357 a57358 a57359 a57360 a57361 a57362 a57363 a57364 a57365 a57366 a57367 a57368 a57369 a57370 a57371 a57372 a57373 a57374 a57375 a57376 a57377 a57378 a57379 a57380 a57381 a57382 a57383 a57384 a57385 a57386 a57387 a57388 a57389 a57390 a57391 a57392 a57393 a57394 a57395 a57396 a57397 a57398 a57399 a57400 a57401 a57402 a57403 a57404 a57405 a57406 a57407 a57408 a57409 a57410 a57411 a57412 a57413 a57414 a57415 a57416 a57417 a57418 a57419 a57420 a57421 a57422 a57423 a57424 a57425 a57426 a57427 a57428 a57429 a57430 a57431 a57432 a57433 a57434 a57435 a57436 a57437 a57438 a57439 a57440 a57441 a57442 a57443 a57444 a57445 a57446 a57447 a57448 a57449 a57450 a57451 a57452 a57453 a57454 a57455 a57456 a57457 a57458 a57459 a57460 a57461 a57462 a57463 a57464 a57465 a57466 a57467 a57468 a57469 a57470 a57471 a57472 a57473 a57474 a57475 a57476 a57477 a57478 a57479 a57480 a57481 a57482 a57483 a57484 a57485 a57486 a57487 a57488 a57489 a57490 a57491 a57492 a57493 a57494 a57495 a57496 a57497 a57498 a57499 a57500 a57501 a57502 a57503 a57504 a57505 a57506 a57507 a57508 a57509 a57510 a57511 a57512 a57513 a57514 a57515 a57516 a57517 a57518 a57519 a57520 a57521 a57522 a57523 a57524 a57525 a57526 a57527 a57528 a57529 a57530 a57531 a57532 a57533 a57534 a57535 a57536 a57537 a57538 a57539 a57540 a57541 a57542 a57543 a57544 a57545 a57546 a57547 a57548 a57549 a57550 a57551 a57552 a57553 a57554 a57555 a57556 a57557 a57558 a57559 a57560 a57561 a57562 a57563 a57564 a57565 a57566 a57567 a57568 a57569 a57570 a57571 a57572 a57573 a57574 a57575 a57576 a57577 a57578 a57579 a57580 a57581 a57582 a57583 a57584 a57585 a57586 a57587 a57588 a57589 a57590 a57591 a57592 a57593 a57594 a57595 a57596 a57597 a57598 a57599 a57600 a57601 a57602 a57603 a57604 a57605 a57606 a57607 a57608 a57609 a57610 a57611 a57612 a57613 a57614 a57615 a57616 a57617 a57618 a57619 a57620 a57621 a57622 a57623 a57624 a57625 a57626 a57627 a57628 a57629 a57630 a57631 a57632 a57633 a57634 a57635 a57636 a57637 a57638 a57639 a57640 a57641 a57642 a57643 a57644 a57645 a57646 a57647 a57648 a57649 a57650 a57651 a57652 a57653 a57654 a57655 a57656 a57657 a57658 a57659 a57660 a57661 a57662 a57663 a57664 a57665 a57666 a57667 a57668 a57669 a57670 a57671 a57672 a57673 a57674 a57675 a57676 a57677 a57678 a57679 a57680 a57681 a57682 a57683 a57684 a57685 a57686 a57687 a57688 a57689 a57690 a57691 a57692 a57693 a57694 a57695 a57696 a57697 a57698 a57699 a57700 a57701 a57702 a57703 a57704 a57705 a57706 a57707 a57708 a57709 a57710 a57711 a57712 a57713 a57714 a57715 a57716 a57717 a57718 a57719 a57720 a57721 a57722 a57723 a57724 a57725 a57726 a57727 a57728 a57729 a57730 a57731 a57732 a57733 a57734 a57735 a57736 a57737 a57738 a57739 a57740 a57741 a57742 a57743 a57744 a57745 a57746 a57747 a57748 a57749 a57750 a57751 a57752 a57753 a57754 a57755 a57756 a57757 a57758 a57759 a57760 a57761 a57762 a57763 a57764 a57765 a57766 a57767 a57768 a57769 a57770 a57771 a57772 a57773 a57774 a57775 a57776 a57777 a57778 a57779 a57780 a57781 a57782 a57783 a57784 a57785 a57786 a57787 a57788 a57789 a57790 a57791 a57792 a57793 a57794 a57795 a57796 a57797 a57798 a57799 a57800 a57801 a57802 a57803 a57804 a57805 a57806 a57807 a57808 a57809 a57810 a57811 a57812 a57813 a57814 a57815 a57816 a57817 a57818 a57819 a57820 a57821 a57822 a57823 a57824 a57825 a57826 a57827 a57828 a57829 a57830 a57831 a57832 a57833 a57834 a57835 a57836 a57837 a57838 a57839 a57840 a57841 a57842 a57843 a57844 a57845 a57846 a57847 a57848 a57849 a57850 a57851 a57852 a57853 a57854 a57855 a57856 a57857 a57858 a57859 a57860 a57861 a57862 a57863 a57864 a57865 a57866 a57867 a57868 a57869 a57870 a57871 a57872 a57873 a57874 a57875 a57876 a57877 a57878 a57879 a57880 a57881 a57882 a57883 a57884 a57885 a57886 a57887 a57888 a57889 a57890 a57891 a57892 a57893 a57894 a57895 a57896 a57897 a57898 a57899 a57900 a57901 a57902 a57903 a57904 a57905 a57906 a57907 a57908 a57909 a57910 a57911 a57912 a57913 a57914 a57915 a57916 a57917 a57918 a57919 a57920 a57921 a57922 a57923 a57924 a57925 a57926 a57927 a57928 a57929 a57930 a57931 a57932 a57933 a57934 a57935 a57936 a57937 a57938 a57939 a57940 a57941 a57942 a57943 a57944 a57945 a57946 a57947 a57948 a57949 a57950 a57951 a57952 a57953 a57954 a57955 a57956 a57957 a57958 a57959 a57960 a57961 a57962 a57963 a57964 a57965 a57966 a57967 a57968 a57969 a57970 a57971 a57972 a57973 a57974 a57975 a57976 a57977 a57978 a57979 a57980 a57981 a57982 a57983 a57984 a57985 a57986 a57987 a57988 a57989 a57990 a57991 a57992 a57993 a57994 a57995 a57996 a57997 a57998 a57999 a58000 a58001 a58002 a58003 a58004 a58005 a58006 a58007 a58008 a58009 a58010 a58011 a58012 a58013 a58014 a58015 a58016 a58017 a58018 a58019 a58020 a58021 a58022 a58023 a58024 a58025 a58026 a58027 a58028 a58029 a58030 a58031 a58032 a58033 a58034 a58035 a58036 a58037 a58038 a58039 a58040 a58041 a58042 a58043 a58044 a58045 a58046 a58047 a58048 a58049 a58050 a58051 a58052 a58053 a58054 a58055 a58056 a58057 a58058 a58059 a58060 a58061 a58062 a58063 a58064 a58065 a58066 a58067 a58068 a58069 a58070 a58071 a58072 a58073 a58074 a58075 a58076 a58077 a58078 a58079 a58080 a58081 a58082 a58083 a58084 a58085 a58086 a58087 a58088 a58089 a58090 a58091 a58092 a58093 a58094 a58095 a58096 a58097 a58098 a58099 a58100 a58101 a58102 a58103 a58104 a58105 a58106 a58107 a58108 a58109 a58110 a58111 a58112 a58113 a58114 a58115 a58116 a58117 a58118 a58119 a58120 a58121 a58122 a58123 a58124 a58125 a58126 a58127 a58128 a58129 a58130 a58131 a58132 a58133 a58134 a58135 a58136 a58137 a58138 a58139 a58140 a58141 a58142 a58143 a58144 a58145 a58146 a58147 a58148 a58149 a58150 a58151 a58152 a58153 a58154 a58155 a58156 a58157 a58158 a58159 a58160 a58161 a58162 a58163 a58164 a58165 a58166 a58167 a58168 a58169 a58170 a58171 a58172 a58173 a58174 a58175 a58176 a58177 a58178 a58179 a58180 a58181 a58182 a58183 a58184 a58185 a58186 a58187 a58188 a58189 a58190 a58191 a58192 a58193 a58194 a58195 a58196 a58197 a58198 a58199 a58200 a58201 a58202 a58203 a58204 a58205 a58206 a58207 a58208 a58209 a58210 a58211 a58212 a58213 a58214 a58215 a58216 a58217 a58218 a58219 a58220 a58221 a58222 a58223 a58224 a58225 a58226 a58227 a58228 a58229 a58230 a58231 a58232 a58233 a58234 a58235 a58236 a58237 a58238 a58239 a58240 a58241 a58242 a58243 a58244 a58245 a58246 a58247 a58248 a58249 a58250 a58251 a58252 a58253 a58254 a58255 a58256 a58257 a58258 a58259 a58260 a58261 a58262 a58263 a58264 a58265 a58266 a58267 a58268 a58269 a58270 a58271 a58272 a58273 a58274 a58275 a58276 a58277 a58278 a58279 a58280 a58281 a58282 a58283 a58284 a58285 a58286 a58287 a58288 a58289 a58290 a58291 a58292 a58293 a58294 a58295 a58296 a58297 a58298 a58299 a58300 a58301 a58302 a58303 a58304 a58305 a58306 a58307 a58308 a58309 a58310 a58311 a58312 a58313 a58314 a58315 a58316 a58317 a58318 a58319 a58320 a58321 a58322 a58323 a58324 a58325 a58326 a58327 a58328 a58329 a58330 a58331 a58332 a58333 a58334 a58335 a58336 a58337 a58338 a58339 a58340 a58341 a58342 a58343 a58344 a58345 a58346 a58347 a58348 a58349 a58350 a58351 a58352 a58353 a58354 a58355 a58356 a58357 a58358 a58359 a58360 a58361 a58362 a58363 a58364 a58365 a58366 a58367 a58368 a58369 a58370 a58371 a58372 a58373 a58374 a58375 a58376 a58377 a58378 a58379 a58380 a58381 a58382 a58383 a58384 a58385 a58386 a58387 a58388 a58389 a58390 a58391 a58392 a58393 a58394 a58395 a58396 a58397 a58398 a58399 a58400 a58401 a58402 a58403 a58404 a58405 a58406 a58407 a58408 a58409 a58410 a58411 a58412 a58413 a58414 a58415 a58416 a58417 a58418 a58419 a58420 a58421 a58422 a58423 a58424 a58425 a58426 a58427 a58428 a58429 a58430 a58431 a58432 a58433 a58434 a58435 a58436 a58437 a58438 a58439 a58440 a58441 a58442 a58443 a58444 a58445 a58446 a58447 a58448 a58449 a58450 a58451 a58452 a58453 a58454 a58455 a58456 a58457 a58458 a58459 a58460 a58461 a58462 a58463 a58464 a58465 a58466 a58467 a58468 a58469 a58470 a58471 a58472 a58473 a58474 a58475 a58476 a58477 a58478 a58479 a58480 a58481 a58482 a58483 a58484 a58485 a58486 a58487 a58488 a58489 a58490 a58491 a58492 a58493 a58494 a58495 a58496 a58497 a58498 a58499 a58500 a58501 a58502 a58503 a58504 a58505 a58506 a58507 a58508 a58509 a58510 a58511 a58512 a58513 a58514 a58515 a58516 a58517 a58518 a58519 a58520 a58521 a58522 a58523 a58524 a58525 a58526 a58527 a58528 a58529 a58530 a58531 a58532 a58533 a58534 a58535 a58536 a58537 a58538 a58539 a58540 a58541 a58542 a58543 a58544 a58545 a58546 a58547 a58548 a58549 a58550 a58551 a58552 a58553 a58554 a58555 a58556 a58557 a58558 a58559 a58560 a58561 a58562 a58563 a58564 a58565 a58566 a58567 a58568 a58569 a58570 a58571 a58572 a58573 a58574 a58575 a58576 a58577 a58578 a58579 a58580 a58581 a58582 a58583 a58584 a58585 a58586 a58587 a58588 a58589 a58590 a58591 a58592 a58593 a58594 a58595 a58596 a58597 a58598 a58599 a58600 a58601 a58602 a58603 a58604 a58605 a58606 a58607 a58608 a58609 a58610 a58611 a58612 a58613 a58614 a58615 a58616 a58617 a58618 a58619 a58620 a58621 a58622 a58623 a58624 a58625 a58626 a58627 a58628 a58629 a58630 a58631 a58632 a58633 a58634 a58635 a58636 a58637 a58638 a58639 a58640 a58641 a58642 a58643 a58644 a58645 a58646 a58647 a58648 a58649 a58650 a58651 a58652 a58653 a58654 a58655 a58656 a58657 a58658 a58659 a58660 a58661 a58662 a58663 a58664 a58665 a58666 a58667 a58668 a58669 a58670 a58671 a58672 a58673 a58674 a58675 a58676 a58677 a58678 a58679 a58680 a58681 a58682 a58683 a58684 a58685 a58686 a58687 a58688 a58689 a58690 a58691 a58692 a58693 a58694 a58695 a58696 a58697 a58698 a58699 a58700 a58701 a58702 a58703 a58704 a58705 a58706 a58707 a58708 a58709 a58710 a58711 a58712 a58713 a58714 a58715 a58716 a58717 a58718 a58719 a58720 a58721 a58722 a58723 a58724 a58725 a58726 a58727 a58728 a58729 a58730 a58731 a58732 a58733 a58734 a58735 a58736 a58737 a58738 a58739 a58740 a58741 a58742 a58743 a58744 a58745 a58746 a58747 a58748 a58749 a58750 a58751 a58752 a58753 a58754 a58755 a58756 a58757 a58758 a58759 a58760 a58761 a58762 a58763 a58764 a58765 a58766 a58767 a58768 a58769 a58770 a58771 a58772 a58773 a58774 a58775 a58776 a58777 a58778 a58779 a58780 a58781 a58782 a58783 a58784 a58785 a58786 a58787 a58788 a58789 a58790 a58791 a58792 a58793 a58794 a58795 a58796 a58797 a58798 a58799 a58800 a58801 a58802 a58803 a58804 a58805 a58806 a58807 a58808 a58809 a58810 a58811 a58812 a58813 a58814 a58815 a58816 a58817 a58818 a58819 a58820 a58821 a58822 a58823 a58824 a58825 a58826 a58827 a58828 a58829 a58830 a58831 a58832 a58833 a58834 a58835 a58836 a58837 a58838 a58839 a58840 a58841 a58842 a58843 a58844 a58845 a58846 a58847 a58848 a58849 a58850 a58851 a58852 a58853 a58854 a58855 a58856 a58857 a58858 a58859 a58860 a58861 a58862 a58863 a58864 a58865 a58866 a58867 a58868 a58869 a58870 a58871 a58872 a58873 a58874 a58875 a58876 a58877 a58878 a58879 a58880 a58881 a58882 a58883 a58884 a58885 a58886 a58887 a58888 a58889 a58890 a58891 a58892 a58893 a58894 a58895 a58896 a58897 a58898 a58899 a58900 a58901 a58902 a58903 a58904 a58905 a58906 a58907 a58908 a58909 a58910 a58911 a58912 a58913 a58914 a58915 a58916 a58917 a58918 a58919 a58920 a58921 a58922 a58923 a58924 a58925 a58926 a58927 a58928 a58929 a58930 a58931 a58932 a58933 a58934 a58935 a58936 a58937 a58938 a58939 a58940 a58941 a58942 a58943 a58944 a58945 a58946 a58947 a58948 a58949 a58950 a58951 a58952 a58953 a58954 a58955 a58956 a58957 a58958 a58959 a58960 a58961 a58962 a58963 a58964 a58965 a58966 a58967 a58968 a58969 a58970 a58971 a58972 a58973 a58974 a58975 a58976 a58977 a58978 a58979 a58980 a58981 a58982 a58983 a58984 a58985 a58986 a58987 a58988 a58989 a58990 a58991 a58992 a58993 a58994 a58995 a58996 a58997 a58998 a58999 a59000 a59001 a59002 a59003 a59004 a59005 a59006 a59007 a59008 a59009 a59010 a59011 a59012 a59013 a59014 a59015 a59016 a59017 a59018 a59019 a59020 a59021 a59022 a59023 a59024 a59025 a59026 a59027 a59028 a59029 a59030 a59031 a59032 a59033 a59034 a59035 a59036 a59037 a59038 a59039 a59040 a59041 a59042 a59043 a59044 a59045 a59046 a59047 a59048 a59049 a59050 a59051 a59052 a59053 a59054 a59055 a59056 a59057 a59058 a59059 a59060 a59061 a59062 a59063 a59064 a59065 a59066 a59067 a59068 a59069 a59070 a59071 a59072 a59073 a59074 a59075 a59076 a59077 a59078 a59079 a59080 a59081 a59082 a59083 a59084 a59085 a59086 a59087 a59088 a59089 a59090 a59091 a59092 a59093 a59094 a59095 a59096 a59097 a59098 a59099 a59100 a59101 a59102 a59103 a59104 a59105 a59106 a59107 a59108 a59109 a59110 a59111 a59112 a59113 a59114 a59115 a59116 a59117 a59118 a59119 a59120 a59121 a59122 a59123 a59124 a59125 a59126 a59127 a59128 a59129 a59130 a59131 a59132 a59133 a59134 a59135 a59136 a59137 a59138 a59139 a59140 a59141 a59142 a59143 a59144 a59145 a59146 a59147 a59148 a59149 a59150 a59151 a59152 a59153 a59154 a59155 a59156 a59157 a59158 a59159 a59160 a59161 a59162 a59163 a59164 a59165 a59166 a59167 a59168 a59169 a59170 a59171 a59172 a59173 a59174 a59175 a59176 a59177 a59178 a59179 a59180 a59181 a59182 a59183 a59184 a59185 a59186 a59187 a59188 a59189 a59190 a59191 a59192 a59193 a59194 a59195 a59196 a59197 a59198 a59199 a59200 a59201 a59202 a59203 a59204 a59205 a59206 a59207 a59208 a59209 a59210 a59211 a59212 a59213 a59214 a59215 a59216 a59217 a59218 a59219 a59220 a59221 a59222 a59223 a59224 a59225 a59226 a59227 a59228 a59229 a59230 a59231 a59232 a59233 a59234 a59235 a59236 a59237 a59238 a59239 a59240 a59241 a59242 a59243 a59244 a59245 a59246 a59247 a59248 a59249 a59250 a59251 a59252 a59253 a59254 a59255 a59256 a59257 a59258 a59259 a59260 a59261 a59262 a59263 a59264 a59265 a59266 a59267 a59268 a59269 a59270 a59271 a59272 a59273 a59274 a59275 a59276 a59277 a59278 a59279 a59280 a59281 a59282 a59283 a59284 a59285 a59286 a59287 a59288 a59289 a59290 a59291 a59292 a59293 a59294 a59295 a59296 a59297 a59298 a59299 a59300 a59301 a59302 a59303 a59304 a59305 a59306 a59307 a59308 a59309 a59310 a59311 a59312 a59313 a59314 a59315 a59316 a59317 a59318 a59319 a59320 a59321 a59322 a59323 a59324 a59325 a59326 a59327 a59328 a59329 a59330 a59331 a59332 a59333 a59334 a59335 a59336 a59337 a59338 a59339 a59340 a59341 a59342 a59343 a59344 a59345 a59346 a59347 a59348 a59349 a59350 a59351 a59352 a59353 a59354 a59355 a59356 a59357 a59358 a59359 a59360 a59361 a59362 a59363 a59364 a59365 a59366 a59367 a59368 a59369 a59370 a59371 a59372 a59373 a59374 a59375 a59376 a59377 a59378 a59379 a59380 a59381 a59382 a59383 a59384 a59385 a59386 a59387 a59388 a59389 a59390 a59391 a59392 a59393 a59394 a59395 a59396 a59397 a59398 a59399 a59400 a59401 a59402 a59403 a59404 a59405 a59406 a59407 a59408 a59409 a59410 a59411 a59412 a59413 a59414 a59415 a59416 a59417 a59418 a59419 a59420 a59421 a59422 a59423 a59424 a59425 a59426 a59427 a59428 a59429 a59430 a59431 a59432 a59433 a59434 a59435 a59436 a59437 a59438 a59439 a59440 a59441 a59442 a59443 a59444 a59445 a59446 a59447 a59448 a59449 a59450 a59451 a59452 a59453 a59454 a59455 a59456 a59457 a59458 a59459 a59460 a59461 a59462 a59463 a59464 a59465 a59466 a59467 a59468 a59469 a59470 a59471 a59472 a59473 a59474 a59475 a59476 a59477 a59478 a59479 a59480 a59481 a59482 a59483 a59484 a59485 a59486 a59487 a59488 a59489 a59490 a59491 a59492 a59493 a59494 a59495 a59496 a59497 a59498 a59499 a59500 a59501 a59502 a59503 a59504 a59505 a59506 a59507 a59508 a59509 a59510 a59511 a59512 a59513 a59514 a59515 a59516 a59517 a59518 a59519 a59520 a59521 a59522 a59523 a59524 a59525 a59526 a59527 a59528 a59529 a59530 a59531 a59532 a59533 a59534 a59535 a59536 a59537 a59538 a59539 a59540 a59541 a59542 a59543 a59544 a59545 a59546 a59547 a59548 a59549 a59550 a59551 a59552 a59553 a59554 a59555 a59556 a59557 a59558 a59559 a59560 a59561 a59562 a59563 a59564 a59565 a59566 a59567 a59568 a59569 a59570 a59571 a59572 a59573 a59574 a59575 a59576 a59577 a59578 a59579 a59580 a59581 a59582 a59583 a59584 a59585 a59586 a59587 a59588 a59589 a59590 a59591 a59592 a59593 a59594 a59595 a59596 a59597 a59598 a59599 a59600 a59601 a59602 a59603 a59604 a59605 a59606 a59607 a59608 a59609 a59610 a59611 a59612 a59613 a59614 a59615 a59616 a59617 a59618 a59619 a59620 a59621 a59622 a59623 a59624 a59625 a59626 a59627 a59628 a59629 a59630 a59631 a59632 a59633 a59634 a59635 a59636 a59637 a59638 a59639 a59640 a59641 a59642 a59643 a59644 a59645 a59646 a59647 a59648 a59649 a59650 a59651 a59652 a59653 a59654 a59655 a59656 a59657 a59658 a59659 a59660 a59661 a59662 a59663 a59664 a59665 a59666 a59667 a59668 a59669 a59670 a59671 a59672 a59673 a59674 a59675 a59676 a59677 a59678 a59679 a59680 a59681 a59682 a59683 a59684 a59685 a59686 a59687 a59688 a59689 a59690 a59691 a59692 a59693 a59694 a59695 a59696 a59697 a59698 a59699 a59700 a59701 a59702 a59703 a59704 a59705 a59706 a59707 a59708 a59709 a59710 a59711 a59712 a59713 a59714 a59715 a59716 a59717 a59718 a59719 a59720 a59721 a59722 a59723 a59724 a59725 a59726 a59727 a59728 a59729 a59730 a59731 a59732 a59733 a59734 a59735 a59736 a59737 a59738 a59739 a59740 a59741 a59742 a59743 a59744 a59745 a59746 a59747 a59748 a59749 a59750 a59751 a59752 a59753 a59754 a59755 a59756 a59757 a59758 a59759 a59760 a59761 a59762 a59763 a59764 a59765 a59766 a59767 a59768 a59769 a59770 a59771 a59772 a59773 a59774 a59775 a59776 a59777 a59778 a59779 a59780 a59781 a59782 a59783 a59784 a59785 a59786 a59787 a59788 a59789 a59790 a59791 a59792 a59793 a59794 a59795 a59796 a59797 a59798 a59799 a59800 a59801 a59802 a59803 a59804 a59805 a59806 a59807 a59808 a59809 a59810 a59811 a59812 a59813 a59814 a59815 a59816 a59817 a59818 a59819 a59820 a59821 a59822 a59823 a59824 a59825 a59826 a59827 a59828 a59829 a59830 a59831 a59832 a59833 a59834 a59835 a59836 a59837 a59838 a59839 a59840 a59841 a59842 a59843 a59844 a59845 a59846 a59847 a59848 a59849 a59850 a59851 a59852 a59853 a59854 a59855 a59856 a59857 a59858 a59859 a59860 a59861 a59862 a59863 a59864 a59865 a59866 a59867 a59868 a59869 a59870 a59871 a59872 a59873 a59874 a59875 a59876 a59877 a59878 a59879 a59880 a59881 a59882 a59883 a59884 a59885 a59886 a59887 a59888 a59889 a59890 a59891 a59892 a59893 a59894 a59895 a59896 a59897 a59898 a59899 a59900 a59901 a59902 a59903 a59904 a59905 a59906 a59907 a59908 a59909 a59910 a59911 a59912 a59913 a59914 a59915 a59916 a59917 a59918 a59919 a59920 a59921 a59922 a59923 a59924 a59925 a59926 a59927 a59928 a59929 a59930 a59931 a59932 a59933 a59934 a59935 a59936 a59937 a59938 a59939 a59940 a59941 a59942 a59943 a59944 a59945 a59946 a59947 a59948 a59949 a59950 a59951 a59952 a59953 a59954 a59955 a59956 a59957 a59958 a59959 a59960 a59961 a59962 a59963 a59964 a59965 a59966 a59967 a59968 a59969 a59970 a59971 a59972 a59973 a59974 a59975 a59976 a59977 a59978 a59979 a59980 a59981 a59982 a59983 a59984 a59985 a59986 a59987 a59988 a59989 a59990 a59991 a59992 a59993 a59994 a59995 a59996 a59997 a59998 a59999 a60000 a60001 a60002 a60003 a60004 a60005 a60006 a60007 a60008 a60009 a60010 a60011 a60012 a60013 a60014 a60015 a60016 a60017 a60018 a60019 a60020 a60021 a60022 a60023 a60024 a60025 a60026 a60027 a60028 a60029 a60030 a60031 a60032 a60033 a60034 a60035 a60036 a60037 a60038 a60039 a60040 a60041 a60042 a60043 a60044 a60045 a60046 a60047 a60048 a60049 a60050 a60051 a60052 a60053 a60054 a60055 a60056 a60057 a60058 a60059 a60060 a60061 a60062 a60063 a60064 a60065 a60066 a60067 a60068 a60069 a60070 a60071 a60072 a60073 a60074 a60075 a60076 a60077 a60078 a60079 a60080 a60081 a60082 a60083 a60084 a60085 a60086 a60087 a60088 a60089 a60090 a60091 a60092 a60093 a60094 a60095 a60096 a60097 a60098 a60099 a60100 a60101 a60102 a60103 a60104 a60105 a60106 a60107 a60108 a60109 a60110 a60111 a60112 a60113 a60114 a60115 a60116 a60117 a60118 a60119 a60120 a60121 a60122 a60123 a60124 a60125 a60126 a60127 a60128 a60129 a60130 a60131 a60132 a60133 a60134 a60135 a60136 a60137 a60138 a60139 a60140 a60141 a60142 a60143 a60144 a60145 a60146 a60147 a60148 a60149 a60150 a60151 a60152 a60153 a60154 a60155 a60156 a60157 a60158 a60159 a60160 a60161 a60162 a60163 a60164 a60165 a60166 a60167 a60168 a60169 a60170 a60171 a60172 a60173 a60174 a60175 a60176 a60177 a60178 a60179 a60180 a60181 a60182 a60183 a60184 a60185 a60186 a60187 a60188 a60189 a60190 a60191 a60192 a60193 a60194 a60195 a60196 a60197 a60198 a60199 a60200 a60201 a60202 a60203 a60204 a60205 a60206 a60207 a60208 a60209 a60210 a60211 a60212 a60213 a60214 a60215 a60216 a60217 a60218 a60219 a60220 a60221 a60222 a60223 a60224 a60225 a60226 a60227 a60228 a60229 a60230 a60231 a60232 a60233 a60234 a60235 a60236 a60237 a60238 a60239 a60240 a60241 a60242 a60243 a60244 a60245 a60246 a60247 a60248 a60249 a60250 a60251 a60252 a60253 a60254 a60255 a60256 a60257 a60258 a60259 a60260 a60261 a60262 a60263 a60264 a60265 a60266 a60267 a60268 a60269 a60270 a60271 a60272 a60273 a60274 a60275 a60276 a60277 a60278 a60279 a60280 a60281 a60282 a60283 a60284 a60285 a60286 a60287 a60288 a60289 a60290 a60291 a60292 a60293 a60294 a60295 a60296 a60297 a60298 a60299 a60300 a60301 a60302 a60303 a60304 a60305 a60306 a60307 a60308 a60309 a60310 a60311 a60312 a60313 a60314 a60315 a60316 a60317 a60318 a60319 a60320 a60321 a60322 a60323 a60324 a60325 a60326 a60327 a60328 a60329 a60330 a60331 a60332 a60333 a60334 a60335 a60336 a60337 a60338 a60339 a60340 a60341 a60342 a60343 a60344 a60345 a60346 a60347 a60348 a60349 a60350 a60351 a60352 a60353 a60354 a60355 a60356 a60357 a60358 a60359 a60360 a60361 a60362 a60363 a60364 a60365 a60366 a60367 a60368 a60369 a60370 a60371 a60372 a60373 a60374 a60375 a60376 a60377 a60378 a60379 a60380 a60381 a60382 a60383 a60384 a60385 a60386 a60387 a60388 a60389 a60390 a60391 a60392 a60393 a60394 a60395 a60396 a60397 a60398 a60399 a60400 a60401 a60402 a60403 a60404 a60405 a60406 a60407 a60408 a60409 a60410 a60411 a60412 a60413 a60414 a60415 a60416 a60417 a60418 a60419 a60420 a60421 a60422 a60423 a60424 a60425 a60426 a60427 a60428 a60429 a60430 a60431 a60432 a60433 a60434 a60435 a60436 a60437 a60438 a60439 a60440 a60441 a60442 a60443 a60444 a60445 a60446 a60447 a60448 a60449 a60450 a60451 a60452 a60453 a60454 a60455 a60456 a60457 a60458 a60459 a60460 a60461 a60462 a60463 a60464 a60465 a60466 a60467 a60468 a60469 a60470 a60471 a60472 a60473 a60474 a60475 a60476 a60477 a60478 a60479 a60480 a60481 a60482 a60483 a60484 a60485 a60486 a60487 a60488 a60489 a60490 a60491 a60492 a60493 a60494 a60495 a60496 a60497 a60498 a60499 a60500 a60501 a60502 a60503 a60504 a60505 a60506 a60507 a60508 a60509 a60510 a60511 a60512 a60513 a60514 a60515 a60516 a60517 a60518 a60519 a60520 a60521 a60522 a60523 a60524 a60525 a60526 a60527 a60528 a60529 a60530 a60531 a60532 a60533 a60534 a60535 a60536 a60537 a60538 a60539 a60540 a60541 a60542 a60543 a60544 a60545 a60546 a60547 a60548 a60549 a60550 a60551 a60552 a60553 a60554 a60555 a60556 a60557 a60558 a60559 a60560 a60561 a60562 a60563 a60564 a60565 a60566 a60567 a60568 a60569 a60570 a60571 a60572 a60573 a60574 a60575 a60576 a60577 a60578 a60579 a60580 a60581 a60582 a60583 a60584 a60585 a60586 a60587 a60588 a60589 a60590 a60591 a60592 a60593 a60594 a60595 a60596 a60597 a60598 a60599 a60600 a60601 a60602 a60603 a60604 a60605 a60606 a60607 a60608 a60609 a60610 a60611 a60612 a60613 a60614 a60615 a60616 a60617 a60618 a60619 a60620 a60621 a60622 a60623 a60624 a60625 a60626 a60627 a60628 a60629 a60630 a60631 a60632 a60633 a60634 a60635 a60636 a60637 a60638 a60639 a60640 a60641 a60642 a60643 a60644 a60645 a60646 a60647 a60648 a60649 a60650 a60651 a60652 a60653 a60654 a60655 a60656 a60657 a60658 a60659 a60660 a60661 a60662 a60663 a60664 a60665 a60666 a60667 a60668 a60669 a60670 a60671 a60672 a60673 a60674 a60675 a60676 a60677 a60678 a60679 a60680 a60681 a60682 a60683 a60684 a60685 a60686 a60687 a60688 a60689 a60690 a60691 a60692 a60693 a60694 a60695 a60696 a60697 a60698 a60699 a60700 a60701 a60702 a60703 a60704 a60705 a60706 a60707 a60708 a60709 a60710 a60711 a60712 a60713 a60714 a60715 a60716 a60717 a60718 a60719 a60720 a60721 a60722 a60723 a60724 a60725 a60726 a60727 a60728 a60729 a60730 a60731 a60732 a60733 a60734 a60735 a60736 a60737 a60738 a60739 a60740 a60741 a60742 a60743 a60744 a60745 a60746 a60747 a60748 a60749 a60750 a60751 a60752 a60753 a60754 a60755 a60756 a60757 a60758 a60759 a60760 a60761 a60762 a60763 a60764 a60765 a60766 a60767 a60768 a60769 a60770 a60771 a60772 a60773 a60774 a60775 a60776 a60777 a60778 a60779 a60780 a60781 a60782 a60783 a60784 a60785 a60786 a60787 a60788 a60789 a60790 a60791 a60792 a60793 a60794 a60795 a60796 a60797 a60798 a60799 a60800 a60801 a60802 a60803 a60804 a60805 a60806 a60807 a60808 a60809 a60810 a60811 a60812 a60813 a60814 a60815 a60816 a60817 a60818 a60819 a60820 a60821 a60822 a60823 a60824 a60825 a60826 a60827 a60828 a60829 a60830 a60831 a60832 a60833 a60834 a60835 a60836 a60837 a60838 a60839 a60840 a60841 a60842 a60843 a60844 a60845 a60846 a60847 a60848 a60849 a60850 a60851 a60852 a60853 a60854 a60855 a60856 a60857 a60858 a60859 a60860 a60861 a60862 a60863 a60864 a60865 a60866 a60867 a60868 a60869 a60870 a60871 a60872 a60873 a60874 a60875 a60876 a60877 a60878 a60879 a60880 a60881 a60882 a60883 a60884 a60885 a60886 a60887 a60888 a60889 a60890 a60891 a60892 a60893 a60894 a60895 a60896 a60897 a60898 a60899 a60900 a60901 a60902 a60903 a60904 a60905 a60906 a60907 a60908 a60909 a60910 a60911 a60912 a60913 a60914 a60915 a60916 a60917 a60918 a60919 a60920 a60921 a60922 a60923 a60924 a60925 a60926 a60927 a60928 a60929 a60930 a60931 a60932 a60933 a60934 a60935 a60936 a60937 a60938 a60939 a60940 a60941 a60942 a60943 a60944 a60945 a60946 a60947 a60948 a60949 a60950 a60951 a60952 a60953 a60954 a60955 a60956 a60957 a60958 a60959 a60960 a60961 a60962 a60963 a60964 a60965 a60966 a60967 a60968 a60969 a60970 a60971 a60972 a60973 a60974 a60975 a60976 a60977 a60978 a60979 a60980 a60981 a60982 a60983 a60984 a60985 a60986 a60987 a60988 a60989 a60990 a60991 a60992 a60993 a60994 a60995 a60996 a60997 a60998 a60999 a61000 a61001 a61002 a61003 a61004 a61005 a61006 a61007 a61008 a61009 a61010 a61011 a61012 a61013 a61014 a61015 a61016 a61017 a61018 a61019 a61020 a61021 a61022 a61023 a61024 a61025 a61026 a61027 a61028 a61029 a61030 a61031 a61032 a61033 a61034 a61035 a61036 a61037 a61038 a61039 a61040 a61041 a61042 a61043 a61044 a61045 a61046 a61047 a61048 a61049 a61050 a61051 a61052 a61053 a61054 a61055 a61056 a61057 a61058 a61059 a61060 a61061 a61062 a61063 a61064 a61065 a61066 a61067 a61068 a61069 a61070 a61071 a61072 a61073 a61074 a61075 a61076 a61077 a61078 a61079 a61080 a61081 a61082 a61083 a61084 a61085 a61086 a61087 a61088 a61089 a61090 a61091 a61092 a61093 a61094 a61095 a61096 a61097 a61098 a61099 a61100 a61101 a61102 a61103 a61104 a61105 a61106 a61107 a61108 a61109 a61110 a61111 a61112 a61113 a61114 a61115 a61116 a61117 a61118 a61119 a61120 a61121 a61122 a61123 a61124 a61125 a61126 a61127 a61128 a61129 a61130 a61131 a61132 a61133 a61134 a61135 a61136 a61137 a61138 a61139 a61140 a61141 a61142 a61143 a61144 a61145 a61146 a61147 a61148 a61149 a61150 a61151 a61152 a61153 a61154 a61155 a61156 a61157 a61158 a61159 a61160 a61161 a61162 a61163 a61164 a61165 a61166 a61167 a61168 a61169 a61170 a61171 a61172 a61173 a61174 a61175 a61176 a61177 a61178 a61179 a61180 a61181 a61182 a61183 a61184 a61185 a61186 a61187 a61188 a61189 a61190 a61191 a61192 a61193 a61194 a61195 a61196 a61197 a61198 a61199 a61200 a61201 a61202 a61203 a61204 a61205 a61206 a61207 a61208 a61209 a61210 a61211 a61212 a61213 a61214 a61215 a61216 a61217 a61218 a61219 a61220 a61221 a61222 a61223 a61224 a61225 a61226 a61227 a61228 a61229 a61230 a61231 a61232 a61233 a61234 a61235 a61236 a61237 a61238 a61239 a61240 a61241 a61242 a61243 a61244 a61245 a61246 a61247 a61248 a61249 a61250 a61251 a61252 a61253 a61254 a61255 a61256 a61257 a61258 a61259 a61260 a61261 a61262 a61263 a61264 a61265 a61266 a61267 a61268 a61269 a61270 a61271 a61272 a61273 a61274 a61275 a61276 a61277 a61278 a61279 a61280 a61281 a61282 a61283 a61284 a61285 a61286 a61287 a61288 a61289 a61290 a61291 a61292 a61293 a61294 a61295 a61296 a61297 a61298 a61299 a61300 a61301 a61302 a61303 a61304 a61305 a61306 a61307 a61308 a61309 a61310 a61311 a61312 a61313 a61314 a61315 a61316 a61317 a61318 a61319 a61320 a61321 a61322 a61323 a61324 a61325 a61326 a61327 a61328 a61329 a61330 a61331 a61332 a61333 a61334 a61335 a61336 a61337 a61338 a61339 a61340 a61341 a61342 a61343 a61344 a61345 a61346 a61347 a61348 a61349 a61350 a61351 a61352 a61353 a61354 a61355 a61356 a61357 a61358 a61359 a61360 a61361 a61362 a61363 a61364 a61365 a61366 a61367 a61368 a61369 a61370 a61371 a61372 a61373 a61374 a61375 a61376 a61377 a61378 a61379 a61380 a61381 a61382 a61383 a61384 a61385 a61386 a61387 a61388 a61389 a61390 a61391 a61392 a61393 a61394 a61395 a61396 a61397 a61398 a61399 a61400 a61401 a61402 a61403 a61404 a61405 a61406 a61407 a61408 a61409 a61410 a61411 a61412 a61413 a61414 a61415 a61416 a61417 a61418 a61419 a61420 a61421 a61422 a61423 a61424 a61425 a61426 a61427 a61428 a61429 a61430 a61431 a61432 a61433 a61434 a61435 a61436 a61437 a61438 a61439 a61440 a61441 a61442 a61443 a61444 a61445 a61446 a61447 a61448 a61449 a61450 a61451 a61452 a61453 a61454 a61455 a61456 a61457 a61458 a61459 a61460 a61461 a61462 a61463 a61464 a61465 a61466 a61467 a61468 a61469 a61470 a61471 a61472 a61473 a61474 a61475 a61476 a61477 a61478 a61479 a61480 a61481 a61482 a61483 a61484 a61485 a61486 a61487 a61488 a61489 a61490 a61491 a61492 a61493 a61494 a61495 a61496 a61497 a61498 a61499 a61500 a61501 a61502 a61503 a61504 a61505 a61506 a61507 a61508 a61509 a61510 a61511 a61512 a61513 a61514 a61515 a61516 a61517 a61518 a61519 a61520 a61521 a61522 a61523 a61524 a61525 a61526 a61527 a61528 a61529 a61530 a61531 a61532 a61533 a61534 a61535 a61536 a61537 a61538 a61539 a61540 a61541 a61542 a61543 a61544 a61545 a61546 a61547 a61548 a61549 a61550 a61551 a61552 a61553 a61554 a61555 a61556 a61557 a61558 a61559 a61560 a61561 a61562 a61563 a61564 a61565 a61566 a61567 a61568 a61569 a61570 a61571 a61572 a61573 a61574 a61575 a61576 a61577 a61578 a61579 a61580 a61581 a61582 a61583 a61584 a61585 a61586 a61587 a61588 a61589 a61590 a61591 a61592 a61593 a61594 a61595 a61596 a61597 a61598 a61599 a61600 a61601 a61602 a61603 a61604 a61605 a61606 a61607 a61608 a61609 a61610 a61611 a61612 a61613 a61614 a61615 a61616 a61617 a61618 a61619 a61620 a61621 a61622 a61623 a61624 a61625 a61626 a61627 a61628 a61629 a61630 a61631 a61632 a61633 a61634 a61635 a61636 a61637 a61638 a61639 a61640 a61641 a61642 a61643 a61644 a61645 a61646 a61647 a61648 a61649 a61650 a61651 a61652 a61653 a61654 a61655 a61656 a61657 a61658 a61659 a61660 a61661 a61662 a61663 a61664 a61665 a61666 a61667 a61668 a61669 a61670 a61671 a61672 a61673 a61674 a61675 a61676 a61677 a61678 a61679 a61680 a61681 a61682 a61683 a61684 a61685 a61686 a61687 a61688 a61689 a61690 a61691 a61692 a61693 a61694 a61695 a61696 a61697 a61698 a61699 a61700 a61701 a61702 a61703 a61704 a61705 a61706 a61707 a61708 a61709 a61710 a61711 a61712 a61713 a61714 a61715 a61716 a61717 a61718 a61719 a61720 a61721 a61722 a61723 a61724 a61725 a61726 a61727 a61728 a61729 a61730 a61731 a61732 a61733 a61734 a61735 a61736 a61737 a61738 a61739 a61740 a61741 a61742 a61743 a61744 a61745 a61746 a61747 a61748 a61749 a61750 a61751 a61752 a61753 a61754 a61755 a61756 a61757 a61758 a61759 a61760 a61761 a61762 a61763 a61764 a61765 a61766 a61767 a61768 a61769 a61770 a61771 a61772 a61773 a61774 a61775 a61776 a61777 a61778 a61779 a61780 a61781 a61782 a61783 a61784 a61785 a61786 a61787 a61788 a61789 a61790 a61791 a61792 a61793 a61794 a61795 a61796 a61797 a61798 a61799 a61800 a61801 a61802 a61803 a61804 a61805 a61806 a61807 a61808 a61809 a61810 a61811 a61812 a61813 a61814 a61815 a61816 a61817 a61818 a61819 a61820 a61821 a61822 a61823 a61824 a61825 a61826 a61827 a61828 a61829 a61830 a61831 a61832 a61833 a61834 a61835 a61836 a61837 a61838 a61839 a61840 a61841 a61842 a61843 a61844 a61845 a61846 a61847 a61848 a61849 a61850 a61851 a61852 a61853 a61854 a61855 a61856 a61857 a61858 a61859 a61860 a61861 a61862 a61863 a61864 a61865 a61866 a61867 a61868 a61869 a61870 a61871 a61872 a61873 a61874 a61875 a61876 a61877 a61878 a61879 a61880 a61881 a61882 a61883 a61884 a61885 a61886 a61887 a61888 a61889 a61890 a61891 a61892 a61893 a61894 a61895 a61896 a61897 a61898 a61899 a61900 a61901 a61902 a61903 a61904 a61905 a61906 a61907 a61908 a61909 a61910 a61911 a61912 a61913 a61914 a61915 a61916 a61917 a61918 a61919 a61920 a61921 a61922 a61923 a61924 a61925 a61926 a61927 a61928 a61929 a61930 a61931 a61932 a61933 a61934 a61935 a61936 a61937 a61938 a61939 a61940 a61941 a61942 a61943 a61944 a61945 a61946 a61947 a61948 a61949 a61950 a61951 a61952 a61953 a61954 a61955 a61956 a61957 a61958 a61959 a61960 a61961 a61962 a61963 a61964 a61965 a61966 a61967 a61968 a61969 a61970 a61971 a61972 a61973 a61974 a61975 a61976 a61977 a61978 a61979 a61980 a61981 a61982 a61983 a61984 a61985 a61986 a61987 a61988 a61989 a61990 a61991 a61992 a61993 a61994 a61995 a61996 a61997 a61998 a61999 a62000 a62001 a62002 a62003 a62004 a62005 a62006 a62007 a62008 a62009 a62010 a62011 a62012 a62013 a62014 a62015 a62016 a62017 a62018 a62019 a62020 a62021 a62022 a62023 a62024 a62025 a62026 a62027 a62028 a62029 a62030 a62031 a62032 a62033 a62034 a62035 a62036 a62037 a62038 a62039 a62040 a62041 a62042 a62043 a62044 a62045 a62046 a62047 a62048 a62049 a62050 a62051 a62052 a62053 a62054 a62055 a62056 a62057 a62058 a62059 a62060 a62061 a62062 a62063 a62064 a62065 a62066 a62067 a62068 a62069 a62070 a62071 a62072 a62073 a62074 a62075 a62076 a62077 a62078 a62079 a62080 a62081 a62082 a62083 a62084 a62085 a62086 a62087 a62088 a62089 a62090 a62091 a62092 a62093 a62094 a62095 a62096 a62097 a62098 a62099 a62100 a62101 a62102 a62103 a62104 a62105 a62106 a62107 a62108 a62109 a62110 a62111 a62112 a62113 a62114 a62115 a62116 a62117 a62118 a62119 a62120 a62121 a62122 a62123 a62124 a62125 a62126 a62127 a62128 a62129 a62130 a62131 a62132 a62133 a62134 a62135 a62136 a62137 a62138 a62139 a62140 a62141 a62142 a62143 a62144 a62145 a62146 a62147 a62148 a62149 a62150 a62151 a62152 a62153 a62154 a62155 a62156 a62157 a62158 a62159 a62160 a62161 a62162 a62163 a62164 a62165 a62166 a62167 a62168 a62169 a62170 a62171 a62172 a62173 a62174 a62175 a62176 a62177 a62178 a62179 a62180 a62181 a62182 a62183 a62184 a62185 a62186 a62187 a62188 a62189 a62190 a62191 a62192 a62193 a62194 a62195 a62196 a62197 a62198 a62199 a62200 a62201 a62202 a62203 a62204 a62205 a62206 a62207 a62208 a62209 a62210 a62211 a62212 a62213 a62214 a62215 a62216 a62217 a62218 a62219 a62220 a62221 a62222 a62223 a62224 a62225 a62226 a62227 a62228 a62229 a62230 a62231 a62232 a62233 a62234 a62235 a62236 a62237 a62238 a62239 a62240 a62241 a62242 a62243 a62244 a62245 a62246 a62247 a62248 a62249 a62250 a62251 a62252 a62253 a62254 a62255 a62256 a62257 a62258 a62259 a62260 a62261 a62262 a62263 a62264 a62265 a62266 a62267 a62268 a62269 a62270 a62271 a62272 a62273 a62274 a62275 a62276 a62277 a62278 a62279 a62280 a62281 a62282 a62283 a62284 a62285 a62286 a62287 a62288 a62289 a62290 a62291 a62292 a62293 a62294 a62295 a62296 a62297 a62298 a62299 a62300 a62301 a62302 a62303 a62304 a62305 a62306 a62307 a62308 a62309 a62310 a62311 a62312 a62313 a62314 a62315 a62316 a62317 a62318 a62319 a62320 a62321 a62322 a62323 a62324 a62325 a62326 a62327 a62328 a62329 a62330 a62331 a62332 a62333 a62334 a62335 a62336 a62337 a62338 a62339 a62340 a62341 a62342 a62343 a62344 a62345 a62346 a62347 a62348 a62349 a62350 a62351 a62352 a62353 a62354 a62355 a62356 a62357 a62358 a62359 a62360 a62361 a62362 a62363 a62364 a62365 a62366 a62367 a62368 a62369 a62370 a62371 a62372 a62373 a62374 a62375 a62376 a62377 a62378 a62379 a62380 a62381 a62382 a62383 a62384 a62385 a62386 a62387 a62388 a62389 a62390 a62391 a62392 a62393 a62394 a62395 a62396 a62397 a62398 a62399 a62400 a62401 a62402 a62403 a62404 a62405 a62406 a62407 a62408 a62409 a62410 a62411 a62412 a62413 a62414 a62415 a62416 a62417 a62418 a62419 a62420 a62421 a62422 a62423 a62424 a62425 a62426 a62427 a62428 a62429 a62430 a62431 a62432 a62433 a62434 a62435 a62436 a62437 a62438 a62439 a62440 a62441 a62442 a62443 a62444 a62445 a62446 a62447 a62448 a62449 a62450 a62451 a62452 a62453 a62454 a62455 a62456 a62457 a62458 a62459 a62460 a62461 a62462 a62463 a62464 a62465 a62466 a62467 a62468 a62469 a62470 a62471 a62472 a62473 a62474 a62475 a62476 a62477 a62478 a62479 a62480 a62481 a62482 a62483 a62484 a62485 a62486 a62487 a62488 a62489 a62490 a62491 a62492 a62493 a62494 a62495 a62496 a62497 a62498 a62499 a62500 a62501 a62502 a62503 a62504 a62505 a62506 a62507 a62508 a62509 a62510 a62511 a62512 a62513 a62514 a62515 a62516 a62517 a62518 a62519 a62520 a62521 a62522 a62523 a62524 a62525 a62526 a62527 a62528 a62529 a62530 a62531 a62532 a62533 a62534 a62535 a62536 a62537 a62538 a62539 a62540 a62541 a62542 a62543 a62544 a62545 a62546 a62547 a62548 a62549 a62550 a62551 a62552 a62553 a62554 a62555 a62556 a62557 a62558 a62559 a62560 a62561 a62562 a62563 a62564 a62565 a62566 a62567 a62568 a62569 a62570 a62571 a62572 a62573 a62574 a62575 a62576 a62577 a62578 a62579 a62580 a62581 a62582 a62583 a62584 a62585 a62586 a62587 a62588 a62589 a62590 a62591 a62592 a62593 a62594 a62595 a62596 a62597 a62598 a62599 a62600 a62601 a62602 a62603 a62604 a62605 a62606 a62607 a62608 a62609 a62610 a62611 a62612 a62613 a62614 a62615 a62616 a62617 a62618 a62619 a62620 a62621 a62622 a62623 a62624 a62625 a62626 a62627 a62628 a62629 a62630 a62631 a62632 a62633 a62634 a62635 a62636 a62637 a62638 a62639 a62640 a62641 a62642 a62643 a62644 a62645 a62646 a62647 a62648 a62649 a62650 a62651 a62652 a62653 a62654 a62655 a62656 a62657 a62658 a62659 a62660 a62661 a62662 a62663 a62664 a62665 a62666 a62667 a62668 a62669 a62670 a62671 a62672 a62673 a62674 a62675 a62676 a62677 a62678 a62679 a62680 a62681 a62682 a62683 a62684 a62685 a62686 a62687 a62688 a62689 a62690 a62691 a62692 a62693 a62694 a62695 a62696 a62697 a62698 a62699 a62700 a62701 a62702 a62703 a62704 a62705 a62706 a62707 a62708 a62709 a62710 a62711 a62712 a62713 a62714 a62715 a62716 a62717 a62718 a62719 a62720 a62721 a62722 a62723 a62724 a62725 a62726 a62727 a62728 a62729 a62730 a62731 a62732 a62733 a62734 a62735 a62736 a62737 a62738 a62739 a62740 a62741 a62742 a62743 a62744 a62745 a62746 a62747 a62748 a62749 a62750 a62751 a62752 a62753 a62754 a62755 a62756 a62757 a62758 a62759 a62760 a62761 a62762 a62763 a62764 a62765 a62766 a62767 a62768 a62769 a62770 a62771 a62772 a62773 a62774 a62775 a62776 a62777 a62778 a62779 a62780 a62781 a62782 a62783 a62784 a62785 a62786 a62787 a62788 a62789 a62790 a62791 a62792 a62793 a62794 a62795 a62796 a62797 a62798 a62799 a62800 a62801 a62802 a62803 a62804 a62805 a62806 a62807 a62808 a62809 a62810 a62811 a62812 a62813 a62814 a62815 a62816 a62817 a62818 a62819 a62820 a62821 a62822 a62823 a62824 a62825 a62826 a62827 a62828 a62829 a62830 a62831 a62832 a62833 a62834 a62835 a62836 a62837 a62838 a62839 a62840 a62841 a62842 a62843 a62844 a62845 a62846 a62847 a62848 a62849 a62850 a62851 a62852 a62853 a62854 a62855 a62856 a62857 a62858 a62859 a62860 a62861 a62862 a62863 a62864 a62865 a62866 a62867 a62868 a62869 a62870 a62871 a62872 a62873 a62874 a62875 a62876 a62877 a62878 a62879 a62880 a62881 a62882 a62883 a62884 a62885 a62886 a62887 a62888 a62889 a62890 a62891 a62892 a62893 a62894 a62895 a62896 a62897 a62898 a62899 a62900 a62901 a62902 a62903 a62904 a62905 a62906 a62907 a62908 a62909 a62910 a62911 a62912 a62913 a62914 a62915 a62916 a62917 a62918 a62919 a62920 a62921 a62922 a62923 a62924 a62925 a62926 a62927 a62928 a62929 a62930 a62931 a62932 a62933 a62934 a62935 a62936 a62937 a62938 a62939 a62940 a62941 a62942 a62943 a62944 a62945 a62946 a62947 a62948 a62949 a62950 a62951 a62952 a62953 a62954 a62955 a62956 a62957 a62958 a62959 a62960 a62961 a62962 a62963 a62964 a62965 a62966 a62967 a62968 a62969 a62970 a62971 a62972 a62973 a62974 a62975 a62976 a62977 a62978 a62979 a62980 a62981 a62982 a62983 a62984 a62985 a62986 a62987 a62988 a62989 a62990 a62991 a62992 a62993 a62994 a62995 a62996 a62997 a62998 a62999 a63000 a63001 a63002 a63003 a63004 a63005 a63006 a63007 a63008 a63009 a63010 a63011 a63012 a63013 a63014 a63015 a63016 a63017 a63018 a63019 a63020 a63021 a63022 a63023 a63024 a63025 a63026 a63027 a63028 a63029 a63030 a63031 a63032 a63033 a63034 a63035 a63036 a63037 a63038 a63039 a63040 a63041 a63042 a63043 a63044 a63045 a63046 a63047 a63048 a63049 a63050 a63051 a63052 a63053 a63054 a63055 a63056 a63057 a63058 a63059 a63060 a63061 a63062 a63063 a63064 a63065 a63066 a63067 a63068 a63069 a63070 a63071 a63072 a63073 a63074 a63075 a63076 a63077 a63078 a63079 a63080 a63081 a63082 a63083 a63084 a63085 a63086 a63087 a63088 a63089 a63090 a63091 a63092 a63093 a63094 a63095 a63096 a63097 a63098 a63099 a63100 a63101 a63102 a63103 a63104 a63105 a63106 a63107 a63108 a63109 a63110 a63111 a63112 a63113 a63114 a63115 a63116 a63117 a63118 a63119 a63120 a63121 a63122 a63123 a63124 a63125 a63126 a63127 a63128 a63129 a63130 a63131 a63132 a63133 a63134 a63135 a63136 a63137 a63138 a63139 a63140 a63141 a63142 a63143 a63144 a63145 a63146 a63147 a63148 a63149 a63150 a63151 a63152 a63153 a63154 a63155 a63156 a63157 a63158 a63159 a63160 a63161 a63162 a63163 a63164 a63165 a63166 a63167 a63168 a63169 a63170 a63171 a63172 a63173 a63174 a63175 a63176 a63177 a63178 a63179 a63180 a63181 a63182 a63183 a63184 a63185 a63186 a63187 a63188 a63189 a63190 a63191 a63192 a63193 a63194 a63195 a63196 a63197 a63198 a63199 a63200 a63201 a63202 a63203 a63204 a63205 a63206 a63207 a63208 a63209 a63210 a63211 a63212 a63213 a63214 a63215 a63216 a63217 a63218 a63219 a63220 a63221 a63222 a63223 a63224 a63225 a63226 a63227 a63228 a63229 a63230 a63231 a63232 a63233 a63234 a63235 a63236 a63237 a63238 a63239 a63240 a63241 a63242 a63243 a63244 a63245 a63246 a63247 a63248 a63249 a63250 a63251 a63252 a63253 a63254 a63255 a63256 a63257 a63258 a63259 a63260 a63261 a63262 a63263 a63264 a63265 a63266 a63267 a63268 a63269 a63270 a63271 a63272 a63273 a63274 a63275 a63276 a63277 a63278 a63279 a63280 a63281 a63282 a63283 a63284 a63285 a63286 a63287 a63288 a63289 a63290 a63291 a63292 a63293 a63294 a63295 a63296 a63297 a63298 a63299 a63300 a63301 a63302 a63303 a63304 a63305 a63306 a63307 a63308 a63309 a63310 a63311 a63312 a63313 a63314 a63315 a63316 a63317 a63318 a63319 a63320 a63321 a63322 a63323 a63324 a63325 a63326 a63327 a63328 a63329 a63330 a63331 a63332 a63333 a63334 a63335 a63336 a63337 a63338 a63339 a63340 a63341 a63342 a63343 a63344 a63345 a63346 a63347 a63348 a63349 a63350 a63351 a63352 a63353 a63354 a63355 a63356 a63357 a63358 a63359 a63360 a63361 a63362 a63363 a63364 a63365 a63366 a63367 a63368 a63369 a63370 a63371 a63372 a63373 a63374 a63375 a63376 a63377 a63378 a63379 a63380 a63381 a63382 a63383 a63384 a63385 a63386 a63387 a63388 a63389 a63390 a63391 a63392 a63393 a63394 a63395 a63396 a63397 a63398 a63399 a63400 a63401 a63402 a63403 a63404 a63405 a63406 a63407 a63408 a63409 a63410 a63411 a63412 a63413 a63414 a63415 a63416 a63417 a63418 a63419 a63420 a63421 a63422 a63423 a63424 a63425 a63426 a63427 a63428 a63429 a63430 a63431 a63432 a63433 a63434 a63435 a63436 a63437 a63438 a63439 a63440 a63441 a63442 a63443 a63444 a63445 a63446 a63447 a63448 a63449 a63450 a63451 a63452 a63453 a63454 a63455 a63456 a63457 a63458 a63459 a63460 a63461 a63462 a63463 a63464 a63465 a63466 a63467 a63468 a63469 a63470 a63471 a63472 a63473 a63474 a63475 a63476 a63477 a63478 a63479 a63480 a63481 a63482 a63483 a63484 a63485 a63486 a63487 a63488 a63489 a63490 a63491 a63492 a63493 a63494 a63495 a63496 a63497 a63498 a63499 a63500 a63501 a63502 a63503 a63504 a63505 a63506 a63507 a63508 a63509 a63510 a63511 a63512 a63513 a63514 a63515 a63516 a63517 a63518 a63519 a63520 a63521 a63522 a63523 a63524 a63525 a63526 a63527 a63528 a63529 a63530 a63531 a63532 a63533 a63534 a63535 a63536 a63537 a63538 a63539 a63540 a63541 a63542 a63543 a63544 a63545 a63546 a63547 a63548 a63549 a63550 a63551 a63552 a63553 a63554 a63555 a63556 a63557 a63558 a63559 a63560 a63561 a63562 a63563 a63564 a63565 a63566 a63567 a63568 a63569 a63570 a63571 a63572 a63573 a63574 a63575 a63576 a63577 a63578 a63579 a63580 a63581 a63582 a63583 a63584 a63585 a63586 a63587 a63588 a63589 a63590 a63591 a63592 a63593 a63594 a63595 a63596 a63597 a63598 a63599 a63600 a63601 a63602 a63603 a63604 a63605 a63606 a63607 a63608 a63609 a63610 a63611 a63612 a63613 a63614 a63615 a63616 a63617 a63618 a63619 a63620 a63621 a63622 a63623 a63624 a63625 a63626 a63627 a63628 a63629 a63630 a63631 a63632 a63633 a63634 a63635 a63636 a63637 a63638 a63639 a63640 a63641 a63642 a63643 a63644 a63645 a63646 a63647 a63648 a63649 a63650 a63651 a63652 a63653 a63654 a63655 a63656 a63657 a63658 a63659 a63660 a63661 a63662 a63663 a63664 a63665 a63666 a63667 a63668 a63669 a63670 a63671 a63672 a63673 a63674 a63675 a63676 a63677 a63678 a63679 a63680 a63681 a63682 a63683 a63684 a63685 a63686 a63687 a63688 a63689 a63690 a63691 a63692 a63693 a63694 a63695 a63696 a63697 a63698 a63699 a63700 a63701 a63702 a63703 a63704 a63705 a63706 a63707 a63708 a63709 a63710 a63711 a63712 a63713 a63714 a63715 a63716 a63717 a63718 a63719 a63720 a63721 a63722 a63723 a63724 a63725 a63726 a63727 a63728 a63729 a63730 a63731 a63732 a63733 a63734 a63735 a63736 a63737 a63738 a63739 a63740 a63741 a63742 a63743 a63744 a63745 a63746 a63747 a63748 a63749 a63750 a63751 a63752 a63753 a63754 a63755 a63756 a63757 a63758 a63759 a63760 a63761 a63762 a63763 a63764 a63765 a63766 a63767 a63768 a63769 a63770 a63771 a63772 a63773 a63774 a63775 a63776 a63777 a63778 a63779 a63780 a63781 a63782 a63783 a63784 a63785 a63786 a63787 a63788 a63789 a63790 a63791 a63792 a63793 a63794 a63795 a63796 a63797 a63798 a63799 a63800 a63801 a63802 a63803 a63804 a63805 a63806 a63807 a63808 a63809 a63810 a63811 a63812 a63813 a63814 a63815 a63816 a63817 a63818 a63819 a63820 a63821 a63822 a63823 a63824 a63825 a63826 a63827 a63828 a63829 a63830 a63831 a63832 a63833 a63834 a63835 a63836 a63837 a63838 a63839 a63840 a63841 a63842 a63843 a63844 a63845 a63846 a63847 a63848 a63849 a63850 a63851 a63852 a63853 a63854 a63855 a63856 a63857 a63858 a63859 a63860 a63861 a63862 a63863 a63864 a63865 a63866 a63867 a63868 a63869 a63870 a63871 a63872 a63873 a63874 a63875 a63876 a63877 a63878 a63879 a63880 a63881 a63882 a63883 a63884 a63885 a63886 a63887 a63888 a63889 a63890 a63891 a63892 a63893 a63894 a63895 a63896 a63897 a63898 a63899 a63900 a63901 a63902 a63903 a63904 a63905 a63906 a63907 a63908 a63909 a63910 a63911 a63912 a63913 a63914 a63915 a63916 a63917 a63918 a63919 a63920 a63921 a63922 a63923 a63924 a63925 a63926 a63927 a63928 a63929 a63930 a63931 a63932 a63933 a63934 a63935 a63936 a63937 a63938 a63939 a63940 a63941 a63942 a63943 a63944 a63945 a63946 a63947 a63948 a63949 a63950 a63951 a63952 a63953 a63954 a63955 a63956 a63957 a63958 a63959 a63960 a63961 a63962 a63963 a63964 a63965 a63966 a63967 a63968 a63969 a63970 a63971 a63972 a63973 a63974 a63975 a63976 a63977 a63978 a63979 a63980 a63981 a63982 a63983 a63984 a63985 a63986 a63987 a63988 a63989 a63990 a63991 a63992 a63993 a63994 a63995 a63996 a63997 a63998 a63999 a64000 a64001 a64002 a64003 a64004 a64005 a64006 a64007 a64008 a64009 a64010 a64011 a64012 a64013 a64014 a64015 a64016 a64017 a64018 a64019 a64020 a64021 a64022 a64023 a64024 a64025 a64026 a64027 a64028 a64029 a64030 a64031 a64032 a64033 a64034 a64035 a64036 a64037 a64038 a64039 a64040 a64041 a64042 a64043 a64044 a64045 a64046 a64047 a64048 a64049 a64050 a64051 a64052 a64053 a64054 a64055 a64056 a64057 a64058 a64059 a64060 a64061 a64062 a64063 a64064 a64065 a64066 a64067 a64068 a64069 a64070 a64071 a64072 a64073 a64074 a64075 a64076 a64077 a64078 a64079 a64080 a64081 a64082 a64083 a64084 a64085 a64086 a64087 a64088 a64089 a64090 a64091 a64092 a64093 a64094 a64095 a64096 a64097 a64098 a64099 a64100 a64101 a64102 a64103 a64104 a64105 a64106 a64107 a64108 a64109 a64110 a64111 a64112 a64113 a64114 a64115 a64116 a64117 a64118 a64119 a64120 a64121 a64122 a64123 a64124 a64125 a64126 a64127 a64128 a64129 a64130 a64131 a64132 a64133 a64134 a64135 a64136 a64137 a64138 a64139 a64140 a64141 a64142 a64143 a64144 a64145 a64146 a64147 a64148 a64149 a64150 a64151 a64152 a64153 a64154 a64155 a64156 a64157 a64158 a64159 a64160 a64161 a64162 a64163 a64164 a64165 a64166 a64167 a64168 a64169 a64170 a64171 a64172 a64173 a64174 a64175 a64176 a64177 a64178 a64179 a64180 a64181 a64182 a64183 a64184 a64185 a64186 a64187 a64188 a64189 a64190 a64191 a64192 a64193 a64194 a64195 a64196 a64197 a64198 a64199 a64200 a64201 a64202 a64203 a64204 a64205 a64206 a64207 a64208 a64209 a64210 a64211 a64212 a64213 a64214 a64215 a64216 a64217 a64218 a64219 a64220 a64221 a64222 a64223 a64224 a64225 a64226 a64227 a64228 a64229 a64230 a64231 a64232 a64233 a64234 a64235 a64236 a64237 a64238 a64239 a64240 a64241 a64242 a64243 a64244 a64245 a64246 a64247 a64248 a64249 a64250 a64251 a64252 a64253 a64254 a64255 a64256 a64257 a64258 a64259 a64260 a64261 a64262 a64263 a64264 a64265 a64266 a64267 a64268 a64269 a64270 a64271 a64272 a64273 a64274 a64275 a64276 a64277 a64278 a64279 a64280 a64281 a64282 a64283 a64284 a64285 a64286 a64287 a64288 a64289 a64290 a64291 a64292 a64293 a64294 a64295 a64296 a64297 a64298 a64299 a64300 a64301 a64302 a64303 a64304 a64305 a64306 a64307 a64308 a64309 a64310 a64311 a64312 a64313 a64314 a64315 a64316 a64317 a64318 a64319 a64320 a64321 a64322 a64323 a64324 a64325 a64326 a64327 a64328 a64329 a64330 a64331 a64332 a64333 a64334 a64335 a64336 a64337 a64338 a64339 a64340 a64341 a64342 a64343 a64344 a64345 a64346 a64347 a64348 a64349 a64350 a64351 a64352 a64353 a64354 a64355 a64356 a64357 a64358 a64359 a64360 a64361 a64362 a64363 a64364 a64365 a64366 a64367 a64368 a64369 a64370 a64371 a64372 a64373 a64374 a64375 a64376 a64377 a64378 a64379 a64380 a64381 a64382 a64383 a64384 a64385 a64386 a64387 a64388 a64389 a64390 a64391 a64392 a64393 a64394 a64395 a64396 a64397 a64398 a64399 a64400 a64401 a64402 a64403 a64404 a64405 a64406 a64407 a64408 a64409 a64410 a64411 a64412 a64413 a64414 a64415 a64416 a64417 a64418 a64419 a64420 a64421 a64422 a64423 a64424 a64425 a64426 a64427 a64428 a64429 a64430 a64431 a64432 a64433 a64434 a64435 a64436 a64437 a64438 a64439 a64440 a64441 a64442 a64443 a64444 a64445 a64446 a64447 a64448 a64449 a64450 a64451 a64452 a64453 a64454 a64455 a64456 a64457 a64458 a64459 a64460 a64461 a64462 a64463 a64464 a64465 a64466 a64467 a64468 a64469 a64470 a64471 a64472 a64473 a64474 a64475 a64476 a64477 a64478 a64479 a64480 a64481 a64482 a64483 a64484 a64485 a64486 a64487 a64488 a64489 a64490 a64491 a64492 a64493 a64494 a64495 a64496 a64497 a64498 a64499 a64500 a64501 a64502 a64503 a64504 a64505 a64506 a64507 a64508 a64509 a64510 a64511 a64512 a64513 a64514 a64515 a64516 a64517 a64518 a64519 a64520 a64521 a64522 a64523 a64524 a64525 a64526 a64527 a64528 a64529 a64530 a64531 a64532 a64533 a64534 a64535 a64536 a64537 a64538 a64539 a64540 a64541 a64542 a64543 a64544 a64545 a64546 a64547 a64548 a64549 a64550 a64551 a64552 a64553 a64554 a64555 a64556 a64557 a64558 a64559 a64560 a64561 a64562 a64563 a64564 a64565 a64566 a64567 a64568 a64569 a64570 a64571 a64572 a64573 a64574 a64575 a64576 a64577 a64578 a64579 a64580 a64581 a64582 a64583 a64584 a64585 a64586 a64587 a64588 a64589 a64590 a64591 a64592 a64593 a64594 a64595 a64596 a64597 a64598 a64599 a64600 a64601 a64602 a64603 a64604 a64605 a64606 a64607 a64608 a64609 a64610 a64611 a64612 a64613 a64614 a64615 a64616 a64617 a64618 a64619 a64620 a64621 a64622 a64623 a64624 a64625 a64626 a64627 a64628 a64629 a64630 a64631 a64632 a64633 a64634 a64635 a64636 a64637 a64638 a64639 a64640 a64641 a64642 a64643 a64644 a64645 a64646 a64647 a64648 a64649 a64650 a64651 a64652 a64653 a64654 a64655 a64656 a64657 a64658 a64659 a64660 a64661 a64662 a64663 a64664 a64665 a64666 a64667 a64668 a64669 a64670 a64671 a64672 a64673 a64674 a64675 a64676 a64677 a64678 a64679 a64680 a64681 a64682 a64683 a64684 a64685 a64686 a64687 a64688 a64689 a64690 a64691 a64692 a64693 a64694 a64695 a64696 a64697 a64698 a64699 a64700 a64701 a64702 a64703 a64704 a64705 a64706 a64707 a64708 a64709 a64710 a64711 a64712 a64713 a64714 a64715 a64716 a64717 a64718 a64719 a64720 a64721 a64722 a64723 a64724 a64725 a64726 a64727 a64728 a64729 a64730 a64731 a64732 a64733 a64734 a64735 a64736 a64737 a64738 a64739 a64740 a64741 a64742 a64743 a64744 a64745 a64746 a64747 a64748 a64749 a64750 a64751 a64752 a64753 a64754 a64755 a64756 a64757 a64758 a64759 a64760 a64761 a64762 a64763 a64764 a64765 a64766 a64767 a64768 a64769 a64770 a64771 a64772 a64773 a64774 a64775 a64776 a64777 a64778 a64779 a64780 a64781 a64782 a64783 a64784 a64785 a64786 a64787 a64788 a64789 a64790 a64791 a64792 a64793 a64794 a64795 a64796 a64797 a64798 a64799 a64800 a64801 a64802 a64803 a64804 a64805 a64806 a64807 a64808 a64809 a64810 a64811 a64812 a64813 a64814 a64815 a64816 a64817 a64818 a64819 a64820 a64821 a64822 a64823 a64824 a64825 a64826 a64827 a64828 a64829 a64830 a64831 a64832 a64833 a64834 a64835 a64836 a64837 a64838 a64839 a64840 a64841 a64842 a64843 a64844 a64845 a64846 a64847 a64848 a64849 a64850 a64851 a64852 a64853 a64854 a64855 a64856 a64857 a64858 a64859 a64860 a64861 a64862 a64863 a64864 a64865 a64866 a64867 a64868 a64869 a64870 a64871 a64872 a64873 a64874 a64875 a64876 a64877 a64878 a64879 a64880 a64881 a64882 a64883 a64884 a64885 a64886 a64887 a64888 a64889 a64890 a64891 a64892 a64893 a64894 a64895 a64896 a64897 a64898 a64899 a64900 a64901 a64902 a64903 a64904 a64905 a64906 a64907 a64908 a64909 a64910 a64911 a64912 a64913 a64914 a64915 a64916 a64917 a64918 a64919 a64920 a64921 a64922 a64923 a64924 a64925 a64926 a64927 a64928 a64929 a64930 a64931 a64932 a64933 a64934 a64935 a64936 a64937 a64938 a64939 a64940 a64941 a64942 a64943 a64944 a64945 a64946 a64947 a64948 a64949 a64950 a64951 a64952 a64953 a64954 a64955 a64956 a64957 a64958 a64959 a64960 a64961 a64962 a64963 a64964 a64965 a64966 a64967 a64968 a64969 a64970 a64971 a64972 a64973 a64974 a64975 a64976 a64977 a64978 a64979 a64980 a64981 a64982 a64983 a64984 a64985 a64986 a64987 a64988 a64989 a64990 a64991 a64992 a64993 a64994 a64995 a64996 a64997 a64998 a64999 a65000 a65001 a65002 a65003 a65004 a65005 a65006 a65007 a65008 a65009 a65010 a65011 a65012 a65013 a65014 a65015 a65016 a65017 a65018 a65019 a65020 a65021 a65022 a65023 a65024 a65025 a65026 a65027 a65028 a65029 a65030 a65031 a65032 a65033 a65034 a65035 a65036 a65037 a65038 a65039 a65040 a65041 a65042 a65043 a65044 a65045 a65046 a65047 a65048 a65049 a65050 a65051 a65052 a65053 a65054 a65055 a65056 a65057 a65058 a65059 a65060 a65061 a65062 a65063 a65064 a65065 a65066 a65067 a65068 a65069 a65070 a65071 a65072 a65073 a65074 a65075 a65076 a65077 a65078 a65079 a65080 a65081 a65082 a65083 a65084 a65085 a65086 a65087 a65088 a65089 a65090 a65091 a65092 a65093 a65094 a65095 a65096 a65097 a65098 a65099 a65100 a65101 a65102 a65103 a65104 a65105 a65106 a65107 a65108 a65109 a65110 a65111 a65112 a65113 a65114 a65115 a65116 a65117 a65118 a65119 a65120 a65121 a65122 a65123 a65124 a65125 a65126 a65127 a65128 a65129 a65130 a65131 a65132 a65133 a65134 a65135 a65136 a65137 a65138 a65139 a65140 a65141 a65142 a65143 a65144 a65145 a65146 a65147 a65148 a65149 a65150 a65151 a65152 a65153 a65154 a65155 a65156 a65157 a65158 a65159 a65160 a65161 a65162 a65163 a65164 a65165 a65166 a65167 a65168 a65169 a65170 a65171 a65172 a65173 a65174 a65175 a65176 a65177 a65178 a65179 a65180 a65181 a65182 a65183 a65184 a65185 a65186 a65187 a65188 a65189 a65190 a65191 a65192 a65193 a65194 a65195 a65196 a65197 a65198 a65199 a65200 a65201 a65202 a65203 a65204 a65205 a65206 a65207 a65208 a65209 a65210 a65211 a65212 a65213 a65214 a65215 a65216 a65217 a65218 a65219 a65220 a65221 a65222 a65223 a65224 a65225 a65226 a65227 a65228 a65229 a65230 a65231 a65232 a65233 a65234 a65235 a65236 a65237 a65238 a65239 a65240 a65241 a65242 a65243 a65244 a65245 a65246 a65247 a65248 a65249 a65250 a65251 a65252 a65253 a65254 a65255 a65256 a65257 a65258 a65259 a65260 a65261 a65262 a65263 a65264 a65265 a65266 a65267 a65268 a65269 a65270 a65271 a65272 a65273 a65274 a65275 a65276 a65277 a65278 a65279 a65280 a65281 a65282 a65283 a65284 a65285 a65286 a65287 a65288 a65289 a65290 a65291 a65292 a65293 a65294 a65295 a65296 a65297 a65298 a65299 a65300 a65301 a65302 a65303 a65304 a65305 a65306 a65307 a65308 a65309 a65310 a65311 a65312 a65313 a65314 a65315 a65316 a65317 a65318 a65319 a65320 a65321 a65322 a65323 a65324 a65325 a65326 a65327 a65328 a65329 a65330 a65331 a65332 a65333 a65334 a65335 a65336 a65337 a65338 a65339 a65340 a65341 a65342 a65343 a65344 a65345 a65346 a65347 a65348 a65349 a65350 a65351 a65352 a65353 a65354 a65355 a65356 a65357 a65358 a65359 a65360 a65361 a65362 a65363 a65364 a65365 a65366 a65367 a65368 a65369 a65370 a65371 a65372 a65373 a65374 a65375 a65376 a65377 a65378 a65379 a65380 a65381 a65382 a65383 a65384 a65385 a65386 a65387 a65388 a65389 a65390 a65391 a65392 a65393 a65394 a65395 a65396 a65397 a65398 a65399 a65400 a65401 a65402 a65403 a65404 a65405 a65406 a65407 a65408 a65409 a65410 a65411 a65412 a65413 a65414 a65415 a65416 a65417 a65418 a65419 a65420 a65421 a65422 a65423 a65424 a65425 a65426 a65427 a65428 a65429 a65430 a65431 a65432 a65433 a65434 a65435 a65436 a65437 a65438 a65439 a65440 a65441 a65442 a65443 a65444 a65445 a65446 a65447 a65448 a65449 a65450 a65451 a65452 a65453 a65454 a65455 a65456 a65457 a65458 a65459 a65460 a65461 a65462 a65463 a65464 a65465 a65466 a65467 a65468 a65469 a65470 a65471 a65472 a65473 a65474 a65475 a65476 a65477 a65478 a65479 a65480 a65481 a65482 a65483 a65484 a65485 a65486 a65487 a65488 a65489 a65490 a65491 a65492 a65493 a65494 a65495 a65496 a65497 a65498 a65499 a65500 a65501 a65502 a65503 a65504 a65505 a65506 a65507 a65508 a65509 a65510 a65511 a65512 a65513 a65514 a65515 a65516 a65517 a65518 a65519 a65520 a65521 a65522 a65523 a65524 a65525 a65526 a65527 a65528 a65529 a65530 a65531 a65532 a65533 a65534 a65535 a65536 a65537 a65538 a65539 a65540 a65541 a65542 a65543 a65544 a65545 a65546 a65547 a65548 a65549 a65550 a65551 a65552 a65553 a65554 a65555 a65556 a65557 a65558 a65559 a65560 a65561 a65562 a65563 a65564 a65565 a65566 a65567 a65568 a65569 a65570 a65571 a65572 a65573 a65574 a65575 a65576 a65577 a65578 a65579 a65580 a65581 a65582 a65583 a65584 a65585 a65586 a65587 a65588 a65589 a65590 a65591 a65592 a65593 a65594 a65595 a65596 a65597 a65598 a65599 a65600 a65601 a65602 a65603 a65604 a65605 a65606 a65607 a65608 a65609 a65610 a65611 a65612 a65613 a65614 a65615 a65616 a65617 a65618 a65619 a65620 a65621 a65622 a65623 a65624 a65625 a65626 a65627 a65628 a65629 a65630 a65631 a65632 a65633 a65634 a65635 a65636 a65637 a65638 a65639 a65640 a65641 a65642 a65643 a65644 a65645 a65646 a65647 a65648 a65649 a65650 a65651 a65652 a65653 a65654 a65655 a65656 a65657 a65658 a65659 a65660 a65661 a65662 a65663 a65664 a65665 a65666 a65667 a65668 a65669 a65670 a65671 a65672 a65673 a65674 a65675 a65676 a65677 a65678 a65679 a65680 a65681 a65682 a65683 a65684 a65685 a65686 a65687 a65688 a65689 a65690 a65691 a65692 a65693 a65694 a65695 a65696 a65697 a65698 a65699 a65700 a65701 a65702 a65703 a65704 a65705 a65706 a65707 a65708 a65709 a65710 a65711 a65712 a65713 a65714 a65715 a65716 a65717 a65718 a65719 a65720 a65721 a65722 a65723 a65724 a65725 a65726 a65727 a65728 a65729 a65730 a65731 a65732 a65733 a65734 a65735 a65736 a65737 a65738 a65739 a65740 a65741 a65742 a65743 a65744 a65745 a65746 a65747 a65748 a65749 a65750 a65751 a65752 a65753 a65754 a65755 a65756 a65757 a65758 a65759 a65760 a65761 a65762 a65763 a65764 a65765 a65766 a65767 a65768 a65769 a65770 a65771 a65772 a65773 a65774 a65775 a65776 a65777 a65778 a65779 a65780 a65781 a65782 a65783 a65784 a65785 a65786 a65787 a65788 a65789 a65790 a65791 a65792 a65793 a65794 a65795 a65796 a65797 a65798 a65799 a65800 a65801 a65802 a65803 a65804 a65805 a65806 a65807 a65808 a65809 a65810 a65811 a65812 a65813 a65814 a65815 a65816 a65817 a65818 a65819 a65820 a65821 a65822 a65823 a65824 a65825 a65826 a65827 a65828 a65829 a65830 a65831 a65832 a65833 a65834 a65835 a65836 a65837 a65838 a65839 a65840 a65841 a65842 a65843 a65844 a65845 a65846 a65847 a65848 a65849 a65850 a65851 a65852 a65853 a65854 a65855 a65856 a65857 a65858 a65859 a65860 a65861 a65862 a65863 a65864 a65865 a65866 a65867 a65868 a65869 a65870 a65871 a65872 a65873 a65874 a65875 a65876 a65877 a65878 a65879 a65880 a65881 a65882 a65883 a65884 a65885 a65886 a65887 a65888 a65889 a65890 a65891 a65892 a65893 a65894 a65895 a65896 a65897 a65898 a65899 a65900 a65901 a65902 a65903 a65904 a65905 a65906 a65907 a65908 a65909 a65910 a65911 a65912 a65913 a65914 a65915 a65916 a65917 a65918 a65919 a65920 a65921 a65922 a65923 a65924 a65925 a65926 a65927 a65928 a65929 a65930 a65931 a65932 a65933 a65934 a65935 a65936 a65937 a65938 a65939 a65940 a65941 a65942 a65943 a65944 a65945 a65946 a65947 a65948 a65949 a65950 a65951 a65952 a65953 a65954 a65955 a65956 a65957 a65958 a65959 a65960 a65961 a65962 a65963 a65964 a65965 a65966 a65967 a65968 a65969 a65970 a65971 a65972 a65973 a65974 a65975 a65976 a65977 a65978 a65979 a65980 a65981 a65982 a65983 a65984 a65985 a65986 a65987 a65988 a65989 a65990 a65991 a65992 a65993 a65994 a65995 a65996 a65997 a65998 a65999 a66000 a66001 a66002 a66003 a66004 a66005 a66006 a66007 a66008 a66009 a66010 a66011 a66012 a66013 a66014 a66015 a66016 a66017 a66018 a66019 a66020 a66021 a66022 a66023 a66024 a66025 a66026 a66027 a66028 a66029 a66030 a66031 a66032 a66033 a66034 a66035 a66036 a66037 a66038 a66039 a66040 a66041 a66042 a66043 a66044 a66045 a66046 a66047 a66048 a66049 a66050 a66051 a66052 a66053 a66054 a66055 a66056 a66057 a66058 a66059 a66060 a66061 a66062 a66063 a66064 a66065 a66066 a66067 a66068 a66069 a66070 a66071 a66072 a66073 a66074 a66075 a66076 a66077 a66078 a66079 a66080 a66081 a66082 a66083 a66084 a66085 a66086 a66087 a66088 a66089 a66090 a66091 a66092 a66093 a66094 a66095 a66096 a66097 a66098 a66099 a66100 a66101 a66102 a66103 a66104 a66105 a66106 a66107 a66108 a66109 a66110 a66111 a66112 a66113 a66114 a66115 a66116 a66117 a66118 a66119 a66120 a66121 a66122 a66123 a66124 a66125 a66126 a66127 a66128 a66129 a66130 a66131 a66132 a66133 a66134 a66135 a66136 a66137 a66138 a66139 a66140 a66141 a66142 a66143 a66144 a66145 a66146 a66147 a66148 a66149 a66150 a66151 a66152 a66153 a66154 a66155 a66156 a66157 a66158 a66159 a66160 a66161 a66162 a66163 a66164 a66165 a66166 a66167 a66168 a66169 a66170 a66171 a66172 a66173 a66174 a66175 a66176 a66177 a66178 a66179 a66180 a66181 a66182 a66183 a66184 a66185 a66186 a66187 a66188 a66189 a66190 a66191 a66192 a66193 a66194 a66195 a66196 a66197 a66198 a66199 a66200 a66201 a66202 a66203 a66204 a66205 a66206 a66207 a66208 a66209 a66210 a66211 a66212 a66213 a66214 a66215 a66216 a66217 a66218 a66219 a66220 a66221 a66222 a66223 a66224 a66225 a66226 a66227 a66228 a66229 a66230 a66231 a66232 a66233 a66234 a66235 a66236 a66237 a66238 a66239 a66240 a66241 a66242 a66243 a66244 a66245 a66246 a66247 a66248 a66249 a66250 a66251 a66252 a66253 a66254 a66255 a66256 a66257 a66258 a66259 a66260 a66261 a66262 a66263 a66264 a66265 a66266 a66267 a66268 a66269 a66270 a66271 a66272 a66273 a66274 a66275 a66276 a66277 a66278 a66279 a66280 a66281 a66282 a66283 a66284 a66285 a66286 a66287 a66288 a66289 a66290 a66291 a66292 a66293 a66294 a66295 a66296 a66297 a66298 a66299 a66300 a66301 a66302 a66303 a66304 a66305 a66306 a66307 a66308 a66309 a66310 a66311 a66312 a66313 a66314 a66315 a66316 a66317 a66318 a66319 a66320 a66321 a66322 a66323 a66324 a66325 a66326 a66327 a66328 a66329 a66330 a66331 a66332 a66333 a66334 a66335 a66336 a66337 a66338 a66339 a66340 a66341 a66342 a66343 a66344 a66345 a66346 a66347 a66348 a66349 a66350 a66351 a66352 a66353 a66354 a66355 a66356 a66357 a66358 a66359 a66360 a66361 a66362 a66363 a66364 a66365 a66366 a66367 a66368 a66369 a66370 a66371 a66372 a66373 a66374 a66375 a66376 a66377 a66378 a66379 a66380 a66381 a66382 a66383 a66384 a66385 a66386 a66387 a66388 a66389 a66390 a66391 a66392 a66393 a66394 a66395 a66396 a66397 a66398 a66399 a66400 a66401 a66402 a66403 a66404 a66405 a66406 a66407 a66408 a66409 a66410 a66411 a66412 a66413 a66414 a66415 a66416 a66417 a66418 a66419 a66420 a66421 a66422 a66423 a66424 a66425 a66426 a66427 a66428 a66429 a66430 a66431 a66432 a66433 a66434 a66435 a66436 a66437 a66438 a66439 a66440 a66441 a66442 a66443 a66444 a66445 a66446 a66447 a66448 a66449 a66450 a66451 a66452 a66453 a66454 a66455 a66456 a66457 a66458 a66459 a66460 a66461 a66462 a66463 a66464 a66465 a66466 a66467 a66468 a66469 a66470 a66471 a66472 a66473 a66474 a66475 a66476 a66477 a66478 a66479 a66480 a66481 a66482 a66483 a66484 a66485 a66486 a66487 a66488 a66489 a66490 a66491 a66492 a66493 a66494 a66495 a66496 a66497 a66498 a66499 a66500 a66501 a66502 a66503 a66504 a66505 a66506 a66507 a66508 a66509 a66510 a66511 a66512 a66513 a66514 a66515 a66516 a66517 a66518 a66519 a66520 a66521 a66522 a66523 a66524 a66525 a66526 a66527 a66528 a66529 a66530 a66531 a66532 a66533 a66534 a66535 a66536 a66537 a66538 a66539 a66540 a66541 a66542 a66543 a66544 a66545 a66546 a66547 a66548 a66549 a66550 a66551 a66552 a66553 a66554 a66555 a66556 a66557 a66558 a66559 a66560 a66561 a66562 a66563 a66564 a66565 a66566 a66567 a66568 a66569 a66570 a66571 a66572 a66573 a66574 a66575 a66576 a66577 a66578 a66579 a66580 a66581 a66582 a66583 a66584 a66585 a66586 a66587 a66588 a66589 a66590 a66591 a66592 a66593 a66594 a66595 a66596 a66597 a66598 a66599 a66600 a66601 a66602 a66603 a66604 a66605 a66606 a66607 a66608 a66609 a66610 a66611 a66612 a66613 a66614 a66615 a66616 a66617 a66618 a66619 a66620 a66621 a66622 a66623 a66624 a66625 a66626 a66627 a66628 a66629 a66630 a66631 a66632 a66633 a66634 a66635 a66636 a66637 a66638 a66639 a66640 a66641 a66642 a66643 a66644 a66645 a66646 a66647 a66648 a66649 a66650 a66651 a66652 a66653 a66654 a66655 a66656 a66657 a66658 a66659 a66660 a66661 a66662 a66663 a66664 a66665 a66666 a66667 a66668 a66669 a66670 a66671 a66672 a66673 a66674 a66675 a66676 a66677 a66678 a66679 a66680 a66681 a66682 a66683 a66684 a66685 a66686 a66687 a66688 a66689 a66690 a66691 a66692 a66693 a66694 a66695 a66696 a66697 a66698 a66699 a66700 a66701 a66702 a66703 a66704 a66705 a66706 a66707 a66708 a66709 a66710 a66711 a66712 a66713 a66714 a66715 a66716 a66717 a66718 a66719 a66720 a66721 a66722 a66723 a66724 a66725 a66726 a66727 a66728 a66729 a66730 a66731 a66732 a66733 a66734 a66735 a66736 a66737 a66738 a66739 a66740 a66741 a66742 a66743 a66744 a66745 a66746 a66747 a66748 a66749 a66750 a66751 a66752 a66753 a66754 a66755 a66756 a66757 a66758 a66759 a66760 a66761 a66762 a66763 a66764 a66765 a66766 a66767 a66768 a66769 a66770 a66771 a66772 a66773 a66774 a66775 a66776 a66777 a66778 a66779 a66780 a66781 a66782 a66783 a66784 a66785 a66786 a66787 a66788 a66789 a66790 a66791 a66792 a66793 a66794 a66795 a66796 a66797 a66798 a66799 a66800 a66801 a66802 a66803 a66804 a66805 a66806 a66807 a66808 a66809 a66810 a66811 a66812 a66813 a66814 a66815 a66816 a66817 a66818 a66819 a66820 a66821 a66822 a66823 a66824 a66825 a66826 a66827 a66828 a66829 a66830 a66831 a66832 a66833 a66834 a66835 a66836 a66837 a66838 a66839 a66840 a66841 a66842 a66843 a66844 a66845 a66846 a66847 a66848 a66849 a66850 a66851 a66852 a66853 a66854 a66855 a66856 a66857 a66858 a66859 a66860 a66861 a66862 a66863 a66864 a66865 a66866 a66867 a66868 a66869 a66870 a66871 a66872 a66873 a66874 a66875 a66876 a66877 a66878 a66879 a66880 a66881 a66882 a66883 a66884 a66885 a66886 a66887 a66888 a66889 a66890 a66891 a66892 a66893 a66894 a66895 a66896 a66897 a66898 a66899 a66900 a66901 a66902 a66903 a66904 a66905 a66906 a66907 a66908 a66909 a66910 a66911 a66912 a66913 a66914 a66915 a66916 a66917 a66918 a66919 a66920 a66921 a66922 a66923 a66924 a66925 a66926 a66927 a66928 a66929 a66930 a66931 a66932 a66933 a66934 a66935 a66936 a66937 a66938 a66939 a66940 a66941 a66942 a66943 a66944 a66945 a66946 a66947 a66948 a66949 a66950 a66951 a66952 a66953 a66954 a66955 a66956 a66957 a66958 a66959 a66960 a66961 a66962 a66963 a66964 a66965 a66966 a66967 a66968 a66969 a66970 a66971 a66972 a66973 a66974 a66975 a66976 a66977 a66978 a66979 a66980 a66981 a66982 a66983 a66984 a66985 a66986 a66987 a66988 a66989 a66990 a66991 a66992 a66993 a66994 a66995 a66996 a66997 a66998 a66999 a67000 a67001 a67002 a67003 a67004 a67005 a67006 a67007 a67008 a67009 a67010 a67011 a67012 a67013 a67014 a67015 a67016 a67017 a67018 a67019 a67020 a67021 a67022 a67023 a67024 a67025 a67026 a67027 a67028 a67029 a67030 a67031 a67032 a67033 a67034 a67035 a67036 a67037 a67038 a67039 a67040 a67041 a67042 a67043 a67044 a67045 a67046 a67047 a67048 a67049 a67050 a67051 a67052 a67053 a67054 a67055 a67056 a67057 a67058 a67059 a67060 a67061 a67062 a67063 a67064 a67065 a67066 a67067 a67068 a67069 a67070 a67071 a67072 a67073 a67074 a67075 a67076 a67077 a67078 a67079 a67080 a67081 a67082 a67083 a67084 a67085 a67086 a67087 a67088 a67089 a67090 a67091 a67092 a67093 a67094 a67095 a67096 a67097 a67098 a67099 a67100 a67101 a67102 a67103 a67104 a67105 a67106 a67107 a67108 a67109 a67110 a67111 a67112 a67113 a67114 a67115 a67116 a67117 a67118 a67119 a67120 a67121 a67122 a67123 a67124 a67125 a67126 a67127 a67128 a67129 a67130 a67131 a67132 a67133 a67134 a67135 a67136 a67137 a67138 a67139 a67140 a67141 a67142 a67143 a67144 a67145 a67146 a67147 a67148 a67149 a67150 a67151 a67152 a67153 a67154 a67155 a67156 a67157 a67158 a67159 a67160 a67161 a67162 a67163 a67164 a67165 a67166 a67167 a67168 a67169 a67170 a67171 a67172 a67173 a67174 a67175 a67176 a67177 a67178 a67179 a67180 a67181 a67182 a67183 a67184 a67185 a67186 a67187 a67188 a67189 a67190 a67191 a67192 a67193 a67194 a67195 a67196 a67197 a67198 a67199 a67200 a67201 a67202 a67203 a67204 a67205 a67206 a67207 a67208 a67209 a67210 a67211 a67212 a67213 a67214 a67215 a67216 a67217 a67218 a67219 a67220 a67221 a67222 a67223 a67224 a67225 a67226 a67227 a67228 a67229 a67230 a67231 a67232 a67233 a67234 a67235 a67236 a67237 a67238 a67239 a67240 a67241 a67242 a67243 a67244 a67245 a67246 a67247 a67248 a67249 a67250 a67251 a67252 a67253 a67254 a67255 a67256 a67257 a67258 a67259 a67260 a67261 a67262 a67263 a67264 a67265 a67266 a67267 a67268 a67269 a67270 a67271 a67272 a67273 a67274 a67275 a67276 a67277 a67278 a67279 a67280 a67281 a67282 a67283 a67284 a67285 a67286 a67287 a67288 a67289 a67290 a67291 a67292 a67293 a67294 a67295 a67296 a67297 a67298 a67299 a67300 a67301 a67302 a67303 a67304 a67305 a67306 a67307 a67308 a67309 a67310 a67311 a67312 a67313 a67314 a67315 a67316 a67317 a67318 a67319 a67320 a67321 a67322 a67323 a67324 a67325 a67326 a67327 a67328 a67329 a67330 a67331 a67332 a67333 a67334 a67335 a67336 a67337 a67338 a67339 a67340 a67341 a67342 a67343 a67344 a67345 a67346 a67347 a67348 a67349 a67350 a67351 a67352 a67353 a67354 a67355 a67356 a67357 a67358 a67359 a67360 a67361 a67362 a67363 a67364 a67365 a67366 a67367 a67368 a67369 a67370 a67371 a67372 a67373 a67374 a67375 a67376 a67377 a67378 a67379 a67380 a67381 a67382 a67383 a67384 a67385 a67386 a67387 a67388 a67389 a67390 a67391 a67392 a67393 a67394 a67395 a67396 a67397 a67398 a67399 a67400 a67401 a67402 a67403 a67404 a67405 a67406 a67407 a67408 a67409 a67410 a67411 a67412 a67413 a67414 a67415 a67416 a67417 a67418 a67419 a67420 a67421 a67422 a67423 a67424 a67425 a67426 a67427 a67428 a67429 a67430 a67431 a67432 a67433 a67434 a67435 a67436 a67437 a67438 a67439 a67440 a67441 a67442 a67443 a67444 a67445 a67446 a67447 a67448 a67449 a67450 a67451 a67452 a67453 a67454 a67455 a67456 a67457 a67458 a67459 a67460 a67461 a67462 a67463 a67464 a67465 a67466 a67467 a67468 a67469 a67470 a67471 a67472 a67473 a67474 a67475 a67476 a67477 a67478 a67479 a67480 a67481 a67482 a67483 a67484 a67485 a67486 a67487 a67488 a67489 a67490 a67491 a67492 a67493 a67494 a67495 a67496 a67497 a67498 a67499 a67500 a67501 a67502 a67503 a67504 a67505 a67506 a67507 a67508 a67509 a67510 a67511 a67512 a67513 a67514 a67515 a67516 a67517 a67518 a67519 a67520 a67521 a67522 a67523 a67524 a67525 a67526 a67527 a67528 a67529 a67530 a67531 a67532 a67533 a67534 a67535 a67536 a67537 a67538 a67539 a67540 a67541 a67542 a67543 a67544 a67545 a67546 a67547 a67548 a67549 a67550 a67551 a67552 a67553 a67554 a67555 a67556 a67557 a67558 a67559 a67560 a67561 a67562 a67563 a67564 a67565 a67566 a67567 a67568 a67569 a67570 a67571 a67572 a67573 a67574 a67575 a67576 a67577 a67578 a67579 a67580 a67581 a67582 a67583 a67584 a67585 a67586 a67587 a67588 a67589 a67590 a67591 a67592 a67593 a67594 a67595 a67596 a67597 a67598 a67599 a67600 a67601 a67602 a67603 a67604 a67605 a67606 a67607 a67608 a67609 a67610 a67611 a67612 a67613 a67614 a67615 a67616 a67617 a67618 a67619 a67620 a67621 a67622 a67623 a67624 a67625 a67626 a67627 a67628 a67629 a67630 a67631 a67632 a67633 a67634 a67635 a67636 a67637 a67638 a67639 a67640 a67641 a67642 a67643 a67644 a67645 a67646 a67647 a67648 a67649 a67650 a67651 a67652 a67653 a67654 a67655 a67656 a67657 a67658 a67659 a67660 a67661 a67662 a67663 a67664 a67665 a67666 a67667 a67668 a67669 a67670 a67671 a67672 a67673 a67674 a67675 a67676 a67677 a67678 a67679 a67680 a67681 a67682 a67683 a67684 a67685 a67686 a67687 a67688 a67689 a67690 a67691 a67692 a67693 a67694 a67695 a67696 a67697 a67698 a67699 a67700 a67701 a67702 a67703 a67704 a67705 a67706 a67707 a67708 a67709 a67710 a67711 a67712 a67713 a67714 a67715 a67716 a67717 a67718 a67719 a67720 a67721 a67722 a67723 a67724 a67725 a67726 a67727 a67728 a67729 a67730 a67731 a67732 a67733 a67734 a67735 a67736 a67737 a67738 a67739 a67740 a67741 a67742 a67743 a67744 a67745 a67746 a67747 a67748 a67749 a67750 a67751 a67752 a67753 a67754 a67755 a67756 a67757 a67758 a67759 a67760 a67761 a67762 a67763 a67764 a67765 a67766 a67767 a67768 a67769 a67770 a67771 a67772 a67773 a67774 a67775 a67776 a67777 a67778 a67779 a67780 a67781 a67782 a67783 a67784 a67785 a67786 a67787 a67788 a67789 a67790 a67791 a67792 a67793 a67794 a67795 a67796 a67797 a67798 a67799 a67800 a67801 a67802 a67803 a67804 a67805 a67806 a67807 a67808 a67809 a67810 a67811 a67812 a67813 a67814 a67815 a67816 a67817 a67818 a67819 a67820 a67821 a67822 a67823 a67824 a67825 a67826 a67827 a67828 a67829 a67830 a67831 a67832 a67833 a67834 a67835 a67836 a67837 a67838 a67839 a67840 a67841 a67842 a67843 a67844 a67845 a67846 a67847 a67848 a67849 a67850 a67851 a67852 a67853 a67854 a67855 a67856 a67857 a67858 a67859 a67860 a67861 a67862 a67863 a67864 a67865 a67866 a67867 a67868 a67869 a67870 a67871 a67872 a67873 a67874 a67875 a67876 a67877 a67878 a67879 a67880 a67881 a67882 a67883 a67884 a67885 a67886 a67887 a67888 a67889 a67890 a67891 a67892 a67893 a67894 a67895 a67896 a67897 a67898 a67899 a67900 a67901 a67902 a67903 a67904 a67905 a67906 a67907 a67908 a67909 a67910 a67911 a67912 a67913 a67914 a67915 a67916 a67917 a67918 a67919 a67920 a67921 a67922 a67923 a67924 a67925 a67926 a67927 a67928 a67929 a67930 a67931 a67932 a67933 a67934 a67935 a67936 a67937 a67938 a67939 a67940 a67941 a67942 a67943 a67944 a67945 a67946 a67947 a67948 a67949 a67950 a67951 a67952 a67953 a67954 a67955 a67956 a67957 a67958 a67959 a67960 a67961 a67962 a67963 a67964 a67965 a67966 a67967 a67968 a67969 a67970 a67971 a67972 a67973 a67974 a67975 a67976 a67977 a67978 a67979 a67980 a67981 a67982 a67983 a67984 a67985 a67986 a67987 a67988 a67989 a67990 a67991 a67992 a67993 a67994 a67995 a67996 a67997 a67998 a67999 a68000 a68001 a68002 a68003 a68004 a68005 a68006 a68007 a68008 a68009 a68010 a68011 a68012 a68013 a68014 a68015 a68016 a68017 a68018 a68019 a68020 a68021 a68022 a68023 a68024 a68025 a68026 a68027 a68028 a68029 a68030 a68031 a68032 a68033 a68034 a68035 a68036 a68037 a68038 a68039 a68040 a68041 a68042 a68043 a68044 a68045 a68046 a68047 a68048 a68049 a68050 a68051 a68052 a68053 a68054 a68055 a68056 a68057 a68058 a68059 a68060 a68061 a68062 a68063 a68064 a68065 a68066 a68067 a68068 a68069 a68070 a68071 a68072 a68073 a68074 a68075 a68076 a68077 a68078 a68079 a68080 a68081 a68082 a68083 a68084 a68085 a68086 a68087 a68088 a68089 a68090 a68091 a68092 a68093 a68094 a68095 a68096 a68097 a68098 a68099 a68100 a68101 a68102 a68103 a68104 a68105 a68106 a68107 a68108 a68109 a68110 a68111 a68112 a68113 a68114 a68115 a68116 a68117 a68118 a68119 a68120 a68121 a68122 a68123 a68124 a68125 a68126 a68127 a68128 a68129 a68130 a68131 a68132 a68133 a68134 a68135 a68136 a68137 a68138 a68139 a68140 a68141 a68142 a68143 a68144 a68145 a68146 a68147 a68148 a68149 a68150 a68151 a68152 a68153 a68154 a68155 a68156 a68157 a68158 a68159 a68160 a68161 a68162 a68163 a68164 a68165 a68166 a68167 a68168 a68169 a68170 a68171 a68172 a68173 a68174 a68175 a68176 a68177 a68178 a68179 a68180 a68181 a68182 a68183 a68184 a68185 a68186 a68187 a68188 a68189 a68190 a68191 a68192 a68193 a68194 a68195 a68196 a68197 a68198 a68199 a68200 a68201 a68202 a68203 a68204 a68205 a68206 a68207 a68208 a68209 a68210 a68211 a68212 a68213 a68214 a68215 a68216 a68217 a68218 a68219 a68220 a68221 a68222 a68223 a68224 a68225 a68226 a68227 a68228 a68229 a68230 a68231 a68232 a68233 a68234 a68235 a68236 a68237 a68238 a68239 a68240 a68241 a68242 a68243 a68244 a68245 a68246 a68247 a68248 a68249 a68250 a68251 a68252 a68253 a68254 a68255 a68256 a68257 a68258 a68259 a68260 a68261 a68262 a68263 a68264 a68265 a68266 a68267 a68268 a68269 a68270 a68271 a68272 a68273 a68274 a68275 a68276 a68277 a68278 a68279 a68280 a68281 a68282 a68283 a68284 a68285 a68286 a68287 a68288 a68289 a68290 a68291 a68292 a68293 a68294 a68295 a68296 a68297 a68298 a68299 a68300 a68301 a68302 a68303 a68304 a68305 a68306 a68307 a68308 a68309 a68310 a68311 a68312 a68313 a68314 a68315 a68316 a68317 a68318 a68319 a68320 a68321 a68322 a68323 a68324 a68325 a68326 a68327 a68328 a68329 a68330 a68331 a68332 a68333 a68334 a68335 a68336 a68337 a68338 a68339 a68340 a68341 a68342 a68343 a68344 a68345 a68346 a68347 a68348 a68349 a68350 a68351 a68352 a68353 a68354 a68355 a68356 a68357 a68358 a68359 a68360 a68361 a68362 a68363 a68364 a68365 a68366 a68367 a68368 a68369 a68370 a68371 a68372 a68373 a68374 a68375 a68376 a68377 a68378 a68379 a68380 a68381 a68382 a68383 a68384 a68385 a68386 a68387 a68388 a68389 a68390 a68391 a68392 a68393 a68394 a68395 a68396 a68397 a68398 a68399 a68400 a68401 a68402 a68403 a68404 a68405 a68406 a68407 a68408 a68409 a68410 a68411 a68412 a68413 a68414 a68415 a68416 a68417 a68418 a68419 a68420 a68421 a68422 a68423 a68424 a68425 a68426 a68427 a68428 a68429 a68430 a68431 a68432 a68433 a68434 a68435 a68436 a68437 a68438 a68439 a68440 a68441 a68442 a68443 a68444 a68445 a68446 a68447 a68448 a68449 a68450 a68451 a68452 a68453 a68454 a68455 a68456 a68457 a68458 a68459 a68460 a68461 a68462 a68463 a68464 a68465 a68466 a68467 a68468 a68469 a68470 a68471 a68472 a68473 a68474 a68475 a68476 a68477 a68478 a68479 a68480 a68481 a68482 a68483 a68484 a68485 a68486 a68487 a68488 a68489 a68490 a68491 a68492 a68493 a68494 a68495 a68496 a68497 a68498 a68499 a68500 a68501 a68502 a68503 a68504 a68505 a68506 a68507 a68508 a68509 a68510 a68511 a68512 a68513 a68514 a68515 a68516 a68517 a68518 a68519 a68520 a68521 a68522 a68523 a68524 a68525 a68526 a68527 a68528 a68529 a68530 a68531 a68532 a68533 a68534 a68535 a68536 a68537 a68538 a68539 a68540 a68541 a68542 a68543 a68544 a68545 a68546 a68547 a68548 a68549 a68550 a68551 a68552 a68553 a68554 a68555 a68556 a68557 a68558 a68559 a68560 a68561 a68562 a68563 a68564 a68565 a68566 a68567 a68568 a68569 a68570 a68571 a68572 a68573 a68574 a68575 a68576 a68577 a68578 a68579 a68580 a68581 a68582 a68583 a68584 a68585 a68586 a68587 a68588 a68589 a68590 a68591 a68592 a68593 a68594 a68595 a68596 a68597 a68598 a68599 a68600 a68601 a68602 a68603 a68604 a68605 a68606 a68607 a68608 a68609 a68610 a68611 a68612 a68613 a68614 a68615 a68616 a68617 a68618 a68619 a68620 a68621 a68622 a68623 a68624 a68625 a68626 a68627 a68628 a68629 a68630 a68631 a68632 a68633 a68634 a68635 a68636 a68637 a68638 a68639 a68640 a68641 a68642 a68643 a68644 a68645 a68646 a68647 a68648 a68649 a68650 a68651 a68652 a68653 a68654 a68655 a68656 a68657 a68658 a68659 a68660 a68661 a68662 a68663 a68664 a68665 a68666 a68667 a68668 a68669 a68670 a68671 a68672 a68673 a68674 a68675 a68676 a68677 a68678 a68679 a68680 a68681 a68682 a68683 a68684 a68685 a68686 a68687 a68688 a68689 a68690 a68691 a68692 a68693 a68694 a68695 a68696 a68697 a68698 a68699 a68700 a68701 a68702 a68703 a68704 a68705 a68706 a68707 a68708 a68709 a68710 a68711 a68712 a68713 a68714 a68715 a68716 a68717 a68718 a68719 a68720 a68721 a68722 a68723 a68724 a68725 a68726 a68727 a68728 a68729 a68730 a68731 a68732 a68733 a68734 a68735 a68736 a68737 a68738 a68739 a68740 a68741 a68742 a68743 a68744 a68745 a68746 a68747 a68748 a68749 a68750 a68751 a68752 a68753 a68754 a68755 a68756 a68757 a68758 a68759 a68760 a68761 a68762 a68763 a68764 a68765 a68766 a68767 a68768 a68769 a68770 a68771 a68772 a68773 a68774 a68775 a68776 a68777 a68778 a68779 a68780 a68781 a68782 a68783 a68784 a68785 a68786 a68787 a68788 a68789 a68790 a68791 a68792 a68793 a68794 a68795 a68796 a68797 a68798 a68799 a68800 a68801 a68802 a68803 a68804 a68805 a68806 a68807 a68808 a68809 a68810 a68811 a68812 a68813 a68814 a68815 a68816 a68817 a68818 a68819 a68820 a68821 a68822 a68823 a68824 a68825 a68826 a68827 a68828 a68829 a68830 a68831 a68832 a68833 a68834 a68835 a68836 a68837 a68838 a68839 a68840 a68841 a68842 a68843 a68844 a68845 a68846 a68847 a68848 a68849 a68850 a68851 a68852 a68853 a68854 a68855 a68856 a68857 a68858 a68859 a68860 a68861 a68862 a68863 a68864 a68865 a68866 a68867 a68868 a68869 a68870 a68871 a68872 a68873 a68874 a68875 a68876 a68877 a68878 a68879 a68880 a68881 a68882 a68883 a68884 a68885 a68886 a68887 a68888 a68889 a68890 a68891 a68892 a68893 a68894 a68895 a68896 a68897 a68898 a68899 a68900 a68901 a68902 a68903 a68904 a68905 a68906 a68907 a68908 a68909 a68910 a68911 a68912 a68913 a68914 a68915 a68916 a68917 a68918 a68919 a68920 a68921 a68922 a68923 a68924 a68925 a68926 a68927 a68928 a68929 a68930 a68931 a68932 a68933 a68934 a68935 a68936 a68937 a68938 a68939 a68940 a68941 a68942 a68943 a68944 a68945 a68946 a68947 a68948 a68949 a68950 a68951 a68952 a68953 a68954 a68955 a68956 a68957 a68958 a68959 a68960 a68961 a68962 a68963 a68964 a68965 a68966 a68967 a68968 a68969 a68970 a68971 a68972 a68973 a68974 a68975 a68976 a68977 a68978 a68979 a68980 a68981 a68982 a68983 a68984 a68985 a68986 a68987 a68988 a68989 a68990 a68991 a68992 a68993 a68994 a68995 a68996 a68997 a68998 a68999 a69000 a69001 a69002 a69003 a69004 a69005 a69006 a69007 a69008 a69009 a69010 a69011 a69012 a69013 a69014 a69015 a69016 a69017 a69018 a69019 a69020 a69021 a69022 a69023 a69024 a69025 a69026 a69027 a69028 a69029 a69030 a69031 a69032 a69033 a69034 a69035 a69036 a69037 a69038 a69039 a69040 a69041 a69042 a69043 a69044 a69045 a69046 a69047 a69048 a69049 a69050 a69051 a69052 a69053 a69054 a69055 a69056 a69057 a69058 a69059 a69060 a69061 a69062 a69063 a69064 a69065 a69066 a69067 a69068 a69069 a69070 a69071 a69072 a69073 a69074 a69075 a69076 a69077 a69078 a69079 a69080 a69081 a69082 a69083 a69084 a69085 a69086 a69087 a69088 a69089 a69090 a69091 a69092 a69093 a69094 a69095 a69096 a69097 a69098 a69099 a69100 a69101 a69102 a69103 a69104 a69105 a69106 a69107 a69108 a69109 a69110 a69111 a69112 a69113 a69114 a69115 a69116 a69117 a69118 a69119 a69120 a69121 a69122 a69123 a69124 a69125 a69126 a69127 a69128 a69129 a69130 a69131 a69132 a69133 a69134 a69135 a69136 a69137 a69138 a69139 a69140 a69141 a69142 a69143 a69144 a69145 a69146 a69147 a69148 a69149 a69150 a69151 a69152 a69153 a69154 a69155 a69156 a69157 a69158 a69159 a69160 a69161 a69162 a69163 a69164 a69165 a69166 a69167 a69168 a69169 a69170 a69171 a69172 a69173 a69174 a69175 a69176 a69177 a69178 a69179 a69180 a69181 a69182 a69183 a69184 a69185 a69186 a69187 a69188 a69189 a69190 a69191 a69192 a69193 a69194 a69195 a69196 a69197 a69198 a69199 a69200 a69201 a69202 a69203 a69204 a69205 a69206 a69207 a69208 a69209 a69210 a69211 a69212 a69213 a69214 a69215 a69216 a69217 a69218 a69219 a69220 a69221 a69222 a69223 a69224 a69225 a69226 a69227 a69228 a69229 a69230 a69231 a69232 a69233 a69234 a69235 a69236 a69237 a69238 a69239 a69240 a69241 a69242 a69243 a69244 a69245 a69246 a69247 a69248 a69249 a69250 a69251 a69252 a69253 a69254 a69255 a69256 a69257 a69258 a69259 a69260 a69261 a69262 a69263 a69264 a69265 a69266 a69267 a69268 a69269 a69270 a69271 a69272 a69273 a69274 a69275 a69276 a69277 a69278 a69279 a69280 a69281 a69282 a69283 a69284 a69285 a69286 a69287 a69288 a69289 a69290 a69291 a69292 a69293 a69294 a69295 a69296 a69297 a69298 a69299 a69300 a69301 a69302 a69303 a69304 a69305 a69306 a69307 a69308 a69309 a69310 a69311 a69312 a69313 a69314 a69315 a69316 a69317 a69318 a69319 a69320 a69321 a69322 a69323 a69324 a69325 a69326 a69327 a69328 a69329 a69330 a69331 a69332 a69333 a69334 a69335 a69336 a69337 a69338 a69339 a69340 a69341 a69342 a69343 a69344 a69345 a69346 a69347 a69348 a69349 a69350 a69351 a69352 a69353 a69354 a69355 a69356 a69357 a69358 a69359 a69360 a69361 a69362 a69363 a69364 a69365 a69366 a69367 a69368 a69369 a69370 a69371 a69372 a69373 a69374 a69375 a69376 a69377 a69378 a69379 a69380 a69381 a69382 a69383 a69384 a69385 a69386 a69387 a69388 a69389 a69390 a69391 a69392 a69393 a69394 a69395 a69396 a69397 a69398 a69399 a69400 a69401 a69402 a69403 a69404 a69405 a69406 a69407 a69408 a69409 a69410 a69411 a69412 a69413 a69414 a69415 a69416 a69417 a69418 a69419 a69420 a69421 a69422 a69423 a69424 a69425 a69426 a69427 a69428 a69429 a69430 a69431 a69432 a69433 a69434 a69435 a69436 a69437 a69438 a69439 a69440 a69441 a69442 a69443 a69444 a69445 a69446 a69447 a69448 a69449 a69450 a69451 a69452 a69453 a69454 a69455 a69456 a69457 a69458 a69459 a69460 a69461 a69462 a69463 a69464 a69465 a69466 a69467 a69468 a69469 a69470 a69471 a69472 a69473 a69474 a69475 a69476 a69477 a69478 a69479 a69480 a69481 a69482 a69483 a69484 a69485 a69486 a69487 a69488 a69489 a69490 a69491 a69492 a69493 a69494 a69495 a69496 a69497 a69498 a69499 a69500 a69501 a69502 a69503 a69504 a69505 a69506 a69507 a69508 a69509 a69510 a69511 a69512 a69513 a69514 a69515 a69516 a69517 a69518 a69519 a69520 a69521 a69522 a69523 a69524 a69525 a69526 a69527 a69528 a69529 a69530 a69531 a69532 a69533 a69534 a69535 a69536 a69537 a69538 a69539 a69540 a69541 a69542 a69543 a69544 a69545 a69546 a69547 a69548 a69549 a69550 a69551 a69552 a69553 a69554 a69555 a69556 a69557 a69558 a69559 a69560 a69561 a69562 a69563 a69564 a69565 a69566 a69567 a69568 a69569 a69570 a69571 a69572 a69573 a69574 a69575 a69576 a69577 a69578 a69579 a69580 a69581 a69582 a69583 a69584 a69585 a69586 a69587 a69588 a69589 a69590 a69591 a69592 a69593 a69594 a69595 a69596 a69597 a69598 a69599 a69600 a69601 a69602 a69603 a69604 a69605 a69606 a69607 a69608 a69609 a69610 a69611 a69612 a69613 a69614 a69615 a69616 a69617 a69618 a69619 a69620 a69621 a69622 a69623 a69624 a69625 a69626 a69627 a69628 a69629 a69630 a69631 a69632 a69633 a69634 a69635 a69636 a69637 a69638 a69639 a69640 a69641 a69642 a69643 a69644 a69645 a69646 a69647 a69648 a69649 a69650 a69651 a69652 a69653 a69654 a69655 a69656 a69657 a69658 a69659 a69660 a69661 a69662 a69663 a69664 a69665 a69666 a69667 a69668 a69669 a69670 a69671 a69672 a69673 a69674 a69675 a69676 a69677 a69678 a69679 a69680 a69681 a69682 a69683 a69684 a69685 a69686 a69687 a69688 a69689 a69690 a69691 a69692 a69693 a69694 a69695 a69696 a69697 a69698 a69699 a69700 a69701 a69702 a69703 a69704 a69705 a69706 a69707 a69708 a69709 a69710 a69711 a69712 a69713 a69714 a69715 a69716 a69717 a69718 a69719 a69720 a69721 a69722 a69723 a69724 a69725 a69726 a69727 a69728 a69729 a69730 a69731 a69732 a69733 a69734 a69735 a69736 a69737 a69738 a69739 a69740 a69741 a69742 a69743 a69744 a69745 a69746 a69747 a69748 a69749 a69750 a69751 a69752 a69753 a69754 a69755 a69756 a69757 a69758 a69759 a69760 a69761 a69762 a69763 a69764 a69765 a69766 a69767 a69768 a69769 a69770 a69771 a69772 a69773 a69774 a69775 a69776 a69777 a69778 a69779 a69780 a69781 a69782 a69783 a69784 a69785 a69786 a69787 a69788 a69789 a69790 a69791 a69792 a69793 a69794 a69795 a69796 a69797 a69798 a69799 a69800 a69801 a69802 a69803 a69804 a69805 a69806 a69807 a69808 a69809 a69810 a69811 a69812 a69813 a69814 a69815 a69816 a69817 a69818 a69819 a69820 a69821 a69822 a69823 a69824 a69825 a69826 a69827 a69828 a69829 a69830 a69831 a69832 a69833 a69834 a69835 a69836 a69837 a69838 a69839 a69840 a69841 a69842 a69843 a69844 a69845 a69846 a69847 a69848 a69849 a69850 a69851 a69852 a69853 a69854 a69855 a69856 a69857 a69858 a69859 a69860 a69861 a69862 a69863 a69864 a69865 a69866 a69867 a69868 a69869 a69870 a69871 a69872 a69873 a69874 a69875 a69876 a69877 a69878 a69879 a69880 a69881 a69882 a69883 a69884 a69885 a69886 a69887 a69888 a69889 a69890 a69891 a69892 a69893 a69894 a69895 a69896 a69897 a69898 a69899 a69900 a69901 a69902 a69903 a69904 a69905 a69906 a69907 a69908 a69909 a69910 a69911 a69912 a69913 a69914 a69915 a69916 a69917 a69918 a69919 a69920 a69921 a69922 a69923 a69924 a69925 a69926 a69927 a69928 a69929 a69930 a69931 a69932 a69933 a69934 a69935 a69936 a69937 a69938 a69939 a69940 a69941 a69942 a69943 a69944 a69945 a69946 a69947 a69948 a69949 a69950 a69951 a69952 a69953 a69954 a69955 a69956 a69957 a69958 a69959 a69960 a69961 a69962 a69963 a69964 a69965 a69966 a69967 a69968 a69969 a69970 a69971 a69972 a69973 a69974 a69975 a69976 a69977 a69978 a69979 a69980 a69981 a69982 a69983 a69984 a69985 a69986 a69987 a69988 a69989 a69990 a69991 a69992 a69993 a69994 a69995 a69996 a69997 a69998 a69999 a70000 a70001 a70002 a70003 a70004 a70005 a70006 a70007 a70008 a70009 a70010 a70011 a70012 a70013 a70014 a70015 a70016 a70017 a70018 a70019 a70020 a70021 a70022 a70023 a70024 a70025 a70026 a70027 a70028 a70029 a70030 a70031 a70032 a70033 a70034 a70035 a70036 a70037 a70038 a70039 a70040 a70041 a70042 a70043 a70044 a70045 a70046 a70047 a70048 a70049 a70050 a70051 a70052 a70053 a70054 a70055 a70056 a70057 a70058 a70059 a70060 a70061 a70062 a70063 a70064 a70065 a70066 a70067 a70068 a70069 a70070 a70071 a70072 a70073 a70074 a70075 a70076 a70077 a70078 a70079 a70080 a70081 a70082 a70083 a70084 a70085 a70086 a70087 a70088 a70089 a70090 a70091 a70092 a70093 a70094 a70095 a70096 a70097 a70098 a70099 a70100 a70101 a70102 a70103 a70104 a70105 a70106 a70107 a70108 a70109 a70110 a70111 a70112 a70113 a70114 a70115 a70116 a70117 a70118 a70119 a70120 a70121 a70122 a70123 a70124 a70125 a70126 a70127 a70128 a70129 a70130 a70131 a70132 a70133 a70134 a70135 a70136 a70137 a70138 a70139 a70140 a70141 a70142 a70143 a70144 a70145 a70146 a70147 a70148 a70149 a70150 a70151 a70152 a70153 a70154 a70155 a70156 a70157 a70158 a70159 a70160 a70161 a70162 a70163 a70164 a70165 a70166 a70167 a70168 a70169 a70170 a70171 a70172 a70173 a70174 a70175 a70176 a70177 a70178 a70179 a70180 a70181 a70182 a70183 a70184 a70185 a70186 a70187 a70188 a70189 a70190 a70191 a70192 a70193 a70194 a70195 a70196 a70197 a70198 a70199 a70200 a70201 a70202 a70203 a70204 a70205 a70206 a70207 a70208 a70209 a70210 a70211 a70212 a70213 a70214 a70215 a70216 a70217 a70218 a70219 a70220 a70221 a70222 a70223 a70224 a70225 a70226 a70227 a70228 a70229 a70230 a70231 a70232 a70233 a70234 a70235 a70236 a70237 a70238 a70239 a70240 a70241 a70242 a70243 a70244 a70245 a70246 a70247 a70248 a70249 a70250 a70251 a70252 a70253 a70254 a70255 a70256 a70257 a70258 a70259 a70260 a70261 a70262 a70263 a70264 a70265 a70266 a70267 a70268 a70269 a70270 a70271 a70272 a70273 a70274 a70275 a70276 a70277 a70278 a70279 a70280 a70281 a70282 a70283 a70284 a70285 a70286 a70287 a70288 a70289 a70290 a70291 a70292 a70293 a70294 a70295 a70296 a70297 a70298 a70299 a70300 a70301 a70302 a70303 a70304 a70305 a70306 a70307 a70308 a70309 a70310 a70311 a70312 a70313 a70314 a70315 a70316 a70317 a70318 a70319 a70320 a70321 a70322 a70323 a70324 a70325 a70326 a70327 a70328 a70329 a70330 a70331 a70332 a70333 a70334 a70335 a70336 a70337 a70338 a70339 a70340 a70341 a70342 a70343 a70344 a70345 a70346 a70347 a70348 a70349 a70350 a70351 a70352 a70353 a70354 a70355 a70356 a70357 a70358 a70359 a70360 a70361 a70362 a70363 a70364 a70365 a70366 a70367 a70368 a70369 a70370 a70371 a70372 a70373 a70374 a70375 a70376 a70377 a70378 a70379 a70380 a70381 a70382 a70383 a70384 a70385 a70386 a70387 a70388 a70389 a70390 a70391 a70392 a70393 a70394 a70395 a70396 a70397 a70398 a70399 a70400 a70401 a70402 a70403 a70404 a70405 a70406 a70407 a70408 a70409 a70410 a70411 a70412 a70413 a70414 a70415 a70416 a70417 a70418 a70419 a70420 a70421 a70422 a70423 a70424 a70425 a70426 a70427 a70428 a70429 a70430 a70431 a70432 a70433 a70434 a70435 a70436 a70437 a70438 a70439 a70440 a70441 a70442 a70443 a70444 a70445 a70446 a70447 a70448 a70449 a70450 a70451 a70452 a70453 a70454 a70455 a70456 a70457 a70458 a70459 a70460 a70461 a70462 a70463 a70464 a70465 a70466 a70467 a70468 a70469 a70470 a70471 a70472 a70473 a70474 a70475 a70476 a70477 a70478 a70479 a70480 a70481 a70482 a70483 a70484 a70485 a70486 a70487 a70488 a70489 a70490 a70491 a70492 a70493 a70494 a70495 a70496 a70497 a70498 a70499 a70500 a70501 a70502 a70503 a70504 a70505 a70506 a70507 a70508 a70509 a70510 a70511 a70512 a70513 a70514 a70515 a70516 a70517 a70518 a70519 a70520 a70521 a70522 a70523 a70524 a70525 a70526 a70527 a70528 a70529 a70530 a70531 a70532 a70533 a70534 a70535 a70536 a70537 a70538 a70539 a70540 a70541 a70542 a70543 a70544 a70545 a70546 a70547 a70548 a70549 a70550 a70551 a70552 a70553 a70554 a70555 a70556 a70557 a70558 a70559 a70560 a70561 a70562 a70563 a70564 a70565 a70566 a70567 a70568 a70569 a70570 a70571 a70572 a70573 a70574 a70575 a70576 a70577 a70578 a70579 a70580 a70581 a70582 a70583 a70584 a70585 a70586 a70587 a70588 a70589 a70590 a70591 a70592 a70593 a70594 a70595 a70596 a70597 a70598 a70599 a70600 a70601 a70602 a70603 a70604 a70605 a70606 a70607 a70608 a70609 a70610 a70611 a70612 a70613 a70614 a70615 a70616 a70617 a70618 a70619 a70620 a70621 a70622 a70623 a70624 a70625 a70626 a70627 a70628 a70629 a70630 a70631 a70632 a70633 a70634 a70635 a70636 a70637 a70638 a70639 a70640 a70641 a70642 a70643 a70644 a70645 a70646 a70647 a70648 a70649 a70650 a70651 a70652 a70653 a70654 a70655 a70656 a70657 a70658 a70659 a70660 a70661 a70662 a70663 a70664 a70665 a70666 a70667 a70668 a70669 a70670 a70671 a70672 a70673 a70674 a70675 a70676 a70677 a70678 a70679 a70680 a70681 a70682 a70683 a70684 a70685 a70686 a70687 a70688 a70689 a70690 a70691 a70692 a70693 a70694 a70695 a70696 a70697 a70698 a70699 a70700 a70701 a70702 a70703 a70704 a70705 a70706 a70707 a70708 a70709 a70710 a70711 a70712 a70713 a70714 a70715 a70716 a70717 a70718 a70719 a70720 a70721 a70722 a70723 a70724 a70725 a70726 a70727 a70728 a70729 a70730 a70731 a70732 a70733 a70734 a70735 a70736 a70737 a70738 a70739 a70740 a70741 a70742 a70743 a70744 a70745 a70746 a70747 a70748 a70749 a70750 a70751 a70752 a70753 a70754 a70755 a70756 a70757 a70758 a70759 a70760 a70761 a70762 a70763 a70764 a70765 a70766 a70767 a70768 a70769 a70770 a70771 a70772 a70773 a70774 a70775 a70776 a70777 a70778 a70779 a70780 a70781 a70782 a70783 a70784 a70785 a70786 a70787 a70788 a70789 a70790 a70791 a70792 a70793 a70794 a70795 a70796 a70797 a70798 a70799 a70800 a70801 a70802 a70803 a70804 a70805 a70806 a70807 a70808 a70809 a70810 a70811 a70812 a70813 a70814 a70815 a70816 a70817 a70818 a70819 a70820 a70821 a70822 a70823 a70824 a70825 a70826 a70827 a70828 a70829 a70830 a70831 a70832 a70833 a70834 a70835 a70836 a70837 a70838 a70839 a70840 a70841 a70842 a70843 a70844 a70845 a70846 a70847 a70848 a70849 a70850 a70851 a70852 a70853 a70854 a70855 a70856 a70857 a70858 a70859 a70860 a70861 a70862 a70863 a70864 a70865 a70866 a70867 a70868 a70869 a70870 a70871 a70872 a70873 a70874 a70875 a70876 a70877 a70878 a70879 a70880 a70881 a70882 a70883 a70884 a70885 a70886 a70887 a70888 a70889 a70890 a70891 a70892 a70893 a70894 a70895 a70896 a70897 a70898 a70899 a70900 a70901 a70902 a70903 a70904 a70905 a70906 a70907 a70908 a70909 a70910 a70911 a70912 a70913 a70914 a70915 a70916 a70917 a70918 a70919 a70920 a70921 a70922 a70923 a70924 a70925 a70926 a70927 a70928 a70929 a70930 a70931 a70932 a70933 a70934 a70935 a70936 a70937 a70938 a70939 a70940 a70941 a70942 a70943 a70944 a70945 a70946 a70947 a70948 a70949 a70950 a70951 a70952 a70953 a70954 a70955 a70956 a70957 a70958 a70959 a70960 a70961 a70962 a70963 a70964 a70965 a70966 a70967 a70968 a70969 a70970 a70971 a70972 a70973 a70974 a70975 a70976 a70977 a70978 a70979 a70980 a70981 a70982 a70983 a70984 a70985 a70986 a70987 a70988 a70989 a70990 a70991 a70992 a70993 a70994 a70995 a70996 a70997 a70998 a70999 a71000 a71001 a71002 a71003 a71004 a71005 a71006 a71007 a71008 a71009 a71010 a71011 a71012 a71013 a71014 a71015 a71016 a71017 a71018 a71019 a71020 a71021 a71022 a71023 a71024 a71025 a71026 a71027 a71028 a71029 a71030 a71031 a71032 a71033 a71034 a71035 a71036 a71037 a71038 a71039 a71040 a71041 a71042 a71043 a71044 a71045 a71046 a71047 a71048 a71049 a71050 a71051 a71052 a71053 a71054 a71055 a71056 a71057 a71058 a71059 a71060 a71061 a71062 a71063 a71064 a71065 a71066 a71067 a71068 a71069 a71070 a71071 a71072 a71073 a71074 a71075 a71076 a71077 a71078 a71079 a71080 a71081 a71082 a71083 a71084 a71085 a71086 a71087 a71088 a71089 a71090 a71091 a71092 a71093 a71094 a71095 a71096 a71097 a71098 a71099 a71100 a71101 a71102 a71103 a71104 a71105 a71106 a71107 a71108 a71109 a71110 a71111 a71112 a71113 a71114 a71115 a71116 a71117 a71118 a71119 a71120 a71121 a71122 a71123 a71124 a71125 a71126 a71127 a71128 a71129 a71130 a71131 a71132 a71133 a71134 a71135 a71136 a71137 a71138 a71139 a71140 a71141 a71142 a71143 a71144 a71145 a71146 a71147 a71148 a71149 a71150 a71151 a71152 a71153 a71154 a71155 a71156 a71157 a71158 a71159 a71160 a71161 a71162 a71163 a71164 a71165 a71166 a71167 a71168 a71169 a71170 a71171 a71172 a71173 a71174 a71175 a71176 a71177 a71178 a71179 a71180 a71181 a71182 a71183 a71184 a71185 a71186 a71187 a71188 a71189 a71190 a71191 a71192 a71193 a71194 a71195 a71196 a71197 a71198 a71199 a71200 a71201 a71202 a71203 a71204 a71205 a71206 a71207 a71208 a71209 a71210 a71211 a71212 a71213 a71214 a71215 a71216 a71217 a71218 a71219 a71220 a71221 a71222 a71223 a71224 a71225 a71226 a71227 a71228 a71229 a71230 a71231 a71232 a71233 a71234 a71235 a71236 a71237 a71238 a71239 a71240 a71241 a71242 a71243 a71244 a71245 a71246 a71247 a71248 a71249 a71250 a71251 a71252 a71253 a71254 a71255 a71256 a71257 a71258 a71259 a71260 a71261 a71262 a71263 a71264 a71265 a71266 a71267 a71268 a71269 a71270 a71271 a71272 a71273 a71274 a71275 a71276 a71277 a71278 a71279 a71280 a71281 a71282 a71283 a71284 a71285 a71286 a71287 a71288 a71289 a71290 a71291 a71292 a71293 a71294 a71295 a71296 a71297 a71298 a71299 a71300 a71301 a71302 a71303 a71304 a71305 a71306 a71307 a71308 a71309 a71310 a71311 a71312 a71313 a71314 a71315 a71316 a71317 a71318 a71319 a71320 a71321 a71322 a71323 a71324 a71325 a71326 a71327 a71328 a71329 a71330 a71331 a71332 a71333 a71334 a71335 a71336 a71337 a71338 a71339 a71340 a71341 a71342 a71343 a71344 a71345 a71346 a71347 a71348 a71349 a71350 a71351 a71352 a71353 a71354 a71355 a71356 a71357 a71358 a71359 a71360 a71361 a71362 a71363 a71364 a71365 a71366 a71367 a71368 a71369 a71370 a71371 a71372 a71373 a71374 a71375 a71376 a71377 a71378 a71379 a71380 a71381 a71382 a71383 a71384 a71385 a71386 a71387 a71388 a71389 a71390 a71391 a71392 a71393 a71394 a71395 a71396 a71397 a71398 a71399 a71400 a71401 a71402 a71403 a71404 a71405 a71406 a71407 a71408 a71409 a71410 a71411 a71412 a71413 a71414 a71415 a71416 a71417 a71418 a71419 a71420 a71421 a71422 a71423 a71424 a71425 a71426 a71427 a71428 a71429 a71430 a71431 a71432 a71433 a71434 a71435 a71436 a71437 a71438 a71439 a71440 a71441 a71442 a71443 a71444 a71445 a71446 a71447 a71448 a71449 a71450 a71451 a71452 a71453 a71454 a71455 a71456 a71457 a71458 a71459 a71460 a71461 a71462 a71463 a71464 a71465 a71466 a71467 a71468 a71469 a71470 a71471 a71472 a71473 a71474 a71475 a71476 a71477 a71478 a71479 a71480 a71481 a71482 a71483 a71484 a71485 a71486 a71487 a71488 a71489 a71490 a71491 a71492 a71493 a71494 a71495 a71496 a71497 a71498 a71499 a71500 a71501 a71502 a71503 a71504 a71505 a71506 a71507 a71508 a71509 a71510 a71511 a71512 a71513 a71514 a71515 a71516 a71517 a71518 a71519 a71520 a71521 a71522 a71523 a71524 a71525 a71526 a71527 a71528 a71529 a71530 a71531 a71532 a71533 a71534 a71535 a71536 a71537 a71538 a71539 a71540 a71541 a71542 a71543 a71544 a71545 a71546 a71547 a71548 a71549 a71550 a71551 a71552 a71553 a71554 a71555 a71556 a71557 a71558 a71559 a71560 a71561 a71562 a71563 a71564 a71565 a71566 a71567 a71568 a71569 a71570 a71571 a71572 a71573 a71574 a71575 a71576 a71577 a71578 a71579 a71580 a71581 a71582 a71583 a71584 a71585 a71586 a71587 a71588 a71589 a71590 a71591 a71592 a71593 a71594 a71595 a71596 a71597 a71598 a71599 a71600 a71601 a71602 a71603 a71604 a71605 a71606 a71607 a71608 a71609 a71610 a71611 a71612 a71613 a71614 a71615 a71616 a71617 a71618 a71619 a71620 a71621 a71622 a71623 a71624 a71625 a71626 a71627 a71628 a71629 a71630 a71631 a71632 a71633 a71634 a71635 a71636 a71637 a71638 a71639 a71640 a71641 a71642 a71643 a71644 a71645 a71646 a71647 a71648 a71649 a71650 a71651 a71652 a71653 a71654 a71655 a71656 a71657 a71658 a71659 a71660 a71661 a71662 a71663 a71664 a71665 a71666 a71667 a71668 a71669 a71670 a71671 a71672 a71673 a71674 a71675 a71676 a71677 a71678 a71679 a71680 a71681 a71682 a71683 a71684 a71685 a71686 a71687 a71688 a71689 a71690 a71691 a71692 a71693 a71694 a71695 a71696 a71697 a71698 a71699 a71700 a71701 a71702 a71703 a71704 a71705 a71706 a71707 a71708 a71709 a71710 a71711 a71712 a71713 a71714 a71715 a71716 a71717 a71718 a71719 a71720 a71721 a71722 a71723 a71724 a71725 a71726 a71727 a71728 a71729 a71730 a71731 a71732 a71733 a71734 a71735 a71736 a71737 a71738 a71739 a71740 a71741 a71742 a71743 a71744 a71745 a71746 a71747 a71748 a71749 a71750 a71751 a71752 a71753 a71754 a71755 a71756 a71757 a71758 a71759 a71760 a71761 a71762 a71763 a71764 a71765 a71766 a71767 a71768 a71769 a71770 a71771 a71772 a71773 a71774 a71775 a71776 a71777 a71778 a71779 a71780 a71781 a71782 a71783 a71784 a71785 a71786 a71787 a71788 a71789 a71790 a71791 a71792 a71793 a71794 a71795 a71796 a71797 a71798 a71799 a71800 a71801 a71802 a71803 a71804 a71805 a71806 a71807 a71808 a71809 a71810 a71811 a71812 a71813 a71814 a71815 a71816 a71817 a71818 a71819 a71820 a71821 a71822 a71823 a71824 a71825 a71826 a71827 a71828 a71829 a71830 a71831 a71832 a71833 a71834 a71835 a71836 a71837 a71838 a71839 a71840 a71841 a71842 a71843 a71844 a71845 a71846 a71847 a71848 a71849 a71850 a71851 a71852 a71853 a71854 a71855 a71856 a71857 a71858 a71859 a71860 a71861 a71862 a71863 a71864 a71865 a71866 a71867 a71868 a71869 a71870 a71871 a71872 a71873 a71874 a71875 a71876 a71877 a71878 a71879 a71880 a71881 a71882 a71883 a71884 a71885 a71886 a71887 a71888 a71889 a71890 a71891 a71892 a71893 a71894 a71895 a71896 a71897 a71898 a71899 a71900 a71901 a71902 a71903 a71904 a71905 a71906 a71907 a71908 a71909 a71910 a71911 a71912 a71913 a71914 a71915 a71916 a71917 a71918 a71919 a71920 a71921 a71922 a71923 a71924 a71925 a71926 a71927 a71928 a71929 a71930 a71931 a71932 a71933 a71934 a71935 a71936 a71937 a71938 a71939 a71940 a71941 a71942 a71943 a71944 a71945 a71946 a71947 a71948 a71949 a71950 a71951 a71952 a71953 a71954 a71955 a71956 a71957 a71958 a71959 a71960 a71961 a71962 a71963 a71964 a71965 a71966 a71967 a71968 a71969 a71970 a71971 a71972 a71973 a71974 a71975 a71976 a71977 a71978 a71979 a71980 a71981 a71982 a71983 a71984 a71985 a71986 a71987 a71988 a71989 a71990 a71991 a71992 a71993 a71994 a71995 a71996 a71997 a71998 a71999 a72000 a72001 a72002 a72003 a72004 a72005 a72006 a72007 a72008 a72009 a72010 a72011 a72012 a72013 a72014 a72015 a72016 a72017 a72018 a72019 a72020 a72021 a72022 a72023 a72024 a72025 a72026 a72027 a72028 a72029 a72030 a72031 a72032 a72033 a72034 a72035 a72036 a72037 a72038 a72039 a72040 a72041 a72042 a72043 a72044 a72045 a72046 a72047 a72048 a72049 a72050 a72051 a72052 a72053 a72054 a72055 a72056 a72057 a72058 a72059 a72060 a72061 a72062 a72063 a72064 a72065 a72066 a72067 a72068 a72069 a72070 a72071 a72072 a72073 a72074 a72075 a72076 a72077 a72078 a72079 a72080 a72081 a72082 a72083 a72084 a72085 a72086 a72087 a72088 a72089 a72090 a72091 a72092 a72093 a72094 a72095 a72096 a72097 a72098 a72099 a72100 a72101 a72102 a72103 a72104 a72105 a72106 a72107 a72108 a72109 a72110 a72111 a72112 a72113 a72114 a72115 a72116 a72117 a72118 a72119 a72120 a72121 a72122 a72123 a72124 a72125 a72126 a72127 a72128 a72129 a72130 a72131 a72132 a72133 a72134 a72135 a72136 a72137 a72138 a72139 a72140 a72141 a72142 a72143 a72144 a72145 a72146 a72147 a72148 a72149 a72150 a72151 a72152 a72153 a72154 a72155 a72156 a72157 a72158 a72159 a72160 a72161 a72162 a72163 a72164 a72165 a72166 a72167 a72168 a72169 a72170 a72171 a72172 a72173 a72174 a72175 a72176 a72177 a72178 a72179 a72180 a72181 a72182 a72183 a72184 a72185 a72186 a72187 a72188 a72189 a72190 a72191 a72192 a72193 a72194 a72195 a72196 a72197 a72198 a72199 a72200 a72201 a72202 a72203 a72204 a72205 a72206 a72207 a72208 a72209 a72210 a72211 a72212 a72213 a72214 a72215 a72216 a72217 a72218 a72219 a72220 a72221 a72222 a72223 a72224 a72225 a72226 a72227 a72228 a72229 a72230 a72231 a72232 a72233 a72234 a72235 a72236 a72237 a72238 a72239 a72240 a72241 a72242 a72243 a72244 a72245 a72246 a72247 a72248 a72249 a72250 a72251 a72252 a72253 a72254 a72255 a72256 a72257 a72258 a72259 a72260 a72261 a72262 a72263 a72264 a72265 a72266 a72267 a72268 a72269 a72270 a72271 a72272 a72273 a72274 a72275 a72276 a72277 a72278 a72279 a72280 a72281 a72282 a72283 a72284 a72285 a72286 a72287 a72288 a72289 a72290 a72291 a72292 a72293 a72294 a72295 a72296 a72297 a72298 a72299 a72300 a72301 a72302 a72303 a72304 a72305 a72306 a72307 a72308 a72309 a72310 a72311 a72312 a72313 a72314 a72315 a72316 a72317 a72318 a72319 a72320 a72321 a72322 a72323 a72324 a72325 a72326 a72327 a72328 a72329 a72330 a72331 a72332 a72333 a72334 a72335 a72336 a72337 a72338 a72339 a72340 a72341 a72342 a72343 a72344 a72345 a72346 a72347 a72348 a72349 a72350 a72351 a72352 a72353 a72354 a72355 a72356 a72357 a72358 a72359 a72360 a72361 a72362 a72363 a72364 a72365 a72366 a72367 a72368 a72369 a72370 a72371 a72372 a72373 a72374 a72375 a72376 a72377 a72378 a72379 a72380 a72381 a72382 a72383 a72384 a72385 a72386 a72387 a72388 a72389 a72390 a72391 a72392 a72393 a72394 a72395 a72396 a72397 a72398 a72399 a72400 a72401 a72402 a72403 a72404 a72405 a72406 a72407 a72408 a72409 a72410 a72411 a72412 a72413 a72414 a72415 a72416 a72417 a72418 a72419 a72420 a72421 a72422 a72423 a72424 a72425 a72426 a72427 a72428 a72429 a72430 a72431 a72432 a72433 a72434 a72435 a72436 a72437 a72438 a72439 a72440 a72441 a72442 a72443 a72444 a72445 a72446 a72447 a72448 a72449 a72450 a72451 a72452 a72453 a72454 a72455 a72456 a72457 a72458 a72459 a72460 a72461 a72462 a72463 a72464 a72465 a72466 a72467 a72468 a72469 a72470 a72471 a72472 a72473 a72474 a72475 a72476 a72477 a72478 a72479 a72480 a72481 a72482 a72483 a72484 a72485 a72486 a72487 a72488 a72489 a72490 a72491 a72492 a72493 a72494 a72495 a72496 a72497 a72498 a72499 a72500 a72501 a72502 a72503 a72504 a72505 a72506 a72507 a72508 a72509 a72510 a72511 a72512 a72513 a72514 a72515 a72516 a72517 a72518 a72519 a72520 a72521 a72522 a72523 a72524 a72525 a72526 a72527 a72528 a72529 a72530 a72531 a72532 a72533 a72534 a72535 a72536 a72537 a72538 a72539 a72540 a72541 a72542 a72543 a72544 a72545 a72546 a72547 a72548 a72549 a72550 a72551 a72552 a72553 a72554 a72555 a72556 a72557 a72558 a72559 a72560 a72561 a72562 a72563 a72564 a72565 a72566 a72567 a72568 a72569 a72570 a72571 a72572 a72573 a72574 a72575 a72576 a72577 a72578 a72579 a72580 a72581 a72582 a72583 a72584 a72585 a72586 a72587 a72588 a72589 a72590 a72591 a72592 a72593 a72594 a72595 a72596 a72597 a72598 a72599 a72600 a72601 a72602 a72603 a72604 a72605 a72606 a72607 a72608 a72609 a72610 a72611 a72612 a72613 a72614 a72615 a72616 a72617 a72618 a72619 a72620 a72621 a72622 a72623 a72624 a72625 a72626 a72627 a72628 a72629 a72630 a72631 a72632 a72633 a72634 a72635 a72636 a72637 a72638 a72639 a72640 a72641 a72642 a72643 a72644 a72645 a72646 a72647 a72648 a72649 a72650 a72651 a72652 a72653 a72654 a72655 a72656 a72657 a72658 a72659 a72660 a72661 a72662 a72663 a72664 a72665 a72666 a72667 a72668 a72669 a72670 a72671 a72672 a72673 a72674 a72675 a72676 a72677 a72678 a72679 a72680 a72681 a72682 a72683 a72684 a72685 a72686 a72687 a72688 a72689 a72690 a72691 a72692 a72693 a72694 a72695 a72696 a72697 a72698 a72699 a72700 a72701 a72702 a72703 a72704 a72705 a72706 a72707 a72708 a72709 a72710 a72711 a72712 a72713 a72714 a72715 a72716 a72717 a72718 a72719 a72720 a72721 a72722 a72723 a72724 a72725 a72726 a72727 a72728 a72729 a72730 a72731 a72732 a72733 a72734 a72735 a72736 a72737 a72738 a72739 a72740 a72741 a72742 a72743 a72744 a72745 a72746 a72747 a72748 a72749 a72750 a72751 a72752 a72753 a72754 a72755 a72756 a72757 a72758 a72759 a72760 a72761 a72762 a72763 a72764 a72765 a72766 a72767 a72768 a72769 a72770 a72771 a72772 a72773 a72774 a72775 a72776 a72777 a72778 a72779 a72780 a72781 a72782 a72783 a72784 a72785 a72786 a72787 a72788 a72789 a72790 a72791 a72792 a72793 a72794 a72795 a72796 a72797 a72798 a72799 a72800 a72801 a72802 a72803 a72804 a72805 a72806 a72807 a72808 a72809 a72810 a72811 a72812 a72813 a72814 a72815 a72816 a72817 a72818 a72819 a72820 a72821 a72822 a72823 a72824 a72825 a72826 a72827 a72828 a72829 a72830 a72831 a72832 a72833 a72834 a72835 a72836 a72837 a72838 a72839 a72840 a72841 a72842 a72843 a72844 a72845 a72846 a72847 a72848 a72849 a72850 a72851 a72852 a72853 a72854 a72855 a72856 a72857 a72858 a72859 a72860 a72861 a72862 a72863 a72864 a72865 a72866 a72867 a72868 a72869 a72870 a72871 a72872 a72873 a72874 a72875 a72876 a72877 a72878 a72879 a72880 a72881 a72882 a72883 a72884 a72885 a72886 a72887 a72888 a72889 a72890 a72891 a72892 a72893 a72894 a72895 a72896 a72897 a72898 a72899 a72900 a72901 a72902 a72903 a72904 a72905 a72906 a72907 a72908 a72909 a72910 a72911 a72912 a72913 a72914 a72915 a72916 a72917 a72918 a72919 a72920 a72921 a72922 a72923 a72924 a72925 a72926 a72927 a72928 a72929 a72930 a72931 a72932 a72933 a72934 a72935 a72936 a72937 a72938 a72939 a72940 a72941 a72942 a72943 a72944 a72945 a72946 a72947 a72948 a72949 a72950 a72951 a72952 a72953 a72954 a72955 a72956 a72957 a72958 a72959 a72960 a72961 a72962 a72963 a72964 a72965 a72966 a72967 a72968 a72969 a72970 a72971 a72972 a72973 a72974 a72975 a72976 a72977 a72978 a72979 a72980 a72981 a72982 a72983 a72984 a72985 a72986 a72987 a72988 a72989 a72990 a72991 a72992 a72993 a72994 a72995 a72996 a72997 a72998 a72999 a73000 a73001 a73002 a73003 a73004 a73005 a73006 a73007 a73008 a73009 a73010 a73011 a73012 a73013 a73014 a73015 a73016 a73017 a73018 a73019 a73020 a73021 a73022 a73023 a73024 a73025 a73026 a73027 a73028 a73029 a73030 a73031 a73032 a73033 a73034 a73035 a73036 a73037 a73038 a73039 a73040 a73041 a73042 a73043 a73044 a73045 a73046 a73047 a73048 a73049 a73050 a73051 a73052 a73053 a73054 a73055 a73056 a73057 a73058 a73059 a73060 a73061 a73062 a73063 a73064 a73065 a73066 a73067 a73068 a73069 a73070 a73071 a73072 a73073 a73074 a73075 a73076 a73077 a73078 a73079 a73080 a73081 a73082 a73083 a73084 a73085 a73086 a73087 a73088 a73089 a73090 a73091 a73092 a73093 a73094 a73095 a73096 a73097 a73098 a73099 a73100 a73101 a73102 a73103 a73104 a73105 a73106 a73107 a73108 a73109 a73110 a73111 a73112 a73113 a73114 a73115 a73116 a73117 a73118 a73119 a73120 a73121 a73122 a73123 a73124 a73125 a73126 a73127 a73128 a73129 a73130 a73131 a73132 a73133 a73134 a73135 a73136 a73137 a73138 a73139 a73140 a73141 a73142 a73143 a73144 a73145 a73146 a73147 a73148 a73149 a73150 a73151 a73152 a73153 a73154 a73155 a73156 a73157 a73158 a73159 a73160 a73161 a73162 a73163 a73164 a73165 a73166 a73167 a73168 a73169 a73170 a73171 a73172 a73173 a73174 a73175 a73176 a73177 a73178 a73179 a73180 a73181 a73182 a73183 a73184 a73185 a73186 a73187 a73188 a73189 a73190 a73191 a73192 a73193 a73194 a73195 a73196 a73197 a73198 a73199 a73200 a73201 a73202 a73203 a73204 a73205 a73206 a73207 a73208 a73209 a73210 a73211 a73212 a73213 a73214 a73215 a73216 a73217 a73218 a73219 a73220 a73221 a73222 a73223 a73224 a73225 a73226 a73227 a73228 a73229 a73230 a73231 a73232 a73233 a73234 a73235 a73236 a73237 a73238 a73239 a73240 a73241 a73242 a73243 a73244 a73245 a73246 a73247 a73248 a73249 a73250 a73251 a73252 a73253 a73254 a73255 a73256 a73257 a73258 a73259 a73260 a73261 a73262 a73263 a73264 a73265 a73266 a73267 a73268 a73269 a73270 a73271 a73272 a73273 a73274 a73275 a73276 a73277 a73278 a73279 a73280 a73281 a73282 a73283 a73284 a73285 a73286 a73287 a73288 a73289 a73290 a73291 a73292 a73293 a73294 a73295 a73296 a73297 a73298 a73299 a73300 a73301 a73302 a73303 a73304 a73305 a73306 a73307 a73308 a73309 a73310 a73311 a73312 a73313 a73314 a73315 a73316 a73317 a73318 a73319 a73320 a73321 a73322 a73323 a73324 a73325 a73326 a73327 a73328 a73329 a73330 a73331 a73332 a73333 a73334 a73335 a73336 a73337 a73338 a73339 a73340 a73341 a73342 a73343 a73344 a73345 a73346 a73347 a73348 a73349 a73350 a73351 a73352 a73353 a73354 a73355 a73356 a73357 a73358 a73359 a73360 a73361 a73362 a73363 a73364 a73365 a73366 a73367 a73368 a73369 a73370 a73371 a73372 a73373 a73374 a73375 a73376 a73377 a73378 a73379 a73380 a73381 a73382 a73383 a73384 a73385 a73386 a73387 a73388 a73389 a73390 a73391 a73392 a73393 a73394 a73395 a73396 a73397 a73398 a73399 a73400 a73401 a73402 a73403 a73404 a73405 a73406 a73407 a73408 a73409 a73410 a73411 a73412 a73413 a73414 a73415 a73416 a73417 a73418 a73419 a73420 a73421 a73422 a73423 a73424 a73425 a73426 a73427 a73428 a73429 a73430 a73431 a73432 a73433 a73434 a73435 a73436 a73437 a73438 a73439 a73440 a73441 a73442 a73443 a73444 a73445 a73446 a73447 a73448 a73449 a73450 a73451 a73452 a73453 a73454 a73455 a73456 a73457 a73458 a73459 a73460 a73461 a73462 a73463 a73464 a73465 a73466 a73467 a73468 a73469 a73470 a73471 a73472 a73473 a73474 a73475 a73476 a73477 a73478 a73479 a73480 a73481 a73482 a73483 a73484 a73485 a73486 a73487 a73488 a73489 a73490 a73491 a73492 a73493 a73494 a73495 a73496 a73497 a73498 a73499 a73500 a73501 a73502 a73503 a73504 a73505 a73506 a73507 a73508 a73509 a73510 a73511 a73512 a73513 a73514 a73515 a73516 a73517 a73518 a73519 a73520 a73521 a73522 a73523 a73524 a73525 a73526 a73527 a73528 a73529 a73530 a73531 a73532 a73533 a73534 a73535 a73536 a73537 a73538 a73539 a73540 a73541 a73542 a73543 a73544 a73545 a73546 a73547 a73548 a73549 a73550 a73551 a73552 a73553 a73554 a73555 a73556 a73557 a73558 a73559 a73560 a73561 a73562 a73563 a73564 a73565 a73566 a73567 a73568 a73569 a73570 a73571 a73572 a73573 a73574 a73575 a73576 a73577 a73578 a73579 a73580 a73581 a73582 a73583 a73584 a73585 a73586 a73587 a73588 a73589 a73590 a73591 a73592 a73593 a73594 a73595 a73596 a73597 a73598 a73599 a73600 a73601 a73602 a73603 a73604 a73605 a73606 a73607 a73608 a73609 a73610 a73611 a73612 a73613 a73614 a73615 a73616 a73617 a73618 a73619 a73620 a73621 a73622 a73623 a73624 a73625 a73626 a73627 a73628 a73629 a73630 a73631 a73632 a73633 a73634 a73635 a73636 a73637 a73638 a73639 a73640 a73641 a73642 a73643 a73644 a73645 a73646 a73647 a73648 a73649 a73650 a73651 a73652 a73653 a73654 a73655 a73656 a73657 a73658 a73659 a73660 a73661 a73662 a73663 a73664 a73665 a73666 a73667 a73668 a73669 a73670 a73671 a73672 a73673 a73674 a73675 a73676 a73677 a73678 a73679 a73680 a73681 a73682 a73683 a73684 a73685 a73686 a73687 a73688 a73689 a73690 a73691 a73692 a73693 a73694 a73695 a73696 a73697 a73698 a73699 a73700 a73701 a73702 a73703 a73704 a73705 a73706 a73707 a73708 a73709 a73710 a73711 a73712 a73713 a73714 a73715 a73716 a73717 a73718 a73719 a73720 a73721 a73722 a73723 a73724 a73725 a73726 a73727 a73728 a73729 a73730 a73731 a73732 a73733 a73734 a73735 a73736 a73737 a73738 a73739 a73740 a73741 a73742 a73743 a73744 a73745 a73746 a73747 a73748 a73749 a73750 a73751 a73752 a73753 a73754 a73755 a73756 a73757 a73758 a73759 a73760 a73761 a73762 a73763 a73764 a73765 a73766 a73767 a73768 a73769 a73770 a73771 a73772 a73773 a73774 a73775 a73776 a73777 a73778 a73779 a73780 a73781 a73782 a73783 a73784 a73785 a73786 a73787 a73788 a73789 a73790 a73791 a73792 a73793 a73794 a73795 a73796 a73797 a73798 a73799 a73800 a73801 a73802 a73803 a73804 a73805 a73806 a73807 a73808 a73809 a73810 a73811 a73812 a73813 a73814 a73815 a73816 a73817 a73818 a73819 a73820 a73821 a73822 a73823 a73824 a73825 a73826 a73827 a73828 a73829 a73830 a73831 a73832 a73833 a73834 a73835 a73836 a73837 a73838 a73839 a73840 a73841 a73842 a73843 a73844 a73845 a73846 a73847 a73848 a73849 a73850 a73851 a73852 a73853 a73854 a73855 a73856 a73857 a73858 a73859 a73860 a73861 a73862 a73863 a73864 a73865 a73866 a73867 a73868 a73869 a73870 a73871 a73872 a73873 a73874 a73875 a73876 a73877 a73878 a73879 a73880 a73881 a73882 a73883 a73884 a73885 a73886 a73887 a73888 a73889 a73890 a73891 a73892 a73893 a73894 a73895 a73896 a73897 a73898 a73899 a73900 a73901 a73902 a73903 a73904 a73905 a73906 a73907 a73908 a73909 a73910 a73911 a73912 a73913 a73914 a73915 a73916 a73917 a73918 a73919 a73920 a73921 a73922 a73923 a73924 a73925 a73926 a73927 a73928 a73929 a73930 a73931 a73932 a73933 a73934 a73935 a73936 a73937 a73938 a73939 a73940 a73941 a73942 a73943 a73944 a73945 a73946 a73947 a73948 a73949 a73950 a73951 a73952 a73953 a73954 a73955 a73956 a73957 a73958 a73959 a73960 a73961 a73962 a73963 a73964 a73965 a73966 a73967 a73968 a73969 a73970 a73971 a73972 a73973 a73974 a73975 a73976 a73977 a73978 a73979 a73980 a73981 a73982 a73983 a73984 a73985 a73986 a73987 a73988 a73989 a73990 a73991 a73992 a73993 a73994 a73995 a73996 a73997 a73998 a73999 a74000 a74001 a74002 a74003 a74004 a74005 a74006 a74007 a74008 a74009 a74010 a74011 a74012 a74013 a74014 a74015 a74016 a74017 a74018 a74019 a74020 a74021 a74022 a74023 a74024 a74025 a74026 a74027 a74028 a74029 a74030 a74031 a74032 a74033 a74034 a74035 a74036 a74037 a74038 a74039 a74040 a74041 a74042 a74043 a74044 a74045 a74046 a74047 a74048 a74049 a74050 a74051 a74052 a74053 a74054 a74055 a74056 a74057 a74058 a74059 a74060 a74061 a74062 a74063 a74064 a74065 a74066 a74067 a74068 a74069 a74070 a74071 a74072 a74073 a74074 a74075 a74076 a74077 a74078 a74079 a74080 a74081 a74082 a74083 a74084 a74085 a74086 a74087 a74088 a74089 a74090 a74091 a74092 a74093 a74094 a74095 a74096 a74097 a74098 a74099 a74100 a74101 a74102 a74103 a74104 a74105 a74106 a74107 a74108 a74109 a74110 a74111 a74112 a74113 a74114 a74115 a74116 a74117 a74118 a74119 a74120 a74121 a74122 a74123 a74124 a74125 a74126 a74127 a74128 a74129 a74130 a74131 a74132 a74133 a74134 a74135 a74136 a74137 a74138 a74139 a74140 a74141 a74142 a74143 a74144 a74145 a74146 a74147 a74148 a74149 a74150 a74151 a74152 a74153 a74154 a74155 a74156 a74157 a74158 a74159 a74160 a74161 a74162 a74163 a74164 a74165 a74166 a74167 a74168 a74169 a74170 a74171 a74172 a74173 a74174 a74175 a74176 a74177 a74178 a74179 a74180 a74181 a74182 a74183 a74184 a74185 a74186 a74187 a74188 a74189 a74190 a74191 a74192 a74193 a74194 a74195 a74196 a74197 a74198 a74199 a74200 a74201 a74202 a74203 a74204 a74205 a74206 a74207 a74208 a74209 a74210 a74211 a74212 a74213 a74214 a74215 a74216 a74217 a74218 a74219 a74220 a74221 a74222 a74223 a74224 a74225 a74226 a74227 a74228 a74229 a74230 a74231 a74232 a74233 a74234 a74235 a74236 a74237 a74238 a74239 a74240 a74241 a74242 a74243 a74244 a74245 a74246 a74247 a74248 a74249 a74250 a74251 a74252 a74253 a74254 a74255 a74256 a74257 a74258 a74259 a74260 a74261 a74262 a74263 a74264 a74265 a74266 a74267 a74268 a74269 a74270 a74271 a74272 a74273 a74274 a74275 a74276 a74277 a74278 a74279 a74280 a74281 a74282 a74283 a74284 a74285 a74286 a74287 a74288 a74289 a74290 a74291 a74292 a74293 a74294 a74295 a74296 a74297 a74298 a74299 a74300 a74301 a74302 a74303 a74304 a74305 a74306 a74307 a74308 a74309 a74310 a74311 a74312 a74313 a74314 a74315 a74316 a74317 a74318 a74319 a74320 a74321 a74322 a74323 a74324 a74325 a74326 a74327 a74328 a74329 a74330 a74331 a74332 a74333 a74334 a74335 a74336 a74337 a74338 a74339 a74340 a74341 a74342 a74343 a74344 a74345 a74346 a74347 a74348 a74349 a74350 a74351 a74352 a74353 a74354 a74355 a74356 a74357 a74358 a74359 a74360 a74361 a74362 a74363 a74364 a74365 a74366 a74367 a74368 a74369 a74370 a74371 a74372 a74373 a74374 a74375 a74376 a74377 a74378 a74379 a74380 a74381 a74382 a74383 a74384 a74385 a74386 a74387 a74388 a74389 a74390 a74391 a74392 a74393 a74394 a74395 a74396 a74397 a74398 a74399 a74400 a74401 a74402 a74403 a74404 a74405 a74406 a74407 a74408 a74409 a74410 a74411 a74412 a74413 a74414 a74415 a74416 a74417 a74418 a74419 a74420 a74421 a74422 a74423 a74424 a74425 a74426 a74427 a74428 a74429 a74430 a74431 a74432 a74433 a74434 a74435 a74436 a74437 a74438 a74439 a74440 a74441 a74442 a74443 a74444 a74445 a74446 a74447 a74448 a74449 a74450 a74451 a74452 a74453 a74454 a74455 a74456 a74457 a74458 a74459 a74460 a74461 a74462 a74463 a74464 a74465 a74466 a74467 a74468 a74469 a74470 a74471 a74472 a74473 a74474 a74475 a74476 a74477 a74478 a74479 a74480 a74481 a74482 a74483 a74484 a74485 a74486 a74487 a74488 a74489 a74490 a74491 a74492 a74493 a74494 a74495 a74496 a74497 a74498 a74499 a74500 a74501 a74502 a74503 a74504 a74505 a74506 a74507 a74508 a74509 a74510 a74511 a74512 a74513 a74514 a74515 a74516 a74517 a74518 a74519 a74520 a74521 a74522 a74523 a74524 a74525 a74526 a74527 a74528 a74529 a74530 a74531 a74532 a74533 a74534 a74535 a74536 a74537 a74538 a74539 a74540 a74541 a74542 a74543 a74544 a74545 a74546 a74547 a74548 a74549 a74550 a74551 a74552 a74553 a74554 a74555 a74556 a74557 a74558 a74559 a74560 a74561 a74562 a74563 a74564 a74565 a74566 a74567 a74568 a74569 a74570 a74571 a74572 a74573 a74574 a74575 a74576 a74577 a74578 a74579 a74580 a74581 a74582 a74583 a74584 a74585 a74586 a74587 a74588 a74589 a74590 a74591 a74592 a74593 a74594 a74595 a74596 a74597 a74598 a74599 a74600 a74601 a74602 a74603 a74604 a74605 a74606 a74607 a74608 a74609 a74610 a74611 a74612 a74613 a74614 a74615 a74616 a74617 a74618 a74619 a74620 a74621 a74622 a74623 a74624 a74625 a74626 a74627 a74628 a74629 a74630 a74631 a74632 a74633 a74634 a74635 a74636 a74637 a74638 a74639 a74640 a74641 a74642 a74643 a74644 a74645 a74646 a74647 a74648 a74649 a74650 a74651 a74652 a74653 a74654 a74655 a74656 a74657 a74658 a74659 a74660 a74661 a74662 a74663 a74664 a74665 a74666 a74667 a74668 a74669 a74670 a74671 a74672 a74673 a74674 a74675 a74676 a74677 a74678 a74679 a74680 a74681 a74682 a74683 a74684 a74685 a74686 a74687 a74688 a74689 a74690 a74691 a74692 a74693 a74694 a74695 a74696 a74697 a74698 a74699 a74700 a74701 a74702 a74703 a74704 a74705 a74706 a74707 a74708 a74709 a74710 a74711 a74712 a74713 a74714 a74715 a74716 a74717 a74718 a74719 a74720 a74721 a74722 a74723 a74724 a74725 a74726 a74727 a74728 a74729 a74730 a74731 a74732 a74733 a74734 a74735 a74736 a74737 a74738 a74739 a74740 a74741 a74742 a74743 a74744 a74745 a74746 a74747 a74748 a74749 a74750 a74751 a74752 a74753 a74754 a74755 a74756 a74757 a74758 a74759 a74760 a74761 a74762 a74763 a74764 a74765 a74766 a74767 a74768 a74769 a74770 a74771 a74772 a74773 a74774 a74775 a74776 a74777 a74778 a74779 a74780 a74781 a74782 a74783 a74784 a74785 a74786 a74787 a74788 a74789 a74790 a74791 a74792 a74793 a74794 a74795 a74796 a74797 a74798 a74799 a74800 a74801 a74802 a74803 a74804 a74805 a74806 a74807 a74808 a74809 a74810 a74811 a74812 a74813 a74814 a74815 a74816 a74817 a74818 a74819 a74820 a74821 a74822 a74823 a74824 a74825 a74826 a74827 a74828 a74829 a74830 a74831 a74832 a74833 a74834 a74835 a74836 a74837 a74838 a74839 a74840 a74841 a74842 a74843 a74844 a74845 a74846 a74847 a74848 a74849 a74850 a74851 a74852 a74853 a74854 a74855 a74856 a74857 a74858 a74859 a74860 a74861 a74862 a74863 a74864 a74865 a74866 a74867 a74868 a74869 a74870 a74871 a74872 a74873 a74874 a74875 a74876 a74877 a74878 a74879 a74880 a74881 a74882 a74883 a74884 a74885 a74886 a74887 a74888 a74889 a74890 a74891 a74892 a74893 a74894 a74895 a74896 a74897 a74898 a74899 a74900 a74901 a74902 a74903 a74904 a74905 a74906 a74907 a74908 a74909 a74910 a74911 a74912 a74913 a74914 a74915 a74916 a74917 a74918 a74919 a74920 a74921 a74922 a74923 a74924 a74925 a74926 a74927 a74928 a74929 a74930 a74931 a74932 a74933 a74934 a74935 a74936 a74937 a74938 a74939 a74940 a74941 a74942 a74943 a74944 a74945 a74946 a74947 a74948 a74949 a74950 a74951 a74952 a74953 a74954 a74955 a74956 a74957 a74958 a74959 a74960 a74961 a74962 a74963 a74964 a74965 a74966 a74967 a74968 a74969 a74970 a74971 a74972 a74973 a74974 a74975 a74976 a74977 a74978 a74979 a74980 a74981 a74982 a74983 a74984 a74985 a74986 a74987 a74988 a74989 a74990 a74991 a74992 a74993 a74994 a74995 a74996 a74997 a74998 a74999 a75000 a75001 a75002 a75003 a75004 a75005 a75006 a75007 a75008 a75009 a75010 a75011 a75012 a75013 a75014 a75015 a75016 a75017 a75018 a75019 a75020 a75021 a75022 a75023 a75024 a75025 a75026 a75027 a75028 a75029 a75030 a75031 a75032 a75033 a75034 a75035 a75036 a75037 a75038 a75039 a75040 a75041 a75042 a75043 a75044 a75045 a75046 a75047 a75048 a75049 a75050 a75051 a75052 a75053 a75054 a75055 a75056 a75057 a75058 a75059 a75060 a75061 a75062 a75063 a75064 a75065 a75066 a75067 a75068 a75069 a75070 a75071 a75072 a75073 a75074 a75075 a75076 a75077 a75078 a75079 a75080 a75081 a75082 a75083 a75084 a75085 a75086 a75087 a75088 a75089 a75090 a75091 a75092 a75093 a75094 a75095 a75096 a75097 a75098 a75099 a75100 a75101 a75102 a75103 a75104 a75105 a75106 a75107 a75108 a75109 a75110 a75111 a75112 a75113 a75114 a75115 a75116 a75117 a75118 a75119 a75120 a75121 a75122 a75123 a75124 a75125 a75126 a75127 a75128 a75129 a75130 a75131 a75132 a75133 a75134 a75135 a75136 a75137 a75138 a75139 a75140 a75141 a75142 a75143 a75144 a75145 a75146 a75147 a75148 a75149 a75150 a75151 a75152 a75153 a75154 a75155 a75156 a75157 a75158 a75159 a75160 a75161 a75162 a75163 a75164 a75165 a75166 a75167 a75168 a75169 a75170 a75171 a75172 a75173 a75174 a75175 a75176 a75177 a75178 a75179 a75180 a75181 a75182 a75183 a75184 a75185 a75186 a75187 a75188 a75189 a75190 a75191 a75192 a75193 a75194 a75195 a75196 a75197 a75198 a75199 a75200 a75201 a75202 a75203 a75204 a75205 a75206 a75207 a75208 a75209 a75210 a75211 a75212 a75213 a75214 a75215 a75216 a75217 a75218 a75219 a75220 a75221 a75222 a75223 a75224 a75225 a75226 a75227 a75228 a75229 a75230 a75231 a75232 a75233 a75234 a75235 a75236 a75237 a75238 a75239 a75240 a75241 a75242 a75243 a75244 a75245 a75246 a75247 a75248 a75249 a75250 a75251 a75252 a75253 a75254 a75255 a75256 a75257 a75258 a75259 a75260 a75261 a75262 a75263 a75264 a75265 a75266 a75267 a75268 a75269 a75270 a75271 a75272 a75273 a75274 a75275 a75276 a75277 a75278 a75279 a75280 a75281 a75282 a75283 a75284 a75285 a75286 a75287 a75288 a75289 a75290 a75291 a75292 a75293 a75294 a75295 a75296 a75297 a75298 a75299 a75300 a75301 a75302 a75303 a75304 a75305 a75306 a75307 a75308 a75309 a75310 a75311 a75312 a75313 a75314 a75315 a75316 a75317 a75318 a75319 a75320 a75321 a75322 a75323 a75324 a75325 a75326 a75327 a75328 a75329 a75330 a75331 a75332 a75333 a75334 a75335 a75336 a75337 a75338 a75339 a75340 a75341 a75342 a75343 a75344 a75345 a75346 a75347 a75348 a75349 a75350 a75351 a75352 a75353 a75354 a75355 a75356 a75357 a75358 a75359 a75360 a75361 a75362 a75363 a75364 a75365 a75366 a75367 a75368 a75369 a75370 a75371 a75372 a75373 a75374 a75375 a75376 a75377 a75378 a75379 a75380 a75381 a75382 a75383 a75384 a75385 a75386 a75387 a75388 a75389 a75390 a75391 a75392 a75393 a75394 a75395 a75396 a75397 a75398 a75399 a75400 a75401 a75402 a75403 a75404 a75405 a75406 a75407 a75408 a75409 a75410 a75411 a75412 a75413 a75414 a75415 a75416 a75417 a75418 a75419 a75420 a75421 a75422 a75423 a75424 a75425 a75426 a75427 a75428 a75429 a75430 a75431 a75432 a75433 a75434 a75435 a75436 a75437 a75438 a75439 a75440 a75441 a75442 a75443 a75444 a75445 a75446 a75447 a75448 a75449 a75450 a75451 a75452 a75453 a75454 a75455 a75456 a75457 a75458 a75459 a75460 a75461 a75462 a75463 a75464 a75465 a75466 a75467 a75468 a75469 a75470 a75471 a75472 a75473 a75474 a75475 a75476 a75477 a75478 a75479 a75480 a75481 a75482 a75483 a75484 a75485 a75486 a75487 a75488 a75489 a75490 a75491 a75492 a75493 a75494 a75495 a75496 a75497 a75498 a75499 a75500 a75501 a75502 a75503 a75504 a75505 a75506 a75507 a75508 a75509 a75510 a75511 a75512 a75513 a75514 a75515 a75516 a75517 a75518 a75519 a75520 a75521 a75522 a75523 a75524 a75525 a75526 a75527 a75528 a75529 a75530 a75531 a75532 a75533 a75534 a75535 a75536 a75537 a75538 a75539 a75540 a75541 a75542 a75543 a75544 a75545 a75546 a75547 a75548 a75549 a75550 a75551 a75552 a75553 a75554 a75555 a75556 a75557 a75558 a75559 a75560 a75561 a75562 a75563 a75564 a75565 a75566 a75567 a75568 a75569 a75570 a75571 a75572 a75573 a75574 a75575 a75576 a75577 a75578 a75579 a75580 a75581 a75582 a75583 a75584 a75585 a75586 a75587 a75588 a75589 a75590 a75591 a75592 a75593 a75594 a75595 a75596 a75597 a75598 a75599 a75600 a75601 a75602 a75603 a75604 a75605 a75606 a75607 a75608 a75609 a75610 a75611 a75612 a75613 a75614 a75615 a75616 a75617 a75618 a75619 a75620 a75621 a75622 a75623 a75624 a75625 a75626 a75627 a75628 a75629 a75630 a75631 a75632 a75633 a75634 a75635 a75636 a75637 a75638 a75639 a75640 a75641 a75642 a75643 a75644 a75645 a75646 a75647 a75648 a75649 a75650 a75651 a75652 a75653 a75654 a75655 a75656 a75657 a75658 a75659 a75660 a75661 a75662 a75663 a75664 a75665 a75666 a75667 a75668 a75669 a75670 a75671 a75672 a75673 a75674 a75675 a75676 a75677 a75678 a75679 a75680 a75681 a75682 a75683 a75684 a75685 a75686 a75687 a75688 a75689 a75690 a75691 a75692 a75693 a75694 a75695 a75696 a75697 a75698 a75699 a75700 a75701 a75702 a75703 a75704 a75705 a75706 a75707 a75708 a75709 a75710 a75711 a75712 a75713 a75714 a75715 a75716 a75717 a75718 a75719 a75720 a75721 a75722 a75723 a75724 a75725 a75726 a75727 a75728 a75729 a75730 a75731 a75732 a75733 a75734 a75735 a75736 a75737 a75738 a75739 a75740 a75741 a75742 a75743 a75744 a75745 a75746 a75747 a75748 a75749 a75750 a75751 a75752 a75753 a75754 a75755 a75756 a75757 a75758 a75759 a75760 a75761 a75762 a75763 a75764 a75765 a75766 a75767 a75768 a75769 a75770 a75771 a75772 a75773 a75774 a75775 a75776 a75777 a75778 a75779 a75780 a75781 a75782 a75783 a75784 a75785 a75786 a75787 a75788 a75789 a75790 a75791 a75792 a75793 a75794 a75795 a75796 a75797 a75798 a75799 a75800 a75801 a75802 a75803 a75804 a75805 a75806 a75807 a75808 a75809 a75810 a75811 a75812 a75813 a75814 a75815 a75816 a75817 a75818 a75819 a75820 a75821 a75822 a75823 a75824 a75825 a75826 a75827 a75828 a75829 a75830 a75831 a75832 a75833 a75834 a75835 a75836 a75837 a75838 a75839 a75840 a75841 a75842 a75843 a75844 a75845 a75846 a75847 a75848 a75849 a75850 a75851 a75852 a75853 a75854 a75855 a75856 a75857 a75858 a75859 a75860 a75861 a75862 a75863 a75864 a75865 a75866 a75867 a75868 a75869 a75870 a75871 a75872 a75873 a75874 a75875 a75876 a75877 a75878 a75879 a75880 a75881 a75882 a75883 a75884 a75885 a75886 a75887 a75888 a75889 a75890 a75891 a75892 a75893 a75894 a75895 a75896 a75897 a75898 a75899 a75900 a75901 a75902 a75903 a75904 a75905 a75906 a75907 a75908 a75909 a75910 a75911 a75912 a75913 a75914 a75915 a75916 a75917 a75918 a75919 a75920 a75921 a75922 a75923 a75924 a75925 a75926 a75927 a75928 a75929 a75930 a75931 a75932 a75933 a75934 a75935 a75936 a75937 a75938 a75939 a75940 a75941 a75942 a75943 a75944 a75945 a75946 a75947 a75948 a75949 a75950 a75951 a75952 a75953 a75954 a75955 a75956 a75957 a75958 a75959 a75960 a75961 a75962 a75963 a75964 a75965 a75966 a75967 a75968 a75969 a75970 a75971 a75972 a75973 a75974 a75975 a75976 a75977 a75978 a75979 a75980 a75981 a75982 a75983 a75984 a75985 a75986 a75987 a75988 a75989 a75990 a75991 a75992 a75993 a75994 a75995 a75996 a75997 a75998 a75999 a76000 a76001 a76002 a76003 a76004 a76005 a76006 a76007 a76008 a76009 a76010 a76011 a76012 a76013 a76014 a76015 a76016 a76017 a76018 a76019 a76020 a76021 a76022 a76023 a76024 a76025 a76026 a76027 a76028 a76029 a76030 a76031 a76032 a76033 a76034 a76035 a76036 a76037 a76038 a76039 a76040 a76041 a76042 a76043 a76044 a76045 a76046 a76047 a76048 a76049 a76050 a76051 a76052 a76053 a76054 a76055 a76056 a76057 a76058 a76059 a76060 a76061 a76062 a76063 a76064 a76065 a76066 a76067 a76068 a76069 a76070 a76071 a76072 a76073 a76074 a76075 a76076 a76077 a76078 a76079 a76080 a76081 a76082 a76083 a76084 a76085 a76086 a76087 a76088 a76089 a76090 a76091 a76092 a76093 a76094 a76095 a76096 a76097 a76098 a76099 a76100 a76101 a76102 a76103 a76104 a76105 a76106 a76107 a76108 a76109 a76110 a76111 a76112 a76113 a76114 a76115 a76116 a76117 a76118 a76119 a76120 a76121 a76122 a76123 a76124 a76125 a76126 a76127 a76128 a76129 a76130 a76131 a76132 a76133 a76134 a76135 a76136 a76137 a76138 a76139 a76140 a76141 a76142 a76143 a76144 a76145 a76146 a76147 a76148 a76149 a76150 a76151 a76152 a76153 a76154 a76155 a76156 a76157 a76158 a76159 a76160 a76161 a76162 a76163 a76164 a76165 a76166 a76167 a76168 a76169 a76170 a76171 a76172 a76173 a76174 a76175 a76176 a76177 a76178 a76179 a76180 a76181 a76182 a76183 a76184 a76185 a76186 a76187 a76188 a76189 a76190 a76191 a76192 a76193 a76194 a76195 a76196 a76197 a76198 a76199 a76200 a76201 a76202 a76203 a76204 a76205 a76206 a76207 a76208 a76209 a76210 a76211 a76212 a76213 a76214 a76215 a76216 a76217 a76218 a76219 a76220 a76221 a76222 a76223 a76224 a76225 a76226 a76227 a76228 a76229 a76230 a76231 a76232 a76233 a76234 a76235 a76236 a76237 a76238 a76239 a76240 a76241 a76242 a76243 a76244 a76245 a76246 a76247 a76248 a76249 a76250 a76251 a76252 a76253 a76254 a76255 a76256 a76257 a76258 a76259 a76260 a76261 a76262 a76263 a76264 a76265 a76266 a76267 a76268 a76269 a76270 a76271 a76272 a76273 a76274 a76275 a76276 a76277 a76278 a76279 a76280 a76281 a76282 a76283 a76284 a76285 a76286 a76287 a76288 a76289 a76290 a76291 a76292 a76293 a76294 a76295 a76296 a76297 a76298 a76299 a76300 a76301 a76302 a76303 a76304 a76305 a76306 a76307 a76308 a76309 a76310 a76311 a76312 a76313 a76314 a76315 a76316 a76317 a76318 a76319 a76320 a76321 a76322 a76323 a76324 a76325 a76326 a76327 a76328 a76329 a76330 a76331 a76332 a76333 a76334 a76335 a76336 a76337 a76338 a76339 a76340 a76341 a76342 a76343 a76344 a76345 a76346 a76347 a76348 a76349 a76350 a76351 a76352 a76353 a76354 a76355 a76356 a76357 a76358 a76359 a76360 a76361 a76362 a76363 a76364 a76365 a76366 a76367 a76368 a76369 a76370 a76371 a76372 a76373 a76374 a76375 a76376 a76377 a76378 a76379 a76380 a76381 a76382 a76383 a76384 a76385 a76386 a76387 a76388 a76389 a76390 a76391 a76392 a76393 a76394 a76395 a76396 a76397 a76398 a76399 a76400 a76401 a76402 a76403 a76404 a76405 a76406 a76407 a76408 a76409 a76410 a76411 a76412 a76413 a76414 a76415 a76416 a76417 a76418 a76419 a76420 a76421 a76422 a76423 a76424 a76425 a76426 a76427 a76428 a76429 a76430 a76431 a76432 a76433 a76434 a76435 a76436 a76437 a76438 a76439 a76440 a76441 a76442 a76443 a76444 a76445 a76446 a76447 a76448 a76449 a76450 a76451 a76452 a76453 a76454 a76455 a76456 a76457 a76458 a76459 a76460 a76461 a76462 a76463 a76464 a76465 a76466 a76467 a76468 a76469 a76470 a76471 a76472 a76473 a76474 a76475 a76476 a76477 a76478 a76479 a76480 a76481 a76482 a76483 a76484 a76485 a76486 a76487 a76488 a76489 a76490 a76491 a76492 a76493 a76494 a76495 a76496 a76497 a76498 a76499 a76500 a76501 a76502 a76503 a76504 a76505 a76506 a76507 a76508 a76509 a76510 a76511 a76512 a76513 a76514 a76515 a76516 a76517 a76518 a76519 a76520 a76521 a76522 a76523 a76524 a76525 a76526 a76527 a76528 a76529 a76530 a76531 a76532 a76533 a76534 a76535 a76536 a76537 a76538 a76539 a76540 a76541 a76542 a76543 a76544 a76545 a76546 a76547 a76548 a76549 a76550 a76551 a76552 a76553 a76554 a76555 a76556 a76557 a76558 a76559 a76560 a76561 a76562 a76563 a76564 a76565 a76566 a76567 a76568 a76569 a76570 a76571 a76572 a76573 a76574 a76575 a76576 a76577 a76578 a76579 a76580 a76581 a76582 a76583 a76584 a76585 a76586 a76587 a76588 a76589 a76590 a76591 a76592 a76593 a76594 a76595 a76596 a76597 a76598 a76599 a76600 a76601 a76602 a76603 a76604 a76605 a76606 a76607 a76608 a76609 a76610 a76611 a76612 a76613 a76614 a76615 a76616 a76617 a76618 a76619 a76620 a76621 a76622 a76623 a76624 a76625 a76626 a76627 a76628 a76629 a76630 a76631 a76632 a76633 a76634 a76635 a76636 a76637 a76638 a76639 a76640 a76641 a76642 a76643 a76644 a76645 a76646 a76647 a76648 a76649 a76650 a76651 a76652 a76653 a76654 a76655 a76656 a76657 a76658 a76659 a76660 a76661 a76662 a76663 a76664 a76665 a76666 a76667 a76668 a76669 a76670 a76671 a76672 a76673 a76674 a76675 a76676 a76677 a76678 a76679 a76680 a76681 a76682 a76683 a76684 a76685 a76686 a76687 a76688 a76689 a76690 a76691 a76692 a76693 a76694 a76695 a76696 a76697 a76698 a76699 a76700 a76701 a76702 a76703 a76704 a76705 a76706 a76707 a76708 a76709 a76710 a76711 a76712 a76713 a76714 a76715 a76716 a76717 a76718 a76719 a76720 a76721 a76722 a76723 a76724 a76725 a76726 a76727 a76728 a76729 a76730 a76731 a76732 a76733 a76734 a76735 a76736 a76737 a76738 a76739 a76740 a76741 a76742 a76743 a76744 a76745 a76746 a76747 a76748 a76749 a76750 a76751 a76752 a76753 a76754 a76755 a76756 a76757 a76758 a76759 a76760 a76761 a76762 a76763 a76764 a76765 a76766 a76767 a76768 a76769 a76770 a76771 a76772 a76773 a76774 a76775 a76776 a76777 a76778 a76779 a76780 a76781 a76782 a76783 a76784 a76785 a76786 a76787 a76788 a76789 a76790 a76791 a76792 a76793 a76794 a76795 a76796 a76797 a76798 a76799 a76800 a76801 a76802 a76803 a76804 a76805 a76806 a76807 a76808 a76809 a76810 a76811 a76812 a76813 a76814 a76815 a76816 a76817 a76818 a76819 a76820 a76821 a76822 a76823 a76824 a76825 a76826 a76827 a76828 a76829 a76830 a76831 a76832 a76833 a76834 a76835 a76836 a76837 a76838 a76839 a76840 a76841 a76842 a76843 a76844 a76845 a76846 a76847 a76848 a76849 a76850 a76851 a76852 a76853 a76854 a76855 a76856 a76857 a76858 a76859 a76860 a76861 a76862 a76863 a76864 a76865 a76866 a76867 a76868 a76869 a76870 a76871 a76872 a76873 a76874 a76875 a76876 a76877 a76878 a76879 a76880 a76881 a76882 a76883 a76884 a76885 a76886 a76887 a76888 a76889 a76890 a76891 a76892 a76893 a76894 a76895 a76896 a76897 a76898 a76899 a76900 a76901 a76902 a76903 a76904 a76905 a76906 a76907 a76908 a76909 a76910 a76911 a76912 a76913 a76914 a76915 a76916 a76917 a76918 a76919 a76920 a76921 a76922 a76923 a76924 a76925 a76926 a76927 a76928 a76929 a76930 a76931 a76932 a76933 a76934 a76935 a76936 a76937 a76938 a76939 a76940 a76941 a76942 a76943 a76944 a76945 a76946 a76947 a76948 a76949 a76950 a76951 a76952 a76953 a76954 a76955 a76956 a76957 a76958 a76959 a76960 a76961 a76962 a76963 a76964 a76965 a76966 a76967 a76968 a76969 a76970 a76971 a76972 a76973 a76974 a76975 a76976 a76977 a76978 a76979 a76980 a76981 a76982 a76983 a76984 a76985 a76986 a76987 a76988 a76989 a76990 a76991 a76992 a76993 a76994 a76995 a76996 a76997 a76998 a76999 a77000 a77001 a77002 a77003 a77004 a77005 a77006 a77007 a77008 a77009 a77010 a77011 a77012 a77013 a77014 a77015 a77016 a77017 a77018 a77019 a77020 a77021 a77022 a77023 a77024 a77025 a77026 a77027 a77028 a77029 a77030 a77031 a77032 a77033 a77034 a77035 a77036 a77037 a77038 a77039 a77040 a77041 a77042 a77043 a77044 a77045 a77046 a77047 a77048 a77049 a77050 a77051 a77052 a77053 a77054 a77055 a77056 a77057 a77058 a77059 a77060 a77061 a77062 a77063 a77064 a77065 a77066 a77067 a77068 a77069 a77070 a77071 a77072 a77073 a77074 a77075 a77076 a77077 a77078 a77079 a77080 a77081 a77082 a77083 a77084 a77085 a77086 a77087 a77088 a77089 a77090 a77091 a77092 a77093 a77094 a77095 a77096 a77097 a77098 a77099 a77100 a77101 a77102 a77103 a77104 a77105 a77106 a77107 a77108 a77109 a77110 a77111 a77112 a77113 a77114 a77115 a77116 a77117 a77118 a77119 a77120 a77121 a77122 a77123 a77124 a77125 a77126 a77127 a77128 a77129 a77130 a77131 a77132 a77133 a77134 a77135 a77136 a77137 a77138 a77139 a77140 a77141 a77142 a77143 a77144 a77145 a77146 a77147 a77148 a77149 a77150 a77151 a77152 a77153 a77154 a77155 a77156 a77157 a77158 a77159 a77160 a77161 a77162 a77163 a77164 a77165 a77166 a77167 a77168 a77169 a77170 a77171 a77172 a77173 a77174 a77175 a77176 a77177 a77178 a77179 a77180 a77181 a77182 a77183 a77184 a77185 a77186 a77187 a77188 a77189 a77190 a77191 a77192 a77193 a77194 a77195 a77196 a77197 a77198 a77199 a77200 a77201 a77202 a77203 a77204 a77205 a77206 a77207 a77208 a77209 a77210 a77211 a77212 a77213 a77214 a77215 a77216 a77217 a77218 a77219 a77220 a77221 a77222 a77223 a77224 a77225 a77226 a77227 a77228 a77229 a77230 a77231 a77232 a77233 a77234 a77235 a77236 a77237 a77238 a77239 a77240 a77241 a77242 a77243 a77244 a77245 a77246 a77247 a77248 a77249 a77250 a77251 a77252 a77253 a77254 a77255 a77256 a77257 a77258 a77259 a77260 a77261 a77262 a77263 a77264 a77265 a77266 a77267 a77268 a77269 a77270 a77271 a77272 a77273 a77274 a77275 a77276 a77277 a77278 a77279 a77280 a77281 a77282 a77283 a77284 a77285 a77286 a77287 a77288 a77289 a77290 a77291 a77292 a77293 a77294 a77295 a77296 a77297 a77298 a77299 a77300 a77301 a77302 a77303 a77304 a77305 a77306 a77307 a77308 a77309 a77310 a77311 a77312 a77313 a77314 a77315 a77316 a77317 a77318 a77319 a77320 a77321 a77322 a77323 a77324 a77325 a77326 a77327 a77328 a77329 a77330 a77331 a77332 a77333 a77334 a77335 a77336 a77337 a77338 a77339 a77340 a77341 a77342 a77343 a77344 a77345 a77346 a77347 a77348 a77349 a77350 a77351 a77352 a77353 a77354 a77355 a77356 a77357 a77358 a77359 a77360 a77361 a77362 a77363 a77364 a77365 a77366 a77367 a77368 a77369 a77370 a77371 a77372 a77373 a77374 a77375 a77376 a77377 a77378 a77379 a77380 a77381 a77382 a77383 a77384 a77385 a77386 a77387 a77388 a77389 a77390 a77391 a77392 a77393 a77394 a77395 a77396 a77397 a77398 a77399 a77400 a77401 a77402 a77403 a77404 a77405 a77406 a77407 a77408 a77409 a77410 a77411 a77412 a77413 a77414 a77415 a77416 a77417 a77418 a77419 a77420 a77421 a77422 a77423 a77424 a77425 a77426 a77427 a77428 a77429 a77430 a77431 a77432 a77433 a77434 a77435 a77436 a77437 a77438 a77439 a77440 a77441 a77442 a77443 a77444 a77445 a77446 a77447 a77448 a77449 a77450 a77451 a77452 a77453 a77454 a77455 a77456 a77457 a77458 a77459 a77460 a77461 a77462 a77463 a77464 a77465 a77466 a77467 a77468 a77469 a77470 a77471 a77472 a77473 a77474 a77475 a77476 a77477 a77478 a77479 a77480 a77481 a77482 a77483 a77484 a77485 a77486 a77487 a77488 a77489 a77490 a77491 a77492 a77493 a77494 a77495 a77496 a77497 a77498 a77499 a77500 a77501 a77502 a77503 a77504 a77505 a77506 a77507 a77508 a77509 a77510 a77511 a77512 a77513 a77514 a77515 a77516 a77517 a77518 a77519 a77520 a77521 a77522 a77523 a77524 a77525 a77526 a77527 a77528 a77529 a77530 a77531 a77532 a77533 a77534 a77535 a77536 a77537 a77538 a77539 a77540 a77541 a77542 a77543 a77544 a77545 a77546 a77547 a77548 a77549 a77550 a77551 a77552 a77553 a77554 a77555 a77556 a77557 a77558 a77559 a77560 a77561 a77562 a77563 a77564 a77565 a77566 a77567 a77568 a77569 a77570 a77571 a77572 a77573 a77574 a77575 a77576 a77577 a77578 a77579 a77580 a77581 a77582 a77583 a77584 a77585 a77586 a77587 a77588 a77589 a77590 a77591 a77592 a77593 a77594 a77595 a77596 a77597 a77598 a77599 a77600 a77601 a77602 a77603 a77604 a77605 a77606 a77607 a77608 a77609 a77610 a77611 a77612 a77613 a77614 a77615 a77616 a77617 a77618 a77619 a77620 a77621 a77622 a77623 a77624 a77625 a77626 a77627 a77628 a77629 a77630 a77631 a77632 a77633 a77634 a77635 a77636 a77637 a77638 a77639 a77640 a77641 a77642 a77643 a77644 a77645 a77646 a77647 a77648 a77649 a77650 a77651 a77652 a77653 a77654 a77655 a77656 a77657 a77658 a77659 a77660 a77661 a77662 a77663 a77664 a77665 a77666 a77667 a77668 a77669 a77670 a77671 a77672 a77673 a77674 a77675 a77676 a77677 a77678 a77679 a77680 a77681 a77682 a77683 a77684 a77685 a77686 a77687 a77688 a77689 a77690 a77691 a77692 a77693 a77694 a77695 a77696 a77697 a77698 a77699 a77700 a77701 a77702 a77703 a77704 a77705 a77706 a77707 a77708 a77709 a77710 a77711 a77712 a77713 a77714 a77715 a77716 a77717 a77718 a77719 a77720 a77721 a77722 a77723 a77724 a77725 a77726 a77727 a77728 a77729 a77730 a77731 a77732 a77733 a77734 a77735 a77736 a77737 a77738 a77739 a77740 a77741 a77742 a77743 a77744 a77745 a77746 a77747 a77748 a77749 a77750 a77751 a77752 a77753 a77754 a77755 a77756 a77757 a77758 a77759 a77760 a77761 a77762 a77763 a77764 a77765 a77766 a77767 a77768 a77769 a77770 a77771 a77772 a77773 a77774 a77775 a77776 a77777 a77778 a77779 a77780 a77781 a77782 a77783 a77784 a77785 a77786 a77787 a77788 a77789 a77790 a77791 a77792 a77793 a77794 a77795 a77796 a77797 a77798 a77799 a77800 a77801 a77802 a77803 a77804 a77805 a77806 a77807 a77808 a77809 a77810 a77811 a77812 a77813 a77814 a77815 a77816 a77817 a77818 a77819 a77820 a77821 a77822 a77823 a77824 a77825 a77826 a77827 a77828 a77829 a77830 a77831 a77832 a77833 a77834 a77835 a77836 a77837 a77838 a77839 a77840 a77841 a77842 a77843 a77844 a77845 a77846 a77847 a77848 a77849 a77850 a77851 a77852 a77853 a77854 a77855 a77856 a77857 a77858 a77859 a77860 a77861 a77862 a77863 a77864 a77865 a77866 a77867 a77868 a77869 a77870 a77871 a77872 a77873 a77874 a77875 a77876 a77877 a77878 a77879 a77880 a77881 a77882 a77883 a77884 a77885 a77886 a77887 a77888 a77889 a77890 a77891 a77892 a77893 a77894 a77895 a77896 a77897 a77898 a77899 a77900 a77901 a77902 a77903 a77904 a77905 a77906 a77907 a77908 a77909 a77910 a77911 a77912 a77913 a77914 a77915 a77916 a77917 a77918 a77919 a77920 a77921 a77922 a77923 a77924 a77925 a77926 a77927 a77928 a77929 a77930 a77931 a77932 a77933 a77934 a77935 a77936 a77937 a77938 a77939 a77940 a77941 a77942 a77943 a77944 a77945 a77946 a77947 a77948 a77949 a77950 a77951 a77952 a77953 a77954 a77955 a77956 a77957 a77958 a77959 a77960 a77961 a77962 a77963 a77964 a77965 a77966 a77967 a77968 a77969 a77970 a77971 a77972 a77973 a77974 a77975 a77976 a77977 a77978 a77979 a77980 a77981 a77982 a77983 a77984 a77985 a77986 a77987 a77988 a77989 a77990 a77991 a77992 a77993 a77994 a77995 a77996 a77997 a77998 a77999 a78000 a78001 a78002 a78003 a78004 a78005 a78006 a78007 a78008 a78009 a78010 a78011 a78012 a78013 a78014 a78015 a78016 a78017 a78018 a78019 a78020 a78021 a78022 a78023 a78024 a78025 a78026 a78027 a78028 a78029 a78030 a78031 a78032 a78033 a78034 a78035 a78036 a78037 a78038 a78039 a78040 a78041 a78042 a78043 a78044 a78045 a78046 a78047 a78048 a78049 a78050 a78051 a78052 a78053 a78054 a78055 a78056 a78057 a78058 a78059 a78060 a78061 a78062 a78063 a78064 a78065 a78066 a78067 a78068 a78069 a78070 a78071 a78072 a78073 a78074 a78075 a78076 a78077 a78078 a78079 a78080 a78081 a78082 a78083 a78084 a78085 a78086 a78087 a78088 a78089 a78090 a78091 a78092 a78093 a78094 a78095 a78096 a78097 a78098 a78099 a78100 a78101 a78102 a78103 a78104 a78105 a78106 a78107 a78108 a78109 a78110 a78111 a78112 a78113 a78114 a78115 a78116 a78117 a78118 a78119 a78120 a78121 a78122 a78123 a78124 a78125 a78126 a78127 a78128 a78129 a78130 a78131 a78132 a78133 a78134 a78135 a78136 a78137 a78138 a78139 a78140 a78141 a78142 a78143 a78144 a78145 a78146 a78147 a78148 a78149 a78150 a78151 a78152 a78153 a78154 a78155 a78156 a78157 a78158 a78159 a78160 a78161 a78162 a78163 a78164 a78165 a78166 a78167 a78168 a78169 a78170 a78171 a78172 a78173 a78174 a78175 a78176 a78177 a78178 a78179 a78180 a78181 a78182 a78183 a78184 a78185 a78186 a78187 a78188 a78189 a78190 a78191 a78192 a78193 a78194 a78195 a78196 a78197 a78198 a78199 a78200 a78201 a78202 a78203 a78204 a78205 a78206 a78207 a78208 a78209 a78210 a78211 a78212 a78213 a78214 a78215 a78216 a78217 a78218 a78219 a78220 a78221 a78222 a78223 a78224 a78225 a78226 a78227 a78228 a78229 a78230 a78231 a78232 a78233 a78234 a78235 a78236 a78237 a78238 a78239 a78240 a78241 a78242 a78243 a78244 a78245 a78246 a78247 a78248 a78249 a78250 a78251 a78252 a78253 a78254 a78255 a78256 a78257 a78258 a78259 a78260 a78261 a78262 a78263 a78264 a78265 a78266 a78267 a78268 a78269 a78270 a78271 a78272 a78273 a78274 a78275 a78276 a78277 a78278 a78279 a78280 a78281 a78282 a78283 a78284 a78285 a78286 a78287 a78288 a78289 a78290 a78291 a78292 a78293 a78294 a78295 a78296 a78297 a78298 a78299 a78300 a78301 a78302 a78303 a78304 a78305 a78306 a78307 a78308 a78309 a78310 a78311 a78312 a78313 a78314 a78315 a78316 a78317 a78318 a78319 a78320 a78321 a78322 a78323 a78324 a78325 a78326 a78327 a78328 a78329 a78330 a78331 a78332 a78333 a78334 a78335 a78336 a78337 a78338 a78339 a78340 a78341 a78342 a78343 a78344 a78345 a78346 a78347 a78348 a78349 a78350 a78351 a78352 a78353 a78354 a78355 a78356 a78357 a78358 a78359 a78360 a78361 a78362 a78363 a78364 a78365 a78366 a78367 a78368 a78369 a78370 a78371 a78372 a78373 a78374 a78375 a78376 a78377 a78378 a78379 a78380 a78381 a78382 a78383 a78384 a78385 a78386 a78387 a78388 a78389 a78390 a78391 a78392 a78393 a78394 a78395 a78396 a78397 a78398 a78399 a78400 a78401 a78402 a78403 a78404 a78405 a78406 a78407 a78408 a78409 a78410 a78411 a78412 a78413 a78414 a78415 a78416 a78417 a78418 a78419 a78420 a78421 a78422 a78423 a78424 a78425 a78426 a78427 a78428 a78429 a78430 a78431 a78432 a78433 a78434 a78435 a78436 a78437 a78438 a78439 a78440 a78441 a78442 a78443 a78444 a78445 a78446 a78447 a78448 a78449 a78450 a78451 a78452 a78453 a78454 a78455 a78456 a78457 a78458 a78459 a78460 a78461 a78462 a78463 a78464 a78465 a78466 a78467 a78468 a78469 a78470 a78471 a78472 a78473 a78474 a78475 a78476 a78477 a78478 a78479 a78480 a78481 a78482 a78483 a78484 a78485 a78486 a78487 a78488 a78489 a78490 a78491 a78492 a78493 a78494 a78495 a78496 a78497 a78498 a78499 a78500 a78501 a78502 a78503 a78504 a78505 a78506 a78507 a78508 a78509 a78510 a78511 a78512 a78513 a78514 a78515 a78516 a78517 a78518 a78519 a78520 a78521 a78522 a78523 a78524 a78525 a78526 a78527 a78528 a78529 a78530 a78531 a78532 a78533 a78534 a78535 a78536 a78537 a78538 a78539 a78540 a78541 a78542 a78543 a78544 a78545 a78546 a78547 a78548 a78549 a78550 a78551 a78552 a78553 a78554 a78555 a78556 a78557 a78558 a78559 a78560 a78561 a78562 a78563 a78564 a78565 a78566 a78567 a78568 a78569 a78570 a78571 a78572 a78573 a78574 a78575 a78576 a78577 a78578 a78579 a78580 a78581 a78582 a78583 a78584 a78585 a78586 a78587 a78588 a78589 a78590 a78591 a78592 a78593 a78594 a78595 a78596 a78597 a78598 a78599 a78600 a78601 a78602 a78603 a78604 a78605 a78606 a78607 a78608 a78609 a78610 a78611 a78612 a78613 a78614 a78615 a78616 a78617 a78618 a78619 a78620 a78621 a78622 a78623 a78624 a78625 a78626 a78627 a78628 a78629 a78630 a78631 a78632 a78633 a78634 a78635 a78636 a78637 a78638 a78639 a78640 a78641 a78642 a78643 a78644 a78645 a78646 a78647 a78648 a78649 a78650 a78651 a78652 a78653 a78654 a78655 a78656 a78657 a78658 a78659 a78660 a78661 a78662 a78663 a78664 a78665 a78666 a78667 a78668 a78669 a78670 a78671 a78672 a78673 a78674 a78675 a78676 a78677 a78678 a78679 a78680 a78681 a78682 a78683 a78684 a78685 a78686 a78687 a78688 a78689 a78690 a78691 a78692 a78693 a78694 a78695 a78696 a78697 a78698 a78699 a78700 a78701 a78702 a78703 a78704 a78705 a78706 a78707 a78708 a78709 a78710 a78711 a78712 a78713 a78714 a78715 a78716 a78717 a78718 a78719 a78720 a78721 a78722 a78723 a78724 a78725 a78726 a78727 a78728 a78729 a78730 a78731 a78732 a78733 a78734 a78735 a78736 a78737 a78738 a78739 a78740 a78741 a78742 a78743 a78744 a78745 a78746 a78747 a78748 a78749 a78750 a78751 a78752 a78753 a78754 a78755 a78756 a78757 a78758 a78759 a78760 a78761 a78762 a78763 a78764 a78765 a78766 a78767 a78768 a78769 a78770 a78771 a78772 a78773 a78774 a78775 a78776 a78777 a78778 a78779 a78780 a78781 a78782 a78783 a78784 a78785 a78786 a78787 a78788 a78789 a78790 a78791 a78792 a78793 a78794 a78795 a78796 a78797 a78798 a78799 a78800 a78801 a78802 a78803 a78804 a78805 a78806 a78807 a78808 a78809 a78810 a78811 a78812 a78813 a78814 a78815 a78816 a78817 a78818 a78819 a78820 a78821 a78822 a78823 a78824 a78825 a78826 a78827 a78828 a78829 a78830 a78831 a78832 a78833 a78834 a78835 a78836 a78837 a78838 a78839 a78840 a78841 a78842 a78843 a78844 a78845 a78846 a78847 a78848 a78849 a78850 a78851 a78852 a78853 a78854 a78855 a78856 a78857 a78858 a78859 a78860 a78861 a78862 a78863 a78864 a78865 a78866 a78867 a78868 a78869 a78870 a78871 a78872 a78873 a78874 a78875 a78876 a78877 a78878 a78879 a78880 a78881 a78882 a78883 a78884 a78885 a78886 a78887 a78888 a78889 a78890 a78891 a78892 a78893 a78894 a78895 a78896 a78897 a78898 a78899 a78900 a78901 a78902 a78903 a78904 a78905 a78906 a78907 a78908 a78909 a78910 a78911 a78912 a78913 a78914 a78915 a78916 a78917 a78918 a78919 a78920 a78921 a78922 a78923 a78924 a78925 a78926 a78927 a78928 a78929 a78930 a78931 a78932 a78933 a78934 a78935 a78936 a78937 a78938 a78939 a78940 a78941 a78942 a78943 a78944 a78945 a78946 a78947 a78948 a78949 a78950 a78951 a78952 a78953 a78954 a78955 a78956 a78957 a78958 a78959 a78960 a78961 a78962 a78963 a78964 a78965 a78966 a78967 a78968 a78969 a78970 a78971 a78972 a78973 a78974 a78975 a78976 a78977 a78978 a78979 a78980 a78981 a78982 a78983 a78984 a78985 a78986 a78987 a78988 a78989 a78990 a78991 a78992 a78993 a78994 a78995 a78996 a78997 a78998 a78999 a79000 a79001 a79002 a79003 a79004 a79005 a79006 a79007 a79008 a79009 a79010 a79011 a79012 a79013 a79014 a79015 a79016 a79017 a79018 a79019 a79020 a79021 a79022 a79023 a79024 a79025 a79026 a79027 a79028 a79029 a79030 a79031 a79032 a79033 a79034 a79035 a79036 a79037 a79038 a79039 a79040 a79041 a79042 a79043 a79044 a79045 a79046 a79047 a79048 a79049 a79050 a79051 a79052 a79053 a79054 a79055 a79056 a79057 a79058 a79059 a79060 a79061 a79062 a79063 a79064 a79065 a79066 a79067 a79068 a79069 a79070 a79071 a79072 a79073 a79074 a79075 a79076 a79077 a79078 a79079 a79080 a79081 a79082 a79083 a79084 a79085 a79086 a79087 a79088 a79089 a79090 a79091 a79092 a79093 a79094 a79095 a79096 a79097 a79098 a79099 a79100 a79101 a79102 a79103 a79104 a79105 a79106 a79107 a79108 a79109 a79110 a79111 a79112 a79113 a79114 a79115 a79116 a79117 a79118 a79119 a79120 a79121 a79122 a79123 a79124 a79125 a79126 a79127 a79128 a79129 a79130 a79131 a79132 a79133 a79134 a79135 a79136 a79137 a79138 a79139 a79140 a79141 a79142 a79143 a79144 a79145 a79146 a79147 a79148 a79149 a79150 a79151 a79152 a79153 a79154 a79155 a79156 a79157 a79158 a79159 a79160 a79161 a79162 a79163 a79164 a79165 a79166 a79167 a79168 a79169 a79170 a79171 a79172 a79173 a79174 a79175 a79176 a79177 a79178 a79179 a79180 a79181 a79182 a79183 a79184 a79185 a79186 a79187 a79188 a79189 a79190 a79191 a79192 a79193 a79194 a79195 a79196 a79197 a79198 a79199 a79200 a79201 a79202 a79203 a79204 a79205 a79206 a79207 a79208 a79209 a79210 a79211 a79212 a79213 a79214 a79215 a79216 a79217 a79218 a79219 a79220 a79221 a79222 a79223 a79224 a79225 a79226 a79227 a79228 a79229 a79230 a79231 a79232 a79233 a79234 a79235 a79236 a79237 a79238 a79239 a79240 a79241 a79242 a79243 a79244 a79245 a79246 a79247 a79248 a79249 a79250 a79251 a79252 a79253 a79254 a79255 a79256 a79257 a79258 a79259 a79260 a79261 a79262 a79263 a79264 a79265 a79266 a79267 a79268 a79269 a79270 a79271 a79272 a79273 a79274 a79275 a79276 a79277 a79278 a79279 a79280 a79281 a79282 a79283 a79284 a79285 a79286 a79287 a79288 a79289 a79290 a79291 a79292 a79293 a79294 a79295 a79296 a79297 a79298 a79299 a79300 a79301 a79302 a79303 a79304 a79305 a79306 a79307 a79308 a79309 a79310 a79311 a79312 a79313 a79314 a79315 a79316 a79317 a79318 a79319 a79320 a79321 a79322 a79323 a79324 a79325 a79326 a79327 a79328 a79329 a79330 a79331 a79332 a79333 a79334 a79335 a79336 a79337 a79338 a79339 a79340 a79341 a79342 a79343 a79344 a79345 a79346 a79347 a79348 a79349 a79350 a79351 a79352 a79353 a79354 a79355 a79356 a79357 a79358 a79359 a79360 a79361 a79362 a79363 a79364 a79365 a79366 a79367 a79368 a79369 a79370 a79371 a79372 a79373 a79374 a79375 a79376 a79377 a79378 a79379 a79380 a79381 a79382 a79383 a79384 a79385 a79386 a79387 a79388 a79389 a79390 a79391 a79392 a79393 a79394 a79395 a79396 a79397 a79398 a79399 a79400 a79401 a79402 a79403 a79404 a79405 a79406 a79407 a79408 a79409 a79410 a79411 a79412 a79413 a79414 a79415 a79416 a79417 a79418 a79419 a79420 a79421 a79422 a79423 a79424 a79425 a79426 a79427 a79428 a79429 a79430 a79431 a79432 a79433 a79434 a79435 a79436 a79437 a79438 a79439 a79440 a79441 a79442 a79443 a79444 a79445 a79446 a79447 a79448 a79449 a79450 a79451 a79452 a79453 a79454 a79455 a79456 a79457 a79458 a79459 a79460 a79461 a79462 a79463 a79464 a79465 a79466 a79467 a79468 a79469 a79470 a79471 a79472 a79473 a79474 a79475 a79476 a79477 a79478 a79479 a79480 a79481 a79482 a79483 a79484 a79485 a79486 a79487 a79488 a79489 a79490 a79491 a79492 a79493 a79494 a79495 a79496 a79497 a79498 a79499 a79500 a79501 a79502 a79503 a79504 a79505 a79506 a79507 a79508 a79509 a79510 a79511 a79512 a79513 a79514 a79515 a79516 a79517 a79518 a79519 a79520 a79521 a79522 a79523 a79524 a79525 a79526 a79527 a79528 a79529 a79530 a79531 a79532 a79533 a79534 a79535 a79536 a79537 a79538 a79539 a79540 a79541 a79542 a79543 a79544 a79545 a79546 a79547 a79548 a79549 a79550 a79551 a79552 a79553 a79554 a79555 a79556 a79557 a79558 a79559 a79560 a79561 a79562 a79563 a79564 a79565 a79566 a79567 a79568 a79569 a79570 a79571 a79572 a79573 a79574 a79575 a79576 a79577 a79578 a79579 a79580 a79581 a79582 a79583 a79584 a79585 a79586 a79587 a79588 a79589 a79590 a79591 a79592 a79593 a79594 a79595 a79596 a79597 a79598 a79599 a79600 a79601 a79602 a79603 a79604 a79605 a79606 a79607 a79608 a79609 a79610 a79611 a79612 a79613 a79614 a79615 a79616 a79617 a79618 a79619 a79620 a79621 a79622 a79623 a79624 a79625 a79626 a79627 a79628 a79629 a79630 a79631 a79632 a79633 a79634 a79635 a79636 a79637 a79638 a79639 a79640 a79641 a79642 a79643 a79644 a79645 a79646 a79647 a79648 a79649 a79650 a79651 a79652 a79653 a79654 a79655 a79656 a79657 a79658 a79659 a79660 a79661 a79662 a79663 a79664 a79665 a79666 a79667 a79668 a79669 a79670 a79671 a79672 a79673 a79674 a79675 a79676 a79677 a79678 a79679 a79680 a79681 a79682 a79683 a79684 a79685 a79686 a79687 a79688 a79689 a79690 a79691 a79692 a79693 a79694 a79695 a79696 a79697 a79698 a79699 a79700 a79701 a79702 a79703 a79704 a79705 a79706 a79707 a79708 a79709 a79710 a79711 a79712 a79713 a79714 a79715 a79716 a79717 a79718 a79719 a79720 a79721 a79722 a79723 a79724 a79725 a79726 a79727 a79728 a79729 a79730 a79731 a79732 a79733 a79734 a79735 a79736 a79737 a79738 a79739 a79740 a79741 a79742 a79743 a79744 a79745 a79746 a79747 a79748 a79749 a79750 a79751 a79752 a79753 a79754 a79755 a79756 a79757 a79758 a79759 a79760 a79761 a79762 a79763 a79764 a79765 a79766 a79767 a79768 a79769 a79770 a79771 a79772 a79773 a79774 a79775 a79776 a79777 a79778 a79779 a79780 a79781 a79782 a79783 a79784 a79785 a79786 a79787 a79788 a79789 a79790 a79791 a79792 a79793 a79794 a79795 a79796 a79797 a79798 a79799 a79800 a79801 a79802 a79803 a79804 a79805 a79806 a79807 a79808 a79809 a79810 a79811 a79812 a79813 a79814 a79815 a79816 a79817 a79818 a79819 a79820 a79821 a79822 a79823 a79824 a79825 a79826 a79827 a79828 a79829 a79830 a79831 a79832 a79833 a79834 a79835 a79836 a79837 a79838 a79839 a79840 a79841 a79842 a79843 a79844 a79845 a79846 a79847 a79848 a79849 a79850 a79851 a79852 a79853 a79854 a79855 a79856 a79857 a79858 a79859 a79860 a79861 a79862 a79863 a79864 a79865 a79866 a79867 a79868 a79869 a79870 a79871 a79872 a79873 a79874 a79875 a79876 a79877 a79878 a79879 a79880 a79881 a79882 a79883 a79884 a79885 a79886 a79887 a79888 a79889 a79890 a79891 a79892 a79893 a79894 a79895 a79896 a79897 a79898 a79899 a79900 a79901 a79902 a79903 a79904 a79905 a79906 a79907 a79908 a79909 a79910 a79911 a79912 a79913 a79914 a79915 a79916 a79917 a79918 a79919 a79920 a79921 a79922 a79923 a79924 a79925 a79926 a79927 a79928 a79929 a79930 a79931 a79932 a79933 a79934 a79935 a79936 a79937 a79938 a79939 a79940 a79941 a79942 a79943 a79944 a79945 a79946 a79947 a79948 a79949 a79950 a79951 a79952 a79953 a79954 a79955 a79956 a79957 a79958 a79959 a79960 a79961 a79962 a79963 a79964 a79965 a79966 a79967 a79968 a79969 a79970 a79971 a79972 a79973 a79974 a79975 a79976 a79977 a79978 a79979 a79980 a79981 a79982 a79983 a79984 a79985 a79986 a79987 a79988 a79989 a79990 a79991 a79992 a79993 a79994 a79995 a79996 a79997 a79998 a79999 a80000 a80001 a80002 a80003 a80004 a80005 a80006 a80007 a80008 a80009 a80010 a80011 a80012 a80013 a80014 a80015 a80016 a80017 a80018 a80019 a80020 a80021 a80022 a80023 a80024 a80025 a80026 a80027 a80028 a80029 a80030 a80031 a80032 a80033 a80034 a80035 a80036 a80037 a80038 a80039 a80040 a80041 a80042 a80043 a80044 a80045 a80046 a80047 a80048 a80049 a80050 a80051 a80052 a80053 a80054 a80055 a80056 a80057 a80058 a80059 a80060 a80061 a80062 a80063 a80064 a80065 a80066 a80067 a80068 a80069 a80070 a80071 a80072 a80073 a80074 a80075 a80076 a80077 a80078 a80079 a80080 a80081 a80082 a80083 a80084 a80085 a80086 a80087 a80088 a80089 a80090 a80091 a80092 a80093 a80094 a80095 a80096 a80097 a80098 a80099 a80100 a80101 a80102 a80103 a80104 a80105 a80106 a80107 a80108 a80109 a80110 a80111 a80112 a80113 a80114 a80115 a80116 a80117 a80118 a80119 a80120 a80121 a80122 a80123 a80124 a80125 a80126 a80127 a80128 a80129 a80130 a80131 a80132 a80133 a80134 a80135 a80136 a80137 a80138 a80139 a80140 a80141 a80142 a80143 a80144 a80145 a80146 a80147 a80148 a80149 a80150 a80151 a80152 a80153 a80154 a80155 a80156 a80157 a80158 a80159 a80160 a80161 a80162 a80163 a80164 a80165 a80166 a80167 a80168 a80169 a80170 a80171 a80172 a80173 a80174 a80175 a80176 a80177 a80178 a80179 a80180 a80181 a80182 a80183 a80184 a80185 a80186 a80187 a80188 a80189 a80190 a80191 a80192 a80193 a80194 a80195 a80196 a80197 a80198 a80199 a80200 a80201 a80202 a80203 a80204 a80205 a80206 a80207 a80208 a80209 a80210 a80211 a80212 a80213 a80214 a80215 a80216 a80217 a80218 a80219 a80220 a80221 a80222 a80223 a80224 a80225 a80226 a80227 a80228 a80229 a80230 a80231 a80232 a80233 a80234 a80235 a80236 a80237 a80238 a80239 a80240 a80241 a80242 a80243 a80244 a80245 a80246 a80247 a80248 a80249 a80250 a80251 a80252 a80253 a80254 a80255 a80256 a80257 a80258 a80259 a80260 a80261 a80262 a80263 a80264 a80265 a80266 a80267 a80268 a80269 a80270 a80271 a80272 a80273 a80274 a80275 a80276 a80277 a80278 a80279 a80280 a80281 a80282 a80283 a80284 a80285 a80286 a80287 a80288 a80289 a80290 a80291 a80292 a80293 a80294 a80295 a80296 a80297 a80298 a80299 a80300 a80301 a80302 a80303 a80304 a80305 a80306 a80307 a80308 a80309 a80310 a80311 a80312 a80313 a80314 a80315 a80316 a80317 a80318 a80319 a80320 a80321 a80322 a80323 a80324 a80325 a80326 a80327 a80328 a80329 a80330 a80331 a80332 a80333 a80334 a80335 a80336 a80337 a80338 a80339 a80340 a80341 a80342 a80343 a80344 a80345 a80346 a80347 a80348 a80349 a80350 a80351 a80352 a80353 a80354 a80355 a80356 a80357 a80358 a80359 a80360 a80361 a80362 a80363 a80364 a80365 a80366 a80367 a80368 a80369 a80370 a80371 a80372 a80373 a80374 a80375 a80376 a80377 a80378 a80379 a80380 a80381 a80382 a80383 a80384 a80385 a80386 a80387 a80388 a80389 a80390 a80391 a80392 a80393 a80394 a80395 a80396 a80397 a80398 a80399 a80400 a80401 a80402 a80403 a80404 a80405 a80406 a80407 a80408 a80409 a80410 a80411 a80412 a80413 a80414 a80415 a80416 a80417 a80418 a80419 a80420 a80421 a80422 a80423 a80424 a80425 a80426 a80427 a80428 a80429 a80430 a80431 a80432 a80433 a80434 a80435 a80436 a80437 a80438 a80439 a80440 a80441 a80442 a80443 a80444 a80445 a80446 a80447 a80448 a80449 a80450 a80451 a80452 a80453 a80454 a80455 a80456 a80457 a80458 a80459 a80460 a80461 a80462 a80463 a80464 a80465 a80466 a80467 a80468 a80469 a80470 a80471 a80472 a80473 a80474 a80475 a80476 a80477 a80478 a80479 a80480 a80481 a80482 a80483 a80484 a80485 a80486 a80487 a80488 a80489 a80490 a80491 a80492 a80493 a80494 a80495 a80496 a80497 a80498 a80499 a80500 a80501 a80502 a80503 a80504 a80505 a80506 a80507 a80508 a80509 a80510 a80511 a80512 a80513 a80514 a80515 a80516 a80517 a80518 a80519 a80520 a80521 a80522 a80523 a80524 a80525 a80526 a80527 a80528 a80529 a80530 a80531 a80532 a80533 a80534 a80535 a80536 a80537 a80538 a80539 a80540 a80541 a80542 a80543 a80544 a80545 a80546 a80547 a80548 a80549 a80550 a80551 a80552 a80553 a80554 a80555 a80556 a80557 a80558 a80559 a80560 a80561 a80562 a80563 a80564 a80565 a80566 a80567 a80568 a80569 a80570 a80571 a80572 a80573 a80574 a80575 a80576 a80577 a80578 a80579 a80580 a80581 a80582 a80583 a80584 a80585 a80586 a80587 a80588 a80589 a80590 a80591 a80592 a80593 a80594 a80595 a80596 a80597 a80598 a80599 a80600 a80601 a80602 a80603 a80604 a80605 a80606 a80607 a80608 a80609 a80610 a80611 a80612 a80613 a80614 a80615 a80616 a80617 a80618 a80619 a80620 a80621 a80622 a80623 a80624 a80625 a80626 a80627 a80628 a80629 a80630 a80631 a80632 a80633 a80634 a80635 a80636 a80637 a80638 a80639 a80640 a80641 a80642 a80643 a80644 a80645 a80646 a80647 a80648 a80649 a80650 a80651 a80652 a80653 a80654 a80655 a80656 a80657 a80658 a80659 a80660 a80661 a80662 a80663 a80664 a80665 a80666 a80667 a80668 a80669 a80670 a80671 a80672 a80673 a80674 a80675 a80676 a80677 a80678 a80679 a80680 a80681 a80682 a80683 a80684 a80685 a80686 a80687 a80688 a80689 a80690 a80691 a80692 a80693 a80694 a80695 a80696 a80697 a80698 a80699 a80700 a80701 a80702 a80703 a80704 a80705 a80706 a80707 a80708 a80709 a80710 a80711 a80712 a80713 a80714 a80715 a80716 a80717 a80718 a80719 a80720 a80721 a80722 a80723 a80724 a80725 a80726 a80727 a80728 a80729 a80730 a80731 a80732 a80733 a80734 a80735 a80736 a80737 a80738 a80739 a80740 a80741 a80742 a80743 a80744 a80745 a80746 a80747 a80748 a80749 a80750 a80751 a80752 a80753 a80754 a80755 a80756 a80757 a80758 a80759 a80760 a80761 a80762 a80763 a80764 a80765 a80766 a80767 a80768 a80769 a80770 a80771 a80772 a80773 a80774 a80775 a80776 a80777 a80778 a80779 a80780 a80781 a80782 a80783 a80784 a80785 a80786 a80787 a80788 a80789 a80790 a80791 a80792 a80793 a80794 a80795 a80796 a80797 a80798 a80799 a80800 a80801 a80802 a80803 a80804 a80805 a80806 a80807 a80808 a80809 a80810 a80811 a80812 a80813 a80814 a80815 a80816 a80817 a80818 a80819 a80820 a80821 a80822 a80823 a80824 a80825 a80826 a80827 a80828 a80829 a80830 a80831 a80832 a80833 a80834 a80835 a80836 a80837 a80838 a80839 a80840 a80841 a80842 a80843 a80844 a80845 a80846 a80847 a80848 a80849 a80850 a80851 a80852 a80853 a80854 a80855 a80856 a80857 a80858 a80859 a80860 a80861 a80862 a80863 a80864 a80865 a80866 a80867 a80868 a80869 a80870 a80871 a80872 a80873 a80874 a80875 a80876 a80877 a80878 a80879 a80880 a80881 a80882 a80883 a80884 a80885 a80886 a80887 a80888 a80889 a80890 a80891 a80892 a80893 a80894 a80895 a80896 a80897 a80898 a80899 a80900 a80901 a80902 a80903 a80904 a80905 a80906 a80907 a80908 a80909 a80910 a80911 a80912 a80913 a80914 a80915 a80916 a80917 a80918 a80919 a80920 a80921 a80922 a80923 a80924 a80925 a80926 a80927 a80928 a80929 a80930 a80931 a80932 a80933 a80934 a80935 a80936 a80937 a80938 a80939 a80940 a80941 a80942 a80943 a80944 a80945 a80946 a80947 a80948 a80949 a80950 a80951 a80952 a80953 a80954 a80955 a80956 a80957 a80958 a80959 a80960 a80961 a80962 a80963 a80964 a80965 a80966 a80967 a80968 a80969 a80970 a80971 a80972 a80973 a80974 a80975 a80976 a80977 a80978 a80979 a80980 a80981 a80982 a80983 a80984 a80985 a80986 a80987 a80988 a80989 a80990 a80991 a80992 a80993 a80994 a80995 a80996 a80997 a80998 a80999 a81000 a81001 a81002 a81003 a81004 a81005 a81006 a81007 a81008 a81009 a81010 a81011 a81012 a81013 a81014 a81015 a81016 a81017 a81018 a81019 a81020 a81021 a81022 a81023 a81024 a81025 a81026 a81027 a81028 a81029 a81030 a81031 a81032 a81033 a81034 a81035 a81036 a81037 a81038 a81039 a81040 a81041 a81042 a81043 a81044 a81045 a81046 a81047 a81048 a81049 a81050 a81051 a81052 a81053 a81054 a81055 a81056 a81057 a81058 a81059 a81060 a81061 a81062 a81063 a81064 a81065 a81066 a81067 a81068 a81069 a81070 a81071 a81072 a81073 a81074 a81075 a81076 a81077 a81078 a81079 a81080 a81081 a81082 a81083 a81084 a81085 a81086 a81087 a81088 a81089 a81090 a81091 a81092 a81093 a81094 a81095 a81096 a81097 a81098 a81099 a81100 a81101 a81102 a81103 a81104 a81105 a81106 a81107 a81108 a81109 a81110 a81111 a81112 a81113 a81114 a81115 a81116 a81117 a81118 a81119 a81120 a81121 a81122 a81123 a81124 a81125 a81126 a81127 a81128 a81129 a81130 a81131 a81132 a81133 a81134 a81135 a81136 a81137 a81138 a81139 a81140 a81141 a81142 a81143 a81144 a81145 a81146 a81147 a81148 a81149 a81150 a81151 a81152 a81153 a81154 a81155 a81156 a81157 a81158 a81159 a81160 a81161 a81162 a81163 a81164 a81165 a81166 a81167 a81168 a81169 a81170 a81171 a81172 a81173 a81174 a81175 a81176 a81177 a81178 a81179 a81180 a81181 a81182 a81183 a81184 a81185 a81186 a81187 a81188 a81189 a81190 a81191 a81192 a81193 a81194 a81195 a81196 a81197 a81198 a81199 a81200 a81201 a81202 a81203 a81204 a81205 a81206 a81207 a81208 a81209 a81210 a81211 a81212 a81213 a81214 a81215 a81216 a81217 a81218 a81219 a81220 a81221 a81222 a81223 a81224 a81225 a81226 a81227 a81228 a81229 a81230 a81231 a81232 a81233 a81234 a81235 a81236 a81237 a81238 a81239 a81240 a81241 a81242 a81243 a81244 a81245 a81246 a81247 a81248 a81249 a81250 a81251 a81252 a81253 a81254 a81255 a81256 a81257 a81258 a81259 a81260 a81261 a81262 a81263 a81264 a81265 a81266 a81267 a81268 a81269 a81270 a81271 a81272 a81273 a81274 a81275 a81276 a81277 a81278 a81279 a81280 a81281 a81282 a81283 a81284 a81285 a81286 a81287 a81288 a81289 a81290 a81291 a81292 a81293 a81294 a81295 a81296 a81297 a81298 a81299 a81300 a81301 a81302 a81303 a81304 a81305 a81306 a81307 a81308 a81309 a81310 a81311 a81312 a81313 a81314 a81315 a81316 a81317 a81318 a81319 a81320 a81321 a81322 a81323 a81324 a81325 a81326 a81327 a81328 a81329 a81330 a81331 a81332 a81333 a81334 a81335 a81336 a81337 a81338 a81339 a81340 a81341 a81342 a81343 a81344 a81345 a81346 a81347 a81348 a81349 a81350 a81351 a81352 a81353 a81354 a81355 a81356 a81357 a81358 a81359 a81360 a81361 a81362 a81363 a81364 a81365 a81366 a81367 a81368 a81369 a81370 a81371 a81372 a81373 a81374 a81375 a81376 a81377 a81378 a81379 a81380 a81381 a81382 a81383 a81384 a81385 a81386 a81387 a81388 a81389 a81390 a81391 a81392 a81393 a81394 a81395 a81396 a81397 a81398 a81399 a81400 a81401 a81402 a81403 a81404 a81405 a81406 a81407 a81408 a81409 a81410 a81411 a81412 a81413 a81414 a81415 a81416 a81417 a81418 a81419 a81420 a81421 a81422 a81423 a81424 a81425 a81426 a81427 a81428 a81429 a81430 a81431 a81432 a81433 a81434 a81435 a81436 a81437 a81438 a81439 a81440 a81441 a81442 a81443 a81444 a81445 a81446 a81447 a81448 a81449 a81450 a81451 a81452 a81453 a81454 a81455 a81456 a81457 a81458 a81459 a81460 a81461 a81462 a81463 a81464 a81465 a81466 a81467 a81468 a81469 a81470 a81471 a81472 a81473 a81474 a81475 a81476 a81477 a81478 a81479 a81480 a81481 a81482 a81483 a81484 a81485 a81486 a81487 a81488 a81489 a81490 a81491 a81492 a81493 a81494 a81495 a81496 a81497 a81498 a81499 a81500 a81501 a81502 a81503 a81504 a81505 a81506 a81507 a81508 a81509 a81510 a81511 a81512 a81513 a81514 a81515 a81516 a81517 a81518 a81519 a81520 a81521 a81522 a81523 a81524 a81525 a81526 a81527 a81528 a81529 a81530 a81531 a81532 a81533 a81534 a81535 a81536 a81537 a81538 a81539 a81540 a81541 a81542 a81543 a81544 a81545 a81546 a81547 a81548 a81549 a81550 a81551 a81552 a81553 a81554 a81555 a81556 a81557 a81558 a81559 a81560 a81561 a81562 a81563 a81564 a81565 a81566 a81567 a81568 a81569 a81570 a81571 a81572 a81573 a81574 a81575 a81576 a81577 a81578 a81579 a81580 a81581 a81582 a81583 a81584 a81585 a81586 a81587 a81588 a81589 a81590 a81591 a81592 a81593 a81594 a81595 a81596 a81597 a81598 a81599 a81600 a81601 a81602 a81603 a81604 a81605 a81606 a81607 a81608 a81609 a81610 a81611 a81612 a81613 a81614 a81615 a81616 a81617 a81618 a81619 a81620 a81621 a81622 a81623 a81624 a81625 a81626 a81627 a81628 a81629 a81630 a81631 a81632 a81633 a81634 a81635 a81636 a81637 a81638 a81639 a81640 a81641 a81642 a81643 a81644 a81645 a81646 a81647 a81648 a81649 a81650 a81651 a81652 a81653 a81654 a81655 a81656 a81657 a81658 a81659 a81660 a81661 a81662 a81663 a81664 a81665 a81666 a81667 a81668 a81669 a81670 a81671 a81672 a81673 a81674 a81675 a81676 a81677 a81678 a81679 a81680 a81681 a81682 a81683 a81684 a81685 a81686 a81687 a81688 a81689 a81690 a81691 a81692 a81693 a81694 a81695 a81696 a81697 a81698 a81699 a81700 a81701 a81702 a81703 a81704 a81705 a81706 a81707 a81708 a81709 a81710 a81711 a81712 a81713 a81714 a81715 a81716 a81717 a81718 a81719 a81720 a81721 a81722 a81723 a81724 a81725 a81726 a81727 a81728 a81729 a81730 a81731 a81732 a81733 a81734 a81735 a81736 a81737 a81738 a81739 a81740 a81741 a81742 a81743 a81744 a81745 a81746 a81747 a81748 a81749 a81750 a81751 a81752 a81753 a81754 a81755 a81756 a81757 a81758 a81759 a81760 a81761 a81762 a81763 a81764 a81765 a81766 a81767 a81768 a81769 a81770 a81771 a81772 a81773 a81774 a81775 a81776 a81777 a81778 a81779 a81780 a81781 a81782 a81783 a81784 a81785 a81786 a81787 a81788 a81789 a81790 a81791 a81792 a81793 a81794 a81795 a81796 a81797 a81798 a81799 a81800 a81801 a81802 a81803 a81804 a81805 a81806 a81807 a81808 a81809 a81810 a81811 a81812 a81813 a81814 a81815 a81816 a81817 a81818 a81819 a81820 a81821 a81822 a81823 a81824 a81825 a81826 a81827 a81828 a81829 a81830 a81831 a81832 a81833 a81834 a81835 a81836 a81837 a81838 a81839 a81840 a81841 a81842 a81843 a81844 a81845 a81846 a81847 a81848 a81849 a81850 a81851 a81852 a81853 a81854 a81855 a81856 a81857 a81858 a81859 a81860 a81861 a81862 a81863 a81864 a81865 a81866 a81867 a81868 a81869 a81870 a81871 a81872 a81873 a81874 a81875 a81876 a81877 a81878 a81879 a81880 a81881 a81882 a81883 a81884 a81885 a81886 a81887 a81888 a81889 a81890 a81891 a81892 a81893 a81894 a81895 a81896 a81897 a81898 a81899 a81900 a81901 a81902 a81903 a81904 a81905 a81906 a81907 a81908 a81909 a81910 a81911 a81912 a81913 a81914 a81915 a81916 a81917 a81918 a81919 a81920 a81921 a81922 a81923 a81924 a81925 a81926 a81927 a81928 a81929 a81930 a81931 a81932 a81933 a81934 a81935 a81936 a81937 a81938 a81939 a81940 a81941 a81942 a81943 a81944 a81945 a81946 a81947 a81948 a81949 a81950 a81951 a81952 a81953 a81954 a81955 a81956 a81957 a81958 a81959 a81960 a81961 a81962 a81963 a81964 a81965 a81966 a81967 a81968 a81969 a81970 a81971 a81972 a81973 a81974 a81975 a81976 a81977 a81978 a81979 a81980 a81981 a81982 a81983 a81984 a81985 a81986 a81987 a81988 a81989 a81990 a81991 a81992 a81993 a81994 a81995 a81996 a81997 a81998 a81999 a82000 a82001 a82002 a82003 a82004 a82005 a82006 a82007 a82008 a82009 a82010 a82011 a82012 a82013 a82014 a82015 a82016 a82017 a82018 a82019 a82020 a82021 a82022 a82023 a82024 a82025 a82026 a82027 a82028 a82029 a82030 a82031 a82032 a82033 a82034 a82035 a82036 a82037 a82038 a82039 a82040 a82041 a82042 a82043 a82044 a82045 a82046 a82047 a82048 a82049 a82050 a82051 a82052 a82053 a82054 a82055 a82056 a82057 a82058 a82059 a82060 a82061 a82062 a82063 a82064 a82065 a82066 a82067 a82068 a82069 a82070 a82071 a82072 a82073 a82074 a82075 a82076 a82077 a82078 a82079 a82080 a82081 a82082 a82083 a82084 a82085 a82086 a82087 a82088 a82089 a82090 a82091 a82092 a82093 a82094 a82095 a82096 a82097 a82098 a82099 a82100 a82101 a82102 a82103 a82104 a82105 a82106 a82107 a82108 a82109 a82110 a82111 a82112 a82113 a82114 a82115 a82116 a82117 a82118 a82119 a82120 a82121 a82122 a82123 a82124 a82125 a82126 a82127 a82128 a82129 a82130 a82131 a82132 a82133 a82134 a82135 a82136 a82137 a82138 a82139 a82140 a82141 a82142 a82143 a82144 a82145 a82146 a82147 a82148 a82149 a82150 a82151 a82152 a82153 a82154 a82155 a82156 a82157 a82158 a82159 a82160 a82161 a82162 a82163 a82164 a82165 a82166 a82167 a82168 a82169 a82170 a82171 a82172 a82173 a82174 a82175 a82176 a82177 a82178 a82179 a82180 a82181 a82182 a82183 a82184 a82185 a82186 a82187 a82188 a82189 a82190 a82191 a82192 a82193 a82194 a82195 a82196 a82197 a82198 a82199 a82200 a82201 a82202 a82203 a82204 a82205 a82206 a82207 a82208 a82209 a82210 a82211 a82212 a82213 a82214 a82215 a82216 a82217 a82218 a82219 a82220 a82221 a82222 a82223 a82224 a82225 a82226 a82227 a82228 a82229 a82230 a82231 a82232 a82233 a82234 a82235 a82236 a82237 a82238 a82239 a82240 a82241 a82242 a82243 a82244 a82245 a82246 a82247 a82248 a82249 a82250 a82251 a82252 a82253 a82254 a82255 a82256 a82257 a82258 a82259 a82260 a82261 a82262 a82263 a82264 a82265 a82266 a82267 a82268 a82269 a82270 a82271 a82272 a82273 a82274 a82275 a82276 a82277 a82278 a82279 a82280 a82281 a82282 a82283 a82284 a82285 a82286 a82287 a82288 a82289 a82290 a82291 a82292 a82293 a82294 a82295 a82296 a82297 a82298 a82299 a82300 a82301 a82302 a82303 a82304 a82305 a82306 a82307 a82308 a82309 a82310 a82311 a82312 a82313 a82314 a82315 a82316 a82317 a82318 a82319 a82320 a82321 a82322 a82323 a82324 a82325 a82326 a82327 a82328 a82329 a82330 a82331 a82332 a82333 a82334 a82335 a82336 a82337 a82338 a82339 a82340 a82341 a82342 a82343 a82344 a82345 a82346 a82347 a82348 a82349 a82350 a82351 a82352 a82353 a82354 a82355 a82356 a82357 a82358 a82359 a82360 a82361 a82362 a82363 a82364 a82365 a82366 a82367 a82368 a82369 a82370 a82371 a82372 a82373 a82374 a82375 a82376 a82377 a82378 a82379 a82380 a82381 a82382 a82383 a82384 a82385 a82386 a82387 a82388 a82389 a82390 a82391 a82392 a82393 a82394 a82395 a82396 a82397 a82398 a82399 a82400 a82401 a82402 a82403 a82404 a82405 a82406 a82407 a82408 a82409 a82410 a82411 a82412 a82413 a82414 a82415 a82416 a82417 a82418 a82419 a82420 a82421 a82422 a82423 a82424 a82425 a82426 a82427 a82428 a82429 a82430 a82431 a82432 a82433 a82434 a82435 a82436 a82437 a82438 a82439 a82440 a82441 a82442 a82443 a82444 a82445 a82446 a82447 a82448 a82449 a82450 a82451 a82452 a82453 a82454 a82455 a82456 a82457 a82458 a82459 a82460 a82461 a82462 a82463 a82464 a82465 a82466 a82467 a82468 a82469 a82470 a82471 a82472 a82473 a82474 a82475 a82476 a82477 a82478 a82479 a82480 a82481 a82482 a82483 a82484 a82485 a82486 a82487 a82488 a82489 a82490 a82491 a82492 a82493 a82494 a82495 a82496 a82497 a82498 a82499 a82500 a82501 a82502 a82503 a82504 a82505 a82506 a82507 a82508 a82509 a82510 a82511 a82512 a82513 a82514 a82515 a82516 a82517 a82518 a82519 a82520 a82521 a82522 a82523 a82524 a82525 a82526 a82527 a82528 a82529 a82530 a82531 a82532 a82533 a82534 a82535 a82536 a82537 a82538 a82539 a82540 a82541 a82542 a82543 a82544 a82545 a82546 a82547 a82548 a82549 a82550 a82551 a82552 a82553 a82554 a82555 a82556 a82557 a82558 a82559 a82560 a82561 a82562 a82563 a82564 a82565 a82566 a82567 a82568 a82569 a82570 a82571 a82572 a82573 a82574 a82575 a82576 a82577 a82578 a82579 a82580 a82581 a82582 a82583 a82584 a82585 a82586 a82587 a82588 a82589 a82590 a82591 a82592 a82593 a82594 a82595 a82596 a82597 a82598 a82599 a82600 a82601 a82602 a82603 a82604 a82605 a82606 a82607 a82608 a82609 a82610 a82611 a82612 a82613 a82614 a82615 a82616 a82617 a82618 a82619 a82620 a82621 a82622 a82623 a82624 a82625 a82626 a82627 a82628 a82629 a82630 a82631 a82632 a82633 a82634 a82635 a82636 a82637 a82638 a82639 a82640 a82641 a82642 a82643 a82644 a82645 a82646 a82647 a82648 a82649 a82650 a82651 a82652 a82653 a82654 a82655 a82656 a82657 a82658 a82659 a82660 a82661 a82662 a82663 a82664 a82665 a82666 a82667 a82668 a82669 a82670 a82671 a82672 a82673 a82674 a82675 a82676 a82677 a82678 a82679 a82680 a82681 a82682 a82683 a82684 a82685 a82686 a82687 a82688 a82689 a82690 a82691 a82692 a82693 a82694 a82695 a82696 a82697 a82698 a82699 a82700 a82701 a82702 a82703 a82704 a82705 a82706 a82707 a82708 a82709 a82710 a82711 a82712 a82713 a82714 a82715 a82716 a82717 a82718 a82719 a82720 a82721 a82722 a82723 a82724 a82725 a82726 a82727 a82728 a82729 a82730 a82731 a82732 a82733 a82734 a82735 a82736 a82737 a82738 a82739 a82740 a82741 a82742 a82743 a82744 a82745 a82746 a82747 a82748 a82749 a82750 a82751 a82752 a82753 a82754 a82755 a82756 a82757 a82758 a82759 a82760 a82761 a82762 a82763 a82764 a82765 a82766 a82767 a82768 a82769 a82770 a82771 a82772 a82773 a82774 a82775 a82776 a82777 a82778 a82779 a82780 a82781 a82782 a82783 a82784 a82785 a82786 a82787 a82788 a82789 a82790 a82791 a82792 a82793 a82794 a82795 a82796 a82797 a82798 a82799 a82800 a82801 a82802 a82803 a82804 a82805 a82806 a82807 a82808 a82809 a82810 a82811 a82812 a82813 a82814 a82815 a82816 a82817 a82818 a82819 a82820 a82821 a82822 a82823 a82824 a82825 a82826 a82827 a82828 a82829 a82830 a82831 a82832 a82833 a82834 a82835 a82836 a82837 a82838 a82839 a82840 a82841 a82842 a82843 a82844 a82845 a82846 a82847 a82848 a82849 a82850 a82851 a82852 a82853 a82854 a82855 a82856 a82857 a82858 a82859 a82860 a82861 a82862 a82863 a82864 a82865 a82866 a82867 a82868 a82869 a82870 a82871 a82872 a82873 a82874 a82875 a82876 a82877 a82878 a82879 a82880 a82881 a82882 a82883 a82884 a82885 a82886 a82887 a82888 a82889 a82890 a82891 a82892 a82893 a82894 a82895 a82896 a82897 a82898 a82899 a82900 a82901 a82902 a82903 a82904 a82905 a82906 a82907 a82908 a82909 a82910 a82911 a82912 a82913 a82914 a82915 a82916 a82917 a82918 a82919 a82920 a82921 a82922 a82923 a82924 a82925 a82926 a82927 a82928 a82929 a82930 a82931 a82932 a82933 a82934 a82935 a82936 a82937 a82938 a82939 a82940 a82941 a82942 a82943 a82944 a82945 a82946 a82947 a82948 a82949 a82950 a82951 a82952 a82953 a82954 a82955 a82956 a82957 a82958 a82959 a82960 a82961 a82962 a82963 a82964 a82965 a82966 a82967 a82968 a82969 a82970 a82971 a82972 a82973 a82974 a82975 a82976 a82977 a82978 a82979 a82980 a82981 a82982 a82983 a82984 a82985 a82986 a82987 a82988 a82989 a82990 a82991 a82992 a82993 a82994 a82995 a82996 a82997 a82998 a82999 a83000 a83001 a83002 a83003 a83004 a83005 a83006 a83007 a83008 a83009 a83010 a83011 a83012 a83013 a83014 a83015 a83016 a83017 a83018 a83019 a83020 a83021 a83022 a83023 a83024 a83025 a83026 a83027 a83028 a83029 a83030 a83031 a83032 a83033 a83034 a83035 a83036 a83037 a83038 a83039 a83040 a83041 a83042 a83043 a83044 a83045 a83046 a83047 a83048 a83049 a83050 a83051 a83052 a83053 a83054 a83055 a83056 a83057 a83058 a83059 a83060 a83061 a83062 a83063 a83064 a83065 a83066 a83067 a83068 a83069 a83070 a83071 a83072 a83073 a83074 a83075 a83076 a83077 a83078 a83079 a83080 a83081 a83082 a83083 a83084 a83085 a83086 a83087 a83088 a83089 a83090 a83091 a83092 a83093 a83094 a83095 a83096 a83097 a83098 a83099 a83100 a83101 a83102 a83103 a83104 a83105 a83106 a83107 a83108 a83109 a83110 a83111 a83112 a83113 a83114 a83115 a83116 a83117 a83118 a83119 a83120 a83121 a83122 a83123 a83124 a83125 a83126 a83127 a83128 a83129 a83130 a83131 a83132 a83133 a83134 a83135 a83136 a83137 a83138 a83139 a83140 a83141 a83142 a83143 a83144 a83145 a83146 a83147 a83148 a83149 a83150 a83151 a83152 a83153 a83154 a83155 a83156 a83157 a83158 a83159 a83160 a83161 a83162 a83163 a83164 a83165 a83166 a83167 a83168 a83169 a83170 a83171 a83172 a83173 a83174 a83175 a83176 a83177 a83178 a83179 a83180 a83181 a83182 a83183 a83184 a83185 a83186 a83187 a83188 a83189 a83190 a83191 a83192 a83193 a83194 a83195 a83196 a83197 a83198 a83199 a83200 a83201 a83202 a83203 a83204 a83205 a83206 a83207 a83208 a83209 a83210 a83211 a83212 a83213 a83214 a83215 a83216 a83217 a83218 a83219 a83220 a83221 a83222 a83223 a83224 a83225 a83226 a83227 a83228 a83229 a83230 a83231 a83232 a83233 a83234 a83235 a83236 a83237 a83238 a83239 a83240 a83241 a83242 a83243 a83244 a83245 a83246 a83247 a83248 a83249 a83250 a83251 a83252 a83253 a83254 a83255 a83256 a83257 a83258 a83259 a83260 a83261 a83262 a83263 a83264 a83265 a83266 a83267 a83268 a83269 a83270 a83271 a83272 a83273 a83274 a83275 a83276 a83277 a83278 a83279 a83280 a83281 a83282 a83283 a83284 a83285 a83286 a83287 a83288 a83289 a83290 a83291 a83292 a83293 a83294 a83295 a83296 a83297 a83298 a83299 a83300 a83301 a83302 a83303 a83304 a83305 a83306 a83307 a83308 a83309 a83310 a83311 a83312 a83313 a83314 a83315 a83316 a83317 a83318 a83319 a83320 a83321 a83322 a83323 a83324 a83325 a83326 a83327 a83328 a83329 a83330 a83331 a83332 a83333 a83334 a83335 a83336 a83337 a83338 a83339 a83340 a83341 a83342 a83343 a83344 a83345 a83346 a83347 a83348 a83349 a83350 a83351 a83352 a83353 a83354 a83355 a83356 a83357 a83358 a83359 a83360 a83361 a83362 a83363 a83364 a83365 a83366 a83367 a83368 a83369 a83370 a83371 a83372 a83373 a83374 a83375 a83376 a83377 a83378 a83379 a83380 a83381 a83382 a83383 a83384 a83385 a83386 a83387 a83388 a83389 a83390 a83391 a83392 a83393 a83394 a83395 a83396 a83397 a83398 a83399 a83400 a83401 a83402 a83403 a83404 a83405 a83406 a83407 a83408 a83409 a83410 a83411 a83412 a83413 a83414 a83415 a83416 a83417 a83418 a83419 a83420 a83421 a83422 a83423 a83424 a83425 a83426 a83427 a83428 a83429 a83430 a83431 a83432 a83433 a83434 a83435 a83436 a83437 a83438 a83439 a83440 a83441 a83442 a83443 a83444 a83445 a83446 a83447 a83448 a83449 a83450 a83451 a83452 a83453 a83454 a83455 a83456 a83457 a83458 a83459 a83460 a83461 a83462 a83463 a83464 a83465 a83466 a83467 a83468 a83469 a83470 a83471 a83472 a83473 a83474 a83475 a83476 a83477 a83478 a83479 a83480 a83481 a83482 a83483 a83484 a83485 a83486 a83487 a83488 a83489 a83490 a83491 a83492 a83493 a83494 a83495 a83496 a83497 a83498 a83499 a83500 a83501 a83502 a83503 a83504 a83505 a83506 a83507 a83508 a83509 a83510 a83511 a83512 a83513 a83514 a83515 a83516 a83517 a83518 a83519 a83520 a83521 a83522 a83523 a83524 a83525 a83526 a83527 a83528 a83529 a83530 a83531 a83532 a83533 a83534 a83535 a83536 a83537 a83538 a83539 a83540 a83541 a83542 a83543 a83544 a83545 a83546 a83547 a83548 a83549 a83550 a83551 a83552 a83553 a83554 a83555 a83556 a83557 a83558 a83559 a83560 a83561 a83562 a83563 a83564 a83565 a83566 a83567 a83568 a83569 a83570 a83571 a83572 a83573 a83574 a83575 a83576 a83577 a83578 a83579 a83580 a83581 a83582 a83583 a83584 a83585 a83586 a83587 a83588 a83589 a83590 a83591 a83592 a83593 a83594 a83595 a83596 a83597 a83598 a83599 a83600 a83601 a83602 a83603 a83604 a83605 a83606 a83607 a83608 a83609 a83610 a83611 a83612 a83613 a83614 a83615 a83616 a83617 a83618 a83619 a83620 a83621 a83622 a83623 a83624 a83625 a83626 a83627 a83628 a83629 a83630 a83631 a83632 a83633 a83634 a83635 a83636 a83637 a83638 a83639 a83640 a83641 a83642 a83643 a83644 a83645 a83646 a83647 a83648 a83649 a83650 a83651 a83652 a83653 a83654 a83655 a83656 a83657 a83658 a83659 a83660 a83661 a83662 a83663 a83664 a83665 a83666 a83667 a83668 a83669 a83670 a83671 a83672 a83673 a83674 a83675 a83676 a83677 a83678 a83679 a83680 a83681 a83682 a83683 a83684 a83685 a83686 a83687 a83688 a83689 a83690 a83691 a83692 a83693 a83694 a83695 a83696 a83697 a83698 a83699 a83700 a83701 a83702 a83703 a83704 a83705 a83706 a83707 a83708 a83709 a83710 a83711 a83712 a83713 a83714 a83715 a83716 a83717 a83718 a83719 a83720 a83721 a83722 a83723 a83724 a83725 a83726 a83727 a83728 a83729 a83730 a83731 a83732 a83733 a83734 a83735 a83736 a83737 a83738 a83739 a83740 a83741 a83742 a83743 a83744 a83745 a83746 a83747 a83748 a83749 a83750 a83751 a83752 a83753 a83754 a83755 a83756 a83757 a83758 a83759 a83760 a83761 a83762 a83763 a83764 a83765 a83766 a83767 a83768 a83769 a83770 a83771 a83772 a83773 a83774 a83775 a83776 a83777 a83778 a83779 a83780 a83781 a83782 a83783 a83784 a83785 a83786 a83787 a83788 a83789 a83790 a83791 a83792 a83793 a83794 a83795 a83796 a83797 a83798 a83799 a83800 a83801 a83802 a83803 a83804 a83805 a83806 a83807 a83808 a83809 a83810 a83811 a83812 a83813 a83814 a83815 a83816 a83817 a83818 a83819 a83820 a83821 a83822 a83823 a83824 a83825 a83826 a83827 a83828 a83829 a83830 a83831 a83832 a83833 a83834 a83835 a83836 a83837 a83838 a83839 a83840 a83841 a83842 a83843 a83844 a83845 a83846 a83847 a83848 a83849 a83850 a83851 a83852 a83853 a83854 a83855 a83856 a83857 a83858 a83859 a83860 a83861 a83862 a83863 a83864 a83865 a83866 a83867 a83868 a83869 a83870 a83871 a83872 a83873 a83874 a83875 a83876 a83877 a83878 a83879 a83880 a83881 a83882 a83883 a83884 a83885 a83886 a83887 a83888 a83889 a83890 a83891 a83892 a83893 a83894 a83895 a83896 a83897 a83898 a83899 a83900 a83901 a83902 a83903 a83904 a83905 a83906 a83907 a83908 a83909 a83910 a83911 a83912 a83913 a83914 a83915 a83916 a83917 a83918 a83919 a83920 a83921 a83922 a83923 a83924 a83925 a83926 a83927 a83928 a83929 a83930 a83931 a83932 a83933 a83934 a83935 a83936 a83937 a83938 a83939 a83940 a83941 a83942 a83943 a83944 a83945 a83946 a83947 a83948 a83949 a83950 a83951 a83952 a83953 a83954 a83955 a83956 a83957 a83958 a83959 a83960 a83961 a83962 a83963 a83964 a83965 a83966 a83967 a83968 a83969 a83970 a83971 a83972 a83973 a83974 a83975 a83976 a83977 a83978 a83979 a83980 a83981 a83982 a83983 a83984 a83985 a83986 a83987 a83988 a83989 a83990 a83991 a83992 a83993 a83994 a83995 a83996 a83997 a83998 a83999 a84000 a84001 a84002 a84003 a84004 a84005 a84006 a84007 a84008 a84009 a84010 a84011 a84012 a84013 a84014 a84015 a84016 a84017 a84018 a84019 a84020 a84021 a84022 a84023 a84024 a84025 a84026 a84027 a84028 a84029 a84030 a84031 a84032 a84033 a84034 a84035 a84036 a84037 a84038 a84039 a84040 a84041 a84042 a84043 a84044 a84045 a84046 a84047 a84048 a84049 a84050 a84051 a84052 a84053 a84054 a84055 a84056 a84057 a84058 a84059 a84060 a84061 a84062 a84063 a84064 a84065 a84066 a84067 a84068 a84069 a84070 a84071 a84072 a84073 a84074 a84075 a84076 a84077 a84078 a84079 a84080 a84081 a84082 a84083 a84084 a84085 a84086 a84087 a84088 a84089 a84090 a84091 a84092 a84093 a84094 a84095 a84096 a84097 a84098 a84099 a84100 a84101 a84102 a84103 a84104 a84105 a84106 a84107 a84108 a84109 a84110 a84111 a84112 a84113 a84114 a84115 a84116 a84117 a84118 a84119 a84120 a84121 a84122 a84123 a84124 a84125 a84126 a84127 a84128 a84129 a84130 a84131 a84132 a84133 a84134 a84135 a84136 a84137 a84138 a84139 a84140 a84141 a84142 a84143 a84144 a84145 a84146 a84147 a84148 a84149 a84150 a84151 a84152 a84153 a84154 a84155 a84156 a84157 a84158 a84159 a84160 a84161 a84162 a84163 a84164 a84165 a84166 a84167 a84168 a84169 a84170 a84171 a84172 a84173 a84174 a84175 a84176 a84177 a84178 a84179 a84180 a84181 a84182 a84183 a84184 a84185 a84186 a84187 a84188 a84189 a84190 a84191 a84192 a84193 a84194 a84195 a84196 a84197 a84198 a84199 a84200 a84201 a84202 a84203 a84204 a84205 a84206 a84207 a84208 a84209 a84210 a84211 a84212 a84213 a84214 a84215 a84216 a84217 a84218 a84219 a84220 a84221 a84222 a84223 a84224 a84225 a84226 a84227 a84228 a84229 a84230 a84231 a84232 a84233 a84234 a84235 a84236 a84237 a84238 a84239 a84240 a84241 a84242 a84243 a84244 a84245 a84246 a84247 a84248 a84249 a84250 a84251 a84252 a84253 a84254 a84255 a84256 a84257 a84258 a84259 a84260 a84261 a84262 a84263 a84264 a84265 a84266 a84267 a84268 a84269 a84270 a84271 a84272 a84273 a84274 a84275 a84276 a84277 a84278 a84279 a84280 a84281 a84282 a84283 a84284 a84285 a84286 a84287 a84288 a84289 a84290 a84291 a84292 a84293 a84294 a84295 a84296 a84297 a84298 a84299 a84300 a84301 a84302 a84303 a84304 a84305 a84306 a84307 a84308 a84309 a84310 a84311 a84312 a84313 a84314 a84315 a84316 a84317 a84318 a84319 a84320 a84321 a84322 a84323 a84324 a84325 a84326 a84327 a84328 a84329 a84330 a84331 a84332 a84333 a84334 a84335 a84336 a84337 a84338 a84339 a84340 a84341 a84342 a84343 a84344 a84345 a84346 a84347 a84348 a84349 a84350 a84351 a84352 a84353 a84354 a84355 a84356 a84357 a84358 a84359 a84360 a84361 a84362 a84363 a84364 a84365 a84366 a84367 a84368 a84369 a84370 a84371 a84372 a84373 a84374 a84375 a84376 a84377 a84378 a84379 a84380 a84381 a84382 a84383 a84384 a84385 a84386 a84387 a84388 a84389 a84390 a84391 a84392 a84393 a84394 a84395 a84396 a84397 a84398 a84399 a84400 a84401 a84402 a84403 a84404 a84405 a84406 a84407 a84408 a84409 a84410 a84411 a84412 a84413 a84414 a84415 a84416 a84417 a84418 a84419 a84420 a84421 a84422 a84423 a84424 a84425 a84426 a84427 a84428 a84429 a84430 a84431 a84432 a84433 a84434 a84435 a84436 a84437 a84438 a84439 a84440 a84441 a84442 a84443 a84444 a84445 a84446 a84447 a84448 a84449 a84450 a84451 a84452 a84453 a84454 a84455 a84456 a84457 a84458 a84459 a84460 a84461 a84462 a84463 a84464 a84465 a84466 a84467 a84468 a84469 a84470 a84471 a84472 a84473 a84474 a84475 a84476 a84477 a84478 a84479 a84480 a84481 a84482 a84483 a84484 a84485 a84486 a84487 a84488 a84489 a84490 a84491 a84492 a84493 a84494 a84495 a84496 a84497 a84498 a84499 a84500 a84501 a84502 a84503 a84504 a84505 a84506 a84507 a84508 a84509 a84510 a84511 a84512 a84513 a84514 a84515 a84516 a84517 a84518 a84519 a84520 a84521 a84522 a84523 a84524 a84525 a84526 a84527 a84528 a84529 a84530 a84531 a84532 a84533 a84534 a84535 a84536 a84537 a84538 a84539 a84540 a84541 a84542 a84543 a84544 a84545 a84546 a84547 a84548 a84549 a84550 a84551 a84552 a84553 a84554 a84555 a84556 a84557 a84558 a84559 a84560 a84561 a84562 a84563 a84564 a84565 a84566 a84567 a84568 a84569 a84570 a84571 a84572 a84573 a84574 a84575 a84576 a84577 a84578 a84579 a84580 a84581 a84582 a84583 a84584 a84585 a84586 a84587 a84588 a84589 a84590 a84591 a84592 a84593 a84594 a84595 a84596 a84597 a84598 a84599 a84600 a84601 a84602 a84603 a84604 a84605 a84606 a84607 a84608 a84609 a84610 a84611 a84612 a84613 a84614 a84615 a84616 a84617 a84618 a84619 a84620 a84621 a84622 a84623 a84624 a84625 a84626 a84627 a84628 a84629 a84630 a84631 a84632 a84633 a84634 a84635 a84636 a84637 a84638 a84639 a84640 a84641 a84642 a84643 a84644 a84645 a84646 a84647 a84648 a84649 a84650 a84651 a84652 a84653 a84654 a84655 a84656 a84657 a84658 a84659 a84660 a84661 a84662 a84663 a84664 a84665 a84666 a84667 a84668 a84669 a84670 a84671 a84672 a84673 a84674 a84675 a84676 a84677 a84678 a84679 a84680 a84681 a84682 a84683 a84684 a84685 a84686 a84687 a84688 a84689 a84690 a84691 a84692 a84693 a84694 a84695 a84696 a84697 a84698 a84699 a84700 a84701 a84702 a84703 a84704 a84705 a84706 a84707 a84708 a84709 a84710 a84711 a84712 a84713 a84714 a84715 a84716 a84717 a84718 a84719 a84720 a84721 a84722 a84723 a84724 a84725 a84726 a84727 a84728 a84729 a84730 a84731 a84732 a84733 a84734 a84735 a84736 a84737 a84738 a84739 a84740 a84741 a84742 a84743 a84744 a84745 a84746 a84747 a84748 a84749 a84750 a84751 a84752 a84753 a84754 a84755 a84756 a84757 a84758 a84759 a84760 a84761 a84762 a84763 a84764 a84765 a84766 a84767 a84768 a84769 a84770 a84771 a84772 a84773 a84774 a84775 a84776 a84777 a84778 a84779 a84780 a84781 a84782 a84783 a84784 a84785 a84786 a84787 a84788 a84789 a84790 a84791 a84792 a84793 a84794 a84795 a84796 a84797 a84798 a84799 a84800 a84801 a84802 a84803 a84804 a84805 a84806 a84807 a84808 a84809 a84810 a84811 a84812 a84813 a84814 a84815 a84816 a84817 a84818 a84819 a84820 a84821 a84822 a84823 a84824 a84825 a84826 a84827 a84828 a84829 a84830 a84831 a84832 a84833 a84834 a84835 a84836 a84837 a84838 a84839 a84840 a84841 a84842 a84843 a84844 a84845 a84846 a84847 a84848 a84849 a84850 a84851 a84852 a84853 a84854 a84855 a84856 a84857 a84858 a84859 a84860 a84861 a84862 a84863 a84864 a84865 a84866 a84867 a84868 a84869 a84870 a84871 a84872 a84873 a84874 a84875 a84876 a84877 a84878 a84879 a84880 a84881 a84882 a84883 a84884 a84885 a84886 a84887 a84888 a84889 a84890 a84891 a84892 a84893 a84894 a84895 a84896 a84897 a84898 a84899 a84900 a84901 a84902 a84903 a84904 a84905 a84906 a84907 a84908 a84909 a84910 a84911 a84912 a84913 a84914 a84915 a84916 a84917 a84918 a84919 a84920 a84921 a84922 a84923 a84924 a84925 a84926 a84927 a84928 a84929 a84930 a84931 a84932 a84933 a84934 a84935 a84936 a84937 a84938 a84939 a84940 a84941 a84942 a84943 a84944 a84945 a84946 a84947 a84948 a84949 a84950 a84951 a84952 a84953 a84954 a84955 a84956 a84957 a84958 a84959 a84960 a84961 a84962 a84963 a84964 a84965 a84966 a84967 a84968 a84969 a84970 a84971 a84972 a84973 a84974 a84975 a84976 a84977 a84978 a84979 a84980 a84981 a84982 a84983 a84984 a84985 a84986 a84987 a84988 a84989 a84990 a84991 a84992 a84993 a84994 a84995 a84996 a84997 a84998 a84999 a85000 a85001 a85002 a85003 a85004 a85005 a85006 a85007 a85008 a85009 a85010 a85011 a85012 a85013 a85014 a85015 a85016 a85017 a85018 a85019 a85020 a85021 a85022 a85023 a85024 a85025 a85026 a85027 a85028 a85029 a85030 a85031 a85032 a85033 a85034 a85035 a85036 a85037 a85038 a85039 a85040 a85041 a85042 a85043 a85044 a85045 a85046 a85047 a85048 a85049 a85050 a85051 a85052 a85053 a85054 a85055 a85056 a85057 a85058 a85059 a85060 a85061 a85062 a85063 a85064 a85065 a85066 a85067 a85068 a85069 a85070 a85071 a85072 a85073 a85074 a85075 a85076 a85077 a85078 a85079 a85080 a85081 a85082 a85083 a85084 a85085 a85086 a85087 a85088 a85089 a85090 a85091 a85092 a85093 a85094 a85095 a85096 a85097 a85098 a85099 a85100 a85101 a85102 a85103 a85104 a85105 a85106 a85107 a85108 a85109 a85110 a85111 a85112 a85113 a85114 a85115 a85116 a85117 a85118 a85119 a85120 a85121 a85122 a85123 a85124 a85125 a85126 a85127 a85128 a85129 a85130 a85131 a85132 a85133 a85134 a85135 a85136 a85137 a85138 a85139 a85140 a85141 a85142 a85143 a85144 a85145 a85146 a85147 a85148 a85149 a85150 a85151 a85152 a85153 a85154 a85155 a85156 a85157 a85158 a85159 a85160 a85161 a85162 a85163 a85164 a85165 a85166 a85167 a85168 a85169 a85170 a85171 a85172 a85173 a85174 a85175 a85176 a85177 a85178 a85179 a85180 a85181 a85182 a85183 a85184 a85185 a85186 a85187 a85188 a85189 a85190 a85191 a85192 a85193 a85194 a85195 a85196 a85197 a85198 a85199 a85200 a85201 a85202 a85203 a85204 a85205 a85206 a85207 a85208 a85209 a85210 a85211 a85212 a85213 a85214 a85215 a85216 a85217 a85218 a85219 a85220 a85221 a85222 a85223 a85224 a85225 a85226 a85227 a85228 a85229 a85230 a85231 a85232 a85233 a85234 a85235 a85236 a85237 a85238 a85239 a85240 a85241 a85242 a85243 a85244 a85245 a85246 a85247 a85248 a85249 a85250 a85251 a85252 a85253 a85254 a85255 a85256 a85257 a85258 a85259 a85260 a85261 a85262 a85263 a85264 a85265 a85266 a85267 a85268 a85269 a85270 a85271 a85272 a85273 a85274 a85275 a85276 a85277 a85278 a85279 a85280 a85281 a85282 a85283 a85284 a85285 a85286 a85287 a85288 a85289 a85290 a85291 a85292 a85293 a85294 a85295 a85296 a85297 a85298 a85299 a85300 a85301 a85302 a85303 a85304 a85305 a85306 a85307 a85308 a85309 a85310 a85311 a85312 a85313 a85314 a85315 a85316 a85317 a85318 a85319 a85320 a85321 a85322 a85323 a85324 a85325 a85326 a85327 a85328 a85329 a85330 a85331 a85332 a85333 a85334 a85335 a85336 a85337 a85338 a85339 a85340 a85341 a85342 a85343 a85344 a85345 a85346 a85347 a85348 a85349 a85350 a85351 a85352 a85353 a85354 a85355 a85356 a85357 a85358 a85359 a85360 a85361 a85362 a85363 a85364 a85365 a85366 a85367 a85368 a85369 a85370 a85371 a85372 a85373 a85374 a85375 a85376 a85377 a85378 a85379 a85380 a85381 a85382 a85383 a85384 a85385 a85386 a85387 a85388 a85389 a85390 a85391 a85392 a85393 a85394 a85395 a85396 a85397 a85398 a85399 a85400 a85401 a85402 a85403 a85404 a85405 a85406 a85407 a85408 a85409 a85410 a85411 a85412 a85413 a85414 a85415 a85416 a85417 a85418 a85419 a85420 a85421 a85422 a85423 a85424 a85425 a85426 a85427 a85428 a85429 a85430 a85431 a85432 a85433 a85434 a85435 a85436 a85437 a85438 a85439 a85440 a85441 a85442 a85443 a85444 a85445 a85446 a85447 a85448 a85449 a85450 a85451 a85452 a85453 a85454 a85455 a85456 a85457 a85458 a85459 a85460 a85461 a85462 a85463 a85464 a85465 a85466 a85467 a85468 a85469 a85470 a85471 a85472 a85473 a85474 a85475 a85476 a85477 a85478 a85479 a85480 a85481 a85482 a85483 a85484 a85485 a85486 a85487 a85488 a85489 a85490 a85491 a85492 a85493 a85494 a85495 a85496 a85497 a85498 a85499 a85500 a85501 a85502 a85503 a85504 a85505 a85506 a85507 a85508 a85509 a85510 a85511 a85512 a85513 a85514 a85515 a85516 a85517 a85518 a85519 a85520 a85521 a85522 a85523 a85524 a85525 a85526 a85527 a85528 a85529 a85530 a85531 a85532 a85533 a85534 a85535 a85536 a85537 a85538 a85539 a85540 a85541 a85542 a85543 a85544 a85545 a85546 a85547 a85548 a85549 a85550 a85551 a85552 a85553 a85554 a85555 a85556 a85557 a85558 a85559 a85560 a85561 a85562 a85563 a85564 a85565 a85566 a85567 a85568 a85569 a85570 a85571 a85572 a85573 a85574 a85575 a85576 a85577 a85578 a85579 a85580 a85581 a85582 a85583 a85584 a85585 a85586 a85587 a85588 a85589 a85590 a85591 a85592 a85593 a85594 a85595 a85596 a85597 a85598 a85599 a85600 a85601 a85602 a85603 a85604 a85605 a85606 a85607 a85608 a85609 a85610 a85611 a85612 a85613 a85614 a85615 a85616 a85617 a85618 a85619 a85620 a85621 a85622 a85623 a85624 a85625 a85626 a85627 a85628 a85629 a85630 a85631 a85632 a85633 a85634 a85635 a85636 a85637 a85638 a85639 a85640 a85641 a85642 a85643 a85644 a85645 a85646 a85647 a85648 a85649 a85650 a85651 a85652 a85653 a85654 a85655 a85656 a85657 a85658 a85659 a85660 a85661 a85662 a85663 a85664 a85665 a85666 a85667 a85668 a85669 a85670 a85671 a85672 a85673 a85674 a85675 a85676 a85677 a85678 a85679 a85680 a85681 a85682 a85683 a85684 a85685 a85686 a85687 a85688 a85689 a85690 a85691 a85692 a85693 a85694 a85695 a85696 a85697 a85698 a85699 a85700 a85701 a85702 a85703 a85704 a85705 a85706 a85707 a85708 a85709 a85710 a85711 a85712 a85713 a85714 a85715 a85716 a85717 a85718 a85719 a85720 a85721 a85722 a85723 a85724 a85725 a85726 a85727 a85728 a85729 a85730 a85731 a85732 a85733 a85734 a85735 a85736 a85737 a85738 a85739 a85740 a85741 a85742 a85743 a85744 a85745 a85746 a85747 a85748 a85749 a85750 a85751 a85752 a85753 a85754 a85755 a85756 a85757 a85758 a85759 a85760 a85761 a85762 a85763 a85764 a85765 a85766 a85767 a85768 a85769 a85770 a85771 a85772 a85773 a85774 a85775 a85776 a85777 a85778 a85779 a85780 a85781 a85782 a85783 a85784 a85785 a85786 a85787 a85788 a85789 a85790 a85791 a85792 a85793 a85794 a85795 a85796 a85797 a85798 a85799 a85800 a85801 a85802 a85803 a85804 a85805 a85806 a85807 a85808 a85809 a85810 a85811 a85812 a85813 a85814 a85815 a85816 a85817 a85818 a85819 a85820 a85821 a85822 a85823 a85824 a85825 a85826 a85827 a85828 a85829 a85830 a85831 a85832 a85833 a85834 a85835 a85836 a85837 a85838 a85839 a85840 a85841 a85842 a85843 a85844 a85845 a85846 a85847 a85848 a85849 a85850 a85851 a85852 a85853 a85854 a85855 a85856 a85857 a85858 a85859 a85860 a85861 a85862 a85863 a85864 a85865 a85866 a85867 a85868 a85869 a85870 a85871 a85872 a85873 a85874 a85875 a85876 a85877 a85878 a85879 a85880 a85881 a85882 a85883 a85884 a85885 a85886 a85887 a85888 a85889 a85890 a85891 a85892 a85893 a85894 a85895 a85896 a85897 a85898 a85899 a85900 a85901 a85902 a85903 a85904 a85905 a85906 a85907 a85908 a85909 a85910 a85911 a85912 a85913 a85914 a85915 a85916 a85917 a85918 a85919 a85920 a85921 a85922 a85923 a85924 a85925 a85926 a85927 a85928 a85929 a85930 a85931 a85932 a85933 a85934 a85935 a85936 a85937 a85938 a85939 a85940 a85941 a85942 a85943 a85944 a85945 a85946 a85947 a85948 a85949 a85950 a85951 a85952 a85953 a85954 a85955 a85956 a85957 a85958 a85959 a85960 a85961 a85962 a85963 a85964 a85965 a85966 a85967 a85968 a85969 a85970 a85971 a85972 a85973 a85974 a85975 a85976 a85977 a85978 a85979 a85980 a85981 a85982 a85983 a85984 a85985 a85986 a85987 a85988 a85989 a85990 a85991 a85992 a85993 a85994 a85995 a85996 a85997 a85998 a85999 a86000 a86001 a86002 a86003 a86004 a86005 a86006 a86007 a86008 a86009 a86010 a86011 a86012 a86013 a86014 a86015 a86016 a86017 a86018 a86019 a86020 a86021 a86022 a86023 a86024 a86025 a86026 a86027 a86028 a86029 a86030 a86031 a86032 a86033 a86034 a86035 a86036 a86037 a86038 a86039 a86040 a86041 a86042 a86043 a86044 a86045 a86046 a86047 a86048 a86049 a86050 a86051 a86052 a86053 a86054 a86055 a86056 a86057 a86058 a86059 a86060 a86061 a86062 a86063 a86064 a86065 a86066 a86067 a86068 a86069 a86070 a86071 a86072 a86073 a86074 a86075 a86076 a86077 a86078 a86079 a86080 a86081 a86082 a86083 a86084 a86085 a86086 a86087 a86088 a86089 a86090 a86091 a86092 a86093 a86094 a86095 a86096 a86097 a86098 a86099 a86100 a86101 a86102 a86103 a86104 a86105 a86106 a86107 a86108 a86109 a86110 a86111 a86112 a86113 a86114 a86115 a86116 a86117 a86118 a86119 a86120 a86121 a86122 a86123 a86124 a86125 a86126 a86127 a86128 a86129 a86130 a86131 a86132 a86133 a86134 a86135 a86136 a86137 a86138 a86139 a86140 a86141 a86142 a86143 a86144 a86145 a86146 a86147 a86148 a86149 a86150 a86151 a86152 a86153 a86154 a86155 a86156 a86157 a86158 a86159 a86160 a86161 a86162 a86163 a86164 a86165 a86166 a86167 a86168 a86169 a86170 a86171 a86172 a86173 a86174 a86175 a86176 a86177 a86178 a86179 a86180 a86181 a86182 a86183 a86184 a86185 a86186 a86187 a86188 a86189 a86190 a86191 a86192 a86193 a86194 a86195 a86196 a86197 a86198 a86199 a86200 a86201 a86202 a86203 a86204 a86205 a86206 a86207 a86208 a86209 a86210 a86211 a86212 a86213 a86214 a86215 a86216 a86217 a86218 a86219 a86220 a86221 a86222 a86223 a86224 a86225 a86226 a86227 a86228 a86229 a86230 a86231 a86232 a86233 a86234 a86235 a86236 a86237 a86238 a86239 a86240 a86241 a86242 a86243 a86244 a86245 a86246 a86247 a86248 a86249 a86250 a86251 a86252 a86253 a86254 a86255 a86256 a86257 a86258 a86259 a86260 a86261 a86262 a86263 a86264 a86265 a86266 a86267 a86268 a86269 a86270 a86271 a86272 a86273 a86274 a86275 a86276 a86277 a86278 a86279 a86280 a86281 a86282 a86283 a86284 a86285 a86286 a86287 a86288 a86289 a86290 a86291 a86292 a86293 a86294 a86295 a86296 a86297 a86298 a86299 a86300 a86301 a86302 a86303 a86304 a86305 a86306 a86307 a86308 a86309 a86310 a86311 a86312 a86313 a86314 a86315 a86316 a86317 a86318 a86319 a86320 a86321 a86322 a86323 a86324 a86325 a86326 a86327 a86328 a86329 a86330 a86331 a86332 a86333 a86334 a86335 a86336 a86337 a86338 a86339 a86340 a86341 a86342 a86343 a86344 a86345 a86346 a86347 a86348 a86349 a86350 a86351 a86352 a86353 a86354 a86355 a86356 a86357 a86358 a86359 a86360 a86361 a86362 a86363 a86364 a86365 a86366 a86367 a86368 a86369 a86370 a86371 a86372 a86373 a86374 a86375 a86376 a86377 a86378 a86379 a86380 a86381 a86382 a86383 a86384 a86385 a86386 a86387 a86388 a86389 a86390 a86391 a86392 a86393 a86394 a86395 a86396 a86397 a86398 a86399 a86400 a86401 a86402 a86403 a86404 a86405 a86406 a86407 a86408 a86409 a86410 a86411 a86412 a86413 a86414 a86415 a86416 a86417 a86418 a86419 a86420 a86421 a86422 a86423 a86424 a86425 a86426 a86427 a86428 a86429 a86430 a86431 a86432 a86433 a86434 a86435 a86436 a86437 a86438 a86439 a86440 a86441 a86442 a86443 a86444 a86445 a86446 a86447 a86448 a86449 a86450 a86451 a86452 a86453 a86454 a86455 a86456 a86457 a86458 a86459 a86460 a86461 a86462 a86463 a86464 a86465 a86466 a86467 a86468 a86469 a86470 a86471 a86472 a86473 a86474 a86475 a86476 a86477 a86478 a86479 a86480 a86481 a86482 a86483 a86484 a86485 a86486 a86487 a86488 a86489 a86490 a86491 a86492 a86493 a86494 a86495 a86496 a86497 a86498 a86499 a86500 a86501 a86502 a86503 a86504 a86505 a86506 a86507 a86508 a86509 a86510 a86511 a86512 a86513 a86514 a86515 a86516 a86517 a86518 a86519 a86520 a86521 a86522 a86523 a86524 a86525 a86526 a86527 a86528 a86529 a86530 a86531 a86532 a86533 a86534 a86535 a86536 a86537 a86538 a86539 a86540 a86541 a86542 a86543 a86544 a86545 a86546 a86547 a86548 a86549 a86550 a86551 a86552 a86553 a86554 a86555 a86556 a86557 a86558 a86559 a86560 a86561 a86562 a86563 a86564 a86565 a86566 a86567 a86568 a86569 a86570 a86571 a86572 a86573 a86574 a86575 a86576 a86577 a86578 a86579 a86580 a86581 a86582 a86583 a86584 a86585 a86586 a86587 a86588 a86589 a86590 a86591 a86592 a86593 a86594 a86595 a86596 a86597 a86598 a86599 a86600 a86601 a86602 a86603 a86604 a86605 a86606 a86607 a86608 a86609 a86610 a86611 a86612 a86613 a86614 a86615 a86616 a86617 a86618 a86619 a86620 a86621 a86622 a86623 a86624 a86625 a86626 a86627 a86628 a86629 a86630 a86631 a86632 a86633 a86634 a86635 a86636 a86637 a86638 a86639 a86640 a86641 a86642 a86643 a86644 a86645 a86646 a86647 a86648 a86649 a86650 a86651 a86652 a86653 a86654 a86655 a86656 a86657 a86658 a86659 a86660 a86661 a86662 a86663 a86664 a86665 a86666 a86667 a86668 a86669 a86670 a86671 a86672 a86673 a86674 a86675 a86676 a86677 a86678 a86679 a86680 a86681 a86682 a86683 a86684 a86685 a86686 a86687 a86688 a86689 a86690 a86691 a86692 a86693 a86694 a86695 a86696 a86697 a86698 a86699 a86700 a86701 a86702 a86703 a86704 a86705 a86706 a86707 a86708 a86709 a86710 a86711 a86712 a86713 a86714 a86715 a86716 a86717 a86718 a86719 a86720 a86721 a86722 a86723 a86724 a86725 a86726 a86727 a86728 a86729 a86730 a86731 a86732 a86733 a86734 a86735 a86736 a86737 a86738 a86739 a86740 a86741 a86742 a86743 a86744 a86745 a86746 a86747 a86748 a86749 a86750 a86751 a86752 a86753 a86754 a86755 a86756 a86757 a86758 a86759 a86760 a86761 a86762 a86763 a86764 a86765 a86766 a86767 a86768 a86769 a86770 a86771 a86772 a86773 a86774 a86775 a86776 a86777 a86778 a86779 a86780 a86781 a86782 a86783 a86784 a86785 a86786 a86787 a86788 a86789 a86790 a86791 a86792 a86793 a86794 a86795 a86796 a86797 a86798 a86799 a86800 a86801 a86802 a86803 a86804 a86805 a86806 a86807 a86808 a86809 a86810 a86811 a86812 a86813 a86814 a86815 a86816 a86817 a86818 a86819 a86820 a86821 a86822 a86823 a86824 a86825 a86826 a86827 a86828 a86829 a86830 a86831 a86832 a86833 a86834 a86835 a86836 a86837 a86838 a86839 a86840 a86841 a86842 a86843 a86844 a86845 a86846 a86847 a86848 a86849 a86850 a86851 a86852 a86853 a86854 a86855 a86856 a86857 a86858 a86859 a86860 a86861 a86862 a86863 a86864 a86865 a86866 a86867 a86868 a86869 a86870 a86871 a86872 a86873 a86874 a86875 a86876 a86877 a86878 a86879 a86880 a86881 a86882 a86883 a86884 a86885 a86886 a86887 a86888 a86889 a86890 a86891 a86892 a86893 a86894 a86895 a86896 a86897 a86898 a86899 a86900 a86901 a86902 a86903 a86904 a86905 a86906 a86907 a86908 a86909 a86910 a86911 a86912 a86913 a86914 a86915 a86916 a86917 a86918 a86919 a86920 a86921 a86922 a86923 a86924 a86925 a86926 a86927 a86928 a86929 a86930 a86931 a86932 a86933 a86934 a86935 a86936 a86937 a86938 a86939 a86940 a86941 a86942 a86943 a86944 a86945 a86946 a86947 a86948 a86949 a86950 a86951 a86952 a86953 a86954 a86955 a86956 a86957 a86958 a86959 a86960 a86961 a86962 a86963 a86964 a86965 a86966 a86967 a86968 a86969 a86970 a86971 a86972 a86973 a86974 a86975 a86976 a86977 a86978 a86979 a86980 a86981 a86982 a86983 a86984 a86985 a86986 a86987 a86988 a86989 a86990 a86991 a86992 a86993 a86994 a86995 a86996 a86997 a86998 a86999 a87000 a87001 a87002 a87003 a87004 a87005 a87006 a87007 a87008 a87009 a87010 a87011 a87012 a87013 a87014 a87015 a87016 a87017 a87018 a87019 a87020 a87021 a87022 a87023 a87024 a87025 a87026 a87027 a87028 a87029 a87030 a87031 a87032 a87033 a87034 a87035 a87036 a87037 a87038 a87039 a87040 a87041 a87042 a87043 a87044 a87045 a87046 a87047 a87048 a87049 a87050 a87051 a87052 a87053 a87054 a87055 a87056 a87057 a87058 a87059 a87060 a87061 a87062 a87063 a87064 a87065 a87066 a87067 a87068 a87069 a87070 a87071 a87072 a87073 a87074 a87075 a87076 a87077 a87078 a87079 a87080 a87081 a87082 a87083 a87084 a87085 a87086 a87087 a87088 a87089 a87090 a87091 a87092 a87093 a87094 a87095 a87096 a87097 a87098 a87099 a87100 a87101 a87102 a87103 a87104 a87105 a87106 a87107 a87108 a87109 a87110 a87111 a87112 a87113 a87114 a87115 a87116 a87117 a87118 a87119 a87120 a87121 a87122 a87123 a87124 a87125 a87126 a87127 a87128 a87129 a87130 a87131 a87132 a87133 a87134 a87135 a87136 a87137 a87138 a87139 a87140 a87141 a87142 a87143 a87144 a87145 a87146 a87147 a87148 a87149 a87150 a87151 a87152 a87153 a87154 a87155 a87156 a87157 a87158 a87159 a87160 a87161 a87162 a87163 a87164 a87165 a87166 a87167 a87168 a87169 a87170 a87171 a87172 a87173 a87174 a87175 a87176 a87177 a87178 a87179 a87180 a87181 a87182 a87183 a87184 a87185 a87186 a87187 a87188 a87189 a87190 a87191 a87192 a87193 a87194 a87195 a87196 a87197 a87198 a87199 a87200 a87201 a87202 a87203 a87204 a87205 a87206 a87207 a87208 a87209 a87210 a87211 a87212 a87213 a87214 a87215 a87216 a87217 a87218 a87219 a87220 a87221 a87222 a87223 a87224 a87225 a87226 a87227 a87228 a87229 a87230 a87231 a87232 a87233 a87234 a87235 a87236 a87237 a87238 a87239 a87240 a87241 a87242 a87243 a87244 a87245 a87246 a87247 a87248 a87249 a87250 a87251 a87252 a87253 a87254 a87255 a87256 a87257 a87258 a87259 a87260 a87261 a87262 a87263 a87264 a87265 a87266 a87267 a87268 a87269 a87270 a87271 a87272 a87273 a87274 a87275 a87276 a87277 a87278 a87279 a87280 a87281 a87282 a87283 a87284 a87285 a87286 a87287 a87288 a87289 a87290 a87291 a87292 a87293 a87294 a87295 a87296 a87297 a87298 a87299 a87300 a87301 a87302 a87303 a87304 a87305 a87306 a87307 a87308 a87309 a87310 a87311 a87312 a87313 a87314 a87315 a87316 a87317 a87318 a87319 a87320 a87321 a87322 a87323 a87324 a87325 a87326 a87327 a87328 a87329 a87330 a87331 a87332 a87333 a87334 a87335 a87336 a87337 a87338 a87339 a87340 a87341 a87342 a87343 a87344 a87345 a87346 a87347 a87348 a87349 a87350 a87351 a87352 a87353 a87354 a87355 a87356 a87357 a87358 a87359 a87360 a87361 a87362 a87363 a87364 a87365 a87366 a87367 a87368 a87369 a87370 a87371 a87372 a87373 a87374 a87375 a87376 a87377 a87378 a87379 a87380 a87381 a87382 a87383 a87384 a87385 a87386 a87387 a87388 a87389 a87390 a87391 a87392 a87393 a87394 a87395 a87396 a87397 a87398 a87399 a87400 a87401 a87402 a87403 a87404 a87405 a87406 a87407 a87408 a87409 a87410 a87411 a87412 a87413 a87414 a87415 a87416 a87417 a87418 a87419 a87420 a87421 a87422 a87423 a87424 a87425 a87426 a87427 a87428 a87429 a87430 a87431 a87432 a87433 a87434 a87435 a87436 a87437 a87438 a87439 a87440 a87441 a87442 a87443 a87444 a87445 a87446 a87447 a87448 a87449 a87450 a87451 a87452 a87453 a87454 a87455 a87456 a87457 a87458 a87459 a87460 a87461 a87462 a87463 a87464 a87465 a87466 a87467 a87468 a87469 a87470 a87471 a87472 a87473 a87474 a87475 a87476 a87477 a87478 a87479 a87480 a87481 a87482 a87483 a87484 a87485 a87486 a87487 a87488 a87489 a87490 a87491 a87492 a87493 a87494 a87495 a87496 a87497 a87498 a87499 a87500 a87501 a87502 a87503 a87504 a87505 a87506 a87507 a87508 a87509 a87510 a87511 a87512 a87513 a87514 a87515 a87516 a87517 a87518 a87519 a87520 a87521 a87522 a87523 a87524 a87525 a87526 a87527 a87528 a87529 a87530 a87531 a87532 a87533 a87534 a87535 a87536 a87537 a87538 a87539 a87540 a87541 a87542 a87543 a87544 a87545 a87546 a87547 a87548 a87549 a87550 a87551 a87552 a87553 a87554 a87555 a87556 a87557 a87558 a87559 a87560 a87561 a87562 a87563 a87564 a87565 a87566 a87567 a87568 a87569 a87570 a87571 a87572 a87573 a87574 a87575 a87576 a87577 a87578 a87579 a87580 a87581 a87582 a87583 a87584 a87585 a87586 a87587 a87588 a87589 a87590 a87591 a87592 a87593 a87594 a87595 a87596 a87597 a87598 a87599 a87600 a87601 a87602 a87603 a87604 a87605 a87606 a87607 a87608 a87609 a87610 a87611 a87612 a87613 a87614 a87615 a87616 a87617 a87618 a87619 a87620 a87621 a87622 a87623 a87624 a87625 a87626 a87627 a87628 a87629 a87630 a87631 a87632 a87633 a87634 a87635 a87636 a87637 a87638 a87639 a87640 a87641 a87642 a87643 a87644 a87645 a87646 a87647 a87648 a87649 a87650 a87651 a87652 a87653 a87654 a87655 a87656 a87657 a87658 a87659 a87660 a87661 a87662 a87663 a87664 a87665 a87666 a87667 a87668 a87669 a87670 a87671 a87672 a87673 a87674 a87675 a87676 a87677 a87678 a87679 a87680 a87681 a87682 a87683 a87684 a87685 a87686 a87687 a87688 a87689 a87690 a87691 a87692 a87693 a87694 a87695 a87696 a87697 a87698 a87699 a87700 a87701 a87702 a87703 a87704 a87705 a87706 a87707 a87708 a87709 a87710 a87711 a87712 a87713 a87714 a87715 a87716 a87717 a87718 a87719 a87720 a87721 a87722 a87723 a87724 a87725 a87726 a87727 a87728 a87729 a87730 a87731 a87732 a87733 a87734 a87735 a87736 a87737 a87738 a87739 a87740 a87741 a87742 a87743 a87744 a87745 a87746 a87747 a87748 a87749 a87750 a87751 a87752 a87753 a87754 a87755 a87756 a87757 a87758 a87759 a87760 a87761 a87762 a87763 a87764 a87765 a87766 a87767 a87768 a87769 a87770 a87771 a87772 a87773 a87774 a87775 a87776 a87777 a87778 a87779 a87780 a87781 a87782 a87783 a87784 a87785 a87786 a87787 a87788 a87789 a87790 a87791 a87792 a87793 a87794 a87795 a87796 a87797 a87798 a87799 a87800 a87801 a87802 a87803 a87804 a87805 a87806 a87807 a87808 a87809 a87810 a87811 a87812 a87813 a87814 a87815 a87816 a87817 a87818 a87819 a87820 a87821 a87822 a87823 a87824 a87825 a87826 a87827 a87828 a87829 a87830 a87831 a87832 a87833 a87834 a87835 a87836 a87837 a87838 a87839 a87840 a87841 a87842 a87843 a87844 a87845 a87846 a87847 a87848 a87849 a87850 a87851 a87852 a87853 a87854 a87855 a87856 a87857 a87858 a87859 a87860 a87861 a87862 a87863 a87864 a87865 a87866 a87867 a87868 a87869 a87870 a87871 a87872 a87873 a87874 a87875 a87876 a87877 a87878 a87879 a87880 a87881 a87882 a87883 a87884 a87885 a87886 a87887 a87888 a87889 a87890 a87891 a87892 a87893 a87894 a87895 a87896 a87897 a87898 a87899 a87900 a87901 a87902 a87903 a87904 a87905 a87906 a87907 a87908 a87909 a87910 a87911 a87912 a87913 a87914 a87915 a87916 a87917 a87918 a87919 a87920 a87921 a87922 a87923 a87924 a87925 a87926 a87927 a87928 a87929 a87930 a87931 a87932 a87933 a87934 a87935 a87936 a87937 a87938 a87939 a87940 a87941 a87942 a87943 a87944 a87945 a87946 a87947 a87948 a87949 a87950 a87951 a87952 a87953 a87954 a87955 a87956 a87957 a87958 a87959 a87960 a87961 a87962 a87963 a87964 a87965 a87966 a87967 a87968 a87969 a87970 a87971 a87972 a87973 a87974 a87975 a87976 a87977 a87978 a87979 a87980 a87981 a87982 a87983 a87984 a87985 a87986 a87987 a87988 a87989 a87990 a87991 a87992 a87993 a87994 a87995 a87996 a87997 a87998 a87999 a88000 a88001 a88002 a88003 a88004 a88005 a88006 a88007 a88008 a88009 a88010 a88011 a88012 a88013 a88014 a88015 a88016 a88017 a88018 a88019 a88020 a88021 a88022 a88023 a88024 a88025 a88026 a88027 a88028 a88029 a88030 a88031 a88032 a88033 a88034 a88035 a88036 a88037 a88038 a88039 a88040 a88041 a88042 a88043 a88044 a88045 a88046 a88047 a88048 a88049 a88050 a88051 a88052 a88053 a88054 a88055 a88056 a88057 a88058 a88059 a88060 a88061 a88062 a88063 a88064 a88065 a88066 a88067 a88068 a88069 a88070 a88071 a88072 a88073 a88074 a88075 a88076 a88077 a88078 a88079 a88080 a88081 a88082 a88083 a88084 a88085 a88086 a88087 a88088 a88089 a88090 a88091 a88092 a88093 a88094 a88095 a88096 a88097 a88098 a88099 a88100 a88101 a88102 a88103 a88104 a88105 a88106 a88107 a88108 a88109 a88110 a88111 a88112 a88113 a88114 a88115 a88116 a88117 a88118 a88119 a88120 a88121 a88122 a88123 a88124 a88125 a88126 a88127 a88128 a88129 a88130 a88131 a88132 a88133 a88134 a88135 a88136 a88137 a88138 a88139 a88140 a88141 a88142 a88143 a88144 a88145 a88146 a88147 a88148 a88149 a88150 a88151 a88152 a88153 a88154 a88155 a88156 a88157 a88158 a88159 a88160 a88161 a88162 a88163 a88164 a88165 a88166 a88167 a88168 a88169 a88170 a88171 a88172 a88173 a88174 a88175 a88176 a88177 a88178 a88179 a88180 a88181 a88182 a88183 a88184 a88185 a88186 a88187 a88188 a88189 a88190 a88191 a88192 a88193 a88194 a88195 a88196 a88197 a88198 a88199 a88200 a88201 a88202 a88203 a88204 a88205 a88206 a88207 a88208 a88209 a88210 a88211 a88212 a88213 a88214 a88215 a88216 a88217 a88218 a88219 a88220 a88221 a88222 a88223 a88224 a88225 a88226 a88227 a88228 a88229 a88230 a88231 a88232 a88233 a88234 a88235 a88236 a88237 a88238 a88239 a88240 a88241 a88242 a88243 a88244 a88245 a88246 a88247 a88248 a88249 a88250 a88251 a88252 a88253 a88254 a88255 a88256 a88257 a88258 a88259 a88260 a88261 a88262 a88263 a88264 a88265 a88266 a88267 a88268 a88269 a88270 a88271 a88272 a88273 a88274 a88275 a88276 a88277 a88278 a88279 a88280 a88281 a88282 a88283 a88284 a88285 a88286 a88287 a88288 a88289 a88290 a88291 a88292 a88293 a88294 a88295 a88296 a88297 a88298 a88299 a88300 a88301 a88302 a88303 a88304 a88305 a88306 a88307 a88308 a88309 a88310 a88311 a88312 a88313 a88314 a88315 a88316 a88317 a88318 a88319 a88320 a88321 a88322 a88323 a88324 a88325 a88326 a88327 a88328 a88329 a88330 a88331 a88332 a88333 a88334 a88335 a88336 a88337 a88338 a88339 a88340 a88341 a88342 a88343 a88344 a88345 a88346 a88347 a88348 a88349 a88350 a88351 a88352 a88353 a88354 a88355 a88356 a88357 a88358 a88359 a88360 a88361 a88362 a88363 a88364 a88365 a88366 a88367 a88368 a88369 a88370 a88371 a88372 a88373 a88374 a88375 a88376 a88377 a88378 a88379 a88380 a88381 a88382 a88383 a88384 a88385 a88386 a88387 a88388 a88389 a88390 a88391 a88392 a88393 a88394 a88395 a88396 a88397 a88398 a88399 a88400 a88401 a88402 a88403 a88404 a88405 a88406 a88407 a88408 a88409 a88410 a88411 a88412 a88413 a88414 a88415 a88416 a88417 a88418 a88419 a88420 a88421 a88422 a88423 a88424 a88425 a88426 a88427 a88428 a88429 a88430 a88431 a88432 a88433 a88434 a88435 a88436 a88437 a88438 a88439 a88440 a88441 a88442 a88443 a88444 a88445 a88446 a88447 a88448 a88449 a88450 a88451 a88452 a88453 a88454 a88455 a88456 a88457 a88458 a88459 a88460 a88461 a88462 a88463 a88464 a88465 a88466 a88467 a88468 a88469 a88470 a88471 a88472 a88473 a88474 a88475 a88476 a88477 a88478 a88479 a88480 a88481 a88482 a88483 a88484 a88485 a88486 a88487 a88488 a88489 a88490 a88491 a88492 a88493 a88494 a88495 a88496 a88497 a88498 a88499 a88500 a88501 a88502 a88503 a88504 a88505 a88506 a88507 a88508 a88509 a88510 a88511 a88512 a88513 a88514 a88515 a88516 a88517 a88518 a88519 a88520 a88521 a88522 a88523 a88524 a88525 a88526 a88527 a88528 a88529 a88530 a88531 a88532 a88533 a88534 a88535 a88536 a88537 a88538 a88539 a88540 a88541 a88542 a88543 a88544 a88545 a88546 a88547 a88548 a88549 a88550 a88551 a88552 a88553 a88554 a88555 a88556 a88557 a88558 a88559 a88560 a88561 a88562 a88563 a88564 a88565 a88566 a88567 a88568 a88569 a88570 a88571 a88572 a88573 a88574 a88575 a88576 a88577 a88578 a88579 a88580 a88581 a88582 a88583 a88584 a88585 a88586 a88587 a88588 a88589 a88590 a88591 a88592 a88593 a88594 a88595 a88596 a88597 a88598 a88599 a88600 a88601 a88602 a88603 a88604 a88605 a88606 a88607 a88608 a88609 a88610 a88611 a88612 a88613 a88614 a88615 a88616 a88617 a88618 a88619 a88620 a88621 a88622 a88623 a88624 a88625 a88626 a88627 a88628 a88629 a88630 a88631 a88632 a88633 a88634 a88635 a88636 a88637 a88638 a88639 a88640 a88641 a88642 a88643 a88644 a88645 a88646 a88647 a88648 a88649 a88650 a88651 a88652 a88653 a88654 a88655 a88656 a88657 a88658 a88659 a88660 a88661 a88662 a88663 a88664 a88665 a88666 a88667 a88668 a88669 a88670 a88671 a88672 a88673 a88674 a88675 a88676 a88677 a88678 a88679 a88680 a88681 a88682 a88683 a88684 a88685 a88686 a88687 a88688 a88689 a88690 a88691 a88692 a88693 a88694 a88695 a88696 a88697 a88698 a88699 a88700 a88701 a88702 a88703 a88704 a88705 a88706 a88707 a88708 a88709 a88710 a88711 a88712 a88713 a88714 a88715 a88716 a88717 a88718 a88719 a88720 a88721 a88722 a88723 a88724 a88725 a88726 a88727 a88728 a88729 a88730 a88731 a88732 a88733 a88734 a88735 a88736 a88737 a88738 a88739 a88740 a88741 a88742 a88743 a88744 a88745 a88746 a88747 a88748 a88749 a88750 a88751 a88752 a88753 a88754 a88755 a88756 a88757 a88758 a88759 a88760 a88761 a88762 a88763 a88764 a88765 a88766 a88767 a88768 a88769 a88770 a88771 a88772 a88773 a88774 a88775 a88776 a88777 a88778 a88779 a88780 a88781 a88782 a88783 a88784 a88785 a88786 a88787 a88788 a88789 a88790 a88791 a88792 a88793 a88794 a88795 a88796 a88797 a88798 a88799 a88800 a88801 a88802 a88803 a88804 a88805 a88806 a88807 a88808 a88809 a88810 a88811 a88812 a88813 a88814 a88815 a88816 a88817 a88818 a88819 a88820 a88821 a88822 a88823 a88824 a88825 a88826 a88827 a88828 a88829 a88830 a88831 a88832 a88833 a88834 a88835 a88836 a88837 a88838 a88839 a88840 a88841 a88842 a88843 a88844 a88845 a88846 a88847 a88848 a88849 a88850 a88851 a88852 a88853 a88854 a88855 a88856 a88857 a88858 a88859 a88860 a88861 a88862 a88863 a88864 a88865 a88866 a88867 a88868 a88869 a88870 a88871 a88872 a88873 a88874 a88875 a88876 a88877 a88878 a88879 a88880 a88881 a88882 a88883 a88884 a88885 a88886 a88887 a88888 a88889 a88890 a88891 a88892 a88893 a88894 a88895 a88896 a88897 a88898 a88899 a88900 a88901 a88902 a88903 a88904 a88905 a88906 a88907 a88908 a88909 a88910 a88911 a88912 a88913 a88914 a88915 a88916 a88917 a88918 a88919 a88920 a88921 a88922 a88923 a88924 a88925 a88926 a88927 a88928 a88929 a88930 a88931 a88932 a88933 a88934 a88935 a88936 a88937 a88938 a88939 a88940 a88941 a88942 a88943 a88944 a88945 a88946 a88947 a88948 a88949 a88950 a88951 a88952 a88953 a88954 a88955 a88956 a88957 a88958 a88959 a88960 a88961 a88962 a88963 a88964 a88965 a88966 a88967 a88968 a88969 a88970 a88971 a88972 a88973 a88974 a88975 a88976 a88977 a88978 a88979 a88980 a88981 a88982 a88983 a88984 a88985 a88986 a88987 a88988 a88989 a88990 a88991 a88992 a88993 a88994 a88995 a88996 a88997 a88998 a88999 a89000 a89001 a89002 a89003 a89004 a89005 a89006 a89007 a89008 a89009 a89010 a89011 a89012 a89013 a89014 a89015 a89016 a89017 a89018 a89019 a89020 a89021 a89022 a89023 a89024 a89025 a89026 a89027 a89028 a89029 a89030 a89031 a89032 a89033 a89034 a89035 a89036 a89037 a89038 a89039 a89040 a89041 a89042 a89043 a89044 a89045 a89046 a89047 a89048 a89049 a89050 a89051 a89052 a89053 a89054 a89055 a89056 a89057 a89058 a89059 a89060 a89061 a89062 a89063 a89064 a89065 a89066 a89067 a89068 a89069 a89070 a89071 a89072 a89073 a89074 a89075 a89076 a89077 a89078 a89079 a89080 a89081 a89082 a89083 a89084 a89085 a89086 a89087 a89088 a89089 a89090 a89091 a89092 a89093 a89094 a89095 a89096 a89097 a89098 a89099 a89100 a89101 a89102 a89103 a89104 a89105 a89106 a89107 a89108 a89109 a89110 a89111 a89112 a89113 a89114 a89115 a89116 a89117 a89118 a89119 a89120 a89121 a89122 a89123 a89124 a89125 a89126 a89127 a89128 a89129 a89130 a89131 a89132 a89133 a89134 a89135 a89136 a89137 a89138 a89139 a89140 a89141 a89142 a89143 a89144 a89145 a89146 a89147 a89148 a89149 a89150 a89151 a89152 a89153 a89154 a89155 a89156 a89157 a89158 a89159 a89160 a89161 a89162 a89163 a89164 a89165 a89166 a89167 a89168 a89169 a89170 a89171 a89172 a89173 a89174 a89175 a89176 a89177 a89178 a89179 a89180 a89181 a89182 a89183 a89184 a89185 a89186 a89187 a89188 a89189 a89190 a89191 a89192 a89193 a89194 a89195 a89196 a89197 a89198 a89199 a89200 a89201 a89202 a89203 a89204 a89205 a89206 a89207 a89208 a89209 a89210 a89211 a89212 a89213 a89214 a89215 a89216 a89217 a89218 a89219 a89220 a89221 a89222 a89223 a89224 a89225 a89226 a89227 a89228 a89229 a89230 a89231 a89232 a89233 a89234 a89235 a89236 a89237 a89238 a89239 a89240 a89241 a89242 a89243 a89244 a89245 a89246 a89247 a89248 a89249 a89250 a89251 a89252 a89253 a89254 a89255 a89256 a89257 a89258 a89259 a89260 a89261 a89262 a89263 a89264 a89265 a89266 a89267 a89268 a89269 a89270 a89271 a89272 a89273 a89274 a89275 a89276 a89277 a89278 a89279 a89280 a89281 a89282 a89283 a89284 a89285 a89286 a89287 a89288 a89289 a89290 a89291 a89292 a89293 a89294 a89295 a89296 a89297 a89298 a89299 a89300 a89301 a89302 a89303 a89304 a89305 a89306 a89307 a89308 a89309 a89310 a89311 a89312 a89313 a89314 a89315 a89316 a89317 a89318 a89319 a89320 a89321 a89322 a89323 a89324 a89325 a89326 a89327 a89328 a89329 a89330 a89331 a89332 a89333 a89334 a89335 a89336 a89337 a89338 a89339 a89340 a89341 a89342 a89343 a89344 a89345 a89346 a89347 a89348 a89349 a89350 a89351 a89352 a89353 a89354 a89355 a89356 a89357 a89358 a89359 a89360 a89361 a89362 a89363 a89364 a89365 a89366 a89367 a89368 a89369 a89370 a89371 a89372 a89373 a89374 a89375 a89376 a89377 a89378 a89379 a89380 a89381 a89382 a89383 a89384 a89385 a89386 a89387 a89388 a89389 a89390 a89391 a89392 a89393 a89394 a89395 a89396 a89397 a89398 a89399 a89400 a89401 a89402 a89403 a89404 a89405 a89406 a89407 a89408 a89409 a89410 a89411 a89412 a89413 a89414 a89415 a89416 a89417 a89418 a89419 a89420 a89421 a89422 a89423 a89424 a89425 a89426 a89427 a89428 a89429 a89430 a89431 a89432 a89433 a89434 a89435 a89436 a89437 a89438 a89439 a89440 a89441 a89442 a89443 a89444 a89445 a89446 a89447 a89448 a89449 a89450 a89451 a89452 a89453 a89454 a89455 a89456 a89457 a89458 a89459 a89460 a89461 a89462 a89463 a89464 a89465 a89466 a89467 a89468 a89469 a89470 a89471 a89472 a89473 a89474 a89475 a89476 a89477 a89478 a89479 a89480 a89481 a89482 a89483 a89484 a89485 a89486 a89487 a89488 a89489 a89490 a89491 a89492 a89493 a89494 a89495 a89496 a89497 a89498 a89499 a89500 a89501 a89502 a89503 a89504 a89505 a89506 a89507 a89508 a89509 a89510 a89511 a89512 a89513 a89514 a89515 a89516 a89517 a89518 a89519 a89520 a89521 a89522 a89523 a89524 a89525 a89526 a89527 a89528 a89529 a89530 a89531 a89532 a89533 a89534 a89535 a89536 a89537 a89538 a89539 a89540 a89541 a89542 a89543 a89544 a89545 a89546 a89547 a89548 a89549 a89550 a89551 a89552 a89553 a89554 a89555 a89556 a89557 a89558 a89559 a89560 a89561 a89562 a89563 a89564 a89565 a89566 a89567 a89568 a89569 a89570 a89571 a89572 a89573 a89574 a89575 a89576 a89577 a89578 a89579 a89580 a89581 a89582 a89583 a89584 a89585 a89586 a89587 a89588 a89589 a89590 a89591 a89592 a89593 a89594 a89595 a89596 a89597 a89598 a89599 a89600 a89601 a89602 a89603 a89604 a89605 a89606 a89607 a89608 a89609 a89610 a89611 a89612 a89613 a89614 a89615 a89616 a89617 a89618 a89619 a89620 a89621 a89622 a89623 a89624 a89625 a89626 a89627 a89628 a89629 a89630 a89631 a89632 a89633 a89634 a89635 a89636 a89637 a89638 a89639 a89640 a89641 a89642 a89643 a89644 a89645 a89646 a89647 a89648 a89649 a89650 a89651 a89652 a89653 a89654 a89655 a89656 a89657 a89658 a89659 a89660 a89661 a89662 a89663 a89664 a89665 a89666 a89667 a89668 a89669 a89670 a89671 a89672 a89673 a89674 a89675 a89676 a89677 a89678 a89679 a89680 a89681 a89682 a89683 a89684 a89685 a89686 a89687 a89688 a89689 a89690 a89691 a89692 a89693 a89694 a89695 a89696 a89697 a89698 a89699 a89700 a89701 a89702 a89703 a89704 a89705 a89706 a89707 a89708 a89709 a89710 a89711 a89712 a89713 a89714 a89715 a89716 a89717 a89718 a89719 a89720 a89721 a89722 a89723 a89724 a89725 a89726 a89727 a89728 a89729 a89730 a89731 a89732 a89733 a89734 a89735 a89736 a89737 a89738 a89739 a89740 a89741 a89742 a89743 a89744 a89745 a89746 a89747 a89748 a89749 a89750 a89751 a89752 a89753 a89754 a89755 a89756 a89757 a89758 a89759 a89760 a89761 a89762 a89763 a89764 a89765 a89766 a89767 a89768 a89769 a89770 a89771 a89772 a89773 a89774 a89775 a89776 a89777 a89778 a89779 a89780 a89781 a89782 a89783 a89784 a89785 a89786 a89787 a89788 a89789 a89790 a89791 a89792 a89793 a89794 a89795 a89796 a89797 a89798 a89799 a89800 a89801 a89802 a89803 a89804 a89805 a89806 a89807 a89808 a89809 a89810 a89811 a89812 a89813 a89814 a89815 a89816 a89817 a89818 a89819 a89820 a89821 a89822 a89823 a89824 a89825 a89826 a89827 a89828 a89829 a89830 a89831 a89832 a89833 a89834 a89835 a89836 a89837 a89838 a89839 a89840 a89841 a89842 a89843 a89844 a89845 a89846 a89847 a89848 a89849 a89850 a89851 a89852 a89853 a89854 a89855 a89856 a89857 a89858 a89859 a89860 a89861 a89862 a89863 a89864 a89865 a89866 a89867 a89868 a89869 a89870 a89871 a89872 a89873 a89874 a89875 a89876 a89877 a89878 a89879 a89880 a89881 a89882 a89883 a89884 a89885 a89886 a89887 a89888 a89889 a89890 a89891 a89892 a89893 a89894 a89895 a89896 a89897 a89898 a89899 a89900 a89901 a89902 a89903 a89904 a89905 a89906 a89907 a89908 a89909 a89910 a89911 a89912 a89913 a89914 a89915 a89916 a89917 a89918 a89919 a89920 a89921 a89922 a89923 a89924 a89925 a89926 a89927 a89928 a89929 a89930 a89931 a89932 a89933 a89934 a89935 a89936 a89937 a89938 a89939 a89940 a89941 a89942 a89943 a89944 a89945 a89946 a89947 a89948 a89949 a89950 a89951 a89952 a89953 a89954 a89955 a89956 a89957 a89958 a89959 a89960 a89961 a89962 a89963 a89964 a89965 a89966 a89967 a89968 a89969 a89970 a89971 a89972 a89973 a89974 a89975 a89976 a89977 a89978 a89979 a89980 a89981 a89982 a89983 a89984 a89985 a89986 a89987 a89988 a89989 a89990 a89991 a89992 a89993 a89994 a89995 a89996 a89997 a89998 a89999 a90000 a90001 a90002 a90003 a90004 a90005 a90006 a90007 a90008 a90009 a90010 a90011 a90012 a90013 a90014 a90015 a90016 a90017 a90018 a90019 a90020 a90021 a90022 a90023 a90024 a90025 a90026 a90027 a90028 a90029 a90030 a90031 a90032 a90033 a90034 a90035 a90036 a90037 a90038 a90039 a90040 a90041 a90042 a90043 a90044 a90045 a90046 a90047 a90048 a90049 a90050 a90051 a90052 a90053 a90054 a90055 a90056 a90057 a90058 a90059 a90060 a90061 a90062 a90063 a90064 a90065 a90066 a90067 a90068 a90069 a90070 a90071 a90072 a90073 a90074 a90075 a90076 a90077 a90078 a90079 a90080 a90081 a90082 a90083 a90084 a90085 a90086 a90087 a90088 a90089 a90090 a90091 a90092 a90093 a90094 a90095 a90096 a90097 a90098 a90099 a90100 a90101 a90102 a90103 a90104 a90105 a90106 a90107 a90108 a90109 a90110 a90111 a90112 a90113 a90114 a90115 a90116 a90117 a90118 a90119 a90120 a90121 a90122 a90123 a90124 a90125 a90126 a90127 a90128 a90129 a90130 a90131 a90132 a90133 a90134 a90135 a90136 a90137 a90138 a90139 a90140 a90141 a90142 a90143 a90144 a90145 a90146 a90147 a90148 a90149 a90150 a90151 a90152 a90153 a90154 a90155 a90156 a90157 a90158 a90159 a90160 a90161 a90162 a90163 a90164 a90165 a90166 a90167 a90168 a90169 a90170 a90171 a90172 a90173 a90174 a90175 a90176 a90177 a90178 a90179 a90180 a90181 a90182 a90183 a90184 a90185 a90186 a90187 a90188 a90189 a90190 a90191 a90192 a90193 a90194 a90195 a90196 a90197 a90198 a90199 a90200 a90201 a90202 a90203 a90204 a90205 a90206 a90207 a90208 a90209 a90210 a90211 a90212 a90213 a90214 a90215 a90216 a90217 a90218 a90219 a90220 a90221 a90222 a90223 a90224 a90225 a90226 a90227 a90228 a90229 a90230 a90231 a90232 a90233 a90234 a90235 a90236 a90237 a90238 a90239 a90240 a90241 a90242 a90243 a90244 a90245 a90246 a90247 a90248 a90249 a90250 a90251 a90252 a90253 a90254 a90255 a90256 a90257 a90258 a90259 a90260 a90261 a90262 a90263 a90264 a90265 a90266 a90267 a90268 a90269 a90270 a90271 a90272 a90273 a90274 a90275 a90276 a90277 a90278 a90279 a90280 a90281 a90282 a90283 a90284 a90285 a90286 a90287 a90288 a90289 a90290 a90291 a90292 a90293 a90294 a90295 a90296 a90297 a90298 a90299 a90300 a90301 a90302 a90303 a90304 a90305 a90306 a90307 a90308 a90309 a90310 a90311 a90312 a90313 a90314 a90315 a90316 a90317 a90318 a90319 a90320 a90321 a90322 a90323 a90324 a90325 a90326 a90327 a90328 a90329 a90330 a90331 a90332 a90333 a90334 a90335 a90336 a90337 a90338 a90339 a90340 a90341 a90342 a90343 a90344 a90345 a90346 a90347 a90348 a90349 a90350 a90351 a90352 a90353 a90354 a90355 a90356 a90357 a90358 a90359 a90360 a90361 a90362 a90363 a90364 a90365 a90366 a90367 a90368 a90369 a90370 a90371 a90372 a90373 a90374 a90375 a90376 a90377 a90378 a90379 a90380 a90381 a90382 a90383 a90384 a90385 a90386 a90387 a90388 a90389 a90390 a90391 a90392 a90393 a90394 a90395 a90396 a90397 a90398 a90399 a90400 a90401 a90402 a90403 a90404 a90405 a90406 a90407 a90408 a90409 a90410 a90411 a90412 a90413 a90414 a90415 a90416 a90417 a90418 a90419 a90420 a90421 a90422 a90423 a90424 a90425 a90426 a90427 a90428 a90429 a90430 a90431 a90432 a90433 a90434 a90435 a90436 a90437 a90438 a90439 a90440 a90441 a90442 a90443 a90444 a90445 a90446 a90447 a90448 a90449 a90450 a90451 a90452 a90453 a90454 a90455 a90456 a90457 a90458 a90459 a90460 a90461 a90462 a90463 a90464 a90465 a90466 a90467 a90468 a90469 a90470 a90471 a90472 a90473 a90474 a90475 a90476 a90477 a90478 a90479 a90480 a90481 a90482 a90483 a90484 a90485 a90486 a90487 a90488 a90489 a90490 a90491 a90492 a90493 a90494 a90495 a90496 a90497 a90498 a90499 a90500 a90501 a90502 a90503 a90504 a90505 a90506 a90507 a90508 a90509 a90510 a90511 a90512 a90513 a90514 a90515 a90516 a90517 a90518 a90519 a90520 a90521 a90522 a90523 a90524 a90525 a90526 a90527 a90528 a90529 a90530 a90531 a90532 a90533 a90534 a90535 a90536 a90537 a90538 a90539 a90540 a90541 a90542 a90543 a90544 a90545 a90546 a90547 a90548 a90549 a90550 a90551 a90552 a90553 a90554 a90555 a90556 a90557 a90558 a90559 a90560 a90561 a90562 a90563 a90564 a90565 a90566 a90567 a90568 a90569 a90570 a90571 a90572 a90573 a90574 a90575 a90576 a90577 a90578 a90579 a90580 a90581 a90582 a90583 a90584 a90585 a90586 a90587 a90588 a90589 a90590 a90591 a90592 a90593 a90594 a90595 a90596 a90597 a90598 a90599 a90600 a90601 a90602 a90603 a90604 a90605 a90606 a90607 a90608 a90609 a90610 a90611 a90612 a90613 a90614 a90615 a90616 a90617 a90618 a90619 a90620 a90621 a90622 a90623 a90624 a90625 a90626 a90627 a90628 a90629 a90630 a90631 a90632 a90633 a90634 a90635 a90636 a90637 a90638 a90639 a90640 a90641 a90642 a90643 a90644 a90645 a90646 a90647 a90648 a90649 a90650 a90651 a90652 a90653 a90654 a90655 a90656 a90657 a90658 a90659 a90660 a90661 a90662 a90663 a90664 a90665 a90666 a90667 a90668 a90669 a90670 a90671 a90672 a90673 a90674 a90675 a90676 a90677 a90678 a90679 a90680 a90681 a90682 a90683 a90684 a90685 a90686 a90687 a90688 a90689 a90690 a90691 a90692 a90693 a90694 a90695 a90696 a90697 a90698 a90699 a90700 a90701 a90702 a90703 a90704 a90705 a90706 a90707 a90708 a90709 a90710 a90711 a90712 a90713 a90714 a90715 a90716 a90717 a90718 a90719 a90720 a90721 a90722 a90723 a90724 a90725 a90726 a90727 a90728 a90729 a90730 a90731 a90732 a90733 a90734 a90735 a90736 a90737 a90738 a90739 a90740 a90741 a90742 a90743 a90744 a90745 a90746 a90747 a90748 a90749 a90750 a90751 a90752 a90753 a90754 a90755 a90756 a90757 a90758 a90759 a90760 a90761 a90762 a90763 a90764 a90765 a90766 a90767 a90768 a90769 a90770 a90771 a90772 a90773 a90774 a90775 a90776 a90777 a90778 a90779 a90780 a90781 a90782 a90783 a90784 a90785 a90786 a90787 a90788 a90789 a90790 a90791 a90792 a90793 a90794 a90795 a90796 a90797 a90798 a90799 a90800 a90801 a90802 a90803 a90804 a90805 a90806 a90807 a90808 a90809 a90810 a90811 a90812 a90813 a90814 a90815 a90816 a90817 a90818 a90819 a90820 a90821 a90822 a90823 a90824 a90825 a90826 a90827 a90828 a90829 a90830 a90831 a90832 a90833 a90834 a90835 a90836 a90837 a90838 a90839 a90840 a90841 a90842 a90843 a90844 a90845 a90846 a90847 a90848 a90849 a90850 a90851 a90852 a90853 a90854 a90855 a90856 a90857 a90858 a90859 a90860 a90861 a90862 a90863 a90864 a90865 a90866 a90867 a90868 a90869 a90870 a90871 a90872 a90873 a90874 a90875 a90876 a90877 a90878 a90879 a90880 a90881 a90882 a90883 a90884 a90885 a90886 a90887 a90888 a90889 a90890 a90891 a90892 a90893 a90894 a90895 a90896 a90897 a90898 a90899 a90900 a90901 a90902 a90903 a90904 a90905 a90906 a90907 a90908 a90909 a90910 a90911 a90912 a90913 a90914 a90915 a90916 a90917 a90918 a90919 a90920 a90921 a90922 a90923 a90924 a90925 a90926 a90927 a90928 a90929 a90930 a90931 a90932 a90933 a90934 a90935 a90936 a90937 a90938 a90939 a90940 a90941 a90942 a90943 a90944 a90945 a90946 a90947 a90948 a90949 a90950 a90951 a90952 a90953 a90954 a90955 a90956 a90957 a90958 a90959 a90960 a90961 a90962 a90963 a90964 a90965 a90966 a90967 a90968 a90969 a90970 a90971 a90972 a90973 a90974 a90975 a90976 a90977 a90978 a90979 a90980 a90981 a90982 a90983 a90984 a90985 a90986 a90987 a90988 a90989 a90990 a90991 a90992 a90993 a90994 a90995 a90996 a90997 a90998 a90999 a91000 a91001 a91002 a91003 a91004 a91005 a91006 a91007 a91008 a91009 a91010 a91011 a91012 a91013 a91014 a91015 a91016 a91017 a91018 a91019 a91020 a91021 a91022 a91023 a91024 a91025 a91026 a91027 a91028 a91029 a91030 a91031 a91032 a91033 a91034 a91035 a91036 a91037 a91038 a91039 a91040 a91041 a91042 a91043 a91044 a91045 a91046 a91047 a91048 a91049 a91050 a91051 a91052 a91053 a91054 a91055 a91056 a91057 a91058 a91059 a91060 a91061 a91062 a91063 a91064 a91065 a91066 a91067 a91068 a91069 a91070 a91071 a91072 a91073 a91074 a91075 a91076 a91077 a91078 a91079 a91080 a91081 a91082 a91083 a91084 a91085 a91086 a91087 a91088 a91089 a91090 a91091 a91092 a91093 a91094 a91095 a91096 a91097 a91098 a91099 a91100 a91101 a91102 a91103 a91104 a91105 a91106 a91107 a91108 a91109 a91110 a91111 a91112 a91113 a91114 a91115 a91116 a91117 a91118 a91119 a91120 a91121 a91122 a91123 a91124 a91125 a91126 a91127 a91128 a91129 a91130 a91131 a91132 a91133 a91134 a91135 a91136 a91137 a91138 a91139 a91140 a91141 a91142 a91143 a91144 a91145 a91146 a91147 a91148 a91149 a91150 a91151 a91152 a91153 a91154 a91155 a91156 a91157 a91158 a91159 a91160 a91161 a91162 a91163 a91164 a91165 a91166 a91167 a91168 a91169 a91170 a91171 a91172 a91173 a91174 a91175 a91176 a91177 a91178 a91179 a91180 a91181 a91182 a91183 a91184 a91185 a91186 a91187 a91188 a91189 a91190 a91191 a91192 a91193 a91194 a91195 a91196 a91197 a91198 a91199 a91200 a91201 a91202 a91203 a91204 a91205 a91206 a91207 a91208 a91209 a91210 a91211 a91212 a91213 a91214 a91215 a91216 a91217 a91218 a91219 a91220 a91221 a91222 a91223 a91224 a91225 a91226 a91227 a91228 a91229 a91230 a91231 a91232 a91233 a91234 a91235 a91236 a91237 a91238 a91239 a91240 a91241 a91242 a91243 a91244 a91245 a91246 a91247 a91248 a91249 a91250 a91251 a91252 a91253 a91254 a91255 a91256 a91257 a91258 a91259 a91260 a91261 a91262 a91263 a91264 a91265 a91266 a91267 a91268 a91269 a91270 a91271 a91272 a91273 a91274 a91275 a91276 a91277 a91278 a91279 a91280 a91281 a91282 a91283 a91284 a91285 a91286 a91287 a91288 a91289 a91290 a91291 a91292 a91293 a91294 a91295 a91296 a91297 a91298 a91299 a91300 a91301 a91302 a91303 a91304 a91305 a91306 a91307 a91308 a91309 a91310 a91311 a91312 a91313 a91314 a91315 a91316 a91317 a91318 a91319 a91320 a91321 a91322 a91323 a91324 a91325 a91326 a91327 a91328 a91329 a91330 a91331 a91332 a91333 a91334 a91335 a91336 a91337 a91338 a91339 a91340 a91341 a91342 a91343 a91344 a91345 a91346 a91347 a91348 a91349 a91350 a91351 a91352 a91353 a91354 a91355 a91356 a91357 a91358 a91359 a91360 a91361 a91362 a91363 a91364 a91365 a91366 a91367 a91368 a91369 a91370 a91371 a91372 a91373 a91374 a91375 a91376 a91377 a91378 a91379 a91380 a91381 a91382 a91383 a91384 a91385 a91386 a91387 a91388 a91389 a91390 a91391 a91392 a91393 a91394 a91395 a91396 a91397 a91398 a91399 a91400 a91401 a91402 a91403 a91404 a91405 a91406 a91407 a91408 a91409 a91410 a91411 a91412 a91413 a91414 a91415 a91416 a91417 a91418 a91419 a91420 a91421 a91422 a91423 a91424 a91425 a91426 a91427 a91428 a91429 a91430 a91431 a91432 a91433 a91434 a91435 a91436 a91437 a91438 a91439 a91440 a91441 a91442 a91443 a91444 a91445 a91446 a91447 a91448 a91449 a91450 a91451 a91452 a91453 a91454 a91455 a91456 a91457 a91458 a91459 a91460 a91461 a91462 a91463 a91464 a91465 a91466 a91467 a91468 a91469 a91470 a91471 a91472 a91473 a91474 a91475 a91476 a91477 a91478 a91479 a91480 a91481 a91482 a91483 a91484 a91485 a91486 a91487 a91488 a91489 a91490 a91491 a91492 a91493 a91494 a91495 a91496 a91497 a91498 a91499 a91500 a91501 a91502 a91503 a91504 a91505 a91506 a91507 a91508 a91509 a91510 a91511 a91512 a91513 a91514 a91515 a91516 a91517 a91518 a91519 a91520 a91521 a91522 a91523 a91524 a91525 a91526 a91527 a91528 a91529 a91530 a91531 a91532 a91533 a91534 a91535 a91536 a91537 a91538 a91539 a91540 a91541 a91542 a91543 a91544 a91545 a91546 a91547 a91548 a91549 a91550 a91551 a91552 a91553 a91554 a91555 a91556 a91557 a91558 a91559 a91560 a91561 a91562 a91563 a91564 a91565 a91566 a91567 a91568 a91569 a91570 a91571 a91572 a91573 a91574 a91575 a91576 a91577 a91578 a91579 a91580 a91581 a91582 a91583 a91584 a91585 a91586 a91587 a91588 a91589 a91590 a91591 a91592 a91593 a91594 a91595 a91596 a91597 a91598 a91599 a91600 a91601 a91602 a91603 a91604 a91605 a91606 a91607 a91608 a91609 a91610 a91611 a91612 a91613 a91614 a91615 a91616 a91617 a91618 a91619 a91620 a91621 a91622 a91623 a91624 a91625 a91626 a91627 a91628 a91629 a91630 a91631 a91632 a91633 a91634 a91635 a91636 a91637 a91638 a91639 a91640 a91641 a91642 a91643 a91644 a91645 a91646 a91647 a91648 a91649 a91650 a91651 a91652 a91653 a91654 a91655 a91656 a91657 a91658 a91659 a91660 a91661 a91662 a91663 a91664 a91665 a91666 a91667 a91668 a91669 a91670 a91671 a91672 a91673 a91674 a91675 a91676 a91677 a91678 a91679 a91680 a91681 a91682 a91683 a91684 a91685 a91686 a91687 a91688 a91689 a91690 a91691 a91692 a91693 a91694 a91695 a91696 a91697 a91698 a91699 a91700 a91701 a91702 a91703 a91704 a91705 a91706 a91707 a91708 a91709 a91710 a91711 a91712 a91713 a91714 a91715 a91716 a91717 a91718 a91719 a91720 a91721 a91722 a91723 a91724 a91725 a91726 a91727 a91728 a91729 a91730 a91731 a91732 a91733 a91734 a91735 a91736 a91737 a91738 a91739 a91740 a91741 a91742 a91743 a91744 a91745 a91746 a91747 a91748 a91749 a91750 a91751 a91752 a91753 a91754 a91755 a91756 a91757 a91758 a91759 a91760 a91761 a91762 a91763 a91764 a91765 a91766 a91767 a91768 a91769 a91770 a91771 a91772 a91773 a91774 a91775 a91776 a91777 a91778 a91779 a91780 a91781 a91782 a91783 a91784 a91785 a91786 a91787 a91788 a91789 a91790 a91791 a91792 a91793 a91794 a91795 a91796 a91797 a91798 a91799 a91800 a91801 a91802 a91803 a91804 a91805 a91806 a91807 a91808 a91809 a91810 a91811 a91812 a91813 a91814 a91815 a91816 a91817 a91818 a91819 a91820 a91821 a91822 a91823 a91824 a91825 a91826 a91827 a91828 a91829 a91830 a91831 a91832 a91833 a91834 a91835 a91836 a91837 a91838 a91839 a91840 a91841 a91842 a91843 a91844 a91845 a91846 a91847 a91848 a91849 a91850 a91851 a91852 a91853 a91854 a91855 a91856 a91857 a91858 a91859 a91860 a91861 a91862 a91863 a91864 a91865 a91866 a91867 a91868 a91869 a91870 a91871 a91872 a91873 a91874 a91875 a91876 a91877 a91878 a91879 a91880 a91881 a91882 a91883 a91884 a91885 a91886 a91887 a91888 a91889 a91890 a91891 a91892 a91893 a91894 a91895 a91896 a91897 a91898 a91899 a91900 a91901 a91902 a91903 a91904 a91905 a91906 a91907 a91908 a91909 a91910 a91911 a91912 a91913 a91914 a91915 a91916 a91917 a91918 a91919 a91920 a91921 a91922 a91923 a91924 a91925 a91926 a91927 a91928 a91929 a91930 a91931 a91932 a91933 a91934 a91935 a91936 a91937 a91938 a91939 a91940 a91941 a91942 a91943 a91944 a91945 a91946 a91947 a91948 a91949 a91950 a91951 a91952 a91953 a91954 a91955 a91956 a91957 a91958 a91959 a91960 a91961 a91962 a91963 a91964 a91965 a91966 a91967 a91968 a91969 a91970 a91971 a91972 a91973 a91974 a91975 a91976 a91977 a91978 a91979 a91980 a91981 a91982 a91983 a91984 a91985 a91986 a91987 a91988 a91989 a91990 a91991 a91992 a91993 a91994 a91995 a91996 a91997 a91998 a91999 a92000 a92001 a92002 a92003 a92004 a92005 a92006 a92007 a92008 a92009 a92010 a92011 a92012 a92013 a92014 a92015 a92016 a92017 a92018 a92019 a92020 a92021 a92022 a92023 a92024 a92025 a92026 a92027 a92028 a92029 a92030 a92031 a92032 a92033 a92034 a92035 a92036 a92037 a92038 a92039 a92040 a92041 a92042 a92043 a92044 a92045 a92046 a92047 a92048 a92049 a92050 a92051 a92052 a92053 a92054 a92055 a92056 a92057 a92058 a92059 a92060 a92061 a92062 a92063 a92064 a92065 a92066 a92067 a92068 a92069 a92070 a92071 a92072 a92073 a92074 a92075 a92076 a92077 a92078 a92079 a92080 a92081 a92082 a92083 a92084 a92085 a92086 a92087 a92088 a92089 a92090 a92091 a92092 a92093 a92094 a92095 a92096 a92097 a92098 a92099 a92100 a92101 a92102 a92103 a92104 a92105 a92106 a92107 a92108 a92109 a92110 a92111 a92112 a92113 a92114 a92115 a92116 a92117 a92118 a92119 a92120 a92121 a92122 a92123 a92124 a92125 a92126 a92127 a92128 a92129 a92130 a92131 a92132 a92133 a92134 a92135 a92136 a92137 a92138 a92139 a92140 a92141 a92142 a92143 a92144 a92145 a92146 a92147 a92148 a92149 a92150 a92151 a92152 a92153 a92154 a92155 a92156 a92157 a92158 a92159 a92160 a92161 a92162 a92163 a92164 a92165 a92166 a92167 a92168 a92169 a92170 a92171 a92172 a92173 a92174 a92175 a92176 a92177 a92178 a92179 a92180 a92181 a92182 a92183 a92184 a92185 a92186 a92187 a92188 a92189 a92190 a92191 a92192 a92193 a92194 a92195 a92196 a92197 a92198 a92199 a92200 a92201 a92202 a92203 a92204 a92205 a92206 a92207 a92208 a92209 a92210 a92211 a92212 a92213 a92214 a92215 a92216 a92217 a92218 a92219 a92220 a92221 a92222 a92223 a92224 a92225 a92226 a92227 a92228 a92229 a92230 a92231 a92232 a92233 a92234 a92235 a92236 a92237 a92238 a92239 a92240 a92241 a92242 a92243 a92244 a92245 a92246 a92247 a92248 a92249 a92250 a92251 a92252 a92253 a92254 a92255 a92256 a92257 a92258 a92259 a92260 a92261 a92262 a92263 a92264 a92265 a92266 a92267 a92268 a92269 a92270 a92271 a92272 a92273 a92274 a92275 a92276 a92277 a92278 a92279 a92280 a92281 a92282 a92283 a92284 a92285 a92286 a92287 a92288 a92289 a92290 a92291 a92292 a92293 a92294 a92295 a92296 a92297 a92298 a92299 a92300 a92301 a92302 a92303 a92304 a92305 a92306 a92307 a92308 a92309 a92310 a92311 a92312 a92313 a92314 a92315 a92316 a92317 a92318 a92319 a92320 a92321 a92322 a92323 a92324 a92325 a92326 a92327 a92328 a92329 a92330 a92331 a92332 a92333 a92334 a92335 a92336 a92337 a92338 a92339 a92340 a92341 a92342 a92343 a92344 a92345 a92346 a92347 a92348 a92349 a92350 a92351 a92352 a92353 a92354 a92355 a92356 a92357 a92358 a92359 a92360 a92361 a92362 a92363 a92364 a92365 a92366 a92367 a92368 a92369 a92370 a92371 a92372 a92373 a92374 a92375 a92376 a92377 a92378 a92379 a92380 a92381 a92382 a92383 a92384 a92385 a92386 a92387 a92388 a92389 a92390 a92391 a92392 a92393 a92394 a92395 a92396 a92397 a92398 a92399 a92400 a92401 a92402 a92403 a92404 a92405 a92406 a92407 a92408 a92409 a92410 a92411 a92412 a92413 a92414 a92415 a92416 a92417 a92418 a92419 a92420 a92421 a92422 a92423 a92424 a92425 a92426 a92427 a92428 a92429 a92430 a92431 a92432 a92433 a92434 a92435 a92436 a92437 a92438 a92439 a92440 a92441 a92442 a92443 a92444 a92445 a92446 a92447 a92448 a92449 a92450 a92451 a92452 a92453 a92454 a92455 a92456 a92457 a92458 a92459 a92460 a92461 a92462 a92463 a92464 a92465 a92466 a92467 a92468 a92469 a92470 a92471 a92472 a92473 a92474 a92475 a92476 a92477 a92478 a92479 a92480 a92481 a92482 a92483 a92484 a92485 a92486 a92487 a92488 a92489 a92490 a92491 a92492 a92493 a92494 a92495 a92496 a92497 a92498 a92499 a92500 a92501 a92502 a92503 a92504 a92505 a92506 a92507 a92508 a92509 a92510 a92511 a92512 a92513 a92514 a92515 a92516 a92517 a92518 a92519 a92520 a92521 a92522 a92523 a92524 a92525 a92526 a92527 a92528 a92529 a92530 a92531 a92532 a92533 a92534 a92535 a92536 a92537 a92538 a92539 a92540 a92541 a92542 a92543 a92544 a92545 a92546 a92547 a92548 a92549 a92550 a92551 a92552 a92553 a92554 a92555 a92556 a92557 a92558 a92559 a92560 a92561 a92562 a92563 a92564 a92565 a92566 a92567 a92568 a92569 a92570 a92571 a92572 a92573 a92574 a92575 a92576 a92577 a92578 a92579 a92580 a92581 a92582 a92583 a92584 a92585 a92586 a92587 a92588 a92589 a92590 a92591 a92592 a92593 a92594 a92595 a92596 a92597 a92598 a92599 a92600 a92601 a92602 a92603 a92604 a92605 a92606 a92607 a92608 a92609 a92610 a92611 a92612 a92613 a92614 a92615 a92616 a92617 a92618 a92619 a92620 a92621 a92622 a92623 a92624 a92625 a92626 a92627 a92628 a92629 a92630 a92631 a92632 a92633 a92634 a92635 a92636 a92637 a92638 a92639 a92640 a92641 a92642 a92643 a92644 a92645 a92646 a92647 a92648 a92649 a92650 a92651 a92652 a92653 a92654 a92655 a92656 a92657 a92658 a92659 a92660 a92661 a92662 a92663 a92664 a92665 a92666 a92667 a92668 a92669 a92670 a92671 a92672 a92673 a92674 a92675 a92676 a92677 a92678 a92679 a92680 a92681 a92682 a92683 a92684 a92685 a92686 a92687 a92688 a92689 a92690 a92691 a92692 a92693 a92694 a92695 a92696 a92697 a92698 a92699 a92700 a92701 a92702 a92703 a92704 a92705 a92706 a92707 a92708 a92709 a92710 a92711 a92712 a92713 a92714 a92715 a92716 a92717 a92718 a92719 a92720 a92721 a92722 a92723 a92724 a92725 a92726 a92727 a92728 a92729 a92730 a92731 a92732 a92733 a92734 a92735 a92736 a92737 a92738 a92739 a92740 a92741 a92742 a92743 a92744 a92745 a92746 a92747 a92748 a92749 a92750 a92751 a92752 a92753 a92754 a92755 a92756 a92757 a92758 a92759 a92760 a92761 a92762 a92763 a92764 a92765 a92766 a92767 a92768 a92769 a92770 a92771 a92772 a92773 a92774 a92775 a92776 a92777 a92778 a92779 a92780 a92781 a92782 a92783 a92784 a92785 a92786 a92787 a92788 a92789 a92790 a92791 a92792 a92793 a92794 a92795 a92796 a92797 a92798 a92799 a92800 a92801 a92802 a92803 a92804 a92805 a92806 a92807 a92808 a92809 a92810 a92811 a92812 a92813 a92814 a92815 a92816 a92817 a92818 a92819 a92820 a92821 a92822 a92823 a92824 a92825 a92826 a92827 a92828 a92829 a92830 a92831 a92832 a92833 a92834 a92835 a92836 a92837 a92838 a92839 a92840 a92841 a92842 a92843 a92844 a92845 a92846 a92847 a92848 a92849 a92850 a92851 a92852 a92853 a92854 a92855 a92856 a92857 a92858 a92859 a92860 a92861 a92862 a92863 a92864 a92865 a92866 a92867 a92868 a92869 a92870 a92871 a92872 a92873 a92874 a92875 a92876 a92877 a92878 a92879 a92880 a92881 a92882 a92883 a92884 a92885 a92886 a92887 a92888 a92889 a92890 a92891 a92892 a92893 a92894 a92895 a92896 a92897 a92898 a92899 a92900 a92901 a92902 a92903 a92904 a92905 a92906 a92907 a92908 a92909 a92910 a92911 a92912 a92913 a92914 a92915 a92916 a92917 a92918 a92919 a92920 a92921 a92922 a92923 a92924 a92925 a92926 a92927 a92928 a92929 a92930 a92931 a92932 a92933 a92934 a92935 a92936 a92937 a92938 a92939 a92940 a92941 a92942 a92943 a92944 a92945 a92946 a92947 a92948 a92949 a92950 a92951 a92952 a92953 a92954 a92955 a92956 a92957 a92958 a92959 a92960 a92961 a92962 a92963 a92964 a92965 a92966 a92967 a92968 a92969 a92970 a92971 a92972 a92973 a92974 a92975 a92976 a92977 a92978 a92979 a92980 a92981 a92982 a92983 a92984 a92985 a92986 a92987 a92988 a92989 a92990 a92991 a92992 a92993 a92994 a92995 a92996 a92997 a92998 a92999 a93000 a93001 a93002 a93003 a93004 a93005 a93006 a93007 a93008 a93009 a93010 a93011 a93012 a93013 a93014 a93015 a93016 a93017 a93018 a93019 a93020 a93021 a93022 a93023 a93024 a93025 a93026 a93027 a93028 a93029 a93030 a93031 a93032 a93033 a93034 a93035 a93036 a93037 a93038 a93039 a93040 a93041 a93042 a93043 a93044 a93045 a93046 a93047 a93048 a93049 a93050 a93051 a93052 a93053 a93054 a93055 a93056 a93057 a93058 a93059 a93060 a93061 a93062 a93063 a93064 a93065 a93066 a93067 a93068 a93069 a93070 a93071 a93072 a93073 a93074 a93075 a93076 a93077 a93078 a93079 a93080 a93081 a93082 a93083 a93084 a93085 a93086 a93087 a93088 a93089 a93090 a93091 a93092 a93093 a93094 a93095 a93096 a93097 a93098 a93099 a93100 a93101 a93102 a93103 a93104 a93105 a93106 a93107 a93108 a93109 a93110 a93111 a93112 a93113 a93114 a93115 a93116 a93117 a93118 a93119 a93120 a93121 a93122 a93123 a93124 a93125 a93126 a93127 a93128 a93129 a93130 a93131 a93132 a93133 a93134 a93135 a93136 a93137 a93138 a93139 a93140 a93141 a93142 a93143 a93144 a93145 a93146 a93147 a93148 a93149 a93150 a93151 a93152 a93153 a93154 a93155 a93156 a93157 a93158 a93159 a93160 a93161 a93162 a93163 a93164 a93165 a93166 a93167 a93168 a93169 a93170 a93171 a93172 a93173 a93174 a93175 a93176 a93177 a93178 a93179 a93180 a93181 a93182 a93183 a93184 a93185 a93186 a93187 a93188 a93189 a93190 a93191 a93192 a93193 a93194 a93195 a93196 a93197 a93198 a93199 a93200 a93201 a93202 a93203 a93204 a93205 a93206 a93207 a93208 a93209 a93210 a93211 a93212 a93213 a93214 a93215 a93216 a93217 a93218 a93219 a93220 a93221 a93222 a93223 a93224 a93225 a93226 a93227 a93228 a93229 a93230 a93231 a93232 a93233 a93234 a93235 a93236 a93237 a93238 a93239 a93240 a93241 a93242 a93243 a93244 a93245 a93246 a93247 a93248 a93249 a93250 a93251 a93252 a93253 a93254 a93255 a93256 a93257 a93258 a93259 a93260 a93261 a93262 a93263 a93264 a93265 a93266 a93267 a93268 a93269 a93270 a93271 a93272 a93273 a93274 a93275 a93276 a93277 a93278 a93279 a93280 a93281 a93282 a93283 a93284 a93285 a93286 a93287 a93288 a93289 a93290 a93291 a93292 a93293 a93294 a93295 a93296 a93297 a93298 a93299 a93300 a93301 a93302 a93303 a93304 a93305 a93306 a93307 a93308 a93309 a93310 a93311 a93312 a93313 a93314 a93315 a93316 a93317 a93318 a93319 a93320 a93321 a93322 a93323 a93324 a93325 a93326 a93327 a93328 a93329 a93330 a93331 a93332 a93333 a93334 a93335 a93336 a93337 a93338 a93339 a93340 a93341 a93342 a93343 a93344 a93345 a93346 a93347 a93348 a93349 a93350 a93351 a93352 a93353 a93354 a93355 a93356 a93357 a93358 a93359 a93360 a93361 a93362 a93363 a93364 a93365 a93366 a93367 a93368 a93369 a93370 a93371 a93372 a93373 a93374 a93375 a93376 a93377 a93378 a93379 a93380 a93381 a93382 a93383 a93384 a93385 a93386 a93387 a93388 a93389 a93390 a93391 a93392 a93393 a93394 a93395 a93396 a93397 a93398 a93399 a93400 a93401 a93402 a93403 a93404 a93405 a93406 a93407 a93408 a93409 a93410 a93411 a93412 a93413 a93414 a93415 a93416 a93417 a93418 a93419 a93420 a93421 a93422 a93423 a93424 a93425 a93426 a93427 a93428 a93429 a93430 a93431 a93432 a93433 a93434 a93435 a93436 a93437 a93438 a93439 a93440 a93441 a93442 a93443 a93444 a93445 a93446 a93447 a93448 a93449 a93450 a93451 a93452 a93453 a93454 a93455 a93456 a93457 a93458 a93459 a93460 a93461 a93462 a93463 a93464 a93465 a93466 a93467 a93468 a93469 a93470 a93471 a93472 a93473 a93474 a93475 a93476 a93477 a93478 a93479 a93480 a93481 a93482 a93483 a93484 a93485 a93486 a93487 a93488 a93489 a93490 a93491 a93492 a93493 a93494 a93495 a93496 a93497 a93498 a93499 a93500 a93501 a93502 a93503 a93504 a93505 a93506 a93507 a93508 a93509 a93510 a93511 a93512 a93513 a93514 a93515 a93516 a93517 a93518 a93519 a93520 a93521 a93522 a93523 a93524 a93525 a93526 a93527 a93528 a93529 a93530 a93531 a93532 a93533 a93534 a93535 a93536 a93537 a93538 a93539 a93540 a93541 a93542 a93543 a93544 a93545 a93546 a93547 a93548 a93549 a93550 a93551 a93552 a93553 a93554 a93555 a93556 a93557 a93558 a93559 a93560 a93561 a93562 a93563 a93564 a93565 a93566 a93567 a93568 a93569 a93570 a93571 a93572 a93573 a93574 a93575 a93576 a93577 a93578 a93579 a93580 a93581 a93582 a93583 a93584 a93585 a93586 a93587 a93588 a93589 a93590 a93591 a93592 a93593 a93594 a93595 a93596 a93597 a93598 a93599 a93600 a93601 a93602 a93603 a93604 a93605 a93606 a93607 a93608 a93609 a93610 a93611 a93612 a93613 a93614 a93615 a93616 a93617 a93618 a93619 a93620 a93621 a93622 a93623 a93624 a93625 a93626 a93627 a93628 a93629 a93630 a93631 a93632 a93633 a93634 a93635 a93636 a93637 a93638 a93639 a93640 a93641 a93642 a93643 a93644 a93645 a93646 a93647 a93648 a93649 a93650 a93651 a93652 a93653 a93654 a93655 a93656 a93657 a93658 a93659 a93660 a93661 a93662 a93663 a93664 a93665 a93666 a93667 a93668 a93669 a93670 a93671 a93672 a93673 a93674 a93675 a93676 a93677 a93678 a93679 a93680 a93681 a93682 a93683 a93684 a93685 a93686 a93687 a93688 a93689 a93690 a93691 a93692 a93693 a93694 a93695 a93696 a93697 a93698 a93699 a93700 a93701 a93702 a93703 a93704 a93705 a93706 a93707 a93708 a93709 a93710 a93711 a93712 a93713 a93714 a93715 a93716 a93717 a93718 a93719 a93720 a93721 a93722 a93723 a93724 a93725 a93726 a93727 a93728 a93729 a93730 a93731 a93732 a93733 a93734 a93735 a93736 a93737 a93738 a93739 a93740 a93741 a93742 a93743 a93744 a93745 a93746 a93747 a93748 a93749 a93750 a93751 a93752 a93753 a93754 a93755 a93756 a93757 a93758 a93759 a93760 a93761 a93762 a93763 a93764 a93765 a93766 a93767 a93768 a93769 a93770 a93771 a93772 a93773 a93774 a93775 a93776 a93777 a93778 a93779 a93780 a93781 a93782 a93783 a93784 a93785 a93786 a93787 a93788 a93789 a93790 a93791 a93792 a93793 a93794 a93795 a93796 a93797 a93798 a93799 a93800 a93801 a93802 a93803 a93804 a93805 a93806 a93807 a93808 a93809 a93810 a93811 a93812 a93813 a93814 a93815 a93816 a93817 a93818 a93819 a93820 a93821 a93822 a93823 a93824 a93825 a93826 a93827 a93828 a93829 a93830 a93831 a93832 a93833 a93834 a93835 a93836 a93837 a93838 a93839 a93840 a93841 a93842 a93843 a93844 a93845 a93846 a93847 a93848 a93849 a93850 a93851 a93852 a93853 a93854 a93855 a93856 a93857 a93858 a93859 a93860 a93861 a93862 a93863 a93864 a93865 a93866 a93867 a93868 a93869 a93870 a93871 a93872 a93873 a93874 a93875 a93876 a93877 a93878 a93879 a93880 a93881 a93882 a93883 a93884 a93885 a93886 a93887 a93888 a93889 a93890 a93891 a93892 a93893 a93894 a93895 a93896 a93897 a93898 a93899 a93900 a93901 a93902 a93903 a93904 a93905 a93906 a93907 a93908 a93909 a93910 a93911 a93912 a93913 a93914 a93915 a93916 a93917 a93918 a93919 a93920 a93921 a93922 a93923 a93924 a93925 a93926 a93927 a93928 a93929 a93930 a93931 a93932 a93933 a93934 a93935 a93936 a93937 a93938 a93939 a93940 a93941 a93942 a93943 a93944 a93945 a93946 a93947 a93948 a93949 a93950 a93951 a93952 a93953 a93954 a93955 a93956 a93957 a93958 a93959 a93960 a93961 a93962 a93963 a93964 a93965 a93966 a93967 a93968 a93969 a93970 a93971 a93972 a93973 a93974 a93975 a93976 a93977 a93978 a93979 a93980 a93981 a93982 a93983 a93984 a93985 a93986 a93987 a93988 a93989 a93990 a93991 a93992 a93993 a93994 a93995 a93996 a93997 a93998 a93999 a94000 a94001 a94002 a94003 a94004 a94005 a94006 a94007 a94008 a94009 a94010 a94011 a94012 a94013 a94014 a94015 a94016 a94017 a94018 a94019 a94020 a94021 a94022 a94023 a94024 a94025 a94026 a94027 a94028 a94029 a94030 a94031 a94032 a94033 a94034 a94035 a94036 a94037 a94038 a94039 a94040 a94041 a94042 a94043 a94044 a94045 a94046 a94047 a94048 a94049 a94050 a94051 a94052 a94053 a94054 a94055 a94056 a94057 a94058 a94059 a94060 a94061 a94062 a94063 a94064 a94065 a94066 a94067 a94068 a94069 a94070 a94071 a94072 a94073 a94074 a94075 a94076 a94077 a94078 a94079 a94080 a94081 a94082 a94083 a94084 a94085 a94086 a94087 a94088 a94089 a94090 a94091 a94092 a94093 a94094 a94095 a94096 a94097 a94098 a94099 a94100 a94101 a94102 a94103 a94104 a94105 a94106 a94107 a94108 a94109 a94110 a94111 a94112 a94113 a94114 a94115 a94116 a94117 a94118 a94119 a94120 a94121 a94122 a94123 a94124 a94125 a94126 a94127 a94128 a94129 a94130 a94131 a94132 a94133 a94134 a94135 a94136 a94137 a94138 a94139 a94140 a94141 a94142 a94143 a94144 a94145 a94146 a94147 a94148 a94149 a94150 a94151 a94152 a94153 a94154 a94155 a94156 a94157 a94158 a94159 a94160 a94161 a94162 a94163 a94164 a94165 a94166 a94167 a94168 a94169 a94170 a94171 a94172 a94173 a94174 a94175 a94176 a94177 a94178 a94179 a94180 a94181 a94182 a94183 a94184 a94185 a94186 a94187 a94188 a94189 a94190 a94191 a94192 a94193 a94194 a94195 a94196 a94197 a94198 a94199 a94200 a94201 a94202 a94203 a94204 a94205 a94206 a94207 a94208 a94209 a94210 a94211 a94212 a94213 a94214 a94215 a94216 a94217 a94218 a94219 a94220 a94221 a94222 a94223 a94224 a94225 a94226 a94227 a94228 a94229 a94230 a94231 a94232 a94233 a94234 a94235 a94236 a94237 a94238 a94239 a94240 a94241 a94242 a94243 a94244 a94245 a94246 a94247 a94248 a94249 a94250 a94251 a94252 a94253 a94254 a94255 a94256 a94257 a94258 a94259 a94260 a94261 a94262 a94263 a94264 a94265 a94266 a94267 a94268 a94269 a94270 a94271 a94272 a94273 a94274 a94275 a94276 a94277 a94278 a94279 a94280 a94281 a94282 a94283 a94284 a94285 a94286 a94287 a94288 a94289 a94290 a94291 a94292 a94293 a94294 a94295 a94296 a94297 a94298 a94299 a94300 a94301 a94302 a94303 a94304 a94305 a94306 a94307 a94308 a94309 a94310 a94311 a94312 a94313 a94314 a94315 a94316 a94317 a94318 a94319 a94320 a94321 a94322 a94323 a94324 a94325 a94326 a94327 a94328 a94329 a94330 a94331 a94332 a94333 a94334 a94335 a94336 a94337 a94338 a94339 a94340 a94341 a94342 a94343 a94344 a94345 a94346 a94347 a94348 a94349 a94350 a94351 a94352 a94353 a94354 a94355 a94356 a94357 a94358 a94359 a94360 a94361 a94362 a94363 a94364 a94365 a94366 a94367 a94368 a94369 a94370 a94371 a94372 a94373 a94374 a94375 a94376 a94377 a94378 a94379 a94380 a94381 a94382 a94383 a94384 a94385 a94386 a94387 a94388 a94389 a94390 a94391 a94392 a94393 a94394 a94395 a94396 a94397 a94398 a94399 a94400 a94401 a94402 a94403 a94404 a94405 a94406 a94407 a94408 a94409 a94410 a94411 a94412 a94413 a94414 a94415 a94416 a94417 a94418 a94419 a94420 a94421 a94422 a94423 a94424 a94425 a94426 a94427 a94428 a94429 a94430 a94431 a94432 a94433 a94434 a94435 a94436 a94437 a94438 a94439 a94440 a94441 a94442 a94443 a94444 a94445 a94446 a94447 a94448 a94449 a94450 a94451 a94452 a94453 a94454 a94455 a94456 a94457 a94458 a94459 a94460 a94461 a94462 a94463 a94464 a94465 a94466 a94467 a94468 a94469 a94470 a94471 a94472 a94473 a94474 a94475 a94476 a94477 a94478 a94479 a94480 a94481 a94482 a94483 a94484 a94485 a94486 a94487 a94488 a94489 a94490 a94491 a94492 a94493 a94494 a94495 a94496 a94497 a94498 a94499 a94500 a94501 a94502 a94503 a94504 a94505 a94506 a94507 a94508 a94509 a94510 a94511 a94512 a94513 a94514 a94515 a94516 a94517 a94518 a94519 a94520 a94521 a94522 a94523 a94524 a94525 a94526 a94527 a94528 a94529 a94530 a94531 a94532 a94533 a94534 a94535 a94536 a94537 a94538 a94539 a94540 a94541 a94542 a94543 a94544 a94545 a94546 a94547 a94548 a94549 a94550 a94551 a94552 a94553 a94554 a94555 a94556 a94557 a94558 a94559 a94560 a94561 a94562 a94563 a94564 a94565 a94566 a94567 a94568 a94569 a94570 a94571 a94572 a94573 a94574 a94575 a94576 a94577 a94578 a94579 a94580 a94581 a94582 a94583 a94584 a94585 a94586 a94587 a94588 a94589 a94590 a94591 a94592 a94593 a94594 a94595 a94596 a94597 a94598 a94599 a94600 a94601 a94602 a94603 a94604 a94605 a94606 a94607 a94608 a94609 a94610 a94611 a94612 a94613 a94614 a94615 a94616 a94617 a94618 a94619 a94620 a94621 a94622 a94623 a94624 a94625 a94626 a94627 a94628 a94629 a94630 a94631 a94632 a94633 a94634 a94635 a94636 a94637 a94638 a94639 a94640 a94641 a94642 a94643 a94644 a94645 a94646 a94647 a94648 a94649 a94650 a94651 a94652 a94653 a94654 a94655 a94656 a94657 a94658 a94659 a94660 a94661 a94662 a94663 a94664 a94665 a94666 a94667 a94668 a94669 a94670 a94671 a94672 a94673 a94674 a94675 a94676 a94677 a94678 a94679 a94680 a94681 a94682 a94683 a94684 a94685 a94686 a94687 a94688 a94689 a94690 a94691 a94692 a94693 a94694 a94695 a94696 a94697 a94698 a94699 a94700 a94701 a94702 a94703 a94704 a94705 a94706 a94707 a94708 a94709 a94710 a94711 a94712 a94713 a94714 a94715 a94716 a94717 a94718 a94719 a94720 a94721 a94722 a94723 a94724 a94725 a94726 a94727 a94728 a94729 a94730 a94731 a94732 a94733 a94734 a94735 a94736 a94737 a94738 a94739 a94740 a94741 a94742 a94743 a94744 a94745 a94746 a94747 a94748 a94749 a94750 a94751 a94752 a94753 a94754 a94755 a94756 a94757 a94758 a94759 a94760 a94761 a94762 a94763 a94764 a94765 a94766 a94767 a94768 a94769 a94770 a94771 a94772 a94773 a94774 a94775 a94776 a94777 a94778 a94779 a94780 a94781 a94782 a94783 a94784 a94785 a94786 a94787 a94788 a94789 a94790 a94791 a94792 a94793 a94794 a94795 a94796 a94797 a94798 a94799 a94800 a94801 a94802 a94803 a94804 a94805 a94806 a94807 a94808 a94809 a94810 a94811 a94812 a94813 a94814 a94815 a94816 a94817 a94818 a94819 a94820 a94821 a94822 a94823 a94824 a94825 a94826 a94827 a94828 a94829 a94830 a94831 a94832 a94833 a94834 a94835 a94836 a94837 a94838 a94839 a94840 a94841 a94842 a94843 a94844 a94845 a94846 a94847 a94848 a94849 a94850 a94851 a94852 a94853 a94854 a94855 a94856 a94857 a94858 a94859 a94860 a94861 a94862 a94863 a94864 a94865 a94866 a94867 a94868 a94869 a94870 a94871 a94872 a94873 a94874 a94875 a94876 a94877 a94878 a94879 a94880 a94881 a94882 a94883 a94884 a94885 a94886 a94887 a94888 a94889 a94890 a94891 a94892 a94893 a94894 a94895 a94896 a94897 a94898 a94899 a94900 a94901 a94902 a94903 a94904 a94905 a94906 a94907 a94908 a94909 a94910 a94911 a94912 a94913 a94914 a94915 a94916 a94917 a94918 a94919 a94920 a94921 a94922 a94923 a94924 a94925 a94926 a94927 a94928 a94929 a94930 a94931 a94932 a94933 a94934 a94935 a94936 a94937 a94938 a94939 a94940 a94941 a94942 a94943 a94944 a94945 a94946 a94947 a94948 a94949 a94950 a94951 a94952 a94953 a94954 a94955 a94956 a94957 a94958 a94959 a94960 a94961 a94962 a94963 a94964 a94965 a94966 a94967 a94968 a94969 a94970 a94971 a94972 a94973 a94974 a94975 a94976 a94977 a94978 a94979 a94980 a94981 a94982 a94983 a94984 a94985 a94986 a94987 a94988 a94989 a94990 a94991 a94992 a94993 a94994 a94995 a94996 a94997 a94998 a94999 a95000 a95001 a95002 a95003 a95004 a95005 a95006 a95007 a95008 a95009 a95010 a95011 a95012 a95013 a95014 a95015 a95016 a95017 a95018 a95019 a95020 a95021 a95022 a95023 a95024 a95025 a95026 a95027 a95028 a95029 a95030 a95031 a95032 a95033 a95034 a95035 a95036 a95037 a95038 a95039 a95040 a95041 a95042 a95043 a95044 a95045 a95046 a95047 a95048 a95049 a95050 a95051 a95052 a95053 a95054 a95055 a95056 a95057 a95058 a95059 a95060 a95061 a95062 a95063 a95064 a95065 a95066 a95067 a95068 a95069 a95070 a95071 a95072 a95073 a95074 a95075 a95076 a95077 a95078 a95079 a95080 a95081 a95082 a95083 a95084 a95085 a95086 a95087 a95088 a95089 a95090 a95091 a95092 a95093 a95094 a95095 a95096 a95097 a95098 a95099 a95100 a95101 a95102 a95103 a95104 a95105 a95106 a95107 a95108 a95109 a95110 a95111 a95112 a95113 a95114 a95115 a95116 a95117 a95118 a95119 a95120 a95121 a95122 a95123 a95124 a95125 a95126 a95127 a95128 a95129 a95130 a95131 a95132 a95133 a95134 a95135 a95136 a95137 a95138 a95139 a95140 a95141 a95142 a95143 a95144 a95145 a95146 a95147 a95148 a95149 a95150 a95151 a95152 a95153 a95154 a95155 a95156 a95157 a95158 a95159 a95160 a95161 a95162 a95163 a95164 a95165 a95166 a95167 a95168 a95169 a95170 a95171 a95172 a95173 a95174 a95175 a95176 a95177 a95178 a95179 a95180 a95181 a95182 a95183 a95184 a95185 a95186 a95187 a95188 a95189 a95190 a95191 a95192 a95193 a95194 a95195 a95196 a95197 a95198 a95199 a95200 a95201 a95202 a95203 a95204 a95205 a95206 a95207 a95208 a95209 a95210 a95211 a95212 a95213 a95214 a95215 a95216 a95217 a95218 a95219 a95220 a95221 a95222 a95223 a95224 a95225 a95226 a95227 a95228 a95229 a95230 a95231 a95232 a95233 a95234 a95235 a95236 a95237 a95238 a95239 a95240 a95241 a95242 a95243 a95244 a95245 a95246 a95247 a95248 a95249 a95250 a95251 a95252 a95253 a95254 a95255 a95256 a95257 a95258 a95259 a95260 a95261 a95262 a95263 a95264 a95265 a95266 a95267 a95268 a95269 a95270 a95271 a95272 a95273 a95274 a95275 a95276 a95277 a95278 a95279 a95280 a95281 a95282 a95283 a95284 a95285 a95286 a95287 a95288 a95289 a95290 a95291 a95292 a95293 a95294 a95295 a95296 a95297 a95298 a95299 a95300 a95301 a95302 a95303 a95304 a95305 a95306 a95307 a95308 a95309 a95310 a95311 a95312 a95313 a95314 a95315 a95316 a95317 a95318 a95319 a95320 a95321 a95322 a95323 a95324 a95325 a95326 a95327 a95328 a95329 a95330 a95331 a95332 a95333 a95334 a95335 a95336 a95337 a95338 a95339 a95340 a95341 a95342 a95343 a95344 a95345 a95346 a95347 a95348 a95349 a95350 a95351 a95352 a95353 a95354 a95355 a95356 a95357 a95358 a95359 a95360 a95361 a95362 a95363 a95364 a95365 a95366 a95367 a95368 a95369 a95370 a95371 a95372 a95373 a95374 a95375 a95376 a95377 a95378 a95379 a95380 a95381 a95382 a95383 a95384 a95385 a95386 a95387 a95388 a95389 a95390 a95391 a95392 a95393 a95394 a95395 a95396 a95397 a95398 a95399 a95400 a95401 a95402 a95403 a95404 a95405 a95406 a95407 a95408 a95409 a95410 a95411 a95412 a95413 a95414 a95415 a95416 a95417 a95418 a95419 a95420 a95421 a95422 a95423 a95424 a95425 a95426 a95427 a95428 a95429 a95430 a95431 a95432 a95433 a95434 a95435 a95436 a95437 a95438 a95439 a95440 a95441 a95442 a95443 a95444 a95445 a95446 a95447 a95448 a95449 a95450 a95451 a95452 a95453 a95454 a95455 a95456 a95457 a95458 a95459 a95460 a95461 a95462 a95463 a95464 a95465 a95466 a95467 a95468 a95469 a95470 a95471 a95472 a95473 a95474 a95475 a95476 a95477 a95478 a95479 a95480 a95481 a95482 a95483 a95484 a95485 a95486 a95487 a95488 a95489 a95490 a95491 a95492 a95493 a95494 a95495 a95496 a95497 a95498 a95499 a95500 a95501 a95502 a95503 a95504 a95505 a95506 a95507 a95508 a95509 a95510 a95511 a95512 a95513 a95514 a95515 a95516 a95517 a95518 a95519 a95520 a95521 a95522 a95523 a95524 a95525 a95526 a95527 a95528 a95529 a95530 a95531 a95532 a95533 a95534 a95535 a95536 a95537 a95538 a95539 a95540 a95541 a95542 a95543 a95544 a95545 a95546 a95547 a95548 a95549 a95550 a95551 a95552 a95553 a95554 a95555 a95556 a95557 a95558 a95559 a95560 a95561 a95562 a95563 a95564 a95565 a95566 a95567 a95568 a95569 a95570 a95571 a95572 a95573 a95574 a95575 a95576 a95577 a95578 a95579 a95580 a95581 a95582 a95583 a95584 a95585 a95586 a95587 a95588 a95589 a95590 a95591 a95592 a95593 a95594 a95595 a95596 a95597 a95598 a95599 a95600 a95601 a95602 a95603 a95604 a95605 a95606 a95607 a95608 a95609 a95610 a95611 a95612 a95613 a95614 a95615 a95616 a95617 a95618 a95619 a95620 a95621 a95622 a95623 a95624 a95625 a95626 a95627 a95628 a95629 a95630 a95631 a95632 a95633 a95634 a95635 a95636 a95637 a95638 a95639 a95640 a95641 a95642 a95643 a95644 a95645 a95646 a95647 a95648 a95649 a95650 a95651 a95652 a95653 a95654 a95655 a95656 a95657 a95658 a95659 a95660 a95661 a95662 a95663 a95664 a95665 a95666 a95667 a95668 a95669 a95670 a95671 a95672 a95673 a95674 a95675 a95676 a95677 a95678 a95679 a95680 a95681 a95682 a95683 a95684 a95685 a95686 a95687 a95688 a95689 a95690 a95691 a95692 a95693 a95694 a95695 a95696 a95697 a95698 a95699 a95700 a95701 a95702 a95703 a95704 a95705 a95706 a95707 a95708 a95709 a95710 a95711 a95712 a95713 a95714 a95715 a95716 a95717 a95718 a95719 a95720 a95721 a95722 a95723 a95724 a95725 a95726 a95727 a95728 a95729 a95730 a95731 a95732 a95733 a95734 a95735 a95736 a95737 a95738 a95739 a95740 a95741 a95742 a95743 a95744 a95745 a95746 a95747 a95748 a95749 a95750 a95751 a95752 a95753 a95754 a95755 a95756 a95757 a95758 a95759 a95760 a95761 a95762 a95763 a95764 a95765 a95766 a95767 a95768 a95769 a95770 a95771 a95772 a95773 a95774 a95775 a95776 a95777 a95778 a95779 a95780 a95781 a95782 a95783 a95784 a95785 a95786 a95787 a95788 a95789 a95790 a95791 a95792 a95793 a95794 a95795 a95796 a95797 a95798 a95799 a95800 a95801 a95802 a95803 a95804 a95805 a95806 a95807 a95808 a95809 a95810 a95811 a95812 a95813 a95814 a95815 a95816 a95817 a95818 a95819 a95820 a95821 a95822 a95823 a95824 a95825 a95826 a95827 a95828 a95829 a95830 a95831 a95832 a95833 a95834 a95835 a95836 a95837 a95838 a95839 a95840 a95841 a95842 a95843 a95844 a95845 a95846 a95847 a95848 a95849 a95850 a95851 a95852 a95853 a95854 a95855 a95856 a95857 a95858 a95859 a95860 a95861 a95862 a95863 a95864 a95865 a95866 a95867 a95868 a95869 a95870 a95871 a95872 a95873 a95874 a95875 a95876 a95877 a95878 a95879 a95880 a95881 a95882 a95883 a95884 a95885 a95886 a95887 a95888 a95889 a95890 a95891 a95892 a95893 a95894 a95895 a95896 a95897 a95898 a95899 a95900 a95901 a95902 a95903 a95904 a95905 a95906 a95907 a95908 a95909 a95910 a95911 a95912 a95913 a95914 a95915 a95916 a95917 a95918 a95919 a95920 a95921 a95922 a95923 a95924 a95925 a95926 a95927 a95928 a95929 a95930 a95931 a95932 a95933 a95934 a95935 a95936 a95937 a95938 a95939 a95940 a95941 a95942 a95943 a95944 a95945 a95946 a95947 a95948 a95949 a95950 a95951 a95952 a95953 a95954 a95955 a95956 a95957 a95958 a95959 a95960 a95961 a95962 a95963 a95964 a95965 a95966 a95967 a95968 a95969 a95970 a95971 a95972 a95973 a95974 a95975 a95976 a95977 a95978 a95979 a95980 a95981 a95982 a95983 a95984 a95985 a95986 a95987 a95988 a95989 a95990 a95991 a95992 a95993 a95994 a95995 a95996 a95997 a95998 a95999 a96000 a96001 a96002 a96003 a96004 a96005 a96006 a96007 a96008 a96009 a96010 a96011 a96012 a96013 a96014 a96015 a96016 a96017 a96018 a96019 a96020 a96021 a96022 a96023 a96024 a96025 a96026 a96027 a96028 a96029 a96030 a96031 a96032 a96033 a96034 a96035 a96036 a96037 a96038 a96039 a96040 a96041 a96042 a96043 a96044 a96045 a96046 a96047 a96048 a96049 a96050 a96051 a96052 a96053 a96054 a96055 a96056 a96057 a96058 a96059 a96060 a96061 a96062 a96063 a96064 a96065 a96066 a96067 a96068 a96069 a96070 a96071 a96072 a96073 a96074 a96075 a96076 a96077 a96078 a96079 a96080 a96081 a96082 a96083 a96084 a96085 a96086 a96087 a96088 a96089 a96090 a96091 a96092 a96093 a96094 a96095 a96096 a96097 a96098 a96099 a96100 a96101 a96102 a96103 a96104 a96105 a96106 a96107 a96108 a96109 a96110 a96111 a96112 a96113 a96114 a96115 a96116 a96117 a96118 a96119 a96120 a96121 a96122 a96123 a96124 a96125 a96126 a96127 a96128 a96129 a96130 a96131 a96132 a96133 a96134 a96135 a96136 a96137 a96138 a96139 a96140 a96141 a96142 a96143 a96144 a96145 a96146 a96147 a96148 a96149 a96150 a96151 a96152 a96153 a96154 a96155 a96156 a96157 a96158 a96159 a96160 a96161 a96162 a96163 a96164 a96165 a96166 a96167 a96168 a96169 a96170 a96171 a96172 a96173 a96174 a96175 a96176 a96177 a96178 a96179 a96180 a96181 a96182 a96183 a96184 a96185 a96186 a96187 a96188 a96189 a96190 a96191 a96192 a96193 a96194 a96195 a96196 a96197 a96198 a96199 a96200 a96201 a96202 a96203 a96204 a96205 a96206 a96207 a96208 a96209 a96210 a96211 a96212 a96213 a96214 a96215 a96216 a96217 a96218 a96219 a96220 a96221 a96222 a96223 a96224 a96225 a96226 a96227 a96228 a96229 a96230 a96231 a96232 a96233 a96234 a96235 a96236 a96237 a96238 a96239 a96240 a96241 a96242 a96243 a96244 a96245 a96246 a96247 a96248 a96249 a96250 a96251 a96252 a96253 a96254 a96255 a96256 a96257 a96258 a96259 a96260 a96261 a96262 a96263 a96264 a96265 a96266 a96267 a96268 a96269 a96270 a96271 a96272 a96273 a96274 a96275 a96276 a96277 a96278 a96279 a96280 a96281 a96282 a96283 a96284 a96285 a96286 a96287 a96288 a96289 a96290 a96291 a96292 a96293 a96294 a96295 a96296 a96297 a96298 a96299 a96300 a96301 a96302 a96303 a96304 a96305 a96306 a96307 a96308 a96309 a96310 a96311 a96312 a96313 a96314 a96315 a96316 a96317 a96318 a96319 a96320 a96321 a96322 a96323 a96324 a96325 a96326 a96327 a96328 a96329 a96330 a96331 a96332 a96333 a96334 a96335 a96336 a96337 a96338 a96339 a96340 a96341 a96342 a96343 a96344 a96345 a96346 a96347 a96348 a96349 a96350 a96351 a96352 a96353 a96354 a96355 a96356 a96357 a96358 a96359 a96360 a96361 a96362 a96363 a96364 a96365 a96366 a96367 a96368 a96369 a96370 a96371 a96372 a96373 a96374 a96375 a96376 a96377 a96378 a96379 a96380 a96381 a96382 a96383 a96384 a96385 a96386 a96387 a96388 a96389 a96390 a96391 a96392 a96393 a96394 a96395 a96396 a96397 a96398 a96399 a96400 a96401 a96402 a96403 a96404 a96405 a96406 a96407 a96408 a96409 a96410 a96411 a96412 a96413 a96414 a96415 a96416 a96417 a96418 a96419 a96420 a96421 a96422 a96423 a96424 a96425 a96426 a96427 a96428 a96429 a96430 a96431 a96432 a96433 a96434 a96435 a96436 a96437 a96438 a96439 a96440 a96441 a96442 a96443 a96444 a96445 a96446 a96447 a96448 a96449 a96450 a96451 a96452 a96453 a96454 a96455 a96456 a96457 a96458 a96459 a96460 a96461 a96462 a96463 a96464 a96465 a96466 a96467 a96468 a96469 a96470 a96471 a96472 a96473 a96474 a96475 a96476 a96477 a96478 a96479 a96480 a96481 a96482 a96483 a96484 a96485 a96486 a96487 a96488 a96489 a96490 a96491 a96492 a96493 a96494 a96495 a96496 a96497 a96498 a96499 a96500 a96501 a96502 a96503 a96504 a96505 a96506 a96507 a96508 a96509 a96510 a96511 a96512 a96513 a96514 a96515 a96516 a96517 a96518 a96519 a96520 a96521 a96522 a96523 a96524 a96525 a96526 a96527 a96528 a96529 a96530 a96531 a96532 a96533 a96534 a96535 a96536 a96537 a96538 a96539 a96540 a96541 a96542 a96543 a96544 a96545 a96546 a96547 a96548 a96549 a96550 a96551 a96552 a96553 a96554 a96555 a96556 a96557 a96558 a96559 a96560 a96561 a96562 a96563 a96564 a96565 a96566 a96567 a96568 a96569 a96570 a96571 a96572 a96573 a96574 a96575 a96576 a96577 a96578 a96579 a96580 a96581 a96582 a96583 a96584 a96585 a96586 a96587 a96588 a96589 a96590 a96591 a96592 a96593 a96594 a96595 a96596 a96597 a96598 a96599 a96600 a96601 a96602 a96603 a96604 a96605 a96606 a96607 a96608 a96609 a96610 a96611 a96612 a96613 a96614 a96615 a96616 a96617 a96618 a96619 a96620 a96621 a96622 a96623 a96624 a96625 a96626 a96627 a96628 a96629 a96630 a96631 a96632 a96633 a96634 a96635 a96636 a96637 a96638 a96639 a96640 a96641 a96642 a96643 a96644 a96645 a96646 a96647 a96648 a96649 a96650 a96651 a96652 a96653 a96654 a96655 a96656 a96657 a96658 a96659 a96660 a96661 a96662 a96663 a96664 a96665 a96666 a96667 a96668 a96669 a96670 a96671 a96672 a96673 a96674 a96675 a96676 a96677 a96678 a96679 a96680 a96681 a96682 a96683 a96684 a96685 a96686 a96687 a96688 a96689 a96690 a96691 a96692 a96693 a96694 a96695 a96696 a96697 a96698 a96699 a96700 a96701 a96702 a96703 a96704 a96705 a96706 a96707 a96708 a96709 a96710 a96711 a96712 a96713 a96714 a96715 a96716 a96717 a96718 a96719 a96720 a96721 a96722 a96723 a96724 a96725 a96726 a96727 a96728 a96729 a96730 a96731 a96732 a96733 a96734 a96735 a96736 a96737 a96738 a96739 a96740 a96741 a96742 a96743 a96744 a96745 a96746 a96747 a96748 a96749 a96750 a96751 a96752 a96753 a96754 a96755 a96756 a96757 a96758 a96759 a96760 a96761 a96762 a96763 a96764 a96765 a96766 a96767 a96768 a96769 a96770 a96771 a96772 a96773 a96774 a96775 a96776 a96777 a96778 a96779 a96780 a96781 a96782 a96783 a96784 a96785 a96786 a96787 a96788 a96789 a96790 a96791 a96792 a96793 a96794 a96795 a96796 a96797 a96798 a96799 a96800 a96801 a96802 a96803 a96804 a96805 a96806 a96807 a96808 a96809 a96810 a96811 a96812 a96813 a96814 a96815 a96816 a96817 a96818 a96819 a96820 a96821 a96822 a96823 a96824 a96825 a96826 a96827 a96828 a96829 a96830 a96831 a96832 a96833 a96834 a96835 a96836 a96837 a96838 a96839 a96840 a96841 a96842 a96843 a96844 a96845 a96846 a96847 a96848 a96849 a96850 a96851 a96852 a96853 a96854 a96855 a96856 a96857 a96858 a96859 a96860 a96861 a96862 a96863 a96864 a96865 a96866 a96867 a96868 a96869 a96870 a96871 a96872 a96873 a96874 a96875 a96876 a96877 a96878 a96879 a96880 a96881 a96882 a96883 a96884 a96885 a96886 a96887 a96888 a96889 a96890 a96891 a96892 a96893 a96894 a96895 a96896 a96897 a96898 a96899 a96900 a96901 a96902 a96903 a96904 a96905 a96906 a96907 a96908 a96909 a96910 a96911 a96912 a96913 a96914 a96915 a96916 a96917 a96918 a96919 a96920 a96921 a96922 a96923 a96924 a96925 a96926 a96927 a96928 a96929 a96930 a96931 a96932 a96933 a96934 a96935 a96936 a96937 a96938 a96939 a96940 a96941 a96942 a96943 a96944 a96945 a96946 a96947 a96948 a96949 a96950 a96951 a96952 a96953 a96954 a96955 a96956 a96957 a96958 a96959 a96960 a96961 a96962 a96963 a96964 a96965 a96966 a96967 a96968 a96969 a96970 a96971 a96972 a96973 a96974 a96975 a96976 a96977 a96978 a96979 a96980 a96981 a96982 a96983 a96984 a96985 a96986 a96987 a96988 a96989 a96990 a96991 a96992 a96993 a96994 a96995 a96996 a96997 a96998 a96999 a97000 a97001 a97002 a97003 a97004 a97005 a97006 a97007 a97008 a97009 a97010 a97011 a97012 a97013 a97014 a97015 a97016 a97017 a97018 a97019 a97020 a97021 a97022 a97023 a97024 a97025 a97026 a97027 a97028 a97029 a97030 a97031 a97032 a97033 a97034 a97035 a97036 a97037 a97038 a97039 a97040 a97041 a97042 a97043 a97044 a97045 a97046 a97047 a97048 a97049 a97050 a97051 a97052 a97053 a97054 a97055 a97056 a97057 a97058 a97059 a97060 a97061 a97062 a97063 a97064 a97065 a97066 a97067 a97068 a97069 a97070 a97071 a97072 a97073 a97074 a97075 a97076 a97077 a97078 a97079 a97080 a97081 a97082 a97083 a97084 a97085 a97086 a97087 a97088 a97089 a97090 a97091 a97092 a97093 a97094 a97095 a97096 a97097 a97098 a97099 a97100 a97101 a97102 a97103 a97104 a97105 a97106 a97107 a97108 a97109 a97110 a97111 a97112 a97113 a97114 a97115 a97116 a97117 a97118 a97119 a97120 a97121 a97122 a97123 a97124 a97125 a97126 a97127 a97128 a97129 a97130 a97131 a97132 a97133 a97134 a97135 a97136 a97137 a97138 a97139 a97140 a97141 a97142 a97143 a97144 a97145 a97146 a97147 a97148 a97149 a97150 a97151 a97152 a97153 a97154 a97155 a97156 a97157 a97158 a97159 a97160 a97161 a97162 a97163 a97164 a97165 a97166 a97167 a97168 a97169 a97170 a97171 a97172 a97173 a97174 a97175 a97176 a97177 a97178 a97179 a97180 a97181 a97182 a97183 a97184 a97185 a97186 a97187 a97188 a97189 a97190 a97191 a97192 a97193 a97194 a97195 a97196 a97197 a97198 a97199 a97200 a97201 a97202 a97203 a97204 a97205 a97206 a97207 a97208 a97209 a97210 a97211 a97212 a97213 a97214 a97215 a97216 a97217 a97218 a97219 a97220 a97221 a97222 a97223 a97224 a97225 a97226 a97227 a97228 a97229 a97230 a97231 a97232 a97233 a97234 a97235 a97236 a97237 a97238 a97239 a97240 a97241 a97242 a97243 a97244 a97245 a97246 a97247 a97248 a97249 a97250 a97251 a97252 a97253 a97254 a97255 a97256 a97257 a97258 a97259 a97260 a97261 a97262 a97263 a97264 a97265 a97266 a97267 a97268 a97269 a97270 a97271 a97272 a97273 a97274 a97275 a97276 a97277 a97278 a97279 a97280 a97281 a97282 a97283 a97284 a97285 a97286 a97287 a97288 a97289 a97290 a97291 a97292 a97293 a97294 a97295 a97296 a97297 a97298 a97299 a97300 a97301 a97302 a97303 a97304 a97305 a97306 a97307 a97308 a97309 a97310 a97311 a97312 a97313 a97314 a97315 a97316 a97317 a97318 a97319 a97320 a97321 a97322 a97323 a97324 a97325 a97326 a97327 a97328 a97329 a97330 a97331 a97332 a97333 a97334 a97335 a97336 a97337 a97338 a97339 a97340 a97341 a97342 a97343 a97344 a97345 a97346 a97347 a97348 a97349 a97350 a97351 a97352 a97353 a97354 a97355 a97356 a97357 a97358 a97359 a97360 a97361 a97362 a97363 a97364 a97365 a97366 a97367 a97368 a97369 a97370 a97371 a97372 a97373 a97374 a97375 a97376 a97377 a97378 a97379 a97380 a97381 a97382 a97383 a97384 a97385 a97386 a97387 a97388 a97389 a97390 a97391 a97392 a97393 a97394 a97395 a97396 a97397 a97398 a97399 a97400 a97401 a97402 a97403 a97404 a97405 a97406 a97407 a97408 a97409 a97410 a97411 a97412 a97413 a97414 a97415 a97416 a97417 a97418 a97419 a97420 a97421 a97422 a97423 a97424 a97425 a97426 a97427 a97428 a97429 a97430 a97431 a97432 a97433 a97434 a97435 a97436 a97437 a97438 a97439 a97440 a97441 a97442 a97443 a97444 a97445 a97446 a97447 a97448 a97449 a97450 a97451 a97452 a97453 a97454 a97455 a97456 a97457 a97458 a97459 a97460 a97461 a97462 a97463 a97464 a97465 a97466 a97467 a97468 a97469 a97470 a97471 a97472 a97473 a97474 a97475 a97476 a97477 a97478 a97479 a97480 a97481 a97482 a97483 a97484 a97485 a97486 a97487 a97488 a97489 a97490 a97491 a97492 a97493 a97494 a97495 a97496 a97497 a97498 a97499 a97500 a97501 a97502 a97503 a97504 a97505 a97506 a97507 a97508 a97509 a97510 a97511 a97512 a97513 a97514 a97515 a97516 a97517 a97518 a97519 a97520 a97521 a97522 a97523 a97524 a97525 a97526 a97527 a97528 a97529 a97530 a97531 a97532 a97533 a97534 a97535 a97536 a97537 a97538 a97539 a97540 a97541 a97542 a97543 a97544 a97545 a97546 a97547 a97548 a97549 a97550 a97551 a97552 a97553 a97554 a97555 a97556 a97557 a97558 a97559 a97560 a97561 a97562 a97563 a97564 a97565 a97566 a97567 a97568 a97569 a97570 a97571 a97572 a97573 a97574 a97575 a97576 a97577 a97578 a97579 a97580 a97581 a97582 a97583 a97584 a97585 a97586 a97587 a97588 a97589 a97590 a97591 a97592 a97593 a97594 a97595 a97596 a97597 a97598 a97599 a97600 a97601 a97602 a97603 a97604 a97605 a97606 a97607 a97608 a97609 a97610 a97611 a97612 a97613 a97614 a97615 a97616 a97617 a97618 a97619 a97620 a97621 a97622 a97623 a97624 a97625 a97626 a97627 a97628 a97629 a97630 a97631 a97632 a97633 a97634 a97635 a97636 a97637 a97638 a97639 a97640 a97641 a97642 a97643 a97644 a97645 a97646 a97647 a97648 a97649 a97650 a97651 a97652 a97653 a97654 a97655 a97656 a97657 a97658 a97659 a97660 a97661 a97662 a97663 a97664 a97665 a97666 a97667 a97668 a97669 a97670 a97671 a97672 a97673 a97674 a97675 a97676 a97677 a97678 a97679 a97680 a97681 a97682 a97683 a97684 a97685 a97686 a97687 a97688 a97689 a97690 a97691 a97692 a97693 a97694 a97695 a97696 a97697 a97698 a97699 a97700 a97701 a97702 a97703 a97704 a97705 a97706 a97707 a97708 a97709 a97710 a97711 a97712 a97713 a97714 a97715 a97716 a97717 a97718 a97719 a97720 a97721 a97722 a97723 a97724 a97725 a97726 a97727 a97728 a97729 a97730 a97731 a97732 a97733 a97734 a97735 a97736 a97737 a97738 a97739 a97740 a97741 a97742 a97743 a97744 a97745 a97746 a97747 a97748 a97749 a97750 a97751 a97752 a97753 a97754 a97755 a97756 a97757 a97758 a97759 a97760 a97761 a97762 a97763 a97764 a97765 a97766 a97767 a97768 a97769 a97770 a97771 a97772 a97773 a97774 a97775 a97776 a97777 a97778 a97779 a97780 a97781 a97782 a97783 a97784 a97785 a97786 a97787 a97788 a97789 a97790 a97791 a97792 a97793 a97794 a97795 a97796 a97797 a97798 a97799 a97800 a97801 a97802 a97803 a97804 a97805 a97806 a97807 a97808 a97809 a97810 a97811 a97812 a97813 a97814 a97815 a97816 a97817 a97818 a97819 a97820 a97821 a97822 a97823 a97824 a97825 a97826 a97827 a97828 a97829 a97830 a97831 a97832 a97833 a97834 a97835 a97836 a97837 a97838 a97839 a97840 a97841 a97842 a97843 a97844 a97845 a97846 a97847 a97848 a97849 a97850 a97851 a97852 a97853 a97854 a97855 a97856 a97857 a97858 a97859 a97860 a97861 a97862 a97863 a97864 a97865 a97866 a97867 a97868 a97869 a97870 a97871 a97872 a97873 a97874 a97875 a97876 a97877 a97878 a97879 a97880 a97881 a97882 a97883 a97884 a97885 a97886 a97887 a97888 a97889 a97890 a97891 a97892 a97893 a97894 a97895 a97896 a97897 a97898 a97899 a97900 a97901 a97902 a97903 a97904 a97905 a97906 a97907 a97908 a97909 a97910 a97911 a97912 a97913 a97914 a97915 a97916 a97917 a97918 a97919 a97920 a97921 a97922 a97923 a97924 a97925 a97926 a97927 a97928 a97929 a97930 a97931 a97932 a97933 a97934 a97935 a97936 a97937 a97938 a97939 a97940 a97941 a97942 a97943 a97944 a97945 a97946 a97947 a97948 a97949 a97950 a97951 a97952 a97953 a97954 a97955 a97956 a97957 a97958 a97959 a97960 a97961 a97962 a97963 a97964 a97965 a97966 a97967 a97968 a97969 a97970 a97971 a97972 a97973 a97974 a97975 a97976 a97977 a97978 a97979 a97980 a97981 a97982 a97983 a97984 a97985 a97986 a97987 a97988 a97989 a97990 a97991 a97992 a97993 a97994 a97995 a97996 a97997 a97998 a97999 a98000 a98001 a98002 a98003 a98004 a98005 a98006 a98007 a98008 a98009 a98010 a98011 a98012 a98013 a98014 a98015 a98016 a98017 a98018 a98019 a98020 a98021 a98022 a98023 a98024 a98025 a98026 a98027 a98028 a98029 a98030 a98031 a98032 a98033 a98034 a98035 a98036 a98037 a98038 a98039 a98040 a98041 a98042 a98043 a98044 a98045 a98046 a98047 a98048 a98049 a98050 a98051 a98052 a98053 a98054 a98055 a98056 a98057 a98058 a98059 a98060 a98061 a98062 a98063 a98064 a98065 a98066 a98067 a98068 a98069 a98070 a98071 a98072 a98073 a98074 a98075 a98076 a98077 a98078 a98079 a98080 a98081 a98082 a98083 a98084 a98085 a98086 a98087 a98088 a98089 a98090 a98091 a98092 a98093 a98094 a98095 a98096 a98097 a98098 a98099 a98100 a98101 a98102 a98103 a98104 a98105 a98106 a98107 a98108 a98109 a98110 a98111 a98112 a98113 a98114 a98115 a98116 a98117 a98118 a98119 a98120 a98121 a98122 a98123 a98124 a98125 a98126 a98127 a98128 a98129 a98130 a98131 a98132 a98133 a98134 a98135 a98136 a98137 a98138 a98139 a98140 a98141 a98142 a98143 a98144 a98145 a98146 a98147 a98148 a98149 a98150 a98151 a98152 a98153 a98154 a98155 a98156 a98157 a98158 a98159 a98160 a98161 a98162 a98163 a98164 a98165 a98166 a98167 a98168 a98169 a98170 a98171 a98172 a98173 a98174 a98175 a98176 a98177 a98178 a98179 a98180 a98181 a98182 a98183 a98184 a98185 a98186 a98187 a98188 a98189 a98190 a98191 a98192 a98193 a98194 a98195 a98196 a98197 a98198 a98199 a98200 a98201 a98202 a98203 a98204 a98205 a98206 a98207 a98208 a98209 a98210 a98211 a98212 a98213 a98214 a98215 a98216 a98217 a98218 a98219 a98220 a98221 a98222 a98223 a98224 a98225 a98226 a98227 a98228 a98229 a98230 a98231 a98232 a98233 a98234 a98235 a98236 a98237 a98238 a98239 a98240 a98241 a98242 a98243 a98244 a98245 a98246 a98247 a98248 a98249 a98250 a98251 a98252 a98253 a98254 a98255 a98256 a98257 a98258 a98259 a98260 a98261 a98262 a98263 a98264 a98265 a98266 a98267 a98268 a98269 a98270 a98271 a98272 a98273 a98274 a98275 a98276 a98277 a98278 a98279 a98280 a98281 a98282 a98283 a98284 a98285 a98286 a98287 a98288 a98289 a98290 a98291 a98292 a98293 a98294 a98295 a98296 a98297 a98298 a98299 a98300 a98301 a98302 a98303 a98304 a98305 a98306 a98307 a98308 a98309 a98310 a98311 a98312 a98313 a98314 a98315 a98316 a98317 a98318 a98319 a98320 a98321 a98322 a98323 a98324 a98325 a98326 a98327 a98328 a98329 a98330 a98331 a98332 a98333 a98334 a98335 a98336 a98337 a98338 a98339 a98340 a98341 a98342 a98343 a98344 a98345 a98346 a98347 a98348 a98349 a98350 a98351 a98352 a98353 a98354 a98355 a98356 a98357 a98358 a98359 a98360 a98361 a98362 a98363 a98364 a98365 a98366 a98367 a98368 a98369 a98370 a98371 a98372 a98373 a98374 a98375 a98376 a98377 a98378 a98379 a98380 a98381 a98382 a98383 a98384 a98385 a98386 a98387 a98388 a98389 a98390 a98391 a98392 a98393 a98394 a98395 a98396 a98397 a98398 a98399 a98400 a98401 a98402 a98403 a98404 a98405 a98406 a98407 a98408 a98409 a98410 a98411 a98412 a98413 a98414 a98415 a98416 a98417 a98418 a98419 a98420 a98421 a98422 a98423 a98424 a98425 a98426 a98427 a98428 a98429 a98430 a98431 a98432 a98433 a98434 a98435 a98436 a98437 a98438 a98439 a98440 a98441 a98442 a98443 a98444 a98445 a98446 a98447 a98448 a98449 a98450 a98451 a98452 a98453 a98454 a98455 a98456 a98457 a98458 a98459 a98460 a98461 a98462 a98463 a98464 a98465 a98466 a98467 a98468 a98469 a98470 a98471 a98472 a98473 a98474 a98475 a98476 a98477 a98478 a98479 a98480 a98481 a98482 a98483 a98484 a98485 a98486 a98487 a98488 a98489 a98490 a98491 a98492 a98493 a98494 a98495 a98496 a98497 a98498 a98499 a98500 a98501 a98502 a98503 a98504 a98505 a98506 a98507 a98508 a98509 a98510 a98511 a98512 a98513 a98514 a98515 a98516 a98517 a98518 a98519 a98520 a98521 a98522 a98523 a98524 a98525 a98526 a98527 a98528 a98529 a98530 a98531 a98532 a98533 a98534 a98535 a98536 a98537 a98538 a98539 a98540 a98541 a98542 a98543 a98544 a98545 a98546 a98547 a98548 a98549 a98550 a98551 a98552 a98553 a98554 a98555 a98556 a98557 a98558 a98559 a98560 a98561 a98562 a98563 a98564 a98565 a98566 a98567 a98568 a98569 a98570 a98571 a98572 a98573 a98574 a98575 a98576 a98577 a98578 a98579 a98580 a98581 a98582 a98583 a98584 a98585 a98586 a98587 a98588 a98589 a98590 a98591 a98592 a98593 a98594 a98595 a98596 a98597 a98598 a98599 a98600 a98601 a98602 a98603 a98604 a98605 a98606 a98607 a98608 a98609 a98610 a98611 a98612 a98613 a98614 a98615 a98616 a98617 a98618 a98619 a98620 a98621 a98622 a98623 a98624 a98625 a98626 a98627 a98628 a98629 a98630 a98631 a98632 a98633 a98634 a98635 a98636 a98637 a98638 a98639 a98640 a98641 a98642 a98643 a98644 a98645 a98646 a98647 a98648 a98649 a98650 a98651 a98652 a98653 a98654 a98655 a98656 a98657 a98658 a98659 a98660 a98661 a98662 a98663 a98664 a98665 a98666 a98667 a98668 a98669 a98670 a98671 a98672 a98673 a98674 a98675 a98676 a98677 a98678 a98679 a98680 a98681 a98682 a98683 a98684 a98685 a98686 a98687 a98688 a98689 a98690 a98691 a98692 a98693 a98694 a98695 a98696 a98697 a98698 a98699 a98700 a98701 a98702 a98703 a98704 a98705 a98706 a98707 a98708 a98709 a98710 a98711 a98712 a98713 a98714 a98715 a98716 a98717 a98718 a98719 a98720 a98721 a98722 a98723 a98724 a98725 a98726 a98727 a98728 a98729 a98730 a98731 a98732 a98733 a98734 a98735 a98736 a98737 a98738 a98739 a98740 a98741 a98742 a98743 a98744 a98745 a98746 a98747 a98748 a98749 a98750 a98751 a98752 a98753 a98754 a98755 a98756 a98757 a98758 a98759 a98760 a98761 a98762 a98763 a98764 a98765 a98766 a98767 a98768 a98769 a98770 a98771 a98772 a98773 a98774 a98775 a98776 a98777 a98778 a98779 a98780 a98781 a98782 a98783 a98784 a98785 a98786 a98787 a98788 a98789 a98790 a98791 a98792 a98793 a98794 a98795 a98796 a98797 a98798 a98799 a98800 a98801 a98802 a98803 a98804 a98805 a98806 a98807 a98808 a98809 a98810 a98811 a98812 a98813 a98814 a98815 a98816 a98817 a98818 a98819 a98820 a98821 a98822 a98823 a98824 a98825 a98826 a98827 a98828 a98829 a98830 a98831 a98832 a98833 a98834 a98835 a98836 a98837 a98838 a98839 a98840 a98841 a98842 a98843 a98844 a98845 a98846 a98847 a98848 a98849 a98850 a98851 a98852 a98853 a98854 a98855 a98856 a98857 a98858 a98859 a98860 a98861 a98862 a98863 a98864 a98865 a98866 a98867 a98868 a98869 a98870 a98871 a98872 a98873 a98874 a98875 a98876 a98877 a98878 a98879 a98880 a98881 a98882 a98883 a98884 a98885 a98886 a98887 a98888 a98889 a98890 a98891 a98892 a98893 a98894 a98895 a98896 a98897 a98898 a98899 a98900 a98901 a98902 a98903 a98904 a98905 a98906 a98907 a98908 a98909 a98910 a98911 a98912 a98913 a98914 a98915 a98916 a98917 a98918 a98919 a98920 a98921 a98922 a98923 a98924 a98925 a98926 a98927 a98928 a98929 a98930 a98931 a98932 a98933 a98934 a98935 a98936 a98937 a98938 a98939 a98940 a98941 a98942 a98943 a98944 a98945 a98946 a98947 a98948 a98949 a98950 a98951 a98952 a98953 a98954 a98955 a98956 a98957 a98958 a98959 a98960 a98961 a98962 a98963 a98964 a98965 a98966 a98967 a98968 a98969 a98970 a98971 a98972 a98973 a98974 a98975 a98976 a98977 a98978 a98979 a98980 a98981 a98982 a98983 a98984 a98985 a98986 a98987 a98988 a98989 a98990 a98991 a98992 a98993 a98994 a98995 a98996 a98997 a98998 a98999 a99000 a99001 a99002 a99003 a99004 a99005 a99006 a99007 a99008 a99009 a99010 a99011 a99012 a99013 a99014 a99015 a99016 a99017 a99018 a99019 a99020 a99021 a99022 a99023 a99024 a99025 a99026 a99027 a99028 a99029 a99030 a99031 a99032 a99033 a99034 a99035 a99036 a99037 a99038 a99039 a99040 a99041 a99042 a99043 a99044 a99045 a99046 a99047 a99048 a99049 a99050 a99051 a99052 a99053 a99054 a99055 a99056 a99057 a99058 a99059 a99060 a99061 a99062 a99063 a99064 a99065 a99066 a99067 a99068 a99069 a99070 a99071 a99072 a99073 a99074 a99075 a99076 a99077 a99078 a99079 a99080 a99081 a99082 a99083 a99084 a99085 a99086 a99087 a99088 a99089 a99090 a99091 a99092 a99093 a99094 a99095 a99096 a99097 a99098 a99099 a99100 a99101 a99102 a99103 a99104 a99105 a99106 a99107 a99108 a99109 a99110 a99111 a99112 a99113 a99114 a99115 a99116 a99117 a99118 a99119 a99120 a99121 a99122 a99123 a99124 a99125 a99126 a99127 a99128 a99129 a99130 a99131 a99132 a99133 a99134 a99135 a99136 a99137 a99138 a99139 a99140 a99141 a99142 a99143 a99144 a99145 a99146 a99147 a99148 a99149 a99150 a99151 a99152 a99153 a99154 a99155 a99156 a99157 a99158 a99159 a99160 a99161 a99162 a99163 a99164 a99165 a99166 a99167 a99168 a99169 a99170 a99171 a99172 a99173 a99174 a99175 a99176 a99177 a99178 a99179 a99180 a99181 a99182 a99183 a99184 a99185 a99186 a99187 a99188 a99189 a99190 a99191 a99192 a99193 a99194 a99195 a99196 a99197 a99198 a99199 a99200 a99201 a99202 a99203 a99204 a99205 a99206 a99207 a99208 a99209 a99210 a99211 a99212 a99213 a99214 a99215 a99216 a99217 a99218 a99219 a99220 a99221 a99222 a99223 a99224 a99225 a99226 a99227 a99228 a99229 a99230 a99231 a99232 a99233 a99234 a99235 a99236 a99237 a99238 a99239 a99240 a99241 a99242 a99243 a99244 a99245 a99246 a99247 a99248 a99249 a99250 a99251 a99252 a99253 a99254 a99255 a99256 a99257 a99258 a99259 a99260 a99261 a99262 a99263 a99264 a99265 a99266 a99267 a99268 a99269 a99270 a99271 a99272 a99273 a99274 a99275 a99276 a99277 a99278 a99279 a99280 a99281 a99282 a99283 a99284 a99285 a99286 a99287 a99288 a99289 a99290 a99291 a99292 a99293 a99294 a99295 a99296 a99297 a99298 a99299 a99300 a99301 a99302 a99303 a99304 a99305 a99306 a99307 a99308 a99309 a99310 a99311 a99312 a99313 a99314 a99315 a99316 a99317 a99318 a99319 a99320 a99321 a99322 a99323 a99324 a99325 a99326 a99327 a99328 a99329 a99330 a99331 a99332 a99333 a99334 a99335 a99336 a99337 a99338 a99339 a99340 a99341 a99342 a99343 a99344 a99345 a99346 a99347 a99348 a99349 a99350 a99351 a99352 a99353 a99354 a99355 a99356 a99357 a99358 a99359 a99360 a99361 a99362 a99363 a99364 a99365 a99366 a99367 a99368 a99369 a99370 a99371 a99372 a99373 a99374 a99375 a99376 a99377 a99378 a99379 a99380 a99381 a99382 a99383 a99384 a99385 a99386 a99387 a99388 a99389 a99390 a99391 a99392 a99393 a99394 a99395 a99396 a99397 a99398 a99399 a99400 a99401 a99402 a99403 a99404 a99405 a99406 a99407 a99408 a99409 a99410 a99411 a99412 a99413 a99414 a99415 a99416 a99417 a99418 a99419 a99420 a99421 a99422 a99423 a99424 a99425 a99426 a99427 a99428 a99429 a99430 a99431 a99432 a99433 a99434 a99435 a99436 a99437 a99438 a99439 a99440 a99441 a99442 a99443 a99444 a99445 a99446 a99447 a99448 a99449 a99450 a99451 a99452 a99453 a99454 a99455 a99456 a99457 a99458 a99459 a99460 a99461 a99462 a99463 a99464 a99465 a99466 a99467 a99468 a99469 a99470 a99471 a99472 a99473 a99474 a99475 a99476 a99477 a99478 a99479 a99480 a99481 a99482 a99483 a99484 a99485 a99486 a99487 a99488 a99489 a99490 a99491 a99492 a99493 a99494 a99495 a99496 a99497 a99498 a99499 a99500 a99501 a99502 a99503 a99504 a99505 a99506 a99507 a99508 a99509 a99510 a99511 a99512 a99513 a99514 a99515 a99516 a99517 a99518 a99519 a99520 a99521 a99522 a99523 a99524 a99525 a99526 a99527 a99528 a99529 a99530 a99531 a99532 a99533 a99534 a99535 a99536 a99537 a99538 a99539 a99540 a99541 a99542 a99543 a99544 a99545 a99546 a99547 a99548 a99549 a99550 a99551 a99552 a99553 a99554 a99555 a99556 a99557 a99558 a99559 a99560 a99561 a99562 a99563 a99564 a99565 a99566 a99567 a99568 a99569 a99570 a99571 a99572 a99573 a99574 a99575 a99576 a99577 a99578 a99579 a99580 a99581 a99582 a99583 a99584 a99585 a99586 a99587 a99588 a99589 a99590 a99591 a99592 a99593 a99594 a99595 a99596 a99597 a99598 a99599 a99600 a99601 a99602 a99603 a99604 a99605 a99606 a99607 a99608 a99609 a99610 a99611 a99612 a99613 a99614 a99615 a99616 a99617 a99618 a99619 a99620 a99621 a99622 a99623 a99624 a99625 a99626 a99627 a99628 a99629 a99630 a99631 a99632 a99633 a99634 a99635 a99636 a99637 a99638 a99639 a99640 a99641 a99642 a99643 a99644 a99645 a99646 a99647 a99648 a99649 a99650 a99651 a99652 a99653 a99654 a99655 a99656 a99657 a99658 a99659 a99660 a99661 a99662 a99663 a99664 a99665 a99666 a99667 a99668 a99669 a99670 a99671 a99672 a99673 a99674 a99675 a99676 a99677 a99678 a99679 a99680 a99681 a99682 a99683 a99684 a99685 a99686 a99687 a99688 a99689 a99690 a99691 a99692 a99693 a99694 a99695 a99696 a99697 a99698 a99699 a99700 a99701 a99702 a99703 a99704 a99705 a99706 a99707 a99708 a99709 a99710 a99711 a99712 a99713 a99714 a99715 a99716 a99717 a99718 a99719 a99720 a99721 a99722 a99723 a99724 a99725 a99726 a99727 a99728 a99729 a99730 a99731 a99732 a99733 a99734 a99735 a99736 a99737 a99738 a99739 a99740 a99741 a99742 a99743 a99744 a99745 a99746 a99747 a99748 a99749 a99750 a99751 a99752 a99753 a99754 a99755 a99756 a99757 a99758 a99759 a99760 a99761 a99762 a99763 a99764 a99765 a99766 a99767 a99768 a99769 a99770 a99771 a99772 a99773 a99774 a99775 a99776 a99777 a99778 a99779 a99780 a99781 a99782 a99783 a99784 a99785 a99786 a99787 a99788 a99789 a99790 a99791 a99792 a99793 a99794 a99795 a99796 a99797 a99798 a99799 a99800 a99801 a99802 a99803 a99804 a99805 a99806 a99807 a99808 a99809 a99810 a99811 a99812 a99813 a99814 a99815 a99816 a99817 a99818 a99819 a99820 a99821 a99822 a99823 a99824 a99825 a99826 a99827 a99828 a99829 a99830 a99831 a99832 a99833 a99834 a99835 a99836 a99837 a99838 a99839 a99840 a99841 a99842 a99843 a99844 a99845 a99846 a99847 a99848 a99849 a99850 a99851 a99852 a99853 a99854 a99855 a99856 a99857 a99858 a99859 a99860 a99861 a99862 a99863 a99864 a99865 a99866 a99867 a99868 a99869 a99870 a99871 a99872 a99873 a99874 a99875 a99876 a99877 a99878 a99879 a99880 a99881 a99882 a99883 a99884 a99885 a99886 a99887 a99888 a99889 a99890 a99891 a99892 a99893 a99894 a99895 a99896 a99897 a99898 a99899 a99900 a99901 a99902 a99903 a99904 a99905 a99906 a99907 a99908 a99909 a99910 a99911 a99912 a99913 a99914 a99915 a99916 a99917 a99918 a99919 a99920 a99921 a99922 a99923 a99924 a99925 a99926 a99927 a99928 a99929 a99930 a99931 a99932 a99933 a99934 a99935 a99936 a99937 a99938 a99939 a99940 a99941 a99942 a99943 a99944 a99945 a99946 a99947 a99948 a99949 a99950 a99951 a99952 a99953 a99954 a99955 a99956 a99957 a99958 a99959 a99960 a99961 a99962 a99963 a99964 a99965 a99966 a99967 a99968 a99969 a99970 a99971 a99972 a99973 a99974 a99975 a99976 a99977 a99978 a99979 a99980 a99981 a99982 a99983 a99984 a99985 a99986 a99987 a99988 a99989 a99990 a99991 a99992 a99993 a99994 a99995 a99996 a99997 a99998 a99999 a100000 | wc -w
@@ -0,0 +1,35 @@
+#!/usr/bin/perl
+# Generates the stress corpus: scripts at the limits of what the shell
+# handles, with the output they must print. Their time and memory budgets
+# are in tests/stress/budgets.
+#
+# Run from the top of the repository, the files are checked in.
+use 5.16.0;
+use warnings FATAL => 'all';
+
+my $dir = "tests/stress";
+
+sub case {
+    my ($name, $script, $output) = @_;
+    for my $file (["$name.sh", $script], ["$name.out", $output]) {
+        open(my $fh, ">", "$dir/$file->[0]") or die "$file->[0]: $!";
+        print $fh $file->[1];
+        close($fh);
+    }
+}
+
+# Subshells kept in the shell, then ones that each need a process of their
+# own since cd must not change the one outside.
+case("nest-10000", "(" x 10000 . "echo deep" . ")" x 10000 . "\n", "deep\n");
+case("nest-cd-500", "(cd /; " x 500 . "pwd" . ")" x 500 . "\n", "/\n");
+
+case("and-or-100k",
+     ":&&" x 50000 . "echo and\n" . "false||" x 50000 . "echo or\n",
+     "and\nor\n");
+
+case("pipe-300", "seq 1000" . " | cat" x 300 . " | wc -l\n", "1000\n");
+
+my $args = join("", map { " a$_" } 1 .. 100000);
+case("argv-100k-builtin", "echo$args | wc -w\n", "100000\n");
+case("argv-100k-exec", "/bin/echo$args | wc -c\n",
+     length($args) . "\n");
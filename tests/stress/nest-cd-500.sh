@@ -0,0 +1 @@
+(cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; (cd /; pwd))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
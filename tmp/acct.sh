@@ -0,0 +1,4 @@
+sleep 0.1 &
+seq 3 | wc -l
+(exit 3)
+wait
@@ -0,0 +1,6 @@
+echo a b > tmp/c1.txt
+cat < tmp/c1.txt && echo ok || echo no
+cat <<EOF
+hi
+EOF
+(echo sub; echo x) | tr a-z A-Z
@@ -0,0 +1 @@
+nushstat -m | grep -o tokens=[0-9]*
@@ -0,0 +1,6 @@
+cat <<EOF <<-X )
+echo body
+EOF
+	echo tabbed
+	X
+echo after the error
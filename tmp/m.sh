@@ -0,0 +1,7 @@
+echo a
+echo ab
+echo "xy" `echo z`
+cat <<E; echo 
+body
+E
+echo after
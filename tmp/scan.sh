@@ -0,0 +1,2 @@
+echo 1"a|b;(c) " d\\e&&f 2>&1;echo 2"a|b;(c) " d\\e&&f 2>&1;echo 3"a|b;(c) " d\\e&&f 2>&1;echo 4"a|b;(c) " d\\e&&f 2>&1;echo 5"a|b;(c) " d\\e&&f 2>&1;echo 6"a|b;(c) " d\\e&&f 2>&1;echo 7"a|b;(c) " d\\e&&f 2>&1;echo 8"a|b;(c) " d\\e&&f 2>&1;echo 9"a|b;(c) " d\\e&&f 2>&1;echo 10"a|b;(c) " d\\e&&f 2>&1;echo 11"a|b;(c) " d\\e&&f 2>&1;echo 12"a|b;(c) " d\\e&&f 2>&1;echo 13"a|b;(c) " d\\e&&f 2>&1;echo 14"a|b;(c) " d\\e&&f 2>&1;echo 15"a|b;(c) " d\\e&&f 2>&1;echo 16"a|b;(c) " d\\e&&f 2>&1;echo 17"a|b;(c) " d\\e&&f 2>&1;echo 18"a|b;(c) " d\\e&&f 2>&1;echo 19"a|b;(c) " d\\e&&f 2>&1;echo 20"a|b;(c) " d\\e&&f 2>&1;echo 21"a|b;(c) " d\\e&&f 2>&1;echo 22"a|b;(c) " d\\e&&f 2>&1;echo 23"a|b;(c) " d\\e&&f 2>&1;echo 24"a|b;(c) " d\\e&&f 2>&1;echo 25"a|b;(c) " d\\e&&f 2>&1;echo 26"a|b;(c) " d\\e&&f 2>&1;echo 27"a|b;(c) " d\\e&&f 2>&1;echo 28"a|b;(c) " d\\e&&f 2>&1;echo 29"a|b;(c) " d\\e&&f 2>&1;echo 30"a|b;(c) " d\\e&&f 2>&1;echo 31"a|b;(c) " d\\e&&f 2>&1;echo 32"a|b;(c) " d\\e&&f 2>&1;echo 33"a|b;(c) " d\\e&&f 2>&1;echo 34"a|b;(c) " d\\e&&f 2>&1;echo 35"a|b;(c) " d\\e&&f 2>&1;echo 36"a|b;(c) " d\\e&&f 2>&1;echo 37"a|b;(c) " d\\e&&f 2>&1;echo 38"a|b;(c) " d\\e&&f 2>&1;echo 39"a|b;(c) " d\\e&&f 2>&1;echo 40"a|b;(c) " d\\e&&f 2>&1;echo 41"a|b;(c) " d\\e&&f 2>&1;echo 42"a|b;(c) " d\\e&&f 2>&1;echo 43"a|b;(c) " d\\e&&f 2>&1;echo 44"a|b;(c) " d\\e&&f 2>&1;echo 45"a|b;(c) " d\\e&&f 2>&1;echo 46"a|b;(c) " d\\e&&f 2>&1;echo 47"a|b;(c) " d\\e&&f 2>&1;echo 48"a|b;(c) " d\\e&&f 2>&1;echo 49"a|b;(c) " d\\e&&f 2>&1;echo 50"a|b;(c) " d\\e&&f 2>&1;echo 51"a|b;(c) " d\\e&&f 2>&1;echo 52"a|b;(c) " d\\e&&f 2>&1;echo 53"a|b;(c) " d\\e&&f 2>&1;echo 54"a|b;(c) " d\\e&&f 2>&1;echo 55"a|b;(c) " d\\e&&f 2>&1;echo 56"a|b;(c) " d\\e&&f 2>&1;echo 57"a|b;(c) " d\\e&&f 2>&1;echo 58"a|b;(c) " d\\e&&f 2>&1;echo 59"a|b;(c) " d\\e&&f 2>&1;echo 60"a|b;(c) " d\\e&&f 2>&1;echo 61"a|b;(c) " d\\e&&f 2>&1;echo 62"a|b;(c) " d\\e&&f 2>&1;echo 63"a|b;(c) " d\\e&&f 2>&1;echo 64"a|b;(c) " d\\e&&f 2>&1;echo 65"a|b;(c) " d\\e&&f 2>&1;echo 66"a|b;(c) " d\\e&&f 2>&1;echo 67"a|b;(c) " d\\e&&f 2>&1;echo 68"a|b;(c) " d\\e&&f 2>&1;echo 69"a|b;(c) " d\\e&&f 2>&1;echo 70"a|b;(c) " d\\e&&f 2>&1;echo 71"a|b;(c) " d\\e&&f 2>&1;echo 72"a|b;(c) " d\\e&&f 2>&1;echo 73"a|b;(c) " d\\e&&f 2>&1;echo 74"a|b;(c) " d\\e&&f 2>&1;echo 75"a|b;(c) " d\\e&&f 2>&1;echo 76"a|b;(c) " d\\e&&f 2>&1;echo 77"a|b;(c) " d\\e&&f 2>&1;echo 78"a|b;(c) " d\\e&&f 2>&1;echo 79"a|b;(c) " d\\e&&f 2>&1;echo 80"a|b;(c) " d\\e&&f 2>&1;echo 81"a|b;(c) " d\\e&&f 2>&1;echo 82"a|b;(c) " d\\e&&f 2>&1;echo 83"a|b;(c) " d\\e&&f 2>&1;echo 84"a|b;(c) " d\\e&&f 2>&1;echo 85"a|b;(c) " d\\e&&f 2>&1;echo 86"a|b;(c) " d\\e&&f 2>&1;echo 87"a|b;(c) " d\\e&&f 2>&1;echo 88"a|b;(c) " d\\e&&f 2>&1;echo 89"a|b;(c) " d\\e&&f 2>&1;echo 90"a|b;(c) " d\\e&&f 2>&1;echo 91"a|b;(c) " d\\e&&f 2>&1;echo 92"a|b;(c) " d\\e&&f 2>&1;echo 93"a|b;(c) " d\\e&&f 2>&1;echo 94"a|b;(c) " d\\e&&f 2>&1;echo 95"a|b;(c) " d\\e&&f 2>&1;echo 96"a|b;(c) " d\\e&&f 2>&1;echo 97"a|b;(c) " d\\e&&f 2>&1;echo 98"a|b;(c) " d\\e&&f 2>&1;echo 99"a|b;(c) " d\\e&&f 2>&1;echo 100"a|b;(c) " d\\e&&f 2>&1;echo 101"a|b;(c) " d\\e&&f 2>&1;echo 102"a|b;(c) " d\\e&&f 2>&1;echo 103"a|b;(c) " d\\e&&f 2>&1;echo 104"a|b;(c) " d\\e&&f 2>&1;echo 105"a|b;(c) " d\\e&&f 2>&1;echo 106"a|b;(c) " d\\e&&f 2>&1;echo 107"a|b;(c) " d\\e&&f 2>&1;echo 108"a|b;(c) " d\\e&&f 2>&1;echo 109"a|b;(c) " d\\e&&f 2>&1;echo 110"a|b;(c) " d\\e&&f 2>&1;echo 111"a|b;(c) " d\\e&&f 2>&1;echo 112"a|b;(c) " d\\e&&f 2>&1;echo 113"a|b;(c) " d\\e&&f 2>&1;echo 114"a|b;(c) " d\\e&&f 2>&1;echo 115"a|b;(c) " d\\e&&f 2>&1;echo 116"a|b;(c) " d\\e&&f 2>&1;echo 117"a|b;(c) " d\\e&&f 2>&1;echo 118"a|b;(c) " d\\e&&f 2>&1;echo 119"a|b;(c) " d\\e&&f 2>&1;echo 120"a|b;(c) " d\\e&&f 2>&1;echo 121"a|b;(c) " d\\e&&f 2>&1;echo 122"a|b;(c) " d\\e&&f 2>&1;echo 123"a|b;(c) " d\\e&&f 2>&1;echo 124"a|b;(c) " d\\e&&f 2>&1;echo 125"a|b;(c) " d\\e&&f 2>&1;echo 126"a|b;(c) " d\\e&&f 2>&1;echo 127"a|b;(c) " d\\e&&f 2>&1;echo 128"a|b;(c) " d\\e&&f 2>&1;echo 129"a|b;(c) " d\\e&&f 2>&1;echo 130"a|b;(c) " d\\e&&f 2>&1;echo 131"a|b;(c) " d\\e&&f 2>&1;echo 132"a|b;(c) " d\\e&&f 2>&1;echo 133"a|b;(c) " d\\e&&f 2>&1;echo 134"a|b;(c) " d\\e&&f 2>&1;echo 135"a|b;(c) " d\\e&&f 2>&1;echo 136"a|b;(c) " d\\e&&f 2>&1;echo 137"a|b;(c) " d\\e&&f 2>&1;echo 138"a|b;(c) " d\\e&&f 2>&1;echo 139"a|b;(c) " d\\e&&f 2>&1;echo 140"a|b;(c) " d\\e&&f 2>&1;echo 141"a|b;(c) " d\\e&&f 2>&1;echo 142"a|b;(c) " d\\e&&f 2>&1;echo 143"a|b;(c) " d\\e&&f 2>&1;echo 144"a|b;(c) " d\\e&&f 2>&1;echo 145"a|b;(c) " d\\e&&f 2>&1;echo 146"a|b;(c) " d\\e&&f 2>&1;echo 147"a|b;(c) " d\\e&&f 2>&1;echo 148"a|b;(c) " d\\e&&f 2>&1;echo 149"a|b;(c) " d\\e&&f 2>&1;echo 150"a|b;(c) " d\\e&&f 2>&1;echo 151"a|b;(c) " d\\e&&f 2>&1;echo 152"a|b;(c) " d\\e&&f 2>&1;echo 153"a|b;(c) " d\\e&&f 2>&1;echo 154"a|b;(c) " d\\e&&f 2>&1;echo 155"a|b;(c) " d\\e&&f 2>&1;echo 156"a|b;(c) " d\\e&&f 2>&1;echo 157"a|b;(c) " d\\e&&f 2>&1;echo 158"a|b;(c) " d\\e&&f 2>&1;echo 159"a|b;(c) " d\\e&&f 2>&1;echo 160"a|b;(c) " d\\e&&f 2>&1;echo 161"a|b;(c) " d\\e&&f 2>&1;echo 162"a|b;(c) " d\\e&&f 2>&1;echo 163"a|b;(c) " d\\e&&f 2>&1;echo 164"a|b;(c) " d\\e&&f 2>&1;echo 165"a|b;(c) " d\\e&&f 2>&1;echo 166"a|b;(c) " d\\e&&f 2>&1;echo 167"a|b;(c) " d\\e&&f 2>&1;echo 168"a|b;(c) " d\\e&&f 2>&1;echo 169"a|b;(c) " d\\e&&f 2>&1;echo 170"a|b;(c) " d\\e&&f 2>&1;echo 171"a|b;(c) " d\\e&&f 2>&1;echo 172"a|b;(c) " d\\e&&f 2>&1;echo 173"a|b;(c) " d\\e&&f 2>&1;echo 174"a|b;(c) " d\\e&&f 2>&1;echo 175"a|b;(c) " d\\e&&f 2>&1;echo 176"a|b;(c) " d\\e&&f 2>&1;echo 177"a|b;(c) " d\\e&&f 2>&1;echo 178"a|b;(c) " d\\e&&f 2>&1;echo 179"a|b;(c) " d\\e&&f 2>&1;echo 180"a|b;(c) " d\\e&&f 2>&1;echo 181"a|b;(c) " d\\e&&f 2>&1;echo 182"a|b;(c) " d\\e&&f 2>&1;echo 183"a|b;(c) " d\\e&&f 2>&1;echo 184"a|b;(c) " d\\e&&f 2>&1;echo 185"a|b;(c) " d\\e&&f 2>&1;echo 186"a|b;(c) " d\\e&&f 2>&1;echo 187"a|b;(c) " d\\e&&f 2>&1;echo 188"a|b;(c) " d\\e&&f 2>&1;echo 189"a|b;(c) " d\\e&&f 2>&1;echo 190"a|b;(c) " d\\e&&f 2>&1;echo 191"a|b;(c) " d\\e&&f 2>&1;echo 192"a|b;(c) " d\\e&&f 2>&1;echo 193"a|b;(c) " d\\e&&f 2>&1;echo 194"a|b;(c) " d\\e&&f 2>&1;echo 195"a|b;(c) " d\\e&&f 2>&1;echo 196"a|b;(c) " d\\e&&f 2>&1;echo 197"a|b;(c) " d\\e&&f 2>&1;echo 198"a|b;(c) " d\\e&&f 2>&1;echo 199"a|b;(c) " d\\e&&f 2>&1;echo 200"a|b;(c) " d\\e&&f 2>&1;echo 201"a|b;(c) " d\\e&&f 2>&1;echo 202"a|b;(c) " d\\e&&f 2>&1;echo 203"a|b;(c) " d\\e&&f 2>&1;echo 204"a|b;(c) " d\\e&&f 2>&1;echo 205"a|b;(c) " d\\e&&f 2>&1;echo 206"a|b;(c) " d\\e&&f 2>&1;echo 207"a|b;(c) " d\\e&&f 2>&1;echo 208"a|b;(c) " d\\e&&f 2>&1;echo 209"a|b;(c) " d\\e&&f 2>&1;echo 210"a|b;(c) " d\\e&&f 2>&1;echo 211"a|b;(c) " d\\e&&f 2>&1;echo 212"a|b;(c) " d\\e&&f 2>&1;echo 213"a|b;(c) " d\\e&&f 2>&1;echo 214"a|b;(c) " d\\e&&f 2>&1;echo 215"a|b;(c) " d\\e&&f 2>&1;echo 216"a|b;(c) " d\\e&&f 2>&1;echo 217"a|b;(c) " d\\e&&f 2>&1;echo 218"a|b;(c) " d\\e&&f 2>&1;echo 219"a|b;(c) " d\\e&&f 2>&1;echo 220"a|b;(c) " d\\e&&f 2>&1;echo 221"a|b;(c) " d\\e&&f 2>&1;echo 222"a|b;(c) " d\\e&&f 2>&1;echo 223"a|b;(c) " d\\e&&f 2>&1;echo 224"a|b;(c) " d\\e&&f 2>&1;echo 225"a|b;(c) " d\\e&&f 2>&1;echo 226"a|b;(c) " d\\e&&f 2>&1;echo 227"a|b;(c) " d\\e&&f 2>&1;echo 228"a|b;(c) " d\\e&&f 2>&1;echo 229"a|b;(c) " d\\e&&f 2>&1;echo 230"a|b;(c) " d\\e&&f 2>&1;echo 231"a|b;(c) " d\\e&&f 2>&1;echo 232"a|b;(c) " d\\e&&f 2>&1;echo 233"a|b;(c) " d\\e&&f 2>&1;echo 234"a|b;(c) " d\\e&&f 2>&1;echo 235"a|b;(c) " d\\e&&f 2>&1;echo 236"a|b;(c) " d\\e&&f 2>&1;echo 237"a|b;(c) " d\\e&&f 2>&1;echo 238"a|b;(c) " d\\e&&f 2>&1;echo 239"a|b;(c) " d\\e&&f 2>&1;echo 240"a|b;(c) " d\\e&&f 2>&1;echo 241"a|b;(c) " d\\e&&f 2>&1;echo 242"a|b;(c) " d\\e&&f 2>&1;echo 243"a|b;(c) " d\\e&&f 2>&1;echo 244"a|b;(c) " d\\e&&f 2>&1;echo 245"a|b;(c) " d\\e&&f 2>&1;echo 246"a|b;(c) " d\\e&&f 2>&1;echo 247"a|b;(c) " d\\e&&f 2>&1;echo 248"a|b;(c) " d\\e&&f 2>&1;echo 249"a|b;(c) " d\\e&&f 2>&1;echo 250"a|b;(c) " d\\e&&f 2>&1;echo 251"a|b;(c) " d\\e&&f 2>&1;echo 252"a|b;(c) " d\\e&&f 2>&1;echo 253"a|b;(c) " d\\e&&f 2>&1;echo 254"a|b;(c) " d\\e&&f 2>&1;echo 255"a|b;(c) " d\\e&&f 2>&1;echo 256"a|b;(c) " d\\e&&f 2>&1;echo 257"a|b;(c) " d\\e&&f 2>&1;echo 258"a|b;(c) " d\\e&&f 2>&1;echo 259"a|b;(c) " d\\e&&f 2>&1;echo 260"a|b;(c) " d\\e&&f 2>&1;echo 261"a|b;(c) " d\\e&&f 2>&1;echo 262"a|b;(c) " d\\e&&f 2>&1;echo 263"a|b;(c) " d\\e&&f 2>&1;echo 264"a|b;(c) " d\\e&&f 2>&1;echo 265"a|b;(c) " d\\e&&f 2>&1;echo 266"a|b;(c) " d\\e&&f 2>&1;echo 267"a|b;(c) " d\\e&&f 2>&1;echo 268"a|b;(c) " d\\e&&f 2>&1;echo 269"a|b;(c) " d\\e&&f 2>&1;echo 270"a|b;(c) " d\\e&&f 2>&1;echo 271"a|b;(c) " d\\e&&f 2>&1;echo 272"a|b;(c) " d\\e&&f 2>&1;echo 273"a|b;(c) " d\\e&&f 2>&1;echo 274"a|b;(c) " d\\e&&f 2>&1;echo 275"a|b;(c) " d\\e&&f 2>&1;echo 276"a|b;(c) " d\\e&&f 2>&1;echo 277"a|b;(c) " d\\e&&f 2>&1;echo 278"a|b;(c) " d\\e&&f 2>&1;echo 279"a|b;(c) " d\\e&&f 2>&1;echo 280"a|b;(c) " d\\e&&f 2>&1;echo 281"a|b;(c) " d\\e&&f 2>&1;echo 282"a|b;(c) " d\\e&&f 2>&1;echo 283"a|b;(c) " d\\e&&f 2>&1;echo 284"a|b;(c) " d\\e&&f 2>&1;echo 285"a|b;(c) " d\\e&&f 2>&1;echo 286"a|b;(c) " d\\e&&f 2>&1;echo 287"a|b;(c) " d\\e&&f 2>&1;echo 288"a|b;(c) " d\\e&&f 2>&1;echo 289"a|b;(c) " d\\e&&f 2>&1;echo 290"a|b;(c) " d\\e&&f 2>&1;echo 291"a|b;(c) " d\\e&&f 2>&1;echo 292"a|b;(c) " d\\e&&f 2>&1;echo 293"a|b;(c) " d\\e&&f 2>&1;echo 294"a|b;(c) " d\\e&&f 2>&1;echo 295"a|b;(c) " d\\e&&f 2>&1;echo 296"a|b;(c) " d\\e&&f 2>&1;echo 297"a|b;(c) " d\\e&&f 2>&1;echo 298"a|b;(c) " d\\e&&f 2>&1;echo 299"a|b;(c) " d\\e&&f 2>&1;echo 300
+